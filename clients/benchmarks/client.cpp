@@ -30,7 +30,9 @@
 #include "hipblas_data.hpp"
 #include "hipblas_datatype2string.hpp"
 #include "hipblas_parse_data.hpp"
+#include "hipblas_replay.hpp"
 #include "hipblas_test.hpp"
+#include "hipblas_tune.hpp"
 #include "test_cleanup.hpp"
 #include "type_dispatch.hpp"
 #include "utility.h"
@@ -128,6 +130,25 @@ void fix_batch(int argc, char* argv[])
         }
 }
 
+// --api takes the name of the interface or its number in hipblas_client_api
+hipblas_client_api string2hipblas_client_api(const std::string& value)
+{
+    static const std::map<std::string, hipblas_client_api> apis
+        = {{"C", C}, {"C_64", C_64}, {"FORTRAN", FORTRAN}, {"FORTRAN_64", FORTRAN_64}};
+
+    std::string name(value);
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    auto it = apis.find(name);
+    if(it != apis.end())
+        return it->second;
+
+    for(const auto& api : apis)
+        if(name == std::to_string(api.second))
+            return api.second;
+
+    throw std::invalid_argument("Invalid value for --api " + value);
+}
+
 int main(int argc, char* argv[])
 try
 {
@@ -144,8 +165,10 @@ try
     std::string initialization;
     int         device_id;
     int         parallel_devices;
-    int32_t     api     = 0;
+    std::string api;
     bool        fortran = false;
+    std::string replay;
+    std::string tune;
 
     bool datafile            = hipblas_parse_data(argc, argv);
     bool atomics_not_allowed = false;
@@ -258,11 +281,11 @@ try
 
         ("a_type",
          value<std::string>(&a_type), "Precision of matrix A. "
-         "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
+         "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f8_r,bf8_r,f32_c,f64_c,i8_r,i32_r")
 
         ("b_type",
          value<std::string>(&b_type), "Precision of matrix B. "
-         "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f32_c,f64_c,i8_r,i32_r")
+         "Options: h,s,d,c,z,f16_r,f32_r,f64_r,bf16_r,f8_r,bf8_r,f32_c,f64_c,i8_r,i32_r")
 
         ("c_type",
          value<std::string>(&c_type), "Precision of matrix C. "
@@ -305,6 +328,18 @@ try
          value<char>(&arg.diag)->default_value('N'),
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm xtrsm_ex xtrsv xtrmm
 
+        ("jobz",
+         value<char>(&arg.jobz)->default_value('V'),
+         "V = eigenvalues and eigenvectors, N = eigenvalues only. Only applicable to certain routines") // xsyevd xheevd
+
+        ("jobu",
+         value<char>(&arg.jobu)->default_value('S'),
+         "A = all left singular vectors, S = the first min(m,n), N = none. Only applicable to certain routines") // xgesvd xgesvdj
+
+        ("jobv",
+         value<char>(&arg.jobv)->default_value('S'),
+         "A = all right singular vectors, S = the first min(m,n), N = none. Only applicable to certain routines") // xgesvd xgesvdj
+
         ("batch_count",
          value<int64_t>(&arg.batch_count)->default_value(1),
          "Number of matrices. Only applicable to batched and strided_batched routines")
@@ -331,16 +366,31 @@ try
 
         ("solution_index",
          value<int32_t>(&arg.solution_index)->default_value(0),
-         "extended precision gemm solution index")
+         "extended precision gemm solution index listed by hipblasGemmExGetSolutions, 0 for the "
+         "default. Only used by hipblas_v2-bench with the rocBLAS backend")
 
         ("flags",
          value<uint32_t>(&arg.flags)->default_value(0),
          "gemm_ex flags")
 
+        ("epilogue",
+         value<int>(&arg.epilogue)->default_value(HIPBLAS_EPILOGUE_DEFAULT),
+         "hipblasEpilogue_t applied by gemm_epilogue_ex: 1 = none, 2 = relu, 4 = bias, "
+         "6 = relu and bias, 32 = gelu, 36 = gelu and bias. Results are written to a matrix of "
+         "type d_type with leading dimension ldd, or to C with --inplace true")
+
+        ("epilogue_scale",
+         bool_switch(&arg.epilogue_scale)->default_value(false),
+         "gemm_epilogue_ex scales the rows and columns of the result")
+
         ("atomics_not_allowed",
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
+        ("workspace",
+         value<size_t>(&arg.user_allocated_workspace)->default_value(0),
+         "Set fixed workspace memory size in bytes instead of using library managed memory")
+
         ("device",
          value<int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -349,9 +399,9 @@ try
          value<int>(&parallel_devices)->default_value(0),
          "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
 
-        // ("c_noalias_d",
-        //  bool_switch(&arg.c_noalias_d)->default_value(false),
-        //  "C and D are stored in separate memory")
+        ("c_noalias_d",
+         bool_switch(&arg.c_noalias_d)->default_value(false),
+         "C and D are stored in separate memory, the gemm_ex functions call the WithD variants")
 
         ("log_function_name",
          bool_switch(&log_function_name)->default_value(false),
@@ -366,8 +416,17 @@ try
          "Run using Fortran interface")
 
         ("api",
-         value<int32_t>(&api)->default_value(0),
-         "Use API, supercedes fortran flag (0==C, 1==C_64, ...)")
+         value<std::string>(&api)->default_value(""),
+         "Use API, supercedes fortran flag: C, C_64, FORTRAN or FORTRAN_64 (or 0, 1, 2, 3)")
+
+        ("replay",
+         value<std::string>(&replay)->default_value(""),
+         "Replay the calls of a trace written with HIPBLAS_LAYER=1, timed with --iters and --cold_iters")
+
+        ("tune",
+         value<std::string>(&tune)->default_value(""),
+         "Time every solution of a gemm_ex, gemm_batched_ex or gemm_strided_batched_ex problem and "
+         "add the fastest to this gemm tuning file, read by the library from HIPBLAS_TUNING_PATH")
 
         ("help,h", "produces this help message");
 
@@ -397,8 +456,8 @@ try
 
     arg.atomics_mode = atomics_not_allowed ? HIPBLAS_ATOMICS_NOT_ALLOWED : HIPBLAS_ATOMICS_ALLOWED;
 
-    if(api)
-        arg.api = hipblas_client_api(api);
+    if(!api.empty())
+        arg.api = string2hipblas_client_api(api);
     else if(fortran)
         arg.api = FORTRAN;
 
@@ -417,6 +476,9 @@ try
     if(datafile)
         return hipblas_bench_datafile();
 
+    if(!replay.empty())
+        return hipblas_bench_replay(replay, arg);
+
     std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
     auto prec = string2hipblas_datatype(precision);
     if(prec == HIPBLAS_DATATYPE_INVALID)
@@ -459,6 +521,9 @@ try
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
+    if(!tune.empty())
+        return hipblas_bench_tune(tune, arg);
+
     if(!parallel_devices)
         return run_bench_test(arg, 0, 1);
     else
@@ -0,0 +1,813 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_datatype2string.hpp"
+#include "hipblas_replay.hpp"
+#include "hipblas_test.hpp"
+#include "type_utils.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Address of a pointer, handle or stream as printed in the trace, 0 for null
+    uintptr_t hipblas_replay_address(const std::string& value)
+    {
+        if(value.empty() || value == "0" || value == "(nil)" || value == "nil")
+            return 0;
+        return uintptr_t(std::stoull(value, nullptr, 16));
+    }
+
+    struct hipblas_replay_type
+    {
+        const char* name;
+        hipDataType type;
+        size_t      size;
+    };
+
+    const hipblas_replay_type hipblas_replay_types[] = {
+        {"f16_r", HIP_R_16F, 2},
+        {"f32_r", HIP_R_32F, 4},
+        {"f64_r", HIP_R_64F, 8},
+        {"f16_c", HIP_C_16F, 4},
+        {"f32_c", HIP_C_32F, 8},
+        {"f64_c", HIP_C_64F, 16},
+        {"i8_r", HIP_R_8I, 1},
+        {"u8_r", HIP_R_8U, 1},
+        {"i32_r", HIP_R_32I, 4},
+        {"u32_r", HIP_R_32U, 4},
+        {"i8_c", HIP_C_8I, 2},
+        {"u8_c", HIP_C_8U, 2},
+        {"i32_c", HIP_C_32I, 8},
+        {"u32_c", HIP_C_32U, 8},
+        {"bf16_r", HIP_R_16BF, 2},
+        {"bf16_c", HIP_C_16BF, 4},
+    };
+
+    const hipblas_replay_type* hipblas_replay_find_type(const std::string& name)
+    {
+        for(auto& type : hipblas_replay_types)
+            if(name == type.name)
+                return &type;
+        return nullptr;
+    }
+
+    template <typename P>
+    P hipblas_replay_enum(const std::string& value)
+    {
+        if constexpr(std::is_same<P, hipblasOperation_t>{})
+            return value == "T" ? HIPBLAS_OP_T : value == "C" ? HIPBLAS_OP_C : HIPBLAS_OP_N;
+        else if constexpr(std::is_same<P, hipblasFillMode_t>{})
+            return value == "L"   ? HIPBLAS_FILL_MODE_LOWER
+                   : value == "F" ? HIPBLAS_FILL_MODE_FULL
+                                  : HIPBLAS_FILL_MODE_UPPER;
+        else if constexpr(std::is_same<P, hipblasDiagType_t>{})
+            return value == "U" ? HIPBLAS_DIAG_UNIT : HIPBLAS_DIAG_NON_UNIT;
+        else if constexpr(std::is_same<P, hipblasSideMode_t>{})
+            return value == "R" ? HIPBLAS_SIDE_RIGHT
+                   : value == "B" ? HIPBLAS_SIDE_BOTH
+                                  : HIPBLAS_SIDE_LEFT;
+        else if constexpr(std::is_same<P, hipDataType>{})
+        {
+            const hipblas_replay_type* type = hipblas_replay_find_type(value);
+            if(!type)
+                throw std::invalid_argument("Invalid datatype in trace: " + value);
+            return type->type;
+        }
+#ifndef HIPBLAS_V2
+        else if constexpr(std::is_same<P, hipblasDatatype_t>{})
+            return string2hipblas_datatype(value);
+#endif
+        else if constexpr(std::is_same<P, hipblasComputeType_t>{})
+            return string2hipblas_computetype(value);
+        else if constexpr(std::is_same<P, hipblasPointerMode_t>{})
+            return value == "device" ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST;
+        else if constexpr(std::is_same<P, hipblasAtomicsMode_t>{})
+            return value == "not_allowed" ? HIPBLAS_ATOMICS_NOT_ALLOWED : HIPBLAS_ATOMICS_ALLOWED;
+        else
+            return P(std::stoll(value));
+    }
+
+    bool hipblas_replay_rot(const hipblas_replay_record& record)
+    {
+        std::string function = record.function;
+        std::transform(function.begin(), function.end(), function.begin(), ::tolower);
+        return function.find("rot") != std::string::npos;
+    }
+
+    // Arguments holding one scalar per batch instance rather than a vector or matrix
+    bool hipblas_replay_scalar_name(const hipblas_replay_record& record, const std::string& name)
+    {
+        static const std::set<std::string> scalars = {"alpha", "beta", "result", "info"};
+        static const std::set<std::string> rot_scalars
+            = {"a", "b", "c", "s", "d1", "d2", "x1", "y1", "param"};
+        return scalars.count(name) || (hipblas_replay_rot(record) && rot_scalars.count(name));
+    }
+
+    // Pointer arguments read or written on the host in host pointer mode, and the info
+    // argument of the solvers which always report argument errors on the host
+    bool hipblas_replay_host_pointer(const hipblas_replay_record& record, const std::string& name)
+    {
+        if(name == "info")
+            return record.function.find("getrs") != std::string::npos
+                   || record.function.find("geqrf") != std::string::npos
+                   || record.function.find("gels") != std::string::npos;
+        return record.pointer_mode == HIPBLAS_POINTER_MODE_HOST
+               && hipblas_replay_scalar_name(record, name);
+    }
+
+    // Size of an element of a void* argument, given by its datatype argument: aType for A,
+    // xType for x, csType for c and s
+    size_t hipblas_replay_untyped_size(const hipblas_replay_record& record,
+                                       const std::string&           name)
+    {
+        std::string type_name = name;
+        type_name[0]          = char(tolower(type_name[0]));
+        type_name += "Type";
+
+        const std::string* value = record.find(type_name);
+        if(!value && (name == "c" || name == "s"))
+            value = record.find("csType");
+        if(value)
+            if(const hipblas_replay_type* type = hipblas_replay_find_type(*value))
+                return type->size;
+
+        size_t size = 0;
+        for(auto& arg : record.args)
+            if(const hipblas_replay_type* type = hipblas_replay_find_type(arg.second))
+                size = std::max(size, type->size);
+        return size ? size : 16;
+    }
+
+    template <typename T>
+    size_t hipblas_replay_size(const hipblas_replay_record& record, const std::string& name)
+    {
+        if constexpr(std::is_void<T>{})
+            return hipblas_replay_untyped_size(record, name);
+        else
+            return sizeof(T);
+    }
+
+    enum class hipblas_replay_scalar
+    {
+        f16,
+        bf16,
+        f32,
+        f64,
+        c32,
+        c64,
+        i32,
+    };
+
+    // Type of alpha and beta, from the pointee type or for void* from the alphaType,
+    // executionType or compute type argument
+    template <typename T>
+    hipblas_replay_scalar hipblas_replay_scalar_of(const hipblas_replay_record& record)
+    {
+        if constexpr(std::is_same<T, float>{})
+            return hipblas_replay_scalar::f32;
+        else if constexpr(std::is_same<T, double>{})
+            return hipblas_replay_scalar::f64;
+        else if constexpr(std::is_same<T, hipblasHalf>{})
+            return hipblas_replay_scalar::f16;
+        else if constexpr(std::is_same<T, hipblasBfloat16>{})
+            return hipblas_replay_scalar::bf16;
+        else if constexpr(!std::is_void<T>{})
+            return sizeof(T) == 2 * sizeof(float) ? hipblas_replay_scalar::c32
+                                                  : hipblas_replay_scalar::c64;
+        else
+        {
+            bool complex = false;
+            for(auto& arg : record.args)
+                if(const hipblas_replay_type* type = hipblas_replay_find_type(arg.second))
+                    complex |= type->name[strlen(type->name) - 1] == 'c';
+
+            for(const char* name : {"alphaType", "executionType", "compute_type", "computeType"})
+            {
+                const std::string* value = record.find(name);
+                if(!value)
+                    continue;
+                const std::string& v = *value;
+                if(v == "f16_r" || !v.compare(0, 4, "c16f"))
+                    return hipblas_replay_scalar::f16;
+                if(v == "bf16_r")
+                    return hipblas_replay_scalar::bf16;
+                if(v == "f64_r")
+                    return hipblas_replay_scalar::f64;
+                if(v == "f32_c")
+                    return hipblas_replay_scalar::c32;
+                if(v == "f64_c")
+                    return hipblas_replay_scalar::c64;
+                if(!v.compare(0, 4, "c64f"))
+                    return complex ? hipblas_replay_scalar::c64 : hipblas_replay_scalar::f64;
+                if(!v.compare(0, 4, "c32i"))
+                    return hipblas_replay_scalar::i32;
+                if(!v.compare(0, 4, "c32f"))
+                    return complex ? hipblas_replay_scalar::c32 : hipblas_replay_scalar::f32;
+                return hipblas_replay_scalar::f32;
+            }
+            return hipblas_replay_scalar::f32;
+        }
+    }
+
+    // Writes a real value or a complex value '(re:im)' of the trace as the scalar type
+    void hipblas_replay_store(char* dst, hipblas_replay_scalar scalar, const std::string& value)
+    {
+        double re = 0, im = 0;
+        size_t open = value.find('(');
+        if(open != std::string::npos)
+        {
+            size_t colon = value.find(':', open);
+            re           = std::stod(value.substr(open + 1, colon - open - 1));
+            im           = std::stod(value.substr(colon + 1));
+        }
+        else
+            re = std::stod(value);
+
+        switch(scalar)
+        {
+        case hipblas_replay_scalar::f16:
+        {
+            hipblasHalf h = float_to_half(float(re));
+            memcpy(dst, &h, sizeof(h));
+            break;
+        }
+        case hipblas_replay_scalar::bf16:
+        {
+            hipblasBfloat16 b = float_to_bfloat16(float(re));
+            memcpy(dst, &b, sizeof(b));
+            break;
+        }
+        case hipblas_replay_scalar::f32:
+        case hipblas_replay_scalar::c32:
+        {
+            float f[2] = {float(re), float(im)};
+            memcpy(dst, f, sizeof(f));
+            break;
+        }
+        case hipblas_replay_scalar::f64:
+        case hipblas_replay_scalar::c64:
+        {
+            double d[2] = {re, im};
+            memcpy(dst, d, sizeof(d));
+            break;
+        }
+        case hipblas_replay_scalar::i32:
+        {
+            int32_t i = int32_t(re);
+            memcpy(dst, &i, sizeof(i));
+            break;
+        }
+        }
+    }
+
+    // Bytes an argument can reach: the largest dimension times its leading dimension or
+    // increment, plus its stride for every further batch instance. Matrices are assumed to be
+    // as large as their largest dimension in both directions, which may overestimate them but
+    // never underestimates.
+    size_t hipblas_replay_bytes(const hipblas_replay_record& record,
+                                const std::string&           name,
+                                size_t                       element_size,
+                                bool                         strided)
+    {
+        if(record.function == "hipblasSetWorkspace")
+            return size_t(record.integer("workspaceSizeInBytes", 0));
+
+        int64_t batch = std::max<int64_t>(1, record.integer("batchCount", 1));
+        int64_t dims = 1, ld = 0, inc = 0, stride = 0;
+        for(auto& arg : record.args)
+        {
+            const std::string& arg_name = arg.first;
+            if(arg_name == "m" || arg_name == "n" || arg_name == "k" || arg_name == "nrhs")
+                dims = std::max<int64_t>(dims, std::stoll(arg.second));
+            else if(!arg_name.compare(0, 2, "ld"))
+                ld = std::max<int64_t>(ld, std::stoll(arg.second));
+            else if(!arg_name.compare(0, 3, "inc"))
+                inc = std::max<int64_t>(inc, std::abs(std::stoll(arg.second)));
+            else if(!arg_name.compare(0, 6, "stride"))
+                stride = std::max<int64_t>(stride, std::abs(std::stoll(arg.second)));
+        }
+
+        std::string lower = name;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        if(const std::string* value = record.find("ld" + lower))
+            ld = std::stoll(*value);
+        if(const std::string* value = record.find("inc" + name))
+            inc = std::abs(std::stoll(*value));
+        if(const std::string* value = record.find("stride" + name))
+            stride = std::abs(std::stoll(*value));
+
+        int64_t elements;
+        if(hipblas_replay_scalar_name(record, name))
+            elements = 5 * (strided ? batch : 1);
+        else
+        {
+            elements = dims * std::max<int64_t>({ld, inc, 1});
+            if(name == "AP")
+                elements = std::max(elements, dims * (dims + 1) / 2);
+            if(strided)
+                elements += stride * (batch - 1);
+        }
+        return size_t(elements) * element_size;
+    }
+
+    // Device memory standing in for an address range of the traced application
+    struct hipblas_replay_region
+    {
+        uintptr_t end;
+        int       device;
+        char*     memory = nullptr;
+    };
+
+    // Device array of device pointers standing in for a pointer array argument
+    struct hipblas_replay_array
+    {
+        int     device;
+        int64_t batch   = 0;
+        size_t  bytes   = 0;
+        void**  memory  = nullptr;
+        char*   buffers = nullptr;
+    };
+
+    // Argument converted once before the replay
+    union hipblas_replay_value
+    {
+        int64_t i;
+        void*   p;
+    };
+
+    enum class hipblas_replay_mode
+    {
+        plan, // record the memory the call touches
+        bind, // convert the arguments
+        call,
+    };
+
+    class hipblas_replay;
+
+    using hipblas_replay_invoker = hipblasStatus_t (*)(hipblas_replay&, size_t, hipblas_replay_mode);
+
+    class hipblas_replay
+    {
+    public:
+        std::vector<hipblas_replay_record>             records;
+        std::vector<hipblas_replay_invoker>            invokers;
+        std::vector<hipblasHandle_t>                   record_handles;
+        std::vector<hipStream_t>                       record_streams;
+        std::vector<std::vector<hipblas_replay_value>> values;
+
+        std::map<std::string, hipblasHandle_t>              handles;
+        std::map<std::pair<int, std::string>, hipStream_t>  streams;
+        std::vector<std::tuple<uintptr_t, uintptr_t, int>>  intervals;
+        std::map<uintptr_t, hipblas_replay_region>          regions;
+        std::map<uintptr_t, hipblas_replay_array>           arrays;
+        std::map<std::pair<size_t, size_t>, std::vector<char>> host_data;
+        std::set<int>                                       devices;
+
+        hipblas_replay() = default;
+
+        hipblas_replay(const hipblas_replay&) = delete;
+        hipblas_replay& operator=(const hipblas_replay&) = delete;
+
+        ~hipblas_replay()
+        {
+            for(auto& handle : handles)
+                hipblasDestroy(handle.second);
+            for(auto& stream : streams)
+                if(stream.second)
+                    (void)hipStreamDestroy(stream.second);
+            for(auto& region : regions)
+                (void)hipFree(region.second.memory);
+            for(auto& array : arrays)
+            {
+                (void)hipFree(array.second.memory);
+                (void)hipFree(array.second.buffers);
+            }
+        }
+
+        hipStream_t stream(int device, const std::string& value)
+        {
+            if(!hipblas_replay_address(value))
+                return nullptr;
+            hipStream_t& stream = streams[{device, value}];
+            if(!stream)
+            {
+                CHECK_HIP_ERROR(hipSetDevice(device));
+                CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            }
+            return stream;
+        }
+
+        hipblasHandle_t handle(int device, const std::string& value)
+        {
+            hipblasHandle_t& handle = handles[value];
+            if(!handle)
+            {
+                CHECK_HIP_ERROR(hipSetDevice(device));
+                CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+            }
+            return handle;
+        }
+
+        template <typename P>
+        void plan(size_t r, size_t i)
+        {
+            const hipblas_replay_record& record = records[r];
+            const std::string&           name   = record.args[i].first;
+            const std::string&           value  = record.args[i].second;
+
+            if constexpr(std::is_same<P, hipStream_t>{})
+                stream(record.device, value);
+            else if constexpr(std::is_pointer<P>{})
+            {
+                using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+                if constexpr(std::is_pointer<T>{})
+                {
+                    using U           = std::remove_cv_t<std::remove_pointer_t<T>>;
+                    uintptr_t address = hipblas_replay_address(value);
+                    if(!address)
+                        return;
+                    hipblas_replay_array& array = arrays[address];
+                    if(!array.batch)
+                        array.device = record.device;
+                    array.batch = std::max<int64_t>(
+                        {array.batch, record.integer("batchCount", 1), int64_t(1)});
+                    array.bytes = std::max(
+                        array.bytes,
+                        hipblas_replay_bytes(record, name, hipblas_replay_size<U>(record, name), false));
+                }
+                else if(hipblas_replay_host_pointer(record, name))
+                {
+                    // alpha and beta are read by the trace, a zero value looks like null
+                    bool read = name == "alpha" || name == "beta";
+                    if(!read && !hipblas_replay_address(value))
+                        return;
+                    int64_t            batch = std::max<int64_t>(1, record.integer("batchCount", 1));
+                    std::vector<char>& data  = host_data[{r, i}];
+                    data.assign(5 * 16 * batch, 0);
+                    if(read)
+                        hipblas_replay_store(data.data(), hipblas_replay_scalar_of<T>(record), value);
+                }
+                else
+                {
+                    uintptr_t address = hipblas_replay_address(value);
+                    if(!address)
+                        return;
+                    size_t bytes
+                        = hipblas_replay_bytes(record, name, hipblas_replay_size<T>(record, name), true);
+                    intervals.emplace_back(address, address + std::max<size_t>(bytes, 1), record.device);
+                }
+            }
+        }
+
+        template <typename P>
+        void bind(size_t r, size_t i)
+        {
+            const hipblas_replay_record& record = records[r];
+            const std::string&           value  = record.args[i].second;
+            hipblas_replay_value&        bound  = values[r][i];
+
+            if constexpr(std::is_same<P, hipStream_t>{})
+                bound.p = stream(record.device, value);
+            else if constexpr(std::is_pointer<P>{})
+            {
+                auto host = host_data.find({r, i});
+                if(host != host_data.end())
+                {
+                    bound.p = host->second.data();
+                    return;
+                }
+
+                uintptr_t address = hipblas_replay_address(value);
+                bound.p           = nullptr;
+                if(!address)
+                    return;
+
+                using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+                if constexpr(std::is_pointer<T>{})
+                    bound.p = arrays.at(address).memory;
+                else
+                {
+                    auto region = --regions.upper_bound(address);
+                    bound.p     = region->second.memory + (address - region->first);
+                }
+            }
+            else if constexpr(std::is_enum<P>{})
+                bound.i = int64_t(hipblas_replay_enum<P>(value));
+            else
+                bound.i = std::stoll(value);
+        }
+
+        template <typename P>
+        P arg(size_t r, size_t i) const
+        {
+            const hipblas_replay_value& bound = values[r][i];
+            if constexpr(std::is_pointer<P>{})
+                return static_cast<P>(bound.p);
+            else
+                return static_cast<P>(bound.i);
+        }
+
+        // Merges the address ranges the calls touch, so arguments which overlapped in the
+        // traced application overlap in the replay, and allocates them
+        void allocate()
+        {
+            std::sort(intervals.begin(), intervals.end());
+            hipblas_replay_region* last = nullptr;
+            for(auto& interval : intervals)
+            {
+                uintptr_t start = std::get<0>(interval), end = std::get<1>(interval);
+                if(last && start < last->end)
+                    last->end = std::max(last->end, end);
+                else
+                    last = &(regions[start] = {end, std::get<2>(interval)});
+            }
+            intervals.clear();
+
+            for(auto& region : regions)
+            {
+                size_t bytes = region.second.end - region.first;
+                CHECK_HIP_ERROR(hipSetDevice(region.second.device));
+                CHECK_HIP_ERROR(hipMalloc(&region.second.memory, bytes));
+                CHECK_HIP_ERROR(hipMemset(region.second.memory, 0, bytes));
+            }
+
+            for(auto& entry : arrays)
+            {
+                hipblas_replay_array& array = entry.second;
+                size_t                bytes = (std::max<size_t>(array.bytes, 1) + 255) / 256 * 256;
+
+                CHECK_HIP_ERROR(hipSetDevice(array.device));
+                CHECK_HIP_ERROR(hipMalloc(&array.buffers, bytes * array.batch));
+                CHECK_HIP_ERROR(hipMemset(array.buffers, 0, bytes * array.batch));
+
+                std::vector<void*> pointers(array.batch);
+                for(int64_t b = 0; b < array.batch; b++)
+                    pointers[b] = array.buffers + b * bytes;
+                CHECK_HIP_ERROR(hipMalloc(&array.memory, sizeof(void*) * array.batch));
+                CHECK_HIP_ERROR(hipMemcpy(array.memory,
+                                          pointers.data(),
+                                          sizeof(void*) * array.batch,
+                                          hipMemcpyHostToDevice));
+            }
+        }
+    };
+
+    template <typename... Ps, size_t... I>
+    hipblasStatus_t hipblas_replay_invoke(hipblasStatus_t (*function)(hipblasHandle_t, Ps...),
+                                          hipblas_replay&     replay,
+                                          size_t              r,
+                                          hipblas_replay_mode mode,
+                                          std::index_sequence<I...>)
+    {
+        switch(mode)
+        {
+        case hipblas_replay_mode::plan:
+            if(replay.records[r].args.size() != sizeof...(Ps))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            (replay.plan<Ps>(r, I), ...);
+            return HIPBLAS_STATUS_SUCCESS;
+        case hipblas_replay_mode::bind:
+            (replay.bind<Ps>(r, I), ...);
+            return HIPBLAS_STATUS_SUCCESS;
+        case hipblas_replay_mode::call:
+            break;
+        }
+        return function(replay.record_handles[r], replay.arg<Ps>(r, I)...);
+    }
+
+    template <typename... Ps>
+    hipblasStatus_t hipblas_replay_invoke(hipblasStatus_t (*function)(hipblasHandle_t, Ps...),
+                                          hipblas_replay&     replay,
+                                          size_t              r,
+                                          hipblas_replay_mode mode)
+    {
+        return hipblas_replay_invoke(function, replay, r, mode, std::index_sequence_for<Ps...>{});
+    }
+
+    // Every function of hipblas.h taking a handle, by the name the trace records. With
+    // HIPBLAS_V2 the names of the original API call the _v2 functions they map to.
+    const std::unordered_map<std::string, hipblas_replay_invoker>& hipblas_replay_functions()
+    {
+        // clang-format off
+        static const std::unordered_map<std::string, hipblas_replay_invoker> functions = {
+#define HIPBLAS_REPLAY_FUNCTION(NAME)                                              \
+            {#NAME, [](hipblas_replay& replay, size_t r, hipblas_replay_mode mode) { \
+                 return hipblas_replay_invoke(NAME, replay, r, mode);               \
+             }},
+#include "hipblas_replay_functions.hpp"
+#undef HIPBLAS_REPLAY_FUNCTION
+        };
+        // clang-format on
+        return functions;
+    }
+
+    // Sets the device, stream and modes the traced call ran with and runs it
+    hipblasStatus_t hipblas_replay_call(hipblas_replay& replay, size_t r)
+    {
+        const hipblas_replay_record& record = replay.records[r];
+        hipblasHandle_t              handle = replay.record_handles[r];
+
+        hipblasStatus_t status = hipblasSetStream(handle, replay.record_streams[r]);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, record.pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(handle, record.atomics_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetMathMode(handle, record.math_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = replay.invokers[r](replay, r, hipblas_replay_mode::call);
+        return status;
+    }
+}
+
+int hipblas_bench_replay(const std::string& path, const Arguments& arg)
+{
+    std::ifstream file(path);
+    if(!file)
+        throw std::invalid_argument("Cannot open trace " + path);
+
+    hipblas_replay replay;
+    for(std::string line; std::getline(file, line);)
+    {
+        hipblas_replay_record record;
+        if(hipblas_replay_parse(line, record))
+            replay.records.push_back(std::move(record));
+    }
+
+    // Traces of several threads interleave, the call number orders them
+    std::stable_sort(replay.records.begin(),
+                     replay.records.end(),
+                     [](const hipblas_replay_record& a, const hipblas_replay_record& b) {
+                         return a.call < b.call;
+                     });
+
+    // Drop the calls which have no replay, such as hipblasDestroy and the getters
+    std::map<std::string, size_t> skipped;
+    const auto&                   functions = hipblas_replay_functions();
+    size_t                        kept      = 0;
+    for(size_t r = 0; r < replay.records.size(); r++)
+    {
+        hipblas_replay_record& record   = replay.records[r];
+        auto                   function = functions.find(record.function);
+        if(function == functions.end())
+        {
+            skipped[record.function]++;
+            continue;
+        }
+
+        if(kept != r)
+            replay.records[kept] = std::move(record);
+        replay.invokers.push_back(function->second);
+        replay.record_handles.push_back(
+            replay.handle(replay.records[kept].device, replay.records[kept].handle));
+        replay.record_streams.push_back(
+            replay.stream(replay.records[kept].device, replay.records[kept].stream));
+        replay.devices.insert(replay.records[kept].device);
+
+        if(replay.invokers[kept](replay, kept, hipblas_replay_mode::plan)
+           != HIPBLAS_STATUS_SUCCESS)
+        {
+            skipped[replay.records[kept].function]++;
+            replay.invokers.pop_back();
+            replay.record_handles.pop_back();
+            replay.record_streams.pop_back();
+            continue;
+        }
+        kept++;
+    }
+    replay.records.resize(kept);
+
+    size_t skipped_calls = 0;
+    for(auto& function : skipped)
+    {
+        skipped_calls += function.second;
+        std::cerr << "Skipping " << function.second << " calls of " << function.first
+                  << " which cannot be replayed" << std::endl;
+    }
+
+    replay.allocate();
+    replay.values.resize(kept);
+    for(size_t r = 0; r < kept; r++)
+    {
+        replay.values[r].resize(replay.records[r].args.size());
+        replay.invokers[r](replay, r, hipblas_replay_mode::bind);
+    }
+
+    std::vector<hipEvent_t> start(kept), stop(kept);
+    for(size_t r = 0; r < kept; r++)
+    {
+        CHECK_HIP_ERROR(hipSetDevice(replay.records[r].device));
+        CHECK_HIP_ERROR(hipEventCreate(&start[r]));
+        CHECK_HIP_ERROR(hipEventCreate(&stop[r]));
+    }
+
+    auto synchronize = [&]() {
+        for(int device : replay.devices)
+        {
+            CHECK_HIP_ERROR(hipSetDevice(device));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+        }
+    };
+
+    std::vector<hipblasStatus_t> status(kept, HIPBLAS_STATUS_SUCCESS);
+    std::vector<double>          call_us(kept, 0);
+    double                       total_us = 0;
+
+    for(int iter = 0; iter < arg.cold_iters + arg.iters; iter++)
+    {
+        bool timed  = iter >= arg.cold_iters;
+        int  device = -1;
+
+        synchronize();
+        double start_us = get_time_us();
+        for(size_t r = 0; r < kept; r++)
+        {
+            if(replay.records[r].device != device)
+            {
+                device = replay.records[r].device;
+                CHECK_HIP_ERROR(hipSetDevice(device));
+            }
+            if(timed)
+                CHECK_HIP_ERROR(hipEventRecord(start[r], replay.record_streams[r]));
+            hipblasStatus_t call_status = hipblas_replay_call(replay, r);
+            if(timed)
+                CHECK_HIP_ERROR(hipEventRecord(stop[r], replay.record_streams[r]));
+            if(call_status != HIPBLAS_STATUS_SUCCESS)
+                status[r] = call_status;
+        }
+        synchronize();
+
+        if(!timed)
+            continue;
+        total_us += get_time_us() - start_us;
+        for(size_t r = 0; r < kept; r++)
+        {
+            float ms = 0;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start[r], stop[r]));
+            call_us[r] += ms * 1000.0;
+        }
+    }
+
+    int    iters  = std::max(arg.iters, 1);
+    double sum_us = 0;
+    std::cout << "call,function,status,hipblas-us" << std::endl;
+    for(size_t r = 0; r < kept; r++)
+    {
+        sum_us += call_us[r] / iters;
+        std::cout << replay.records[r].call << "," << replay.records[r].function << ","
+                  << hipblasStatusToString(status[r]) << "," << call_us[r] / iters << std::endl;
+    }
+
+    std::cout << std::endl
+              << "trace,calls,skipped,iters,hipblas-us,sum-of-calls-us" << std::endl
+              << path << "," << kept << "," << skipped_calls << "," << arg.iters
+              << "," << total_us / iters << "," << sum_us << std::endl;
+
+    for(size_t r = 0; r < kept; r++)
+    {
+        (void)hipEventDestroy(start[r]);
+        (void)hipEventDestroy(stop[r]);
+    }
+
+    bool failed = std::any_of(status.begin(), status.end(), [](hipblasStatus_t s) {
+        return s != HIPBLAS_STATUS_SUCCESS;
+    });
+    return failed ? -1 : 0;
+}
@@ -0,0 +1,472 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_datatype2string.hpp"
+#include "hipblas_test.hpp"
+#include "hipblas_tune.hpp"
+#include "utility.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    size_t hipblas_tune_sizeof(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return 2;
+        case HIP_R_32F:
+        case HIP_R_32I:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+#ifndef HIPBLAS_V2
+    // The tuning file has the types of the HIPBLAS_V2 functions
+    hipDataType hipblas_tune_datatype(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_8I:
+            return HIP_R_8I;
+        case HIPBLAS_R_16F:
+            return HIP_R_16F;
+        case HIPBLAS_R_16B:
+            return HIP_R_16BF;
+        case HIPBLAS_R_32F:
+            return HIP_R_32F;
+        case HIPBLAS_R_32I:
+            return HIP_R_32I;
+        case HIPBLAS_R_64F:
+            return HIP_R_64F;
+        case HIPBLAS_C_32F:
+            return HIP_C_32F;
+        case HIPBLAS_C_64F:
+            return HIP_C_64F;
+        default:
+            return HIP_R_8U; // not supported by gemm_ex
+        }
+    }
+
+    hipblasComputeType_t hipblas_tune_compute_type(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return HIPBLAS_COMPUTE_16F;
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_64F:
+            return HIPBLAS_COMPUTE_64F;
+        case HIPBLAS_R_32I:
+            return HIPBLAS_COMPUTE_32I;
+        default:
+            return HIPBLAS_COMPUTE_32F;
+        }
+    }
+#endif
+
+    // Sets scalar to value in the type alpha and beta have for compute_type. The imaginary part
+    // of complex scalars is left 0.
+    void hipblas_tune_scalar(hipblasComputeType_t compute_type, int value, void* scalar)
+    {
+        memset(scalar, 0, 16);
+        switch(compute_type)
+        {
+        case HIPBLAS_COMPUTE_16F:
+        {
+            uint16_t half = value ? 0x3c00 : 0;
+            memcpy(scalar, &half, sizeof(half));
+            break;
+        }
+        case HIPBLAS_COMPUTE_64F:
+        {
+            double d = value;
+            memcpy(scalar, &d, sizeof(d));
+            break;
+        }
+        case HIPBLAS_COMPUTE_32I:
+        {
+            int32_t i = value;
+            memcpy(scalar, &i, sizeof(i));
+            break;
+        }
+        default:
+        {
+            float f = value;
+            memcpy(scalar, &f, sizeof(f));
+            break;
+        }
+        }
+    }
+}
+
+int hipblas_bench_tune(const std::string& path, const Arguments& arg)
+{
+    hipblasGemmTuningFunction_t function;
+    if(!strcmp(arg.function, "gemm_ex"))
+        function = HIPBLAS_GEMM_TUNING_EX;
+    else if(!strcmp(arg.function, "gemm_batched_ex"))
+        function = HIPBLAS_GEMM_TUNING_BATCHED_EX;
+    else if(!strcmp(arg.function, "gemm_strided_batched_ex"))
+        function = HIPBLAS_GEMM_TUNING_STRIDED_BATCHED_EX;
+    else
+    {
+        std::cerr << "hipblas-bench --tune: --function must be gemm_ex, gemm_batched_ex or "
+                     "gemm_strided_batched_ex"
+                  << std::endl;
+        return -1;
+    }
+
+#ifdef HIPBLAS_V2
+    hipDataType          a_type       = arg.a_type;
+    hipDataType          b_type       = arg.b_type;
+    hipDataType          c_type       = arg.c_type;
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+#else
+    hipDataType          a_type       = hipblas_tune_datatype(arg.a_type);
+    hipDataType          b_type       = hipblas_tune_datatype(arg.b_type);
+    hipDataType          c_type       = hipblas_tune_datatype(arg.c_type);
+    hipblasComputeType_t compute_type = hipblas_tune_compute_type(arg.compute_type);
+#endif
+    hipblasGemmFlags_t flags = hipblasGemmFlags_t(arg.flags);
+
+    size_t a_size = hipblas_tune_sizeof(a_type);
+    size_t b_size = hipblas_tune_sizeof(b_type);
+    size_t c_size = hipblas_tune_sizeof(c_type);
+    if(!a_size || !b_size || !c_size)
+    {
+        std::cerr << "hipblas-bench --tune: unsupported types" << std::endl;
+        return -1;
+    }
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = int(arg.M);
+    int N           = int(arg.N);
+    int K           = int(arg.K);
+    int lda         = int(std::max<int64_t>(arg.lda, arg.transA == 'N' ? M : K));
+    int ldb         = int(std::max<int64_t>(arg.ldb, arg.transB == 'N' ? K : N));
+    int ldc         = int(std::max<int64_t>(arg.ldc, M));
+    int batch_count = function == HIPBLAS_GEMM_TUNING_EX ? 1 : int(arg.batch_count);
+    if(M <= 0 || N <= 0 || K <= 0 || batch_count <= 0)
+    {
+        std::cerr << "hipblas-bench --tune: the problem must not be empty" << std::endl;
+        return -1;
+    }
+
+    hipblasStride stride_a = hipblasStride(lda) * (arg.transA == 'N' ? K : M);
+    hipblasStride stride_b = hipblasStride(ldb) * (arg.transB == 'N' ? N : K);
+    hipblasStride stride_c = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // 0x3c in every byte is a small normal number in each floating point type, so that the
+    // solutions are timed on nonzero data
+    char *dA, *dB, *dC;
+    CHECK_HIP_ERROR(hipMalloc(&dA, a_size * stride_a * batch_count));
+    CHECK_HIP_ERROR(hipMalloc(&dB, b_size * stride_b * batch_count));
+    CHECK_HIP_ERROR(hipMalloc(&dC, c_size * stride_c * batch_count));
+    CHECK_HIP_ERROR(hipMemset(dA, 0x3c, a_size * stride_a * batch_count));
+    CHECK_HIP_ERROR(hipMemset(dB, 0x3c, b_size * stride_b * batch_count));
+    CHECK_HIP_ERROR(hipMemset(dC, 0x3c, c_size * stride_c * batch_count));
+
+    std::vector<const void*> hA(batch_count), hB(batch_count);
+    std::vector<void*>       hC(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b] = dA + a_size * stride_a * b;
+        hB[b] = dB + b_size * stride_b * b;
+        hC[b] = dC + c_size * stride_c * b;
+    }
+    const void** dA_array;
+    const void** dB_array;
+    void**       dC_array;
+    CHECK_HIP_ERROR(hipMalloc(&dA_array, sizeof(void*) * batch_count));
+    CHECK_HIP_ERROR(hipMalloc(&dB_array, sizeof(void*) * batch_count));
+    CHECK_HIP_ERROR(hipMalloc(&dC_array, sizeof(void*) * batch_count));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_array, hA.data(), sizeof(void*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB_array, hB.data(), sizeof(void*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dC_array, hC.data(), sizeof(void*) * batch_count, hipMemcpyHostToDevice));
+
+    alignas(16) char alpha[16], beta[16];
+    hipblas_tune_scalar(compute_type, 1, alpha);
+    hipblas_tune_scalar(compute_type, 0, beta);
+
+    auto get_solutions = [&](int* solutions, int* count) {
+        if(function == HIPBLAS_GEMM_TUNING_EX)
+            return hipblasGemmExGetSolutions(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             alpha,
+                                             dA,
+                                             a_type,
+                                             lda,
+                                             dB,
+                                             b_type,
+                                             ldb,
+                                             beta,
+                                             dC,
+                                             c_type,
+                                             ldc,
+                                             compute_type,
+                                             flags,
+                                             solutions,
+                                             count);
+        else if(function == HIPBLAS_GEMM_TUNING_BATCHED_EX)
+            return hipblasGemmBatchedExGetSolutions(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    alpha,
+                                                    dA_array,
+                                                    a_type,
+                                                    lda,
+                                                    dB_array,
+                                                    b_type,
+                                                    ldb,
+                                                    beta,
+                                                    dC_array,
+                                                    c_type,
+                                                    ldc,
+                                                    batch_count,
+                                                    compute_type,
+                                                    flags,
+                                                    solutions,
+                                                    count);
+        else
+            return hipblasGemmStridedBatchedExGetSolutions(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           alpha,
+                                                           dA,
+                                                           a_type,
+                                                           lda,
+                                                           stride_a,
+                                                           dB,
+                                                           b_type,
+                                                           ldb,
+                                                           stride_b,
+                                                           beta,
+                                                           dC,
+                                                           c_type,
+                                                           ldc,
+                                                           stride_c,
+                                                           batch_count,
+                                                           compute_type,
+                                                           flags,
+                                                           solutions,
+                                                           count);
+    };
+
+    // Solution 0 is the default solution
+    auto run = [&](int solution) {
+        if(function == HIPBLAS_GEMM_TUNING_EX)
+            return hipblasGemmExWithSolution(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             alpha,
+                                             dA,
+                                             a_type,
+                                             lda,
+                                             dB,
+                                             b_type,
+                                             ldb,
+                                             beta,
+                                             dC,
+                                             c_type,
+                                             ldc,
+                                             compute_type,
+                                             solution,
+                                             flags);
+        else if(function == HIPBLAS_GEMM_TUNING_BATCHED_EX)
+            return hipblasGemmBatchedExWithSolution(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    alpha,
+                                                    dA_array,
+                                                    a_type,
+                                                    lda,
+                                                    dB_array,
+                                                    b_type,
+                                                    ldb,
+                                                    beta,
+                                                    dC_array,
+                                                    c_type,
+                                                    ldc,
+                                                    batch_count,
+                                                    compute_type,
+                                                    solution,
+                                                    flags);
+        else
+            return hipblasGemmStridedBatchedExWithSolution(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           alpha,
+                                                           dA,
+                                                           a_type,
+                                                           lda,
+                                                           stride_a,
+                                                           dB,
+                                                           b_type,
+                                                           ldb,
+                                                           stride_b,
+                                                           beta,
+                                                           dC,
+                                                           c_type,
+                                                           ldc,
+                                                           stride_c,
+                                                           batch_count,
+                                                           compute_type,
+                                                           solution,
+                                                           flags);
+    };
+
+    int              solution_count = 0;
+    std::vector<int> solutions;
+    hipblasStatus_t  status = get_solutions(nullptr, &solution_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        solutions.resize(solution_count);
+        status = get_solutions(solutions.data(), &solution_count);
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::cerr << "hipblas-bench --tune: cannot list the solutions, "
+                  << hipblasStatusToString(status) << std::endl;
+        return -1;
+    }
+    solutions.resize(solution_count);
+    solutions.insert(solutions.begin(), 0);
+
+    std::cout << "solution,status,hipblas-us" << std::endl;
+
+    int    best_solution = 0;
+    double default_us = 0, best_us = std::numeric_limits<double>::max();
+    for(int solution : solutions)
+    {
+        for(int iter = 0; iter < arg.cold_iters; iter++)
+            run(solution);
+
+        double          start_us = get_time_us_sync(stream);
+        hipblasStatus_t status   = HIPBLAS_STATUS_SUCCESS;
+        for(int iter = 0; iter < arg.iters; iter++)
+        {
+            hipblasStatus_t call_status = run(solution);
+            if(call_status != HIPBLAS_STATUS_SUCCESS)
+                status = call_status;
+        }
+        double us = (get_time_us_sync(stream) - start_us) / std::max(arg.iters, 1);
+
+        std::cout << solution << "," << hipblasStatusToString(status) << "," << us << std::endl;
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            continue;
+        if(!solution)
+            default_us = us;
+        if(us < best_us)
+        {
+            best_solution = solution;
+            best_us       = us;
+        }
+    }
+
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dA_array));
+    CHECK_HIP_ERROR(hipFree(dB_array));
+    CHECK_HIP_ERROR(hipFree(dC_array));
+
+    if(!best_solution)
+    {
+        std::cout << "The default solution is the fastest, " << path << " is unchanged"
+                  << std::endl;
+        return 0;
+    }
+
+    hipblasGemmTuningEntry_t entry = {function,
+                                      transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      lda,
+                                      ldb,
+                                      ldc,
+                                      a_type,
+                                      b_type,
+                                      c_type,
+                                      compute_type,
+                                      batch_count,
+                                      best_solution};
+    status = hipblasGemmTuningWrite(path.c_str(), &entry, 1);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::cerr << "hipblas-bench --tune: cannot write " << path << ", "
+                  << hipblasStatusToString(status) << std::endl;
+        return -1;
+    }
+    std::cout << "Solution " << best_solution << " takes " << best_us << " us instead of "
+              << default_us << " us, added to " << path << std::endl;
+    return 0;
+}
@@ -49,6 +49,138 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
+void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotri_(char* uplo, int* n, hipblasComplex* A, int* lda, int* info);
+void zpotri_(char* uplo, int* n, hipblasDoubleComplex* A, int* lda, int* info);
+
+void ssyevd_(char*  jobz,
+             char*  uplo,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* W,
+             float* work,
+             int*   lwork,
+             int*   iwork,
+             int*   liwork,
+             int*   info);
+void dsyevd_(char*   jobz,
+             char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* W,
+             double* work,
+             int*    lwork,
+             int*    iwork,
+             int*    liwork,
+             int*    info);
+void cheevd_(char*           jobz,
+             char*           uplo,
+             int*            n,
+             hipblasComplex* A,
+             int*            lda,
+             float*          W,
+             hipblasComplex* work,
+             int*            lwork,
+             float*          rwork,
+             int*            lrwork,
+             int*            iwork,
+             int*            liwork,
+             int*            info);
+void zheevd_(char*                 jobz,
+             char*                 uplo,
+             int*                  n,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             double*               W,
+             hipblasDoubleComplex* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  lrwork,
+             int*                  iwork,
+             int*                  liwork,
+             int*                  info);
+
+void sgesvd_(char*  jobu,
+             char*  jobvt,
+             int*   m,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* S,
+             float* U,
+             int*   ldu,
+             float* VT,
+             int*   ldvt,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dgesvd_(char*   jobu,
+             char*   jobvt,
+             int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* S,
+             double* U,
+             int*    ldu,
+             double* VT,
+             int*    ldvt,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cgesvd_(char*           jobu,
+             char*           jobvt,
+             int*            m,
+             int*            n,
+             hipblasComplex* A,
+             int*            lda,
+             float*          S,
+             hipblasComplex* U,
+             int*            ldu,
+             hipblasComplex* VT,
+             int*            ldvt,
+             hipblasComplex* work,
+             int*            lwork,
+             float*          rwork,
+             int*            info);
+void zgesvd_(char*                 jobu,
+             char*                 jobvt,
+             int*                  m,
+             int*                  n,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             double*               S,
+             hipblasDoubleComplex* U,
+             int*                  ldu,
+             hipblasDoubleComplex* VT,
+             int*                  ldvt,
+             hipblasDoubleComplex* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  info);
+
 void sgetrf_(int* m, int* n, float* A, int* lda, int* ipiv, int* info);
 void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
 void cgetrf_(int* m, int* n, hipblasComplex* A, int* lda, int* ipiv, int* info);
@@ -2949,6 +3081,175 @@ void ref_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
         C[i] = static_cast<int32_t>(C_double[i]);
 }
 
+// cblas does not support FP8, so A and B are converted to float, which holds them exactly, and
+// 16-bit C is computed in float and rounded back
+template <typename Ti, typename To>
+static void ref_gemm_f8(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int64_t            m,
+                        int64_t            n,
+                        int64_t            k,
+                        float              alpha,
+                        Ti*                A,
+                        int64_t            lda,
+                        Ti*                B,
+                        int64_t            ldb,
+                        float              beta,
+                        To*                C,
+                        int64_t            ldc)
+{
+    size_t sizeA = transA == HIPBLAS_OP_N ? size_t(k) * lda : size_t(m) * lda;
+    size_t sizeB = transB == HIPBLAS_OP_N ? size_t(n) * ldb : size_t(k) * ldb;
+    size_t sizeC = size_t(n) * ldc;
+
+    std::vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
+    for(size_t i = 0; i < sizeA; i++)
+        A_float[i] = float(A[i]);
+    for(size_t i = 0; i < sizeB; i++)
+        B_float[i] = float(B[i]);
+    for(size_t i = 0; i < sizeC; i++)
+    {
+        if constexpr(std::is_same_v<To, hipblasHalf>)
+            C_float[i] = half_to_float(C[i]);
+        else if constexpr(std::is_same_v<To, hipblasBfloat16>)
+            C_float[i] = bfloat16_to_float(C[i]);
+        else
+            C_float[i] = C[i];
+    }
+
+    ref_gemm<float>(transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    A_float.data(),
+                    lda,
+                    B_float.data(),
+                    ldb,
+                    beta,
+                    C_float.data(),
+                    ldc);
+
+    for(size_t i = 0; i < sizeC; i++)
+    {
+        if constexpr(std::is_same_v<To, hipblasHalf>)
+            C[i] = float_to_half(C_float[i]);
+        else if constexpr(std::is_same_v<To, hipblasBfloat16>)
+            C[i] = float_to_bfloat16(C_float[i]);
+        else
+            C[i] = C_float[i];
+    }
+}
+
+template <>
+void ref_gemm<hipblas_f8, float, float>(hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int64_t            m,
+                                        int64_t            n,
+                                        int64_t            k,
+                                        float              alpha,
+                                        hipblas_f8*        A,
+                                        int64_t            lda,
+                                        hipblas_f8*        B,
+                                        int64_t            ldb,
+                                        float              beta,
+                                        float*             C,
+                                        int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+void ref_gemm<hipblas_f8, hipblasHalf, float>(hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              float              alpha,
+                                              hipblas_f8*        A,
+                                              int64_t            lda,
+                                              hipblas_f8*        B,
+                                              int64_t            ldb,
+                                              float              beta,
+                                              hipblasHalf*       C,
+                                              int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+void ref_gemm<hipblas_f8, hipblasBfloat16, float>(hipblasOperation_t transA,
+                                                  hipblasOperation_t transB,
+                                                  int64_t            m,
+                                                  int64_t            n,
+                                                  int64_t            k,
+                                                  float              alpha,
+                                                  hipblas_f8*        A,
+                                                  int64_t            lda,
+                                                  hipblas_f8*        B,
+                                                  int64_t            ldb,
+                                                  float              beta,
+                                                  hipblasBfloat16*   C,
+                                                  int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+void ref_gemm<hipblas_bf8, float, float>(hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int64_t            m,
+                                         int64_t            n,
+                                         int64_t            k,
+                                         float              alpha,
+                                         hipblas_bf8*       A,
+                                         int64_t            lda,
+                                         hipblas_bf8*       B,
+                                         int64_t            ldb,
+                                         float              beta,
+                                         float*             C,
+                                         int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+void ref_gemm<hipblas_bf8, hipblasHalf, float>(hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               float              alpha,
+                                               hipblas_bf8*       A,
+                                               int64_t            lda,
+                                               hipblas_bf8*       B,
+                                               int64_t            ldb,
+                                               float              beta,
+                                               hipblasHalf*       C,
+                                               int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+void ref_gemm<hipblas_bf8, hipblasBfloat16, float>(hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   int64_t            m,
+                                                   int64_t            n,
+                                                   int64_t            k,
+                                                   float              alpha,
+                                                   hipblas_bf8*       A,
+                                                   int64_t            lda,
+                                                   hipblas_bf8*       B,
+                                                   int64_t            ldb,
+                                                   float              beta,
+                                                   hipblasBfloat16*   C,
+                                                   int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 // hemm
 template <>
 void ref_hemm(hipblasSideMode_t side,
@@ -3932,6 +4233,509 @@ int ref_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int ref_potrs(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_spotrs(LAPACK_COL_MAJOR, uplo, n, nrhs, A, lda, B, ldb);
+
+    info = info_64;
+#else
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_dpotrs(LAPACK_COL_MAJOR, uplo, n, nrhs, A, lda, B, ldb);
+
+    info = info_64;
+#else
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs(char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_cpotrs(LAPACK_COL_MAJOR,
+                             uplo,
+                             n,
+                             nrhs,
+                             (lapack_complex_float*)A,
+                             lda,
+                             (lapack_complex_float*)B,
+                             ldb);
+
+    info = info_64;
+#else
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs(
+    char uplo, int n, int nrhs, hipblasDoubleComplex* A, int lda, hipblasDoubleComplex* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_zpotrs(LAPACK_COL_MAJOR,
+                             uplo,
+                             n,
+                             nrhs,
+                             (lapack_complex_double*)A,
+                             lda,
+                             (lapack_complex_double*)B,
+                             ldb);
+
+    info = info_64;
+#else
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+// potri
+template <>
+int ref_potri(char uplo, int n, float* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_spotri(LAPACK_COL_MAJOR, uplo, n, A, lda);
+
+    info = info_64;
+#else
+    spotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri(char uplo, int n, double* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_dpotri(LAPACK_COL_MAJOR, uplo, n, A, lda);
+
+    info = info_64;
+#else
+    dpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri(char uplo, int n, hipblasComplex* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_cpotri(LAPACK_COL_MAJOR, uplo, n, (lapack_complex_float*)A, lda);
+
+    info = info_64;
+#else
+    cpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri(char uplo, int n, hipblasDoubleComplex* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_zpotri(LAPACK_COL_MAJOR, uplo, n, (lapack_complex_double*)A, lda);
+
+    info = info_64;
+#else
+    zpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+// syevd
+template <>
+int ref_syevd(char jobz, char uplo, int n, float* A, int lda, float* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_ssyevd(LAPACK_COL_MAJOR, jobz, uplo, n, A, lda, W);
+
+    info = info_64;
+#else
+    float query;
+    int   iquery, lwork = -1, liwork = -1;
+    ssyevd_(&jobz, &uplo, &n, A, &lda, W, &query, &lwork, &iquery, &liwork, &info);
+
+    lwork  = std::max(1, int(query));
+    liwork = std::max(1, iquery);
+    std::vector<float> work(lwork);
+    std::vector<int>   iwork(liwork);
+    ssyevd_(&jobz, &uplo, &n, A, &lda, W, work.data(), &lwork, iwork.data(), &liwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_syevd(char jobz, char uplo, int n, double* A, int lda, double* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_dsyevd(LAPACK_COL_MAJOR, jobz, uplo, n, A, lda, W);
+
+    info = info_64;
+#else
+    double query;
+    int    iquery, lwork = -1, liwork = -1;
+    dsyevd_(&jobz, &uplo, &n, A, &lda, W, &query, &lwork, &iquery, &liwork, &info);
+
+    lwork  = std::max(1, int(query));
+    liwork = std::max(1, iquery);
+    std::vector<double> work(lwork);
+    std::vector<int>    iwork(liwork);
+    dsyevd_(&jobz, &uplo, &n, A, &lda, W, work.data(), &lwork, iwork.data(), &liwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_syevd(char jobz, char uplo, int n, hipblasComplex* A, int lda, float* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_cheevd(LAPACK_COL_MAJOR, jobz, uplo, n, (lapack_complex_float*)A, lda, W);
+
+    info = info_64;
+#else
+    hipblasComplex query;
+    float          rquery;
+    int            iquery, lwork = -1, lrwork = -1, liwork = -1;
+    cheevd_(&jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            W,
+            &query,
+            &lwork,
+            &rquery,
+            &lrwork,
+            &iquery,
+            &liwork,
+            &info);
+
+    lwork  = std::max(1, int(std::real(query)));
+    lrwork = std::max(1, int(rquery));
+    liwork = std::max(1, iquery);
+    std::vector<hipblasComplex> work(lwork);
+    std::vector<float>          rwork(lrwork);
+    std::vector<int>            iwork(liwork);
+    cheevd_(&jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            W,
+            work.data(),
+            &lwork,
+            rwork.data(),
+            &lrwork,
+            iwork.data(),
+            &liwork,
+            &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_syevd(char jobz, char uplo, int n, hipblasDoubleComplex* A, int lda, double* W)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_zheevd(LAPACK_COL_MAJOR, jobz, uplo, n, (lapack_complex_double*)A, lda, W);
+
+    info = info_64;
+#else
+    hipblasDoubleComplex query;
+    double               rquery;
+    int                  iquery, lwork = -1, lrwork = -1, liwork = -1;
+    zheevd_(&jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            W,
+            &query,
+            &lwork,
+            &rquery,
+            &lrwork,
+            &iquery,
+            &liwork,
+            &info);
+
+    lwork  = std::max(1, int(std::real(query)));
+    lrwork = std::max(1, int(rquery));
+    liwork = std::max(1, iquery);
+    std::vector<hipblasDoubleComplex> work(lwork);
+    std::vector<double>               rwork(lrwork);
+    std::vector<int>                  iwork(liwork);
+    zheevd_(&jobz,
+            &uplo,
+            &n,
+            A,
+            &lda,
+            W,
+            work.data(),
+            &lwork,
+            rwork.data(),
+            &lrwork,
+            iwork.data(),
+            &liwork,
+            &info);
+#endif
+
+    return info;
+}
+
+// gesvd, V holds the rows of V^H
+template <>
+int ref_gesvd(char   jobu,
+              char   jobv,
+              int    m,
+              int    n,
+              float* A,
+              int    lda,
+              float* S,
+              float* U,
+              int    ldu,
+              float* V,
+              int    ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t            info_64;
+    std::vector<float> superb(std::max(1, std::min(m, n)));
+    info_64 = LAPACKE_sgesvd(
+        LAPACK_COL_MAJOR, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, superb.data());
+
+    info = info_64;
+#else
+    float query;
+    int   lwork = -1;
+    sgesvd_(&jobu, &jobv, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &query, &lwork, &info);
+
+    lwork = std::max(1, int(query));
+    std::vector<float> work(lwork);
+    sgesvd_(&jobu, &jobv, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work.data(), &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_gesvd(char    jobu,
+              char    jobv,
+              int     m,
+              int     n,
+              double* A,
+              int     lda,
+              double* S,
+              double* U,
+              int     ldu,
+              double* V,
+              int     ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t             info_64;
+    std::vector<double> superb(std::max(1, std::min(m, n)));
+    info_64 = LAPACKE_dgesvd(
+        LAPACK_COL_MAJOR, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, superb.data());
+
+    info = info_64;
+#else
+    double query;
+    int    lwork = -1;
+    dgesvd_(&jobu, &jobv, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &query, &lwork, &info);
+
+    lwork = std::max(1, int(query));
+    std::vector<double> work(lwork);
+    dgesvd_(&jobu, &jobv, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work.data(), &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_gesvd(char            jobu,
+              char            jobv,
+              int             m,
+              int             n,
+              hipblasComplex* A,
+              int             lda,
+              float*          S,
+              hipblasComplex* U,
+              int             ldu,
+              hipblasComplex* V,
+              int             ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t            info_64;
+    std::vector<float> superb(std::max(1, std::min(m, n)));
+    info_64 = LAPACKE_cgesvd(LAPACK_COL_MAJOR,
+                             jobu,
+                             jobv,
+                             m,
+                             n,
+                             (lapack_complex_float*)A,
+                             lda,
+                             S,
+                             (lapack_complex_float*)U,
+                             ldu,
+                             (lapack_complex_float*)V,
+                             ldv,
+                             superb.data());
+
+    info = info_64;
+#else
+    hipblasComplex     query;
+    int                lwork = -1;
+    std::vector<float> rwork(5 * std::max(1, std::min(m, n)));
+    cgesvd_(
+        &jobu, &jobv, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &query, &lwork, rwork.data(), &info);
+
+    lwork = std::max(1, int(std::real(query)));
+    std::vector<hipblasComplex> work(lwork);
+    cgesvd_(&jobu,
+            &jobv,
+            &m,
+            &n,
+            A,
+            &lda,
+            S,
+            U,
+            &ldu,
+            V,
+            &ldv,
+            work.data(),
+            &lwork,
+            rwork.data(),
+            &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_gesvd(char                  jobu,
+              char                  jobv,
+              int                   m,
+              int                   n,
+              hipblasDoubleComplex* A,
+              int                   lda,
+              double*               S,
+              hipblasDoubleComplex* U,
+              int                   ldu,
+              hipblasDoubleComplex* V,
+              int                   ldv)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t             info_64;
+    std::vector<double> superb(std::max(1, std::min(m, n)));
+    info_64 = LAPACKE_zgesvd(LAPACK_COL_MAJOR,
+                             jobu,
+                             jobv,
+                             m,
+                             n,
+                             (lapack_complex_double*)A,
+                             lda,
+                             S,
+                             (lapack_complex_double*)U,
+                             ldu,
+                             (lapack_complex_double*)V,
+                             ldv,
+                             superb.data());
+
+    info = info_64;
+#else
+    hipblasDoubleComplex query;
+    int                  lwork = -1;
+    std::vector<double>  rwork(5 * std::max(1, std::min(m, n)));
+    zgesvd_(
+        &jobu, &jobv, &m, &n, A, &lda, S, U, &ldu, V, &ldv, &query, &lwork, rwork.data(), &info);
+
+    lwork = std::max(1, int(std::real(query)));
+    std::vector<hipblasDoubleComplex> work(lwork);
+    zgesvd_(&jobu,
+            &jobv,
+            &m,
+            &n,
+            A,
+            &lda,
+            S,
+            U,
+            &ldu,
+            V,
+            &ldv,
+            work.data(),
+            &lwork,
+            rwork.data(),
+            &info);
+#endif
+
+    return info;
+}
+
 // getrf
 template <>
 int ref_getrf<float>(int m, int n, float* A, int lda, int* ipiv)
@@ -43,6 +43,7 @@
 #include <string>
 #include <type_traits>
 // aux
+#include "auxil/testing_call_overhead.hpp"
 #include "auxil/testing_set_get_matrix.hpp"
 #include "auxil/testing_set_get_matrix_async.hpp"
 #include "auxil/testing_set_get_vector.hpp"
@@ -172,7 +173,10 @@
 #include "blas3/testing_her2k_strided_batched.hpp"
 #include "blas3/testing_herk.hpp"
 #include "blas3/testing_herk_batched.hpp"
+#include "blas3/testing_herk_batched_ex.hpp"
+#include "blas3/testing_herk_ex.hpp"
 #include "blas3/testing_herk_strided_batched.hpp"
+#include "blas3/testing_herk_strided_batched_ex.hpp"
 #include "blas3/testing_herkx.hpp"
 #include "blas3/testing_herkx_batched.hpp"
 #include "blas3/testing_herkx_strided_batched.hpp"
@@ -184,7 +188,10 @@
 #include "blas3/testing_syr2k_strided_batched.hpp"
 #include "blas3/testing_syrk.hpp"
 #include "blas3/testing_syrk_batched.hpp"
+#include "blas3/testing_syrk_batched_ex.hpp"
+#include "blas3/testing_syrk_ex.hpp"
 #include "blas3/testing_syrk_strided_batched.hpp"
+#include "blas3/testing_syrk_strided_batched_ex.hpp"
 #include "blas3/testing_syrkx.hpp"
 #include "blas3/testing_syrkx_batched.hpp"
 #include "blas3/testing_syrkx_strided_batched.hpp"
@@ -207,6 +214,8 @@
 #include "blas_ex/testing_dot_strided_batched_ex.hpp"
 #include "blas_ex/testing_gemm_batched_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_epilogue_ex.hpp"
+#include "blas_ex/testing_gemm_grouped_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_ex.hpp"
@@ -228,6 +237,9 @@
 #include "solver/testing_geqrf.hpp"
 #include "solver/testing_geqrf_batched.hpp"
 #include "solver/testing_geqrf_strided_batched.hpp"
+#include "solver/testing_gesv.hpp"
+#include "solver/testing_gesv_batched.hpp"
+#include "solver/testing_gesv_strided_batched.hpp"
 #include "solver/testing_getrf.hpp"
 #include "solver/testing_getrf_batched.hpp"
 #include "solver/testing_getrf_npvt.hpp"
@@ -239,6 +251,24 @@
 #include "solver/testing_getrs.hpp"
 #include "solver/testing_getrs_batched.hpp"
 #include "solver/testing_getrs_strided_batched.hpp"
+#include "solver/testing_potrf.hpp"
+#include "solver/testing_potrf_batched.hpp"
+#include "solver/testing_potrf_strided_batched.hpp"
+#include "solver/testing_potri.hpp"
+#include "solver/testing_potri_batched.hpp"
+#include "solver/testing_potri_strided_batched.hpp"
+#include "solver/testing_syevd.hpp"
+#include "solver/testing_syevd_batched.hpp"
+#include "solver/testing_syevd_strided_batched.hpp"
+#include "solver/testing_gesvd.hpp"
+#include "solver/testing_gesvd_batched.hpp"
+#include "solver/testing_gesvd_strided_batched.hpp"
+#include "solver/testing_gesvdj.hpp"
+#include "solver/testing_gesvdj_batched.hpp"
+#include "solver/testing_gesvdj_strided_batched.hpp"
+#include "solver/testing_potrs.hpp"
+#include "solver/testing_potrs_batched.hpp"
+#include "solver/testing_potrs_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -422,12 +452,21 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
+#ifdef HIPBLAS_V2
+        {"gemm_grouped_ex", testname_gemm_grouped_ex},
+        {"gemm_epilogue_ex", testname_gemm_epilogue_ex},
+#endif
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
         {"hemm_strided_batched", testname_hemm_strided_batched},
         {"herk", testname_herk},
         {"herk_batched", testname_herk_batched},
         {"herk_strided_batched", testname_herk_strided_batched},
+#ifdef HIPBLAS_V2
+        {"herk_ex", testname_herk_ex},
+        {"herk_batched_ex", testname_herk_batched_ex},
+        {"herk_strided_batched_ex", testname_herk_strided_batched_ex},
+#endif
         {"her2k", testname_her2k},
         {"her2k_batched", testname_her2k_batched},
         {"her2k_strided_batched", testname_her2k_strided_batched},
@@ -440,6 +479,11 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"syrk", testname_syrk},
         {"syrk_batched", testname_syrk_batched},
         {"syrk_strided_batched", testname_syrk_strided_batched},
+#ifdef HIPBLAS_V2
+        {"syrk_ex", testname_syrk_ex},
+        {"syrk_batched_ex", testname_syrk_batched_ex},
+        {"syrk_strided_batched_ex", testname_syrk_strided_batched_ex},
+#endif
         {"syr2k", testname_syr2k},
         {"syr2k_batched", testname_syr2k_batched},
         {"syr2k_strided_batched", testname_syr2k_strided_batched},
@@ -463,6 +507,9 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"geqrf", testname_geqrf},
         {"geqrf_batched", testname_geqrf_batched},
         {"geqrf_strided_batched", testname_geqrf_strided_batched},
+        {"gesv", testname_gesv},
+        {"gesv_batched", testname_gesv_batched},
+        {"gesv_strided_batched", testname_gesv_strided_batched},
         {"getrf", testname_getrf},
         {"getrf_batched", testname_getrf_batched},
         {"getrf_strided_batched", testname_getrf_strided_batched},
@@ -474,12 +521,34 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"getrs", testname_getrs},
         {"getrs_batched", testname_getrs_batched},
         {"getrs_strided_batched", testname_getrs_strided_batched},
+        {"potrf", testname_potrf},
+        {"potrf_batched", testname_potrf_batched},
+        {"potrf_strided_batched", testname_potrf_strided_batched},
+        {"potrs", testname_potrs},
+        {"potrs_batched", testname_potrs_batched},
+        {"potrs_strided_batched", testname_potrs_strided_batched},
+        {"potri", testname_potri},
+        {"potri_batched", testname_potri_batched},
+        {"potri_strided_batched", testname_potri_strided_batched},
+        {"syevd", testname_syevd},
+        {"syevd_batched", testname_syevd_batched},
+        {"syevd_strided_batched", testname_syevd_strided_batched},
+        {"heevd", testname_syevd},
+        {"heevd_batched", testname_syevd_batched},
+        {"heevd_strided_batched", testname_syevd_strided_batched},
+        {"gesvd", testname_gesvd},
+        {"gesvd_batched", testname_gesvd_batched},
+        {"gesvd_strided_batched", testname_gesvd_strided_batched},
+        {"gesvdj", testname_gesvdj},
+        {"gesvdj_batched", testname_gesvdj_batched},
+        {"gesvdj_strided_batched", testname_gesvdj_strided_batched},
         {"gels", testname_gels},
         {"gels_batched", testname_gels_batched},
         {"gels_strided_batched", testname_gels_strided_batched},
 #endif
 
         // Aux
+        {"call_overhead", testname_call_overhead},
         {"set_get_vector", testname_set_get_vector},
         {"set_get_vector_async", testname_set_get_vector_async},
         {"set_get_matrix", testname_set_get_matrix},
@@ -512,6 +581,10 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex<Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex<Ti, To, Tc>},
+#ifdef HIPBLAS_V2
+            {"gemm_grouped_ex", testing_gemm_grouped_ex<Ti, To, Tc>},
+            {"gemm_epilogue_ex", testing_gemm_epilogue_ex<Ti, To, Tc>},
+#endif
         };
         run_function(map, arg);
     }
@@ -692,12 +765,31 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"syevd", testing_syevd<T>},
+            {"syevd_batched", testing_syevd_batched<T>},
+            {"syevd_strided_batched", testing_syevd_strided_batched<T>},
+            {"gesvd", testing_gesvd<T>},
+            {"gesvd_batched", testing_gesvd_batched<T>},
+            {"gesvd_strided_batched", testing_gesvd_strided_batched<T>},
+            {"gesvdj", testing_gesvdj<T>},
+            {"gesvdj_batched", testing_gesvdj_batched<T>},
+            {"gesvdj_strided_batched", testing_gesvdj_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
 #endif
 
             // Aux
+            {"call_overhead", testing_call_overhead<T>},
             {"set_get_vector", testing_set_get_vector<T>},
             {"set_get_vector_async", testing_set_get_vector_async<T>},
             {"set_get_matrix", testing_set_get_matrix<T>},
@@ -914,6 +1006,27 @@ struct perf_blas<
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"syevd", testing_syevd<T>},
+            {"syevd_batched", testing_syevd_batched<T>},
+            {"syevd_strided_batched", testing_syevd_strided_batched<T>},
+            {"heevd", testing_syevd<T>},
+            {"heevd_batched", testing_syevd_batched<T>},
+            {"heevd_strided_batched", testing_syevd_strided_batched<T>},
+            {"gesvd", testing_gesvd<T>},
+            {"gesvd_batched", testing_gesvd_batched<T>},
+            {"gesvd_strided_batched", testing_gesvd_strided_batched<T>},
+            {"gesvdj", testing_gesvdj<T>},
+            {"gesvdj_batched", testing_gesvdj_batched<T>},
+            {"gesvdj_strided_batched", testing_gesvdj_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
@@ -1189,6 +1302,54 @@ struct perf_blas_scal_ex<
     }
 };
 
+#ifdef __HIP_PLATFORM_SOLVER__
+template <typename T, typename = void>
+struct perf_gesv : hipblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_gesv<
+    T,
+    std::enable_if_t<std::is_same<T, double>{} || std::is_same<T, hipblasDoubleComplex>{}>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gesv", testing_gesv<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+        };
+        run_function(map, arg);
+    }
+};
+#endif
+
+#ifdef HIPBLAS_V2
+template <typename T, typename = void>
+struct perf_syrk_ex : hipblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_syrk_ex<T, std::enable_if_t<std::is_same<T, hipblasComplex>{}>> : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"syrk_ex", testing_syrk_ex<T>},
+            {"syrk_batched_ex", testing_syrk_batched_ex<T>},
+            {"syrk_strided_batched_ex", testing_syrk_strided_batched_ex<T>},
+            {"herk_ex", testing_herk_ex<T>},
+            {"herk_batched_ex", testing_herk_batched_ex<T>},
+            {"herk_strided_batched_ex", testing_herk_strided_batched_ex<T>},
+        };
+        run_function(map, arg);
+    }
+};
+#endif
+
 int run_bench_test(Arguments& arg, int unit_check, int timing)
 {
     //hipblas_initialize(); // Initialize rocBLAS
@@ -1282,7 +1443,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_epilogue_ex"))
     {
         // adjust dimension for GEMM routines
         int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1346,9 +1508,29 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
                       << min_stride_c << std::endl;
             arg.stride_c = min_stride_c;
         }
+        int64_t min_stride_d = arg.ldd * arg.N;
+        if(arg.c_noalias_d && arg.stride_d < min_stride_d)
+        {
+            std::cout << "hipblas-bench INFO: stride_d < min_stride_d, set stride_d = "
+                      << min_stride_d << std::endl;
+            arg.stride_d = min_stride_d;
+        }
 
         hipblas_gemm_dispatch<perf_gemm_strided_batched_ex>(arg);
     }
+#ifdef HIPBLAS_V2
+    else if(!strcmp(function, "gemm_grouped_ex"))
+    {
+        // the leading dimensions of each group are the smallest legal ones
+        hipblas_gemm_dispatch<perf_gemm_ex>(arg);
+    }
+    else if(!strcmp(function, "syrk_ex") || !strcmp(function, "syrk_batched_ex")
+            || !strcmp(function, "syrk_strided_batched_ex") || !strcmp(function, "herk_ex")
+            || !strcmp(function, "herk_batched_ex") || !strcmp(function, "herk_strided_batched_ex"))
+    {
+        hipblas_syrk_ex_dispatch<perf_syrk_ex>(arg);
+    }
+#endif
     else
     {
         if(!strcmp(function, "scal_ex") || !strcmp(function, "scal_batched_ex")
@@ -1376,6 +1558,11 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         else if(!strcmp(function, "rot_ex") || !strcmp(function, "rot_batched_ex")
                 || !strcmp(function, "rot_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
+#ifdef __HIP_PLATFORM_SOLVER__
+        else if(!strcmp(function, "gesv") || !strcmp(function, "gesv_batched")
+                || !strcmp(function, "gesv_strided_batched"))
+            hipblas_simple_dispatch<perf_gesv>(arg);
+#endif
         else
             hipblas_simple_dispatch<perf_blas>(arg);
     }
@@ -27,6 +27,7 @@
 #include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <type_traits>
 #include <utility>
 
 bool gpu_arch_match(const std::string& gpu_arch, const char pattern[4])
@@ -62,7 +63,17 @@ std::ostream& operator<<(std::ostream& os, const Arguments& arg)
 {
     // delim starts as "{ " and becomes ", " afterwards
     auto print_pair = [&, delim = "{ "](const char* name, const auto& value) mutable {
-        os << delim << std::make_pair(name, value);
+        using V = std::remove_cv_t<std::remove_reference_t<decltype(value)>>;
+        if constexpr(std::is_array_v<V> && !std::is_same_v<std::remove_extent_t<V>, char>)
+        {
+            // arrays other than strings, such as group_M, are printed as YAML lists
+            os << delim << name << ": [";
+            for(size_t i = 0; i < std::extent_v<V>; i++)
+                os << (i ? ", " : "") << value[i];
+            os << "]";
+        }
+        else
+            os << delim << std::make_pair(name, value);
         delim = ", ";
     };
 
@@ -164,6 +164,42 @@ hipblasSideMode_t char2hipblas_side(char value)
     return HIPBLAS_SIDE_LEFT;
 }
 
+hipblasEigMode_t char2hipblas_eig_mode(char value)
+{
+    switch(value)
+    {
+    case 'N':
+        return HIPBLAS_EIG_MODE_NOVECTOR;
+    case 'V':
+        return HIPBLAS_EIG_MODE_VECTOR;
+    case 'n':
+        return HIPBLAS_EIG_MODE_NOVECTOR;
+    case 'v':
+        return HIPBLAS_EIG_MODE_VECTOR;
+    }
+    return HIPBLAS_EIG_MODE_VECTOR;
+}
+
+hipblasSvdMode_t char2hipblas_svd_mode(char value)
+{
+    switch(value)
+    {
+    case 'N':
+        return HIPBLAS_SVD_MODE_NOVECTOR;
+    case 'S':
+        return HIPBLAS_SVD_MODE_SINGULAR;
+    case 'A':
+        return HIPBLAS_SVD_MODE_ALL;
+    case 'n':
+        return HIPBLAS_SVD_MODE_NOVECTOR;
+    case 's':
+        return HIPBLAS_SVD_MODE_SINGULAR;
+    case 'a':
+        return HIPBLAS_SVD_MODE_ALL;
+    }
+    return HIPBLAS_SVD_MODE_SINGULAR;
+}
+
 // clang-format off
 hipblasDatatype_t string2hipblas_datatype(const std::string& value)
 {
@@ -184,6 +220,10 @@ hipblasDatatype_t string2hipblas_datatype(const std::string& value)
         value == "u32_r"                 ? HIPBLAS_R_32U  :
         value == "u8_c"                  ? HIPBLAS_C_8U   :
         value == "u32_c"                 ? HIPBLAS_C_32U  :
+#ifdef HIPBLAS_V2
+        value == "f8_r"                  ? HIP_R_8F_E4M3_FNUZ :
+        value == "bf8_r"                 ? HIP_R_8F_E5M2_FNUZ :
+#endif
         HIPBLAS_DATATYPE_INVALID;
 }
 
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_replay.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+static std::string hipblas_replay_trim(const std::string& s)
+{
+    size_t begin = s.find_first_not_of(" \t\r");
+    size_t end   = s.find_last_not_of(" \t\r");
+    return begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+}
+
+bool hipblas_replay_parse(const std::string& line, hipblas_replay_record& record)
+{
+    std::string text = hipblas_replay_trim(line);
+    if(text.size() < 4 || text.compare(0, 3, "- {") || text.back() != '}')
+        return false;
+
+    std::vector<std::pair<std::string, std::string>> fields;
+    std::istringstream                               is(text.substr(3, text.size() - 4));
+    for(std::string field; std::getline(is, field, ',');)
+    {
+        size_t colon = field.find(':');
+        if(colon == std::string::npos)
+            throw std::invalid_argument("Invalid trace line: " + line);
+        fields.emplace_back(hipblas_replay_trim(field.substr(0, colon)),
+                            hipblas_replay_trim(field.substr(colon + 1)));
+    }
+
+    static const char* header[] = {"call",
+                                   "thread",
+                                   "function",
+                                   "handle",
+                                   "device",
+                                   "stream",
+                                   "pointer_mode",
+                                   "atomics_mode",
+                                   "math_mode"};
+    constexpr size_t   header_size = sizeof(header) / sizeof(header[0]);
+    if(fields.size() < header_size)
+        throw std::invalid_argument("Invalid trace line: " + line);
+    for(size_t i = 0; i < header_size; i++)
+        if(fields[i].first != header[i])
+            throw std::invalid_argument("Invalid trace line: " + line);
+
+    record.call         = std::stoull(fields[0].second);
+    record.function     = fields[2].second;
+    record.handle       = fields[3].second;
+    record.device       = std::max(0, std::stoi(fields[4].second));
+    record.stream       = fields[5].second;
+    record.pointer_mode = fields[6].second == "device" ? HIPBLAS_POINTER_MODE_DEVICE
+                                                       : HIPBLAS_POINTER_MODE_HOST;
+    record.atomics_mode = fields[7].second == "not_allowed" ? HIPBLAS_ATOMICS_NOT_ALLOWED
+                                                            : HIPBLAS_ATOMICS_ALLOWED;
+    record.math_mode    = hipblasMath_t(std::stoi(fields[8].second));
+    record.args.assign(fields.begin() + header_size, fields.end());
+    return true;
+}
@@ -2496,6 +2496,69 @@ hipblasStatus_t hipblasZgbmvCast(hipblasHandle_t             handle,
                         incy);
 }
 
+// gbmv_64
+hipblasStatus_t hipblasCgbmvCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    int64_t               kl,
+                                    int64_t               ku,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy)
+{
+    return hipblasCgbmv_64(handle,
+                           transA,
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)beta,
+                           (hipComplex*)y,
+                           incy);
+}
+
+hipblasStatus_t hipblasZgbmvCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    int64_t                     kl,
+                                    int64_t                     ku,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy)
+{
+    return hipblasZgbmv_64(handle,
+                           transA,
+                           m,
+                           n,
+                           kl,
+                           ku,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)y,
+                           incy);
+}
+
 // gbmv_batched
 hipblasStatus_t hipblasCgbmvBatchedCast(hipblasHandle_t             handle,
                                         hipblasOperation_t          transA,
@@ -2563,6 +2626,73 @@ hipblasStatus_t hipblasZgbmvBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// gbmv_batched_64
+hipblasStatus_t hipblasCgbmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           int64_t                     kl,
+                                           int64_t                     ku,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batch_count)
+{
+    return hipblasCgbmvBatched_64(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  kl,
+                                  ku,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)y,
+                                  incy,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZgbmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           int64_t                           kl,
+                                           int64_t                           ku,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batch_count)
+{
+    return hipblasZgbmvBatched_64(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  kl,
+                                  ku,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)y,
+                                  incy,
+                                  batch_count);
+}
+
 // gbmv_strided_batched
 hipblasStatus_t hipblasCgbmvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasOperation_t    transA,
@@ -2642,6 +2772,85 @@ hipblasStatus_t hipblasZgbmvStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// gbmv_strided_batched_64
+hipblasStatus_t hipblasCgbmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  int64_t               kl,
+                                                  int64_t               ku,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stride_y,
+                                                  int64_t               batch_count)
+{
+    return hipblasCgbmvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)y,
+                                         incy,
+                                         stride_y,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZgbmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  int64_t                     kl,
+                                                  int64_t                     ku,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stride_y,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZgbmvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)y,
+                                         incy,
+                                         stride_y,
+                                         batch_count);
+}
+
 // gemv
 hipblasStatus_t hipblasCgemvCast(hipblasHandle_t       handle,
                                  hipblasOperation_t    transA,
@@ -2697,6 +2906,61 @@ hipblasStatus_t hipblasZgemvCast(hipblasHandle_t             handle,
                         incy);
 }
 
+// gemv_64
+hipblasStatus_t hipblasCgemvCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy)
+{
+    return hipblasCgemv_64(handle,
+                           transA,
+                           m,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)beta,
+                           (hipComplex*)y,
+                           incy);
+}
+
+hipblasStatus_t hipblasZgemvCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy)
+{
+    return hipblasZgemv_64(handle,
+                           transA,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)y,
+                           incy);
+}
+
 // gemv_batched
 hipblasStatus_t hipblasCgemvBatchedCast(hipblasHandle_t             handle,
                                         hipblasOperation_t          transA,
@@ -2756,6 +3020,65 @@ hipblasStatus_t hipblasZgemvBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// gemv_batched_64
+hipblasStatus_t hipblasCgemvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batch_count)
+{
+    return hipblasCgemvBatched_64(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)y,
+                                  incy,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZgemvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batch_count)
+{
+    return hipblasZgemvBatched_64(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)y,
+                                  incy,
+                                  batch_count);
+}
+
 // gemv_strided_batched
 hipblasStatus_t hipblasCgemvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasOperation_t    transA,
@@ -2827,6 +3150,77 @@ hipblasStatus_t hipblasZgemvStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// gemv_strided_batched_64
+hipblasStatus_t hipblasCgemvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batch_count)
+{
+    return hipblasCgemvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZgemvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZgemvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batch_count);
+}
+
 // ger
 hipblasStatus_t hipblasCgeruCast(hipblasHandle_t       handle,
                                  int                   m,
@@ -2920,6 +3314,99 @@ hipblasStatus_t hipblasZgercCast(hipblasHandle_t             handle,
                         lda);
 }
 
+// ger_64
+hipblasStatus_t hipblasCgeruCast_64(hipblasHandle_t       handle,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda)
+{
+    return hipblasCgeru_64(handle,
+                           m,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)y,
+                           incy,
+                           (hipComplex*)A,
+                           lda);
+}
+
+hipblasStatus_t hipblasCgercCast_64(hipblasHandle_t       handle,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda)
+{
+    return hipblasCgerc_64(handle,
+                           m,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)y,
+                           incy,
+                           (hipComplex*)A,
+                           lda);
+}
+
+hipblasStatus_t hipblasZgeruCast_64(hipblasHandle_t             handle,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda)
+{
+    return hipblasZgeru_64(handle,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)y,
+                           incy,
+                           (hipDoubleComplex*)A,
+                           lda);
+}
+
+hipblasStatus_t hipblasZgercCast_64(hipblasHandle_t             handle,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda)
+{
+    return hipblasZgerc_64(handle,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)y,
+                           incy,
+                           (hipDoubleComplex*)A,
+                           lda);
+}
+
 // ger_batched
 hipblasStatus_t hipblasCgeruBatchedCast(hipblasHandle_t             handle,
                                         int                         m,
@@ -3021,10 +3508,111 @@ hipblasStatus_t hipblasZgercBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
-// ger_strided_batched
-hipblasStatus_t hipblasCgeruStridedBatchedCast(hipblasHandle_t       handle,
-                                               int                   m,
-                                               int                   n,
+// ger_batched_64
+hipblasStatus_t hipblasCgeruBatchedCast_64(hipblasHandle_t             handle,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batch_count)
+{
+    return hipblasCgeruBatched_64(handle,
+                                  m,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex* const*)y,
+                                  incy,
+                                  (hipComplex* const*)A,
+                                  lda,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasCgercBatchedCast_64(hipblasHandle_t             handle,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batch_count)
+{
+    return hipblasCgercBatched_64(handle,
+                                  m,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex* const*)y,
+                                  incy,
+                                  (hipComplex* const*)A,
+                                  lda,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZgeruBatchedCast_64(hipblasHandle_t                   handle,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batch_count)
+{
+    return hipblasZgeruBatched_64(handle,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex* const*)y,
+                                  incy,
+                                  (hipDoubleComplex* const*)A,
+                                  lda,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZgercBatchedCast_64(hipblasHandle_t                   handle,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batch_count)
+{
+    return hipblasZgercBatched_64(handle,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex* const*)y,
+                                  incy,
+                                  (hipDoubleComplex* const*)A,
+                                  lda,
+                                  batch_count);
+}
+
+// ger_strided_batched
+hipblasStatus_t hipblasCgeruStridedBatchedCast(hipblasHandle_t       handle,
+                                               int                   m,
+                                               int                   n,
                                                const hipblasComplex* alpha,
                                                const hipblasComplex* x,
                                                int                   incx,
@@ -3146,6 +3734,131 @@ hipblasStatus_t hipblasZgercStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// ger_strided_batched_64
+hipblasStatus_t hipblasCgeruStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batch_count)
+{
+    return hipblasCgeruStridedBatched_64(handle,
+                                         m,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasCgercStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batch_count)
+{
+    return hipblasCgercStridedBatched_64(handle,
+                                         m,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZgeruStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZgeruStridedBatched_64(handle,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZgercStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZgercStridedBatched_64(handle,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
 // hbmv
 hipblasStatus_t hipblasChbmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -3201,6 +3914,61 @@ hipblasStatus_t hipblasZhbmvCast(hipblasHandle_t             handle,
                         incy);
 }
 
+// hbmv_64
+hipblasStatus_t hipblasChbmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy)
+{
+    return hipblasChbmv_64(handle,
+                           uplo,
+                           n,
+                           k,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)beta,
+                           (hipComplex*)y,
+                           incy);
+}
+
+hipblasStatus_t hipblasZhbmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy)
+{
+    return hipblasZhbmv_64(handle,
+                           uplo,
+                           n,
+                           k,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)y,
+                           incy);
+}
+
 // hbmv_batched
 hipblasStatus_t hipblasChbmvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -3260,6 +4028,65 @@ hipblasStatus_t hipblasZhbmvBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// hbmv_batched_64
+hipblasStatus_t hipblasChbmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batchCount)
+{
+    return hipblasChbmvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  k,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)y,
+                                  incy,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZhbmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batchCount)
+{
+    return hipblasZhbmvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  k,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)y,
+                                  incy,
+                                  batchCount);
+}
+
 // hbmv_strided_batched
 hipblasStatus_t hipblasChbmvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -3331,6 +4158,77 @@ hipblasStatus_t hipblasZhbmvStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// hbmv_strided_batched_64
+hipblasStatus_t hipblasChbmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batchCount)
+{
+    return hipblasChbmvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         k,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZhbmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZhbmvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         k,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batchCount);
+}
+
 // hemv
 hipblasStatus_t hipblasChemvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -3382,6 +4280,57 @@ hipblasStatus_t hipblasZhemvCast(hipblasHandle_t             handle,
                         incy);
 }
 
+// hemv_64
+hipblasStatus_t hipblasChemvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy)
+{
+    return hipblasChemv_64(handle,
+                           uplo,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)beta,
+                           (hipComplex*)y,
+                           incy);
+}
+
+hipblasStatus_t hipblasZhemvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy)
+{
+    return hipblasZhemv_64(handle,
+                           uplo,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)y,
+                           incy);
+}
+
 // hemv_batched
 hipblasStatus_t hipblasChemvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -3437,6 +4386,61 @@ hipblasStatus_t hipblasZhemvBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// hemv_batched_64
+hipblasStatus_t hipblasChemvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batch_count)
+{
+    return hipblasChemvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)y,
+                                  incy,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZhemvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batch_count)
+{
+    return hipblasZhemvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)y,
+                                  incy,
+                                  batch_count);
+}
+
 // hemv_strided_batched
 hipblasStatus_t hipblasChemvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -3504,6 +4508,73 @@ hipblasStatus_t hipblasZhemvStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// hemv_strided_batched_64
+hipblasStatus_t hipblasChemvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stride_y,
+                                                  int64_t               batch_count)
+{
+    return hipblasChemvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)y,
+                                         incy,
+                                         stride_y,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZhemvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stride_y,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZhemvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)y,
+                                         incy,
+                                         stride_y,
+                                         batch_count);
+}
+
 // her
 hipblasStatus_t hipblasCherCast(hipblasHandle_t       handle,
                                 hipblasFillMode_t     uplo,
@@ -3530,6 +4601,32 @@ hipblasStatus_t hipblasZherCast(hipblasHandle_t             handle,
         handle, uplo, n, alpha, (const hipDoubleComplex*)x, incx, (hipDoubleComplex*)A, lda);
 }
 
+// her_64
+hipblasStatus_t hipblasCherCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const float*          alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       A,
+                                   int64_t               lda)
+{
+    return hipblasCher_64(handle, uplo, n, alpha, (const hipComplex*)x, incx, (hipComplex*)A, lda);
+}
+
+hipblasStatus_t hipblasZherCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const double*               alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       A,
+                                   int64_t                     lda)
+{
+    return hipblasZher_64(
+        handle, uplo, n, alpha, (const hipDoubleComplex*)x, incx, (hipDoubleComplex*)A, lda);
+}
+
 // her_batched
 hipblasStatus_t hipblasCherBatchedCast(hipblasHandle_t             handle,
                                        hipblasFillMode_t           uplo,
@@ -3573,6 +4670,49 @@ hipblasStatus_t hipblasZherBatchedCast(hipblasHandle_t                   handle,
                               batchCount);
 }
 
+// her_batched_64
+hipblasStatus_t hipblasCherBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const float*                alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       A[],
+                                          int64_t                     lda,
+                                          int64_t                     batchCount)
+{
+    return hipblasCherBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 alpha,
+                                 (const hipComplex* const*)x,
+                                 incx,
+                                 (hipComplex* const*)A,
+                                 lda,
+                                 batchCount);
+}
+
+hipblasStatus_t hipblasZherBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const double*                     alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       A[],
+                                          int64_t                           lda,
+                                          int64_t                           batchCount)
+{
+    return hipblasZherBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 alpha,
+                                 (const hipDoubleComplex* const*)x,
+                                 incx,
+                                 (hipDoubleComplex* const*)A,
+                                 lda,
+                                 batchCount);
+}
+
 // her_strided_batched
 hipblasStatus_t hipblasCherStridedBatchedCast(hipblasHandle_t       handle,
                                               hipblasFillMode_t     uplo,
@@ -3624,6 +4764,57 @@ hipblasStatus_t hipblasZherStridedBatchedCast(hipblasHandle_t             handle
                                      batchCount);
 }
 
+// her_strided_batched_64
+hipblasStatus_t hipblasCherStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const float*          alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       A,
+                                                 int64_t               lda,
+                                                 hipblasStride         strideA,
+                                                 int64_t               batchCount)
+{
+    return hipblasCherStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        alpha,
+                                        (const hipComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipComplex*)A,
+                                        lda,
+                                        strideA,
+                                        batchCount);
+}
+
+hipblasStatus_t hipblasZherStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const double*               alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       A,
+                                                 int64_t                     lda,
+                                                 hipblasStride               strideA,
+                                                 int64_t                     batchCount)
+{
+    return hipblasZherStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        alpha,
+                                        (const hipDoubleComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        strideA,
+                                        batchCount);
+}
+
 // her2
 hipblasStatus_t hipblasCher2Cast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -3671,6 +4862,53 @@ hipblasStatus_t hipblasZher2Cast(hipblasHandle_t             handle,
                         lda);
 }
 
+// her2_64
+hipblasStatus_t hipblasCher2Cast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda)
+{
+    return hipblasCher2_64(handle,
+                           uplo,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)y,
+                           incy,
+                           (hipComplex*)A,
+                           lda);
+}
+
+hipblasStatus_t hipblasZher2Cast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda)
+{
+    return hipblasZher2_64(handle,
+                           uplo,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)y,
+                           incy,
+                           (hipDoubleComplex*)A,
+                           lda);
+}
+
 // her2_batched
 hipblasStatus_t hipblasCher2BatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -3722,6 +4960,57 @@ hipblasStatus_t hipblasZher2BatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// her2_batched_64
+hipblasStatus_t hipblasCher2BatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batchCount)
+{
+    return hipblasCher2Batched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex* const*)y,
+                                  incy,
+                                  (hipComplex* const*)A,
+                                  lda,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZher2BatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batchCount)
+{
+    return hipblasZher2Batched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex* const*)y,
+                                  incy,
+                                  (hipDoubleComplex* const*)A,
+                                  lda,
+                                  batchCount);
+}
+
 // her2_strided_batched
 hipblasStatus_t hipblasCher2StridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -3785,6 +5074,69 @@ hipblasStatus_t hipblasZher2StridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// her2_strided_batched_64
+hipblasStatus_t hipblasCher2StridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batchCount)
+{
+    return hipblasCher2StridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZher2StridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZher2StridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batchCount);
+}
+
 // hpmv
 hipblasStatus_t hipblasChpmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -3832,6 +5184,53 @@ hipblasStatus_t hipblasZhpmvCast(hipblasHandle_t             handle,
                         incy);
 }
 
+// hpmv_64
+hipblasStatus_t hipblasChpmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* AP,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy)
+{
+    return hipblasChpmv_64(handle,
+                           uplo,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)AP,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)beta,
+                           (hipComplex*)y,
+                           incy);
+}
+
+hipblasStatus_t hipblasZhpmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* AP,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy)
+{
+    return hipblasZhpmv_64(handle,
+                           uplo,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)AP,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)y,
+                           incy);
+}
+
 // hpmv_batched
 hipblasStatus_t hipblasChpmvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -3883,6 +5282,57 @@ hipblasStatus_t hipblasZhpmvBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// hpmv_batched_64
+hipblasStatus_t hipblasChpmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const AP[],
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batchCount)
+{
+    return hipblasChpmvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)AP,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)y,
+                                  incy,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZhpmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const AP[],
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batchCount)
+{
+    return hipblasZhpmvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)AP,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)y,
+                                  incy,
+                                  batchCount);
+}
+
 // hpmv_strided_batched
 hipblasStatus_t hipblasChpmvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -3946,6 +5396,69 @@ hipblasStatus_t hipblasZhpmvStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// hpmv_strided_batched_64
+hipblasStatus_t hipblasChpmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* AP,
+                                                  hipblasStride         strideAP,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batchCount)
+{
+    return hipblasChpmvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)AP,
+                                         strideAP,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZhpmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* AP,
+                                                  hipblasStride               strideAP,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZhpmvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)AP,
+                                         strideAP,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batchCount);
+}
+
 // hpr
 hipblasStatus_t hipblasChprCast(hipblasHandle_t       handle,
                                 hipblasFillMode_t     uplo,
@@ -3970,6 +5483,30 @@ hipblasStatus_t hipblasZhprCast(hipblasHandle_t             handle,
         handle, uplo, n, alpha, (const hipDoubleComplex*)x, incx, (hipDoubleComplex*)AP);
 }
 
+// hpr_64
+hipblasStatus_t hipblasChprCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const float*          alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       AP)
+{
+    return hipblasChpr_64(handle, uplo, n, alpha, (const hipComplex*)x, incx, (hipComplex*)AP);
+}
+
+hipblasStatus_t hipblasZhprCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const double*               alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       AP)
+{
+    return hipblasZhpr_64(
+        handle, uplo, n, alpha, (const hipDoubleComplex*)x, incx, (hipDoubleComplex*)AP);
+}
+
 // hpr_batched
 hipblasStatus_t hipblasChprBatchedCast(hipblasHandle_t             handle,
                                        hipblasFillMode_t           uplo,
@@ -3999,14 +5536,53 @@ hipblasStatus_t hipblasZhprBatchedCast(hipblasHandle_t                   handle,
                                        hipblasDoubleComplex* const       AP[],
                                        int                               batchCount)
 {
-    return hipblasZhprBatched(handle,
-                              uplo,
-                              n,
-                              alpha,
-                              (const hipDoubleComplex* const*)x,
-                              incx,
-                              (hipDoubleComplex* const*)AP,
-                              batchCount);
+    return hipblasZhprBatched(handle,
+                              uplo,
+                              n,
+                              alpha,
+                              (const hipDoubleComplex* const*)x,
+                              incx,
+                              (hipDoubleComplex* const*)AP,
+                              batchCount);
+}
+
+// hpr_batched_64
+hipblasStatus_t hipblasChprBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const float*                alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       AP[],
+                                          int64_t                     batchCount)
+{
+    return hipblasChprBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 alpha,
+                                 (const hipComplex* const*)x,
+                                 incx,
+                                 (hipComplex* const*)AP,
+                                 batchCount);
+}
+
+hipblasStatus_t hipblasZhprBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const double*                     alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       AP[],
+                                          int64_t                           batchCount)
+{
+    return hipblasZhprBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 alpha,
+                                 (const hipDoubleComplex* const*)x,
+                                 incx,
+                                 (hipDoubleComplex* const*)AP,
+                                 batchCount);
 }
 
 // hpr_strided_batched
@@ -4056,6 +5632,53 @@ hipblasStatus_t hipblasZhprStridedBatchedCast(hipblasHandle_t             handle
                                      batchCount);
 }
 
+// hpr_strided_batched_64
+hipblasStatus_t hipblasChprStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const float*          alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       AP,
+                                                 hipblasStride         strideAP,
+                                                 int64_t               batchCount)
+{
+    return hipblasChprStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        alpha,
+                                        (const hipComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipComplex*)AP,
+                                        strideAP,
+                                        batchCount);
+}
+
+hipblasStatus_t hipblasZhprStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const double*               alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       AP,
+                                                 hipblasStride               strideAP,
+                                                 int64_t                     batchCount)
+{
+    return hipblasZhprStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        alpha,
+                                        (const hipDoubleComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipDoubleComplex*)AP,
+                                        strideAP,
+                                        batchCount);
+}
+
 // hpr2
 hipblasStatus_t hipblasChpr2Cast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -4099,6 +5722,49 @@ hipblasStatus_t hipblasZhpr2Cast(hipblasHandle_t             handle,
                         (hipDoubleComplex*)AP);
 }
 
+// hpr2_64
+hipblasStatus_t hipblasChpr2Cast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       AP)
+{
+    return hipblasChpr2_64(handle,
+                           uplo,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)y,
+                           incy,
+                           (hipComplex*)AP);
+}
+
+hipblasStatus_t hipblasZhpr2Cast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       AP)
+{
+    return hipblasZhpr2_64(handle,
+                           uplo,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)y,
+                           incy,
+                           (hipDoubleComplex*)AP);
+}
+
 // hpr2_batched
 hipblasStatus_t hipblasChpr2BatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -4146,6 +5812,53 @@ hipblasStatus_t hipblasZhpr2BatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// hpr2_batched_64
+hipblasStatus_t hipblasChpr2BatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       AP[],
+                                           int64_t                     batchCount)
+{
+    return hipblasChpr2Batched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex* const*)y,
+                                  incy,
+                                  (hipComplex* const*)AP,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZhpr2BatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       AP[],
+                                           int64_t                           batchCount)
+{
+    return hipblasZhpr2Batched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex* const*)y,
+                                  incy,
+                                  (hipDoubleComplex* const*)AP,
+                                  batchCount);
+}
+
 // hpr2_strided_batched
 hipblasStatus_t hipblasChpr2StridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -4205,6 +5918,65 @@ hipblasStatus_t hipblasZhpr2StridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// hpr2_strided_batched_64
+hipblasStatus_t hipblasChpr2StridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       AP,
+                                                  hipblasStride         strideAP,
+                                                  int64_t               batchCount)
+{
+    return hipblasChpr2StridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipComplex*)AP,
+                                         strideAP,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZhpr2StridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       AP,
+                                                  hipblasStride               strideAP,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZhpr2StridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipDoubleComplex*)AP,
+                                         strideAP,
+                                         batchCount);
+}
+
 // sbmv, spmv, spr2 no complex versions
 
 // spr
@@ -4237,6 +6009,36 @@ hipblasStatus_t hipblasZsprCast(hipblasHandle_t             handle,
                        (hipDoubleComplex*)AP);
 }
 
+// spr_64
+hipblasStatus_t hipblasCsprCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const hipblasComplex* alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       AP)
+{
+    return hipblasCspr_64(
+        handle, uplo, n, (const hipComplex*)alpha, (const hipComplex*)x, incx, (hipComplex*)AP);
+}
+
+hipblasStatus_t hipblasZsprCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       AP)
+{
+    return hipblasZspr_64(handle,
+                          uplo,
+                          n,
+                          (const hipDoubleComplex*)alpha,
+                          (const hipDoubleComplex*)x,
+                          incx,
+                          (hipDoubleComplex*)AP);
+}
+
 // spr_batched
 hipblasStatus_t hipblasCsprBatchedCast(hipblasHandle_t             handle,
                                        hipblasFillMode_t           uplo,
@@ -4276,6 +6078,45 @@ hipblasStatus_t hipblasZsprBatchedCast(hipblasHandle_t                   handle,
                               batchCount);
 }
 
+// spr_batched_64
+hipblasStatus_t hipblasCsprBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const hipblasComplex*       alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       AP[],
+                                          int64_t                     batchCount)
+{
+    return hipblasCsprBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 (const hipComplex*)alpha,
+                                 (const hipComplex* const*)x,
+                                 incx,
+                                 (hipComplex* const*)AP,
+                                 batchCount);
+}
+
+hipblasStatus_t hipblasZsprBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const hipblasDoubleComplex*       alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       AP[],
+                                          int64_t                           batchCount)
+{
+    return hipblasZsprBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 (const hipDoubleComplex*)alpha,
+                                 (const hipDoubleComplex* const*)x,
+                                 incx,
+                                 (hipDoubleComplex* const*)AP,
+                                 batchCount);
+}
+
 // spr_strided_batched
 hipblasStatus_t hipblasCsprStridedBatchedCast(hipblasHandle_t       handle,
                                               hipblasFillMode_t     uplo,
@@ -4323,6 +6164,53 @@ hipblasStatus_t hipblasZsprStridedBatchedCast(hipblasHandle_t             handle
                                      batchCount);
 }
 
+// spr_strided_batched_64
+hipblasStatus_t hipblasCsprStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const hipblasComplex* alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       AP,
+                                                 hipblasStride         strideAP,
+                                                 int64_t               batchCount)
+{
+    return hipblasCsprStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        (const hipComplex*)alpha,
+                                        (const hipComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipComplex*)AP,
+                                        strideAP,
+                                        batchCount);
+}
+
+hipblasStatus_t hipblasZsprStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const hipblasDoubleComplex* alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       AP,
+                                                 hipblasStride               strideAP,
+                                                 int64_t                     batchCount)
+{
+    return hipblasZsprStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        (const hipDoubleComplex*)alpha,
+                                        (const hipDoubleComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipDoubleComplex*)AP,
+                                        strideAP,
+                                        batchCount);
+}
+
 // symv
 hipblasStatus_t hipblasCsymvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -4374,6 +6262,57 @@ hipblasStatus_t hipblasZsymvCast(hipblasHandle_t             handle,
                         incy);
 }
 
+// symv_64
+hipblasStatus_t hipblasCsymvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy)
+{
+    return hipblasCsymv_64(handle,
+                           uplo,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)beta,
+                           (hipComplex*)y,
+                           incy);
+}
+
+hipblasStatus_t hipblasZsymvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy)
+{
+    return hipblasZsymv_64(handle,
+                           uplo,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)y,
+                           incy);
+}
+
 // symv_batched
 hipblasStatus_t hipblasCsymvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -4429,6 +6368,61 @@ hipblasStatus_t hipblasZsymvBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// symv_batched_64
+hipblasStatus_t hipblasCsymvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batchCount)
+{
+    return hipblasCsymvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)y,
+                                  incy,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZsymvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batchCount)
+{
+    return hipblasZsymvBatched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)y,
+                                  incy,
+                                  batchCount);
+}
+
 // symv_strided_batched
 hipblasStatus_t hipblasCsymvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -4479,21 +6473,88 @@ hipblasStatus_t hipblasZsymvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridey,
                                                int                         batchCount)
 {
-    return hipblasZsymvStridedBatched(handle,
-                                      uplo,
-                                      n,
-                                      (const hipDoubleComplex*)alpha,
-                                      (const hipDoubleComplex*)A,
-                                      lda,
-                                      strideA,
-                                      (const hipDoubleComplex*)x,
-                                      incx,
-                                      stridex,
-                                      (const hipDoubleComplex*)beta,
-                                      (hipDoubleComplex*)y,
-                                      incy,
-                                      stridey,
-                                      batchCount);
+    return hipblasZsymvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      (const hipDoubleComplex*)alpha,
+                                      (const hipDoubleComplex*)A,
+                                      lda,
+                                      strideA,
+                                      (const hipDoubleComplex*)x,
+                                      incx,
+                                      stridex,
+                                      (const hipDoubleComplex*)beta,
+                                      (hipDoubleComplex*)y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+
+// symv_strided_batched_64
+hipblasStatus_t hipblasCsymvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batchCount)
+{
+    return hipblasCsymvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZsymvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZsymvStridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         batchCount);
 }
 
 // syr
@@ -4529,6 +6590,39 @@ hipblasStatus_t hipblasZsyrCast(hipblasHandle_t             handle,
                        lda);
 }
 
+// syr_64
+hipblasStatus_t hipblasCsyrCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const hipblasComplex* alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       A,
+                                   int64_t               lda)
+{
+    return hipblasCsyr_64(
+        handle, uplo, n, (const hipComplex*)alpha, (const hipComplex*)x, incx, (hipComplex*)A, lda);
+}
+
+hipblasStatus_t hipblasZsyrCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       A,
+                                   int64_t                     lda)
+{
+    return hipblasZsyr_64(handle,
+                          uplo,
+                          n,
+                          (const hipDoubleComplex*)alpha,
+                          (const hipDoubleComplex*)x,
+                          incx,
+                          (hipDoubleComplex*)A,
+                          lda);
+}
+
 // syr_batched
 hipblasStatus_t hipblasCsyrBatchedCast(hipblasHandle_t             handle,
                                        hipblasFillMode_t           uplo,
@@ -4572,6 +6666,49 @@ hipblasStatus_t hipblasZsyrBatchedCast(hipblasHandle_t                   handle,
                               batch_count);
 }
 
+// syr_batched_64
+hipblasStatus_t hipblasCsyrBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const hipblasComplex*       alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       A[],
+                                          int64_t                     lda,
+                                          int64_t                     batch_count)
+{
+    return hipblasCsyrBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 (const hipComplex*)alpha,
+                                 (const hipComplex* const*)x,
+                                 incx,
+                                 (hipComplex* const*)A,
+                                 lda,
+                                 batch_count);
+}
+
+hipblasStatus_t hipblasZsyrBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const hipblasDoubleComplex*       alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       A[],
+                                          int64_t                           lda,
+                                          int64_t                           batch_count)
+{
+    return hipblasZsyrBatched_64(handle,
+                                 uplo,
+                                 n,
+                                 (const hipDoubleComplex*)alpha,
+                                 (const hipDoubleComplex* const*)x,
+                                 incx,
+                                 (hipDoubleComplex* const*)A,
+                                 lda,
+                                 batch_count);
+}
+
 // syr_strided_batched
 hipblasStatus_t hipblasCsyrStridedBatchedCast(hipblasHandle_t       handle,
                                               hipblasFillMode_t     uplo,
@@ -4623,6 +6760,57 @@ hipblasStatus_t hipblasZsyrStridedBatchedCast(hipblasHandle_t             handle
                                      batch_count);
 }
 
+// syr_strided_batched_64
+hipblasStatus_t hipblasCsyrStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const hipblasComplex* alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       A,
+                                                 int64_t               lda,
+                                                 hipblasStride         strideA,
+                                                 int64_t               batch_count)
+{
+    return hipblasCsyrStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        (const hipComplex*)alpha,
+                                        (const hipComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipComplex*)A,
+                                        lda,
+                                        strideA,
+                                        batch_count);
+}
+
+hipblasStatus_t hipblasZsyrStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const hipblasDoubleComplex* alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       A,
+                                                 int64_t                     lda,
+                                                 hipblasStride               strideA,
+                                                 int64_t                     batch_count)
+{
+    return hipblasZsyrStridedBatched_64(handle,
+                                        uplo,
+                                        n,
+                                        (const hipDoubleComplex*)alpha,
+                                        (const hipDoubleComplex*)x,
+                                        incx,
+                                        stridex,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        strideA,
+                                        batch_count);
+}
+
 // syr2
 hipblasStatus_t hipblasCsyr2Cast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -4670,6 +6858,53 @@ hipblasStatus_t hipblasZsyr2Cast(hipblasHandle_t             handle,
                         lda);
 }
 
+// syr2_64
+hipblasStatus_t hipblasCsyr2Cast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda)
+{
+    return hipblasCsyr2_64(handle,
+                           uplo,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)x,
+                           incx,
+                           (const hipComplex*)y,
+                           incy,
+                           (hipComplex*)A,
+                           lda);
+}
+
+hipblasStatus_t hipblasZsyr2Cast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda)
+{
+    return hipblasZsyr2_64(handle,
+                           uplo,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (const hipDoubleComplex*)y,
+                           incy,
+                           (hipDoubleComplex*)A,
+                           lda);
+}
+
 // syr2_batched
 hipblasStatus_t hipblasCsyr2BatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -4721,6 +6956,57 @@ hipblasStatus_t hipblasZsyr2BatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// syr2_batched_64
+hipblasStatus_t hipblasCsyr2BatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batchCount)
+{
+    return hipblasCsyr2Batched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (const hipComplex* const*)y,
+                                  incy,
+                                  (hipComplex* const*)A,
+                                  lda,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZsyr2BatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batchCount)
+{
+    return hipblasZsyr2Batched_64(handle,
+                                  uplo,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (const hipDoubleComplex* const*)y,
+                                  incy,
+                                  (hipDoubleComplex* const*)A,
+                                  lda,
+                                  batchCount);
+}
+
 // syr2_strided_batched
 hipblasStatus_t hipblasCsyr2StridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -4784,6 +7070,69 @@ hipblasStatus_t hipblasZsyr2StridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// syr2_strided_batched_64
+hipblasStatus_t hipblasCsyr2StridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batchCount)
+{
+    return hipblasCsyr2StridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZsyr2StridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZsyr2StridedBatched_64(handle,
+                                         uplo,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         (const hipDoubleComplex*)y,
+                                         incy,
+                                         stridey,
+                                         (hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         batchCount);
+}
+
 // trsv
 hipblasStatus_t hipblasCtrsvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -4813,6 +7162,35 @@ hipblasStatus_t hipblasZtrsvCast(hipblasHandle_t             handle,
         handle, uplo, transA, diag, m, (const hipDoubleComplex*)A, lda, (hipDoubleComplex*)x, incx);
 }
 
+// trsv_64
+hipblasStatus_t hipblasCtrsvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx)
+{
+    return hipblasCtrsv_64(
+        handle, uplo, transA, diag, m, (const hipComplex*)A, lda, (hipComplex*)x, incx);
+}
+
+hipblasStatus_t hipblasZtrsvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx)
+{
+    return hipblasZtrsv_64(
+        handle, uplo, transA, diag, m, (const hipDoubleComplex*)A, lda, (hipDoubleComplex*)x, incx);
+}
+
 // trsv_batched
 hipblasStatus_t hipblasCtrsvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -4860,6 +7238,53 @@ hipblasStatus_t hipblasZtrsvBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// trsv_batched_64
+hipblasStatus_t hipblasCtrsvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batch_count)
+{
+    return hipblasCtrsvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (hipComplex* const*)x,
+                                  incx,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZtrsvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batch_count)
+{
+    return hipblasZtrsvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (hipDoubleComplex* const*)x,
+                                  incx,
+                                  batch_count);
+}
+
 // trsv_strided_batched
 hipblasStatus_t hipblasCtrsvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -4915,6 +7340,61 @@ hipblasStatus_t hipblasZtrsvStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// trsv_strided_batched_64
+hipblasStatus_t hipblasCtrsvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batch_count)
+{
+    return hipblasCtrsvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZtrsvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZtrsvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batch_count);
+}
+
 // tbmv
 hipblasStatus_t hipblasCtbmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -4954,6 +7434,45 @@ hipblasStatus_t hipblasZtbmvCast(hipblasHandle_t             handle,
                         incx);
 }
 
+// tbmv_64
+hipblasStatus_t hipblasCtbmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    int64_t               k,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx)
+{
+    return hipblasCtbmv_64(
+        handle, uplo, transA, diag, m, k, (const hipComplex*)A, lda, (hipComplex*)x, incx);
+}
+
+hipblasStatus_t hipblasZtbmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx)
+{
+    return hipblasZtbmv_64(handle,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           k,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (hipDoubleComplex*)x,
+                           incx);
+}
+
 // tbmv_batched
 hipblasStatus_t hipblasCtbmvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -5005,6 +7524,57 @@ hipblasStatus_t hipblasZtbmvBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// tbmv_batched_64
+hipblasStatus_t hipblasCtbmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           int64_t                     k,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batch_count)
+{
+    return hipblasCtbmvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  k,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (hipComplex* const*)x,
+                                  incx,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZtbmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batch_count)
+{
+    return hipblasZtbmvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  k,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (hipDoubleComplex* const*)x,
+                                  incx,
+                                  batch_count);
+}
+
 // tbmv_strided_batched
 hipblasStatus_t hipblasCtbmvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -5064,6 +7634,65 @@ hipblasStatus_t hipblasZtbmvStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// tbmv_strided_batched_64
+hipblasStatus_t hipblasCtbmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  int64_t               k,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  int64_t               batch_count)
+{
+    return hipblasCtbmvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         k,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (hipComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZtbmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZtbmvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         k,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (hipDoubleComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         batch_count);
+}
+
 // tbsv
 hipblasStatus_t hipblasCtbsvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -5103,6 +7732,45 @@ hipblasStatus_t hipblasZtbsvCast(hipblasHandle_t             handle,
                         incx);
 }
 
+// tbsv_64
+hipblasStatus_t hipblasCtbsvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx)
+{
+    return hipblasCtbsv_64(
+        handle, uplo, transA, diag, n, k, (const hipComplex*)A, lda, (hipComplex*)x, incx);
+}
+
+hipblasStatus_t hipblasZtbsvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx)
+{
+    return hipblasZtbsv_64(handle,
+                           uplo,
+                           transA,
+                           diag,
+                           n,
+                           k,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (hipDoubleComplex*)x,
+                           incx);
+}
+
 // tbsv_batched
 hipblasStatus_t hipblasCtbsvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -5154,6 +7822,57 @@ hipblasStatus_t hipblasZtbsvBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// tbsv_batched_64
+hipblasStatus_t hipblasCtbsvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batchCount)
+{
+    return hipblasCtbsvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  n,
+                                  k,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (hipComplex* const*)x,
+                                  incx,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZtbsvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batchCount)
+{
+    return hipblasZtbsvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  n,
+                                  k,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (hipDoubleComplex* const*)x,
+                                  incx,
+                                  batchCount);
+}
+
 // tbsv_strided_batched
 hipblasStatus_t hipblasCtbsvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -5213,6 +7932,65 @@ hipblasStatus_t hipblasZtbsvStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// tbsv_strided_batched_64
+hipblasStatus_t hipblasCtbsvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batchCount)
+{
+    return hipblasCtbsvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         n,
+                                         k,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZtbsvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZtbsvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         n,
+                                         k,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batchCount);
+}
+
 // tpmv
 hipblasStatus_t hipblasCtpmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -5239,6 +8017,33 @@ hipblasStatus_t hipblasZtpmvCast(hipblasHandle_t             handle,
         handle, uplo, transA, diag, m, (const hipDoubleComplex*)AP, (hipDoubleComplex*)x, incx);
 }
 
+// tpmv_64
+hipblasStatus_t hipblasCtpmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* AP,
+                                    hipblasComplex*       x,
+                                    int64_t               incx)
+{
+    return
+        hipblasCtpmv_64(handle, uplo, transA, diag, m, (const hipComplex*)AP, (hipComplex*)x, incx);
+}
+
+hipblasStatus_t hipblasZtpmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* AP,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx)
+{
+    return hipblasZtpmv_64(
+        handle, uplo, transA, diag, m, (const hipDoubleComplex*)AP, (hipDoubleComplex*)x, incx);
+}
+
 // tpmv_batched
 hipblasStatus_t hipblasCtpmvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -5282,6 +8087,49 @@ hipblasStatus_t hipblasZtpmvBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// tpmv_batched_64
+hipblasStatus_t hipblasCtpmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const AP[],
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batchCount)
+{
+    return hipblasCtpmvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipComplex* const*)AP,
+                                  (hipComplex* const*)x,
+                                  incx,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZtpmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const AP[],
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batchCount)
+{
+    return hipblasZtpmvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipDoubleComplex* const*)AP,
+                                  (hipDoubleComplex* const*)x,
+                                  incx,
+                                  batchCount);
+}
+
 // tpmv_strided_batched
 hipblasStatus_t hipblasCtpmvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -5333,6 +8181,57 @@ hipblasStatus_t hipblasZtpmvStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// tpmv_strided_batched_64
+hipblasStatus_t hipblasCtpmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* AP,
+                                                  hipblasStride         strideAP,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batchCount)
+{
+    return hipblasCtpmvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipComplex*)AP,
+                                         strideAP,
+                                         (hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZtpmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* AP,
+                                                  hipblasStride               strideAP,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZtpmvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipDoubleComplex*)AP,
+                                         strideAP,
+                                         (hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batchCount);
+}
+
 // tpsv
 hipblasStatus_t hipblasCtpsvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -5359,6 +8258,33 @@ hipblasStatus_t hipblasZtpsvCast(hipblasHandle_t             handle,
         handle, uplo, transA, diag, m, (const hipDoubleComplex*)AP, (hipDoubleComplex*)x, incx);
 }
 
+// tpsv_64
+hipblasStatus_t hipblasCtpsvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* AP,
+                                    hipblasComplex*       x,
+                                    int64_t               incx)
+{
+    return
+        hipblasCtpsv_64(handle, uplo, transA, diag, m, (const hipComplex*)AP, (hipComplex*)x, incx);
+}
+
+hipblasStatus_t hipblasZtpsvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* AP,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx)
+{
+    return hipblasZtpsv_64(
+        handle, uplo, transA, diag, m, (const hipDoubleComplex*)AP, (hipDoubleComplex*)x, incx);
+}
+
 // tpsv_batched
 hipblasStatus_t hipblasCtpsvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -5402,6 +8328,49 @@ hipblasStatus_t hipblasZtpsvBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// tpsv_batched_64
+hipblasStatus_t hipblasCtpsvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const AP[],
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batchCount)
+{
+    return hipblasCtpsvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipComplex* const*)AP,
+                                  (hipComplex* const*)x,
+                                  incx,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZtpsvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const AP[],
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batchCount)
+{
+    return hipblasZtpsvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipDoubleComplex* const*)AP,
+                                  (hipDoubleComplex* const*)x,
+                                  incx,
+                                  batchCount);
+}
+
 // tpsv_strided_batched
 hipblasStatus_t hipblasCtpsvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -5453,6 +8422,57 @@ hipblasStatus_t hipblasZtpsvStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// tpsv_strided_batched_64
+hipblasStatus_t hipblasCtpsvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* AP,
+                                                  hipblasStride         strideAP,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batchCount)
+{
+    return hipblasCtpsvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipComplex*)AP,
+                                         strideAP,
+                                         (hipComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZtpsvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* AP,
+                                                  hipblasStride               strideAP,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZtpsvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipDoubleComplex*)AP,
+                                         strideAP,
+                                         (hipDoubleComplex*)x,
+                                         incx,
+                                         stridex,
+                                         batchCount);
+}
+
 // trmv
 hipblasStatus_t hipblasCtrmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -5482,6 +8502,35 @@ hipblasStatus_t hipblasZtrmvCast(hipblasHandle_t             handle,
         handle, uplo, transA, diag, m, (const hipDoubleComplex*)A, lda, (hipDoubleComplex*)x, incx);
 }
 
+// trmv_64
+hipblasStatus_t hipblasCtrmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx)
+{
+    return hipblasCtrmv_64(
+        handle, uplo, transA, diag, m, (const hipComplex*)A, lda, (hipComplex*)x, incx);
+}
+
+hipblasStatus_t hipblasZtrmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx)
+{
+    return hipblasZtrmv_64(
+        handle, uplo, transA, diag, m, (const hipDoubleComplex*)A, lda, (hipDoubleComplex*)x, incx);
+}
+
 // trmv_batched
 hipblasStatus_t hipblasCtrmvBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -5529,6 +8578,53 @@ hipblasStatus_t hipblasZtrmvBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// trmv_batched_64
+hipblasStatus_t hipblasCtrmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batch_count)
+{
+    return hipblasCtrmvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (hipComplex* const*)x,
+                                  incx,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZtrmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batch_count)
+{
+    return hipblasZtrmvBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (hipDoubleComplex* const*)x,
+                                  incx,
+                                  batch_count);
+}
+
 // trmv_strided_batched
 hipblasStatus_t hipblasCtrmvStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -5584,6 +8680,61 @@ hipblasStatus_t hipblasZtrmvStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// trmv_strided_batched_64
+hipblasStatus_t hipblasCtrmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  int64_t               batch_count)
+{
+    return hipblasCtrmvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (hipComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZtrmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZtrmvStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         stride_a,
+                                         (hipDoubleComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         batch_count);
+}
+
 /*
  * ===========================================================================
  *    level 3 BLAS
@@ -5758,6 +8909,53 @@ hipblasStatus_t hipblasZdgmmCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// dgmm_64
+hipblasStatus_t hipblasCdgmmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasCdgmm_64(handle,
+                           side,
+                           m,
+                           n,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)x,
+                           incx,
+                           (hipComplex*)C,
+                           ldc);
+}
+
+hipblasStatus_t hipblasZdgmmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZdgmm_64(handle,
+                           side,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)x,
+                           incx,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // dgmm_batched
 hipblasStatus_t hipblasCdgmmBatchedCast(hipblasHandle_t             handle,
                                         hipblasSideMode_t           side,
@@ -5809,6 +9007,57 @@ hipblasStatus_t hipblasZdgmmBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// dgmm_batched_64
+hipblasStatus_t hipblasCdgmmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batch_count)
+{
+    return hipblasCdgmmBatched_64(handle,
+                                  side,
+                                  m,
+                                  n,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)x,
+                                  incx,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZdgmmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batch_count)
+{
+    return hipblasZdgmmBatched_64(handle,
+                                  side,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)x,
+                                  incx,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batch_count);
+}
+
 // dgmm_strided_batched
 hipblasStatus_t hipblasCdgmmStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasSideMode_t     side,
@@ -5872,6 +9121,69 @@ hipblasStatus_t hipblasZdgmmStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// dgmm_strided_batched_64
+hipblasStatus_t hipblasCdgmmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_A,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         stride_C,
+                                                  int64_t               batch_count)
+{
+    return hipblasCdgmmStridedBatched_64(handle,
+                                         side,
+                                         m,
+                                         n,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         stride_A,
+                                         (const hipComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         stride_C,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZdgmmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_A,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               stride_C,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZdgmmStridedBatched_64(handle,
+                                         side,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         stride_A,
+                                         (const hipDoubleComplex*)x,
+                                         incx,
+                                         stride_x,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         stride_C,
+                                         batch_count);
+}
+
 // gemm
 hipblasStatus_t hipblasCgemmCast(hipblasHandle_t       handle,
                                  hipblasOperation_t    transA,
@@ -5935,6 +9247,69 @@ hipblasStatus_t hipblasZgemmCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// gemm_64
+hipblasStatus_t hipblasCgemmCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    hipblasOperation_t    transB,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasCgemm_64(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)B,
+                           ldb,
+                           (const hipComplex*)beta,
+                           (hipComplex*)C,
+                           ldc);
+}
+
+hipblasStatus_t hipblasZgemmCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZgemm_64(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)B,
+                           ldb,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // gemm_batched
 hipblasStatus_t hipblasCgemmBatchedCast(hipblasHandle_t             handle,
                                         hipblasOperation_t          transA,
@@ -6002,6 +9377,73 @@ hipblasStatus_t hipblasZgemmBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// gemm_batched_64
+hipblasStatus_t hipblasCgemmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           hipblasOperation_t          transB,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batch_count)
+{
+    return hipblasCgemmBatched_64(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)B,
+                                  ldb,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZgemmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           hipblasOperation_t                transB,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batch_count)
+{
+    return hipblasZgemmBatched_64(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)B,
+                                  ldb,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batch_count);
+}
+
 // gemm_strided_batched
 hipblasStatus_t hipblasCgemmStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasOperation_t    transA,
@@ -6081,6 +9523,85 @@ hipblasStatus_t hipblasZgemmStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// gemm_strided_batched_64
+hipblasStatus_t hipblasCgemmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasOperation_t    transB,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  int64_t               bsa,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  int64_t               bsb,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  int64_t               bsc,
+                                                  int64_t               batch_count)
+{
+    return hipblasCgemmStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         bsa,
+                                         (const hipComplex*)B,
+                                         ldb,
+                                         bsb,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         bsc,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZgemmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasOperation_t          transB,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  int64_t                     bsa,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  int64_t                     bsb,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  int64_t                     bsc,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZgemmStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         bsa,
+                                         (const hipDoubleComplex*)B,
+                                         ldb,
+                                         bsb,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         bsc,
+                                         batch_count);
+}
+
 // herk
 hipblasStatus_t hipblasCherkCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -6123,6 +9644,48 @@ hipblasStatus_t hipblasZherkCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// herk_64
+hipblasStatus_t hipblasCherkCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const float*          alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const float*          beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasCherk_64(
+        handle, uplo, transA, n, k, alpha, (const hipComplex*)A, lda, beta, (hipComplex*)C, ldc);
+}
+
+hipblasStatus_t hipblasZherkCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const double*               alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const double*               beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZherk_64(handle,
+                           uplo,
+                           transA,
+                           n,
+                           k,
+                           alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           beta,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // herk_batched
 hipblasStatus_t hipblasCherkBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -6178,6 +9741,61 @@ hipblasStatus_t hipblasZherkBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// herk_batched_64
+hipblasStatus_t hipblasCherkBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const float*                alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const float*                beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount)
+{
+    return hipblasCherkBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  n,
+                                  k,
+                                  alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  beta,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZherkBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const double*                     alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const double*                     beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount)
+{
+    return hipblasZherkBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  n,
+                                  k,
+                                  alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  beta,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
 // herk_strided_batched
 hipblasStatus_t hipblasCherkStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -6241,6 +9859,69 @@ hipblasStatus_t hipblasZherkStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// herk_strided_batched_64
+hipblasStatus_t hipblasCherkStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const float*          alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const float*          beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount)
+{
+    return hipblasCherkStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZherkStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const double*               alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const double*               beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZherkStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
 // her2k
 hipblasStatus_t hipblasCher2kCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -6300,6 +9981,65 @@ hipblasStatus_t hipblasZher2kCast(hipblasHandle_t             handle,
                          ldc);
 }
 
+// her2k_64
+hipblasStatus_t hipblasCher2kCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const float*          beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc)
+{
+    return hipblasCher2k_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipComplex*)alpha,
+                            (const hipComplex*)A,
+                            lda,
+                            (const hipComplex*)B,
+                            ldb,
+                            beta,
+                            (hipComplex*)C,
+                            ldc);
+}
+
+hipblasStatus_t hipblasZher2kCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const double*               beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc)
+{
+    return hipblasZher2k_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipDoubleComplex*)alpha,
+                            (const hipDoubleComplex*)A,
+                            lda,
+                            (const hipDoubleComplex*)B,
+                            ldb,
+                            beta,
+                            (hipDoubleComplex*)C,
+                            ldc);
+}
+
 // her2k_batched
 hipblasStatus_t hipblasCher2kBatchedCast(hipblasHandle_t             handle,
                                          hipblasFillMode_t           uplo,
@@ -6363,6 +10103,69 @@ hipblasStatus_t hipblasZher2kBatchedCast(hipblasHandle_t                   handl
                                 batchCount);
 }
 
+// her2k_batched_64
+hipblasStatus_t hipblasCher2kBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const float*                beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount)
+{
+    return hipblasCher2kBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipComplex*)alpha,
+                                   (const hipComplex* const*)A,
+                                   lda,
+                                   (const hipComplex* const*)B,
+                                   ldb,
+                                   beta,
+                                   (hipComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
+hipblasStatus_t hipblasZher2kBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const double*                     beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount)
+{
+    return hipblasZher2kBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipDoubleComplex*)alpha,
+                                   (const hipDoubleComplex* const*)A,
+                                   lda,
+                                   (const hipDoubleComplex* const*)B,
+                                   ldb,
+                                   beta,
+                                   (hipDoubleComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
 // her2k_strided_batched
 hipblasStatus_t hipblasCher2kStridedBatchedCast(hipblasHandle_t       handle,
                                                 hipblasFillMode_t     uplo,
@@ -6438,6 +10241,81 @@ hipblasStatus_t hipblasZher2kStridedBatchedCast(hipblasHandle_t             hand
                                        batchCount);
 }
 
+// her2k_strided_batched_64
+hipblasStatus_t hipblasCher2kStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const float*          beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount)
+{
+    return hipblasCher2kStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipComplex*)alpha,
+                                          (const hipComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          (hipComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
+hipblasStatus_t hipblasZher2kStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const double*               beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount)
+{
+    return hipblasZher2kStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipDoubleComplex*)alpha,
+                                          (const hipDoubleComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipDoubleComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          (hipDoubleComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
 // herkx
 hipblasStatus_t hipblasCherkxCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -6497,6 +10375,65 @@ hipblasStatus_t hipblasZherkxCast(hipblasHandle_t             handle,
                          ldc);
 }
 
+// herkx_64
+hipblasStatus_t hipblasCherkxCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const float*          beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc)
+{
+    return hipblasCherkx_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipComplex*)alpha,
+                            (const hipComplex*)A,
+                            lda,
+                            (const hipComplex*)B,
+                            ldb,
+                            beta,
+                            (hipComplex*)C,
+                            ldc);
+}
+
+hipblasStatus_t hipblasZherkxCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const double*               beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc)
+{
+    return hipblasZherkx_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipDoubleComplex*)alpha,
+                            (const hipDoubleComplex*)A,
+                            lda,
+                            (const hipDoubleComplex*)B,
+                            ldb,
+                            beta,
+                            (hipDoubleComplex*)C,
+                            ldc);
+}
+
 // herkx_batched
 hipblasStatus_t hipblasCherkxBatchedCast(hipblasHandle_t             handle,
                                          hipblasFillMode_t           uplo,
@@ -6560,6 +10497,69 @@ hipblasStatus_t hipblasZherkxBatchedCast(hipblasHandle_t                   handl
                                 batchCount);
 }
 
+// herkx_batched_64
+hipblasStatus_t hipblasCherkxBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const float*                beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount)
+{
+    return hipblasCherkxBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipComplex*)alpha,
+                                   (const hipComplex* const*)A,
+                                   lda,
+                                   (const hipComplex* const*)B,
+                                   ldb,
+                                   beta,
+                                   (hipComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
+hipblasStatus_t hipblasZherkxBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const double*                     beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount)
+{
+    return hipblasZherkxBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipDoubleComplex*)alpha,
+                                   (const hipDoubleComplex* const*)A,
+                                   lda,
+                                   (const hipDoubleComplex* const*)B,
+                                   ldb,
+                                   beta,
+                                   (hipDoubleComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
 // herkx_strided_batched
 hipblasStatus_t hipblasCherkxStridedBatchedCast(hipblasHandle_t       handle,
                                                 hipblasFillMode_t     uplo,
@@ -6635,6 +10635,81 @@ hipblasStatus_t hipblasZherkxStridedBatchedCast(hipblasHandle_t             hand
                                        batchCount);
 }
 
+// herkx_strided_batched_64
+hipblasStatus_t hipblasCherkxStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const float*          beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount)
+{
+    return hipblasCherkxStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipComplex*)alpha,
+                                          (const hipComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          (hipComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
+hipblasStatus_t hipblasZherkxStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const double*               beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount)
+{
+    return hipblasZherkxStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipDoubleComplex*)alpha,
+                                          (const hipDoubleComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipDoubleComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          (hipDoubleComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
 // symm
 hipblasStatus_t hipblasCsymmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -6694,6 +10769,65 @@ hipblasStatus_t hipblasZsymmCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// symm_64
+hipblasStatus_t hipblasCsymmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasCsymm_64(handle,
+                           side,
+                           uplo,
+                           m,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)B,
+                           ldb,
+                           (const hipComplex*)beta,
+                           (hipComplex*)C,
+                           ldc);
+}
+
+hipblasStatus_t hipblasZsymmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZsymm_64(handle,
+                           side,
+                           uplo,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)B,
+                           ldb,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // symm_batched
 hipblasStatus_t hipblasCsymmBatchedCast(hipblasHandle_t             handle,
                                         hipblasSideMode_t           side,
@@ -6757,6 +10891,69 @@ hipblasStatus_t hipblasZsymmBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// symm_batched_64
+hipblasStatus_t hipblasCsymmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount)
+{
+    return hipblasCsymmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  m,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)B,
+                                  ldb,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZsymmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount)
+{
+    return hipblasZsymmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)B,
+                                  ldb,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
 // symm_strided_batched
 hipblasStatus_t hipblasCsymmStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasSideMode_t     side,
@@ -6832,6 +11029,81 @@ hipblasStatus_t hipblasZsymmStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// symm_strided_batched_64
+hipblasStatus_t hipblasCsymmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount)
+{
+    return hipblasCsymmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         m,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZsymmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZsymmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
 // syrk
 hipblasStatus_t hipblasCsyrkCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -6883,6 +11155,57 @@ hipblasStatus_t hipblasZsyrkCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// syrk_64
+hipblasStatus_t hipblasCsyrkCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasCsyrk_64(handle,
+                           uplo,
+                           transA,
+                           n,
+                           k,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)beta,
+                           (hipComplex*)C,
+                           ldc);
+}
+
+hipblasStatus_t hipblasZsyrkCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZsyrk_64(handle,
+                           uplo,
+                           transA,
+                           n,
+                           k,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // syrk_batched
 hipblasStatus_t hipblasCsyrkBatchedCast(hipblasHandle_t             handle,
                                         hipblasFillMode_t           uplo,
@@ -6938,6 +11261,61 @@ hipblasStatus_t hipblasZsyrkBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// syrk_batched_64
+hipblasStatus_t hipblasCsyrkBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount)
+{
+    return hipblasCsyrkBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  n,
+                                  k,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZsyrkBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount)
+{
+    return hipblasZsyrkBatched_64(handle,
+                                  uplo,
+                                  transA,
+                                  n,
+                                  k,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
 // syrk_strided_batched
 hipblasStatus_t hipblasCsyrkStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasFillMode_t     uplo,
@@ -7001,6 +11379,69 @@ hipblasStatus_t hipblasZsyrkStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// syrk_strided_batched_64
+hipblasStatus_t hipblasCsyrkStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount)
+{
+    return hipblasCsyrkStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZsyrkStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZsyrkStridedBatched_64(handle,
+                                         uplo,
+                                         transA,
+                                         n,
+                                         k,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
 // syr2k
 hipblasStatus_t hipblasCsyr2kCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -7060,6 +11501,65 @@ hipblasStatus_t hipblasZsyr2kCast(hipblasHandle_t             handle,
                          ldc);
 }
 
+// syr2k_64
+hipblasStatus_t hipblasCsyr2kCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc)
+{
+    return hipblasCsyr2k_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipComplex*)alpha,
+                            (const hipComplex*)A,
+                            lda,
+                            (const hipComplex*)B,
+                            ldb,
+                            (const hipComplex*)beta,
+                            (hipComplex*)C,
+                            ldc);
+}
+
+hipblasStatus_t hipblasZsyr2kCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc)
+{
+    return hipblasZsyr2k_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipDoubleComplex*)alpha,
+                            (const hipDoubleComplex*)A,
+                            lda,
+                            (const hipDoubleComplex*)B,
+                            ldb,
+                            (const hipDoubleComplex*)beta,
+                            (hipDoubleComplex*)C,
+                            ldc);
+}
+
 // syr2k_batched
 hipblasStatus_t hipblasCsyr2kBatchedCast(hipblasHandle_t             handle,
                                          hipblasFillMode_t           uplo,
@@ -7123,6 +11623,69 @@ hipblasStatus_t hipblasZsyr2kBatchedCast(hipblasHandle_t                   handl
                                 batchCount);
 }
 
+// syr2k_batched_64
+hipblasStatus_t hipblasCsyr2kBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount)
+{
+    return hipblasCsyr2kBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipComplex*)alpha,
+                                   (const hipComplex* const*)A,
+                                   lda,
+                                   (const hipComplex* const*)B,
+                                   ldb,
+                                   (const hipComplex*)beta,
+                                   (hipComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
+hipblasStatus_t hipblasZsyr2kBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount)
+{
+    return hipblasZsyr2kBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipDoubleComplex*)alpha,
+                                   (const hipDoubleComplex* const*)A,
+                                   lda,
+                                   (const hipDoubleComplex* const*)B,
+                                   ldb,
+                                   (const hipDoubleComplex*)beta,
+                                   (hipDoubleComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
 // syr2k_strided_batched
 hipblasStatus_t hipblasCsyr2kStridedBatchedCast(hipblasHandle_t       handle,
                                                 hipblasFillMode_t     uplo,
@@ -7198,6 +11761,81 @@ hipblasStatus_t hipblasZsyr2kStridedBatchedCast(hipblasHandle_t             hand
                                        batchCount);
 }
 
+// syr2k_strided_batched_64
+hipblasStatus_t hipblasCsyr2kStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const hipblasComplex* beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount)
+{
+    return hipblasCsyr2kStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipComplex*)alpha,
+                                          (const hipComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          (const hipComplex*)beta,
+                                          (hipComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
+hipblasStatus_t hipblasZsyr2kStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount)
+{
+    return hipblasZsyr2kStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipDoubleComplex*)alpha,
+                                          (const hipDoubleComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipDoubleComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          (const hipDoubleComplex*)beta,
+                                          (hipDoubleComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
 // syrkx
 hipblasStatus_t hipblasCsyrkxCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -7257,6 +11895,65 @@ hipblasStatus_t hipblasZsyrkxCast(hipblasHandle_t             handle,
                          ldc);
 }
 
+// syrkx_64
+hipblasStatus_t hipblasCsyrkxCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc)
+{
+    return hipblasCsyrkx_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipComplex*)alpha,
+                            (const hipComplex*)A,
+                            lda,
+                            (const hipComplex*)B,
+                            ldb,
+                            (const hipComplex*)beta,
+                            (hipComplex*)C,
+                            ldc);
+}
+
+hipblasStatus_t hipblasZsyrkxCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc)
+{
+    return hipblasZsyrkx_64(handle,
+                            uplo,
+                            transA,
+                            n,
+                            k,
+                            (const hipDoubleComplex*)alpha,
+                            (const hipDoubleComplex*)A,
+                            lda,
+                            (const hipDoubleComplex*)B,
+                            ldb,
+                            (const hipDoubleComplex*)beta,
+                            (hipDoubleComplex*)C,
+                            ldc);
+}
+
 // syrkx_batched
 hipblasStatus_t hipblasCsyrkxBatchedCast(hipblasHandle_t             handle,
                                          hipblasFillMode_t           uplo,
@@ -7320,6 +12017,69 @@ hipblasStatus_t hipblasZsyrkxBatchedCast(hipblasHandle_t                   handl
                                 batchCount);
 }
 
+// syrkx_batched_64
+hipblasStatus_t hipblasCsyrkxBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount)
+{
+    return hipblasCsyrkxBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipComplex*)alpha,
+                                   (const hipComplex* const*)A,
+                                   lda,
+                                   (const hipComplex* const*)B,
+                                   ldb,
+                                   (const hipComplex*)beta,
+                                   (hipComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
+hipblasStatus_t hipblasZsyrkxBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount)
+{
+    return hipblasZsyrkxBatched_64(handle,
+                                   uplo,
+                                   transA,
+                                   n,
+                                   k,
+                                   (const hipDoubleComplex*)alpha,
+                                   (const hipDoubleComplex* const*)A,
+                                   lda,
+                                   (const hipDoubleComplex* const*)B,
+                                   ldb,
+                                   (const hipDoubleComplex*)beta,
+                                   (hipDoubleComplex* const*)C,
+                                   ldc,
+                                   batchCount);
+}
+
 // syrkx_strided_batched
 hipblasStatus_t hipblasCsyrkxStridedBatchedCast(hipblasHandle_t       handle,
                                                 hipblasFillMode_t     uplo,
@@ -7395,6 +12155,81 @@ hipblasStatus_t hipblasZsyrkxStridedBatchedCast(hipblasHandle_t             hand
                                        batchCount);
 }
 
+// syrkx_strided_batched_64
+hipblasStatus_t hipblasCsyrkxStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const hipblasComplex* beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount)
+{
+    return hipblasCsyrkxStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipComplex*)alpha,
+                                          (const hipComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          (const hipComplex*)beta,
+                                          (hipComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
+hipblasStatus_t hipblasZsyrkxStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount)
+{
+    return hipblasZsyrkxStridedBatched_64(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          (const hipDoubleComplex*)alpha,
+                                          (const hipDoubleComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (const hipDoubleComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          (const hipDoubleComplex*)beta,
+                                          (hipDoubleComplex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+
 // hemm
 hipblasStatus_t hipblasChemmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -7454,6 +12289,65 @@ hipblasStatus_t hipblasZhemmCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// hemm_64
+hipblasStatus_t hipblasChemmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasChemm_64(handle,
+                           side,
+                           uplo,
+                           n,
+                           k,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)B,
+                           ldb,
+                           (const hipComplex*)beta,
+                           (hipComplex*)C,
+                           ldc);
+}
+
+hipblasStatus_t hipblasZhemmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZhemm_64(handle,
+                           side,
+                           uplo,
+                           n,
+                           k,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)B,
+                           ldb,
+                           (const hipDoubleComplex*)beta,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // hemm_batched
 hipblasStatus_t hipblasChemmBatchedCast(hipblasHandle_t             handle,
                                         hipblasSideMode_t           side,
@@ -7517,6 +12411,69 @@ hipblasStatus_t hipblasZhemmBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// hemm_batched_64
+hipblasStatus_t hipblasChemmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount)
+{
+    return hipblasChemmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  n,
+                                  k,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)B,
+                                  ldb,
+                                  (const hipComplex*)beta,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZhemmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount)
+{
+    return hipblasZhemmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  n,
+                                  k,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)B,
+                                  ldb,
+                                  (const hipDoubleComplex*)beta,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
 // hemm_strided_batched
 hipblasStatus_t hipblasChemmStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasSideMode_t     side,
@@ -7592,6 +12549,81 @@ hipblasStatus_t hipblasZhemmStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// hemm_strided_batched_64
+hipblasStatus_t hipblasChemmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount)
+{
+    return hipblasChemmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         n,
+                                         k,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (const hipComplex*)beta,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZhemmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZhemmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         n,
+                                         k,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (const hipDoubleComplex*)beta,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
 // trmm
 hipblasStatus_t hipblasCtrmmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -7655,6 +12687,69 @@ hipblasStatus_t hipblasZtrmmCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// trmm_64
+hipblasStatus_t hipblasCtrmmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasCtrmm_64(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)B,
+                           ldb,
+                           (hipComplex*)C,
+                           ldc);
+}
+
+hipblasStatus_t hipblasZtrmmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZtrmm_64(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)B,
+                           ldb,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // trmm_batched
 hipblasStatus_t hipblasCtrmmBatchedCast(hipblasHandle_t             handle,
                                         hipblasSideMode_t           side,
@@ -7722,6 +12817,73 @@ hipblasStatus_t hipblasZtrmmBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// trmm_batched_64
+hipblasStatus_t hipblasCtrmmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount)
+{
+    return hipblasCtrmmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex* const*)B,
+                                  ldb,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZtrmmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount)
+{
+    return hipblasZtrmmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex* const*)B,
+                                  ldb,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
 // trmm_strided_batched
 hipblasStatus_t hipblasCtrmmStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasSideMode_t     side,
@@ -7801,6 +12963,85 @@ hipblasStatus_t hipblasZtrmmStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// trmm_strided_batched_64
+hipblasStatus_t hipblasCtrmmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount)
+{
+    return hipblasCtrmmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZtrmmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZtrmmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
 // trsm
 hipblasStatus_t hipblasCtrsmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -7856,6 +13097,61 @@ hipblasStatus_t hipblasZtrsmCast(hipblasHandle_t             handle,
                         ldb);
 }
 
+// trsm_64
+hipblasStatus_t hipblasCtrsmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       B,
+                                    int64_t               ldb)
+{
+    return hipblasCtrsm_64(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (hipComplex*)B,
+                           ldb);
+}
+
+hipblasStatus_t hipblasZtrsmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       B,
+                                    int64_t                     ldb)
+{
+    return hipblasZtrsm_64(handle,
+                           side,
+                           uplo,
+                           transA,
+                           diag,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (hipDoubleComplex*)B,
+                           ldb);
+}
+
 // trsm_batched
 hipblasStatus_t hipblasCtrsmBatchedCast(hipblasHandle_t             handle,
                                         hipblasSideMode_t           side,
@@ -7915,6 +13211,65 @@ hipblasStatus_t hipblasZtrsmBatchedCast(hipblasHandle_t                   handle
                                batch_count);
 }
 
+// trsm_batched_64
+hipblasStatus_t hipblasCtrsmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       B[],
+                                           int64_t                     ldb,
+                                           int64_t                     batch_count)
+{
+    return hipblasCtrsmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (hipComplex* const*)B,
+                                  ldb,
+                                  batch_count);
+}
+
+hipblasStatus_t hipblasZtrsmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       B[],
+                                           int64_t                           ldb,
+                                           int64_t                           batch_count)
+{
+    return hipblasZtrsmBatched_64(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (hipDoubleComplex* const*)B,
+                                  ldb,
+                                  batch_count);
+}
+
 // trsm_strided_batched
 hipblasStatus_t hipblasCtrsmStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasSideMode_t     side,
@@ -7982,6 +13337,73 @@ hipblasStatus_t hipblasZtrsmStridedBatchedCast(hipblasHandle_t             handl
                                       batch_count);
 }
 
+// trsm_strided_batched_64
+hipblasStatus_t hipblasCtrsmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  hipblasComplex*       B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  int64_t               batch_count)
+{
+    return hipblasCtrsmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  hipblasDoubleComplex*       B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  int64_t                     batch_count)
+{
+    return hipblasZtrsmStridedBatched_64(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipDoubleComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
 // geam
 hipblasStatus_t hipblasCgeamCast(hipblasHandle_t       handle,
                                  hipblasOperation_t    transA,
@@ -8041,6 +13463,65 @@ hipblasStatus_t hipblasZgeamCast(hipblasHandle_t             handle,
                         ldc);
 }
 
+// geam_64
+hipblasStatus_t hipblasCgeamCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    hipblasOperation_t    transB,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* beta,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc)
+{
+    return hipblasCgeam_64(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           (const hipComplex*)alpha,
+                           (const hipComplex*)A,
+                           lda,
+                           (const hipComplex*)beta,
+                           (const hipComplex*)B,
+                           ldb,
+                           (hipComplex*)C,
+                           ldc);
+}
+
+hipblasStatus_t hipblasZgeamCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* beta,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc)
+{
+    return hipblasZgeam_64(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           (const hipDoubleComplex*)alpha,
+                           (const hipDoubleComplex*)A,
+                           lda,
+                           (const hipDoubleComplex*)beta,
+                           (const hipDoubleComplex*)B,
+                           ldb,
+                           (hipDoubleComplex*)C,
+                           ldc);
+}
+
 // geam_batched
 hipblasStatus_t hipblasCgeamBatchedCast(hipblasHandle_t             handle,
                                         hipblasOperation_t          transA,
@@ -8104,6 +13585,69 @@ hipblasStatus_t hipblasZgeamBatchedCast(hipblasHandle_t                   handle
                                batchCount);
 }
 
+// geam_batched_64
+hipblasStatus_t hipblasCgeamBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           hipblasOperation_t          transB,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex*       beta,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount)
+{
+    return hipblasCgeamBatched_64(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  (const hipComplex*)alpha,
+                                  (const hipComplex* const*)A,
+                                  lda,
+                                  (const hipComplex*)beta,
+                                  (const hipComplex* const*)B,
+                                  ldb,
+                                  (hipComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZgeamBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           hipblasOperation_t                transB,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex*       beta,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount)
+{
+    return hipblasZgeamBatched_64(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  (const hipDoubleComplex*)alpha,
+                                  (const hipDoubleComplex* const*)A,
+                                  lda,
+                                  (const hipDoubleComplex*)beta,
+                                  (const hipDoubleComplex* const*)B,
+                                  ldb,
+                                  (hipDoubleComplex* const*)C,
+                                  ldc,
+                                  batchCount);
+}
+
 // geam_strided_batched
 hipblasStatus_t hipblasCgeamStridedBatchedCast(hipblasHandle_t       handle,
                                                hipblasOperation_t    transA,
@@ -8179,6 +13723,81 @@ hipblasStatus_t hipblasZgeamStridedBatchedCast(hipblasHandle_t             handl
                                       batchCount);
 }
 
+// geam_strided_batched_64
+hipblasStatus_t hipblasCgeamStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasOperation_t    transB,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* beta,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount)
+{
+    return hipblasCgeamStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         (const hipComplex*)alpha,
+                                         (const hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipComplex*)beta,
+                                         (const hipComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (hipComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZgeamStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasOperation_t          transB,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* beta,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount)
+{
+    return hipblasZgeamStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         (const hipDoubleComplex*)alpha,
+                                         (const hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const hipDoubleComplex*)beta,
+                                         (const hipDoubleComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (hipDoubleComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
 #ifdef __HIP_PLATFORM_SOLVER__
 
 // getrf
@@ -8198,6 +13817,27 @@ hipblasStatus_t hipblasZgetrfCast(hipblasHandle_t       handle,
     return hipblasZgetrf(handle, n, (hipDoubleComplex*)A, lda, ipiv, info);
 }
 
+// getrf_64
+hipblasStatus_t hipblasCgetrfCast_64(hipblasHandle_t handle,
+                                     const int64_t   n,
+                                     hipblasComplex* A,
+                                     const int64_t   lda,
+                                     int64_t*        ipiv,
+                                     int64_t*        info)
+{
+    return hipblasCgetrf_64(handle, n, (hipComplex*)A, lda, ipiv, info);
+}
+
+hipblasStatus_t hipblasZgetrfCast_64(hipblasHandle_t       handle,
+                                     const int64_t         n,
+                                     hipblasDoubleComplex* A,
+                                     const int64_t         lda,
+                                     int64_t*              ipiv,
+                                     int64_t*              info)
+{
+    return hipblasZgetrf_64(handle, n, (hipDoubleComplex*)A, lda, ipiv, info);
+}
+
 // getrf_batched
 hipblasStatus_t hipblasCgetrfBatchedCast(hipblasHandle_t       handle,
                                          const int             n,
@@ -8222,6 +13862,30 @@ hipblasStatus_t hipblasZgetrfBatchedCast(hipblasHandle_t             handle,
         handle, n, (hipDoubleComplex* const*)A, lda, ipiv, info, batchCount);
 }
 
+// getrf_batched_64
+hipblasStatus_t hipblasCgetrfBatchedCast_64(hipblasHandle_t       handle,
+                                            const int64_t         n,
+                                            hipblasComplex* const A[],
+                                            const int64_t         lda,
+                                            int64_t*              ipiv,
+                                            int64_t*              info,
+                                            const int64_t         batchCount)
+{
+    return hipblasCgetrfBatched_64(handle, n, (hipComplex* const*)A, lda, ipiv, info, batchCount);
+}
+
+hipblasStatus_t hipblasZgetrfBatchedCast_64(hipblasHandle_t             handle,
+                                            const int64_t               n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int64_t               lda,
+                                            int64_t*                    ipiv,
+                                            int64_t*                    info,
+                                            const int64_t               batchCount)
+{
+    return hipblasZgetrfBatched_64(
+        handle, n, (hipDoubleComplex* const*)A, lda, ipiv, info, batchCount);
+}
+
 // getrf_strided_batched
 hipblasStatus_t hipblasCgetrfStridedBatchedCast(hipblasHandle_t     handle,
                                                 const int           n,
@@ -8251,6 +13915,35 @@ hipblasStatus_t hipblasZgetrfStridedBatchedCast(hipblasHandle_t       handle,
         handle, n, (hipDoubleComplex*)A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
+// getrf_strided_batched_64
+hipblasStatus_t hipblasCgetrfStridedBatchedCast_64(hipblasHandle_t     handle,
+                                                   const int64_t       n,
+                                                   hipblasComplex*     A,
+                                                   const int64_t       lda,
+                                                   const hipblasStride strideA,
+                                                   int64_t*            ipiv,
+                                                   const hipblasStride strideP,
+                                                   int64_t*            info,
+                                                   const int64_t       batchCount)
+{
+    return hipblasCgetrfStridedBatched_64(
+        handle, n, (hipComplex*)A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+hipblasStatus_t hipblasZgetrfStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   const int64_t         n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int64_t         lda,
+                                                   const hipblasStride   strideA,
+                                                   int64_t*              ipiv,
+                                                   const hipblasStride   strideP,
+                                                   int64_t*              info,
+                                                   const int64_t         batchCount)
+{
+    return hipblasZgetrfStridedBatched_64(
+        handle, n, (hipDoubleComplex*)A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
 // getrs
 hipblasStatus_t hipblasCgetrsCast(hipblasHandle_t          handle,
                                   const hipblasOperation_t trans,
@@ -8282,6 +13975,37 @@ hipblasStatus_t hipblasZgetrsCast(hipblasHandle_t          handle,
         handle, trans, n, nrhs, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)B, ldb, info);
 }
 
+// getrs_64
+hipblasStatus_t hipblasCgetrsCast_64(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int64_t            n,
+                                     const int64_t            nrhs,
+                                     hipblasComplex*          A,
+                                     const int64_t            lda,
+                                     const int64_t*           ipiv,
+                                     hipblasComplex*          B,
+                                     const int64_t            ldb,
+                                     int64_t*                 info)
+{
+    return hipblasCgetrs_64(
+        handle, trans, n, nrhs, (hipComplex*)A, lda, ipiv, (hipComplex*)B, ldb, info);
+}
+
+hipblasStatus_t hipblasZgetrsCast_64(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int64_t            n,
+                                     const int64_t            nrhs,
+                                     hipblasDoubleComplex*    A,
+                                     const int64_t            lda,
+                                     const int64_t*           ipiv,
+                                     hipblasDoubleComplex*    B,
+                                     const int64_t            ldb,
+                                     int64_t*                 info)
+{
+    return hipblasZgetrs_64(
+        handle, trans, n, nrhs, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)B, ldb, info);
+}
+
 // getrs_batched
 hipblasStatus_t hipblasCgetrsBatchedCast(hipblasHandle_t          handle,
                                          const hipblasOperation_t trans,
@@ -8333,6 +14057,57 @@ hipblasStatus_t hipblasZgetrsBatchedCast(hipblasHandle_t             handle,
                                 batchCount);
 }
 
+// getrs_batched_64
+hipblasStatus_t hipblasCgetrsBatchedCast_64(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int64_t            n,
+                                            const int64_t            nrhs,
+                                            hipblasComplex* const    A[],
+                                            const int64_t            lda,
+                                            const int64_t*           ipiv,
+                                            hipblasComplex* const    B[],
+                                            const int64_t            ldb,
+                                            int64_t*                 info,
+                                            const int64_t            batchCount)
+{
+    return hipblasCgetrsBatched_64(handle,
+                                   trans,
+                                   n,
+                                   nrhs,
+                                   (hipComplex* const*)A,
+                                   lda,
+                                   ipiv,
+                                   (hipComplex* const*)B,
+                                   ldb,
+                                   info,
+                                   batchCount);
+}
+
+hipblasStatus_t hipblasZgetrsBatchedCast_64(hipblasHandle_t             handle,
+                                            const hipblasOperation_t    trans,
+                                            const int64_t               n,
+                                            const int64_t               nrhs,
+                                            hipblasDoubleComplex* const A[],
+                                            const int64_t               lda,
+                                            const int64_t*              ipiv,
+                                            hipblasDoubleComplex* const B[],
+                                            const int64_t               ldb,
+                                            int64_t*                    info,
+                                            const int64_t               batchCount)
+{
+    return hipblasZgetrsBatched_64(handle,
+                                   trans,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex* const*)A,
+                                   lda,
+                                   ipiv,
+                                   (hipDoubleComplex* const*)B,
+                                   ldb,
+                                   info,
+                                   batchCount);
+}
+
 // getrs_strided_batched
 hipblasStatus_t hipblasCgetrsStridedBatchedCast(hipblasHandle_t          handle,
                                                 const hipblasOperation_t trans,
@@ -8396,6 +14171,69 @@ hipblasStatus_t hipblasZgetrsStridedBatchedCast(hipblasHandle_t          handle,
                                        batchCount);
 }
 
+// getrs_strided_batched_64
+hipblasStatus_t hipblasCgetrsStridedBatchedCast_64(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int64_t            n,
+                                                   const int64_t            nrhs,
+                                                   hipblasComplex*          A,
+                                                   const int64_t            lda,
+                                                   const hipblasStride      strideA,
+                                                   const int64_t*           ipiv,
+                                                   const hipblasStride      strideP,
+                                                   hipblasComplex*          B,
+                                                   const int64_t            ldb,
+                                                   const hipblasStride      strideB,
+                                                   int64_t*                 info,
+                                                   const int64_t            batchCount)
+{
+    return hipblasCgetrsStridedBatched_64(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipComplex*)A,
+                                          lda,
+                                          strideA,
+                                          ipiv,
+                                          strideP,
+                                          (hipComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          info,
+                                          batchCount);
+}
+
+hipblasStatus_t hipblasZgetrsStridedBatchedCast_64(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int64_t            n,
+                                                   const int64_t            nrhs,
+                                                   hipblasDoubleComplex*    A,
+                                                   const int64_t            lda,
+                                                   const hipblasStride      strideA,
+                                                   const int64_t*           ipiv,
+                                                   const hipblasStride      strideP,
+                                                   hipblasDoubleComplex*    B,
+                                                   const int64_t            ldb,
+                                                   const hipblasStride      strideB,
+                                                   int64_t*                 info,
+                                                   const int64_t            batchCount)
+{
+    return hipblasZgetrsStridedBatched_64(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          strideA,
+                                          ipiv,
+                                          strideP,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          strideB,
+                                          info,
+                                          batchCount);
+}
+
 // getri_batched
 hipblasStatus_t hipblasCgetriBatchedCast(hipblasHandle_t       handle,
                                          const int             n,
@@ -8432,6 +14270,945 @@ hipblasStatus_t hipblasZgetriBatchedCast(hipblasHandle_t             handle,
                                 batchCount);
 }
 
+// potrf
+hipblasStatus_t hipblasCpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasCpotrf(handle, uplo, n, (hipComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasZpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasZpotrf(handle, uplo, n, (hipDoubleComplex*)A, lda, info);
+}
+
+// potrf_batched
+hipblasStatus_t hipblasCpotrfBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotrfBatched(handle, uplo, n, (hipComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotrfBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return
+        hipblasZpotrfBatched(handle, uplo, n, (hipDoubleComplex* const*)A, lda, info, batchCount);
+}
+
+// potrf_strided_batched
+hipblasStatus_t hipblasCpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotrfStridedBatched(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotrfStridedBatched(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
+
+// potrs
+hipblasStatus_t hipblasCpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  hipblasComplex*         B,
+                                  const int               ldb,
+                                  int*                    info)
+{
+    return hipblasCpotrs(handle, uplo, n, nrhs, (hipComplex*)A, lda, (hipComplex*)B, ldb, info);
+}
+
+hipblasStatus_t hipblasZpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  hipblasDoubleComplex*   B,
+                                  const int               ldb,
+                                  int*                    info)
+{
+    return hipblasZpotrs(
+        handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+}
+
+// potrs_batched
+hipblasStatus_t hipblasCpotrsBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         const int               nrhs,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         hipblasComplex* const   B[],
+                                         const int               ldb,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotrsBatched(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipComplex* const*)A,
+                                lda,
+                                (hipComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasZpotrsBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const int                   nrhs,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const B[],
+                                         const int                   ldb,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZpotrsBatched(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                (hipDoubleComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+
+// potrs_strided_batched
+hipblasStatus_t hipblasCpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasComplex*         B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipComplex*)B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasDoubleComplex*   B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipDoubleComplex*)B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+// potri
+hipblasStatus_t hipblasCpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasCpotri(handle, uplo, n, (hipComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasZpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasZpotri(handle, uplo, n, (hipDoubleComplex*)A, lda, info);
+}
+
+// potri_batched
+hipblasStatus_t hipblasCpotriBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotriBatched(handle, uplo, n, (hipComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotriBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return
+        hipblasZpotriBatched(handle, uplo, n, (hipDoubleComplex* const*)A, lda, info, batchCount);
+}
+
+// potri_strided_batched
+hipblasStatus_t hipblasCpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotriStridedBatched(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotriStridedBatched(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
+
+// heevd
+hipblasStatus_t hipblasCheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEigMode_t  jobz,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  float*                  W,
+                                  int*                    info)
+{
+    return hipblasCheevd(handle, jobz, uplo, n, (hipComplex*)A, lda, W, info);
+}
+
+hipblasStatus_t hipblasZheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEigMode_t  jobz,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  double*                 W,
+                                  int*                    info)
+{
+    return hipblasZheevd(handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, info);
+}
+
+// heevd_batched
+hipblasStatus_t hipblasCheevdBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasEigMode_t  jobz,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         float*                  W,
+                                         const hipblasStride     strideW,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCheevdBatched(
+        handle, jobz, uplo, n, (hipComplex* const*)A, lda, W, strideW, info, batchCount);
+}
+
+hipblasStatus_t hipblasZheevdBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasEigMode_t      jobz,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         double*                     W,
+                                         const hipblasStride         strideW,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZheevdBatched(
+        handle, jobz, uplo, n, (hipDoubleComplex* const*)A, lda, W, strideW, info, batchCount);
+}
+
+// heevd_strided_batched
+hipblasStatus_t hipblasCheevdStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEigMode_t  jobz,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                float*                  W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCheevdStridedBatched(
+        handle, jobz, uplo, n, (hipComplex*)A, lda, strideA, W, strideW, info, batchCount);
+}
+
+hipblasStatus_t hipblasZheevdStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEigMode_t  jobz,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                double*                 W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZheevdStridedBatched(
+        handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, strideA, W, strideW, info, batchCount);
+}
+
+
+// gesvd
+hipblasStatus_t hipblasCgesvdCast(hipblasHandle_t        handle,
+                                  const hipblasSvdMode_t jobu,
+                                  const hipblasSvdMode_t jobv,
+                                  const int              m,
+                                  const int              n,
+                                  hipblasComplex*        A,
+                                  const int              lda,
+                                  float*                 S,
+                                  hipblasComplex*        U,
+                                  const int              ldu,
+                                  hipblasComplex*        V,
+                                  const int              ldv,
+                                  int*                   info)
+{
+    return hipblasCgesvd(handle,
+                         jobu,
+                         jobv,
+                         m,
+                         n,
+                         (hipComplex*)A,
+                         lda,
+                         S,
+                         (hipComplex*)U,
+                         ldu,
+                         (hipComplex*)V,
+                         ldv,
+                         info);
+}
+
+hipblasStatus_t hipblasZgesvdCast(hipblasHandle_t        handle,
+                                  const hipblasSvdMode_t jobu,
+                                  const hipblasSvdMode_t jobv,
+                                  const int              m,
+                                  const int              n,
+                                  hipblasDoubleComplex*  A,
+                                  const int              lda,
+                                  double*                S,
+                                  hipblasDoubleComplex*  U,
+                                  const int              ldu,
+                                  hipblasDoubleComplex*  V,
+                                  const int              ldv,
+                                  int*                   info)
+{
+    return hipblasZgesvd(handle,
+                         jobu,
+                         jobv,
+                         m,
+                         n,
+                         (hipDoubleComplex*)A,
+                         lda,
+                         S,
+                         (hipDoubleComplex*)U,
+                         ldu,
+                         (hipDoubleComplex*)V,
+                         ldv,
+                         info);
+}
+
+// gesvd_batched
+hipblasStatus_t hipblasCgesvdBatchedCast(hipblasHandle_t        handle,
+                                         const hipblasSvdMode_t jobu,
+                                         const hipblasSvdMode_t jobv,
+                                         const int              m,
+                                         const int              n,
+                                         hipblasComplex* const  A[],
+                                         const int              lda,
+                                         float*                 S,
+                                         const hipblasStride    strideS,
+                                         hipblasComplex*        U,
+                                         const int              ldu,
+                                         const hipblasStride    strideU,
+                                         hipblasComplex*        V,
+                                         const int              ldv,
+                                         const hipblasStride    strideV,
+                                         int*                   info,
+                                         const int              batchCount)
+{
+    return hipblasCgesvdBatched(handle,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                (hipComplex* const*)A,
+                                lda,
+                                S,
+                                strideS,
+                                (hipComplex*)U,
+                                ldu,
+                                strideU,
+                                (hipComplex*)V,
+                                ldv,
+                                strideV,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasZgesvdBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasSvdMode_t      jobu,
+                                         const hipblasSvdMode_t      jobv,
+                                         const int                   m,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         double*                     S,
+                                         const hipblasStride         strideS,
+                                         hipblasDoubleComplex*       U,
+                                         const int                   ldu,
+                                         const hipblasStride         strideU,
+                                         hipblasDoubleComplex*       V,
+                                         const int                   ldv,
+                                         const hipblasStride         strideV,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZgesvdBatched(handle,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                S,
+                                strideS,
+                                (hipDoubleComplex*)U,
+                                ldu,
+                                strideU,
+                                (hipDoubleComplex*)V,
+                                ldv,
+                                strideV,
+                                info,
+                                batchCount);
+}
+
+// gesvd_strided_batched
+hipblasStatus_t hipblasCgesvdStridedBatchedCast(hipblasHandle_t        handle,
+                                                const hipblasSvdMode_t jobu,
+                                                const hipblasSvdMode_t jobv,
+                                                const int              m,
+                                                const int              n,
+                                                hipblasComplex*        A,
+                                                const int              lda,
+                                                const hipblasStride    strideA,
+                                                float*                 S,
+                                                const hipblasStride    strideS,
+                                                hipblasComplex*        U,
+                                                const int              ldu,
+                                                const hipblasStride    strideU,
+                                                hipblasComplex*        V,
+                                                const int              ldv,
+                                                const hipblasStride    strideV,
+                                                int*                   info,
+                                                const int              batchCount)
+{
+    return hipblasCgesvdStridedBatched(handle,
+                                       jobu,
+                                       jobv,
+                                       m,
+                                       n,
+                                       (hipComplex*)A,
+                                       lda,
+                                       strideA,
+                                       S,
+                                       strideS,
+                                       (hipComplex*)U,
+                                       ldu,
+                                       strideU,
+                                       (hipComplex*)V,
+                                       ldv,
+                                       strideV,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasZgesvdStridedBatchedCast(hipblasHandle_t        handle,
+                                                const hipblasSvdMode_t jobu,
+                                                const hipblasSvdMode_t jobv,
+                                                const int              m,
+                                                const int              n,
+                                                hipblasDoubleComplex*  A,
+                                                const int              lda,
+                                                const hipblasStride    strideA,
+                                                double*                S,
+                                                const hipblasStride    strideS,
+                                                hipblasDoubleComplex*  U,
+                                                const int              ldu,
+                                                const hipblasStride    strideU,
+                                                hipblasDoubleComplex*  V,
+                                                const int              ldv,
+                                                const hipblasStride    strideV,
+                                                int*                   info,
+                                                const int              batchCount)
+{
+    return hipblasZgesvdStridedBatched(handle,
+                                       jobu,
+                                       jobv,
+                                       m,
+                                       n,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       S,
+                                       strideS,
+                                       (hipDoubleComplex*)U,
+                                       ldu,
+                                       strideU,
+                                       (hipDoubleComplex*)V,
+                                       ldv,
+                                       strideV,
+                                       info,
+                                       batchCount);
+}
+
+// gesvdj
+hipblasStatus_t hipblasCgesvdjCast(hipblasHandle_t        handle,
+                                   const hipblasSvdMode_t jobu,
+                                   const hipblasSvdMode_t jobv,
+                                   const int              m,
+                                   const int              n,
+                                   hipblasComplex*        A,
+                                   const int              lda,
+                                   const float            abstol,
+                                   float*                 residual,
+                                   const int              maxSweeps,
+                                   int*                   nSweeps,
+                                   float*                 S,
+                                   hipblasComplex*        U,
+                                   const int              ldu,
+                                   hipblasComplex*        V,
+                                   const int              ldv,
+                                   int*                   info)
+{
+    return hipblasCgesvdj(handle,
+                          jobu,
+                          jobv,
+                          m,
+                          n,
+                          (hipComplex*)A,
+                          lda,
+                          abstol,
+                          residual,
+                          maxSweeps,
+                          nSweeps,
+                          S,
+                          (hipComplex*)U,
+                          ldu,
+                          (hipComplex*)V,
+                          ldv,
+                          info);
+}
+
+hipblasStatus_t hipblasZgesvdjCast(hipblasHandle_t        handle,
+                                   const hipblasSvdMode_t jobu,
+                                   const hipblasSvdMode_t jobv,
+                                   const int              m,
+                                   const int              n,
+                                   hipblasDoubleComplex*  A,
+                                   const int              lda,
+                                   const double           abstol,
+                                   double*                residual,
+                                   const int              maxSweeps,
+                                   int*                   nSweeps,
+                                   double*                S,
+                                   hipblasDoubleComplex*  U,
+                                   const int              ldu,
+                                   hipblasDoubleComplex*  V,
+                                   const int              ldv,
+                                   int*                   info)
+{
+    return hipblasZgesvdj(handle,
+                          jobu,
+                          jobv,
+                          m,
+                          n,
+                          (hipDoubleComplex*)A,
+                          lda,
+                          abstol,
+                          residual,
+                          maxSweeps,
+                          nSweeps,
+                          S,
+                          (hipDoubleComplex*)U,
+                          ldu,
+                          (hipDoubleComplex*)V,
+                          ldv,
+                          info);
+}
+
+// gesvdj_batched
+hipblasStatus_t hipblasCgesvdjBatchedCast(hipblasHandle_t        handle,
+                                          const hipblasSvdMode_t jobu,
+                                          const hipblasSvdMode_t jobv,
+                                          const int              m,
+                                          const int              n,
+                                          hipblasComplex* const  A[],
+                                          const int              lda,
+                                          const float            abstol,
+                                          float*                 residual,
+                                          const int              maxSweeps,
+                                          int*                   nSweeps,
+                                          float*                 S,
+                                          const hipblasStride    strideS,
+                                          hipblasComplex*        U,
+                                          const int              ldu,
+                                          const hipblasStride    strideU,
+                                          hipblasComplex*        V,
+                                          const int              ldv,
+                                          const hipblasStride    strideV,
+                                          int*                   info,
+                                          const int              batchCount)
+{
+    return hipblasCgesvdjBatched(handle,
+                                 jobu,
+                                 jobv,
+                                 m,
+                                 n,
+                                 (hipComplex* const*)A,
+                                 lda,
+                                 abstol,
+                                 residual,
+                                 maxSweeps,
+                                 nSweeps,
+                                 S,
+                                 strideS,
+                                 (hipComplex*)U,
+                                 ldu,
+                                 strideU,
+                                 (hipComplex*)V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+hipblasStatus_t hipblasZgesvdjBatchedCast(hipblasHandle_t             handle,
+                                          const hipblasSvdMode_t      jobu,
+                                          const hipblasSvdMode_t      jobv,
+                                          const int                   m,
+                                          const int                   n,
+                                          hipblasDoubleComplex* const A[],
+                                          const int                   lda,
+                                          const double                abstol,
+                                          double*                     residual,
+                                          const int                   maxSweeps,
+                                          int*                        nSweeps,
+                                          double*                     S,
+                                          const hipblasStride         strideS,
+                                          hipblasDoubleComplex*       U,
+                                          const int                   ldu,
+                                          const hipblasStride         strideU,
+                                          hipblasDoubleComplex*       V,
+                                          const int                   ldv,
+                                          const hipblasStride         strideV,
+                                          int*                        info,
+                                          const int                   batchCount)
+{
+    return hipblasZgesvdjBatched(handle,
+                                 jobu,
+                                 jobv,
+                                 m,
+                                 n,
+                                 (hipDoubleComplex* const*)A,
+                                 lda,
+                                 abstol,
+                                 residual,
+                                 maxSweeps,
+                                 nSweeps,
+                                 S,
+                                 strideS,
+                                 (hipDoubleComplex*)U,
+                                 ldu,
+                                 strideU,
+                                 (hipDoubleComplex*)V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+// gesvdj_strided_batched
+hipblasStatus_t hipblasCgesvdjStridedBatchedCast(hipblasHandle_t        handle,
+                                                 const hipblasSvdMode_t jobu,
+                                                 const hipblasSvdMode_t jobv,
+                                                 const int              m,
+                                                 const int              n,
+                                                 hipblasComplex*        A,
+                                                 const int              lda,
+                                                 const hipblasStride    strideA,
+                                                 const float            abstol,
+                                                 float*                 residual,
+                                                 const int              maxSweeps,
+                                                 int*                   nSweeps,
+                                                 float*                 S,
+                                                 const hipblasStride    strideS,
+                                                 hipblasComplex*        U,
+                                                 const int              ldu,
+                                                 const hipblasStride    strideU,
+                                                 hipblasComplex*        V,
+                                                 const int              ldv,
+                                                 const hipblasStride    strideV,
+                                                 int*                   info,
+                                                 const int              batchCount)
+{
+    return hipblasCgesvdjStridedBatched(handle,
+                                        jobu,
+                                        jobv,
+                                        m,
+                                        n,
+                                        (hipComplex*)A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        maxSweeps,
+                                        nSweeps,
+                                        S,
+                                        strideS,
+                                        (hipComplex*)U,
+                                        ldu,
+                                        strideU,
+                                        (hipComplex*)V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+hipblasStatus_t hipblasZgesvdjStridedBatchedCast(hipblasHandle_t        handle,
+                                                 const hipblasSvdMode_t jobu,
+                                                 const hipblasSvdMode_t jobv,
+                                                 const int              m,
+                                                 const int              n,
+                                                 hipblasDoubleComplex*  A,
+                                                 const int              lda,
+                                                 const hipblasStride    strideA,
+                                                 const double           abstol,
+                                                 double*                residual,
+                                                 const int              maxSweeps,
+                                                 int*                   nSweeps,
+                                                 double*                S,
+                                                 const hipblasStride    strideS,
+                                                 hipblasDoubleComplex*  U,
+                                                 const int              ldu,
+                                                 const hipblasStride    strideU,
+                                                 hipblasDoubleComplex*  V,
+                                                 const int              ldv,
+                                                 const hipblasStride    strideV,
+                                                 int*                   info,
+                                                 const int              batchCount)
+{
+    return hipblasZgesvdjStridedBatched(handle,
+                                        jobu,
+                                        jobv,
+                                        m,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        maxSweeps,
+                                        nSweeps,
+                                        S,
+                                        strideS,
+                                        (hipDoubleComplex*)U,
+                                        ldu,
+                                        strideU,
+                                        (hipDoubleComplex*)V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+// gesv
+hipblasStatus_t hipblasZCgesvCast(hipblasHandle_t             handle,
+                                  const int                   n,
+                                  const int                   nrhs,
+                                  hipblasDoubleComplex*       A,
+                                  const int                   lda,
+                                  int*                        ipiv,
+                                  const hipblasDoubleComplex* B,
+                                  const int                   ldb,
+                                  hipblasDoubleComplex*       X,
+                                  const int                   ldx,
+                                  int*                        iter,
+                                  int*                        info,
+                                  int*                        deviceInfo)
+{
+    return hipblasZCgesv(handle,
+                         n,
+                         nrhs,
+                         (hipDoubleComplex*)A,
+                         lda,
+                         ipiv,
+                         (const hipDoubleComplex*)B,
+                         ldb,
+                         (hipDoubleComplex*)X,
+                         ldx,
+                         iter,
+                         info,
+                         deviceInfo);
+}
+
+// gesv_batched
+hipblasStatus_t hipblasZCgesvBatchedCast(hipblasHandle_t                   handle,
+                                         const int                         n,
+                                         const int                         nrhs,
+                                         hipblasDoubleComplex* const       A[],
+                                         const int                         lda,
+                                         int*                              ipiv,
+                                         const hipblasDoubleComplex* const B[],
+                                         const int                         ldb,
+                                         hipblasDoubleComplex* const       X[],
+                                         const int                         ldx,
+                                         int*                              iter,
+                                         int*                              info,
+                                         int*                              deviceInfo,
+                                         const int                         batchCount)
+{
+    return hipblasZCgesvBatched(handle,
+                                n,
+                                nrhs,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                ipiv,
+                                (const hipDoubleComplex* const*)B,
+                                ldb,
+                                (hipDoubleComplex* const*)X,
+                                ldx,
+                                iter,
+                                info,
+                                deviceInfo,
+                                batchCount);
+}
+
+// gesv_strided_batched
+hipblasStatus_t hipblasZCgesvStridedBatchedCast(hipblasHandle_t             handle,
+                                                const int                   n,
+                                                const int                   nrhs,
+                                                hipblasDoubleComplex*       A,
+                                                const int                   lda,
+                                                const hipblasStride         strideA,
+                                                int*                        ipiv,
+                                                const hipblasStride         strideP,
+                                                const hipblasDoubleComplex* B,
+                                                const int                   ldb,
+                                                const hipblasStride         strideB,
+                                                hipblasDoubleComplex*       X,
+                                                const int                   ldx,
+                                                const hipblasStride         strideX,
+                                                int*                        iter,
+                                                int*                        info,
+                                                int*                        deviceInfo,
+                                                const int                   batchCount)
+{
+    return hipblasZCgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       (const hipDoubleComplex*)B,
+                                       ldb,
+                                       strideB,
+                                       (hipDoubleComplex*)X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+}
+
 // geqrf
 hipblasStatus_t hipblasCgeqrfCast(hipblasHandle_t handle,
                                   const int       m,
@@ -8455,6 +15232,29 @@ hipblasStatus_t hipblasZgeqrfCast(hipblasHandle_t       handle,
     return hipblasZgeqrf(handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)ipiv, info);
 }
 
+// geqrf_64
+hipblasStatus_t hipblasCgeqrfCast_64(hipblasHandle_t handle,
+                                     const int64_t   m,
+                                     const int64_t   n,
+                                     hipblasComplex* A,
+                                     const int64_t   lda,
+                                     hipblasComplex* ipiv,
+                                     int64_t*        info)
+{
+    return hipblasCgeqrf_64(handle, m, n, (hipComplex*)A, lda, (hipComplex*)ipiv, info);
+}
+
+hipblasStatus_t hipblasZgeqrfCast_64(hipblasHandle_t       handle,
+                                     const int64_t         m,
+                                     const int64_t         n,
+                                     hipblasDoubleComplex* A,
+                                     const int64_t         lda,
+                                     hipblasDoubleComplex* ipiv,
+                                     int64_t*              info)
+{
+    return hipblasZgeqrf_64(handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)ipiv, info);
+}
+
 // geqrf_batched
 hipblasStatus_t hipblasCgeqrfBatchedCast(hipblasHandle_t       handle,
                                          const int             m,
@@ -8488,6 +15288,39 @@ hipblasStatus_t hipblasZgeqrfBatchedCast(hipblasHandle_t             handle,
                                 batchCount);
 }
 
+// geqrf_batched_64
+hipblasStatus_t hipblasCgeqrfBatchedCast_64(hipblasHandle_t       handle,
+                                            const int64_t         m,
+                                            const int64_t         n,
+                                            hipblasComplex* const A[],
+                                            const int64_t         lda,
+                                            hipblasComplex* const ipiv[],
+                                            int64_t*              info,
+                                            const int64_t         batchCount)
+{
+    return hipblasCgeqrfBatched_64(
+        handle, m, n, (hipComplex* const*)A, lda, (hipComplex* const*)ipiv, info, batchCount);
+}
+
+hipblasStatus_t hipblasZgeqrfBatchedCast_64(hipblasHandle_t             handle,
+                                            const int64_t               m,
+                                            const int64_t               n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int64_t               lda,
+                                            hipblasDoubleComplex* const ipiv[],
+                                            int64_t*                    info,
+                                            const int64_t               batchCount)
+{
+    return hipblasZgeqrfBatched_64(handle,
+                                   m,
+                                   n,
+                                   (hipDoubleComplex* const*)A,
+                                   lda,
+                                   (hipDoubleComplex* const*)ipiv,
+                                   info,
+                                   batchCount);
+}
+
 // geqrf_strided_batched
 hipblasStatus_t hipblasCgeqrfStridedBatchedCast(hipblasHandle_t     handle,
                                                 const int           m,
@@ -8527,6 +15360,45 @@ hipblasStatus_t hipblasZgeqrfStridedBatchedCast(hipblasHandle_t       handle,
                                        batchCount);
 }
 
+// geqrf_strided_batched_64
+hipblasStatus_t hipblasCgeqrfStridedBatchedCast_64(hipblasHandle_t     handle,
+                                                   const int64_t       m,
+                                                   const int64_t       n,
+                                                   hipblasComplex*     A,
+                                                   const int64_t       lda,
+                                                   const hipblasStride strideA,
+                                                   hipblasComplex*     ipiv,
+                                                   const hipblasStride strideP,
+                                                   int64_t*            info,
+                                                   const int64_t       batchCount)
+{
+    return hipblasCgeqrfStridedBatched_64(
+        handle, m, n, (hipComplex*)A, lda, strideA, (hipComplex*)ipiv, strideP, info, batchCount);
+}
+
+hipblasStatus_t hipblasZgeqrfStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   const int64_t         m,
+                                                   const int64_t         n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int64_t         lda,
+                                                   const hipblasStride   strideA,
+                                                   hipblasDoubleComplex* ipiv,
+                                                   const hipblasStride   strideP,
+                                                   int64_t*              info,
+                                                   const int64_t         batchCount)
+{
+    return hipblasZgeqrfStridedBatched_64(handle,
+                                          m,
+                                          n,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          strideA,
+                                          (hipDoubleComplex*)ipiv,
+                                          strideP,
+                                          info,
+                                          batchCount);
+}
+
 // gels
 hipblasStatus_t hipblasCgelsCast(hipblasHandle_t    handle,
                                  hipblasOperation_t trans,
@@ -8569,6 +15441,48 @@ hipblasStatus_t hipblasZgelsCast(hipblasHandle_t       handle,
                         deviceInfo);
 }
 
+// gels_64
+hipblasStatus_t hipblasCgelsCast_64(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int64_t      m,
+                                    const int64_t      n,
+                                    const int64_t      nrhs,
+                                    hipblasComplex*    A,
+                                    const int64_t      lda,
+                                    hipblasComplex*    B,
+                                    const int64_t      ldb,
+                                    int64_t*           info,
+                                    int64_t*           deviceInfo)
+{
+    return hipblasCgels_64(
+        handle, trans, m, n, nrhs, (hipComplex*)A, lda, (hipComplex*)B, ldb, info, deviceInfo);
+}
+
+hipblasStatus_t hipblasZgelsCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    trans,
+                                    const int64_t         m,
+                                    const int64_t         n,
+                                    const int64_t         nrhs,
+                                    hipblasDoubleComplex* A,
+                                    const int64_t         lda,
+                                    hipblasDoubleComplex* B,
+                                    const int64_t         ldb,
+                                    int64_t*              info,
+                                    int64_t*              deviceInfo)
+{
+    return hipblasZgels_64(handle,
+                           trans,
+                           m,
+                           n,
+                           nrhs,
+                           (hipDoubleComplex*)A,
+                           lda,
+                           (hipDoubleComplex*)B,
+                           ldb,
+                           info,
+                           deviceInfo);
+}
+
 // gelsBatched
 hipblasStatus_t hipblasCgelsBatchedCast(hipblasHandle_t       handle,
                                         hipblasOperation_t    trans,
@@ -8624,6 +15538,61 @@ hipblasStatus_t hipblasZgelsBatchedCast(hipblasHandle_t             handle,
                                batchCount);
 }
 
+// gelsBatched_64
+hipblasStatus_t hipblasCgelsBatchedCast_64(hipblasHandle_t       handle,
+                                           hipblasOperation_t    trans,
+                                           const int64_t         m,
+                                           const int64_t         n,
+                                           const int64_t         nrhs,
+                                           hipblasComplex* const A[],
+                                           const int64_t         lda,
+                                           hipblasComplex* const B[],
+                                           const int64_t         ldb,
+                                           int64_t*              info,
+                                           int64_t*              deviceInfo,
+                                           const int64_t         batchCount)
+{
+    return hipblasCgelsBatched_64(handle,
+                                  trans,
+                                  m,
+                                  n,
+                                  nrhs,
+                                  (hipComplex* const*)A,
+                                  lda,
+                                  (hipComplex* const*)B,
+                                  ldb,
+                                  info,
+                                  deviceInfo,
+                                  batchCount);
+}
+
+hipblasStatus_t hipblasZgelsBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          trans,
+                                           const int64_t               m,
+                                           const int64_t               n,
+                                           const int64_t               nrhs,
+                                           hipblasDoubleComplex* const A[],
+                                           const int64_t               lda,
+                                           hipblasDoubleComplex* const B[],
+                                           const int64_t               ldb,
+                                           int64_t*                    info,
+                                           int64_t*                    deviceInfo,
+                                           const int64_t               batchCount)
+{
+    return hipblasZgelsBatched_64(handle,
+                                  trans,
+                                  m,
+                                  n,
+                                  nrhs,
+                                  (hipDoubleComplex* const*)A,
+                                  lda,
+                                  (hipDoubleComplex* const*)B,
+                                  ldb,
+                                  info,
+                                  deviceInfo,
+                                  batchCount);
+}
+
 // gelsStridedBatched
 hipblasStatus_t hipblasCgelsStridedBatchedCast(hipblasHandle_t     handle,
                                                hipblasOperation_t  trans,
@@ -8687,5 +15656,68 @@ hipblasStatus_t hipblasZgelsStridedBatchedCast(hipblasHandle_t       handle,
                                       batchCount);
 }
 
+// gelsStridedBatched_64
+hipblasStatus_t hipblasCgelsStridedBatchedCast_64(hipblasHandle_t     handle,
+                                                  hipblasOperation_t  trans,
+                                                  const int64_t       m,
+                                                  const int64_t       n,
+                                                  const int64_t       nrhs,
+                                                  hipblasComplex*     A,
+                                                  const int64_t       lda,
+                                                  const hipblasStride strideA,
+                                                  hipblasComplex*     B,
+                                                  const int64_t       ldb,
+                                                  const hipblasStride strideB,
+                                                  int64_t*            info,
+                                                  int64_t*            deviceInfo,
+                                                  const int64_t       batchCount)
+{
+    return hipblasCgelsStridedBatched_64(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         (hipComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         info,
+                                         deviceInfo,
+                                         batchCount);
+}
+
+hipblasStatus_t hipblasZgelsStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    trans,
+                                                  const int64_t         m,
+                                                  const int64_t         n,
+                                                  const int64_t         nrhs,
+                                                  hipblasDoubleComplex* A,
+                                                  const int64_t         lda,
+                                                  const hipblasStride   strideA,
+                                                  hipblasDoubleComplex* B,
+                                                  const int64_t         ldb,
+                                                  const hipblasStride   strideB,
+                                                  int64_t*              info,
+                                                  int64_t*              deviceInfo,
+                                                  const int64_t         batchCount)
+{
+    return hipblasZgelsStridedBatched_64(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         (hipDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (hipDoubleComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         info,
+                                         deviceInfo,
+                                         batchCount);
+}
+
 #endif // solver
 #endif // HIPBLAS_V2
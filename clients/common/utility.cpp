@@ -198,27 +198,32 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
         status = hipblasSetAtomicsMode(m_handle, hipblasAtomicsMode_t(arg.atomics_mode));
     if(status == HIPBLAS_STATUS_SUCCESS)
     {
-        /*
         // If the test specifies user allocated workspace, allocate and use it
         if(arg.user_allocated_workspace)
         {
             if((hipMalloc)(&m_memory, arg.user_allocated_workspace) != hipSuccess)
                 throw std::bad_alloc();
-            status = rocblas_set_workspace(m_handle, m_memory, arg.user_allocated_workspace);
+            status = hipblasSetWorkspace(m_handle, m_memory, arg.user_allocated_workspace);
         }
-    */
     }
-    else
-    {
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
         throw std::runtime_error(hipblasStatusToString(status));
-    }
 }
 
 hipblasLocalHandle::~hipblasLocalHandle()
 {
+    // the handle may still use the workspace, destroy it first
+    hipblasStatus_t status = hipblasDestroy(m_handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::cerr << "hipblasDestroy error: " << hipblasStatusToString(status) << "\n";
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+#endif
+    }
     if(m_memory)
     {
-        // m_memory never used currently
         auto hipStatus = hipFree(m_memory);
         if(hipStatus != hipSuccess)
         {
@@ -226,14 +231,6 @@ hipblasLocalHandle::~hipblasLocalHandle()
                       << hipGetErrorString(hipStatus) << "\n";
         }
     }
-    hipblasStatus_t status = hipblasDestroy(m_handle);
-    if(status != HIPBLAS_STATUS_SUCCESS)
-    {
-        std::cerr << "hipblasDestroy error: " << hipblasStatusToString(status) << "\n";
-#ifdef GOOGLE_TEST
-        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
-#endif
-    }
 }
 
 /*******************************************************************************
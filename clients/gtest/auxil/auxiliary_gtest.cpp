@@ -21,9 +21,18 @@
  *
  * ************************************************************************ */
 
+#include "hipblas_replay.hpp"
+#include "hipblas_test.hpp"
+#include "hipblas_vector.hpp"
 #include "utility.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <math.h>
+#include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 namespace
@@ -36,4 +45,401 @@ namespace
                          hipblasStatusToString(HIPBLAS_STATUS_ALLOC_FAILED)));
     }
 
+    TEST(hipblas_auxiliary, handlePool)
+    {
+        int device;
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+
+        hipblasHandlePool_t      pool;
+        hipblasHandle_t          handle, handle2;
+        hipblasHandlePoolStats_t stats;
+
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(nullptr, device, nullptr, &handle),
+                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolCreate(&pool));
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(pool, device, nullptr, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(pool, -1, nullptr, &handle),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolGetStats(pool, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // Modes changed while the handle is acquired are reset on release
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, device, nullptr, &handle));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(pool, handle),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, device, nullptr, &handle2));
+        EXPECT_EQ(handle, handle2);
+
+        hipblasPointerMode_t mode;
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle2, &mode));
+        EXPECT_EQ(mode, HIPBLAS_POINTER_MODE_HOST);
+
+        // Handles must be released before the pool is destroyed
+        EXPECT_HIPBLAS_STATUS(hipblasHandlePoolDestroy(pool), HIPBLAS_STATUS_INVALID_VALUE);
+
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolGetStats(pool, &stats));
+        EXPECT_EQ(stats.handlesCreated, size_t(1));
+        EXPECT_EQ(stats.acquires, size_t(2));
+        EXPECT_EQ(stats.threadCacheHits, size_t(1));
+        EXPECT_EQ(stats.handlesInUse, size_t(1));
+        EXPECT_EQ(stats.handlesIdle, size_t(0));
+
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle2));
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(pool));
+    }
+
+    TEST(hipblas_auxiliary, handlePoolThreads)
+    {
+        int device;
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+
+        hipblasHandlePool_t pool;
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolCreate(&pool));
+
+        const int                threads = 8, iterations = 100;
+        std::vector<std::thread> workers;
+        for(int t = 0; t < threads; t++)
+            workers.emplace_back([&] {
+                CHECK_HIP_ERROR(hipSetDevice(device));
+                for(int i = 0; i < iterations; i++)
+                {
+                    hipblasHandle_t handle;
+                    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, device, nullptr, &handle));
+                    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+                }
+            });
+        for(auto& worker : workers)
+            worker.join();
+
+        // A handle may be released by another thread than the one which acquired it
+        hipblasHandle_t handle;
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, device, nullptr, &handle));
+        std::thread([&] { CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle)); }).join();
+
+        hipblasHandlePoolStats_t stats;
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolGetStats(pool, &stats));
+        EXPECT_EQ(stats.acquires, size_t(threads * iterations + 1));
+        EXPECT_EQ(stats.releases, stats.acquires);
+        EXPECT_EQ(stats.acquires,
+                  stats.handlesCreated + stats.threadCacheHits + stats.sharedHits);
+        EXPECT_LE(stats.handlesCreated, size_t(threads + 1));
+        EXPECT_EQ(stats.handlesInUse, size_t(0));
+        EXPECT_EQ(stats.handlesIdle, stats.handlesCreated);
+
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(pool));
+    }
+
+    TEST(hipblas_auxiliary, profile)
+    {
+        const char* path = "hipblas_auxiliary_profile.yaml";
+        std::remove(path);
+
+        hipblasHandle_t handle;
+        CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+
+        EXPECT_HIPBLAS_STATUS(hipblasProfileStart(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_HIPBLAS_STATUS(hipblasProfileDump(nullptr, path), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+        const int            n     = 1000;
+        float                alpha = 2;
+        device_vector<float> dx(n);
+        CHECK_HIP_ERROR(dx.memcheck());
+
+        // Calls are only timed between start and stop
+        CHECK_HIPBLAS_ERROR(hipblasSscal(handle, n, &alpha, dx, 1));
+        CHECK_HIPBLAS_ERROR(hipblasProfileStart(handle));
+        for(int i = 0; i < 3; i++)
+            CHECK_HIPBLAS_ERROR(hipblasSscal(handle, n, &alpha, dx, 1));
+        CHECK_HIPBLAS_ERROR(hipblasSscal(handle, n / 2, &alpha, dx, 1));
+        CHECK_HIPBLAS_ERROR(hipblasProfileStop(handle));
+        CHECK_HIPBLAS_ERROR(hipblasSscal(handle, n, &alpha, dx, 1));
+
+        CHECK_HIPBLAS_ERROR(hipblasProfileDump(handle, path));
+        CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+
+        std::ifstream      file(path);
+        std::ostringstream summary;
+        summary << file.rdbuf();
+        file.close();
+        std::remove(path);
+
+        EXPECT_NE(summary.str().find("function: hipblasSscal, n: 1000, incx: 1, calls: 3,"),
+                  std::string::npos);
+        EXPECT_NE(summary.str().find("function: hipblasSscal, n: 500, incx: 1, calls: 1,"),
+                  std::string::npos);
+        EXPECT_NE(summary.str().find("gflops: "), std::string::npos);
+    }
+
+    TEST(hipblas_auxiliary, buildPointerArray)
+    {
+        hipblasHandle_t handle;
+        CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+
+        const int              n = 10, batch_count = 1000;
+        const hipblasStride    stride = 16;
+        device_vector<float>   dx(stride * batch_count);
+        device_vector<float*>  dptrs(batch_count);
+        device_vector<int64_t> doffsets(batch_count);
+        void**                 ptrs = (void**)(float**)dptrs;
+
+        EXPECT_HIPBLAS_STATUS(
+            hipblasBuildPointerArrayStrided(nullptr, ptrs, dx, sizeof(float), stride, batch_count),
+            HIPBLAS_STATUS_NOT_INITIALIZED);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasBuildPointerArrayStrided(handle, ptrs, dx, 0, stride, batch_count),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasBuildPointerArrayStrided(handle, nullptr, dx, sizeof(float), stride, 1),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasBuildPointerArrayOffsets(handle, ptrs, dx, sizeof(float), nullptr, 1),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasBuildPointerArrayOffsets(nullptr, nullptr, nullptr, sizeof(float), nullptr, 0),
+            HIPBLAS_STATUS_NOT_INITIALIZED);
+        // quick return with no batches before the arrays are read
+        CHECK_HIPBLAS_ERROR(
+            hipblasBuildPointerArrayStrided(handle, nullptr, nullptr, sizeof(float), stride, 0));
+        CHECK_HIPBLAS_ERROR(
+            hipblasBuildPointerArrayOffsets(handle, nullptr, nullptr, sizeof(float), nullptr, 0));
+
+        // The pointer array is used on the stream it was built on without synchronizing
+        std::vector<float> hx(stride * batch_count, 1.0f);
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(
+            hipblasBuildPointerArrayStrided(handle, ptrs, dx, sizeof(float), stride, batch_count));
+        float alpha = 2;
+        CHECK_HIPBLAS_ERROR(
+            hipblasSscalBatched(handle, n, &alpha, (float* const*)ptrs, 1, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hx.data(), dx, sizeof(float) * hx.size(), hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < hx.size(); i++)
+            EXPECT_EQ(hx[i], i % stride < n ? 2.0f : 1.0f);
+
+        // Offsets in reverse order
+        std::vector<int64_t> hoffsets(batch_count);
+        for(int b = 0; b < batch_count; b++)
+            hoffsets[b] = (batch_count - 1 - b) * stride + 1;
+        CHECK_HIP_ERROR(hipMemcpy(
+            doffsets, hoffsets.data(), sizeof(int64_t) * batch_count, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(
+            hipblasBuildPointerArrayOffsets(handle, ptrs, dx, sizeof(float), doffsets, batch_count));
+
+        std::vector<float*> hptrs(batch_count);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hptrs.data(), dptrs, sizeof(float*) * batch_count, hipMemcpyDeviceToHost));
+        for(int b = 0; b < batch_count; b++)
+            EXPECT_EQ(hptrs[b], (float*)dx + hoffsets[b]);
+
+        CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+    }
+
+    TEST(hipblas_auxiliary, invalidEnum)
+    {
+        hipblasHandle_t handle;
+        CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+
+        // Enum arguments are checked before anything else, so no memory is needed
+        const auto bad_op   = hipblasOperation_t(HIPBLAS_OP_C + 1);
+        const auto bad_side = hipblasSideMode_t(0);
+        const auto bad_fill = hipblasFillMode_t(HIPBLAS_FILL_MODE_FULL + 1);
+        float      alpha = 1, beta = 0;
+
+        EXPECT_HIPBLAS_STATUS(hipblasSgemm(handle,
+                                           bad_op,
+                                           HIPBLAS_OP_N,
+                                           0,
+                                           0,
+                                           0,
+                                           &alpha,
+                                           nullptr,
+                                           1,
+                                           nullptr,
+                                           1,
+                                           &beta,
+                                           nullptr,
+                                           1),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+        EXPECT_HIPBLAS_STATUS(hipblasStrsm(handle,
+                                           bad_side,
+                                           HIPBLAS_FILL_MODE_UPPER,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_DIAG_UNIT,
+                                           0,
+                                           0,
+                                           &alpha,
+                                           nullptr,
+                                           1,
+                                           nullptr,
+                                           1),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+        EXPECT_HIPBLAS_STATUS(hipblasSsyr(handle, bad_fill, 0, &alpha, nullptr, 1, nullptr, 1),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+        EXPECT_HIPBLAS_STATUS(hipblasSetMathMode(handle, hipblasMath_t(HIPBLAS_TENSOR_OP_MATH + 1)),
+                              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+        CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+    }
+
+    TEST(hipblas_auxiliary, gemmTuning)
+    {
+        const char* path = "hipblas_auxiliary_gemm.tuning";
+        std::remove(path);
+
+        std::vector<hipblasGemmTuningEntry_t> entries;
+        for(int i = 1; i <= 100; i++)
+            entries.push_back({i % 2 ? HIPBLAS_GEMM_TUNING_EX : HIPBLAS_GEMM_TUNING_BATCHED_EX,
+                               HIPBLAS_OP_N,
+                               HIPBLAS_OP_T,
+                               i,
+                               2 * i,
+                               3 * i,
+                               i,
+                               3 * i,
+                               i,
+                               HIP_R_16F,
+                               HIP_R_16F,
+                               HIP_R_32F,
+                               HIPBLAS_COMPUTE_32F,
+                               i % 2 ? 1 : i,
+                               1000 + i});
+
+        int count = 0;
+        EXPECT_HIPBLAS_STATUS(hipblasGemmTuningRead(path, nullptr, &count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmTuningWrite(path, nullptr, 1),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // Entries are added to the file, replacing those for the same problem
+        CHECK_HIPBLAS_ERROR(hipblasGemmTuningWrite(path, entries.data(), 60));
+        CHECK_HIPBLAS_ERROR(hipblasGemmTuningWrite(path, entries.data() + 40, 60));
+        entries[10].solutionIndex = 7;
+        CHECK_HIPBLAS_ERROR(hipblasGemmTuningWrite(path, &entries[10], 1));
+
+        entries[0].solutionIndex = 0;
+        EXPECT_HIPBLAS_STATUS(hipblasGemmTuningWrite(path, entries.data(), 1),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        entries[0].solutionIndex = 1001;
+
+        CHECK_HIPBLAS_ERROR(hipblasGemmTuningRead(path, nullptr, &count));
+        EXPECT_EQ(count, 100);
+
+        std::vector<hipblasGemmTuningEntry_t> read(count);
+        count = 99;
+        EXPECT_HIPBLAS_STATUS(hipblasGemmTuningRead(path, read.data(), &count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        CHECK_HIPBLAS_ERROR(hipblasGemmTuningRead(path, read.data(), &count));
+        std::remove(path);
+
+        std::sort(read.begin(), read.end(), [](auto& a, auto& b) { return a.m < b.m; });
+        for(int i = 0; i < 100; i++)
+            EXPECT_EQ(0, memcmp(&read[i], &entries[i], sizeof(hipblasGemmTuningEntry_t)));
+    }
+
+
+    // The trace layer is chosen from HIPBLAS_LAYER when the library first logs, so the calls
+    // are traced by a child process running this test with HIPBLAS_LAYER=1. The trace it
+    // writes at exit is read back with the hipblas-bench replay parser.
+    TEST(hipblas_auxiliary, traceReplay)
+    {
+        if(getenv("HIPBLAS_TEST_TRACE_CHILD"))
+        {
+            hipblasHandle_t handle;
+            CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+
+            const int             n      = 16;
+            float                 salpha = 2.5f;
+            double                dalpha = 0.5, dbeta = -1;
+            device_vector<float>  dx(n), dy(n);
+            device_vector<double> dA(n * n), dB(n * n), dC(n * n);
+            CHECK_HIP_ERROR(dx.memcheck());
+            CHECK_HIP_ERROR(dy.memcheck());
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dB.memcheck());
+            CHECK_HIP_ERROR(dC.memcheck());
+
+            CHECK_HIPBLAS_ERROR(hipblasSscal(handle, n, &salpha, dx, 1));
+            CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, n / 2, &salpha, dx, 2, dy, 1));
+            CHECK_HIPBLAS_ERROR(hipblasDgemm(handle,
+                                             HIPBLAS_OP_N,
+                                             HIPBLAS_OP_T,
+                                             n,
+                                             n / 2,
+                                             n / 4,
+                                             &dalpha,
+                                             dA,
+                                             n,
+                                             dB,
+                                             n,
+                                             &dbeta,
+                                             dC,
+                                             n));
+            CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+            return;
+        }
+
+#ifdef WIN32
+        GTEST_SKIP() << "The trace is written by a child process, only run on Linux";
+#else
+        char* exe = realpath("/proc/self/exe", nullptr);
+        ASSERT_NE(exe, nullptr);
+        std::string path    = hipblas_tempname();
+        std::string command = "HIPBLAS_TEST_TRACE_CHILD=1 HIPBLAS_LAYER=1 HIPBLAS_LOG_TRACE_PATH="
+                              + path + " " + exe
+                              + " --gtest_filter=hipblas_auxiliary.traceReplay > /dev/null";
+        free(exe);
+        ASSERT_EQ(std::system(command.c_str()), 0);
+
+        std::vector<hipblas_replay_record> records;
+        std::ifstream                      file(path);
+        for(std::string line; std::getline(file, line);)
+        {
+            hipblas_replay_record record;
+            if(hipblas_replay_parse(line, record))
+                records.push_back(record);
+        }
+        file.close();
+        std::remove(path.c_str());
+
+        // The calls are made in order on one thread, so the trace is in call order
+        ASSERT_EQ(records.size(), size_t(4));
+        const char* functions[]
+            = {"hipblasSscal", "hipblasSaxpy", "hipblasDgemm", "hipblasDestroy"};
+        for(size_t i = 0; i < records.size(); i++)
+        {
+            EXPECT_EQ(records[i].function, functions[i]);
+            EXPECT_EQ(records[i].handle, records[0].handle);
+            EXPECT_EQ(records[i].pointer_mode, HIPBLAS_POINTER_MODE_HOST);
+            if(i)
+                EXPECT_LT(records[i - 1].call, records[i].call);
+        }
+
+        using args_t = std::vector<std::pair<std::string, std::string>>;
+        const auto& x = *records[0].find("x");
+        EXPECT_EQ(records[0].args,
+                  (args_t{{"n", "16"}, {"alpha", "2.5"}, {"x", x}, {"incx", "1"}}));
+        EXPECT_EQ(records[1].args,
+                  (args_t{{"n", "8"},
+                          {"alpha", "2.5"},
+                          {"x", x},
+                          {"incx", "2"},
+                          {"y", *records[1].find("y")},
+                          {"incy", "1"}}));
+        EXPECT_NE(*records[1].find("y"), x);
+
+        // The transposes and matrix names of the backends differ, the sizes and scalars do not
+        EXPECT_EQ(records[2].integer("m", 0), 16);
+        EXPECT_EQ(records[2].integer("n", 0), 8);
+        EXPECT_EQ(records[2].integer("k", 0), 4);
+        EXPECT_EQ(records[2].integer("lda", 0), 16);
+        EXPECT_EQ(records[2].integer("ldc", 0), 16);
+        EXPECT_EQ(*records[2].find("alpha"), "0.5");
+        EXPECT_EQ(*records[2].find("beta"), "-1");
+        EXPECT_EQ(records[2].args.size(), size_t(13));
+#endif
+    }
 } // namespace
@@ -21,8 +21,10 @@
  * ************************************************************************ */
 
 #include "auxil/testing_set_get_atomics_mode.hpp"
+#include "auxil/testing_set_get_capture_mode.hpp"
 #include "auxil/testing_set_get_math_mode.hpp"
 #include "auxil/testing_set_get_pointer_mode.hpp"
+#include "auxil/testing_set_get_workspace.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +37,8 @@ namespace
         SG_POINTER,
         SG_ATOMICS,
         SG_MATH,
+        SG_WORKSPACE,
+        SG_CAPTURE,
     };
 
     // aux test template
@@ -72,6 +76,10 @@ namespace
                 return !strcmp(arg.function, "set_get_atomics_mode");
             case SG_MATH:
                 return !strcmp(arg.function, "set_get_math_mode");
+            case SG_WORKSPACE:
+                return !strcmp(arg.function, "set_get_workspace");
+            case SG_CAPTURE:
+                return !strcmp(arg.function, "set_get_capture_mode");
             }
             return false;
         }
@@ -86,6 +94,10 @@ namespace
                 testname_set_get_atomics_mode(arg, name);
             else if constexpr(AUX_TYPE == SG_MATH)
                 testname_set_get_math_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_WORKSPACE)
+                testname_set_get_workspace(arg, name);
+            else if constexpr(AUX_TYPE == SG_CAPTURE)
+                testname_set_get_capture_mode(arg, name);
 
             return std::move(name);
         }
@@ -102,6 +114,10 @@ namespace
                 testing_set_get_atomics_mode(arg);
             else if(!strcmp(arg.function, "set_get_math_mode"))
                 testing_set_get_math_mode(arg);
+            else if(!strcmp(arg.function, "set_get_workspace"))
+                testing_set_get_workspace(arg);
+            else if(!strcmp(arg.function, "set_get_capture_mode"))
+                testing_set_get_capture_mode(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -128,4 +144,18 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_math);
 
+    using set_get_workspace = aux_mode_template<aux_mode_testing, SG_WORKSPACE>;
+    TEST_P(set_get_workspace, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_workspace);
+
+    using set_get_capture = aux_mode_template<aux_mode_testing, SG_CAPTURE>;
+    TEST_P(set_get_capture, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_capture);
+
 } // namespace
@@ -21,8 +21,11 @@
  * ************************************************************************ */
 
 #include "blas3/testing_herk.hpp"
+#include "blas3/testing_herk_ex.hpp"
 #include "blas3/testing_herk_batched.hpp"
+#include "blas3/testing_herk_batched_ex.hpp"
 #include "blas3/testing_herk_strided_batched.hpp"
+#include "blas3/testing_herk_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +38,9 @@ namespace
         HERK,
         HERK_BATCHED,
         HERK_STRIDED_BATCHED,
+        HERK_EX,
+        HERK_BATCHED_EX,
+        HERK_STRIDED_BATCHED_EX,
     };
 
     // herk test template
@@ -58,7 +64,12 @@ namespace
         // Filter for which types apply to this suite
         static bool type_filter(const Arguments& arg)
         {
-            return hipblas_simple_dispatch<herk_template::template type_filter_functor>(arg);
+            // A of the _ex functions may be stored more narrowly than C
+            if constexpr(HERK_TYPE == HERK_EX || HERK_TYPE == HERK_BATCHED_EX
+                         || HERK_TYPE == HERK_STRIDED_BATCHED_EX)
+                return hipblas_syrk_ex_dispatch<herk_template::template type_filter_functor>(arg);
+            else
+                return hipblas_simple_dispatch<herk_template::template type_filter_functor>(arg);
         }
 
         // Filter for which functions apply to this suite
@@ -74,6 +85,14 @@ namespace
             case HERK_STRIDED_BATCHED:
                 return !strcmp(arg.function, "herk_strided_batched")
                        || !strcmp(arg.function, "herk_strided_batched_bad_arg");
+            case HERK_EX:
+                return !strcmp(arg.function, "herk_ex") || !strcmp(arg.function, "herk_ex_bad_arg");
+            case HERK_BATCHED_EX:
+                return !strcmp(arg.function, "herk_batched_ex")
+                       || !strcmp(arg.function, "herk_batched_ex_bad_arg");
+            case HERK_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "herk_strided_batched_ex")
+                       || !strcmp(arg.function, "herk_strided_batched_ex_bad_arg");
             }
             return false;
         }
@@ -88,6 +107,14 @@ namespace
                 testname_herk_batched(arg, name);
             else if constexpr(HERK_TYPE == HERK_STRIDED_BATCHED)
                 testname_herk_strided_batched(arg, name);
+#ifdef HIPBLAS_V2
+            else if constexpr(HERK_TYPE == HERK_EX)
+                testname_herk_ex(arg, name);
+            else if constexpr(HERK_TYPE == HERK_BATCHED_EX)
+                testname_herk_batched_ex(arg, name);
+            else if constexpr(HERK_TYPE == HERK_STRIDED_BATCHED_EX)
+                testname_herk_strided_batched_ex(arg, name);
+#endif
             return std::move(name);
         }
     };
@@ -148,4 +175,59 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(herk_strided_batched);
 
+#ifdef HIPBLAS_V2
+    // The _ex functions take C in single precision complex only
+    template <typename, typename = void>
+    struct herk_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct herk_ex_testing<T, std::enable_if_t<std::is_same_v<T, hipblasComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "herk_ex"))
+                testing_herk_ex<T>(arg);
+            else if(!strcmp(arg.function, "herk_ex_bad_arg"))
+                testing_herk_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "herk_batched_ex"))
+                testing_herk_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "herk_batched_ex_bad_arg"))
+                testing_herk_batched_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "herk_strided_batched_ex"))
+                testing_herk_strided_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "herk_strided_batched_ex_bad_arg"))
+                testing_herk_strided_batched_ex_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using herk_ex = herk_template<herk_ex_testing, HERK_EX>;
+    TEST_P(herk_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_syrk_ex_dispatch<herk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(herk_ex);
+
+    using herk_batched_ex = herk_template<herk_ex_testing, HERK_BATCHED_EX>;
+    TEST_P(herk_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_syrk_ex_dispatch<herk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(herk_batched_ex);
+
+    using herk_strided_batched_ex = herk_template<herk_ex_testing, HERK_STRIDED_BATCHED_EX>;
+    TEST_P(herk_strided_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_syrk_ex_dispatch<herk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(herk_strided_batched_ex);
+#endif
+
 } // namespace
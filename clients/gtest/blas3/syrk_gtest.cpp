@@ -21,8 +21,11 @@
  * ************************************************************************ */
 
 #include "blas3/testing_syrk.hpp"
+#include "blas3/testing_syrk_ex.hpp"
 #include "blas3/testing_syrk_batched.hpp"
+#include "blas3/testing_syrk_batched_ex.hpp"
 #include "blas3/testing_syrk_strided_batched.hpp"
+#include "blas3/testing_syrk_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +38,9 @@ namespace
         SYRK,
         SYRK_BATCHED,
         SYRK_STRIDED_BATCHED,
+        SYRK_EX,
+        SYRK_BATCHED_EX,
+        SYRK_STRIDED_BATCHED_EX,
     };
 
     // syrk test template
@@ -58,7 +64,12 @@ namespace
         // Filter for which types apply to this suite
         static bool type_filter(const Arguments& arg)
         {
-            return hipblas_simple_dispatch<syrk_template::template type_filter_functor>(arg);
+            // A of the _ex functions may be stored more narrowly than C
+            if constexpr(SYRK_TYPE == SYRK_EX || SYRK_TYPE == SYRK_BATCHED_EX
+                         || SYRK_TYPE == SYRK_STRIDED_BATCHED_EX)
+                return hipblas_syrk_ex_dispatch<syrk_template::template type_filter_functor>(arg);
+            else
+                return hipblas_simple_dispatch<syrk_template::template type_filter_functor>(arg);
         }
 
         // Filter for which functions apply to this suite
@@ -74,6 +85,14 @@ namespace
             case SYRK_STRIDED_BATCHED:
                 return !strcmp(arg.function, "syrk_strided_batched")
                        || !strcmp(arg.function, "syrk_strided_batched_bad_arg");
+            case SYRK_EX:
+                return !strcmp(arg.function, "syrk_ex") || !strcmp(arg.function, "syrk_ex_bad_arg");
+            case SYRK_BATCHED_EX:
+                return !strcmp(arg.function, "syrk_batched_ex")
+                       || !strcmp(arg.function, "syrk_batched_ex_bad_arg");
+            case SYRK_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "syrk_strided_batched_ex")
+                       || !strcmp(arg.function, "syrk_strided_batched_ex_bad_arg");
             }
             return false;
         }
@@ -88,6 +107,14 @@ namespace
                 testname_syrk_batched(arg, name);
             else if constexpr(SYRK_TYPE == SYRK_STRIDED_BATCHED)
                 testname_syrk_strided_batched(arg, name);
+#ifdef HIPBLAS_V2
+            else if constexpr(SYRK_TYPE == SYRK_EX)
+                testname_syrk_ex(arg, name);
+            else if constexpr(SYRK_TYPE == SYRK_BATCHED_EX)
+                testname_syrk_batched_ex(arg, name);
+            else if constexpr(SYRK_TYPE == SYRK_STRIDED_BATCHED_EX)
+                testname_syrk_strided_batched_ex(arg, name);
+#endif
             return std::move(name);
         }
     };
@@ -150,4 +177,59 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(syrk_strided_batched);
 
+#ifdef HIPBLAS_V2
+    // The _ex functions take C in single precision complex only
+    template <typename, typename = void>
+    struct syrk_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct syrk_ex_testing<T, std::enable_if_t<std::is_same_v<T, hipblasComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "syrk_ex"))
+                testing_syrk_ex<T>(arg);
+            else if(!strcmp(arg.function, "syrk_ex_bad_arg"))
+                testing_syrk_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syrk_batched_ex"))
+                testing_syrk_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "syrk_batched_ex_bad_arg"))
+                testing_syrk_batched_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syrk_strided_batched_ex"))
+                testing_syrk_strided_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "syrk_strided_batched_ex_bad_arg"))
+                testing_syrk_strided_batched_ex_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using syrk_ex = syrk_template<syrk_ex_testing, SYRK_EX>;
+    TEST_P(syrk_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_syrk_ex_dispatch<syrk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk_ex);
+
+    using syrk_batched_ex = syrk_template<syrk_ex_testing, SYRK_BATCHED_EX>;
+    TEST_P(syrk_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_syrk_ex_dispatch<syrk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk_batched_ex);
+
+    using syrk_strided_batched_ex = syrk_template<syrk_ex_testing, SYRK_STRIDED_BATCHED_EX>;
+    TEST_P(syrk_strided_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_syrk_ex_dispatch<syrk_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syrk_strided_batched_ex);
+#endif
+
 } // namespace
@@ -21,7 +21,9 @@
  * ************************************************************************ */
 
 #include "blas_ex/testing_gemm_batched_ex.hpp"
+#include "blas_ex/testing_gemm_epilogue_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_grouped_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +37,8 @@ namespace
         GEMM_EX,
         GEMM_BATCHED_EX,
         GEMM_STRIDED_BATCHED_EX,
+        GEMM_GROUPED_EX,
+        GEMM_EPILOGUE_EX,
     };
 
     // gemm test template
@@ -58,6 +62,11 @@ namespace
         // Filter for which types apply to this suite
         static bool type_filter(const Arguments& arg)
         {
+#ifdef HIPBLAS_V2
+            // FP8 inputs have no simple precision of their own
+            if(arg.a_type == HIP_R_8F_E4M3_FNUZ || arg.a_type == HIP_R_8F_E5M2_FNUZ)
+                return hipblas_gemm_dispatch<gemm_ex_template::template type_filter_functor>(arg);
+#endif
             return hipblas_simple_dispatch<gemm_ex_template::template type_filter_functor>(arg);
         }
 
@@ -74,6 +83,12 @@ namespace
             case GEMM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "gemm_strided_batched_ex")
                        || !strcmp(arg.function, "gemm_strided_batched_ex_bad_arg");
+            case GEMM_GROUPED_EX:
+                return !strcmp(arg.function, "gemm_grouped_ex")
+                       || !strcmp(arg.function, "gemm_grouped_ex_bad_arg");
+            case GEMM_EPILOGUE_EX:
+                return !strcmp(arg.function, "gemm_epilogue_ex")
+                       || !strcmp(arg.function, "gemm_epilogue_ex_bad_arg");
             }
             return false;
         }
@@ -88,6 +103,12 @@ namespace
                 testname_gemm_batched_ex(arg, name);
             else if constexpr(GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_EX)
                 testname_gemm_strided_batched_ex(arg, name);
+#ifdef HIPBLAS_V2
+            else if constexpr(GEMM_EX_TYPE == GEMM_GROUPED_EX)
+                testname_gemm_grouped_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_EPILOGUE_EX)
+                testname_gemm_epilogue_ex(arg, name);
+#endif
             return std::move(name);
         }
     };
@@ -126,6 +147,16 @@ namespace
                 testing_gemm_strided_batched_ex<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_strided_batched_ex_bad_arg"))
                 testing_gemm_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+#ifdef HIPBLAS_V2
+            else if(!strcmp(arg.function, "gemm_grouped_ex"))
+                testing_gemm_grouped_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_ex_bad_arg"))
+                testing_gemm_grouped_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_epilogue_ex"))
+                testing_gemm_epilogue_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_epilogue_ex_bad_arg"))
+                testing_gemm_epilogue_ex_bad_arg<Ti, To, Tc>(arg);
+#endif
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -155,4 +186,22 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_ex);
 
+#ifdef HIPBLAS_V2
+    using gemm_grouped_ex = gemm_ex_template<gemm_ex_testing, GEMM_GROUPED_EX>;
+    TEST_P(gemm_grouped_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_ex);
+
+    using gemm_epilogue_ex = gemm_ex_template<gemm_ex_testing, GEMM_EPILOGUE_EX>;
+    TEST_P(gemm_epilogue_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_epilogue_ex);
+#endif
+
 } // namespace
@@ -270,6 +270,8 @@ bool hipblas_client_global_filters(const Arguments& args)
 
 #ifdef __HIP_PLATFORM_NVCC__
     static constexpr hipblas_backend backend = hipblas_backend::NVIDIA;
+#elif defined(__HIP_PLATFORM_HOST__)
+    static constexpr hipblas_backend backend = hipblas_backend::HOST;
 #else
     static constexpr hipblas_backend   backend = hipblas_backend::AMD;
 #endif
@@ -291,6 +293,14 @@ bool hipblas_client_global_filters(const Arguments& args)
     if(!(args.backend_flags & backend))
         return false;
 
+#ifdef __HIP_PLATFORM_HOST__
+    // the host backend has no half, bfloat16 or integer precision routines
+    for(hipblasDatatype_t type : {args.a_type, args.b_type, args.c_type, args.compute_type})
+        if(type == HIPBLAS_R_16F || type == HIPBLAS_R_16B || type == HIPBLAS_R_8I
+           || type == HIPBLAS_R_32I)
+            return false;
+#endif
+
     if(args.gpu_arch[0] && !gpu_arch_match(gpu_arch, args.gpu_arch))
         return false;
 
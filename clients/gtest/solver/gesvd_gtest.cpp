@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "solver/testing_gesvd.hpp"
+#include "solver/testing_gesvd_batched.hpp"
+#include "solver/testing_gesvd_strided_batched.hpp"
+#include "solver/testing_gesvdj.hpp"
+#include "solver/testing_gesvdj_batched.hpp"
+#include "solver/testing_gesvdj_strided_batched.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible gesvd test cases
+    enum gesvd_test_type
+    {
+        GESVD,
+        GESVD_BATCHED,
+        GESVD_STRIDED_BATCHED,
+        GESVDJ,
+        GESVDJ_BATCHED,
+        GESVDJ_STRIDED_BATCHED,
+    };
+
+    //gesvd test template
+    template <template <typename...> class FILTER, gesvd_test_type GESVD_TYPE>
+    struct gesvd_template : HipBLAS_Test<gesvd_template<FILTER, GESVD_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<gesvd_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GESVD_TYPE)
+            {
+            case GESVD:
+                return !strcmp(arg.function, "gesvd") || !strcmp(arg.function, "gesvd_bad_arg");
+            case GESVD_BATCHED:
+                return !strcmp(arg.function, "gesvd_batched")
+                       || !strcmp(arg.function, "gesvd_batched_bad_arg");
+            case GESVD_STRIDED_BATCHED:
+                return !strcmp(arg.function, "gesvd_strided_batched")
+                       || !strcmp(arg.function, "gesvd_strided_batched_bad_arg");
+            case GESVDJ:
+                return !strcmp(arg.function, "gesvdj") || !strcmp(arg.function, "gesvdj_bad_arg");
+            case GESVDJ_BATCHED:
+                return !strcmp(arg.function, "gesvdj_batched")
+                       || !strcmp(arg.function, "gesvdj_batched_bad_arg");
+            case GESVDJ_STRIDED_BATCHED:
+                return !strcmp(arg.function, "gesvdj_strided_batched")
+                       || !strcmp(arg.function, "gesvdj_strided_batched_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(GESVD_TYPE == GESVD)
+                testname_gesvd(arg, name);
+            else if constexpr(GESVD_TYPE == GESVD_BATCHED)
+                testname_gesvd_batched(arg, name);
+            else if constexpr(GESVD_TYPE == GESVD_STRIDED_BATCHED)
+                testname_gesvd_strided_batched(arg, name);
+            else if constexpr(GESVD_TYPE == GESVDJ)
+                testname_gesvdj(arg, name);
+            else if constexpr(GESVD_TYPE == GESVDJ_BATCHED)
+                testname_gesvdj_batched(arg, name);
+            else if constexpr(GESVD_TYPE == GESVDJ_STRIDED_BATCHED)
+                testname_gesvdj_strided_batched(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct gesvd_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct gesvd_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gesvd"))
+                testing_gesvd<T>(arg);
+            else if(!strcmp(arg.function, "gesvd_bad_arg"))
+                testing_gesvd_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gesvd_batched"))
+                testing_gesvd_batched<T>(arg);
+            else if(!strcmp(arg.function, "gesvd_batched_bad_arg"))
+                testing_gesvd_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gesvd_strided_batched"))
+                testing_gesvd_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "gesvd_strided_batched_bad_arg"))
+                testing_gesvd_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gesvdj"))
+                testing_gesvdj<T>(arg);
+            else if(!strcmp(arg.function, "gesvdj_bad_arg"))
+                testing_gesvdj_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gesvdj_batched"))
+                testing_gesvdj_batched<T>(arg);
+            else if(!strcmp(arg.function, "gesvdj_batched_bad_arg"))
+                testing_gesvdj_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gesvdj_strided_batched"))
+                testing_gesvdj_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "gesvdj_strided_batched_bad_arg"))
+                testing_gesvdj_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gesvd = gesvd_template<gesvd_testing, GESVD>;
+    TEST_P(gesvd, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesvd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesvd);
+
+    using gesvd_batched = gesvd_template<gesvd_testing, GESVD_BATCHED>;
+    TEST_P(gesvd_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesvd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesvd_batched);
+
+    using gesvd_strided_batched = gesvd_template<gesvd_testing, GESVD_STRIDED_BATCHED>;
+    TEST_P(gesvd_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesvd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesvd_strided_batched);
+
+    using gesvdj = gesvd_template<gesvd_testing, GESVDJ>;
+    TEST_P(gesvdj, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesvd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesvdj);
+
+    using gesvdj_batched = gesvd_template<gesvd_testing, GESVDJ_BATCHED>;
+    TEST_P(gesvdj_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesvd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesvdj_batched);
+
+    using gesvdj_strided_batched = gesvd_template<gesvd_testing, GESVDJ_STRIDED_BATCHED>;
+    TEST_P(gesvdj_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesvd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesvdj_strided_batched);
+
+} // namespace
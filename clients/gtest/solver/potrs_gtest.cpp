@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "solver/testing_potrs.hpp"
+#include "solver/testing_potrs_batched.hpp"
+#include "solver/testing_potrs_strided_batched.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible potrs test cases
+    enum potrs_test_type
+    {
+        POTRS,
+        POTRS_BATCHED,
+        POTRS_STRIDED_BATCHED,
+    };
+
+    //potrs test template
+    template <template <typename...> class FILTER, potrs_test_type POTRS_TYPE>
+    struct potrs_template : HipBLAS_Test<potrs_template<FILTER, POTRS_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<potrs_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(POTRS_TYPE)
+            {
+            case POTRS:
+                return !strcmp(arg.function, "potrs") || !strcmp(arg.function, "potrs_bad_arg");
+            case POTRS_BATCHED:
+                return !strcmp(arg.function, "potrs_batched")
+                       || !strcmp(arg.function, "potrs_batched_bad_arg");
+            case POTRS_STRIDED_BATCHED:
+                return !strcmp(arg.function, "potrs_strided_batched")
+                       || !strcmp(arg.function, "potrs_strided_batched_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(POTRS_TYPE == POTRS)
+                testname_potrs(arg, name);
+            else if constexpr(POTRS_TYPE == POTRS_BATCHED)
+                testname_potrs_batched(arg, name);
+            else if constexpr(POTRS_TYPE == POTRS_STRIDED_BATCHED)
+                testname_potrs_strided_batched(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct potrs_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct potrs_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "potrs"))
+                testing_potrs<T>(arg);
+            else if(!strcmp(arg.function, "potrs_bad_arg"))
+                testing_potrs_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "potrs_batched"))
+                testing_potrs_batched<T>(arg);
+            else if(!strcmp(arg.function, "potrs_batched_bad_arg"))
+                testing_potrs_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "potrs_strided_batched"))
+                testing_potrs_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "potrs_strided_batched_bad_arg"))
+                testing_potrs_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using potrs = potrs_template<potrs_testing, POTRS>;
+    TEST_P(potrs, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<potrs_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(potrs);
+
+    using potrs_batched = potrs_template<potrs_testing, POTRS_BATCHED>;
+    TEST_P(potrs_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<potrs_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(potrs_batched);
+
+    using potrs_strided_batched = potrs_template<potrs_testing, POTRS_STRIDED_BATCHED>;
+    TEST_P(potrs_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<potrs_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(potrs_strided_batched);
+
+} // namespace
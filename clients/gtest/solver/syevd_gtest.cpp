@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "solver/testing_syevd.hpp"
+#include "solver/testing_syevd_batched.hpp"
+#include "solver/testing_syevd_strided_batched.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible syevd test cases
+    enum syevd_test_type
+    {
+        SYEVD,
+        SYEVD_BATCHED,
+        SYEVD_STRIDED_BATCHED,
+    };
+
+    //syevd test template
+    template <template <typename...> class FILTER, syevd_test_type SYEVD_TYPE>
+    struct syevd_template : HipBLAS_Test<syevd_template<FILTER, SYEVD_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<syevd_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(SYEVD_TYPE)
+            {
+            case SYEVD:
+                return !strcmp(arg.function, "syevd") || !strcmp(arg.function, "syevd_bad_arg");
+            case SYEVD_BATCHED:
+                return !strcmp(arg.function, "syevd_batched")
+                       || !strcmp(arg.function, "syevd_batched_bad_arg");
+            case SYEVD_STRIDED_BATCHED:
+                return !strcmp(arg.function, "syevd_strided_batched")
+                       || !strcmp(arg.function, "syevd_strided_batched_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(SYEVD_TYPE == SYEVD)
+                testname_syevd(arg, name);
+            else if constexpr(SYEVD_TYPE == SYEVD_BATCHED)
+                testname_syevd_batched(arg, name);
+            else if constexpr(SYEVD_TYPE == SYEVD_STRIDED_BATCHED)
+                testname_syevd_strided_batched(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct syevd_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct syevd_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "syevd"))
+                testing_syevd<T>(arg);
+            else if(!strcmp(arg.function, "syevd_bad_arg"))
+                testing_syevd_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syevd_batched"))
+                testing_syevd_batched<T>(arg);
+            else if(!strcmp(arg.function, "syevd_batched_bad_arg"))
+                testing_syevd_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "syevd_strided_batched"))
+                testing_syevd_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "syevd_strided_batched_bad_arg"))
+                testing_syevd_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using syevd = syevd_template<syevd_testing, SYEVD>;
+    TEST_P(syevd, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<syevd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syevd);
+
+    using syevd_batched = syevd_template<syevd_testing, SYEVD_BATCHED>;
+    TEST_P(syevd_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<syevd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syevd_batched);
+
+    using syevd_strided_batched = syevd_template<syevd_testing, SYEVD_STRIDED_BATCHED>;
+    TEST_P(syevd_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<syevd_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syevd_strided_batched);
+
+} // namespace
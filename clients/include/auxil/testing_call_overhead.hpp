@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasCallOverheadModel = ArgumentModel<e_a_type, e_transA, e_transB>;
+
+inline void testname_call_overhead(const Arguments& arg, std::string& name)
+{
+    hipblasCallOverheadModel{}.test_name(arg, name);
+}
+
+// Host time of a gemm call which returns before launching anything, once with valid arguments
+// and once with an invalid transA. This is the cost of the hipBLAS layer and of the argument
+// checks of the backend, without any kernel.
+template <typename T>
+void testing_call_overhead(const Arguments& arg)
+{
+    bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGemmFn = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    hipblasOperation_t bad_op = hipblasOperation_t(HIPBLAS_OP_C + 1);
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto call = [&](hipblasOperation_t op) {
+        return hipblasGemmFn(
+            handle, op, transB, 0, 0, 0, &h_alpha, nullptr, 1, nullptr, 1, &h_beta, nullptr, 1);
+    };
+
+    CHECK_HIPBLAS_ERROR(call(transA));
+    EXPECT_HIPBLAS_STATUS(call(bad_op), HIPBLAS_STATUS_INVALID_ENUM);
+
+    if(arg.timing)
+    {
+        double quick_return_time = 0.0, invalid_enum_time = 0.0;
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                quick_return_time = get_time_us();
+
+            call(transA);
+        }
+        quick_return_time = get_time_us() - quick_return_time;
+
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                invalid_enum_time = get_time_us();
+
+            call(bad_op);
+        }
+        invalid_enum_time = get_time_us() - invalid_enum_time;
+
+        // The invalid call is reported with transA = X
+        Arguments bad_arg = arg;
+        bad_arg.transA    = 'X';
+
+        hipblasCallOverheadModel{}.log_args<T>(
+            std::cout, arg, quick_return_time, ArgumentLogging::NA_value);
+        hipblasCallOverheadModel{}.log_args<T>(
+            std::cout, bad_arg, invalid_enum_time, ArgumentLogging::NA_value);
+    }
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_capture_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+struct capture_mode_trsm_data
+{
+    float*          A;
+    float*          B;
+    hipblasStatus_t status;
+};
+
+// Calls made by hipblasReserveWorkspace to size the workspace
+inline void capture_mode_trsm_calls(hipblasHandle_t handle, void* userData)
+{
+    auto* data = static_cast<capture_mode_trsm_data*>(userData);
+
+    float alpha  = 1.0f;
+    data->status = hipblasStrsm(handle,
+                                HIPBLAS_SIDE_LEFT,
+                                HIPBLAS_FILL_MODE_LOWER,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_DIAG_UNIT,
+                                64,
+                                64,
+                                &alpha,
+                                data->A,
+                                64,
+                                data->B,
+                                64);
+}
+
+void testing_set_get_capture_mode(const Arguments& arg)
+{
+    hipblasCaptureMode_t mode = HIPBLAS_CAPTURE_MODE_DEFAULT;
+    size_t               size = 0;
+    hipblasLocalHandle   handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetCaptureMode(nullptr, HIPBLAS_CAPTURE_MODE_SAFE),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetCaptureMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetCaptureMode(handle, hipblasCaptureMode_t(-1)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetCaptureMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_CAPTURE_MODE_DEFAULT);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE));
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_CAPTURE_MODE_SAFE);
+
+    // Outside of a capture, calls in safe mode behave as usual
+    device_vector<float> dA(64 * 64);
+    device_vector<float> dB(64 * 64);
+    CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(float) * 64 * 64));
+    CHECK_HIP_ERROR(hipMemset(dB, 0, sizeof(float) * 64 * 64));
+
+    capture_mode_trsm_data data{dA, dB, HIPBLAS_STATUS_SUCCESS};
+
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_HIPBLAS_STATUS(hipblasReserveWorkspace(handle, capture_mode_trsm_calls, &data, &size),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    EXPECT_HIPBLAS_STATUS(hipblasReserveWorkspace(handle, nullptr, &data, &size),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasReserveWorkspace(handle, capture_mode_trsm_calls, &data, &size));
+    CHECK_HIPBLAS_ERROR(data.status);
+
+    // The reserved workspace is enough for the calls to run in safe mode
+    capture_mode_trsm_calls(handle, &data);
+    CHECK_HIPBLAS_ERROR(data.status);
+#endif
+
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_CAPTURE_MODE_DEFAULT);
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_workspace(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_workspace(const Arguments& arg)
+{
+    void*              workspace = nullptr;
+    size_t             size      = 0;
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspace(nullptr, nullptr, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspace(nullptr, &workspace, &size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspace(handle, nullptr, 1024),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspace(handle, nullptr, &size),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspace(handle, &workspace, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetRequiredWorkspaceSize(nullptr, nullptr, &size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetRequiredWorkspaceSize(handle, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Nothing has been called with the handle yet
+    CHECK_HIPBLAS_ERROR(hipblasGetRequiredWorkspaceSize(handle, nullptr, &size));
+    EXPECT_EQ(size, size_t(0));
+    CHECK_HIPBLAS_ERROR(hipblasGetRequiredWorkspaceSize(handle, "hipblasStrsm", &size));
+    EXPECT_EQ(size, size_t(0));
+
+    size_t              bytes = 1 << 20;
+    device_vector<char> memory(bytes);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, memory, bytes));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspace(handle, &workspace, &size));
+
+    EXPECT_EQ(workspace, (void*)memory);
+    EXPECT_EQ(size, bytes);
+
+    // Return to library managed memory before memory is freed
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspace(handle, &workspace, &size));
+
+    EXPECT_EQ(workspace, nullptr);
+}
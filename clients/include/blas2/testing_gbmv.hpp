@@ -52,6 +52,8 @@ void testing_gbmv_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGbmvFn = FORTRAN ? hipblasGbmv<T, true> : hipblasGbmv<T, false>;
+    auto hipblasGbmvFn_64
+        = arg.api == FORTRAN_64 ? hipblasGbmv_64<T, true> : hipblasGbmv_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -91,136 +93,107 @@ void testing_gbmv_bad_arg(const Arguments& arg)
         device_vector<T> dx(N * incx);
         device_vector<T> dy(M * incy);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGbmvFn(nullptr, transA, M, N, KL, KU, alpha, dA, lda, dx, incx, beta, dy, incy),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvFn(handle,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            M,
-                                            N,
-                                            KL,
-                                            KU,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dx,
-                                            incx,
-                                            beta,
-                                            dy,
-                                            incy),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGbmvFn,
+                    (nullptr, transA, M, N, KL, KU, alpha, dA, lda, dx, incx, beta, dy, incy));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGbmvFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     alpha,
+                     dA,
+                     lda,
+                     dx,
+                     incx,
+                     beta,
+                     dy,
+                     incy));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGbmvFn(
-                    handle, transA, M, N, KL, KU, nullptr, dA, lda, dx, incx, beta, dy, incy),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGbmvFn(
-                    handle, transA, M, N, KL, KU, alpha, dA, lda, dx, incx, nullptr, dy, incy),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGbmvFn,
+                        (handle, transA, M, N, KL, KU, nullptr, dA, lda, dx, incx, beta, dy, incy));
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasGbmvFn,
+                (handle, transA, M, N, KL, KU, alpha, dA, lda, dx, incx, nullptr, dy, incy));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(hipblasGbmvFn(handle,
-                                                    transA,
-                                                    M,
-                                                    N,
-                                                    KL,
-                                                    KU,
-                                                    alpha,
-                                                    nullptr,
-                                                    lda,
-                                                    dx,
-                                                    incx,
-                                                    beta,
-                                                    dy,
-                                                    incy),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGbmvFn(handle,
-                                                    transA,
-                                                    M,
-                                                    N,
-                                                    KL,
-                                                    KU,
-                                                    alpha,
-                                                    dA,
-                                                    lda,
-                                                    nullptr,
-                                                    incx,
-                                                    beta,
-                                                    dy,
-                                                    incy),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGbmvFn(handle,
-                                                    transA,
-                                                    M,
-                                                    N,
-                                                    KL,
-                                                    KU,
-                                                    alpha,
-                                                    dA,
-                                                    lda,
-                                                    dx,
-                                                    incx,
-                                                    beta,
-                                                    nullptr,
-                                                    incy),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGbmvFn,
+                    (handle, transA, M, N, KL, KU, alpha, nullptr, lda, dx, incx, beta, dy, incy));
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGbmvFn,
+                    (handle, transA, M, N, KL, KU, alpha, dA, lda, nullptr, incx, beta, dy, incy));
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGbmvFn,
+                    (handle, transA, M, N, KL, KU, alpha, dA, lda, dx, incx, beta, nullptr, incy));
             }
 
             // With alpha == 0 can have x nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGbmvFn(
-                handle, transA, M, N, KL, KU, zero, nullptr, lda, nullptr, incx, beta, dy, incy));
+            DAPI_CHECK(
+                hipblasGbmvFn,
+                (handle, transA, M, N, KL, KU, zero, nullptr, lda, nullptr, incx, beta, dy, incy));
 
             // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGbmvFn(handle,
-                                              transA,
-                                              M,
-                                              N,
-                                              KL,
-                                              KU,
-                                              zero,
-                                              nullptr,
-                                              lda,
-                                              nullptr,
-                                              incx,
-                                              one,
-                                              nullptr,
-                                              incy));
+            DAPI_CHECK(hipblasGbmvFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        KL,
+                        KU,
+                        zero,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        incx,
+                        one,
+                        nullptr,
+                        incy));
         }
 
         // With M == 0 || N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGbmvFn(handle,
-                                          transA,
-                                          0,
-                                          N,
-                                          KL,
-                                          KU,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          incx,
-                                          nullptr,
-                                          nullptr,
-                                          incy));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvFn(handle,
-                                          transA,
-                                          M,
-                                          0,
-                                          KL,
-                                          KU,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          incx,
-                                          nullptr,
-                                          nullptr,
-                                          incy));
+        DAPI_CHECK(hipblasGbmvFn,
+                   (handle,
+                    transA,
+                    0,
+                    N,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy));
+        DAPI_CHECK(hipblasGbmvFn,
+                   (handle,
+                    transA,
+                    M,
+                    0,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy));
     }
 }
 
@@ -229,6 +202,8 @@ void testing_gbmv(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGbmvFn = FORTRAN ? hipblasGbmv<T, true> : hipblasGbmv<T, false>;
+    auto hipblasGbmvFn_64
+        = arg.api == FORTRAN_64 ? hipblasGbmv_64<T, true> : hipblasGbmv_64<T, false>;
 
     int M    = arg.M;
     int N    = arg.N;
@@ -262,22 +237,22 @@ void testing_gbmv(const Arguments& arg)
     bool invalid_size = M < 0 || N < 0 || lda < KL + KU + 1 || !incx || !incy || KL < 0 || KU < 0;
     if(invalid_size || !M || !N)
     {
-        hipblasStatus_t actual = hipblasGbmvFn(handle,
-                                               transA,
-                                               M,
-                                               N,
-                                               KL,
-                                               KU,
-                                               nullptr,
-                                               nullptr,
-                                               lda,
-                                               nullptr,
-                                               incx,
-                                               nullptr,
-                                               nullptr,
-                                               incy);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasGbmvFn,
+                    (handle,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     incx,
+                     nullptr,
+                     nullptr,
+                     incy));
         return;
     }
 
@@ -327,15 +302,16 @@ void testing_gbmv(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvFn(
-            handle, transA, M, N, KL, KU, (T*)&h_alpha, dA, lda, dx, incx, (T*)&h_beta, dy, incy));
+        DAPI_CHECK(
+            hipblasGbmvFn,
+            (handle, transA, M, N, KL, KU, (T*)&h_alpha, dA, lda, dx, incx, (T*)&h_beta, dy, incy));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_host.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvFn(
-            handle, transA, M, N, KL, KU, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+        DAPI_CHECK(hipblasGbmvFn,
+                   (handle, transA, M, N, KL, KU, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_device.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
 
@@ -386,8 +362,9 @@ void testing_gbmv(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGbmvFn(
-                handle, transA, M, N, KL, KU, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+            DAPI_CHECK(
+                hipblasGbmvFn,
+                (handle, transA, M, N, KL, KU, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
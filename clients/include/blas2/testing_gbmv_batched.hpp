@@ -54,6 +54,8 @@ void testing_gbmv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGbmvBatchedFn
         = FORTRAN ? hipblasGbmvBatched<T, true> : hipblasGbmvBatched<T, false>;
+    auto hipblasGbmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGbmvBatched_64<T, true> : hipblasGbmvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -94,205 +96,217 @@ void testing_gbmv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dx(N, incx, batch_count);
         device_batch_vector<T> dy(M, incy, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvBatchedFn(nullptr,
-                                                   transA,
-                                                   M,
-                                                   N,
-                                                   KL,
-                                                   KU,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvBatchedFn(handle,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   M,
-                                                   N,
-                                                   KL,
-                                                   KU,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   dx,
-                                                   incx,
-                                                   beta,
-                                                   dy,
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvBatchedFn(handle,
-                                                   transA,
-                                                   M,
-                                                   N,
-                                                   KL,
-                                                   KU,
-                                                   nullptr,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvBatchedFn(handle,
-                                                   transA,
-                                                   M,
-                                                   N,
-                                                   KL,
-                                                   KU,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   nullptr,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGbmvBatchedFn,
+                    (nullptr,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGbmvBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     alpha,
+                     dA,
+                     lda,
+                     dx,
+                     incx,
+                     beta,
+                     dy,
+                     incy,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGbmvBatchedFn,
+                    (handle,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     nullptr,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGbmvBatchedFn,
+                    (handle,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     nullptr,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasGbmvBatchedFn(handle,
-                                                       transA,
-                                                       M,
-                                                       N,
-                                                       KL,
-                                                       KU,
-                                                       alpha,
-                                                       nullptr,
-                                                       lda,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGbmvBatchedFn(handle,
-                                                       transA,
-                                                       M,
-                                                       N,
-                                                       KL,
-                                                       KU,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       nullptr,
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGbmvBatchedFn(handle,
-                                                       transA,
-                                                       M,
-                                                       N,
-                                                       KL,
-                                                       KU,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       nullptr,
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGbmvBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         KL,
+                         KU,
+                         alpha,
+                         nullptr,
+                         lda,
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGbmvBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         KL,
+                         KU,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         nullptr,
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGbmvBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         KL,
+                         KU,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         nullptr,
+                         incy,
+                         batch_count));
         }
 
         // With M == 0 || N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                 transA,
-                                                 0,
-                                                 N,
-                                                 KL,
-                                                 KU,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 nullptr,
-                                                 nullptr,
-                                                 incy,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 0,
-                                                 KL,
-                                                 KU,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 nullptr,
-                                                 nullptr,
-                                                 incy,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 N,
-                                                 KL,
-                                                 KU,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 nullptr,
-                                                 nullptr,
-                                                 incy,
-                                                 0));
+        DAPI_CHECK(hipblasGbmvBatchedFn,
+                   (handle,
+                    transA,
+                    0,
+                    N,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    batch_count));
+        DAPI_CHECK(hipblasGbmvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    0,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    batch_count));
+        DAPI_CHECK(hipblasGbmvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    0));
 
         // With alpha == 0 can have x nullptr
-        CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 N,
-                                                 KL,
-                                                 KU,
-                                                 zero,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGbmvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    zero,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-        CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 N,
-                                                 KL,
-                                                 KU,
-                                                 zero,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 one,
-                                                 nullptr,
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGbmvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    zero,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    one,
+                    nullptr,
+                    incy,
+                    batch_count));
     }
 }
 
@@ -302,6 +316,8 @@ void testing_gbmv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGbmvBatchedFn
         = FORTRAN ? hipblasGbmvBatched<T, true> : hipblasGbmvBatched<T, false>;
+    auto hipblasGbmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGbmvBatched_64<T, true> : hipblasGbmvBatched_64<T, false>;
 
     int M           = arg.M;
     int N           = arg.N;
@@ -337,23 +353,23 @@ void testing_gbmv_batched(const Arguments& arg)
                         || KL < 0 || KU < 0;
     if(invalid_size || !M || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasGbmvBatchedFn(handle,
-                                                      transA,
-                                                      M,
-                                                      N,
-                                                      KL,
-                                                      KU,
-                                                      nullptr,
-                                                      nullptr,
-                                                      lda,
-                                                      nullptr,
-                                                      incx,
-                                                      nullptr,
-                                                      nullptr,
-                                                      incy,
-                                                      batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasGbmvBatchedFn,
+                    (handle,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     incx,
+                     nullptr,
+                     nullptr,
+                     incy,
+                     batch_count));
         return;
     }
 
@@ -403,41 +419,43 @@ void testing_gbmv_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 N,
-                                                 KL,
-                                                 KU,
-                                                 (T*)&h_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 (T*)&h_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGbmvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    (T*)&h_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    (T*)&h_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_host.transfer_from(dy));
         CHECK_HIP_ERROR(dy.transfer_from(hy));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 N,
-                                                 KL,
-                                                 KU,
-                                                 d_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 d_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGbmvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    d_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    d_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
@@ -480,21 +498,22 @@ void testing_gbmv_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGbmvBatchedFn(handle,
-                                                     transA,
-                                                     M,
-                                                     N,
-                                                     KL,
-                                                     KU,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     d_beta,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGbmvBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        KL,
+                        KU,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        dx.ptr_on_device(),
+                        incx,
+                        d_beta,
+                        dy.ptr_on_device(),
+                        incy,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -55,6 +55,9 @@ void testing_gbmv_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGbmvStridedBatchedFn
         = FORTRAN ? hipblasGbmvStridedBatched<T, true> : hipblasGbmvStridedBatched<T, false>;
+    auto hipblasGbmvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGbmvStridedBatched_64<T, true>
+                                              : hipblasGbmvStridedBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -99,242 +102,253 @@ void testing_gbmv_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dx(stridex * batch_count);
         device_vector<T> dy(stridey * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvStridedBatchedFn(nullptr,
-                                                          transA,
-                                                          M,
-                                                          N,
-                                                          KL,
-                                                          KU,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          beta,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGbmvStridedBatchedFn(handle,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        M,
-                                        N,
-                                        KL,
-                                        KU,
-                                        alpha,
-                                        dA,
-                                        lda,
-                                        strideA,
-                                        dx,
-                                        incx,
-                                        stridex,
-                                        beta,
-                                        dy,
-                                        incy,
-                                        stridey,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvStridedBatchedFn(handle,
-                                                          transA,
-                                                          M,
-                                                          N,
-                                                          KL,
-                                                          KU,
-                                                          nullptr,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          beta,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasGbmvStridedBatchedFn(handle,
-                                                          transA,
-                                                          M,
-                                                          N,
-                                                          KL,
-                                                          KU,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          nullptr,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGbmvStridedBatchedFn,
+                    (nullptr,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     beta,
+                     dy,
+                     incy,
+                     stridey,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGbmvStridedBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     beta,
+                     dy,
+                     incy,
+                     stridey,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGbmvStridedBatchedFn,
+                    (handle,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     nullptr,
+                     dA,
+                     lda,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     beta,
+                     dy,
+                     incy,
+                     stridey,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGbmvStridedBatchedFn,
+                    (handle,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     nullptr,
+                     dy,
+                     incy,
+                     stridey,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasGbmvStridedBatchedFn(handle,
-                                                              transA,
-                                                              M,
-                                                              N,
-                                                              KL,
-                                                              KU,
-                                                              alpha,
-                                                              nullptr,
-                                                              lda,
-                                                              strideA,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              beta,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGbmvStridedBatchedFn(handle,
-                                                              transA,
-                                                              M,
-                                                              N,
-                                                              KL,
-                                                              KU,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              nullptr,
-                                                              incx,
-                                                              stridex,
-                                                              beta,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGbmvStridedBatchedFn(handle,
-                                                              transA,
-                                                              M,
-                                                              N,
-                                                              KL,
-                                                              KU,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              beta,
-                                                              nullptr,
-                                                              incy,
-                                                              stridey,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGbmvStridedBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         KL,
+                         KU,
+                         alpha,
+                         nullptr,
+                         lda,
+                         strideA,
+                         dx,
+                         incx,
+                         stridex,
+                         beta,
+                         dy,
+                         incy,
+                         stridey,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGbmvStridedBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         KL,
+                         KU,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         nullptr,
+                         incx,
+                         stridex,
+                         beta,
+                         dy,
+                         incy,
+                         stridey,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGbmvStridedBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         KL,
+                         KU,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         dx,
+                         incx,
+                         stridex,
+                         beta,
+                         nullptr,
+                         incy,
+                         stridey,
+                         batch_count));
         }
 
         // With M == 0 || N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                        transA,
-                                                        0,
-                                                        N,
-                                                        KL,
-                                                        KU,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        0,
-                                                        KL,
-                                                        KU,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        KL,
-                                                        KU,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        0));
+        DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    0,
+                    N,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    stridey,
+                    batch_count));
+        DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    0,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    stridey,
+                    batch_count));
+        DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    stridey,
+                    0));
 
         // With alpha == 0 can have x nullptr
-        CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        KL,
-                                                        KU,
-                                                        zero,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        beta,
-                                                        dy,
-                                                        incy,
-                                                        stridey,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    zero,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    beta,
+                    dy,
+                    incy,
+                    stridey,
+                    batch_count));
 
         // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-        CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        KL,
-                                                        KU,
-                                                        zero,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        one,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    zero,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    one,
+                    nullptr,
+                    incy,
+                    stridey,
+                    batch_count));
     }
 }
 
@@ -344,6 +358,9 @@ void testing_gbmv_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGbmvStridedBatchedFn
         = FORTRAN ? hipblasGbmvStridedBatched<T, true> : hipblasGbmvStridedBatched<T, false>;
+    auto hipblasGbmvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGbmvStridedBatched_64<T, true>
+                                              : hipblasGbmvStridedBatched_64<T, false>;
 
     int    M            = arg.M;
     int    N            = arg.N;
@@ -392,26 +409,26 @@ void testing_gbmv_strided_batched(const Arguments& arg)
                         || batch_count < 0;
     if(invalid_size || !M || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasGbmvStridedBatchedFn(handle,
-                                                             transA,
-                                                             M,
-                                                             N,
-                                                             KL,
-                                                             KU,
-                                                             nullptr,
-                                                             nullptr,
-                                                             lda,
-                                                             stride_A,
-                                                             nullptr,
-                                                             incx,
-                                                             stride_x,
-                                                             nullptr,
-                                                             nullptr,
-                                                             incy,
-                                                             stride_y,
-                                                             batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasGbmvStridedBatchedFn,
+                    (handle,
+                     transA,
+                     M,
+                     N,
+                     KL,
+                     KU,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     stride_A,
+                     nullptr,
+                     incx,
+                     stride_x,
+                     nullptr,
+                     nullptr,
+                     incy,
+                     stride_y,
+                     batch_count));
         return;
     }
 
@@ -465,47 +482,49 @@ void testing_gbmv_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        KL,
-                                                        KU,
-                                                        (T*)&h_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dx,
-                                                        incx,
-                                                        stride_x,
-                                                        (T*)&h_beta,
-                                                        dy,
-                                                        incy,
-                                                        stride_y,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    (T*)&h_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dx,
+                    incx,
+                    stride_x,
+                    (T*)&h_beta,
+                    dy,
+                    incy,
+                    stride_y,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_host.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        KL,
-                                                        KU,
-                                                        d_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dx,
-                                                        incx,
-                                                        stride_x,
-                                                        d_beta,
-                                                        dy,
-                                                        incy,
-                                                        stride_y,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    KL,
+                    KU,
+                    d_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dx,
+                    incx,
+                    stride_x,
+                    d_beta,
+                    dy,
+                    incy,
+                    stride_y,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_device.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
 
@@ -559,24 +578,25 @@ void testing_gbmv_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                            transA,
-                                                            M,
-                                                            N,
-                                                            KL,
-                                                            KU,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            d_beta,
-                                                            dy,
-                                                            incy,
-                                                            stride_y,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGbmvStridedBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        KL,
+                        KU,
+                        d_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        dx,
+                        incx,
+                        stride_x,
+                        d_beta,
+                        dy,
+                        incy,
+                        stride_y,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -43,6 +43,8 @@ void testing_gemv_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemvFn = FORTRAN ? hipblasGemv<T, true> : hipblasGemv<T, false>;
+    auto hipblasGemvFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemv_64<T, true> : hipblasGemv_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -80,63 +82,64 @@ void testing_gemv_bad_arg(const Arguments& arg)
         device_vector<T> dx(N * incx);
         device_vector<T> dy(M * incy);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGemvFn(nullptr, transA, M, N, alpha, dA, lda, dx, incx, beta, dy, incy),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasGemvFn(handle,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dx,
-                                            incx,
-                                            beta,
-                                            dy,
-                                            incy),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGemvFn,
+                    (nullptr, transA, M, N, alpha, dA, lda, dx, incx, beta, dy, incy));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemvFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dx,
+                     incx,
+                     beta,
+                     dy,
+                     incy));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGemvFn(handle, transA, M, N, nullptr, dA, lda, dx, incx, beta, dy, incy),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGemvFn(handle, transA, M, N, alpha, dA, lda, dx, incx, nullptr, dy, incy),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemvFn,
+                        (handle, transA, M, N, nullptr, dA, lda, dx, incx, beta, dy, incy));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemvFn,
+                        (handle, transA, M, N, alpha, dA, lda, dx, incx, nullptr, dy, incy));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGemvFn(
-                        handle, transA, M, N, alpha, nullptr, lda, dx, incx, beta, dy, incy),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGemvFn(
-                        handle, transA, M, N, alpha, dA, lda, nullptr, incx, beta, dy, incy),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGemvFn(
-                        handle, transA, M, N, alpha, dA, lda, dx, incx, beta, nullptr, incy),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvFn,
+                            (handle, transA, M, N, alpha, nullptr, lda, dx, incx, beta, dy, incy));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvFn,
+                            (handle, transA, M, N, alpha, dA, lda, nullptr, incx, beta, dy, incy));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvFn,
+                            (handle, transA, M, N, alpha, dA, lda, dx, incx, beta, nullptr, incy));
             }
 
             // With alpha == 0 can have x nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemvFn(
-                handle, transA, M, N, zero, nullptr, lda, nullptr, incx, beta, dy, incy));
+            DAPI_CHECK(hipblasGemvFn,
+                       (handle, transA, M, N, zero, nullptr, lda, nullptr, incx, beta, dy, incy));
 
             // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemvFn(
-                handle, transA, M, N, zero, nullptr, lda, nullptr, incx, one, nullptr, incy));
+            DAPI_CHECK(
+                hipblasGemvFn,
+                (handle, transA, M, N, zero, nullptr, lda, nullptr, incx, one, nullptr, incy));
         }
 
         // With M == 0 || N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGemvFn(
-            handle, transA, 0, N, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy));
-        CHECK_HIPBLAS_ERROR(hipblasGemvFn(
-            handle, transA, M, 0, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy));
+        DAPI_CHECK(
+            hipblasGemvFn,
+            (handle, transA, 0, N, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy));
+        DAPI_CHECK(
+            hipblasGemvFn,
+            (handle, transA, M, 0, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy));
     }
 }
 
@@ -145,6 +148,8 @@ void testing_gemv(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemvFn = FORTRAN ? hipblasGemv<T, true> : hipblasGemv<T, false>;
+    auto hipblasGemvFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemv_64<T, true> : hipblasGemv_64<T, false>;
 
     int M    = arg.M;
     int N    = arg.N;
@@ -179,10 +184,20 @@ void testing_gemv(const Arguments& arg)
         if(!invalid_size || arg.bad_arg_all)
         {
             // cublas backend doesn't support nullptrs with bad input sizes
-            hipblasStatus_t actual = hipblasGemvFn(
-                handle, transA, M, N, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy);
-            EXPECT_HIPBLAS_STATUS(
-                actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+            DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                        hipblasGemvFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         nullptr,
+                         nullptr,
+                         lda,
+                         nullptr,
+                         incx,
+                         nullptr,
+                         nullptr,
+                         incy));
         }
 
         return;
@@ -234,15 +249,15 @@ void testing_gemv(const Arguments& arg)
     if(arg.unit_check || arg.norm_check)
     {
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGemvFn(
-            handle, transA, M, N, (T*)&h_alpha, dA, lda, dx, incx, (T*)&h_beta, dy, incy));
+        DAPI_CHECK(hipblasGemvFn,
+                   (handle, transA, M, N, (T*)&h_alpha, dA, lda, dx, incx, (T*)&h_beta, dy, incy));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_host.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(
-            hipblasGemvFn(handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+        DAPI_CHECK(
+            hipblasGemvFn, (handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_device.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
 
@@ -283,8 +298,8 @@ void testing_gemv(const Arguments& arg)
                 gpu_time_used = get_time_us_sync(stream);
             }
 
-            CHECK_HIPBLAS_ERROR(
-                hipblasGemvFn(handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+            DAPI_CHECK(hipblasGemvFn,
+                       (handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -52,6 +52,8 @@ void testing_gemv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemvBatchedFn
         = FORTRAN ? hipblasGemvBatched<T, true> : hipblasGemvBatched<T, false>;
+    auto hipblasGemvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemvBatched_64<T, true> : hipblasGemvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -90,174 +92,197 @@ void testing_gemv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dx(N, incx, batch_count);
         device_batch_vector<T> dy(M, incy, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasGemvBatchedFn(handle,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemvBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasGemvBatchedFn(nullptr,
-                                                       transA,
-                                                       M,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_NOT_INITIALIZED);
-
-            EXPECT_HIPBLAS_STATUS(hipblasGemvBatchedFn(handle,
-                                                       transA,
-                                                       M,
-                                                       N,
-                                                       nullptr,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGemvBatchedFn(handle,
-                                                       transA,
-                                                       M,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       nullptr,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                        hipblasGemvBatchedFn,
+                        (nullptr,
+                         transA,
+                         M,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemvBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         nullptr,
+                         dA.ptr_on_device(),
+                         lda,
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemvBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         dx.ptr_on_device(),
+                         incx,
+                         nullptr,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(hipblasGemvBatchedFn(handle,
-                                                           transA,
-                                                           M,
-                                                           N,
-                                                           alpha,
-                                                           nullptr,
-                                                           lda,
-                                                           dx.ptr_on_device(),
-                                                           incx,
-                                                           beta,
-                                                           dy.ptr_on_device(),
-                                                           incy,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemvBatchedFn(handle,
-                                                           transA,
-                                                           M,
-                                                           N,
-                                                           alpha,
-                                                           dA.ptr_on_device(),
-                                                           lda,
-                                                           nullptr,
-                                                           incx,
-                                                           beta,
-                                                           dy.ptr_on_device(),
-                                                           incy,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemvBatchedFn(handle,
-                                                           transA,
-                                                           M,
-                                                           N,
-                                                           alpha,
-                                                           dA.ptr_on_device(),
-                                                           lda,
-                                                           dx.ptr_on_device(),
-                                                           incx,
-                                                           beta,
-                                                           nullptr,
-                                                           incy,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvBatchedFn,
+                            (handle,
+                             transA,
+                             M,
+                             N,
+                             alpha,
+                             nullptr,
+                             lda,
+                             dx.ptr_on_device(),
+                             incx,
+                             beta,
+                             dy.ptr_on_device(),
+                             incy,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvBatchedFn,
+                            (handle,
+                             transA,
+                             M,
+                             N,
+                             alpha,
+                             dA.ptr_on_device(),
+                             lda,
+                             nullptr,
+                             incx,
+                             beta,
+                             dy.ptr_on_device(),
+                             incy,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvBatchedFn,
+                            (handle,
+                             transA,
+                             M,
+                             N,
+                             alpha,
+                             dA.ptr_on_device(),
+                             lda,
+                             dx.ptr_on_device(),
+                             incx,
+                             beta,
+                             nullptr,
+                             incy,
+                             batch_count));
             }
 
             // With alpha == 0 can have x nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                     transA,
-                                                     M,
-                                                     N,
-                                                     zero,
-                                                     nullptr,
-                                                     lda,
-                                                     nullptr,
-                                                     incx,
-                                                     beta,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGemvBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        zero,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        incx,
+                        beta,
+                        dy.ptr_on_device(),
+                        incy,
+                        batch_count));
 
             // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                     transA,
-                                                     M,
-                                                     N,
-                                                     zero,
-                                                     nullptr,
-                                                     lda,
-                                                     nullptr,
-                                                     incx,
-                                                     one,
-                                                     nullptr,
-                                                     incy,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGemvBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        zero,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        incx,
+                        one,
+                        nullptr,
+                        incy,
+                        batch_count));
         }
 
         // With M == 0 || N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                 transA,
-                                                 0,
-                                                 N,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 nullptr,
-                                                 nullptr,
-                                                 incy,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 0,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 nullptr,
-                                                 nullptr,
-                                                 incy,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(
-            handle, transA, M, N, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy, 0));
+        DAPI_CHECK(hipblasGemvBatchedFn,
+                   (handle,
+                    transA,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    batch_count));
+        DAPI_CHECK(hipblasGemvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    batch_count));
+        DAPI_CHECK(hipblasGemvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    0));
     }
 }
 
@@ -267,6 +292,8 @@ void testing_gemv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemvBatchedFn
         = FORTRAN ? hipblasGemvBatched<T, true> : hipblasGemvBatched<T, false>;
+    auto hipblasGemvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemvBatched_64<T, true> : hipblasGemvBatched_64<T, false>;
 
     int M    = arg.M;
     int N    = arg.N;
@@ -303,21 +330,21 @@ void testing_gemv_batched(const Arguments& arg)
         if(!invalid_size || arg.bad_arg_all)
         {
             // cublas backend doesn't support nullptrs with bad input sizes
-            hipblasStatus_t actual = hipblasGemvBatchedFn(handle,
-                                                          transA,
-                                                          M,
-                                                          N,
-                                                          nullptr,
-                                                          nullptr,
-                                                          lda,
-                                                          nullptr,
-                                                          incx,
-                                                          nullptr,
-                                                          nullptr,
-                                                          incy,
-                                                          batch_count);
-            EXPECT_HIPBLAS_STATUS(
-                actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+            DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                        hipblasGemvBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         nullptr,
+                         nullptr,
+                         lda,
+                         nullptr,
+                         incx,
+                         nullptr,
+                         nullptr,
+                         incy,
+                         batch_count));
         }
 
         return;
@@ -368,37 +395,39 @@ void testing_gemv_batched(const Arguments& arg)
     if(arg.unit_check || arg.norm_check)
     {
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 N,
-                                                 (T*)&h_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 (T*)&h_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGemvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    (T*)&h_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    (T*)&h_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_host.transfer_from(dy));
         CHECK_HIP_ERROR(dy.transfer_from(hy));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                 transA,
-                                                 M,
-                                                 N,
-                                                 d_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 d_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGemvBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    d_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    d_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
@@ -441,19 +470,20 @@ void testing_gemv_batched(const Arguments& arg)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
-            CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                     transA,
-                                                     M,
-                                                     N,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     d_beta,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGemvBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        dx.ptr_on_device(),
+                        incx,
+                        d_beta,
+                        dy.ptr_on_device(),
+                        incy,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
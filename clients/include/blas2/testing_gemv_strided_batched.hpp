@@ -53,6 +53,9 @@ void testing_gemv_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemvStridedBatchedFn
         = FORTRAN ? hipblasGemvStridedBatched<T, true> : hipblasGemvStridedBatched<T, false>;
+    auto hipblasGemvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGemvStridedBatched_64<T, true>
+                                              : hipblasGemvStridedBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -95,222 +98,233 @@ void testing_gemv_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dx(stridex * batch_count);
         device_vector<T> dy(stridey * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGemvStridedBatchedFn(handle,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        M,
-                                        N,
-                                        alpha,
-                                        dA,
-                                        lda,
-                                        strideA,
-                                        dx,
-                                        incx,
-                                        stridex,
-                                        beta,
-                                        dy,
-                                        incy,
-                                        stridey,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemvStridedBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     beta,
+                     dy,
+                     incy,
+                     stridey,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedFn(nullptr,
-                                                              transA,
-                                                              M,
-                                                              N,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              beta,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_NOT_INITIALIZED);
-
-            EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedFn(handle,
-                                                              transA,
-                                                              M,
-                                                              N,
-                                                              nullptr,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              beta,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedFn(handle,
-                                                              transA,
-                                                              M,
-                                                              N,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              nullptr,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                        hipblasGemvStridedBatchedFn,
+                        (nullptr,
+                         transA,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         dx,
+                         incx,
+                         stridex,
+                         beta,
+                         dy,
+                         incy,
+                         stridey,
+                         batch_count));
+
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemvStridedBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         nullptr,
+                         dA,
+                         lda,
+                         strideA,
+                         dx,
+                         incx,
+                         stridex,
+                         beta,
+                         dy,
+                         incy,
+                         stridey,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemvStridedBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         dx,
+                         incx,
+                         stridex,
+                         nullptr,
+                         dy,
+                         incy,
+                         stridey,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  M,
-                                                                  N,
-                                                                  alpha,
-                                                                  nullptr,
-                                                                  lda,
-                                                                  strideA,
-                                                                  dx,
-                                                                  incx,
-                                                                  stridex,
-                                                                  beta,
-                                                                  dy,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  M,
-                                                                  N,
-                                                                  alpha,
-                                                                  dA,
-                                                                  lda,
-                                                                  strideA,
-                                                                  nullptr,
-                                                                  incx,
-                                                                  stridex,
-                                                                  beta,
-                                                                  dy,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemvStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  M,
-                                                                  N,
-                                                                  alpha,
-                                                                  dA,
-                                                                  lda,
-                                                                  strideA,
-                                                                  dx,
-                                                                  incx,
-                                                                  stridex,
-                                                                  beta,
-                                                                  nullptr,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvStridedBatchedFn,
+                            (handle,
+                             transA,
+                             M,
+                             N,
+                             alpha,
+                             nullptr,
+                             lda,
+                             strideA,
+                             dx,
+                             incx,
+                             stridex,
+                             beta,
+                             dy,
+                             incy,
+                             stridey,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvStridedBatchedFn,
+                            (handle,
+                             transA,
+                             M,
+                             N,
+                             alpha,
+                             dA,
+                             lda,
+                             strideA,
+                             nullptr,
+                             incx,
+                             stridex,
+                             beta,
+                             dy,
+                             incy,
+                             stridey,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemvStridedBatchedFn,
+                            (handle,
+                             transA,
+                             M,
+                             N,
+                             alpha,
+                             dA,
+                             lda,
+                             strideA,
+                             dx,
+                             incx,
+                             stridex,
+                             beta,
+                             nullptr,
+                             incy,
+                             stridey,
+                             batch_count));
             }
 
             // With alpha == 0 can have x nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                            transA,
-                                                            M,
-                                                            N,
-                                                            zero,
-                                                            nullptr,
-                                                            lda,
-                                                            strideA,
-                                                            nullptr,
-                                                            incx,
-                                                            stridex,
-                                                            beta,
-                                                            dy,
-                                                            incy,
-                                                            stridey,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        zero,
+                        nullptr,
+                        lda,
+                        strideA,
+                        nullptr,
+                        incx,
+                        stridex,
+                        beta,
+                        dy,
+                        incy,
+                        stridey,
+                        batch_count));
 
             // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                            transA,
-                                                            M,
-                                                            N,
-                                                            zero,
-                                                            nullptr,
-                                                            lda,
-                                                            strideA,
-                                                            nullptr,
-                                                            incx,
-                                                            stridex,
-                                                            one,
-                                                            nullptr,
-                                                            incy,
-                                                            stridey,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        zero,
+                        nullptr,
+                        lda,
+                        strideA,
+                        nullptr,
+                        incx,
+                        stridex,
+                        one,
+                        nullptr,
+                        incy,
+                        stridey,
+                        batch_count));
         }
 
         // With M == 0 || N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                        transA,
-                                                        0,
-                                                        N,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        0,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        0));
+        DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    stridey,
+                    batch_count));
+        DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    stridey,
+                    batch_count));
+        DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    stridey,
+                    0));
     }
 }
 
@@ -320,6 +334,9 @@ void testing_gemv_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemvStridedBatchedFn
         = FORTRAN ? hipblasGemvStridedBatched<T, true> : hipblasGemvStridedBatched<T, false>;
+    auto hipblasGemvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGemvStridedBatched_64<T, true>
+                                              : hipblasGemvStridedBatched_64<T, false>;
 
     int    M            = arg.M;
     int    N            = arg.N;
@@ -368,24 +385,24 @@ void testing_gemv_strided_batched(const Arguments& arg)
         if(!invalid_size || arg.bad_arg_all)
         {
             // cublas backend doesn't support nullptrs with bad input sizes
-            hipblasStatus_t actual = hipblasGemvStridedBatchedFn(handle,
-                                                                 transA,
-                                                                 M,
-                                                                 N,
-                                                                 nullptr,
-                                                                 nullptr,
-                                                                 lda,
-                                                                 stride_A,
-                                                                 nullptr,
-                                                                 incx,
-                                                                 stride_x,
-                                                                 nullptr,
-                                                                 nullptr,
-                                                                 incy,
-                                                                 stride_y,
-                                                                 batch_count);
-            EXPECT_HIPBLAS_STATUS(
-                actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+            DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                        hipblasGemvStridedBatchedFn,
+                        (handle,
+                         transA,
+                         M,
+                         N,
+                         nullptr,
+                         nullptr,
+                         lda,
+                         stride_A,
+                         nullptr,
+                         incx,
+                         stride_x,
+                         nullptr,
+                         nullptr,
+                         incy,
+                         stride_y,
+                         batch_count));
         }
         return;
     }
@@ -441,43 +458,45 @@ void testing_gemv_strided_batched(const Arguments& arg)
         =================================================================== */
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        (T*)&h_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dx,
-                                                        incx,
-                                                        stride_x,
-                                                        (T*)&h_beta,
-                                                        dy,
-                                                        incy,
-                                                        stride_y,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    (T*)&h_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dx,
+                    incx,
+                    stride_x,
+                    (T*)&h_beta,
+                    dy,
+                    incy,
+                    stride_y,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_host.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                        transA,
-                                                        M,
-                                                        N,
-                                                        d_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dx,
-                                                        incx,
-                                                        stride_x,
-                                                        d_beta,
-                                                        dy,
-                                                        incy,
-                                                        stride_y,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                   (handle,
+                    transA,
+                    M,
+                    N,
+                    d_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dx,
+                    incx,
+                    stride_x,
+                    d_beta,
+                    dy,
+                    incy,
+                    stride_y,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_device.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
 
@@ -529,22 +548,23 @@ void testing_gemv_strided_batched(const Arguments& arg)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
-            CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                            transA,
-                                                            M,
-                                                            N,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            d_beta,
-                                                            dy,
-                                                            incy,
-                                                            stride_y,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGemvStridedBatchedFn,
+                       (handle,
+                        transA,
+                        M,
+                        N,
+                        d_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        dx,
+                        incx,
+                        stride_x,
+                        d_beta,
+                        dy,
+                        incy,
+                        stride_y,
+                        batch_count));
         }
 
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
@@ -43,6 +43,11 @@ void testing_ger_bad_arg(const Arguments& arg)
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGerFn = FORTRAN ? (CONJ ? hipblasGer<T, true, true> : hipblasGer<T, false, true>)
                                 : (CONJ ? hipblasGer<T, true, false> : hipblasGer<T, false, false>);
+    auto hipblasGerFn_64 = arg.api == FORTRAN_64
+                               ? (CONJ ? hipblasGer_64<T, true, true>
+                                       : hipblasGer_64<T, false, true>)
+                               : (CONJ ? hipblasGer_64<T, true, false>
+                                       : hipblasGer_64<T, false, false>);
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -73,36 +78,38 @@ void testing_ger_bad_arg(const Arguments& arg)
         device_vector<T> dx(N * incx);
         device_vector<T> dy(M * incy);
 
-        EXPECT_HIPBLAS_STATUS(hipblasGerFn(nullptr, M, N, alpha, dx, incx, dy, incy, dA, lda),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGerFn,
+                    (nullptr, M, N, alpha, dx, incx, dy, incy, dA, lda));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasGerFn(handle, M, N, nullptr, dx, incx, dy, incy, dA, lda),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGerFn,
+                        (handle, M, N, nullptr, dx, incx, dy, incy, dA, lda));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGerFn(handle, M, N, alpha, nullptr, incx, dy, incy, dA, lda),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGerFn(handle, M, N, alpha, dx, incx, nullptr, incy, dA, lda),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGerFn(handle, M, N, alpha, dx, incx, dy, incy, nullptr, lda),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGerFn,
+                            (handle, M, N, alpha, nullptr, incx, dy, incy, dA, lda));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGerFn,
+                            (handle, M, N, alpha, dx, incx, nullptr, incy, dA, lda));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGerFn,
+                            (handle, M, N, alpha, dx, incx, dy, incy, nullptr, lda));
             }
 
             // With alpha == 0 can have all nullptrs
-            CHECK_HIPBLAS_ERROR(
-                hipblasGerFn(handle, M, N, zero, nullptr, incx, nullptr, incy, nullptr, lda));
+            DAPI_CHECK(
+                hipblasGerFn, (handle, M, N, zero, nullptr, incx, nullptr, incy, nullptr, lda));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasGerFn(handle, M, 0, nullptr, nullptr, incx, nullptr, incy, nullptr, lda));
+        DAPI_CHECK(
+            hipblasGerFn, (handle, M, 0, nullptr, nullptr, incx, nullptr, incy, nullptr, lda));
     }
 }
 
@@ -112,6 +119,11 @@ void testing_ger(const Arguments& arg)
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGerFn = FORTRAN ? (CONJ ? hipblasGer<T, true, true> : hipblasGer<T, false, true>)
                                 : (CONJ ? hipblasGer<T, true, false> : hipblasGer<T, false, false>);
+    auto hipblasGerFn_64 = arg.api == FORTRAN_64
+                               ? (CONJ ? hipblasGer_64<T, true, true>
+                                       : hipblasGer_64<T, false, true>)
+                               : (CONJ ? hipblasGer_64<T, true, false>
+                                       : hipblasGer_64<T, false, false>);
 
     int M    = arg.M;
     int N    = arg.N;
@@ -132,10 +144,9 @@ void testing_ger(const Arguments& arg)
     bool invalid_size = M < 0 || N < 0 || !incx || !incy || lda < M || lda < 1;
     if(invalid_size || !M || !N)
     {
-        hipblasStatus_t actual
-            = hipblasGerFn(handle, M, N, nullptr, nullptr, incx, nullptr, incy, nullptr, lda);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasGerFn,
+                    (handle, M, N, nullptr, nullptr, incx, nullptr, incy, nullptr, lda));
         return;
     }
 
@@ -176,13 +187,13 @@ void testing_ger(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGerFn(handle, M, N, (T*)&h_alpha, dx, incx, dy, incy, dA, lda));
+        DAPI_CHECK(hipblasGerFn, (handle, M, N, (T*)&h_alpha, dx, incx, dy, incy, dA, lda));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGerFn(handle, M, N, d_alpha, dx, incx, dy, incy, dA, lda));
+        DAPI_CHECK(hipblasGerFn, (handle, M, N, d_alpha, dx, incx, dy, incy, dA, lda));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -220,7 +231,7 @@ void testing_ger(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGerFn(handle, M, N, d_alpha, dx, incx, dy, incy, dA, lda));
+            DAPI_CHECK(hipblasGerFn, (handle, M, N, d_alpha, dx, incx, dy, incy, dA, lda));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
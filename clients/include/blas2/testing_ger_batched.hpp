@@ -45,6 +45,11 @@ void testing_ger_batched_bad_arg(const Arguments& arg)
     auto hipblasGerBatchedFn
         = FORTRAN ? (CONJ ? hipblasGerBatched<T, true, true> : hipblasGerBatched<T, false, true>)
                   : (CONJ ? hipblasGerBatched<T, true, false> : hipblasGerBatched<T, false, false>);
+    auto hipblasGerBatchedFn_64 = arg.api == FORTRAN_64
+                                      ? (CONJ ? hipblasGerBatched_64<T, true, true>
+                                              : hipblasGerBatched_64<T, false, true>)
+                                      : (CONJ ? hipblasGerBatched_64<T, true, false>
+                                              : hipblasGerBatched_64<T, false, false>);
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -76,79 +81,85 @@ void testing_ger_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dx(N, incx, batch_count);
         device_batch_vector<T> dy(M, incy, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasGerBatchedFn(nullptr,
-                                                  M,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dy.ptr_on_device(),
-                                                  incy,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasGerBatchedFn(handle,
-                                                  M,
-                                                  N,
-                                                  nullptr,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dy.ptr_on_device(),
-                                                  incy,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGerBatchedFn,
+                    (nullptr,
+                     M,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dy.ptr_on_device(),
+                     incy,
+                     dA.ptr_on_device(),
+                     lda,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGerBatchedFn,
+                    (handle,
+                     M,
+                     N,
+                     nullptr,
+                     dx.ptr_on_device(),
+                     incx,
+                     dy.ptr_on_device(),
+                     incy,
+                     dA.ptr_on_device(),
+                     lda,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasGerBatchedFn(handle,
-                                                      M,
-                                                      N,
-                                                      alpha,
-                                                      nullptr,
-                                                      incx,
-                                                      dy.ptr_on_device(),
-                                                      incy,
-                                                      dA.ptr_on_device(),
-                                                      lda,
-                                                      batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGerBatchedFn(handle,
-                                                      M,
-                                                      N,
-                                                      alpha,
-                                                      dx.ptr_on_device(),
-                                                      incx,
-                                                      nullptr,
-                                                      incy,
-                                                      dA.ptr_on_device(),
-                                                      lda,
-                                                      batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGerBatchedFn(handle,
-                                                      M,
-                                                      N,
-                                                      alpha,
-                                                      dx.ptr_on_device(),
-                                                      incx,
-                                                      dy.ptr_on_device(),
-                                                      incy,
-                                                      nullptr,
-                                                      lda,
-                                                      batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGerBatchedFn,
+                        (handle,
+                         M,
+                         N,
+                         alpha,
+                         nullptr,
+                         incx,
+                         dy.ptr_on_device(),
+                         incy,
+                         dA.ptr_on_device(),
+                         lda,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGerBatchedFn,
+                        (handle,
+                         M,
+                         N,
+                         alpha,
+                         dx.ptr_on_device(),
+                         incx,
+                         nullptr,
+                         incy,
+                         dA.ptr_on_device(),
+                         lda,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGerBatchedFn,
+                        (handle,
+                         M,
+                         N,
+                         alpha,
+                         dx.ptr_on_device(),
+                         incx,
+                         dy.ptr_on_device(),
+                         incy,
+                         nullptr,
+                         lda,
+                         batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGerBatchedFn(
-            handle, M, 0, nullptr, nullptr, incx, nullptr, incy, nullptr, lda, batch_count));
+        DAPI_CHECK(
+            hipblasGerBatchedFn,
+            (handle, M, 0, nullptr, nullptr, incx, nullptr, incy, nullptr, lda, batch_count));
 
         // With alpha == 0 can have x nullptr
-        CHECK_HIPBLAS_ERROR(hipblasGerBatchedFn(
-            handle, M, N, zero, nullptr, incx, nullptr, incy, nullptr, lda, batch_count));
+        DAPI_CHECK(hipblasGerBatchedFn,
+                   (handle, M, N, zero, nullptr, incx, nullptr, incy, nullptr, lda, batch_count));
     }
 }
 
@@ -159,6 +170,11 @@ void testing_ger_batched(const Arguments& arg)
     auto hipblasGerBatchedFn
         = FORTRAN ? (CONJ ? hipblasGerBatched<T, true, true> : hipblasGerBatched<T, false, true>)
                   : (CONJ ? hipblasGerBatched<T, true, false> : hipblasGerBatched<T, false, false>);
+    auto hipblasGerBatchedFn_64 = arg.api == FORTRAN_64
+                                      ? (CONJ ? hipblasGerBatched_64<T, true, true>
+                                              : hipblasGerBatched_64<T, false, true>)
+                                      : (CONJ ? hipblasGerBatched_64<T, true, false>
+                                              : hipblasGerBatched_64<T, false, false>);
 
     int M           = arg.M;
     int N           = arg.N;
@@ -180,10 +196,10 @@ void testing_ger_batched(const Arguments& arg)
     bool invalid_size = M < 0 || N < 0 || !incx || !incy || lda < M || lda < 1 || batch_count < 0;
     if(invalid_size || !M || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasGerBatchedFn(
-            handle, M, N, nullptr, nullptr, incx, nullptr, incy, nullptr, lda, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT(
+            (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+            hipblasGerBatchedFn,
+            (handle, M, N, nullptr, nullptr, incx, nullptr, incy, nullptr, lda, batch_count));
         return;
     }
 
@@ -223,33 +239,35 @@ void testing_ger_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGerBatchedFn(handle,
-                                                M,
-                                                N,
-                                                (T*)&h_alpha,
-                                                dx.ptr_on_device(),
-                                                incx,
-                                                dy.ptr_on_device(),
-                                                incy,
-                                                dA.ptr_on_device(),
-                                                lda,
-                                                batch_count));
+        DAPI_CHECK(hipblasGerBatchedFn,
+                   (handle,
+                    M,
+                    N,
+                    (T*)&h_alpha,
+                    dx.ptr_on_device(),
+                    incx,
+                    dy.ptr_on_device(),
+                    incy,
+                    dA.ptr_on_device(),
+                    lda,
+                    batch_count));
 
         CHECK_HIP_ERROR(hA_host.transfer_from(dA));
         CHECK_HIP_ERROR(dA.transfer_from(hA));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGerBatchedFn(handle,
-                                                M,
-                                                N,
-                                                d_alpha,
-                                                dx.ptr_on_device(),
-                                                incx,
-                                                dy.ptr_on_device(),
-                                                incy,
-                                                dA.ptr_on_device(),
-                                                lda,
-                                                batch_count));
+        DAPI_CHECK(hipblasGerBatchedFn,
+                   (handle,
+                    M,
+                    N,
+                    d_alpha,
+                    dx.ptr_on_device(),
+                    incx,
+                    dy.ptr_on_device(),
+                    incy,
+                    dA.ptr_on_device(),
+                    lda,
+                    batch_count));
 
         CHECK_HIP_ERROR(hA_device.transfer_from(dA));
 
@@ -290,17 +308,18 @@ void testing_ger_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGerBatchedFn(handle,
-                                                    M,
-                                                    N,
-                                                    d_alpha,
-                                                    dx.ptr_on_device(),
-                                                    incx,
-                                                    dy.ptr_on_device(),
-                                                    incy,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    batch_count));
+            DAPI_CHECK(hipblasGerBatchedFn,
+                       (handle,
+                        M,
+                        N,
+                        d_alpha,
+                        dx.ptr_on_device(),
+                        incx,
+                        dy.ptr_on_device(),
+                        incy,
+                        dA.ptr_on_device(),
+                        lda,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
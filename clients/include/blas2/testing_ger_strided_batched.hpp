@@ -53,6 +53,12 @@ void testing_ger_strided_batched_bad_arg(const Arguments& arg)
                                                       : hipblasGerStridedBatched<T, false, true>)
                                               : (CONJ ? hipblasGerStridedBatched<T, true, false>
                                                       : hipblasGerStridedBatched<T, false, false>);
+    auto hipblasGerStridedBatchedFn_64
+        = arg.api == FORTRAN_64
+              ? (CONJ ? hipblasGerStridedBatched_64<T, true, true>
+                      : hipblasGerStridedBatched_64<T, false, true>)
+              : (CONJ ? hipblasGerStridedBatched_64<T, true, false>
+                      : hipblasGerStridedBatched_64<T, false, false>);
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -88,118 +94,125 @@ void testing_ger_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dx(stridex * batch_count);
         device_vector<T> dy(stridey * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasGerStridedBatchedFn(nullptr,
-                                                         M,
-                                                         N,
-                                                         alpha,
-                                                         dx,
-                                                         incx,
-                                                         stridex,
-                                                         dy,
-                                                         incy,
-                                                         stridey,
-                                                         dA,
-                                                         lda,
-                                                         strideA,
-                                                         batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasGerStridedBatchedFn(handle,
-                                                         M,
-                                                         N,
-                                                         nullptr,
-                                                         dx,
-                                                         incx,
-                                                         stridex,
-                                                         dy,
-                                                         incy,
-                                                         stridey,
-                                                         dA,
-                                                         lda,
-                                                         strideA,
-                                                         batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGerStridedBatchedFn,
+                    (nullptr,
+                     M,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGerStridedBatchedFn,
+                    (handle,
+                     M,
+                     N,
+                     nullptr,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasGerStridedBatchedFn(handle,
-                                                             M,
-                                                             N,
-                                                             alpha,
-                                                             nullptr,
-                                                             incx,
-                                                             stridex,
-                                                             dy,
-                                                             incy,
-                                                             stridey,
-                                                             dA,
-                                                             lda,
-                                                             strideA,
-                                                             batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGerStridedBatchedFn(handle,
-                                                             M,
-                                                             N,
-                                                             alpha,
-                                                             dx,
-                                                             incx,
-                                                             stridex,
-                                                             nullptr,
-                                                             incy,
-                                                             stridey,
-                                                             dA,
-                                                             lda,
-                                                             strideA,
-                                                             batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGerStridedBatchedFn(handle,
-                                                             M,
-                                                             N,
-                                                             alpha,
-                                                             dx,
-                                                             incx,
-                                                             stridex,
-                                                             dy,
-                                                             incy,
-                                                             stridey,
-                                                             nullptr,
-                                                             lda,
-                                                             strideA,
-                                                             batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGerStridedBatchedFn,
+                        (handle,
+                         M,
+                         N,
+                         alpha,
+                         nullptr,
+                         incx,
+                         stridex,
+                         dy,
+                         incy,
+                         stridey,
+                         dA,
+                         lda,
+                         strideA,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGerStridedBatchedFn,
+                        (handle,
+                         M,
+                         N,
+                         alpha,
+                         dx,
+                         incx,
+                         stridex,
+                         nullptr,
+                         incy,
+                         stridey,
+                         dA,
+                         lda,
+                         strideA,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGerStridedBatchedFn,
+                        (handle,
+                         M,
+                         N,
+                         alpha,
+                         dx,
+                         incx,
+                         stridex,
+                         dy,
+                         incy,
+                         stridey,
+                         nullptr,
+                         lda,
+                         strideA,
+                         batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGerStridedBatchedFn(handle,
-                                                       M,
-                                                       0,
-                                                       nullptr,
-                                                       nullptr,
-                                                       incx,
-                                                       stridex,
-                                                       nullptr,
-                                                       incy,
-                                                       stridey,
-                                                       nullptr,
-                                                       lda,
-                                                       strideA,
-                                                       batch_count));
+        DAPI_CHECK(hipblasGerStridedBatchedFn,
+                   (handle,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    lda,
+                    strideA,
+                    batch_count));
 
         // With alpha == 0 can have x nullptr
-        CHECK_HIPBLAS_ERROR(hipblasGerStridedBatchedFn(handle,
-                                                       M,
-                                                       N,
-                                                       zero,
-                                                       nullptr,
-                                                       incx,
-                                                       stridex,
-                                                       nullptr,
-                                                       incy,
-                                                       stridey,
-                                                       nullptr,
-                                                       lda,
-                                                       strideA,
-                                                       batch_count));
+        DAPI_CHECK(hipblasGerStridedBatchedFn,
+                   (handle,
+                    M,
+                    N,
+                    zero,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    lda,
+                    strideA,
+                    batch_count));
     }
 }
 
@@ -211,6 +224,12 @@ void testing_ger_strided_batched(const Arguments& arg)
                                                       : hipblasGerStridedBatched<T, false, true>)
                                               : (CONJ ? hipblasGerStridedBatched<T, true, false>
                                                       : hipblasGerStridedBatched<T, false, false>);
+    auto hipblasGerStridedBatchedFn_64
+        = arg.api == FORTRAN_64
+              ? (CONJ ? hipblasGerStridedBatched_64<T, true, true>
+                      : hipblasGerStridedBatched_64<T, false, true>)
+              : (CONJ ? hipblasGerStridedBatched_64<T, true, false>
+                      : hipblasGerStridedBatched_64<T, false, false>);
 
     int    M            = arg.M;
     int    N            = arg.N;
@@ -236,22 +255,22 @@ void testing_ger_strided_batched(const Arguments& arg)
     bool invalid_size = M < 0 || N < 0 || !incx || !incy || lda < M || lda < 1 || batch_count < 0;
     if(invalid_size || !M || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasGerStridedBatchedFn(handle,
-                                                            M,
-                                                            N,
-                                                            nullptr,
-                                                            nullptr,
-                                                            incx,
-                                                            stride_x,
-                                                            nullptr,
-                                                            incy,
-                                                            stride_y,
-                                                            nullptr,
-                                                            lda,
-                                                            stride_A,
-                                                            batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasGerStridedBatchedFn,
+                    (handle,
+                     M,
+                     N,
+                     nullptr,
+                     nullptr,
+                     incx,
+                     stride_x,
+                     nullptr,
+                     incy,
+                     stride_y,
+                     nullptr,
+                     lda,
+                     stride_A,
+                     batch_count));
         return;
     }
 
@@ -294,39 +313,41 @@ void testing_ger_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGerStridedBatchedFn(handle,
-                                                       M,
-                                                       N,
-                                                       (T*)&h_alpha,
-                                                       dx,
-                                                       incx,
-                                                       stride_x,
-                                                       dy,
-                                                       incy,
-                                                       stride_y,
-                                                       dA,
-                                                       lda,
-                                                       stride_A,
-                                                       batch_count));
+        DAPI_CHECK(hipblasGerStridedBatchedFn,
+                   (handle,
+                    M,
+                    N,
+                    (T*)&h_alpha,
+                    dx,
+                    incx,
+                    stride_x,
+                    dy,
+                    incy,
+                    stride_y,
+                    dA,
+                    lda,
+                    stride_A,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGerStridedBatchedFn(handle,
-                                                       M,
-                                                       N,
-                                                       d_alpha,
-                                                       dx,
-                                                       incx,
-                                                       stride_x,
-                                                       dy,
-                                                       incy,
-                                                       stride_y,
-                                                       dA,
-                                                       lda,
-                                                       stride_A,
-                                                       batch_count));
+        DAPI_CHECK(hipblasGerStridedBatchedFn,
+                   (handle,
+                    M,
+                    N,
+                    d_alpha,
+                    dx,
+                    incx,
+                    stride_x,
+                    dy,
+                    incy,
+                    stride_y,
+                    dA,
+                    lda,
+                    stride_A,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -376,20 +397,21 @@ void testing_ger_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGerStridedBatchedFn(handle,
-                                                           M,
-                                                           N,
-                                                           d_alpha,
-                                                           dx,
-                                                           incx,
-                                                           stride_x,
-                                                           dy,
-                                                           incy,
-                                                           stride_y,
-                                                           dA,
-                                                           lda,
-                                                           stride_A,
-                                                           batch_count));
+            DAPI_CHECK(hipblasGerStridedBatchedFn,
+                       (handle,
+                        M,
+                        N,
+                        d_alpha,
+                        dx,
+                        incx,
+                        stride_x,
+                        dy,
+                        incy,
+                        stride_y,
+                        dA,
+                        lda,
+                        stride_A,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -52,6 +52,8 @@ void testing_hbmv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHbmvBatchedFn
         = FORTRAN ? hipblasHbmvBatched<T, true> : hipblasHbmvBatched<T, false>;
+    auto hipblasHbmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasHbmvBatched_64<T, true> : hipblasHbmvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -90,171 +92,183 @@ void testing_hbmv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dx(N, incx, batch_count);
         device_batch_vector<T> dy(N, incy, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(nullptr,
-                                                   uplo,
-                                                   N,
-                                                   K,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(handle,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   N,
-                                                   K,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(handle,
-                                                   (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                   N,
-                                                   K,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(handle,
-                                                   uplo,
-                                                   N,
-                                                   K,
-                                                   nullptr,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(handle,
-                                                   uplo,
-                                                   N,
-                                                   K,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   nullptr,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHbmvBatchedFn,
+                    (nullptr,
+                     uplo,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHbmvBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHbmvBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHbmvBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     K,
+                     nullptr,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHbmvBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     nullptr,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       K,
-                                                       alpha,
-                                                       nullptr,
-                                                       lda,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       K,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       nullptr,
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasHbmvBatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       K,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       nullptr,
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHbmvBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         K,
+                         alpha,
+                         nullptr,
+                         lda,
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHbmvBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         K,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         nullptr,
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHbmvBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         K,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         nullptr,
+                         incy,
+                         batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHbmvBatchedFn(handle,
-                                                 uplo,
-                                                 0,
-                                                 K,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 nullptr,
-                                                 nullptr,
-                                                 incy,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasHbmvBatchedFn(
-            handle, uplo, N, K, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy, 0));
+        DAPI_CHECK(hipblasHbmvBatchedFn,
+                   (handle,
+                    uplo,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    batch_count));
+        DAPI_CHECK(
+            hipblasHbmvBatchedFn,
+            (handle, uplo, N, K, nullptr, nullptr, lda, nullptr, incx, nullptr, nullptr, incy, 0));
 
         // With alpha == 0 can have A and x nullptr
-        CHECK_HIPBLAS_ERROR(hipblasHbmvBatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 K,
-                                                 zero,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasHbmvBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    K,
+                    zero,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-        CHECK_HIPBLAS_ERROR(hipblasHbmvBatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 K,
-                                                 zero,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 incx,
-                                                 one,
-                                                 nullptr,
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasHbmvBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    K,
+                    zero,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    incx,
+                    one,
+                    nullptr,
+                    incy,
+                    batch_count));
     }
 }
 
@@ -264,6 +278,8 @@ void testing_hbmv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHbmvBatchedFn
         = FORTRAN ? hipblasHbmvBatched<T, true> : hipblasHbmvBatched<T, false>;
+    auto hipblasHbmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasHbmvBatched_64<T, true> : hipblasHbmvBatched_64<T, false>;
 
     hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
     int               N           = arg.N;
@@ -283,21 +299,21 @@ void testing_hbmv_batched(const Arguments& arg)
     bool invalid_size = N < 0 || K < 0 || lda <= K || !incx || !incy || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasHbmvBatchedFn(handle,
-                                                      uplo,
-                                                      N,
-                                                      K,
-                                                      nullptr,
-                                                      nullptr,
-                                                      lda,
-                                                      nullptr,
-                                                      incx,
-                                                      nullptr,
-                                                      nullptr,
-                                                      incy,
-                                                      batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasHbmvBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     K,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     incx,
+                     nullptr,
+                     nullptr,
+                     incy,
+                     batch_count));
         return;
     }
 
@@ -344,37 +360,39 @@ void testing_hbmv_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHbmvBatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 K,
-                                                 (T*)&h_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 (T*)&h_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasHbmvBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    K,
+                    (T*)&h_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    (T*)&h_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_host.transfer_from(dy));
         CHECK_HIP_ERROR(dy.transfer_from(hy));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHbmvBatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 K,
-                                                 d_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 d_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasHbmvBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    K,
+                    d_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    d_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
@@ -416,19 +434,20 @@ void testing_hbmv_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHbmvBatchedFn(handle,
-                                                     uplo,
-                                                     N,
-                                                     K,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     d_beta,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
+            DAPI_CHECK(hipblasHbmvBatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        K,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        dx.ptr_on_device(),
+                        incx,
+                        d_beta,
+                        dy.ptr_on_device(),
+                        incy,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
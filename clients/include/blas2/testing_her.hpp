@@ -43,6 +43,8 @@ void testing_her_bad_arg(const Arguments& arg)
     using U           = real_t<T>;
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHerFn = FORTRAN ? hipblasHer<T, U, true> : hipblasHer<T, U, false>;
+    auto hipblasHerFn_64
+        = arg.api == FORTRAN_64 ? hipblasHer_64<T, U, true> : hipblasHer_64<T, U, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -71,35 +73,39 @@ void testing_her_bad_arg(const Arguments& arg)
         device_vector<T> dA(N * lda);
         device_vector<T> dx(N * incx);
 
-        EXPECT_HIPBLAS_STATUS(hipblasHerFn(nullptr, uplo, N, alpha, dx, incx, dA, lda),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHerFn(handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dA, lda),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHerFn(handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dA, lda),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHerFn,
+                    (nullptr, uplo, N, alpha, dx, incx, dA, lda));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHerFn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dA, lda));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHerFn,
+                    (handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dA, lda));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasHerFn(handle, uplo, N, nullptr, dx, incx, dA, lda),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHerFn,
+                        (handle, uplo, N, nullptr, dx, incx, dA, lda));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(hipblasHerFn(handle, uplo, N, alpha, nullptr, incx, dA, lda),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasHerFn(handle, uplo, N, alpha, dx, incx, nullptr, lda),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHerFn,
+                            (handle, uplo, N, alpha, nullptr, incx, dA, lda));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHerFn,
+                            (handle, uplo, N, alpha, dx, incx, nullptr, lda));
             }
 
             // With alpha == 0, can have all nullptrs
-            CHECK_HIPBLAS_ERROR(hipblasHerFn(handle, uplo, N, zero, nullptr, incx, nullptr, lda));
+            DAPI_CHECK(hipblasHerFn, (handle, uplo, N, zero, nullptr, incx, nullptr, lda));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHerFn(handle, uplo, 0, nullptr, nullptr, incx, nullptr, lda));
+        DAPI_CHECK(hipblasHerFn, (handle, uplo, 0, nullptr, nullptr, incx, nullptr, lda));
     }
 }
 
@@ -109,6 +115,8 @@ void testing_her(const Arguments& arg)
     using U           = real_t<T>;
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHerFn = FORTRAN ? hipblasHer<T, U, true> : hipblasHer<T, U, false>;
+    auto hipblasHerFn_64
+        = arg.api == FORTRAN_64 ? hipblasHer_64<T, U, true> : hipblasHer_64<T, U, false>;
 
     hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
     int               N    = arg.N;
@@ -126,10 +134,9 @@ void testing_her(const Arguments& arg)
     bool invalid_size = N < 0 || lda < N || lda < 1 || !incx;
     if(invalid_size || !N)
     {
-        hipblasStatus_t actual
-            = hipblasHerFn(handle, uplo, N, nullptr, nullptr, incx, nullptr, lda);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasHerFn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr, lda));
         return;
     }
 
@@ -166,13 +173,13 @@ void testing_her(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHerFn(handle, uplo, N, (U*)&h_alpha, dx, incx, dA, lda));
+        DAPI_CHECK(hipblasHerFn, (handle, uplo, N, (U*)&h_alpha, dx, incx, dA, lda));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * N * lda, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * N * lda, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHerFn(handle, uplo, N, d_alpha, dx, incx, dA, lda));
+        DAPI_CHECK(hipblasHerFn, (handle, uplo, N, d_alpha, dx, incx, dA, lda));
 
         CHECK_HIP_ERROR(
             hipMemcpy(hA_device.data(), dA, sizeof(T) * N * lda, hipMemcpyDeviceToHost));
@@ -214,7 +221,7 @@ void testing_her(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHerFn(handle, uplo, N, d_alpha, dx, incx, dA, lda));
+            DAPI_CHECK(hipblasHerFn, (handle, uplo, N, d_alpha, dx, incx, dA, lda));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
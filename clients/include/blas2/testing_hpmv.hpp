@@ -42,6 +42,8 @@ void testing_hpmv_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpmvFn = FORTRAN ? hipblasHpmv<T, true> : hipblasHpmv<T, false>;
+    auto hipblasHpmvFn_64
+        = arg.api == FORTRAN_64 ? hipblasHpmv_64<T, true> : hipblasHpmv_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -78,50 +80,51 @@ void testing_hpmv_bad_arg(const Arguments& arg)
         device_vector<T> dx(N * incx);
         device_vector<T> dy(N * incy);
 
-        EXPECT_HIPBLAS_STATUS(hipblasHpmvFn(nullptr, uplo, N, alpha, dA, dx, incx, beta, dy, incy),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHpmvFn(handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dA, dx, incx, beta, dy, incy),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHpmvFn(
-                handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dA, dx, incx, beta, dy, incy),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHpmvFn,
+                    (nullptr, uplo, N, alpha, dA, dx, incx, beta, dy, incy));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHpmvFn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dA, dx, incx, beta, dy, incy));
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_ENUM,
+            hipblasHpmvFn,
+            (handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dA, dx, incx, beta, dy, incy));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHpmvFn(handle, uplo, N, nullptr, dA, dx, incx, beta, dy, incy),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHpmvFn(handle, uplo, N, alpha, dA, dx, incx, nullptr, dy, incy),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpmvFn,
+                        (handle, uplo, N, nullptr, dA, dx, incx, beta, dy, incy));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpmvFn,
+                        (handle, uplo, N, alpha, dA, dx, incx, nullptr, dy, incy));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHpmvFn(handle, uplo, N, alpha, nullptr, dx, incx, beta, dy, incy),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHpmvFn(handle, uplo, N, alpha, dA, nullptr, incx, beta, dy, incy),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHpmvFn(handle, uplo, N, alpha, dA, dx, incx, beta, nullptr, incy),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHpmvFn,
+                            (handle, uplo, N, alpha, nullptr, dx, incx, beta, dy, incy));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHpmvFn,
+                            (handle, uplo, N, alpha, dA, nullptr, incx, beta, dy, incy));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHpmvFn,
+                            (handle, uplo, N, alpha, dA, dx, incx, beta, nullptr, incy));
             }
             // With alpha == 0 can have A and x nullptr
-            CHECK_HIPBLAS_ERROR(
-                hipblasHpmvFn(handle, uplo, N, zero, nullptr, nullptr, incx, beta, dy, incy));
+            DAPI_CHECK(
+                hipblasHpmvFn, (handle, uplo, N, zero, nullptr, nullptr, incx, beta, dy, incy));
 
             // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-            CHECK_HIPBLAS_ERROR(
-                hipblasHpmvFn(handle, uplo, N, zero, nullptr, nullptr, incx, one, nullptr, incy));
+            DAPI_CHECK(
+                hipblasHpmvFn, (handle, uplo, N, zero, nullptr, nullptr, incx, one, nullptr, incy));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHpmvFn(
-            handle, uplo, 0, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy));
+        DAPI_CHECK(hipblasHpmvFn,
+                   (handle, uplo, 0, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy));
     }
 }
 
@@ -130,6 +133,8 @@ void testing_hpmv(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpmvFn = FORTRAN ? hipblasHpmv<T, true> : hipblasHpmv<T, false>;
+    auto hipblasHpmvFn_64
+        = arg.api == FORTRAN_64 ? hipblasHpmv_64<T, true> : hipblasHpmv_64<T, false>;
 
     hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
     int               N    = arg.N;
@@ -149,10 +154,9 @@ void testing_hpmv(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || !incy;
     if(invalid_size || !N)
     {
-        hipblasStatus_t actual = hipblasHpmvFn(
-            handle, uplo, N, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasHpmvFn,
+                    (handle, uplo, N, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy));
         return;
     }
 
@@ -196,15 +200,14 @@ void testing_hpmv(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(
-            hipblasHpmvFn(handle, uplo, N, (T*)&h_alpha, dA, dx, incx, (T*)&h_beta, dy, incy));
+        DAPI_CHECK(
+            hipblasHpmvFn, (handle, uplo, N, (T*)&h_alpha, dA, dx, incx, (T*)&h_beta, dy, incy));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_host.data(), dy, sizeof(T) * y_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(
-            hipblasHpmvFn(handle, uplo, N, d_alpha, dA, dx, incx, d_beta, dy, incy));
+        DAPI_CHECK(hipblasHpmvFn, (handle, uplo, N, d_alpha, dA, dx, incx, d_beta, dy, incy));
 
         CHECK_HIP_ERROR(hipMemcpy(hy_device.data(), dy, sizeof(T) * y_size, hipMemcpyDeviceToHost));
 
@@ -241,8 +244,7 @@ void testing_hpmv(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(
-                hipblasHpmvFn(handle, uplo, N, d_alpha, dA, dx, incx, d_beta, dy, incy));
+            DAPI_CHECK(hipblasHpmvFn, (handle, uplo, N, d_alpha, dA, dx, incx, d_beta, dy, incy));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -44,6 +44,8 @@ void testing_hpmv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpmvBatchedFn
         = FORTRAN ? hipblasHpmvBatched<T, true> : hipblasHpmvBatched<T, false>;
+    auto hipblasHpmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasHpmvBatched_64<T, true> : hipblasHpmvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -81,131 +83,151 @@ void testing_hpmv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dx(N, incx, batch_count);
         device_batch_vector<T> dy(N, incy, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(nullptr,
-                                                   uplo,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(handle,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(handle,
-                                                   (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(handle,
-                                                   uplo,
-                                                   N,
-                                                   nullptr,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   beta,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(handle,
-                                                   uplo,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   nullptr,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHpmvBatchedFn,
+                    (nullptr,
+                     uplo,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHpmvBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHpmvBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHpmvBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     beta,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHpmvBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     nullptr,
+                     dy.ptr_on_device(),
+                     incy,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx, dy as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       alpha,
-                                                       nullptr,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       nullptr,
-                                                       incx,
-                                                       beta,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasHpmvBatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       beta,
-                                                       nullptr,
-                                                       incy,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpmvBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         nullptr,
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpmvBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         nullptr,
+                         incx,
+                         beta,
+                         dy.ptr_on_device(),
+                         incy,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpmvBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         dx.ptr_on_device(),
+                         incx,
+                         beta,
+                         nullptr,
+                         incy,
+                         batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(
-            handle, uplo, 0, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy, batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(
-            handle, uplo, N, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy, 0));
+        DAPI_CHECK(hipblasHpmvBatchedFn,
+                   (handle,
+                    uplo,
+                    0,
+                    nullptr,
+                    nullptr,
+                    nullptr,
+                    incx,
+                    nullptr,
+                    nullptr,
+                    incy,
+                    batch_count));
+        DAPI_CHECK(hipblasHpmvBatchedFn,
+                   (handle, uplo, N, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy, 0));
 
         // With alpha == 0 can have A and x nullptr
-        CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 zero,
-                                                 nullptr,
-                                                 nullptr,
-                                                 incx,
-                                                 beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasHpmvBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    zero,
+                    nullptr,
+                    nullptr,
+                    incx,
+                    beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         // With alpha == 0 && beta == 1, all other ptrs can be nullptr
-        CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(
-            handle, uplo, N, zero, nullptr, nullptr, incx, one, nullptr, incy, batch_count));
+        DAPI_CHECK(
+            hipblasHpmvBatchedFn,
+            (handle, uplo, N, zero, nullptr, nullptr, incx, one, nullptr, incy, batch_count));
     }
 }
 
@@ -215,6 +237,8 @@ void testing_hpmv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpmvBatchedFn
         = FORTRAN ? hipblasHpmvBatched<T, true> : hipblasHpmvBatched<T, false>;
+    auto hipblasHpmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasHpmvBatched_64<T, true> : hipblasHpmvBatched_64<T, false>;
 
     hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
     int               N           = arg.N;
@@ -232,10 +256,19 @@ void testing_hpmv_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || !incy || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasHpmvBatchedFn(
-            handle, uplo, N, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasHpmvBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     incx,
+                     nullptr,
+                     nullptr,
+                     incy,
+                     batch_count));
         return;
     }
 
@@ -282,33 +315,35 @@ void testing_hpmv_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 (T*)&h_alpha,
-                                                 dA.ptr_on_device(),
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 (T*)&h_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasHpmvBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    (T*)&h_alpha,
+                    dA.ptr_on_device(),
+                    dx.ptr_on_device(),
+                    incx,
+                    (T*)&h_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_host.transfer_from(dy));
         CHECK_HIP_ERROR(dy.transfer_from(hy));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 d_alpha,
-                                                 dA.ptr_on_device(),
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 d_beta,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 batch_count));
+        DAPI_CHECK(hipblasHpmvBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    d_alpha,
+                    dA.ptr_on_device(),
+                    dx.ptr_on_device(),
+                    incx,
+                    d_beta,
+                    dy.ptr_on_device(),
+                    incy,
+                    batch_count));
 
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
@@ -350,17 +385,18 @@ void testing_hpmv_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHpmvBatchedFn(handle,
-                                                     uplo,
-                                                     N,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     d_beta,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
+            DAPI_CHECK(hipblasHpmvBatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        dx.ptr_on_device(),
+                        incx,
+                        d_beta,
+                        dy.ptr_on_device(),
+                        incy,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
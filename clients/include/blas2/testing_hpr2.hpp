@@ -42,6 +42,8 @@ void testing_hpr2_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpr2Fn = FORTRAN ? hipblasHpr2<T, true> : hipblasHpr2<T, false>;
+    auto hipblasHpr2Fn_64
+        = arg.api == FORTRAN_64 ? hipblasHpr2_64<T, true> : hipblasHpr2_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -72,43 +74,44 @@ void testing_hpr2_bad_arg(const Arguments& arg)
         device_vector<T> dx(N * incx);
         device_vector<T> dy(N * incy);
 
-        EXPECT_HIPBLAS_STATUS(hipblasHpr2Fn(nullptr, uplo, N, alpha, dx, incx, dy, incy, dA),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHpr2Fn(handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dy, incy, dA),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHpr2Fn(
-                handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dy, incy, dA),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHpr2Fn,
+                    (nullptr, uplo, N, alpha, dx, incx, dy, incy, dA));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHpr2Fn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dy, incy, dA));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHpr2Fn,
+                    (handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dy, incy, dA));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasHpr2Fn(handle, uplo, N, nullptr, dx, incx, dy, incy, dA),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpr2Fn,
+                        (handle, uplo, N, nullptr, dx, incx, dy, incy, dA));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHpr2Fn(handle, uplo, N, alpha, nullptr, incx, dy, incy, dA),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHpr2Fn(handle, uplo, N, alpha, dx, incx, nullptr, incy, dA),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHpr2Fn(handle, uplo, N, alpha, dx, incx, dy, incy, nullptr),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHpr2Fn,
+                            (handle, uplo, N, alpha, nullptr, incx, dy, incy, dA));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHpr2Fn,
+                            (handle, uplo, N, alpha, dx, incx, nullptr, incy, dA));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHpr2Fn,
+                            (handle, uplo, N, alpha, dx, incx, dy, incy, nullptr));
             }
 
             // With alpha == 0, can have all nullptrs
-            CHECK_HIPBLAS_ERROR(
-                hipblasHpr2Fn(handle, uplo, N, zero, nullptr, incx, nullptr, incy, nullptr));
+            DAPI_CHECK(
+                hipblasHpr2Fn, (handle, uplo, N, zero, nullptr, incx, nullptr, incy, nullptr));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasHpr2Fn(handle, uplo, 0, nullptr, nullptr, incx, nullptr, incy, nullptr));
+        DAPI_CHECK(
+            hipblasHpr2Fn, (handle, uplo, 0, nullptr, nullptr, incx, nullptr, incy, nullptr));
     }
 }
 
@@ -117,6 +120,8 @@ void testing_hpr2(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpr2Fn = FORTRAN ? hipblasHpr2<T, true> : hipblasHpr2<T, false>;
+    auto hipblasHpr2Fn_64
+        = arg.api == FORTRAN_64 ? hipblasHpr2_64<T, true> : hipblasHpr2_64<T, false>;
 
     int N    = arg.N;
     int incx = arg.incx;
@@ -136,10 +141,9 @@ void testing_hpr2(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || !incy;
     if(invalid_size || !N)
     {
-        hipblasStatus_t actual
-            = hipblasHpr2Fn(handle, uplo, N, nullptr, nullptr, incx, nullptr, incy, nullptr);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasHpr2Fn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr, incy, nullptr));
         return;
     }
 
@@ -180,13 +184,13 @@ void testing_hpr2(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHpr2Fn(handle, uplo, N, (T*)&h_alpha, dx, incx, dy, incy, dA));
+        DAPI_CHECK(hipblasHpr2Fn, (handle, uplo, N, (T*)&h_alpha, dx, incx, dy, incy, dA));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHpr2Fn(handle, uplo, N, d_alpha, dx, incx, dy, incy, dA));
+        DAPI_CHECK(hipblasHpr2Fn, (handle, uplo, N, d_alpha, dx, incx, dy, incy, dA));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -224,7 +228,7 @@ void testing_hpr2(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHpr2Fn(handle, uplo, N, d_alpha, dx, incx, dy, incy, dA));
+            DAPI_CHECK(hipblasHpr2Fn, (handle, uplo, N, d_alpha, dx, incx, dy, incy, dA));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -44,6 +44,8 @@ void testing_hpr2_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpr2BatchedFn
         = FORTRAN ? hipblasHpr2Batched<T, true> : hipblasHpr2Batched<T, false>;
+    auto hipblasHpr2BatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasHpr2Batched_64<T, true> : hipblasHpr2Batched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -75,99 +77,106 @@ void testing_hpr2_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dx(N, incx, batch_count);
         device_batch_vector<T> dy(N, incy, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasHpr2BatchedFn(nullptr,
-                                                   uplo,
-                                                   N,
-                                                   alpha,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   dA.ptr_on_device(),
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasHpr2BatchedFn(handle,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   N,
-                                                   alpha,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   dA.ptr_on_device(),
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHpr2BatchedFn(handle,
-                                                   (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                   N,
-                                                   alpha,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   dA.ptr_on_device(),
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasHpr2BatchedFn(handle,
-                                                   uplo,
-                                                   N,
-                                                   nullptr,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   dy.ptr_on_device(),
-                                                   incy,
-                                                   dA.ptr_on_device(),
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHpr2BatchedFn,
+                    (nullptr,
+                     uplo,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dy.ptr_on_device(),
+                     incy,
+                     dA.ptr_on_device(),
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHpr2BatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dy.ptr_on_device(),
+                     incy,
+                     dA.ptr_on_device(),
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHpr2BatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dy.ptr_on_device(),
+                     incy,
+                     dA.ptr_on_device(),
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHpr2BatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     dx.ptr_on_device(),
+                     incx,
+                     dy.ptr_on_device(),
+                     incy,
+                     dA.ptr_on_device(),
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasHpr2BatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       alpha,
-                                                       nullptr,
-                                                       incx,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       dA.ptr_on_device(),
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasHpr2BatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       alpha,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       nullptr,
-                                                       incy,
-                                                       dA.ptr_on_device(),
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasHpr2BatchedFn(handle,
-                                                       uplo,
-                                                       N,
-                                                       alpha,
-                                                       dx.ptr_on_device(),
-                                                       incx,
-                                                       dy.ptr_on_device(),
-                                                       incy,
-                                                       nullptr,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpr2BatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         nullptr,
+                         incx,
+                         dy.ptr_on_device(),
+                         incy,
+                         dA.ptr_on_device(),
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpr2BatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dx.ptr_on_device(),
+                         incx,
+                         nullptr,
+                         incy,
+                         dA.ptr_on_device(),
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHpr2BatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dx.ptr_on_device(),
+                         incx,
+                         dy.ptr_on_device(),
+                         incy,
+                         nullptr,
+                         batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHpr2BatchedFn(
-            handle, uplo, 0, nullptr, nullptr, incx, nullptr, incy, nullptr, batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasHpr2BatchedFn(
-            handle, uplo, N, nullptr, nullptr, incx, nullptr, incy, nullptr, 0));
+        DAPI_CHECK(hipblasHpr2BatchedFn,
+                   (handle, uplo, 0, nullptr, nullptr, incx, nullptr, incy, nullptr, batch_count));
+        DAPI_CHECK(hipblasHpr2BatchedFn,
+                   (handle, uplo, N, nullptr, nullptr, incx, nullptr, incy, nullptr, 0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHpr2BatchedFn(
-            handle, uplo, N, zero, nullptr, incx, nullptr, incy, nullptr, batch_count));
+        DAPI_CHECK(hipblasHpr2BatchedFn,
+                   (handle, uplo, N, zero, nullptr, incx, nullptr, incy, nullptr, batch_count));
     }
 }
 
@@ -177,6 +186,8 @@ void testing_hpr2_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHpr2BatchedFn
         = FORTRAN ? hipblasHpr2Batched<T, true> : hipblasHpr2Batched<T, false>;
+    auto hipblasHpr2BatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasHpr2Batched_64<T, true> : hipblasHpr2Batched_64<T, false>;
 
     int N           = arg.N;
     int incx        = arg.incx;
@@ -197,10 +208,9 @@ void testing_hpr2_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || !incy || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasHpr2BatchedFn(
-            handle, uplo, N, nullptr, nullptr, incx, nullptr, incy, nullptr, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasHpr2BatchedFn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr, incy, nullptr, batch_count));
         return;
     }
 
@@ -238,31 +248,33 @@ void testing_hpr2_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHpr2BatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 (T*)&h_alpha,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 dA.ptr_on_device(),
-                                                 batch_count));
+        DAPI_CHECK(hipblasHpr2BatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    (T*)&h_alpha,
+                    dx.ptr_on_device(),
+                    incx,
+                    dy.ptr_on_device(),
+                    incy,
+                    dA.ptr_on_device(),
+                    batch_count));
 
         CHECK_HIP_ERROR(hA_host.transfer_from(dA));
         CHECK_HIP_ERROR(dA.transfer_from(hA));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHpr2BatchedFn(handle,
-                                                 uplo,
-                                                 N,
-                                                 d_alpha,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 dy.ptr_on_device(),
-                                                 incy,
-                                                 dA.ptr_on_device(),
-                                                 batch_count));
+        DAPI_CHECK(hipblasHpr2BatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    d_alpha,
+                    dx.ptr_on_device(),
+                    incx,
+                    dy.ptr_on_device(),
+                    incy,
+                    dA.ptr_on_device(),
+                    batch_count));
 
         CHECK_HIP_ERROR(hA_device.transfer_from(dA));
 
@@ -303,16 +315,17 @@ void testing_hpr2_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHpr2BatchedFn(handle,
-                                                     uplo,
-                                                     N,
-                                                     d_alpha,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     dA.ptr_on_device(),
-                                                     batch_count));
+            DAPI_CHECK(hipblasHpr2BatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        d_alpha,
+                        dx.ptr_on_device(),
+                        incx,
+                        dy.ptr_on_device(),
+                        incy,
+                        dA.ptr_on_device(),
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -44,6 +44,9 @@ void testing_hpr_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHprBatchedFn
         = FORTRAN ? hipblasHprBatched<T, U, true> : hipblasHprBatched<T, U, false>;
+    auto hipblasHprBatchedFn_64 = arg.api == FORTRAN_64
+                                      ? hipblasHprBatched_64<T, U, true>
+                                      : hipblasHprBatched_64<T, U, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -73,61 +76,55 @@ void testing_hpr_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dA(A_size, 1, batch_count);
         device_batch_vector<T> dx(N, incx, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHprBatchedFn(
-                nullptr, uplo, N, alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasHprBatchedFn(handle,
-                                                  HIPBLAS_FILL_MODE_FULL,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHprBatchedFn(handle,
-                                                  (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasHprBatchedFn(handle,
-                                                  uplo,
-                                                  N,
-                                                  nullptr,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasHprBatchedFn,
+            (nullptr, uplo, N, alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHprBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHprBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     batch_count));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasHprBatchedFn,
+            (handle, uplo, N, nullptr, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHprBatchedFn(
-                    handle, uplo, N, alpha, nullptr, incx, dA.ptr_on_device(), batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHprBatchedFn(
-                    handle, uplo, N, alpha, dx.ptr_on_device(), incx, nullptr, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHprBatchedFn,
+                        (handle, uplo, N, alpha, nullptr, incx, dA.ptr_on_device(), batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHprBatchedFn,
+                        (handle, uplo, N, alpha, dx.ptr_on_device(), incx, nullptr, batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasHprBatchedFn(handle, uplo, 0, nullptr, nullptr, incx, nullptr, batch_count));
-        CHECK_HIPBLAS_ERROR(
-            hipblasHprBatchedFn(handle, uplo, N, nullptr, nullptr, incx, nullptr, 0));
+        DAPI_CHECK(
+            hipblasHprBatchedFn, (handle, uplo, 0, nullptr, nullptr, incx, nullptr, batch_count));
+        DAPI_CHECK(hipblasHprBatchedFn, (handle, uplo, N, nullptr, nullptr, incx, nullptr, 0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasHprBatchedFn(handle, uplo, N, zero, nullptr, incx, nullptr, batch_count));
+        DAPI_CHECK(
+            hipblasHprBatchedFn, (handle, uplo, N, zero, nullptr, incx, nullptr, batch_count));
     }
 }
 
@@ -138,6 +135,9 @@ void testing_hpr_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHprBatchedFn
         = FORTRAN ? hipblasHprBatched<T, U, true> : hipblasHprBatched<T, U, false>;
+    auto hipblasHprBatchedFn_64 = arg.api == FORTRAN_64
+                                      ? hipblasHprBatched_64<T, U, true>
+                                      : hipblasHprBatched_64<T, U, false>;
 
     hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
     int               N           = arg.N;
@@ -157,10 +157,9 @@ void testing_hpr_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual
-            = hipblasHprBatchedFn(handle, uplo, N, nullptr, nullptr, incx, nullptr, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasHprBatchedFn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr, batch_count));
         return;
     }
 
@@ -193,21 +192,23 @@ void testing_hpr_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHprBatchedFn(handle,
-                                                uplo,
-                                                N,
-                                                (U*)&h_alpha,
-                                                dx.ptr_on_device(),
-                                                incx,
-                                                dA.ptr_on_device(),
-                                                batch_count));
+        DAPI_CHECK(hipblasHprBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    (U*)&h_alpha,
+                    dx.ptr_on_device(),
+                    incx,
+                    dA.ptr_on_device(),
+                    batch_count));
 
         CHECK_HIP_ERROR(hA_host.transfer_from(dA));
         CHECK_HIP_ERROR(dA.transfer_from(hA));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHprBatchedFn(
-            handle, uplo, N, d_alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
+        DAPI_CHECK(
+            hipblasHprBatchedFn,
+            (handle, uplo, N, d_alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
 
         CHECK_HIP_ERROR(hA_device.transfer_from(dA));
 
@@ -248,14 +249,15 @@ void testing_hpr_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHprBatchedFn(handle,
-                                                    uplo,
-                                                    N,
-                                                    d_alpha,
-                                                    dx.ptr_on_device(),
-                                                    incx,
-                                                    dA.ptr_on_device(),
-                                                    batch_count));
+            DAPI_CHECK(hipblasHprBatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        d_alpha,
+                        dx.ptr_on_device(),
+                        incx,
+                        dA.ptr_on_device(),
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -45,6 +45,9 @@ void testing_hpr_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHprStridedBatchedFn
         = FORTRAN ? hipblasHprStridedBatched<T, U, true> : hipblasHprStridedBatched<T, U, false>;
+    auto hipblasHprStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                             ? hipblasHprStridedBatched_64<T, U, true>
+                                             : hipblasHprStridedBatched_64<T, U, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -76,60 +79,59 @@ void testing_hpr_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dA(strideA * batch_count);
         device_vector<T> dx(stridex * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHprStridedBatchedFn(
-                nullptr, uplo, N, alpha, dx, incx, stridex, dA, strideA, batch_count),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasHprStridedBatchedFn(handle,
-                                                         HIPBLAS_FILL_MODE_FULL,
-                                                         N,
-                                                         alpha,
-                                                         dx,
-                                                         incx,
-                                                         stridex,
-                                                         dA,
-                                                         strideA,
-                                                         batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHprStridedBatchedFn(handle,
-                                                         (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                         N,
-                                                         alpha,
-                                                         dx,
-                                                         incx,
-                                                         stridex,
-                                                         dA,
-                                                         strideA,
-                                                         batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHprStridedBatchedFn(
-                handle, uplo, N, nullptr, dx, incx, stridex, dA, strideA, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHprStridedBatchedFn,
+                    (nullptr, uplo, N, alpha, dx, incx, stridex, dA, strideA, batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHprStridedBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dA,
+                     strideA,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHprStridedBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dA,
+                     strideA,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHprStridedBatchedFn,
+                    (handle, uplo, N, nullptr, dx, incx, stridex, dA, strideA, batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHprStridedBatchedFn(
-                    handle, uplo, N, alpha, nullptr, incx, stridex, dA, strideA, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHprStridedBatchedFn(
-                    handle, uplo, N, alpha, dx, incx, stridex, nullptr, strideA, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHprStridedBatchedFn,
+                        (handle, uplo, N, alpha, nullptr, incx, stridex, dA, strideA, batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHprStridedBatchedFn,
+                        (handle, uplo, N, alpha, dx, incx, stridex, nullptr, strideA, batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHprStridedBatchedFn(
-            handle, uplo, 0, nullptr, nullptr, incx, stridex, nullptr, strideA, batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasHprStridedBatchedFn(
-            handle, uplo, N, nullptr, nullptr, incx, stridex, nullptr, strideA, 0));
+        DAPI_CHECK(
+            hipblasHprStridedBatchedFn,
+            (handle, uplo, 0, nullptr, nullptr, incx, stridex, nullptr, strideA, batch_count));
+        DAPI_CHECK(hipblasHprStridedBatchedFn,
+                   (handle, uplo, N, nullptr, nullptr, incx, stridex, nullptr, strideA, 0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHprStridedBatchedFn(
-            handle, uplo, N, zero, nullptr, incx, stridex, nullptr, strideA, batch_count));
+        DAPI_CHECK(hipblasHprStridedBatchedFn,
+                   (handle, uplo, N, zero, nullptr, incx, stridex, nullptr, strideA, batch_count));
     }
 }
 
@@ -140,6 +142,9 @@ void testing_hpr_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHprStridedBatchedFn
         = FORTRAN ? hipblasHprStridedBatched<T, U, true> : hipblasHprStridedBatched<T, U, false>;
+    auto hipblasHprStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                             ? hipblasHprStridedBatched_64<T, U, true>
+                                             : hipblasHprStridedBatched_64<T, U, false>;
 
     hipblasFillMode_t uplo         = char2hipblas_fill(arg.uplo);
     int               N            = arg.N;
@@ -161,10 +166,10 @@ void testing_hpr_strided_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasHprStridedBatchedFn(
-            handle, uplo, N, nullptr, nullptr, incx, stride_x, nullptr, stride_A, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT(
+            (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+            hipblasHprStridedBatchedFn,
+            (handle, uplo, N, nullptr, nullptr, incx, stride_x, nullptr, stride_A, batch_count));
         return;
     }
 
@@ -203,15 +208,15 @@ void testing_hpr_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHprStridedBatchedFn(
-            handle, uplo, N, (U*)&h_alpha, dx, incx, stride_x, dA, stride_A, batch_count));
+        DAPI_CHECK(hipblasHprStridedBatchedFn,
+                   (handle, uplo, N, (U*)&h_alpha, dx, incx, stride_x, dA, stride_A, batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHprStridedBatchedFn(
-            handle, uplo, N, d_alpha, dx, incx, stride_x, dA, stride_A, batch_count));
+        DAPI_CHECK(hipblasHprStridedBatchedFn,
+                   (handle, uplo, N, d_alpha, dx, incx, stride_x, dA, stride_A, batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -255,8 +260,8 @@ void testing_hpr_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHprStridedBatchedFn(
-                handle, uplo, N, d_alpha, dx, incx, stride_x, dA, stride_A, batch_count));
+            DAPI_CHECK(hipblasHprStridedBatchedFn,
+                       (handle, uplo, N, d_alpha, dx, incx, stride_x, dA, stride_A, batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
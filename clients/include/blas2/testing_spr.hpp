@@ -42,6 +42,7 @@ void testing_spr_bad_arg(const Arguments& arg)
 {
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSprFn = FORTRAN ? hipblasSpr<T, true> : hipblasSpr<T, false>;
+    auto hipblasSprFn_64 = arg.api == FORTRAN_64 ? hipblasSpr_64<T, true> : hipblasSpr_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -70,34 +71,38 @@ void testing_spr_bad_arg(const Arguments& arg)
         device_vector<T> dA(A_size);
         device_vector<T> dx(N * incx);
 
-        EXPECT_HIPBLAS_STATUS(hipblasSprFn(nullptr, uplo, N, alpha, dx, incx, dA),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasSprFn(handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dA),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSprFn(handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dA),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED, hipblasSprFn, (nullptr, uplo, N, alpha, dx, incx, dA));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSprFn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dA));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSprFn,
+                    (handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dA));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasSprFn(handle, uplo, N, nullptr, dx, incx, dA),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSprFn,
+                        (handle, uplo, N, nullptr, dx, incx, dA));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(hipblasSprFn(handle, uplo, N, alpha, nullptr, incx, dA),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasSprFn(handle, uplo, N, alpha, dx, incx, nullptr),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSprFn,
+                            (handle, uplo, N, alpha, nullptr, incx, dA));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSprFn,
+                            (handle, uplo, N, alpha, dx, incx, nullptr));
             }
 
             // With alpha == 0, can have all nullptrs
-            CHECK_HIPBLAS_ERROR(hipblasSprFn(handle, uplo, N, zero, nullptr, incx, nullptr));
+            DAPI_CHECK(hipblasSprFn, (handle, uplo, N, zero, nullptr, incx, nullptr));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSprFn(handle, uplo, 0, nullptr, nullptr, incx, nullptr));
+        DAPI_CHECK(hipblasSprFn, (handle, uplo, 0, nullptr, nullptr, incx, nullptr));
     }
 }
 
@@ -106,6 +111,7 @@ void testing_spr(const Arguments& arg)
 {
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSprFn = FORTRAN ? hipblasSpr<T, true> : hipblasSpr<T, false>;
+    auto hipblasSprFn_64 = arg.api == FORTRAN_64 ? hipblasSpr_64<T, true> : hipblasSpr_64<T, false>;
 
     hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
     int               N    = arg.N;
@@ -122,9 +128,9 @@ void testing_spr(const Arguments& arg)
     bool invalid_size = N < 0 || !incx;
     if(invalid_size || !N)
     {
-        hipblasStatus_t actual = hipblasSprFn(handle, uplo, N, nullptr, nullptr, incx, nullptr);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasSprFn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr));
         return;
     }
 
@@ -160,13 +166,13 @@ void testing_spr(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSprFn(handle, uplo, N, &h_alpha, dx, incx, dA));
+        DAPI_CHECK(hipblasSprFn, (handle, uplo, N, &h_alpha, dx, incx, dA));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSprFn(handle, uplo, N, d_alpha, dx, incx, dA));
+        DAPI_CHECK(hipblasSprFn, (handle, uplo, N, d_alpha, dx, incx, dA));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -204,7 +210,7 @@ void testing_spr(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSprFn(handle, uplo, N, d_alpha, dx, incx, dA));
+            DAPI_CHECK(hipblasSprFn, (handle, uplo, N, d_alpha, dx, incx, dA));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -44,6 +44,9 @@ void testing_spr2_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSpr2StridedBatchedFn
         = FORTRAN ? hipblasSpr2StridedBatched<T, true> : hipblasSpr2StridedBatched<T, false>;
+    auto hipblasSpr2StridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasSpr2StridedBatched_64<T, true>
+                                              : hipblasSpr2StridedBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -78,153 +81,163 @@ void testing_spr2_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dx(stridex * batch_count);
         device_vector<T> dy(stridey * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasSpr2StridedBatchedFn(nullptr,
-                                                          uplo,
-                                                          N,
-                                                          alpha,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasSpr2StridedBatchedFn(handle,
-                                                          HIPBLAS_FILL_MODE_FULL,
-                                                          N,
-                                                          alpha,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasSpr2StridedBatchedFn(handle,
-                                                          (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                          N,
-                                                          alpha,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasSpr2StridedBatchedFn(handle,
-                                                          uplo,
-                                                          N,
-                                                          nullptr,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasSpr2StridedBatchedFn,
+                    (nullptr,
+                     uplo,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     strideA,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSpr2StridedBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     strideA,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSpr2StridedBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     strideA,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSpr2StridedBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     strideA,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasSpr2StridedBatchedFn(handle,
-                                                              uplo,
-                                                              N,
-                                                              alpha,
-                                                              nullptr,
-                                                              incx,
-                                                              stridex,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              dA,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasSpr2StridedBatchedFn(handle,
-                                                              uplo,
-                                                              N,
-                                                              alpha,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              nullptr,
-                                                              incy,
-                                                              stridey,
-                                                              dA,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasSpr2StridedBatchedFn(handle,
-                                                              uplo,
-                                                              N,
-                                                              alpha,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              nullptr,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSpr2StridedBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         nullptr,
+                         incx,
+                         stridex,
+                         dy,
+                         incy,
+                         stridey,
+                         dA,
+                         strideA,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSpr2StridedBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dx,
+                         incx,
+                         stridex,
+                         nullptr,
+                         incy,
+                         stridey,
+                         dA,
+                         strideA,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSpr2StridedBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dx,
+                         incx,
+                         stridex,
+                         dy,
+                         incy,
+                         stridey,
+                         nullptr,
+                         strideA,
+                         batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSpr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        0,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        nullptr,
-                                                        strideA,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasSpr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        nullptr,
-                                                        strideA,
-                                                        0));
+        DAPI_CHECK(hipblasSpr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    0,
+                    nullptr,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    strideA,
+                    batch_count));
+        DAPI_CHECK(hipblasSpr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    nullptr,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    strideA,
+                    0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSpr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        zero,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        nullptr,
-                                                        strideA,
-                                                        batch_count));
+        DAPI_CHECK(hipblasSpr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    zero,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    strideA,
+                    batch_count));
     }
 }
 
@@ -234,6 +247,9 @@ void testing_spr2_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSpr2StridedBatchedFn
         = FORTRAN ? hipblasSpr2StridedBatched<T, true> : hipblasSpr2StridedBatched<T, false>;
+    auto hipblasSpr2StridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasSpr2StridedBatched_64<T, true>
+                                              : hipblasSpr2StridedBatched_64<T, false>;
 
     hipblasFillMode_t uplo         = char2hipblas_fill(arg.uplo);
     int               N            = arg.N;
@@ -260,21 +276,21 @@ void testing_spr2_strided_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || !incy || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasSpr2StridedBatchedFn(handle,
-                                                             uplo,
-                                                             N,
-                                                             nullptr,
-                                                             nullptr,
-                                                             incx,
-                                                             stridex,
-                                                             nullptr,
-                                                             incy,
-                                                             stridey,
-                                                             nullptr,
-                                                             strideA,
-                                                             batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasSpr2StridedBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     nullptr,
+                     incx,
+                     stridex,
+                     nullptr,
+                     incy,
+                     stridey,
+                     nullptr,
+                     strideA,
+                     batch_count));
         return;
     }
 
@@ -314,37 +330,39 @@ void testing_spr2_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSpr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        &h_alpha,
-                                                        dx,
-                                                        incx,
-                                                        stridex,
-                                                        dy,
-                                                        incy,
-                                                        stridey,
-                                                        dA,
-                                                        strideA,
-                                                        batch_count));
+        DAPI_CHECK(hipblasSpr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    &h_alpha,
+                    dx,
+                    incx,
+                    stridex,
+                    dy,
+                    incy,
+                    stridey,
+                    dA,
+                    strideA,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSpr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        d_alpha,
-                                                        dx,
-                                                        incx,
-                                                        stridex,
-                                                        dy,
-                                                        incy,
-                                                        stridey,
-                                                        dA,
-                                                        strideA,
-                                                        batch_count));
+        DAPI_CHECK(hipblasSpr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    d_alpha,
+                    dx,
+                    incx,
+                    stridex,
+                    dy,
+                    incy,
+                    stridey,
+                    dA,
+                    strideA,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -392,19 +410,20 @@ void testing_spr2_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSpr2StridedBatchedFn(handle,
-                                                            uplo,
-                                                            N,
-                                                            d_alpha,
-                                                            dx,
-                                                            incx,
-                                                            stridex,
-                                                            dy,
-                                                            incy,
-                                                            stridey,
-                                                            dA,
-                                                            strideA,
-                                                            batch_count));
+            DAPI_CHECK(hipblasSpr2StridedBatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        d_alpha,
+                        dx,
+                        incx,
+                        stridex,
+                        dy,
+                        incy,
+                        stridey,
+                        dA,
+                        strideA,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -42,6 +42,8 @@ void testing_spr_batched_bad_arg(const Arguments& arg)
 {
     bool FORTRAN             = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSprBatchedFn = FORTRAN ? hipblasSprBatched<T, true> : hipblasSprBatched<T, false>;
+    auto hipblasSprBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasSprBatched_64<T, true> : hipblasSprBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -71,61 +73,55 @@ void testing_spr_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dA(A_size, 1, batch_count);
         device_batch_vector<T> dx(N, incx, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSprBatchedFn(
-                nullptr, uplo, N, alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasSprBatchedFn(handle,
-                                                  HIPBLAS_FILL_MODE_FULL,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasSprBatchedFn(handle,
-                                                  (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasSprBatchedFn(handle,
-                                                  uplo,
-                                                  N,
-                                                  nullptr,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasSprBatchedFn,
+            (nullptr, uplo, N, alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSprBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSprBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     batch_count));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasSprBatchedFn,
+            (handle, uplo, N, nullptr, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSprBatchedFn(
-                    handle, uplo, N, alpha, nullptr, incx, dA.ptr_on_device(), batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSprBatchedFn(
-                    handle, uplo, N, alpha, dx.ptr_on_device(), incx, nullptr, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSprBatchedFn,
+                        (handle, uplo, N, alpha, nullptr, incx, dA.ptr_on_device(), batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSprBatchedFn,
+                        (handle, uplo, N, alpha, dx.ptr_on_device(), incx, nullptr, batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasSprBatchedFn(handle, uplo, 0, nullptr, nullptr, incx, nullptr, batch_count));
-        CHECK_HIPBLAS_ERROR(
-            hipblasSprBatchedFn(handle, uplo, N, nullptr, nullptr, incx, nullptr, 0));
+        DAPI_CHECK(
+            hipblasSprBatchedFn, (handle, uplo, 0, nullptr, nullptr, incx, nullptr, batch_count));
+        DAPI_CHECK(hipblasSprBatchedFn, (handle, uplo, N, nullptr, nullptr, incx, nullptr, 0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasSprBatchedFn(handle, uplo, N, zero, nullptr, incx, nullptr, batch_count));
+        DAPI_CHECK(
+            hipblasSprBatchedFn, (handle, uplo, N, zero, nullptr, incx, nullptr, batch_count));
     }
 }
 
@@ -134,6 +130,8 @@ void testing_spr_batched(const Arguments& arg)
 {
     bool FORTRAN             = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSprBatchedFn = FORTRAN ? hipblasSprBatched<T, true> : hipblasSprBatched<T, false>;
+    auto hipblasSprBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasSprBatched_64<T, true> : hipblasSprBatched_64<T, false>;
 
     hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
     int               N           = arg.N;
@@ -152,10 +150,9 @@ void testing_spr_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual
-            = hipblasSprBatchedFn(handle, uplo, N, nullptr, nullptr, incx, nullptr, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasSprBatchedFn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr, batch_count));
         return;
     }
 
@@ -190,15 +187,17 @@ void testing_spr_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSprBatchedFn(
-            handle, uplo, N, &h_alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
+        DAPI_CHECK(
+            hipblasSprBatchedFn,
+            (handle, uplo, N, &h_alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
 
         CHECK_HIP_ERROR(hA_host.transfer_from(dA));
         CHECK_HIP_ERROR(dA.transfer_from(hA));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSprBatchedFn(
-            handle, uplo, N, d_alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
+        DAPI_CHECK(
+            hipblasSprBatchedFn,
+            (handle, uplo, N, d_alpha, dx.ptr_on_device(), incx, dA.ptr_on_device(), batch_count));
 
         CHECK_HIP_ERROR(hA_device.transfer_from(dA));
 
@@ -239,14 +238,15 @@ void testing_spr_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSprBatchedFn(handle,
-                                                    uplo,
-                                                    N,
-                                                    d_alpha,
-                                                    dx.ptr_on_device(),
-                                                    incx,
-                                                    dA.ptr_on_device(),
-                                                    batch_count));
+            DAPI_CHECK(hipblasSprBatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        d_alpha,
+                        dx.ptr_on_device(),
+                        incx,
+                        dA.ptr_on_device(),
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -42,6 +42,7 @@ void testing_syr_bad_arg(const Arguments& arg)
 {
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrFn = FORTRAN ? hipblasSyr<T, true> : hipblasSyr<T, false>;
+    auto hipblasSyrFn_64 = arg.api == FORTRAN_64 ? hipblasSyr_64<T, true> : hipblasSyr_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -70,35 +71,39 @@ void testing_syr_bad_arg(const Arguments& arg)
         device_vector<T> dA(N * lda);
         device_vector<T> dx(N * incx);
 
-        EXPECT_HIPBLAS_STATUS(hipblasSyrFn(nullptr, uplo, N, alpha, dx, incx, dA, lda),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSyrFn(handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dA, lda),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSyrFn(handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dA, lda),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasSyrFn,
+                    (nullptr, uplo, N, alpha, dx, incx, dA, lda));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyrFn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, N, alpha, dx, incx, dA, lda));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSyrFn,
+                    (handle, (hipblasFillMode_t)HIPBLAS_OP_N, N, alpha, dx, incx, dA, lda));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasSyrFn(handle, uplo, N, nullptr, dx, incx, dA, lda),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyrFn,
+                        (handle, uplo, N, nullptr, dx, incx, dA, lda));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-                EXPECT_HIPBLAS_STATUS(hipblasSyrFn(handle, uplo, N, alpha, nullptr, incx, dA, lda),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasSyrFn(handle, uplo, N, alpha, dx, incx, nullptr, lda),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSyrFn,
+                            (handle, uplo, N, alpha, nullptr, incx, dA, lda));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSyrFn,
+                            (handle, uplo, N, alpha, dx, incx, nullptr, lda));
             }
 
             // With alpha == 0, can have all nullptrs
-            CHECK_HIPBLAS_ERROR(hipblasSyrFn(handle, uplo, N, zero, nullptr, incx, nullptr, lda));
+            DAPI_CHECK(hipblasSyrFn, (handle, uplo, N, zero, nullptr, incx, nullptr, lda));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyrFn(handle, uplo, 0, nullptr, nullptr, incx, nullptr, lda));
+        DAPI_CHECK(hipblasSyrFn, (handle, uplo, 0, nullptr, nullptr, incx, nullptr, lda));
     }
 }
 
@@ -107,6 +112,7 @@ void testing_syr(const Arguments& arg)
 {
     bool FORTRAN      = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrFn = FORTRAN ? hipblasSyr<T, true> : hipblasSyr<T, false>;
+    auto hipblasSyrFn_64 = arg.api == FORTRAN_64 ? hipblasSyr_64<T, true> : hipblasSyr_64<T, false>;
 
     hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
     int               N    = arg.N;
@@ -124,10 +130,9 @@ void testing_syr(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || lda < N || lda < 1;
     if(invalid_size || !N)
     {
-        hipblasStatus_t actual
-            = hipblasSyrFn(handle, uplo, N, nullptr, nullptr, incx, nullptr, lda);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasSyrFn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr, lda));
         return;
     }
 
@@ -162,13 +167,13 @@ void testing_syr(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSyrFn(handle, uplo, N, &h_alpha, dx, incx, dA, lda));
+        DAPI_CHECK(hipblasSyrFn, (handle, uplo, N, &h_alpha, dx, incx, dA, lda));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSyrFn(handle, uplo, N, d_alpha, dx, incx, dA, lda));
+        DAPI_CHECK(hipblasSyrFn, (handle, uplo, N, d_alpha, dx, incx, dA, lda));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -206,7 +211,7 @@ void testing_syr(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSyrFn(handle, uplo, N, d_alpha, dx, incx, dA, lda));
+            DAPI_CHECK(hipblasSyrFn, (handle, uplo, N, d_alpha, dx, incx, dA, lda));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
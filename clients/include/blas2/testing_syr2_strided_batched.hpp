@@ -51,6 +51,9 @@ void testing_syr2_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyr2StridedBatchedFn
         = FORTRAN ? hipblasSyr2StridedBatched<T, true> : hipblasSyr2StridedBatched<T, false>;
+    auto hipblasSyr2StridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasSyr2StridedBatched_64<T, true>
+                                              : hipblasSyr2StridedBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -85,163 +88,173 @@ void testing_syr2_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dx(stridex * batch_count);
         device_vector<T> dy(stridey * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasSyr2StridedBatchedFn(nullptr,
-                                                          uplo,
-                                                          N,
-                                                          alpha,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasSyr2StridedBatchedFn(handle,
-                                                          HIPBLAS_FILL_MODE_FULL,
-                                                          N,
-                                                          alpha,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasSyr2StridedBatchedFn(handle,
-                                                          (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                          N,
-                                                          alpha,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasSyr2StridedBatchedFn(handle,
-                                                          uplo,
-                                                          N,
-                                                          nullptr,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dy,
-                                                          incy,
-                                                          stridey,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasSyr2StridedBatchedFn,
+                    (nullptr,
+                     uplo,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyr2StridedBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSyr2StridedBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyr2StridedBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     dx,
+                     incx,
+                     stridex,
+                     dy,
+                     incy,
+                     stridey,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(hipblasSyr2StridedBatchedFn(handle,
-                                                              uplo,
-                                                              N,
-                                                              alpha,
-                                                              nullptr,
-                                                              incx,
-                                                              stridex,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasSyr2StridedBatchedFn(handle,
-                                                              uplo,
-                                                              N,
-                                                              alpha,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              nullptr,
-                                                              incy,
-                                                              stridey,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasSyr2StridedBatchedFn(handle,
-                                                              uplo,
-                                                              N,
-                                                              alpha,
-                                                              dx,
-                                                              incx,
-                                                              stridex,
-                                                              dy,
-                                                              incy,
-                                                              stridey,
-                                                              nullptr,
-                                                              lda,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyr2StridedBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         nullptr,
+                         incx,
+                         stridex,
+                         dy,
+                         incy,
+                         stridey,
+                         dA,
+                         lda,
+                         strideA,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyr2StridedBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dx,
+                         incx,
+                         stridex,
+                         nullptr,
+                         incy,
+                         stridey,
+                         dA,
+                         lda,
+                         strideA,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyr2StridedBatchedFn,
+                        (handle,
+                         uplo,
+                         N,
+                         alpha,
+                         dx,
+                         incx,
+                         stridex,
+                         dy,
+                         incy,
+                         stridey,
+                         nullptr,
+                         lda,
+                         strideA,
+                         batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        0,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasSyr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        nullptr,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        0));
+        DAPI_CHECK(hipblasSyr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    0,
+                    nullptr,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    lda,
+                    strideA,
+                    batch_count));
+        DAPI_CHECK(hipblasSyr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    nullptr,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    lda,
+                    strideA,
+                    0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        zero,
-                                                        nullptr,
-                                                        incx,
-                                                        stridex,
-                                                        nullptr,
-                                                        incy,
-                                                        stridey,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        batch_count));
+        DAPI_CHECK(hipblasSyr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    zero,
+                    nullptr,
+                    incx,
+                    stridex,
+                    nullptr,
+                    incy,
+                    stridey,
+                    nullptr,
+                    lda,
+                    strideA,
+                    batch_count));
     }
 }
 
@@ -251,6 +264,9 @@ void testing_syr2_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyr2StridedBatchedFn
         = FORTRAN ? hipblasSyr2StridedBatched<T, true> : hipblasSyr2StridedBatched<T, false>;
+    auto hipblasSyr2StridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasSyr2StridedBatched_64<T, true>
+                                              : hipblasSyr2StridedBatched_64<T, false>;
 
     hipblasFillMode_t uplo         = char2hipblas_fill(arg.uplo);
     int               N            = arg.N;
@@ -277,22 +293,22 @@ void testing_syr2_strided_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || !incy || lda < N || lda < 1 || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasSyr2StridedBatchedFn(handle,
-                                                             uplo,
-                                                             N,
-                                                             nullptr,
-                                                             nullptr,
-                                                             incx,
-                                                             stridex,
-                                                             nullptr,
-                                                             incy,
-                                                             stridey,
-                                                             nullptr,
-                                                             lda,
-                                                             strideA,
-                                                             batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasSyr2StridedBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     nullptr,
+                     incx,
+                     stridex,
+                     nullptr,
+                     incy,
+                     stridey,
+                     nullptr,
+                     lda,
+                     strideA,
+                     batch_count));
         return;
     }
 
@@ -333,39 +349,41 @@ void testing_syr2_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSyr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        &h_alpha,
-                                                        dx,
-                                                        incx,
-                                                        stridex,
-                                                        dy,
-                                                        incy,
-                                                        stridey,
-                                                        dA,
-                                                        lda,
-                                                        strideA,
-                                                        batch_count));
+        DAPI_CHECK(hipblasSyr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    &h_alpha,
+                    dx,
+                    incx,
+                    stridex,
+                    dy,
+                    incy,
+                    stridey,
+                    dA,
+                    lda,
+                    strideA,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSyr2StridedBatchedFn(handle,
-                                                        uplo,
-                                                        N,
-                                                        d_alpha,
-                                                        dx,
-                                                        incx,
-                                                        stridex,
-                                                        dy,
-                                                        incy,
-                                                        stridey,
-                                                        dA,
-                                                        lda,
-                                                        strideA,
-                                                        batch_count));
+        DAPI_CHECK(hipblasSyr2StridedBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    d_alpha,
+                    dx,
+                    incx,
+                    stridex,
+                    dy,
+                    incy,
+                    stridey,
+                    dA,
+                    lda,
+                    strideA,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -414,20 +432,21 @@ void testing_syr2_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSyr2StridedBatchedFn(handle,
-                                                            uplo,
-                                                            N,
-                                                            d_alpha,
-                                                            dx,
-                                                            incx,
-                                                            stridex,
-                                                            dy,
-                                                            incy,
-                                                            stridey,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            batch_count));
+            DAPI_CHECK(hipblasSyr2StridedBatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        d_alpha,
+                        dx,
+                        incx,
+                        stridex,
+                        dy,
+                        incy,
+                        stridey,
+                        dA,
+                        lda,
+                        strideA,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
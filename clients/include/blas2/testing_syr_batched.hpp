@@ -43,6 +43,8 @@ void testing_syr_batched_bad_arg(const Arguments& arg)
 {
     bool FORTRAN             = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrBatchedFn = FORTRAN ? hipblasSyrBatched<T, true> : hipblasSyrBatched<T, false>;
+    auto hipblasSyrBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasSyrBatched_64<T, true> : hipblasSyrBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -72,70 +74,73 @@ void testing_syr_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dA(N * lda, 1, batch_count);
         device_batch_vector<T> dx(N, incx, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasSyrBatchedFn(nullptr,
-                                                  uplo,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasSyrBatchedFn(handle,
-                                                  HIPBLAS_FILL_MODE_FULL,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasSyrBatchedFn(handle,
-                                                  (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                  N,
-                                                  alpha,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasSyrBatchedFn(handle,
-                                                  uplo,
-                                                  N,
-                                                  nullptr,
-                                                  dx.ptr_on_device(),
-                                                  incx,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasSyrBatchedFn,
+                    (nullptr,
+                     uplo,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     lda,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyrBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     lda,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSyrBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     lda,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyrBatchedFn,
+                    (handle,
+                     uplo,
+                     N,
+                     nullptr,
+                     dx.ptr_on_device(),
+                     incx,
+                     dA.ptr_on_device(),
+                     lda,
+                     batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSyrBatchedFn(
-                    handle, uplo, N, alpha, nullptr, incx, dA.ptr_on_device(), lda, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSyrBatchedFn(
-                    handle, uplo, N, alpha, dx.ptr_on_device(), incx, nullptr, lda, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasSyrBatchedFn,
+                (handle, uplo, N, alpha, nullptr, incx, dA.ptr_on_device(), lda, batch_count));
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasSyrBatchedFn,
+                (handle, uplo, N, alpha, dx.ptr_on_device(), incx, nullptr, lda, batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyrBatchedFn(
-            handle, uplo, 0, nullptr, nullptr, incx, nullptr, lda, batch_count));
-        CHECK_HIPBLAS_ERROR(
-            hipblasSyrBatchedFn(handle, uplo, N, nullptr, nullptr, incx, nullptr, lda, 0));
+        DAPI_CHECK(hipblasSyrBatchedFn,
+                   (handle, uplo, 0, nullptr, nullptr, incx, nullptr, lda, batch_count));
+        DAPI_CHECK(hipblasSyrBatchedFn, (handle, uplo, N, nullptr, nullptr, incx, nullptr, lda, 0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasSyrBatchedFn(handle, uplo, N, zero, nullptr, incx, nullptr, lda, batch_count));
+        DAPI_CHECK(
+            hipblasSyrBatchedFn, (handle, uplo, N, zero, nullptr, incx, nullptr, lda, batch_count));
     }
 }
 
@@ -144,6 +149,8 @@ void testing_syr_batched(const Arguments& arg)
 {
     bool FORTRAN             = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrBatchedFn = FORTRAN ? hipblasSyrBatched<T, true> : hipblasSyrBatched<T, false>;
+    auto hipblasSyrBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasSyrBatched_64<T, true> : hipblasSyrBatched_64<T, false>;
 
     hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
     int               N           = arg.N;
@@ -163,10 +170,9 @@ void testing_syr_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || lda < N || lda < 1 || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasSyrBatchedFn(
-            handle, uplo, N, nullptr, nullptr, incx, nullptr, lda, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasSyrBatchedFn,
+                    (handle, uplo, N, nullptr, nullptr, incx, nullptr, lda, batch_count));
         return;
     }
 
@@ -201,29 +207,31 @@ void testing_syr_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSyrBatchedFn(handle,
-                                                uplo,
-                                                N,
-                                                &h_alpha,
-                                                dx.ptr_on_device(),
-                                                incx,
-                                                dA.ptr_on_device(),
-                                                lda,
-                                                batch_count));
+        DAPI_CHECK(hipblasSyrBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    &h_alpha,
+                    dx.ptr_on_device(),
+                    incx,
+                    dA.ptr_on_device(),
+                    lda,
+                    batch_count));
 
         CHECK_HIP_ERROR(hA_host.transfer_from(dA));
         CHECK_HIP_ERROR(dA.transfer_from(hA));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSyrBatchedFn(handle,
-                                                uplo,
-                                                N,
-                                                d_alpha,
-                                                dx.ptr_on_device(),
-                                                incx,
-                                                dA.ptr_on_device(),
-                                                lda,
-                                                batch_count));
+        DAPI_CHECK(hipblasSyrBatchedFn,
+                   (handle,
+                    uplo,
+                    N,
+                    d_alpha,
+                    dx.ptr_on_device(),
+                    incx,
+                    dA.ptr_on_device(),
+                    lda,
+                    batch_count));
 
         CHECK_HIP_ERROR(hA_device.transfer_from(dA));
 
@@ -264,15 +272,16 @@ void testing_syr_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSyrBatchedFn(handle,
-                                                    uplo,
-                                                    N,
-                                                    d_alpha,
-                                                    dx.ptr_on_device(),
-                                                    incx,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    batch_count));
+            DAPI_CHECK(hipblasSyrBatchedFn,
+                       (handle,
+                        uplo,
+                        N,
+                        d_alpha,
+                        dx.ptr_on_device(),
+                        incx,
+                        dA.ptr_on_device(),
+                        lda,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
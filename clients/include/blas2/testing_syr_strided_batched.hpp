@@ -44,6 +44,9 @@ void testing_syr_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrStridedBatchedFn
         = FORTRAN ? hipblasSyrStridedBatched<T, true> : hipblasSyrStridedBatched<T, false>;
+    auto hipblasSyrStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                             ? hipblasSyrStridedBatched_64<T, true>
+                                             : hipblasSyrStridedBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -75,62 +78,64 @@ void testing_syr_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dA(strideA * batch_count);
         device_vector<T> dx(stridex * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSyrStridedBatchedFn(
-                nullptr, uplo, N, alpha, dx, incx, stridex, dA, lda, strideA, batch_count),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasSyrStridedBatchedFn(handle,
-                                                         HIPBLAS_FILL_MODE_FULL,
-                                                         N,
-                                                         alpha,
-                                                         dx,
-                                                         incx,
-                                                         stridex,
-                                                         dA,
-                                                         lda,
-                                                         strideA,
-                                                         batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasSyrStridedBatchedFn(handle,
-                                                         (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                         N,
-                                                         alpha,
-                                                         dx,
-                                                         incx,
-                                                         stridex,
-                                                         dA,
-                                                         lda,
-                                                         strideA,
-                                                         batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSyrStridedBatchedFn(
-                handle, uplo, N, nullptr, dx, incx, stridex, dA, lda, strideA, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasSyrStridedBatchedFn,
+                    (nullptr, uplo, N, alpha, dx, incx, stridex, dA, lda, strideA, batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyrStridedBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSyrStridedBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     N,
+                     alpha,
+                     dx,
+                     incx,
+                     stridex,
+                     dA,
+                     lda,
+                     strideA,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyrStridedBatchedFn,
+                    (handle, uplo, N, nullptr, dx, incx, stridex, dA, lda, strideA, batch_count));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
             // For device mode in rocBLAS we don't have checks for dA, dx as we may be able to quick return
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSyrStridedBatchedFn(
-                    handle, uplo, N, alpha, nullptr, incx, stridex, dA, lda, strideA, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSyrStridedBatchedFn(
-                    handle, uplo, N, alpha, dx, incx, stridex, nullptr, lda, strideA, batch_count),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasSyrStridedBatchedFn,
+                (handle, uplo, N, alpha, nullptr, incx, stridex, dA, lda, strideA, batch_count));
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasSyrStridedBatchedFn,
+                (handle, uplo, N, alpha, dx, incx, stridex, nullptr, lda, strideA, batch_count));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyrStridedBatchedFn(
-            handle, uplo, 0, nullptr, nullptr, incx, stridex, nullptr, lda, strideA, batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasSyrStridedBatchedFn(
-            handle, uplo, N, nullptr, nullptr, incx, stridex, nullptr, lda, strideA, 0));
+        DAPI_CHECK(
+            hipblasSyrStridedBatchedFn,
+            (handle, uplo, 0, nullptr, nullptr, incx, stridex, nullptr, lda, strideA, batch_count));
+        DAPI_CHECK(hipblasSyrStridedBatchedFn,
+                   (handle, uplo, N, nullptr, nullptr, incx, stridex, nullptr, lda, strideA, 0));
 
         // With alpha == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyrStridedBatchedFn(
-            handle, uplo, N, zero, nullptr, incx, stridex, nullptr, lda, strideA, batch_count));
+        DAPI_CHECK(
+            hipblasSyrStridedBatchedFn,
+            (handle, uplo, N, zero, nullptr, incx, stridex, nullptr, lda, strideA, batch_count));
     }
 }
 
@@ -140,6 +145,9 @@ void testing_syr_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrStridedBatchedFn
         = FORTRAN ? hipblasSyrStridedBatched<T, true> : hipblasSyrStridedBatched<T, false>;
+    auto hipblasSyrStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                             ? hipblasSyrStridedBatched_64<T, true>
+                                             : hipblasSyrStridedBatched_64<T, false>;
 
     hipblasFillMode_t uplo         = char2hipblas_fill(arg.uplo);
     int               N            = arg.N;
@@ -162,10 +170,10 @@ void testing_syr_strided_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || lda < N || lda < 1 || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasSyrStridedBatchedFn(
-            handle, uplo, N, nullptr, nullptr, incx, stridex, nullptr, lda, strideA, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT(
+            (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+            hipblasSyrStridedBatchedFn,
+            (handle, uplo, N, nullptr, nullptr, incx, stridex, nullptr, lda, strideA, batch_count));
         return;
     }
 
@@ -202,15 +210,15 @@ void testing_syr_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSyrStridedBatchedFn(
-            handle, uplo, N, &h_alpha, dx, incx, stridex, dA, lda, strideA, batch_count));
+        DAPI_CHECK(hipblasSyrStridedBatchedFn,
+                   (handle, uplo, N, &h_alpha, dx, incx, stridex, dA, lda, strideA, batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSyrStridedBatchedFn(
-            handle, uplo, N, d_alpha, dx, incx, stridex, dA, lda, strideA, batch_count));
+        DAPI_CHECK(hipblasSyrStridedBatchedFn,
+                   (handle, uplo, N, d_alpha, dx, incx, stridex, dA, lda, strideA, batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
 
@@ -252,8 +260,9 @@ void testing_syr_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSyrStridedBatchedFn(
-                handle, uplo, N, d_alpha, dx, incx, stridex, dA, lda, strideA, batch_count));
+            DAPI_CHECK(
+                hipblasSyrStridedBatchedFn,
+                (handle, uplo, N, d_alpha, dx, incx, stridex, dA, lda, strideA, batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
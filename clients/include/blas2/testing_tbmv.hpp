@@ -42,6 +42,8 @@ void testing_tbmv_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTbmvFn = FORTRAN ? hipblasTbmv<T, true> : hipblasTbmv<T, false>;
+    auto hipblasTbmvFn_64
+        = arg.api == FORTRAN_64 ? hipblasTbmv_64<T, true> : hipblasTbmv_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -59,51 +61,53 @@ void testing_tbmv_bad_arg(const Arguments& arg)
         device_vector<T> dA(N * lda);
         device_vector<T> dx(N * incx);
 
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvFn(nullptr, uplo, transA, diag, N, K, dA, lda, dx, incx),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTbmvFn(handle, HIPBLAS_FILL_MODE_FULL, transA, diag, N, K, dA, lda, dx, incx),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTbmvFn(
-                handle, (hipblasFillMode_t)HIPBLAS_OP_N, transA, diag, N, K, dA, lda, dx, incx),
-            HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvFn(handle,
-                                            uplo,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            diag,
-                                            N,
-                                            K,
-                                            dA,
-                                            lda,
-                                            dx,
-                                            incx),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvFn(handle,
-                                            uplo,
-                                            transA,
-                                            (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                            N,
-                                            K,
-                                            dA,
-                                            lda,
-                                            dx,
-                                            incx),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTbmvFn,
+                    (nullptr, uplo, transA, diag, N, K, dA, lda, dx, incx));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTbmvFn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, transA, diag, N, K, dA, lda, dx, incx));
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_ENUM,
+            hipblasTbmvFn,
+            (handle, (hipblasFillMode_t)HIPBLAS_OP_N, transA, diag, N, K, dA, lda, dx, incx));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbmvFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     N,
+                     K,
+                     dA,
+                     lda,
+                     dx,
+                     incx));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbmvFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     dA,
+                     lda,
+                     dx,
+                     incx));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasTbmvFn(handle, uplo, transA, diag, N, K, nullptr, lda, dx, incx),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasTbmvFn(handle, uplo, transA, diag, N, K, dA, lda, nullptr, incx),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTbmvFn,
+                        (handle, uplo, transA, diag, N, K, nullptr, lda, dx, incx));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTbmvFn,
+                        (handle, uplo, transA, diag, N, K, dA, lda, nullptr, incx));
         }
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(
-            hipblasTbmvFn(handle, uplo, transA, diag, 0, K, nullptr, lda, nullptr, incx));
+        DAPI_CHECK(hipblasTbmvFn, (handle, uplo, transA, diag, 0, K, nullptr, lda, nullptr, incx));
     }
 }
 
@@ -112,6 +116,8 @@ void testing_tbmv(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTbmvFn = FORTRAN ? hipblasTbmv<T, true> : hipblasTbmv<T, false>;
+    auto hipblasTbmvFn_64
+        = arg.api == FORTRAN_64 ? hipblasTbmv_64<T, true> : hipblasTbmv_64<T, false>;
 
     hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
     hipblasOperation_t transA = char2hipblas_operation(arg.transA);
@@ -132,10 +138,9 @@ void testing_tbmv(const Arguments& arg)
     bool invalid_size = M < 0 || K < 0 || lda < K + 1 || !incx;
     if(invalid_size || !M)
     {
-        hipblasStatus_t actual
-            = hipblasTbmvFn(handle, uplo, transA, diag, M, K, nullptr, lda, nullptr, incx);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasTbmvFn,
+                    (handle, uplo, transA, diag, M, K, nullptr, lda, nullptr, incx));
         return;
     }
 
@@ -166,7 +171,7 @@ void testing_tbmv(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasTbmvFn(handle, uplo, transA, diag, M, K, dA, lda, dx, incx));
+        DAPI_CHECK(hipblasTbmvFn, (handle, uplo, transA, diag, M, K, dA, lda, dx, incx));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hx_res.data(), dx, sizeof(T) * x_size, hipMemcpyDeviceToHost));
@@ -201,7 +206,7 @@ void testing_tbmv(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTbmvFn(handle, uplo, transA, diag, M, K, dA, lda, dx, incx));
+            DAPI_CHECK(hipblasTbmvFn, (handle, uplo, transA, diag, M, K, dA, lda, dx, incx));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
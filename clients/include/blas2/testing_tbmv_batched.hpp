@@ -44,6 +44,8 @@ void testing_tbmv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTbmvBatchedFn
         = FORTRAN ? hipblasTbmvBatched<T, true> : hipblasTbmvBatched<T, false>;
+    auto hipblasTbmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTbmvBatched_64<T, true> : hipblasTbmvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -62,97 +64,104 @@ void testing_tbmv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dA(N * lda, 1, batch_count);
         device_batch_vector<T> dx(N, incx, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvBatchedFn(nullptr,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvBatchedFn(handle,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvBatchedFn(handle,
-                                                   (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvBatchedFn(handle,
-                                                   uplo,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   nullptr,
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTbmvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   nullptr,
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTbmvBatchedFn,
+                    (nullptr,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTbmvBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbmvBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbmvBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbmvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTbmvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     nullptr,
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTbmvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     nullptr,
+                     incx,
+                     batch_count));
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTbmvBatchedFn(
-            handle, uplo, transA, diag, 0, K, nullptr, lda, nullptr, incx, batch_count));
-        CHECK_HIPBLAS_ERROR(
-            hipblasTbmvBatchedFn(handle, uplo, transA, diag, N, K, nullptr, lda, nullptr, incx, 0));
+        DAPI_CHECK(hipblasTbmvBatchedFn,
+                   (handle, uplo, transA, diag, 0, K, nullptr, lda, nullptr, incx, batch_count));
+        DAPI_CHECK(hipblasTbmvBatchedFn,
+                   (handle, uplo, transA, diag, N, K, nullptr, lda, nullptr, incx, 0));
     }
 }
 
@@ -162,6 +171,8 @@ void testing_tbmv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTbmvBatchedFn
         = FORTRAN ? hipblasTbmvBatched<T, true> : hipblasTbmvBatched<T, false>;
+    auto hipblasTbmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTbmvBatched_64<T, true> : hipblasTbmvBatched_64<T, false>;
 
     hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
     hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
@@ -184,10 +195,9 @@ void testing_tbmv_batched(const Arguments& arg)
     bool invalid_size = M < 0 || K < 0 || lda < K + 1 || !incx || batch_count < 0;
     if(invalid_size || !M || !batch_count)
     {
-        hipblasStatus_t actual = hipblasTbmvBatchedFn(
-            handle, uplo, transA, diag, M, K, nullptr, lda, nullptr, incx, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasTbmvBatchedFn,
+                    (handle, uplo, transA, diag, M, K, nullptr, lda, nullptr, incx, batch_count));
         return;
     }
 
@@ -219,17 +229,18 @@ void testing_tbmv_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasTbmvBatchedFn(handle,
-                                                 uplo,
-                                                 transA,
-                                                 diag,
-                                                 M,
-                                                 K,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 batch_count));
+        DAPI_CHECK(hipblasTbmvBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    K,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    batch_count));
 
         CHECK_HIP_ERROR(hx_res.transfer_from(dx));
 
@@ -266,17 +277,18 @@ void testing_tbmv_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTbmvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     K,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
+            DAPI_CHECK(hipblasTbmvBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        diag,
+                        M,
+                        K,
+                        dA.ptr_on_device(),
+                        lda,
+                        dx.ptr_on_device(),
+                        incx,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
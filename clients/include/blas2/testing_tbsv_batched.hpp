@@ -44,6 +44,8 @@ void testing_tbsv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTbsvBatchedFn
         = FORTRAN ? hipblasTbsvBatched<T, true> : hipblasTbsvBatched<T, false>;
+    auto hipblasTbsvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTbsvBatched_64<T, true> : hipblasTbsvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -62,97 +64,104 @@ void testing_tbsv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dA(N * lda, 1, batch_count);
         device_batch_vector<T> dx(N, incx, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasTbsvBatchedFn(nullptr,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasTbsvBatchedFn(handle,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTbsvBatchedFn(handle,
-                                                   (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTbsvBatchedFn(handle,
-                                                   uplo,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTbsvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTbsvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   nullptr,
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTbsvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   K,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   nullptr,
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTbsvBatchedFn,
+                    (nullptr,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTbsvBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbsvBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbsvBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTbsvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTbsvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     nullptr,
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTbsvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     K,
+                     dA.ptr_on_device(),
+                     lda,
+                     nullptr,
+                     incx,
+                     batch_count));
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTbsvBatchedFn(
-            handle, uplo, transA, diag, 0, K, nullptr, lda, nullptr, incx, batch_count));
-        CHECK_HIPBLAS_ERROR(
-            hipblasTbsvBatchedFn(handle, uplo, transA, diag, N, K, nullptr, lda, nullptr, incx, 0));
+        DAPI_CHECK(hipblasTbsvBatchedFn,
+                   (handle, uplo, transA, diag, 0, K, nullptr, lda, nullptr, incx, batch_count));
+        DAPI_CHECK(hipblasTbsvBatchedFn,
+                   (handle, uplo, transA, diag, N, K, nullptr, lda, nullptr, incx, 0));
     }
 }
 
@@ -162,6 +171,8 @@ void testing_tbsv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTbsvBatchedFn
         = FORTRAN ? hipblasTbsvBatched<T, true> : hipblasTbsvBatched<T, false>;
+    auto hipblasTbsvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTbsvBatched_64<T, true> : hipblasTbsvBatched_64<T, false>;
 
     hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
     hipblasDiagType_t  diag        = char2hipblas_diagonal(arg.diag);
@@ -184,10 +195,9 @@ void testing_tbsv_batched(const Arguments& arg)
     bool invalid_size = N < 0 || K < 0 || lda < K + 1 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasTbsvBatchedFn(
-            handle, uplo, transA, diag, N, K, nullptr, lda, nullptr, incx, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasTbsvBatchedFn,
+                    (handle, uplo, transA, diag, N, K, nullptr, lda, nullptr, incx, batch_count));
         return;
     }
 
@@ -246,17 +256,18 @@ void testing_tbsv_batched(const Arguments& arg)
     =================================================================== */
     if(arg.unit_check || arg.norm_check)
     {
-        CHECK_HIPBLAS_ERROR(hipblasTbsvBatchedFn(handle,
-                                                 uplo,
-                                                 transA,
-                                                 diag,
-                                                 N,
-                                                 K,
-                                                 dAB.ptr_on_device(),
-                                                 lda,
-                                                 dx_or_b.ptr_on_device(),
-                                                 incx,
-                                                 batch_count));
+        DAPI_CHECK(hipblasTbsvBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    diag,
+                    N,
+                    K,
+                    dAB.ptr_on_device(),
+                    lda,
+                    dx_or_b.ptr_on_device(),
+                    incx,
+                    batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hx_or_b.transfer_from(dx_or_b));
@@ -287,17 +298,18 @@ void testing_tbsv_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTbsvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     N,
-                                                     K,
-                                                     dAB.ptr_on_device(),
-                                                     lda,
-                                                     dx_or_b.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
+            DAPI_CHECK(hipblasTbsvBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        diag,
+                        N,
+                        K,
+                        dAB.ptr_on_device(),
+                        lda,
+                        dx_or_b.ptr_on_device(),
+                        incx,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
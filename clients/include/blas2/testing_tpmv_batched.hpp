@@ -44,6 +44,8 @@ void testing_tpmv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpmvBatchedFn
         = FORTRAN ? hipblasTpmvBatched<T, true> : hipblasTpmvBatched<T, false>;
+    auto hipblasTpmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTpmvBatched_64<T, true> : hipblasTpmvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -61,71 +63,76 @@ void testing_tpmv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dA(A_size, 1, batch_count);
         device_batch_vector<T> dx(N, incx, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvBatchedFn(nullptr,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvBatchedFn(handle,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvBatchedFn(handle,
-                                                   (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvBatchedFn(handle,
-                                                   uplo,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpmvBatchedFn(
-                handle, uplo, transA, diag, N, nullptr, dx.ptr_on_device(), incx, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpmvBatchedFn(
-                handle, uplo, transA, diag, N, dA.ptr_on_device(), nullptr, incx, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTpmvBatchedFn,
+                    (nullptr,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTpmvBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpmvBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpmvBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpmvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpmvBatchedFn,
+            (handle, uplo, transA, diag, N, nullptr, dx.ptr_on_device(), incx, batch_count));
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpmvBatchedFn,
+            (handle, uplo, transA, diag, N, dA.ptr_on_device(), nullptr, incx, batch_count));
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTpmvBatchedFn(
-            handle, uplo, transA, diag, 0, nullptr, nullptr, incx, batch_count));
-        CHECK_HIPBLAS_ERROR(
-            hipblasTpmvBatchedFn(handle, uplo, transA, diag, N, nullptr, nullptr, incx, 0));
+        DAPI_CHECK(hipblasTpmvBatchedFn,
+                   (handle, uplo, transA, diag, 0, nullptr, nullptr, incx, batch_count));
+        DAPI_CHECK(
+            hipblasTpmvBatchedFn, (handle, uplo, transA, diag, N, nullptr, nullptr, incx, 0));
     }
 }
 
@@ -135,6 +142,8 @@ void testing_tpmv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpmvBatchedFn
         = FORTRAN ? hipblasTpmvBatched<T, true> : hipblasTpmvBatched<T, false>;
+    auto hipblasTpmvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTpmvBatched_64<T, true> : hipblasTpmvBatched_64<T, false>;
 
     hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
     hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
@@ -155,10 +164,9 @@ void testing_tpmv_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasTpmvBatchedFn(
-            handle, uplo, transA, diag, N, nullptr, nullptr, incx, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasTpmvBatchedFn,
+                    (handle, uplo, transA, diag, N, nullptr, nullptr, incx, batch_count));
         return;
     }
 
@@ -187,15 +195,16 @@ void testing_tpmv_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasTpmvBatchedFn(handle,
-                                                 uplo,
-                                                 transA,
-                                                 diag,
-                                                 N,
-                                                 dA.ptr_on_device(),
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 batch_count));
+        DAPI_CHECK(hipblasTpmvBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    diag,
+                    N,
+                    dA.ptr_on_device(),
+                    dx.ptr_on_device(),
+                    incx,
+                    batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hx_res.transfer_from(dx));
@@ -231,15 +240,16 @@ void testing_tpmv_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTpmvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     N,
-                                                     dA.ptr_on_device(),
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
+            DAPI_CHECK(hipblasTpmvBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        diag,
+                        N,
+                        dA.ptr_on_device(),
+                        dx.ptr_on_device(),
+                        incx,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
@@ -44,6 +44,9 @@ void testing_tpmv_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpmvStridedBatchedFn
         = FORTRAN ? hipblasTpmvStridedBatched<T, true> : hipblasTpmvStridedBatched<T, false>;
+    auto hipblasTpmvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasTpmvStridedBatched_64<T, true>
+                                              : hipblasTpmvStridedBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -63,74 +66,77 @@ void testing_tpmv_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dA(strideA * batch_count);
         device_vector<T> dx(stridex * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpmvStridedBatchedFn(
-                nullptr, uplo, transA, diag, N, dA, strideA, dx, incx, stridex, batch_count),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvStridedBatchedFn(handle,
-                                                          HIPBLAS_FILL_MODE_FULL,
-                                                          transA,
-                                                          diag,
-                                                          N,
-                                                          dA,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvStridedBatchedFn(handle,
-                                                          (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                          transA,
-                                                          diag,
-                                                          N,
-                                                          dA,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpmvStridedBatchedFn(handle,
-                                        uplo,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        diag,
-                                        N,
-                                        dA,
-                                        strideA,
-                                        dx,
-                                        incx,
-                                        stridex,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTpmvStridedBatchedFn(handle,
-                                                          uplo,
-                                                          transA,
-                                                          (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                                          N,
-                                                          dA,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpmvStridedBatchedFn(
-                handle, uplo, transA, diag, N, nullptr, strideA, dx, incx, stridex, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpmvStridedBatchedFn(
-                handle, uplo, transA, diag, N, dA, strideA, nullptr, incx, stridex, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTpmvStridedBatchedFn,
+                    (nullptr, uplo, transA, diag, N, dA, strideA, dx, incx, stridex, batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTpmvStridedBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpmvStridedBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     diag,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpmvStridedBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpmvStridedBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpmvStridedBatchedFn,
+            (handle, uplo, transA, diag, N, nullptr, strideA, dx, incx, stridex, batch_count));
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpmvStridedBatchedFn,
+            (handle, uplo, transA, diag, N, dA, strideA, nullptr, incx, stridex, batch_count));
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTpmvStridedBatchedFn(
-            handle, uplo, transA, diag, 0, nullptr, strideA, nullptr, incx, stridex, batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasTpmvStridedBatchedFn(
-            handle, uplo, transA, diag, N, nullptr, strideA, nullptr, incx, stridex, 0));
+        DAPI_CHECK(
+            hipblasTpmvStridedBatchedFn,
+            (handle, uplo, transA, diag, 0, nullptr, strideA, nullptr, incx, stridex, batch_count));
+        DAPI_CHECK(hipblasTpmvStridedBatchedFn,
+                   (handle, uplo, transA, diag, N, nullptr, strideA, nullptr, incx, stridex, 0));
     }
 }
 
@@ -140,6 +146,9 @@ void testing_tpmv_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpmvStridedBatchedFn
         = FORTRAN ? hipblasTpmvStridedBatched<T, true> : hipblasTpmvStridedBatched<T, false>;
+    auto hipblasTpmvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasTpmvStridedBatched_64<T, true>
+                                              : hipblasTpmvStridedBatched_64<T, false>;
 
     hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
     hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
@@ -164,10 +173,19 @@ void testing_tpmv_strided_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasTpmvStridedBatchedFn(
-            handle, uplo, transA, diag, N, nullptr, stride_A, nullptr, incx, stride_x, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasTpmvStridedBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     nullptr,
+                     stride_A,
+                     nullptr,
+                     incx,
+                     stride_x,
+                     batch_count));
         return;
     }
 
@@ -197,8 +215,8 @@ void testing_tpmv_strided_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasTpmvStridedBatchedFn(
-            handle, uplo, transA, diag, N, dA, stride_A, dx, incx, stride_x, batch_count));
+        DAPI_CHECK(hipblasTpmvStridedBatchedFn,
+                   (handle, uplo, transA, diag, N, dA, stride_A, dx, incx, stride_x, batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hres.data(), dx, sizeof(T) * X_size, hipMemcpyDeviceToHost));
@@ -236,8 +254,9 @@ void testing_tpmv_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTpmvStridedBatchedFn(
-                handle, uplo, transA, diag, N, dA, stride_A, dx, incx, stride_x, batch_count));
+            DAPI_CHECK(
+                hipblasTpmvStridedBatchedFn,
+                (handle, uplo, transA, diag, N, dA, stride_A, dx, incx, stride_x, batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
@@ -44,6 +44,8 @@ void testing_tpsv_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpsvBatchedFn
         = FORTRAN ? hipblasTpsvBatched<T, true> : hipblasTpsvBatched<T, false>;
+    auto hipblasTpsvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTpsvBatched_64<T, true> : hipblasTpsvBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -61,71 +63,76 @@ void testing_tpsv_batched_bad_arg(const Arguments& arg)
         device_batch_vector<T> dA(A_size, 1, batch_count);
         device_batch_vector<T> dx(N, incx, batch_count);
 
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvBatchedFn(nullptr,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvBatchedFn(handle,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvBatchedFn(handle,
-                                                   (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                   transA,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvBatchedFn(handle,
-                                                   uplo,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   diag,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvBatchedFn(handle,
-                                                   uplo,
-                                                   transA,
-                                                   (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpsvBatchedFn(
-                handle, uplo, transA, diag, N, nullptr, dx.ptr_on_device(), incx, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpsvBatchedFn(
-                handle, uplo, transA, diag, N, dA.ptr_on_device(), nullptr, incx, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTpsvBatchedFn,
+                    (nullptr,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTpsvBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpsvBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpsvBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpsvBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     dA.ptr_on_device(),
+                     dx.ptr_on_device(),
+                     incx,
+                     batch_count));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpsvBatchedFn,
+            (handle, uplo, transA, diag, N, nullptr, dx.ptr_on_device(), incx, batch_count));
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpsvBatchedFn,
+            (handle, uplo, transA, diag, N, dA.ptr_on_device(), nullptr, incx, batch_count));
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTpsvBatchedFn(
-            handle, uplo, transA, diag, 0, nullptr, nullptr, incx, batch_count));
-        CHECK_HIPBLAS_ERROR(
-            hipblasTpsvBatchedFn(handle, uplo, transA, diag, N, nullptr, nullptr, incx, 0));
+        DAPI_CHECK(hipblasTpsvBatchedFn,
+                   (handle, uplo, transA, diag, 0, nullptr, nullptr, incx, batch_count));
+        DAPI_CHECK(
+            hipblasTpsvBatchedFn, (handle, uplo, transA, diag, N, nullptr, nullptr, incx, 0));
     }
 }
 
@@ -135,6 +142,8 @@ void testing_tpsv_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpsvBatchedFn
         = FORTRAN ? hipblasTpsvBatched<T, true> : hipblasTpsvBatched<T, false>;
+    auto hipblasTpsvBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTpsvBatched_64<T, true> : hipblasTpsvBatched_64<T, false>;
 
     hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
     hipblasDiagType_t  diag        = char2hipblas_diagonal(arg.diag);
@@ -155,10 +164,9 @@ void testing_tpsv_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasTpsvBatchedFn(
-            handle, uplo, transA, diag, N, nullptr, nullptr, incx, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasTpsvBatchedFn,
+                    (handle, uplo, transA, diag, N, nullptr, nullptr, incx, batch_count));
         return;
     }
 
@@ -220,15 +228,16 @@ void testing_tpsv_batched(const Arguments& arg)
     =================================================================== */
     if(arg.unit_check || arg.norm_check)
     {
-        CHECK_HIPBLAS_ERROR(hipblasTpsvBatchedFn(handle,
-                                                 uplo,
-                                                 transA,
-                                                 diag,
-                                                 N,
-                                                 dAP.ptr_on_device(),
-                                                 dx_or_b.ptr_on_device(),
-                                                 incx,
-                                                 batch_count));
+        DAPI_CHECK(hipblasTpsvBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    diag,
+                    N,
+                    dAP.ptr_on_device(),
+                    dx_or_b.ptr_on_device(),
+                    incx,
+                    batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hx_or_b_1.transfer_from(dx_or_b));
@@ -260,15 +269,16 @@ void testing_tpsv_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTpsvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     N,
-                                                     dAP.ptr_on_device(),
-                                                     dx_or_b.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
+            DAPI_CHECK(hipblasTpsvBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        diag,
+                        N,
+                        dAP.ptr_on_device(),
+                        dx_or_b.ptr_on_device(),
+                        incx,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
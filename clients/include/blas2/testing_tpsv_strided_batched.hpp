@@ -44,6 +44,9 @@ void testing_tpsv_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpsvStridedBatchedFn
         = FORTRAN ? hipblasTpsvStridedBatched<T, true> : hipblasTpsvStridedBatched<T, false>;
+    auto hipblasTpsvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasTpsvStridedBatched_64<T, true>
+                                              : hipblasTpsvStridedBatched_64<T, false>;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -63,74 +66,77 @@ void testing_tpsv_strided_batched_bad_arg(const Arguments& arg)
         device_vector<T> dA(strideA * batch_count);
         device_vector<T> dx(stridex * batch_count);
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpsvStridedBatchedFn(
-                nullptr, uplo, transA, diag, N, dA, strideA, dx, incx, stridex, batch_count),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvStridedBatchedFn(handle,
-                                                          HIPBLAS_FILL_MODE_FULL,
-                                                          transA,
-                                                          diag,
-                                                          N,
-                                                          dA,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvStridedBatchedFn(handle,
-                                                          (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                          transA,
-                                                          diag,
-                                                          N,
-                                                          dA,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpsvStridedBatchedFn(handle,
-                                        uplo,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        diag,
-                                        N,
-                                        dA,
-                                        strideA,
-                                        dx,
-                                        incx,
-                                        stridex,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTpsvStridedBatchedFn(handle,
-                                                          uplo,
-                                                          transA,
-                                                          (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                                          N,
-                                                          dA,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpsvStridedBatchedFn(
-                handle, uplo, transA, diag, N, nullptr, strideA, dx, incx, stridex, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTpsvStridedBatchedFn(
-                handle, uplo, transA, diag, N, dA, strideA, nullptr, incx, stridex, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTpsvStridedBatchedFn,
+                    (nullptr, uplo, transA, diag, N, dA, strideA, dx, incx, stridex, batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTpsvStridedBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpsvStridedBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     diag,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpsvStridedBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTpsvStridedBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     dA,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     batch_count));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpsvStridedBatchedFn,
+            (handle, uplo, transA, diag, N, nullptr, strideA, dx, incx, stridex, batch_count));
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTpsvStridedBatchedFn,
+            (handle, uplo, transA, diag, N, dA, strideA, nullptr, incx, stridex, batch_count));
 
         // With N == 0, can have all nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTpsvStridedBatchedFn(
-            handle, uplo, transA, diag, 0, nullptr, strideA, nullptr, incx, stridex, batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasTpsvStridedBatchedFn(
-            handle, uplo, transA, diag, N, nullptr, strideA, nullptr, incx, stridex, 0));
+        DAPI_CHECK(
+            hipblasTpsvStridedBatchedFn,
+            (handle, uplo, transA, diag, 0, nullptr, strideA, nullptr, incx, stridex, batch_count));
+        DAPI_CHECK(hipblasTpsvStridedBatchedFn,
+                   (handle, uplo, transA, diag, N, nullptr, strideA, nullptr, incx, stridex, 0));
     }
 }
 
@@ -140,6 +146,9 @@ void testing_tpsv_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTpsvStridedBatchedFn
         = FORTRAN ? hipblasTpsvStridedBatched<T, true> : hipblasTpsvStridedBatched<T, false>;
+    auto hipblasTpsvStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasTpsvStridedBatched_64<T, true>
+                                              : hipblasTpsvStridedBatched_64<T, false>;
 
     hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
     hipblasDiagType_t  diag         = char2hipblas_diagonal(arg.diag);
@@ -165,10 +174,19 @@ void testing_tpsv_strided_batched(const Arguments& arg)
     bool invalid_size = N < 0 || !incx || batch_count < 0;
     if(invalid_size || !N || !batch_count)
     {
-        hipblasStatus_t actual = hipblasTpsvStridedBatchedFn(
-            handle, uplo, transA, diag, N, nullptr, strideAP, nullptr, incx, stridex, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasTpsvStridedBatchedFn,
+                    (handle,
+                     uplo,
+                     transA,
+                     diag,
+                     N,
+                     nullptr,
+                     strideAP,
+                     nullptr,
+                     incx,
+                     stridex,
+                     batch_count));
         return;
     }
 
@@ -232,8 +250,9 @@ void testing_tpsv_strided_batched(const Arguments& arg)
     =================================================================== */
     if(arg.unit_check || arg.norm_check)
     {
-        CHECK_HIPBLAS_ERROR(hipblasTpsvStridedBatchedFn(
-            handle, uplo, transA, diag, N, dAP, strideAP, dx_or_b, incx, stridex, batch_count));
+        DAPI_CHECK(
+            hipblasTpsvStridedBatchedFn,
+            (handle, uplo, transA, diag, N, dAP, strideAP, dx_or_b, incx, stridex, batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(
@@ -265,8 +284,18 @@ void testing_tpsv_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTpsvStridedBatchedFn(
-                handle, uplo, transA, diag, N, dAP, strideAP, dx_or_b, incx, stridex, batch_count));
+            DAPI_CHECK(hipblasTpsvStridedBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        diag,
+                        N,
+                        dAP,
+                        strideAP,
+                        dx_or_b,
+                        incx,
+                        stridex,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
@@ -42,6 +42,8 @@ void testing_dgmm_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDgmmFn = FORTRAN ? hipblasDgmm<T, true> : hipblasDgmm<T, false>;
+    auto hipblasDgmmFn_64
+        = arg.api == FORTRAN_64 ? hipblasDgmm_64<T, true> : hipblasDgmm_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -59,29 +61,31 @@ void testing_dgmm_bad_arg(const Arguments& arg)
     device_vector<T> dx(incx * K);
     device_vector<T> dC(N * ldc);
 
-    EXPECT_HIPBLAS_STATUS(hipblasDgmmFn(nullptr, side, M, N, dA, lda, dx, incx, dC, ldc),
-                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                hipblasDgmmFn,
+                (nullptr, side, M, N, dA, lda, dx, incx, dC, ldc));
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasDgmmFn(
-            handle, (hipblasSideMode_t)HIPBLAS_FILL_MODE_FULL, M, N, dA, lda, dx, incx, dC, ldc),
-        HIPBLAS_STATUS_INVALID_ENUM);
+    DAPI_EXPECT(
+        HIPBLAS_STATUS_INVALID_ENUM,
+        hipblasDgmmFn,
+        (handle, (hipblasSideMode_t)HIPBLAS_FILL_MODE_FULL, M, N, dA, lda, dx, incx, dC, ldc));
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmFn(handle, side, M, N, nullptr, lda, dx, incx, dC, ldc),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmFn(handle, side, M, N, dA, lda, nullptr, incx, dC, ldc),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmFn(handle, side, M, N, dA, lda, dx, incx, nullptr, ldc),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmFn,
+                    (handle, side, M, N, nullptr, lda, dx, incx, dC, ldc));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmFn,
+                    (handle, side, M, N, dA, lda, nullptr, incx, dC, ldc));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmFn,
+                    (handle, side, M, N, dA, lda, dx, incx, nullptr, ldc));
     }
 
     // If M == 0 || N == 0, can have nullptrs
-    CHECK_HIPBLAS_ERROR(
-        hipblasDgmmFn(handle, side, 0, N, nullptr, lda, nullptr, incx, nullptr, ldc));
-    CHECK_HIPBLAS_ERROR(
-        hipblasDgmmFn(handle, side, M, 0, nullptr, lda, nullptr, incx, nullptr, ldc));
+    DAPI_CHECK(hipblasDgmmFn, (handle, side, 0, N, nullptr, lda, nullptr, incx, nullptr, ldc));
+    DAPI_CHECK(hipblasDgmmFn, (handle, side, M, 0, nullptr, lda, nullptr, incx, nullptr, ldc));
 }
 
 template <typename T>
@@ -89,6 +93,8 @@ void testing_dgmm(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDgmmFn = FORTRAN ? hipblasDgmm<T, true> : hipblasDgmm<T, false>;
+    auto hipblasDgmmFn_64
+        = arg.api == FORTRAN_64 ? hipblasDgmm_64<T, true> : hipblasDgmm_64<T, false>;
 
     hipblasSideMode_t side = char2hipblas_side(arg.side);
 
@@ -113,10 +119,9 @@ void testing_dgmm(const Arguments& arg)
     bool invalid_size = M < 0 || N < 0 || ldc < M || lda < M;
     if(invalid_size || !N || !M)
     {
-        hipblasStatus_t actual
-            = hipblasDgmmFn(handle, side, M, N, nullptr, lda, nullptr, incx, nullptr, ldc);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasDgmmFn,
+                    (handle, side, M, N, nullptr, lda, nullptr, incx, nullptr, ldc));
         return;
     }
 
@@ -154,7 +159,7 @@ void testing_dgmm(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasDgmmFn(handle, side, M, N, dA, lda, dx, incx, dC, ldc));
+        DAPI_CHECK(hipblasDgmmFn, (handle, side, M, N, dA, lda, dx, incx, dC, ldc));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
@@ -204,7 +209,7 @@ void testing_dgmm(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasDgmmFn(handle, side, M, N, dA, lda, dx, incx, dC, ldc));
+            DAPI_CHECK(hipblasDgmmFn, (handle, side, M, N, dA, lda, dx, incx, dC, ldc));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
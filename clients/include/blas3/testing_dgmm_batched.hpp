@@ -44,6 +44,8 @@ void testing_dgmm_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDgmmBatchedFn
         = FORTRAN ? hipblasDgmmBatched<T, true> : hipblasDgmmBatched<T, false>;
+    auto hipblasDgmmBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasDgmmBatched_64<T, true> : hipblasDgmmBatched_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -62,79 +64,84 @@ void testing_dgmm_batched_bad_arg(const Arguments& arg)
     device_batch_vector<T> dx(K, incx, batch_count);
     device_batch_vector<T> dC(N * ldc, 1, batch_count);
 
-    EXPECT_HIPBLAS_STATUS(hipblasDgmmBatchedFn(nullptr,
-                                               side,
-                                               M,
-                                               N,
-                                               dA.ptr_on_device(),
-                                               lda,
-                                               dx.ptr_on_device(),
-                                               incx,
-                                               dC.ptr_on_device(),
-                                               ldc,
-                                               batch_count),
-                          HIPBLAS_STATUS_NOT_INITIALIZED);
-
-    EXPECT_HIPBLAS_STATUS(hipblasDgmmBatchedFn(handle,
-                                               (hipblasSideMode_t)HIPBLAS_FILL_MODE_FULL,
-                                               M,
-                                               N,
-                                               dA.ptr_on_device(),
-                                               lda,
-                                               dx.ptr_on_device(),
-                                               incx,
-                                               dC.ptr_on_device(),
-                                               ldc,
-                                               batch_count),
-                          HIPBLAS_STATUS_INVALID_ENUM);
+    DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                hipblasDgmmBatchedFn,
+                (nullptr,
+                 side,
+                 M,
+                 N,
+                 dA.ptr_on_device(),
+                 lda,
+                 dx.ptr_on_device(),
+                 incx,
+                 dC.ptr_on_device(),
+                 ldc,
+                 batch_count));
+
+    DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                hipblasDgmmBatchedFn,
+                (handle,
+                 (hipblasSideMode_t)HIPBLAS_FILL_MODE_FULL,
+                 M,
+                 N,
+                 dA.ptr_on_device(),
+                 lda,
+                 dx.ptr_on_device(),
+                 incx,
+                 dC.ptr_on_device(),
+                 ldc,
+                 batch_count));
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmBatchedFn(handle,
-                                                   side,
-                                                   M,
-                                                   N,
-                                                   nullptr,
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmBatchedFn(handle,
-                                                   side,
-                                                   M,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   nullptr,
-                                                   incx,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmBatchedFn(handle,
-                                                   side,
-                                                   M,
-                                                   N,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dx.ptr_on_device(),
-                                                   incx,
-                                                   nullptr,
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmBatchedFn,
+                    (handle,
+                     side,
+                     M,
+                     N,
+                     nullptr,
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmBatchedFn,
+                    (handle,
+                     side,
+                     M,
+                     N,
+                     dA.ptr_on_device(),
+                     lda,
+                     nullptr,
+                     incx,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmBatchedFn,
+                    (handle,
+                     side,
+                     M,
+                     N,
+                     dA.ptr_on_device(),
+                     lda,
+                     dx.ptr_on_device(),
+                     incx,
+                     nullptr,
+                     ldc,
+                     batch_count));
     }
 
     // If M == 0 || N == 0 || batch_count == 0, can have all nullptrs
-    CHECK_HIPBLAS_ERROR(hipblasDgmmBatchedFn(
-        handle, side, 0, N, nullptr, lda, nullptr, incx, nullptr, ldc, batch_count));
-    CHECK_HIPBLAS_ERROR(hipblasDgmmBatchedFn(
-        handle, side, M, 0, nullptr, lda, nullptr, incx, nullptr, ldc, batch_count));
-    CHECK_HIPBLAS_ERROR(
-        hipblasDgmmBatchedFn(handle, side, M, N, nullptr, lda, nullptr, incx, nullptr, ldc, 0));
+    DAPI_CHECK(hipblasDgmmBatchedFn,
+               (handle, side, 0, N, nullptr, lda, nullptr, incx, nullptr, ldc, batch_count));
+    DAPI_CHECK(hipblasDgmmBatchedFn,
+               (handle, side, M, 0, nullptr, lda, nullptr, incx, nullptr, ldc, batch_count));
+    DAPI_CHECK(
+        hipblasDgmmBatchedFn, (handle, side, M, N, nullptr, lda, nullptr, incx, nullptr, ldc, 0));
 }
 
 template <typename T>
@@ -143,6 +150,8 @@ void testing_dgmm_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDgmmBatchedFn
         = FORTRAN ? hipblasDgmmBatched<T, true> : hipblasDgmmBatched<T, false>;
+    auto hipblasDgmmBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasDgmmBatched_64<T, true> : hipblasDgmmBatched_64<T, false>;
 
     hipblasSideMode_t side = char2hipblas_side(arg.side);
 
@@ -164,10 +173,9 @@ void testing_dgmm_batched(const Arguments& arg)
     bool invalid_size = M < 0 || N < 0 || ldc < M || lda < M || batch_count < 0;
     if(invalid_size || !N || !M || !batch_count)
     {
-        hipblasStatus_t actual = hipblasDgmmBatchedFn(
-            handle, side, M, N, nullptr, lda, nullptr, incx, nullptr, ldc, batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasDgmmBatchedFn,
+                    (handle, side, M, N, nullptr, lda, nullptr, incx, nullptr, ldc, batch_count));
         return;
     }
 
@@ -209,17 +217,18 @@ void testing_dgmm_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasDgmmBatchedFn(handle,
-                                                 side,
-                                                 M,
-                                                 N,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dx.ptr_on_device(),
-                                                 incx,
-                                                 dC.ptr_on_device(),
-                                                 ldc,
-                                                 batch_count));
+        DAPI_CHECK(hipblasDgmmBatchedFn,
+                   (handle,
+                    side,
+                    M,
+                    N,
+                    dA.ptr_on_device(),
+                    lda,
+                    dx.ptr_on_device(),
+                    incx,
+                    dC.ptr_on_device(),
+                    ldc,
+                    batch_count));
         CHECK_HIP_ERROR(hC_1.transfer_from(dC));
 
         /* =====================================================================
@@ -272,17 +281,18 @@ void testing_dgmm_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasDgmmBatchedFn(handle,
-                                                     side,
-                                                     M,
-                                                     N,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasDgmmBatchedFn,
+                       (handle,
+                        side,
+                        M,
+                        N,
+                        dA.ptr_on_device(),
+                        lda,
+                        dx.ptr_on_device(),
+                        incx,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
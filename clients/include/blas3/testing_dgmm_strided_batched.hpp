@@ -51,6 +51,9 @@ void testing_dgmm_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDgmmStridedBatchedFn
         = FORTRAN ? hipblasDgmmStridedBatched<T, true> : hipblasDgmmStridedBatched<T, false>;
+    auto hipblasDgmmStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasDgmmStridedBatched_64<T, true>
+                                              : hipblasDgmmStridedBatched_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -73,130 +76,126 @@ void testing_dgmm_strided_batched_bad_arg(const Arguments& arg)
     device_vector<T> dx(stridex * batch_count);
     device_vector<T> dC(strideC * batch_count);
 
-    EXPECT_HIPBLAS_STATUS(hipblasDgmmStridedBatchedFn(nullptr,
-                                                      side,
-                                                      M,
-                                                      N,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      dx,
-                                                      incx,
-                                                      stridex,
-                                                      dC,
-                                                      ldc,
-                                                      strideC,
-                                                      batch_count),
-                          HIPBLAS_STATUS_NOT_INITIALIZED);
-
-    EXPECT_HIPBLAS_STATUS(hipblasDgmmStridedBatchedFn(handle,
-                                                      (hipblasSideMode_t)HIPBLAS_FILL_MODE_FULL,
-                                                      M,
-                                                      N,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      dx,
-                                                      incx,
-                                                      stridex,
-                                                      dC,
-                                                      ldc,
-                                                      strideC,
-                                                      batch_count),
-                          HIPBLAS_STATUS_INVALID_ENUM);
+    DAPI_EXPECT(
+        HIPBLAS_STATUS_NOT_INITIALIZED,
+        hipblasDgmmStridedBatchedFn,
+        (nullptr, side, M, N, dA, lda, strideA, dx, incx, stridex, dC, ldc, strideC, batch_count));
+
+    DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                hipblasDgmmStridedBatchedFn,
+                (handle,
+                 (hipblasSideMode_t)HIPBLAS_FILL_MODE_FULL,
+                 M,
+                 N,
+                 dA,
+                 lda,
+                 strideA,
+                 dx,
+                 incx,
+                 stridex,
+                 dC,
+                 ldc,
+                 strideC,
+                 batch_count));
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmStridedBatchedFn(handle,
-                                                          side,
-                                                          M,
-                                                          N,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          dC,
-                                                          ldc,
-                                                          strideC,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmStridedBatchedFn(handle,
-                                                          side,
-                                                          M,
-                                                          N,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          incx,
-                                                          stridex,
-                                                          dC,
-                                                          ldc,
-                                                          strideC,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasDgmmStridedBatchedFn(handle,
-                                                          side,
-                                                          M,
-                                                          N,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dx,
-                                                          incx,
-                                                          stridex,
-                                                          nullptr,
-                                                          ldc,
-                                                          strideC,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     M,
+                     N,
+                     nullptr,
+                     lda,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     M,
+                     N,
+                     dA,
+                     lda,
+                     strideA,
+                     nullptr,
+                     incx,
+                     stridex,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasDgmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     M,
+                     N,
+                     dA,
+                     lda,
+                     strideA,
+                     dx,
+                     incx,
+                     stridex,
+                     nullptr,
+                     ldc,
+                     strideC,
+                     batch_count));
     }
 
     // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
-    CHECK_HIPBLAS_ERROR(hipblasDgmmStridedBatchedFn(handle,
-                                                    side,
-                                                    0,
-                                                    N,
-                                                    nullptr,
-                                                    lda,
-                                                    strideA,
-                                                    nullptr,
-                                                    incx,
-                                                    stridex,
-                                                    nullptr,
-                                                    ldc,
-                                                    strideC,
-                                                    batch_count));
-    CHECK_HIPBLAS_ERROR(hipblasDgmmStridedBatchedFn(handle,
-                                                    side,
-                                                    M,
-                                                    0,
-                                                    nullptr,
-                                                    lda,
-                                                    strideA,
-                                                    nullptr,
-                                                    incx,
-                                                    stridex,
-                                                    nullptr,
-                                                    ldc,
-                                                    strideC,
-                                                    batch_count));
-    CHECK_HIPBLAS_ERROR(hipblasDgmmStridedBatchedFn(handle,
-                                                    side,
-                                                    M,
-                                                    N,
-                                                    nullptr,
-                                                    lda,
-                                                    strideA,
-                                                    nullptr,
-                                                    incx,
-                                                    stridex,
-                                                    nullptr,
-                                                    ldc,
-                                                    strideC,
-                                                    0));
+    DAPI_CHECK(hipblasDgmmStridedBatchedFn,
+               (handle,
+                side,
+                0,
+                N,
+                nullptr,
+                lda,
+                strideA,
+                nullptr,
+                incx,
+                stridex,
+                nullptr,
+                ldc,
+                strideC,
+                batch_count));
+    DAPI_CHECK(hipblasDgmmStridedBatchedFn,
+               (handle,
+                side,
+                M,
+                0,
+                nullptr,
+                lda,
+                strideA,
+                nullptr,
+                incx,
+                stridex,
+                nullptr,
+                ldc,
+                strideC,
+                batch_count));
+    DAPI_CHECK(hipblasDgmmStridedBatchedFn,
+               (handle,
+                side,
+                M,
+                N,
+                nullptr,
+                lda,
+                strideA,
+                nullptr,
+                incx,
+                stridex,
+                nullptr,
+                ldc,
+                strideC,
+                0));
 }
 
 template <typename T>
@@ -205,6 +204,9 @@ void testing_dgmm_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDgmmStridedBatchedFn
         = FORTRAN ? hipblasDgmmStridedBatched<T, true> : hipblasDgmmStridedBatched<T, false>;
+    auto hipblasDgmmStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasDgmmStridedBatched_64<T, true>
+                                              : hipblasDgmmStridedBatched_64<T, false>;
 
     hipblasSideMode_t side = char2hipblas_side(arg.side);
 
@@ -235,22 +237,22 @@ void testing_dgmm_strided_batched(const Arguments& arg)
     bool invalid_size = M < 0 || N < 0 || ldc < M || lda < M || batch_count < 0;
     if(invalid_size || !N || !M || !batch_count)
     {
-        hipblasStatus_t actual = hipblasDgmmStridedBatchedFn(handle,
-                                                             side,
-                                                             M,
-                                                             N,
-                                                             nullptr,
-                                                             lda,
-                                                             stride_A,
-                                                             nullptr,
-                                                             incx,
-                                                             stride_x,
-                                                             nullptr,
-                                                             ldc,
-                                                             stride_C,
-                                                             batch_count);
-        EXPECT_HIPBLAS_STATUS(
-            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        DAPI_EXPECT((invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS),
+                    hipblasDgmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     M,
+                     N,
+                     nullptr,
+                     lda,
+                     stride_A,
+                     nullptr,
+                     incx,
+                     stride_x,
+                     nullptr,
+                     ldc,
+                     stride_C,
+                     batch_count));
         return;
     }
 
@@ -290,20 +292,21 @@ void testing_dgmm_strided_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasDgmmStridedBatchedFn(handle,
-                                                        side,
-                                                        M,
-                                                        N,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dx,
-                                                        incx,
-                                                        stride_x,
-                                                        dC,
-                                                        ldc,
-                                                        stride_C,
-                                                        batch_count));
+        DAPI_CHECK(hipblasDgmmStridedBatchedFn,
+                   (handle,
+                    side,
+                    M,
+                    N,
+                    dA,
+                    lda,
+                    stride_A,
+                    dx,
+                    incx,
+                    stride_x,
+                    dC,
+                    ldc,
+                    stride_C,
+                    batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
@@ -362,20 +365,21 @@ void testing_dgmm_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasDgmmStridedBatchedFn(handle,
-                                                            side,
-                                                            M,
-                                                            N,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            dC,
-                                                            ldc,
-                                                            stride_C,
-                                                            batch_count));
+            DAPI_CHECK(hipblasDgmmStridedBatchedFn,
+                       (handle,
+                        side,
+                        M,
+                        N,
+                        dA,
+                        lda,
+                        stride_A,
+                        dx,
+                        incx,
+                        stride_x,
+                        dC,
+                        ldc,
+                        stride_C,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
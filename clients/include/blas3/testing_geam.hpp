@@ -46,6 +46,8 @@ void testing_geam_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGeamFn = FORTRAN ? hipblasGeam<T, true> : hipblasGeam<T, false>;
+    auto hipblasGeamFn_64
+        = arg.api == FORTRAN_64 ? hipblasGeam_64<T, true> : hipblasGeam_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -86,112 +88,112 @@ void testing_geam_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGeamFn(nullptr, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, dC, ldc),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasGeamFn(handle,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            transB,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            beta,
-                                            dB,
-                                            ldb,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasGeamFn(handle,
-                                            transA,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            beta,
-                                            dB,
-                                            ldb,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGeamFn,
+                    (nullptr, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, dC, ldc));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGeamFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     transB,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     beta,
+                     dB,
+                     ldb,
+                     dC,
+                     ldc));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGeamFn,
+                    (handle,
+                     transA,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     beta,
+                     dB,
+                     ldb,
+                     dC,
+                     ldc));
 
         if(arg.bad_arg_all)
         {
             // (dA == dC) => (lda == ldc) else invalid_value
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGeamFn(
-                    handle, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, dA, lda + 1),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamFn,
+                        (handle, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, dA, lda + 1));
 
             // (dB == dC) => (ldb == ldc) else invalid value
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGeamFn(
-                    handle, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, dB, ldb + 1),
-                HIPBLAS_STATUS_INVALID_VALUE);
-
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGeamFn(
-                    handle, transA, transB, M, N, nullptr, dA, lda, beta, dB, ldb, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGeamFn(
-                    handle, transA, transB, M, N, alpha, dA, lda, nullptr, dB, ldb, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGeamFn(
-                    handle, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, nullptr, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamFn,
+                        (handle, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, dB, ldb + 1));
+
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamFn,
+                        (handle, transA, transB, M, N, nullptr, dA, lda, beta, dB, ldb, dC, ldc));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamFn,
+                        (handle, transA, transB, M, N, alpha, dA, lda, nullptr, dB, ldb, dC, ldc));
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasGeamFn,
+                (handle, transA, transB, M, N, alpha, dA, lda, beta, dB, ldb, nullptr, ldc));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGeamFn(
-                        handle, transA, transB, M, N, alpha, nullptr, lda, beta, dB, ldb, dC, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGeamFn(
-                        handle, transA, transB, M, N, alpha, dA, lda, beta, nullptr, ldb, dC, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGeamFn,
+                    (handle, transA, transB, M, N, alpha, nullptr, lda, beta, dB, ldb, dC, ldc));
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGeamFn,
+                    (handle, transA, transB, M, N, alpha, dA, lda, beta, nullptr, ldb, dC, ldc));
             }
 
             // alpha == 0, can have A be nullptr. beta == 0 can have B be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGeamFn(
-                handle, transA, transB, M, N, zero, nullptr, lda, beta, dB, ldb, dC, ldc));
-            CHECK_HIPBLAS_ERROR(hipblasGeamFn(
-                handle, transA, transB, M, N, alpha, dA, lda, zero, nullptr, ldb, dC, ldc));
+            DAPI_CHECK(hipblasGeamFn,
+                       (handle, transA, transB, M, N, zero, nullptr, lda, beta, dB, ldb, dC, ldc));
+            DAPI_CHECK(hipblasGeamFn,
+                       (handle, transA, transB, M, N, alpha, dA, lda, zero, nullptr, ldb, dC, ldc));
         }
 
         // If M == 0 || N == 0, can have nullptrs, but quirk of needing lda == ldb == ldc since A == B == C
-        CHECK_HIPBLAS_ERROR(hipblasGeamFn(handle,
-                                          transA,
-                                          transB,
-                                          0,
-                                          N,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          lda));
-        CHECK_HIPBLAS_ERROR(hipblasGeamFn(handle,
-                                          transA,
-                                          transB,
-                                          M,
-                                          0,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          lda));
+        DAPI_CHECK(hipblasGeamFn,
+                   (handle,
+                    transA,
+                    transB,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    lda));
+        DAPI_CHECK(hipblasGeamFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    lda));
     }
 }
 
@@ -200,6 +202,8 @@ void testing_geam(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGeamFn = FORTRAN ? hipblasGeam<T, true> : hipblasGeam<T, false>;
+    auto hipblasGeamFn_64
+        = arg.api == FORTRAN_64 ? hipblasGeam_64<T, true> : hipblasGeam_64<T, false>;
 
     hipblasOperation_t transA = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB = char2hipblas_operation(arg.transB);
@@ -285,8 +289,9 @@ void testing_geam(const Arguments& arg)
         {
             // &h_alpha and &h_beta are host pointers
             CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-            CHECK_HIPBLAS_ERROR(hipblasGeamFn(
-                handle, transA, transB, M, N, &h_alpha, dA, lda, &h_beta, dB, ldb, dC, ldc));
+            DAPI_CHECK(
+                hipblasGeamFn,
+                (handle, transA, transB, M, N, &h_alpha, dA, lda, &h_beta, dB, ldb, dC, ldc));
 
             CHECK_HIP_ERROR(hipMemcpy(hC1.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
         }
@@ -295,8 +300,8 @@ void testing_geam(const Arguments& arg)
 
             // d_alpha and d_beta are device pointers
             CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-            CHECK_HIPBLAS_ERROR(hipblasGeamFn(
-                handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
+            DAPI_CHECK(hipblasGeamFn,
+                       (handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
 
             CHECK_HIP_ERROR(hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
         }
@@ -335,8 +340,8 @@ void testing_geam(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGeamFn(
-                handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
+            DAPI_CHECK(hipblasGeamFn,
+                       (handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
@@ -56,6 +56,8 @@ void testing_geam_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGeamBatchedFn
         = FORTRAN ? hipblasGeamBatched<T, true> : hipblasGeamBatched<T, false>;
+    auto hipblasGeamBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGeamBatched_64<T, true> : hipblasGeamBatched_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -97,243 +99,258 @@ void testing_geam_batched_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(nullptr,
-                                                   transA,
-                                                   transB,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   beta,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   transB,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   beta,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                   transA,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   beta,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGeamBatchedFn,
+                    (nullptr,
+                     transA,
+                     transB,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     beta,
+                     dB.ptr_on_device(),
+                     ldb,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGeamBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     transB,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     beta,
+                     dB.ptr_on_device(),
+                     ldb,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGeamBatchedFn,
+                    (handle,
+                     transA,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     beta,
+                     dB.ptr_on_device(),
+                     ldb,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
             // (dA == dC) => (lda == ldc) else invalid_value
-            EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       beta,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       dA.ptr_on_device(),
-                                                       lda + 1,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         beta,
+                         dB.ptr_on_device(),
+                         ldb,
+                         dA.ptr_on_device(),
+                         lda + 1,
+                         batch_count));
 
             // (dB == dC) => (ldb == ldc) else invalid value
-            EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       beta,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       dB.ptr_on_device(),
-                                                       ldb + 1,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-
-            EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       nullptr,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       beta,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       dC.ptr_on_device(),
-                                                       ldc,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       nullptr,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       dC.ptr_on_device(),
-                                                       ldc,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       beta,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       nullptr,
-                                                       ldc,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         beta,
+                         dB.ptr_on_device(),
+                         ldb,
+                         dB.ptr_on_device(),
+                         ldb + 1,
+                         batch_count));
+
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         nullptr,
+                         dA.ptr_on_device(),
+                         lda,
+                         beta,
+                         dB.ptr_on_device(),
+                         ldb,
+                         dC.ptr_on_device(),
+                         ldc,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         nullptr,
+                         dB.ptr_on_device(),
+                         ldb,
+                         dC.ptr_on_device(),
+                         ldc,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         beta,
+                         dB.ptr_on_device(),
+                         ldb,
+                         nullptr,
+                         ldc,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           N,
-                                                           alpha,
-                                                           nullptr,
-                                                           lda,
-                                                           beta,
-                                                           dB.ptr_on_device(),
-                                                           ldb,
-                                                           dC.ptr_on_device(),
-                                                           ldc,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGeamBatchedFn(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           N,
-                                                           alpha,
-                                                           dA.ptr_on_device(),
-                                                           lda,
-                                                           beta,
-                                                           nullptr,
-                                                           ldb,
-                                                           dC.ptr_on_device(),
-                                                           ldc,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGeamBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             alpha,
+                             nullptr,
+                             lda,
+                             beta,
+                             dB.ptr_on_device(),
+                             ldb,
+                             dC.ptr_on_device(),
+                             ldc,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGeamBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             alpha,
+                             dA.ptr_on_device(),
+                             lda,
+                             beta,
+                             nullptr,
+                             ldb,
+                             dC.ptr_on_device(),
+                             ldc,
+                             batch_count));
             }
 
             // alpha == 0, can have A be nullptr. beta == 0 can have B be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     zero,
-                                                     nullptr,
-                                                     lda,
-                                                     beta,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
-            CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     zero,
-                                                     nullptr,
-                                                     ldb,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGeamBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        zero,
+                        nullptr,
+                        lda,
+                        beta,
+                        dB.ptr_on_device(),
+                        ldb,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
+            DAPI_CHECK(hipblasGeamBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        zero,
+                        nullptr,
+                        ldb,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
         }
 
         // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 0,
-                                                 N,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 lda,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 0,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 lda,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 N,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 lda,
-                                                 0));
+        DAPI_CHECK(hipblasGeamBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    lda,
+                    batch_count));
+        DAPI_CHECK(hipblasGeamBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    lda,
+                    batch_count));
+        DAPI_CHECK(hipblasGeamBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    lda,
+                    0));
     }
 }
 
@@ -343,6 +360,8 @@ void testing_geam_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGeamBatchedFn
         = FORTRAN ? hipblasGeamBatched<T, true> : hipblasGeamBatched<T, false>;
+    auto hipblasGeamBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGeamBatched_64<T, true> : hipblasGeamBatched_64<T, false>;
 
     hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
@@ -434,20 +453,21 @@ void testing_geam_batched(const Arguments& arg)
         {
             // &h_alpha and &h_beta are host pointers
             CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-            CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     &h_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     &h_beta,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGeamBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        &h_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        &h_beta,
+                        dB.ptr_on_device(),
+                        ldb,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
 
             CHECK_HIP_ERROR(hC1.transfer_from(dC));
         }
@@ -456,20 +476,21 @@ void testing_geam_batched(const Arguments& arg)
 
             // d_alpha and d_beta are device pointers
             CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-            CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     d_beta,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGeamBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        d_beta,
+                        dB.ptr_on_device(),
+                        ldb,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
 
             CHECK_HIP_ERROR(hC2.transfer_from(dC));
         }
@@ -521,20 +542,21 @@ void testing_geam_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     d_beta,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGeamBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        d_beta,
+                        dB.ptr_on_device(),
+                        ldb,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
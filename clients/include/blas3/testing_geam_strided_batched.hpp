@@ -57,6 +57,9 @@ void testing_geam_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGeamStridedBatchedFn
         = FORTRAN ? hipblasGeamStridedBatched<T, true> : hipblasGeamStridedBatched<T, false>;
+    auto hipblasGeamStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGeamStridedBatched_64<T, true>
+                                              : hipblasGeamStridedBatched_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -102,290 +105,303 @@ void testing_geam_strided_batched_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(nullptr,
-                                                          transA,
-                                                          transB,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          beta,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          dC,
-                                                          ldc,
-                                                          strideC,
-                                                          batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGeamStridedBatchedFn(handle,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        transB,
-                                        M,
-                                        N,
-                                        alpha,
-                                        dA,
-                                        lda,
-                                        strideA,
-                                        beta,
-                                        dB,
-                                        ldb,
-                                        strideB,
-                                        dC,
-                                        ldc,
-                                        strideC,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGeamStridedBatchedFn(handle,
-                                        transA,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        M,
-                                        N,
-                                        alpha,
-                                        dA,
-                                        lda,
-                                        strideA,
-                                        beta,
-                                        dB,
-                                        ldb,
-                                        strideB,
-                                        dC,
-                                        ldc,
-                                        strideC,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGeamStridedBatchedFn,
+                    (nullptr,
+                     transA,
+                     transB,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     beta,
+                     dB,
+                     ldb,
+                     strideB,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGeamStridedBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     transB,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     beta,
+                     dB,
+                     ldb,
+                     strideB,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGeamStridedBatchedFn,
+                    (handle,
+                     transA,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     beta,
+                     dB,
+                     ldb,
+                     strideB,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
             // (dA == dC) => (lda == ldc) else invalid_value, note no checks on strides
-            EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              beta,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              dA,
-                                                              lda + 1,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamStridedBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         beta,
+                         dB,
+                         ldb,
+                         strideB,
+                         dA,
+                         lda + 1,
+                         strideA,
+                         batch_count));
 
             // (dB == dC) => (ldb == ldc) else invalid value
-            EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              beta,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              dB,
-                                                              ldb + 1,
-                                                              strideA,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-
-            EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              nullptr,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              beta,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              dC,
-                                                              ldc,
-                                                              strideC,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              nullptr,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              dC,
-                                                              ldc,
-                                                              strideC,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              beta,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              nullptr,
-                                                              ldc,
-                                                              strideC,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamStridedBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         beta,
+                         dB,
+                         ldb,
+                         strideB,
+                         dB,
+                         ldb + 1,
+                         strideA,
+                         batch_count));
+
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamStridedBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         nullptr,
+                         dA,
+                         lda,
+                         strideA,
+                         beta,
+                         dB,
+                         ldb,
+                         strideB,
+                         dC,
+                         ldc,
+                         strideC,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamStridedBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         nullptr,
+                         dB,
+                         ldb,
+                         strideB,
+                         dC,
+                         ldc,
+                         strideC,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGeamStridedBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         beta,
+                         dB,
+                         ldb,
+                         strideB,
+                         nullptr,
+                         ldc,
+                         strideC,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  transB,
-                                                                  M,
-                                                                  N,
-                                                                  alpha,
-                                                                  nullptr,
-                                                                  lda,
-                                                                  strideA,
-                                                                  beta,
-                                                                  dB,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  dC,
-                                                                  ldc,
-                                                                  strideC,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGeamStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  transB,
-                                                                  M,
-                                                                  N,
-                                                                  alpha,
-                                                                  dA,
-                                                                  lda,
-                                                                  strideA,
-                                                                  beta,
-                                                                  nullptr,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  dC,
-                                                                  ldc,
-                                                                  strideC,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGeamStridedBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             alpha,
+                             nullptr,
+                             lda,
+                             strideA,
+                             beta,
+                             dB,
+                             ldb,
+                             strideB,
+                             dC,
+                             ldc,
+                             strideC,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGeamStridedBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             alpha,
+                             dA,
+                             lda,
+                             strideA,
+                             beta,
+                             nullptr,
+                             ldb,
+                             strideB,
+                             dC,
+                             ldc,
+                             strideC,
+                             batch_count));
             }
 
             // alpha == 0, can have A be nullptr. beta == 0 can have B be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            zero,
-                                                            nullptr,
-                                                            lda,
-                                                            strideA,
-                                                            beta,
-                                                            dB,
-                                                            ldb,
-                                                            strideB,
-                                                            dC,
-                                                            ldc,
-                                                            strideC,
-                                                            batch_count));
-            CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            alpha,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            zero,
-                                                            nullptr,
-                                                            ldb,
-                                                            strideB,
-                                                            dC,
-                                                            ldc,
-                                                            strideC,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        zero,
+                        nullptr,
+                        lda,
+                        strideA,
+                        beta,
+                        dB,
+                        ldb,
+                        strideB,
+                        dC,
+                        ldc,
+                        strideC,
+                        batch_count));
+            DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        alpha,
+                        dA,
+                        lda,
+                        strideA,
+                        zero,
+                        nullptr,
+                        ldb,
+                        strideB,
+                        dC,
+                        ldc,
+                        strideC,
+                        batch_count));
         }
 
         // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        0,
-                                                        N,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideB,
-                                                        nullptr,
-                                                        lda,
-                                                        strideC,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        M,
-                                                        0,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideB,
-                                                        nullptr,
-                                                        lda,
-                                                        strideC,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        M,
-                                                        N,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideB,
-                                                        nullptr,
-                                                        lda,
-                                                        strideC,
-                                                        0));
+        DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideB,
+                    nullptr,
+                    lda,
+                    strideC,
+                    batch_count));
+        DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideB,
+                    nullptr,
+                    lda,
+                    strideC,
+                    batch_count));
+        DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideB,
+                    nullptr,
+                    lda,
+                    strideC,
+                    0));
     }
 }
 
@@ -395,6 +411,9 @@ void testing_geam_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGeamStridedBatchedFn
         = FORTRAN ? hipblasGeamStridedBatched<T, true> : hipblasGeamStridedBatched<T, false>;
+    auto hipblasGeamStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGeamStridedBatched_64<T, true>
+                                              : hipblasGeamStridedBatched_64<T, false>;
 
     hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
@@ -493,23 +512,24 @@ void testing_geam_strided_batched(const Arguments& arg)
         {
             // &h_alpha and &h_beta are host pointers
             CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-            CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            &h_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            &h_beta,
-                                                            dB,
-                                                            ldb,
-                                                            stride_B,
-                                                            dC,
-                                                            ldc,
-                                                            stride_C,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        &h_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        &h_beta,
+                        dB,
+                        ldb,
+                        stride_B,
+                        dC,
+                        ldc,
+                        stride_C,
+                        batch_count));
 
             CHECK_HIP_ERROR(hipMemcpy(hC1.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
         }
@@ -518,23 +538,24 @@ void testing_geam_strided_batched(const Arguments& arg)
 
             // d_alpha and d_beta are device pointers
             CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-            CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            d_beta,
-                                                            dB,
-                                                            ldb,
-                                                            stride_B,
-                                                            dC,
-                                                            ldc,
-                                                            stride_C,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        d_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        d_beta,
+                        dB,
+                        ldb,
+                        stride_B,
+                        dC,
+                        ldc,
+                        stride_C,
+                        batch_count));
 
             CHECK_HIP_ERROR(hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
         }
@@ -588,23 +609,24 @@ void testing_geam_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            d_beta,
-                                                            dB,
-                                                            ldb,
-                                                            stride_B,
-                                                            dC,
-                                                            ldc,
-                                                            stride_C,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGeamStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        d_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        d_beta,
+                        dB,
+                        ldb,
+                        stride_B,
+                        dC,
+                        ldc,
+                        stride_C,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
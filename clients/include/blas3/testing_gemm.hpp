@@ -53,6 +53,8 @@ void testing_gemm_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmFn = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+    auto hipblasGemmFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemm_64<T, true> : hipblasGemm_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -100,170 +102,144 @@ void testing_gemm_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGemmFn(nullptr, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasGemmFn(handle,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            transB,
-                                            M,
-                                            N,
-                                            K,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            beta,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasGemmFn(handle,
-                                            transA,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            M,
-                                            N,
-                                            K,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            beta,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGemmFn,
+                    (nullptr, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemmFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     beta,
+                     dC,
+                     ldc));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemmFn,
+                    (handle,
+                     transA,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     beta,
+                     dC,
+                     ldc));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasGemmFn(
-                    handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, nullptr, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasGemmFn,
+                (handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, nullptr, dC, ldc));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // alpha check only for host mode. rocBLAS can handle this in device mode too but shouldn't assume in case this changes.
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasGemmFn(
-                        handle, transA, transB, M, N, K, nullptr, dA, lda, dB, ldb, beta, dC, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGemmFn,
+                    (handle, transA, transB, M, N, K, nullptr, dA, lda, dB, ldb, beta, dC, ldc));
 
                 // again, rocBLAS can handle this in device mode but shouldn't assume
-                EXPECT_HIPBLAS_STATUS(hipblasGemmFn(handle,
-                                                    transA,
-                                                    transB,
-                                                    M,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    nullptr,
-                                                    lda,
-                                                    dB,
-                                                    ldb,
-                                                    beta,
-                                                    dC,
-                                                    ldc),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemmFn(handle,
-                                                    transA,
-                                                    transB,
-                                                    M,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    dA,
-                                                    lda,
-                                                    nullptr,
-                                                    ldb,
-                                                    beta,
-                                                    dC,
-                                                    ldc),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemmFn(handle,
-                                                    transA,
-                                                    transB,
-                                                    M,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    dA,
-                                                    lda,
-                                                    dB,
-                                                    ldb,
-                                                    beta,
-                                                    nullptr,
-                                                    ldc),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGemmFn,
+                    (handle, transA, transB, M, N, K, alpha, nullptr, lda, dB, ldb, beta, dC, ldc));
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGemmFn,
+                    (handle, transA, transB, M, N, K, alpha, dA, lda, nullptr, ldb, beta, dC, ldc));
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGemmFn,
+                    (handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, beta, nullptr, ldc));
             }
 
             // If alpha == 0 && beta == 1, can have A, B, C be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmFn(handle,
-                                              transA,
-                                              transB,
-                                              M,
-                                              N,
-                                              K,
-                                              zero,
-                                              nullptr,
-                                              lda,
-                                              nullptr,
-                                              ldb,
-                                              one,
-                                              nullptr,
-                                              ldc));
+            DAPI_CHECK(hipblasGemmFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        zero,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        one,
+                        nullptr,
+                        ldc));
 
             // If alpha == 0, A and B can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-                handle, transA, transB, M, N, K, zero, nullptr, lda, nullptr, ldb, beta, dC, ldc));
+            DAPI_CHECK(
+                hipblasGemmFn,
+                (handle, transA, transB, M, N, K, zero, nullptr, lda, nullptr, ldb, beta, dC, ldc));
 
             // If K == 0, alpha, A, and B can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmFn(handle,
-                                              transA,
-                                              transB,
-                                              M,
-                                              N,
-                                              0,
-                                              nullptr,
-                                              nullptr,
-                                              lda,
-                                              nullptr,
-                                              ldb,
-                                              beta,
-                                              dC,
-                                              ldc));
+            DAPI_CHECK(hipblasGemmFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        0,
+                        nullptr,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        beta,
+                        dC,
+                        ldc));
         }
 
         // If M == 0 || N == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGemmFn(handle,
-                                          transA,
-                                          transB,
-                                          0,
-                                          N,
-                                          K,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          ldb,
-                                          nullptr,
-                                          nullptr,
-                                          ldc));
-        CHECK_HIPBLAS_ERROR(hipblasGemmFn(handle,
-                                          transA,
-                                          transB,
-                                          M,
-                                          0,
-                                          K,
-                                          nullptr,
-                                          nullptr,
-                                          lda,
-                                          nullptr,
-                                          ldb,
-                                          nullptr,
-                                          nullptr,
-                                          ldc));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle,
+                    transA,
+                    transB,
+                    0,
+                    N,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc));
     }
 }
 
@@ -272,6 +248,8 @@ void testing_gemm(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmFn = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+    auto hipblasGemmFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemm_64<T, true> : hipblasGemm_64<T, false>;
 
     hipblasOperation_t transA = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB = char2hipblas_operation(arg.transB);
@@ -360,16 +338,16 @@ void testing_gemm(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
         // library interface
-        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
 
         CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+        DAPI_CHECK(hipblasGemmFn,
+                   (handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
         CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
 
         /* =====================================================================
@@ -430,8 +408,9 @@ void testing_gemm(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+            DAPI_CHECK(
+                hipblasGemmFn,
+                (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
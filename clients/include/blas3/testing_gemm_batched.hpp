@@ -56,6 +56,8 @@ void testing_gemm_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmBatchedFn
         = FORTRAN ? hipblasGemmBatched<T, true> : hipblasGemmBatched<T, false>;
+    auto hipblasGemmBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemmBatched_64<T, true> : hipblasGemmBatched_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -104,244 +106,258 @@ void testing_gemm_batched_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(nullptr,
-                                                   transA,
-                                                   transB,
-                                                   M,
-                                                   N,
-                                                   K,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   beta,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(handle,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   transB,
-                                                   M,
-                                                   N,
-                                                   K,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   beta,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(handle,
-                                                   transA,
-                                                   (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                   M,
-                                                   N,
-                                                   K,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   beta,
-                                                   dC.ptr_on_device(),
-                                                   ldc,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGemmBatchedFn,
+                    (nullptr,
+                     transA,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemmBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemmBatchedFn,
+                    (handle,
+                     transA,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       K,
-                                                       alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       nullptr,
-                                                       dC.ptr_on_device(),
-                                                       ldc,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemmBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         K,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         dB.ptr_on_device(),
+                         ldb,
+                         nullptr,
+                         dC.ptr_on_device(),
+                         ldc,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // alpha check only for host mode. rocBLAS can handle this in device mode too but shouldn't assume in case this changes.
-                EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           N,
-                                                           K,
-                                                           nullptr,
-                                                           dA.ptr_on_device(),
-                                                           lda,
-                                                           dB.ptr_on_device(),
-                                                           ldb,
-                                                           beta,
-                                                           dC.ptr_on_device(),
-                                                           ldc,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             nullptr,
+                             dA.ptr_on_device(),
+                             lda,
+                             dB.ptr_on_device(),
+                             ldb,
+                             beta,
+                             dC.ptr_on_device(),
+                             ldc,
+                             batch_count));
 
                 // again, rocBLAS can handle this in device mode but shouldn't assume
-                EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           N,
-                                                           K,
-                                                           alpha,
-                                                           nullptr,
-                                                           lda,
-                                                           dB.ptr_on_device(),
-                                                           ldb,
-                                                           beta,
-                                                           dC.ptr_on_device(),
-                                                           ldc,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           N,
-                                                           K,
-                                                           alpha,
-                                                           dA.ptr_on_device(),
-                                                           lda,
-                                                           nullptr,
-                                                           ldb,
-                                                           beta,
-                                                           dC.ptr_on_device(),
-                                                           ldc,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedFn(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           N,
-                                                           K,
-                                                           alpha,
-                                                           dA.ptr_on_device(),
-                                                           lda,
-                                                           dB.ptr_on_device(),
-                                                           ldb,
-                                                           beta,
-                                                           nullptr,
-                                                           ldc,
-                                                           batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             alpha,
+                             nullptr,
+                             lda,
+                             dB.ptr_on_device(),
+                             ldb,
+                             beta,
+                             dC.ptr_on_device(),
+                             ldc,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             alpha,
+                             dA.ptr_on_device(),
+                             lda,
+                             nullptr,
+                             ldb,
+                             beta,
+                             dC.ptr_on_device(),
+                             ldc,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             alpha,
+                             dA.ptr_on_device(),
+                             lda,
+                             dB.ptr_on_device(),
+                             ldb,
+                             beta,
+                             nullptr,
+                             ldc,
+                             batch_count));
             }
 
             // If alpha == 0 && beta == 1, can have A, B, C be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     K,
-                                                     zero,
-                                                     nullptr,
-                                                     lda,
-                                                     nullptr,
-                                                     ldb,
-                                                     one,
-                                                     nullptr,
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGemmBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        zero,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        one,
+                        nullptr,
+                        ldc,
+                        batch_count));
 
             // If alpha == 0, A and B can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     K,
-                                                     zero,
-                                                     nullptr,
-                                                     lda,
-                                                     nullptr,
-                                                     ldb,
-                                                     beta,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGemmBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        zero,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        beta,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
 
             // If K == 0, alpha, A, and B can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     0,
-                                                     nullptr,
-                                                     nullptr,
-                                                     lda,
-                                                     nullptr,
-                                                     ldb,
-                                                     beta,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGemmBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        0,
+                        nullptr,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        beta,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
         }
 
         // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 0,
-                                                 N,
-                                                 K,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 ldb,
-                                                 nullptr,
-                                                 nullptr,
-                                                 ldc,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 0,
-                                                 K,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 ldb,
-                                                 nullptr,
-                                                 nullptr,
-                                                 ldc,
-                                                 batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 N,
-                                                 K,
-                                                 nullptr,
-                                                 nullptr,
-                                                 lda,
-                                                 nullptr,
-                                                 ldb,
-                                                 nullptr,
-                                                 nullptr,
-                                                 ldc,
-                                                 0));
+        DAPI_CHECK(hipblasGemmBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    0,
+                    N,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc,
+                    batch_count));
+        DAPI_CHECK(hipblasGemmBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc,
+                    batch_count));
+        DAPI_CHECK(hipblasGemmBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc,
+                    0));
     }
 }
 
@@ -351,6 +367,8 @@ void testing_gemm_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmBatchedFn
         = FORTRAN ? hipblasGemmBatched<T, true> : hipblasGemmBatched<T, false>;
+    auto hipblasGemmBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemmBatched_64<T, true> : hipblasGemmBatched_64<T, false>;
 
     hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
@@ -486,42 +504,44 @@ void testing_gemm_batched(const Arguments& arg)
 
         // test hipBLAS batched gemm with alpha and beta pointers on device
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 N,
-                                                 K,
-                                                 d_alpha,
-                                                 (const T* const*)dA.ptr_on_device(),
-                                                 lda,
-                                                 (const T* const*)dB.ptr_on_device(),
-                                                 ldb,
-                                                 d_beta,
-                                                 dC.ptr_on_device(),
-                                                 ldc,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGemmBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    d_alpha,
+                    (const T* const*)dA.ptr_on_device(),
+                    lda,
+                    (const T* const*)dB.ptr_on_device(),
+                    ldb,
+                    d_beta,
+                    dC.ptr_on_device(),
+                    ldc,
+                    batch_count));
 
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
         // test hipBLAS batched gemm with alpha and beta pointers on host
         CHECK_HIP_ERROR(dC.transfer_from(hC_host));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 N,
-                                                 K,
-                                                 &h_alpha,
-                                                 (const T* const*)dA.ptr_on_device(),
-                                                 lda,
-                                                 (const T* const*)dB.ptr_on_device(),
-                                                 ldb,
-                                                 &h_beta,
-                                                 dC.ptr_on_device(),
-                                                 ldc,
-                                                 batch_count));
+        DAPI_CHECK(hipblasGemmBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    &h_alpha,
+                    (const T* const*)dA.ptr_on_device(),
+                    lda,
+                    (const T* const*)dB.ptr_on_device(),
+                    ldb,
+                    &h_beta,
+                    dC.ptr_on_device(),
+                    ldc,
+                    batch_count));
 
         CHECK_HIP_ERROR(hC_host.transfer_from(dC));
 
@@ -564,21 +584,22 @@ void testing_gemm_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     K,
-                                                     &h_alpha,
-                                                     (const T* const*)dA.ptr_on_device(),
-                                                     lda,
-                                                     (const T* const*)dB.ptr_on_device(),
-                                                     ldb,
-                                                     &h_beta,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
+            DAPI_CHECK(hipblasGemmBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        &h_alpha,
+                        (const T* const*)dA.ptr_on_device(),
+                        lda,
+                        (const T* const*)dB.ptr_on_device(),
+                        ldb,
+                        &h_beta,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
         }
 
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
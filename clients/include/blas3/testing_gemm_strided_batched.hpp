@@ -57,6 +57,9 @@ void testing_gemm_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmStridedBatchedFn
         = FORTRAN ? hipblasGemmStridedBatched<T, true> : hipblasGemmStridedBatched<T, false>;
+    auto hipblasGemmStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGemmStridedBatched_64<T, true>
+                                              : hipblasGemmStridedBatched_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -109,288 +112,300 @@ void testing_gemm_strided_batched_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedFn(nullptr,
-                                                          transA,
-                                                          transB,
-                                                          M,
-                                                          N,
-                                                          K,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          beta,
-                                                          dC,
-                                                          ldc,
-                                                          strideC,
-                                                          batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGemmStridedBatchedFn(handle,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        transB,
-                                        M,
-                                        N,
-                                        K,
-                                        alpha,
-                                        dA,
-                                        lda,
-                                        strideA,
-                                        dB,
-                                        ldb,
-                                        strideB,
-                                        beta,
-                                        dC,
-                                        ldc,
-                                        strideC,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGemmStridedBatchedFn(handle,
-                                        transA,
-                                        (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                        M,
-                                        N,
-                                        K,
-                                        alpha,
-                                        dA,
-                                        lda,
-                                        strideA,
-                                        dB,
-                                        ldb,
-                                        strideB,
-                                        beta,
-                                        dC,
-                                        ldc,
-                                        strideC,
-                                        batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasGemmStridedBatchedFn,
+                    (nullptr,
+                     transA,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     beta,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemmStridedBatchedFn,
+                    (handle,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     beta,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasGemmStridedBatchedFn,
+                    (handle,
+                     transA,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     beta,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              K,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              nullptr,
-                                                              dC,
-                                                              ldc,
-                                                              strideC,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasGemmStridedBatchedFn,
+                        (handle,
+                         transA,
+                         transB,
+                         M,
+                         N,
+                         K,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         dB,
+                         ldb,
+                         strideB,
+                         nullptr,
+                         dC,
+                         ldc,
+                         strideC,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
                 // alpha check only for host mode. rocBLAS can handle this in device mode too but shouldn't assume in case this changes.
-                EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  transB,
-                                                                  M,
-                                                                  N,
-                                                                  K,
-                                                                  nullptr,
-                                                                  dA,
-                                                                  lda,
-                                                                  strideA,
-                                                                  dB,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  beta,
-                                                                  dC,
-                                                                  ldc,
-                                                                  strideC,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmStridedBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             nullptr,
+                             dA,
+                             lda,
+                             strideA,
+                             dB,
+                             ldb,
+                             strideB,
+                             beta,
+                             dC,
+                             ldc,
+                             strideC,
+                             batch_count));
 
                 // again, rocBLAS can handle this in device mode but shouldn't assume
-                EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  transB,
-                                                                  M,
-                                                                  N,
-                                                                  K,
-                                                                  alpha,
-                                                                  nullptr,
-                                                                  lda,
-                                                                  strideA,
-                                                                  dB,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  beta,
-                                                                  dC,
-                                                                  ldc,
-                                                                  strideC,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  transB,
-                                                                  M,
-                                                                  N,
-                                                                  K,
-                                                                  alpha,
-                                                                  dA,
-                                                                  lda,
-                                                                  strideA,
-                                                                  nullptr,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  beta,
-                                                                  dC,
-                                                                  ldc,
-                                                                  strideC,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedFn(handle,
-                                                                  transA,
-                                                                  transB,
-                                                                  M,
-                                                                  N,
-                                                                  K,
-                                                                  alpha,
-                                                                  dA,
-                                                                  lda,
-                                                                  strideA,
-                                                                  dB,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  beta,
-                                                                  nullptr,
-                                                                  ldc,
-                                                                  strideC,
-                                                                  batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmStridedBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             alpha,
+                             nullptr,
+                             lda,
+                             strideA,
+                             dB,
+                             ldb,
+                             strideB,
+                             beta,
+                             dC,
+                             ldc,
+                             strideC,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmStridedBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             alpha,
+                             dA,
+                             lda,
+                             strideA,
+                             nullptr,
+                             ldb,
+                             strideB,
+                             beta,
+                             dC,
+                             ldc,
+                             strideC,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasGemmStridedBatchedFn,
+                            (handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             alpha,
+                             dA,
+                             lda,
+                             strideA,
+                             dB,
+                             ldb,
+                             strideB,
+                             beta,
+                             nullptr,
+                             ldc,
+                             strideC,
+                             batch_count));
             }
 
             // If alpha == 0 && beta == 1, can have A, B, C be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            K,
-                                                            zero,
-                                                            nullptr,
-                                                            lda,
-                                                            strideA,
-                                                            nullptr,
-                                                            ldb,
-                                                            strideB,
-                                                            one,
-                                                            nullptr,
-                                                            ldc,
-                                                            strideC,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        zero,
+                        nullptr,
+                        lda,
+                        strideA,
+                        nullptr,
+                        ldb,
+                        strideB,
+                        one,
+                        nullptr,
+                        ldc,
+                        strideC,
+                        batch_count));
 
             // If alpha == 0, A and B can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            K,
-                                                            zero,
-                                                            nullptr,
-                                                            lda,
-                                                            strideA,
-                                                            nullptr,
-                                                            ldb,
-                                                            strideB,
-                                                            beta,
-                                                            dC,
-                                                            ldc,
-                                                            strideC,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        zero,
+                        nullptr,
+                        lda,
+                        strideA,
+                        nullptr,
+                        ldb,
+                        strideB,
+                        beta,
+                        dC,
+                        ldc,
+                        strideC,
+                        batch_count));
 
             // If K == 0, alpha, A, and B can be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            0,
-                                                            nullptr,
-                                                            nullptr,
-                                                            lda,
-                                                            strideA,
-                                                            nullptr,
-                                                            ldb,
-                                                            strideB,
-                                                            beta,
-                                                            dC,
-                                                            ldc,
-                                                            strideC,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        0,
+                        nullptr,
+                        nullptr,
+                        lda,
+                        strideA,
+                        nullptr,
+                        ldb,
+                        strideB,
+                        beta,
+                        dC,
+                        ldc,
+                        strideC,
+                        batch_count));
         }
 
         // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        0,
-                                                        N,
-                                                        K,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        lda,
-                                                        strideB,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideC,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        M,
-                                                        0,
-                                                        K,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        lda,
-                                                        strideB,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideC,
-                                                        batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        M,
-                                                        N,
-                                                        K,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideA,
-                                                        nullptr,
-                                                        lda,
-                                                        strideB,
-                                                        nullptr,
-                                                        nullptr,
-                                                        lda,
-                                                        strideC,
-                                                        0));
+        DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    0,
+                    N,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    lda,
+                    strideB,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideC,
+                    batch_count));
+        DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    lda,
+                    strideB,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideC,
+                    batch_count));
+        DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    lda,
+                    strideB,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideC,
+                    0));
     }
 }
 
@@ -400,6 +415,9 @@ void testing_gemm_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmStridedBatchedFn
         = FORTRAN ? hipblasGemmStridedBatched<T, true> : hipblasGemmStridedBatched<T, false>;
+    auto hipblasGemmStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGemmStridedBatched_64<T, true>
+                                              : hipblasGemmStridedBatched_64<T, false>;
 
     hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
     hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
@@ -496,24 +514,25 @@ void testing_gemm_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
         // library interface
-        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        M,
-                                                        N,
-                                                        K,
-                                                        &h_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dB,
-                                                        ldb,
-                                                        stride_B,
-                                                        &h_beta,
-                                                        dC,
-                                                        ldc,
-                                                        stride_C,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    &h_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    &h_beta,
+                    dC,
+                    ldc,
+                    stride_C,
+                    batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
@@ -521,24 +540,25 @@ void testing_gemm_strided_batched(const Arguments& arg)
         // device mode
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
-        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                        transA,
-                                                        transB,
-                                                        M,
-                                                        N,
-                                                        K,
-                                                        d_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dB,
-                                                        ldb,
-                                                        stride_B,
-                                                        d_beta,
-                                                        dC,
-                                                        ldc,
-                                                        stride_C,
-                                                        batch_count));
+        DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                   (handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    d_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    d_beta,
+                    dC,
+                    ldc,
+                    stride_C,
+                    batch_count));
         CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
 
         /* =====================================================================
@@ -601,24 +621,25 @@ void testing_gemm_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
-                                                            transA,
-                                                            transB,
-                                                            M,
-                                                            N,
-                                                            K,
-                                                            &h_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dB,
-                                                            ldb,
-                                                            stride_B,
-                                                            &h_beta,
-                                                            dC,
-                                                            ldc,
-                                                            stride_C,
-                                                            batch_count));
+            DAPI_CHECK(hipblasGemmStridedBatchedFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        &h_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        dB,
+                        ldb,
+                        stride_B,
+                        &h_beta,
+                        dC,
+                        ldc,
+                        stride_C,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
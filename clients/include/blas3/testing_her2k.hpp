@@ -44,6 +44,8 @@ void testing_her2k_bad_arg(const Arguments& arg)
     using U             = real_t<T>;
     bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHer2kFn = FORTRAN ? hipblasHer2k<T, U, true> : hipblasHer2k<T, U, false>;
+    auto hipblasHer2kFn_64
+        = arg.api == FORTRAN_64 ? hipblasHer2k_64<T, U, true> : hipblasHer2k_64<T, U, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -87,107 +89,100 @@ void testing_her2k_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHer2kFn(nullptr, uplo, transA, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kFn(handle,
-                                             HIPBLAS_FILL_MODE_FULL,
-                                             transA,
-                                             N,
-                                             K,
-                                             alpha,
-                                             dA,
-                                             lda,
-                                             dB,
-                                             ldb,
-                                             beta,
-                                             dC,
-                                             ldc),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kFn(handle,
-                                             (hipblasFillMode_t)HIPBLAS_OP_N,
-                                             transA,
-                                             N,
-                                             K,
-                                             alpha,
-                                             dA,
-                                             lda,
-                                             dB,
-                                             ldb,
-                                             beta,
-                                             dC,
-                                             ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHer2kFn,
+                    (nullptr, uplo, transA, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasHer2kFn,
+            (handle, HIPBLAS_FILL_MODE_FULL, transA, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHer2kFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     beta,
+                     dC,
+                     ldc));
         // EXPECT_HIPBLAS_STATUS(
         //     hipblasHer2kFn(
         //         handle, uplo, HIPBLAS_OP_T, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc),
         //     HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kFn(handle,
-                                             uplo,
-                                             (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                             N,
-                                             K,
-                                             alpha,
-                                             dA,
-                                             lda,
-                                             dB,
-                                             ldb,
-                                             beta,
-                                             dC,
-                                             ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHer2kFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     beta,
+                     dC,
+                     ldc));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHer2kFn(
-                    handle, uplo, transA, N, K, nullptr, dA, lda, dB, ldb, beta, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHer2kFn(
-                    handle, uplo, transA, N, K, alpha, dA, lda, dB, ldb, nullptr, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHer2kFn,
+                        (handle, uplo, transA, N, K, nullptr, dA, lda, dB, ldb, beta, dC, ldc));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHer2kFn,
+                        (handle, uplo, transA, N, K, alpha, dA, lda, dB, ldb, nullptr, dC, ldc));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHer2kFn(
-                        handle, uplo, transA, N, K, alpha, nullptr, lda, dB, ldb, beta, dC, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHer2kFn(
-                        handle, uplo, transA, N, K, alpha, dA, lda, nullptr, ldb, beta, dC, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHer2kFn(
-                        handle, uplo, transA, N, K, alpha, dA, lda, dB, ldb, beta, nullptr, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHer2kFn,
+                    (handle, uplo, transA, N, K, alpha, nullptr, lda, dB, ldb, beta, dC, ldc));
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHer2kFn,
+                    (handle, uplo, transA, N, K, alpha, dA, lda, nullptr, ldb, beta, dC, ldc));
+                DAPI_EXPECT(
+                    HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHer2kFn,
+                    (handle, uplo, transA, N, K, alpha, dA, lda, dB, ldb, beta, nullptr, ldc));
             }
 
             // If k == 0 && beta == 1, A, B, C may be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasHer2kFn(
-                handle, uplo, transA, N, 0, alpha, nullptr, lda, nullptr, ldb, one, nullptr, ldc));
+            DAPI_CHECK(
+                hipblasHer2kFn,
+                (handle, uplo, transA, N, 0, alpha, nullptr, lda, nullptr, ldb, one, nullptr, ldc));
 
             // If alpha == 0 && beta == 1, A, B, C may be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasHer2kFn(
-                handle, uplo, transA, N, K, zero, nullptr, lda, nullptr, ldb, one, nullptr, ldc));
+            DAPI_CHECK(
+                hipblasHer2kFn,
+                (handle, uplo, transA, N, K, zero, nullptr, lda, nullptr, ldb, one, nullptr, ldc));
         }
 
         // If N == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHer2kFn(handle,
-                                           uplo,
-                                           transA,
-                                           0,
-                                           K,
-                                           nullptr,
-                                           nullptr,
-                                           lda,
-                                           nullptr,
-                                           ldb,
-                                           nullptr,
-                                           nullptr,
-                                           ldc));
+        DAPI_CHECK(hipblasHer2kFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc));
     }
 }
 
@@ -197,6 +192,8 @@ void testing_her2k(const Arguments& arg)
     using U             = real_t<T>;
     bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHer2kFn = FORTRAN ? hipblasHer2k<T, U, true> : hipblasHer2k<T, U, false>;
+    auto hipblasHer2kFn_64
+        = arg.api == FORTRAN_64 ? hipblasHer2k_64<T, U, true> : hipblasHer2k_64<T, U, false>;
 
     int N   = arg.N;
     int K   = arg.K;
@@ -263,16 +260,16 @@ void testing_her2k(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHer2kFn(
-            handle, uplo, transA, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        DAPI_CHECK(hipblasHer2kFn,
+                   (handle, uplo, transA, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
 
         CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(
-            hipblasHer2kFn(handle, uplo, transA, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+        DAPI_CHECK(hipblasHer2kFn,
+                   (handle, uplo, transA, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
 
         CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
 
@@ -308,8 +305,8 @@ void testing_her2k(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHer2kFn(
-                handle, uplo, transA, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+            DAPI_CHECK(hipblasHer2kFn,
+                       (handle, uplo, transA, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
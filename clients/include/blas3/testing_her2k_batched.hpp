@@ -54,6 +54,9 @@ void testing_her2k_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHer2kBatchedFn
         = FORTRAN ? hipblasHer2kBatched<T, U, true> : hipblasHer2kBatched<T, U, false>;
+    auto hipblasHer2kBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasHer2kBatched_64<T, U, true>
+                                        : hipblasHer2kBatched_64<T, U, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -98,227 +101,241 @@ void testing_her2k_batched_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(nullptr,
-                                                    uplo,
-                                                    transA,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    dB.ptr_on_device(),
-                                                    ldb,
-                                                    beta,
-                                                    dC.ptr_on_device(),
-                                                    ldc,
-                                                    batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                    HIPBLAS_FILL_MODE_FULL,
-                                                    transA,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    dB.ptr_on_device(),
-                                                    ldb,
-                                                    beta,
-                                                    dC.ptr_on_device(),
-                                                    ldc,
-                                                    batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                    (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                    transA,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    dB.ptr_on_device(),
-                                                    ldb,
-                                                    beta,
-                                                    dC.ptr_on_device(),
-                                                    ldc,
-                                                    batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                    uplo,
-                                                    HIPBLAS_OP_T,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    dB.ptr_on_device(),
-                                                    ldb,
-                                                    beta,
-                                                    dC.ptr_on_device(),
-                                                    ldc,
-                                                    batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                    uplo,
-                                                    (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                    N,
-                                                    K,
-                                                    alpha,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    dB.ptr_on_device(),
-                                                    ldb,
-                                                    beta,
-                                                    dC.ptr_on_device(),
-                                                    ldc,
-                                                    batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHer2kBatchedFn,
+                    (nullptr,
+                     uplo,
+                     transA,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHer2kBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHer2kBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHer2kBatchedFn,
+                    (handle,
+                     uplo,
+                     HIPBLAS_OP_T,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHer2kBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     beta,
+                     dC.ptr_on_device(),
+                     ldc,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                        uplo,
-                                                        transA,
-                                                        N,
-                                                        K,
-                                                        nullptr,
-                                                        dA.ptr_on_device(),
-                                                        lda,
-                                                        dB.ptr_on_device(),
-                                                        ldb,
-                                                        beta,
-                                                        dC.ptr_on_device(),
-                                                        ldc,
-                                                        batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                        uplo,
-                                                        transA,
-                                                        N,
-                                                        K,
-                                                        alpha,
-                                                        dA.ptr_on_device(),
-                                                        lda,
-                                                        dB,
-                                                        ldb,
-                                                        nullptr,
-                                                        dC.ptr_on_device(),
-                                                        ldc,
-                                                        batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHer2kBatchedFn,
+                        (handle,
+                         uplo,
+                         transA,
+                         N,
+                         K,
+                         nullptr,
+                         dA.ptr_on_device(),
+                         lda,
+                         dB.ptr_on_device(),
+                         ldb,
+                         beta,
+                         dC.ptr_on_device(),
+                         ldc,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHer2kBatchedFn,
+                        (handle,
+                         uplo,
+                         transA,
+                         N,
+                         K,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         dB,
+                         ldb,
+                         nullptr,
+                         dC.ptr_on_device(),
+                         ldc,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                            uplo,
-                                                            transA,
-                                                            N,
-                                                            K,
-                                                            alpha,
-                                                            nullptr,
-                                                            lda,
-                                                            dB.ptr_on_device(),
-                                                            ldb,
-                                                            beta,
-                                                            dC.ptr_on_device(),
-                                                            ldc,
-                                                            batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                            uplo,
-                                                            transA,
-                                                            N,
-                                                            K,
-                                                            alpha,
-                                                            dA.ptr_on_device(),
-                                                            lda,
-                                                            nullptr,
-                                                            ldb,
-                                                            beta,
-                                                            dC.ptr_on_device(),
-                                                            ldc,
-                                                            batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasHer2kBatchedFn(handle,
-                                                            uplo,
-                                                            transA,
-                                                            N,
-                                                            K,
-                                                            alpha,
-                                                            dA.ptr_on_device(),
-                                                            lda,
-                                                            dB.ptr_on_device(),
-                                                            ldb,
-                                                            beta,
-                                                            nullptr,
-                                                            ldc,
-                                                            batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHer2kBatchedFn,
+                            (handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             alpha,
+                             nullptr,
+                             lda,
+                             dB.ptr_on_device(),
+                             ldb,
+                             beta,
+                             dC.ptr_on_device(),
+                             ldc,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHer2kBatchedFn,
+                            (handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             alpha,
+                             dA.ptr_on_device(),
+                             lda,
+                             nullptr,
+                             ldb,
+                             beta,
+                             dC.ptr_on_device(),
+                             ldc,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHer2kBatchedFn,
+                            (handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             alpha,
+                             dA.ptr_on_device(),
+                             lda,
+                             dB.ptr_on_device(),
+                             ldb,
+                             beta,
+                             nullptr,
+                             ldc,
+                             batch_count));
             }
 
             // If k == 0 && beta == 1, A, B, C may be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasHer2kBatchedFn(handle,
-                                                      uplo,
-                                                      transA,
-                                                      N,
-                                                      0,
-                                                      alpha,
-                                                      nullptr,
-                                                      lda,
-                                                      nullptr,
-                                                      ldb,
-                                                      one,
-                                                      nullptr,
-                                                      ldc,
-                                                      batch_count));
+            DAPI_CHECK(hipblasHer2kBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        N,
+                        0,
+                        alpha,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        one,
+                        nullptr,
+                        ldc,
+                        batch_count));
 
             // If alpha == 0 && beta == 1, A, B, C may be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasHer2kBatchedFn(handle,
-                                                      uplo,
-                                                      transA,
-                                                      N,
-                                                      K,
-                                                      zero,
-                                                      nullptr,
-                                                      lda,
-                                                      nullptr,
-                                                      ldb,
-                                                      one,
-                                                      nullptr,
-                                                      ldc,
-                                                      batch_count));
+            DAPI_CHECK(hipblasHer2kBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        N,
+                        K,
+                        zero,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        one,
+                        nullptr,
+                        ldc,
+                        batch_count));
         }
 
         // If N == 0 || batch_count == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHer2kBatchedFn(handle,
-                                                  uplo,
-                                                  transA,
-                                                  0,
-                                                  K,
-                                                  nullptr,
-                                                  nullptr,
-                                                  lda,
-                                                  nullptr,
-                                                  ldb,
-                                                  nullptr,
-                                                  nullptr,
-                                                  ldc,
-                                                  batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasHer2kBatchedFn(handle,
-                                                  uplo,
-                                                  transA,
-                                                  N,
-                                                  K,
-                                                  nullptr,
-                                                  nullptr,
-                                                  lda,
-                                                  nullptr,
-                                                  ldb,
-                                                  nullptr,
-                                                  nullptr,
-                                                  ldc,
-                                                  0));
+        DAPI_CHECK(hipblasHer2kBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc,
+                    batch_count));
+        DAPI_CHECK(hipblasHer2kBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    N,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    nullptr,
+                    ldc,
+                    0));
     }
 }
 
@@ -329,6 +346,9 @@ void testing_her2k_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHer2kBatchedFn
         = FORTRAN ? hipblasHer2kBatched<T, U, true> : hipblasHer2kBatched<T, U, false>;
+    auto hipblasHer2kBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasHer2kBatched_64<T, U, true>
+                                        : hipblasHer2kBatched_64<T, U, false>;
 
     int N           = arg.N;
     int K           = arg.K;
@@ -399,39 +419,41 @@ void testing_her2k_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasHer2kBatchedFn(handle,
-                                                  uplo,
-                                                  transA,
-                                                  N,
-                                                  K,
-                                                  &h_alpha,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  dB.ptr_on_device(),
-                                                  ldb,
-                                                  &h_beta,
-                                                  dC.ptr_on_device(),
-                                                  ldc,
-                                                  batch_count));
+        DAPI_CHECK(hipblasHer2kBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    N,
+                    K,
+                    &h_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    &h_beta,
+                    dC.ptr_on_device(),
+                    ldc,
+                    batch_count));
 
         CHECK_HIP_ERROR(hC_host.transfer_from(dC));
 
         CHECK_HIP_ERROR(dC.transfer_from(hC_device));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasHer2kBatchedFn(handle,
-                                                  uplo,
-                                                  transA,
-                                                  N,
-                                                  K,
-                                                  d_alpha,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  dB.ptr_on_device(),
-                                                  ldb,
-                                                  d_beta,
-                                                  dC.ptr_on_device(),
-                                                  ldc,
-                                                  batch_count));
+        DAPI_CHECK(hipblasHer2kBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    N,
+                    K,
+                    d_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    d_beta,
+                    dC.ptr_on_device(),
+                    ldc,
+                    batch_count));
 
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
@@ -473,20 +495,21 @@ void testing_her2k_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasHer2kBatchedFn(handle,
-                                                      uplo,
-                                                      transA,
-                                                      N,
-                                                      K,
-                                                      d_alpha,
-                                                      dA.ptr_on_device(),
-                                                      lda,
-                                                      dB.ptr_on_device(),
-                                                      ldb,
-                                                      d_beta,
-                                                      dC.ptr_on_device(),
-                                                      ldc,
-                                                      batch_count));
+            DAPI_CHECK(hipblasHer2kBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        N,
+                        K,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        dB.ptr_on_device(),
+                        ldb,
+                        d_beta,
+                        dC.ptr_on_device(),
+                        ldc,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
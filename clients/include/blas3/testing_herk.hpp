@@ -44,6 +44,8 @@ void testing_herk_bad_arg(const Arguments& arg)
     using U            = real_t<T>;
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHerkFn = FORTRAN ? hipblasHerk<T, U, true> : hipblasHerk<T, U, false>;
+    auto hipblasHerkFn_64
+        = arg.api == FORTRAN_64 ? hipblasHerk_64<T, U, true> : hipblasHerk_64<T, U, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -83,77 +85,69 @@ void testing_herk_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHerkFn(nullptr, uplo, transA, N, K, alpha, dA, lda, beta, dC, ldc),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasHerkFn(
-                handle, HIPBLAS_FILL_MODE_FULL, transA, N, K, alpha, dA, lda, beta, dC, ldc),
-            HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasHerkFn(handle,
-                                            (hipblasFillMode_t)HIPBLAS_OP_N,
-                                            transA,
-                                            N,
-                                            K,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            beta,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasHerkFn,
+                    (nullptr, uplo, transA, N, K, alpha, dA, lda, beta, dC, ldc));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasHerkFn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, transA, N, K, alpha, dA, lda, beta, dC, ldc));
+
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_ENUM,
+            hipblasHerkFn,
+            (handle, (hipblasFillMode_t)HIPBLAS_OP_N, transA, N, K, alpha, dA, lda, beta, dC, ldc));
 
         // TODO: Supported in cuBLAS but not in rocBLAS? Need to investigate.
         // EXPECT_HIPBLAS_STATUS(
         //     hipblasHerkFn(handle, uplo, HIPBLAS_OP_T, N, K, alpha, dA, lda, beta, dC, ldc),
         //     HIPBLAS_STATUS_INVALID_VALUE);
 
-        EXPECT_HIPBLAS_STATUS(hipblasHerkFn(handle,
-                                            uplo,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            N,
-                                            K,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            beta,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasHerkFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     beta,
+                     dC,
+                     ldc));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHerkFn(handle, uplo, transA, N, K, nullptr, dA, lda, beta, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasHerkFn(handle, uplo, transA, N, K, alpha, dA, lda, nullptr, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHerkFn,
+                        (handle, uplo, transA, N, K, nullptr, dA, lda, beta, dC, ldc));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasHerkFn,
+                        (handle, uplo, transA, N, K, alpha, dA, lda, nullptr, dC, ldc));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHerkFn(handle, uplo, transA, N, K, alpha, nullptr, lda, beta, dC, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasHerkFn(handle, uplo, transA, N, K, alpha, dA, lda, beta, nullptr, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHerkFn,
+                            (handle, uplo, transA, N, K, alpha, nullptr, lda, beta, dC, ldc));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasHerkFn,
+                            (handle, uplo, transA, N, K, alpha, dA, lda, beta, nullptr, ldc));
             }
 
             // If k == 0 && beta == 1, A, C may be nullptr
-            CHECK_HIPBLAS_ERROR(
-                hipblasHerkFn(handle, uplo, transA, N, 0, alpha, nullptr, lda, one, nullptr, ldc));
+            DAPI_CHECK(hipblasHerkFn,
+                       (handle, uplo, transA, N, 0, alpha, nullptr, lda, one, nullptr, ldc));
 
             // If alpha == 0 && beta == 1, A, C may be nullptr
-            CHECK_HIPBLAS_ERROR(
-                hipblasHerkFn(handle, uplo, transA, N, K, zero, nullptr, lda, one, nullptr, ldc));
+            DAPI_CHECK(
+                hipblasHerkFn, (handle, uplo, transA, N, K, zero, nullptr, lda, one, nullptr, ldc));
         }
 
         // If N == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasHerkFn(
-            handle, uplo, transA, 0, K, nullptr, nullptr, lda, nullptr, nullptr, ldc));
+        DAPI_CHECK(hipblasHerkFn,
+                   (handle, uplo, transA, 0, K, nullptr, nullptr, lda, nullptr, nullptr, ldc));
     }
 }
 
@@ -163,6 +157,8 @@ void testing_herk(const Arguments& arg)
     using U            = real_t<T>;
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasHerkFn = FORTRAN ? hipblasHerk<T, U, true> : hipblasHerk<T, U, false>;
+    auto hipblasHerkFn_64
+        = arg.api == FORTRAN_64 ? hipblasHerk_64<T, U, true> : hipblasHerk_64<T, U, false>;
 
     int N   = arg.N;
     int K   = arg.K;
@@ -219,16 +215,15 @@ void testing_herk(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(
-            hipblasHerkFn(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+        DAPI_CHECK(
+            hipblasHerkFn, (handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
 
         CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(
-            hipblasHerkFn(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+        DAPI_CHECK(hipblasHerkFn, (handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
@@ -265,8 +260,8 @@ void testing_herk(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(
-                hipblasHerkFn(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+            DAPI_CHECK(
+                hipblasHerkFn, (handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
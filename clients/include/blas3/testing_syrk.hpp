@@ -43,6 +43,8 @@ void testing_syrk_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrkFn = FORTRAN ? hipblasSyrk<T, true> : hipblasSyrk<T, false>;
+    auto hipblasSyrkFn_64
+        = arg.api == FORTRAN_64 ? hipblasSyrk_64<T, true> : hipblasSyrk_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -82,70 +84,62 @@ void testing_syrk_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSyrkFn(nullptr, uplo, transA, N, K, alpha, dA, lda, beta, dC, ldc),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSyrkFn(
-                handle, HIPBLAS_FILL_MODE_FULL, transA, N, K, alpha, dA, lda, beta, dC, ldc),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasSyrkFn(handle,
-                                            (hipblasFillMode_t)HIPBLAS_OP_N,
-                                            transA,
-                                            N,
-                                            K,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            beta,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasSyrkFn(handle,
-                                            uplo,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            N,
-                                            K,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            beta,
-                                            dC,
-                                            ldc),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasSyrkFn,
+                    (nullptr, uplo, transA, N, K, alpha, dA, lda, beta, dC, ldc));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyrkFn,
+                    (handle, HIPBLAS_FILL_MODE_FULL, transA, N, K, alpha, dA, lda, beta, dC, ldc));
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_ENUM,
+            hipblasSyrkFn,
+            (handle, (hipblasFillMode_t)HIPBLAS_OP_N, transA, N, K, alpha, dA, lda, beta, dC, ldc));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSyrkFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     beta,
+                     dC,
+                     ldc));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSyrkFn(handle, uplo, transA, N, K, nullptr, dA, lda, beta, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasSyrkFn(handle, uplo, transA, N, K, alpha, dA, lda, nullptr, dC, ldc),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyrkFn,
+                        (handle, uplo, transA, N, K, nullptr, dA, lda, beta, dC, ldc));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyrkFn,
+                        (handle, uplo, transA, N, K, alpha, dA, lda, nullptr, dC, ldc));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasSyrkFn(handle, uplo, transA, N, K, alpha, nullptr, lda, beta, dC, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasSyrkFn(handle, uplo, transA, N, K, alpha, dA, lda, beta, nullptr, ldc),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSyrkFn,
+                            (handle, uplo, transA, N, K, alpha, nullptr, lda, beta, dC, ldc));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSyrkFn,
+                            (handle, uplo, transA, N, K, alpha, dA, lda, beta, nullptr, ldc));
             }
 
             // If k == 0 && beta == 1, A, C may be nullptr
-            CHECK_HIPBLAS_ERROR(
-                hipblasSyrkFn(handle, uplo, transA, N, 0, alpha, nullptr, lda, one, nullptr, ldc));
+            DAPI_CHECK(hipblasSyrkFn,
+                       (handle, uplo, transA, N, 0, alpha, nullptr, lda, one, nullptr, ldc));
 
             // If alpha == 0 && beta == 1, A, C may be nullptr
-            CHECK_HIPBLAS_ERROR(
-                hipblasSyrkFn(handle, uplo, transA, N, K, zero, nullptr, lda, one, nullptr, ldc));
+            DAPI_CHECK(
+                hipblasSyrkFn, (handle, uplo, transA, N, K, zero, nullptr, lda, one, nullptr, ldc));
         }
 
         // If N == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyrkFn(
-            handle, uplo, transA, 0, K, nullptr, nullptr, lda, nullptr, nullptr, ldc));
+        DAPI_CHECK(hipblasSyrkFn,
+                   (handle, uplo, transA, 0, K, nullptr, nullptr, lda, nullptr, nullptr, ldc));
     }
 }
 
@@ -154,6 +148,8 @@ void testing_syrk(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrkFn = FORTRAN ? hipblasSyrk<T, true> : hipblasSyrk<T, false>;
+    auto hipblasSyrkFn_64
+        = arg.api == FORTRAN_64 ? hipblasSyrk_64<T, true> : hipblasSyrk_64<T, false>;
 
     hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
     hipblasOperation_t transA = char2hipblas_operation(arg.transA);
@@ -212,8 +208,8 @@ void testing_syrk(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(
-            hipblasSyrkFn(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+        DAPI_CHECK(
+            hipblasSyrkFn, (handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
@@ -221,8 +217,7 @@ void testing_syrk(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(
-            hipblasSyrkFn(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+        DAPI_CHECK(hipblasSyrkFn, (handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
 
         CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
 
@@ -258,8 +253,8 @@ void testing_syrk(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(
-                hipblasSyrkFn(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+            DAPI_CHECK(
+                hipblasSyrkFn, (handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "syrk_ex_storage.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// hipblasCsyrkStridedBatchedEx takes the HIPBLAS_V2 types only
+#ifdef HIPBLAS_V2
+
+using hipblasSyrkStridedBatchedExModel = ArgumentModel<e_a_type,
+                                                       e_c_type,
+                                                       e_uplo,
+                                                       e_transA,
+                                                       e_N,
+                                                       e_K,
+                                                       e_alpha,
+                                                       e_lda,
+                                                       e_beta,
+                                                       e_ldc,
+                                                       e_stride_scale,
+                                                       e_batch_count>;
+
+inline void testname_syrk_strided_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasSyrkStridedBatchedExModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_syrk_strided_batched_ex_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipDataType        aType       = arg.a_type;
+    hipDataType        cType       = arg.c_type;
+    int                N           = 101;
+    int                K           = 100;
+    int                lda         = 102;
+    int                ldc         = 104;
+    int                batch_count = 2;
+    hipblasOperation_t transA      = HIPBLAS_OP_N;
+    hipblasFillMode_t  uplo        = HIPBLAS_FILL_MODE_LOWER;
+
+    int64_t       cols    = transA == HIPBLAS_OP_N ? K : N;
+    hipblasStride strideA = cols * lda;
+    hipblasStride strideC = N * ldc;
+    size_t        A_bytes = strideA * batch_count * syrk_ex_type_size(aType);
+    size_t        C_size  = strideC * batch_count;
+
+    device_vector<int8_t> dA(A_bytes);
+    device_vector<T>      dC(C_size);
+
+    device_vector<T> d_alpha(1), d_zero(1), d_beta(1), d_one(1);
+    const T          h_alpha(1), h_zero(0), h_beta(2), h_one(1);
+
+    const T* alpha = &h_alpha;
+    const T* beta  = &h_beta;
+    const T* one   = &h_one;
+    const T* zero  = &h_zero;
+
+    auto syrk_ex = [&](hipblasHandle_t    h,
+                       hipblasFillMode_t  uplo_,
+                       hipblasOperation_t transA_,
+                       int                K_,
+                       const T*           alpha_,
+                       const void*        A_,
+                       hipDataType        aType_,
+                       const T*           beta_,
+                       T*                 C_,
+                       int                batch_count_) {
+        return hipblasCsyrkStridedBatchedEx(h,
+                                            uplo_,
+                                            transA_,
+                                            N,
+                                            K_,
+                                            (const hipComplex*)alpha_,
+                                            A_,
+                                            aType_,
+                                            lda,
+                                            strideA,
+                                            (const hipComplex*)beta_,
+                                            (hipComplex*)C_,
+                                            cType,
+                                            ldc,
+                                            strideC,
+                                            batch_count_);
+    };
+
+    for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
+
+        if(pointer_mode == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(d_beta, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(d_one, one, sizeof(*one), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(d_zero, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            alpha = d_alpha;
+            beta  = d_beta;
+            one   = d_one;
+            zero  = d_zero;
+        }
+
+        EXPECT_HIPBLAS_STATUS(
+            syrk_ex(nullptr, uplo, transA, K, alpha, dA, aType, beta, dC, batch_count),
+            HIPBLAS_STATUS_NOT_INITIALIZED);
+
+        EXPECT_HIPBLAS_STATUS(syrk_ex(handle,
+                                      HIPBLAS_FILL_MODE_FULL,
+                                      transA,
+                                      K,
+                                      alpha,
+                                      dA,
+                                      aType,
+                                      beta,
+                                      dC,
+                                      batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(syrk_ex(handle,
+                                      (hipblasFillMode_t)HIPBLAS_OP_N,
+                                      transA,
+                                      K,
+                                      alpha,
+                                      dA,
+                                      aType,
+                                      beta,
+                                      dC,
+                                      batch_count),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+        EXPECT_HIPBLAS_STATUS(
+            syrk_ex(handle, uplo, HIPBLAS_OP_C, K, alpha, dA, aType, beta, dC, batch_count),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(syrk_ex(handle,
+                                      uplo,
+                                      (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                      K,
+                                      alpha,
+                                      dA,
+                                      aType,
+                                      beta,
+                                      dC,
+                                      batch_count),
+                              HIPBLAS_STATUS_INVALID_ENUM);
+
+        // the narrower types of A accumulate in single precision complex only
+        EXPECT_HIPBLAS_STATUS(
+            syrk_ex(handle, uplo, transA, K, alpha, dA, HIP_R_8I, beta, dC, batch_count),
+            HIPBLAS_STATUS_NOT_SUPPORTED);
+
+        if(arg.bad_arg_all)
+        {
+            EXPECT_HIPBLAS_STATUS(
+                syrk_ex(handle, uplo, transA, K, nullptr, dA, aType, beta, dC, batch_count),
+                HIPBLAS_STATUS_INVALID_VALUE);
+            EXPECT_HIPBLAS_STATUS(
+                syrk_ex(handle, uplo, transA, K, alpha, dA, aType, nullptr, dC, batch_count),
+                HIPBLAS_STATUS_INVALID_VALUE);
+
+            if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
+            {
+                EXPECT_HIPBLAS_STATUS(
+                    syrk_ex(handle, uplo, transA, K, alpha, nullptr, aType, beta, dC, batch_count),
+                    HIPBLAS_STATUS_INVALID_VALUE);
+                EXPECT_HIPBLAS_STATUS(
+                    syrk_ex(handle, uplo, transA, K, alpha, dA, aType, beta, nullptr, batch_count),
+                    HIPBLAS_STATUS_INVALID_VALUE);
+            }
+
+            // If k == 0 && beta == 1, A, C may be nullptr
+            CHECK_HIPBLAS_ERROR(
+                syrk_ex(handle, uplo, transA, 0, alpha, nullptr, aType, one, nullptr, batch_count));
+
+            // If alpha == 0 && beta == 1, A, C may be nullptr
+            CHECK_HIPBLAS_ERROR(
+                syrk_ex(handle, uplo, transA, K, zero, nullptr, aType, one, nullptr, batch_count));
+        }
+
+        // If N == 0 batch_count == 0, can have nullptrs
+        CHECK_HIPBLAS_ERROR(hipblasCsyrkStridedBatchedEx(handle,
+                                                         uplo,
+                                                         transA,
+                                                         0,
+                                                         K,
+                                                         nullptr,
+                                                         nullptr,
+                                                         aType,
+                                                         lda,
+                                                         strideA,
+                                                         nullptr,
+                                                         nullptr,
+                                                         cType,
+                                                         ldc,
+                                                         strideC,
+                                                         batch_count));
+        CHECK_HIPBLAS_ERROR(
+            syrk_ex(handle, uplo, transA, K, nullptr, nullptr, aType, nullptr, nullptr, 0));
+    }
+}
+
+template <typename T>
+void testing_syrk_strided_batched_ex(const Arguments& arg)
+{
+    hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+    hipDataType        aType        = arg.a_type;
+    hipDataType        cType        = arg.c_type;
+    int                N            = arg.N;
+    int                K            = arg.K;
+    int                lda          = arg.lda;
+    int                ldc          = arg.ldc;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    int           K1       = (transA == HIPBLAS_OP_N ? K : N);
+    hipblasStride stride_A = size_t(lda) * K1 * stride_scale;
+    hipblasStride stride_C = size_t(ldc) * N * stride_scale;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        C_size   = stride_C * batch_count;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || K < 0 || ldc < N || (transA == HIPBLAS_OP_N && lda < N)
+       || (transA != HIPBLAS_OP_N && lda < K) || batch_count <= 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>      hA(A_size);
+    host_vector<int8_t> hA_storage(A_size * syrk_ex_type_size(aType));
+    host_vector<T>      hC_host(C_size);
+    host_vector<T>      hC_device(C_size);
+    host_vector<T>      hC_gold(C_size);
+
+    device_vector<int8_t> dA(A_size * syrk_ex_type_size(aType));
+    device_vector<T>      dC(C_size);
+    device_vector<T>      d_alpha(1);
+    device_vector<T>      d_beta(1);
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // Initial Data on CPU, A is rounded to the values stored in aType
+    hipblas_init_matrix(
+        hA, arg, N, K1, lda, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(
+        hC_host, arg, N, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    syrk_ex_store(aType, A_size, hA, hA_storage);
+
+    hC_device = hC_host;
+    hC_gold   = hC_host;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA_storage, hA_storage.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto syrk_ex = [&](const T* alpha, const T* beta) {
+        return hipblasCsyrkStridedBatchedEx(handle,
+                                            uplo,
+                                            transA,
+                                            N,
+                                            K,
+                                            (const hipComplex*)alpha,
+                                            dA,
+                                            aType,
+                                            lda,
+                                            stride_A,
+                                            (const hipComplex*)beta,
+                                            (hipComplex*)(T*)dC,
+                                            cType,
+                                            ldc,
+                                            stride_C,
+                                            batch_count);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(syrk_ex(&h_alpha, &h_beta));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(syrk_ex(d_alpha, d_beta));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            ref_syrk<T>(uplo,
+                        transA,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data() + b * stride_A,
+                        lda,
+                        h_beta,
+                        hC_gold.data() + b * stride_C,
+                        ldc);
+        }
+
+        // enable unit check, notice unit check is not invasive, but norm check is,
+        // unit check and norm check can not be interchanged their order
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+            unit_check_general<T>(N, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', N, N, ldc, stride_C, hC_gold, hC_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<T>('F', N, N, ldc, stride_C, hC_gold, hC_device, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(syrk_ex(d_alpha, d_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasSyrkStridedBatchedExModel{}.log_args<T>(std::cout,
+                                                       arg,
+                                                       gpu_time_used,
+                                                       syrk_gflop_count<T>(N, K),
+                                                       syrk_gbyte_count<T>(N, K),
+                                                       hipblas_error_host,
+                                                       hipblas_error_device);
+    }
+}
+
+#endif
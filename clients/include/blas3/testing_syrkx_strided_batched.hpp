@@ -53,6 +53,9 @@ void testing_syrkx_strided_batched_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrkxStridedBatchedFn
         = FORTRAN ? hipblasSyrkxStridedBatched<T, true> : hipblasSyrkxStridedBatched<T, false>;
+    auto hipblasSyrkxStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasSyrkxStridedBatched_64<T, true>
+                                               : hipblasSyrkxStridedBatched_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -99,252 +102,264 @@ void testing_syrkx_strided_batched_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(nullptr,
-                                                           uplo,
-                                                           transA,
-                                                           N,
-                                                           K,
-                                                           alpha,
-                                                           dA,
-                                                           lda,
-                                                           strideA,
-                                                           dB,
-                                                           ldb,
-                                                           strideB,
-                                                           beta,
-                                                           dC,
-                                                           ldc,
-                                                           strideC,
-                                                           batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(handle,
-                                                           HIPBLAS_FILL_MODE_FULL,
-                                                           transA,
-                                                           N,
-                                                           K,
-                                                           alpha,
-                                                           dA,
-                                                           lda,
-                                                           strideA,
-                                                           dB,
-                                                           ldb,
-                                                           strideB,
-                                                           beta,
-                                                           dC,
-                                                           ldc,
-                                                           strideC,
-                                                           batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(handle,
-                                                           (hipblasFillMode_t)HIPBLAS_OP_N,
-                                                           transA,
-                                                           N,
-                                                           K,
-                                                           alpha,
-                                                           dA,
-                                                           lda,
-                                                           strideA,
-                                                           dB,
-                                                           ldb,
-                                                           strideB,
-                                                           beta,
-                                                           dC,
-                                                           ldc,
-                                                           strideC,
-                                                           batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasSyrkxStridedBatchedFn(handle,
-                                         uplo,
-                                         (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                         N,
-                                         K,
-                                         alpha,
-                                         dA,
-                                         lda,
-                                         strideA,
-                                         dB,
-                                         ldb,
-                                         strideB,
-                                         beta,
-                                         dC,
-                                         ldc,
-                                         strideC,
-                                         batch_count),
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasSyrkxStridedBatchedFn,
+                    (nullptr,
+                     uplo,
+                     transA,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     beta,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasSyrkxStridedBatchedFn,
+                    (handle,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     beta,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSyrkxStridedBatchedFn,
+                    (handle,
+                     (hipblasFillMode_t)HIPBLAS_OP_N,
+                     transA,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     beta,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasSyrkxStridedBatchedFn,
+                    (handle,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     N,
+                     K,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     beta,
+                     dC,
+                     ldc,
+                     strideC,
+                     batch_count));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(handle,
-                                                               uplo,
-                                                               transA,
-                                                               N,
-                                                               K,
-                                                               nullptr,
-                                                               dA,
-                                                               lda,
-                                                               strideA,
-                                                               dB,
-                                                               ldb,
-                                                               strideB,
-                                                               beta,
-                                                               dC,
-                                                               ldc,
-                                                               strideC,
-                                                               batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(handle,
-                                                               uplo,
-                                                               transA,
-                                                               N,
-                                                               K,
-                                                               alpha,
-                                                               dA,
-                                                               lda,
-                                                               strideA,
-                                                               dB,
-                                                               ldb,
-                                                               strideB,
-                                                               nullptr,
-                                                               dC,
-                                                               ldc,
-                                                               strideC,
-                                                               batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyrkxStridedBatchedFn,
+                        (handle,
+                         uplo,
+                         transA,
+                         N,
+                         K,
+                         nullptr,
+                         dA,
+                         lda,
+                         strideA,
+                         dB,
+                         ldb,
+                         strideB,
+                         beta,
+                         dC,
+                         ldc,
+                         strideC,
+                         batch_count));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasSyrkxStridedBatchedFn,
+                        (handle,
+                         uplo,
+                         transA,
+                         N,
+                         K,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         dB,
+                         ldb,
+                         strideB,
+                         nullptr,
+                         dC,
+                         ldc,
+                         strideC,
+                         batch_count));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(handle,
-                                                                   uplo,
-                                                                   transA,
-                                                                   N,
-                                                                   K,
-                                                                   alpha,
-                                                                   nullptr,
-                                                                   lda,
-                                                                   strideA,
-                                                                   dB,
-                                                                   ldb,
-                                                                   strideB,
-                                                                   beta,
-                                                                   dC,
-                                                                   ldc,
-                                                                   strideC,
-                                                                   batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(handle,
-                                                                   uplo,
-                                                                   transA,
-                                                                   N,
-                                                                   K,
-                                                                   alpha,
-                                                                   dA,
-                                                                   lda,
-                                                                   strideA,
-                                                                   nullptr,
-                                                                   ldb,
-                                                                   strideB,
-                                                                   beta,
-                                                                   dC,
-                                                                   ldc,
-                                                                   strideC,
-                                                                   batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasSyrkxStridedBatchedFn(handle,
-                                                                   uplo,
-                                                                   transA,
-                                                                   N,
-                                                                   K,
-                                                                   alpha,
-                                                                   dA,
-                                                                   lda,
-                                                                   strideA,
-                                                                   dB,
-                                                                   ldb,
-                                                                   strideB,
-                                                                   beta,
-                                                                   nullptr,
-                                                                   ldc,
-                                                                   strideC,
-                                                                   batch_count),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSyrkxStridedBatchedFn,
+                            (handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             alpha,
+                             nullptr,
+                             lda,
+                             strideA,
+                             dB,
+                             ldb,
+                             strideB,
+                             beta,
+                             dC,
+                             ldc,
+                             strideC,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSyrkxStridedBatchedFn,
+                            (handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             alpha,
+                             dA,
+                             lda,
+                             strideA,
+                             nullptr,
+                             ldb,
+                             strideB,
+                             beta,
+                             dC,
+                             ldc,
+                             strideC,
+                             batch_count));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasSyrkxStridedBatchedFn,
+                            (handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             alpha,
+                             dA,
+                             lda,
+                             strideA,
+                             dB,
+                             ldb,
+                             strideB,
+                             beta,
+                             nullptr,
+                             ldc,
+                             strideC,
+                             batch_count));
             }
 
             // If k == 0 && beta == 1, A, B, C may be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                             uplo,
-                                                             transA,
-                                                             N,
-                                                             0,
-                                                             alpha,
-                                                             nullptr,
-                                                             lda,
-                                                             strideA,
-                                                             nullptr,
-                                                             ldb,
-                                                             strideB,
-                                                             one,
-                                                             nullptr,
-                                                             ldc,
-                                                             strideC,
-                                                             batch_count));
+            DAPI_CHECK(hipblasSyrkxStridedBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        N,
+                        0,
+                        alpha,
+                        nullptr,
+                        lda,
+                        strideA,
+                        nullptr,
+                        ldb,
+                        strideB,
+                        one,
+                        nullptr,
+                        ldc,
+                        strideC,
+                        batch_count));
 
             // If alpha == 0 && beta == 1, A, B, C may be nullptr
-            CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                             uplo,
-                                                             transA,
-                                                             N,
-                                                             K,
-                                                             zero,
-                                                             nullptr,
-                                                             lda,
-                                                             strideA,
-                                                             nullptr,
-                                                             ldb,
-                                                             strideB,
-                                                             one,
-                                                             nullptr,
-                                                             ldc,
-                                                             strideC,
-                                                             batch_count));
+            DAPI_CHECK(hipblasSyrkxStridedBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        N,
+                        K,
+                        zero,
+                        nullptr,
+                        lda,
+                        strideA,
+                        nullptr,
+                        ldb,
+                        strideB,
+                        one,
+                        nullptr,
+                        ldc,
+                        strideC,
+                        batch_count));
         }
 
         // If N == 0 || batch_count, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                         uplo,
-                                                         transA,
-                                                         0,
-                                                         K,
-                                                         nullptr,
-                                                         nullptr,
-                                                         lda,
-                                                         strideA,
-                                                         nullptr,
-                                                         ldb,
-                                                         strideB,
-                                                         nullptr,
-                                                         nullptr,
-                                                         ldc,
-                                                         strideC,
-                                                         batch_count));
-        CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                         uplo,
-                                                         transA,
-                                                         0,
-                                                         K,
-                                                         nullptr,
-                                                         nullptr,
-                                                         lda,
-                                                         strideA,
-                                                         nullptr,
-                                                         ldb,
-                                                         strideB,
-                                                         nullptr,
-                                                         nullptr,
-                                                         ldc,
-                                                         strideC,
-                                                         0));
+        DAPI_CHECK(hipblasSyrkxStridedBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    ldb,
+                    strideB,
+                    nullptr,
+                    nullptr,
+                    ldc,
+                    strideC,
+                    batch_count));
+        DAPI_CHECK(hipblasSyrkxStridedBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    0,
+                    K,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    ldb,
+                    strideB,
+                    nullptr,
+                    nullptr,
+                    ldc,
+                    strideC,
+                    0));
     }
 }
 
@@ -354,6 +369,9 @@ void testing_syrkx_strided_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasSyrkxStridedBatchedFn
         = FORTRAN ? hipblasSyrkxStridedBatched<T, true> : hipblasSyrkxStridedBatched<T, false>;
+    auto hipblasSyrkxStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasSyrkxStridedBatched_64<T, true>
+                                               : hipblasSyrkxStridedBatched_64<T, false>;
 
     hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
     hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
@@ -425,46 +443,48 @@ void testing_syrkx_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                         uplo,
-                                                         transA,
-                                                         N,
-                                                         K,
-                                                         &h_alpha,
-                                                         dA,
-                                                         lda,
-                                                         stride_A,
-                                                         dB,
-                                                         ldb,
-                                                         stride_B,
-                                                         &h_beta,
-                                                         dC,
-                                                         ldc,
-                                                         stride_C,
-                                                         batch_count));
+        DAPI_CHECK(hipblasSyrkxStridedBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    N,
+                    K,
+                    &h_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    &h_beta,
+                    dC,
+                    ldc,
+                    stride_C,
+                    batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyDeviceToHost));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                         uplo,
-                                                         transA,
-                                                         N,
-                                                         K,
-                                                         d_alpha,
-                                                         dA,
-                                                         lda,
-                                                         stride_A,
-                                                         dB,
-                                                         ldb,
-                                                         stride_B,
-                                                         d_beta,
-                                                         dC,
-                                                         ldc,
-                                                         stride_C,
-                                                         batch_count));
+        DAPI_CHECK(hipblasSyrkxStridedBatchedFn,
+                   (handle,
+                    uplo,
+                    transA,
+                    N,
+                    K,
+                    d_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    d_beta,
+                    dC,
+                    ldc,
+                    stride_C,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
 
@@ -516,23 +536,24 @@ void testing_syrkx_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                             uplo,
-                                                             transA,
-                                                             N,
-                                                             K,
-                                                             d_alpha,
-                                                             dA,
-                                                             lda,
-                                                             stride_A,
-                                                             dB,
-                                                             ldb,
-                                                             stride_B,
-                                                             d_beta,
-                                                             dC,
-                                                             ldc,
-                                                             stride_C,
-                                                             batch_count));
+            DAPI_CHECK(hipblasSyrkxStridedBatchedFn,
+                       (handle,
+                        uplo,
+                        transA,
+                        N,
+                        K,
+                        d_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        dB,
+                        ldb,
+                        stride_B,
+                        d_beta,
+                        dC,
+                        ldc,
+                        stride_C,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -43,6 +43,8 @@ void testing_trmm_bad_arg(const Arguments& arg)
 {
     auto hipblasTrmmFn
         = arg.api == hipblas_client_api::FORTRAN ? hipblasTrmm<T, true> : hipblasTrmm<T, false>;
+    auto hipblasTrmmFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrmm_64<T, true> : hipblasTrmm_64<T, false>;
     bool inplace = arg.inplace;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_DEVICE, HIPBLAS_POINTER_MODE_HOST})
@@ -91,217 +93,208 @@ void testing_trmm_bad_arg(const Arguments& arg)
         // cuBLAS doesn't have CUBLAS_SIDE_BOTH so will return invalid_enum,
         // while rocBLAS has rocblas_side_both, but just invalid for this func.
         // invalid enums
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                            HIPBLAS_SIDE_BOTH,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            *dOut,
-                                            ldOut),
 #ifndef __HIP_PLATFORM_NVCC__
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmFn,
+                    (handle,
+                     HIPBLAS_SIDE_BOTH,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut));
 #else
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrmmFn,
+                    (handle,
+                     HIPBLAS_SIDE_BOTH,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut));
 #endif
 
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                            side,
-                                            HIPBLAS_FILL_MODE_FULL,
-                                            transA,
-                                            diag,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            *dOut,
-                                            ldOut),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                            side,
-                                            uplo,
-                                            (hipblasOperation_t)HIPBLAS_SIDE_BOTH,
-                                            diag,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            *dOut,
-                                            ldOut),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            (hipblasDiagType_t)HIPBLAS_SIDE_BOTH,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            *dOut,
-                                            ldOut),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmFn,
+                    (handle,
+                     side,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrmmFn,
+                    (handle,
+                     side,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_SIDE_BOTH,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrmmFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_SIDE_BOTH,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut));
 
         // nullptr checks
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTrmmFn(
-                nullptr, side, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb, *dOut, ldOut),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasTrmmFn,
+            (nullptr, side, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb, *dOut, ldOut));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                                side,
-                                                uplo,
-                                                transA,
-                                                diag,
-                                                M,
-                                                N,
-                                                alpha,
-                                                dA,
-                                                lda,
-                                                dB,
-                                                ldb,
-                                                nullptr,
-                                                ldOut),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                                side,
-                                                uplo,
-                                                transA,
-                                                diag,
-                                                M,
-                                                N,
-                                                nullptr,
-                                                dA,
-                                                lda,
-                                                dB,
-                                                ldb,
-                                                *dOut,
-                                                ldOut),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                                side,
-                                                uplo,
-                                                transA,
-                                                diag,
-                                                M,
-                                                N,
-                                                alpha,
-                                                nullptr,
-                                                lda,
-                                                dB,
-                                                ldb,
-                                                *dOut,
-                                                ldOut),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                                side,
-                                                uplo,
-                                                transA,
-                                                diag,
-                                                M,
-                                                N,
-                                                alpha,
-                                                dA,
-                                                lda,
-                                                nullptr,
-                                                ldb,
-                                                *dOut,
-                                                ldOut),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasTrmmFn,
+                (handle, side, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb, nullptr, ldOut));
+
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasTrmmFn,
+                (handle, side, uplo, transA, diag, M, N, nullptr, dA, lda, dB, ldb, *dOut, ldOut));
+
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrmmFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         nullptr,
+                         lda,
+                         dB,
+                         ldb,
+                         *dOut,
+                         ldOut));
+
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrmmFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         nullptr,
+                         ldb,
+                         *dOut,
+                         ldOut));
 
             // quick return: if alpha == 0, both A & B can be nullptr
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                                side,
-                                                uplo,
-                                                transA,
-                                                diag,
-                                                M,
-                                                N,
-                                                zero,
-                                                nullptr,
-                                                lda,
-                                                nullptr,
-                                                ldb,
-                                                *dOut,
-                                                ldOut),
-                                  HIPBLAS_STATUS_SUCCESS);
+            DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                        hipblasTrmmFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         zero,
+                         nullptr,
+                         lda,
+                         nullptr,
+                         ldb,
+                         *dOut,
+                         ldOut));
         }
 
         // quick return: if M == 0, then all other ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            0,
-                                            N,
-                                            nullptr,
-                                            nullptr,
-                                            lda,
-                                            nullptr,
-                                            ldb,
-                                            nullptr,
-                                            ldOut),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     0,
+                     N,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     ldb,
+                     nullptr,
+                     ldOut));
 
         // quick return: if N == 0, then all other ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            M,
-                                            0,
-                                            nullptr,
-                                            nullptr,
-                                            lda,
-                                            nullptr,
-                                            ldb,
-                                            nullptr,
-                                            ldOut),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     0,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     ldb,
+                     nullptr,
+                     ldOut));
 
         // in-place only checks
         if(inplace)
         {
             // if inplace, must have ldb == ldc
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmFn(handle,
-                                                side,
-                                                uplo,
-                                                transA,
-                                                diag,
-                                                M,
-                                                N,
-                                                alpha,
-                                                dA,
-                                                lda,
-                                                dB,
-                                                ldb,
-                                                *dOut,
-                                                ldb + 1),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasTrmmFn,
+                (handle, side, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb, *dOut, ldb + 1));
         }
     }
 }
@@ -311,6 +304,8 @@ void testing_trmm(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrmmFn = FORTRAN ? hipblasTrmm<T, true> : hipblasTrmm<T, false>;
+    auto hipblasTrmmFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrmm_64<T, true> : hipblasTrmm_64<T, false>;
     bool inplace       = arg.inplace;
 
     hipblasSideMode_t  side   = char2hipblas_side(arg.side);
@@ -383,8 +378,9 @@ void testing_trmm(const Arguments& arg)
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        CHECK_HIPBLAS_ERROR(hipblasTrmmFn(
-            handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, *dOut, ldOut));
+        DAPI_CHECK(
+            hipblasTrmmFn,
+            (handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, *dOut, ldOut));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hOut_host, *dOut, sizeof(T) * out_size, hipMemcpyDeviceToHost));
@@ -393,8 +389,9 @@ void testing_trmm(const Arguments& arg)
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        CHECK_HIPBLAS_ERROR(hipblasTrmmFn(
-            handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, *dOut, ldOut));
+        DAPI_CHECK(
+            hipblasTrmmFn,
+            (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, *dOut, ldOut));
 
         CHECK_HIP_ERROR(hipMemcpy(hOut_device, *dOut, sizeof(T) * out_size, hipMemcpyDeviceToHost));
 
@@ -431,8 +428,9 @@ void testing_trmm(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTrmmFn(
-                handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, *dOut, ldOut));
+            DAPI_CHECK(
+                hipblasTrmmFn,
+                (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb, *dOut, ldOut));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
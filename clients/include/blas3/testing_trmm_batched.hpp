@@ -53,6 +53,8 @@ inline void testing_trmm_batched_bad_arg(const Arguments& arg)
     auto hipblasTrmmBatchedFn = arg.api == hipblas_client_api::FORTRAN
                                     ? hipblasTrmmBatched<T, true>
                                     : hipblasTrmmBatched<T, false>;
+    auto hipblasTrmmBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrmmBatched_64<T, true> : hipblasTrmmBatched_64<T, false>;
     bool inplace              = arg.inplace;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_DEVICE, HIPBLAS_POINTER_MODE_HOST})
@@ -108,252 +110,266 @@ inline void testing_trmm_batched_bad_arg(const Arguments& arg)
         auto dOut = inplace ? &dB : &dC;
 
         // invalid enums
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   HIPBLAS_SIDE_BOTH,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   HIPBLAS_FILL_MODE_FULL,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   (hipblasOperation_t)HIPBLAS_SIDE_BOTH,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   (hipblasDiagType_t)HIPBLAS_SIDE_BOTH,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     HIPBLAS_SIDE_BOTH,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_SIDE_BOTH,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_SIDE_BOTH,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
 
         // nullptr checks
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(nullptr,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   nullptr,
-                                                   dA,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   nullptr,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA,
-                                                   lda,
-                                                   dB,
-                                                   ldb,
-                                                   nullptr,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTrmmBatchedFn,
+                    (nullptr,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     nullptr,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     nullptr,
+                     lda,
+                     dB,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     nullptr,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     nullptr,
+                     ldOut,
+                     batch_count));
 
         // quick return: if alpha == 0, both A & B can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   zero,
-                                                   nullptr,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   *dOut,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     zero,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     ldb,
+                     *dOut,
+                     ldOut,
+                     batch_count));
 
         // quick return: if M == 0, then all ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   0,
-                                                   N,
-                                                   nullptr,
-                                                   nullptr,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   nullptr,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     0,
+                     N,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     ldb,
+                     nullptr,
+                     ldOut,
+                     batch_count));
 
         // quick return: if N == 0, then all ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   0,
-                                                   nullptr,
-                                                   nullptr,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   nullptr,
-                                                   ldOut,
-                                                   batch_count),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     0,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     ldb,
+                     nullptr,
+                     ldOut,
+                     batch_count));
 
         // quick return: if batch_count == 0, then all ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   nullptr,
-                                                   nullptr,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   nullptr,
-                                                   ldOut,
-                                                   0),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     ldb,
+                     nullptr,
+                     ldOut,
+                     0));
 
         // in-place only checks
         if(inplace)
         {
             // if inplace, must have ldb == ldc
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmBatchedFn(handle,
-                                                       side,
-                                                       uplo,
-                                                       transA,
-                                                       diag,
-                                                       M,
-                                                       N,
-                                                       alpha,
-                                                       dA,
-                                                       lda,
-                                                       dB,
-                                                       ldb,
-                                                       *dOut,
-                                                       ldb + 1,
-                                                       batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrmmBatchedFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         dB,
+                         ldb,
+                         *dOut,
+                         ldb + 1,
+                         batch_count));
         }
     }
 }
@@ -364,6 +380,8 @@ void testing_trmm_batched(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrmmBatchedFn
         = FORTRAN ? hipblasTrmmBatched<T, true> : hipblasTrmmBatched<T, false>;
+    auto hipblasTrmmBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrmmBatched_64<T, true> : hipblasTrmmBatched_64<T, false>;
     bool inplace = arg.inplace;
 
     hipblasSideMode_t  side        = char2hipblas_side(arg.side);
@@ -444,42 +462,44 @@ void testing_trmm_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasTrmmBatchedFn(handle,
-                                                 side,
-                                                 uplo,
-                                                 transA,
-                                                 diag,
-                                                 M,
-                                                 N,
-                                                 &h_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dB.ptr_on_device(),
-                                                 ldb,
-                                                 (*dOut).ptr_on_device(),
-                                                 ldOut,
-                                                 batch_count));
+        DAPI_CHECK(hipblasTrmmBatchedFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    &h_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    (*dOut).ptr_on_device(),
+                    ldOut,
+                    batch_count));
 
         CHECK_HIP_ERROR(hOut_host.transfer_from(*dOut));
         CHECK_HIP_ERROR(dB.transfer_from(hB));
         CHECK_HIP_ERROR(dC.transfer_from(hC));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasTrmmBatchedFn(handle,
-                                                 side,
-                                                 uplo,
-                                                 transA,
-                                                 diag,
-                                                 M,
-                                                 N,
-                                                 d_alpha,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dB.ptr_on_device(),
-                                                 ldb,
-                                                 (*dOut).ptr_on_device(),
-                                                 ldOut,
-                                                 batch_count));
+        DAPI_CHECK(hipblasTrmmBatchedFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    d_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    (*dOut).ptr_on_device(),
+                    ldOut,
+                    batch_count));
 
         CHECK_HIP_ERROR(hOut_device.transfer_from(*dOut));
 
@@ -521,21 +541,22 @@ void testing_trmm_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTrmmBatchedFn(handle,
-                                                     side,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     N,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     (*dOut).ptr_on_device(),
-                                                     ldOut,
-                                                     batch_count));
+            DAPI_CHECK(hipblasTrmmBatchedFn,
+                       (handle,
+                        side,
+                        uplo,
+                        transA,
+                        diag,
+                        M,
+                        N,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        dB.ptr_on_device(),
+                        ldb,
+                        (*dOut).ptr_on_device(),
+                        ldOut,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
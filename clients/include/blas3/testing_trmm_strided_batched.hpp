@@ -54,6 +54,9 @@ void testing_trmm_strided_batched_bad_arg(const Arguments& arg)
     auto hipblasTrmmStridedBatchedFn = arg.api == hipblas_client_api::FORTRAN
                                            ? hipblasTrmmStridedBatched<T, true>
                                            : hipblasTrmmStridedBatched<T, false>;
+    auto hipblasTrmmStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasTrmmStridedBatched_64<T, true>
+                                              : hipblasTrmmStridedBatched_64<T, false>;
     bool inplace                     = arg.inplace;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_DEVICE, HIPBLAS_POINTER_MODE_HOST})
@@ -105,294 +108,308 @@ void testing_trmm_strided_batched_bad_arg(const Arguments& arg)
         hipblasStride     strideOut = inplace ? strideB : strideC;
 
         // invalid enums
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          HIPBLAS_SIDE_BOTH,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          HIPBLAS_FILL_MODE_FULL,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          strideA,
-                                                          lda,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          (hipblasOperation_t)HIPBLAS_SIDE_BOTH,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          (hipblasDiagType_t)HIPBLAS_SIDE_BOTH,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     HIPBLAS_SIDE_BOTH,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     strideA,
+                     lda,
+                     dB,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_SIDE_BOTH,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_SIDE_BOTH,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
 
         // nullptr checks
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(nullptr,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          nullptr,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          nullptr,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTrmmStridedBatchedFn,
+                    (nullptr,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     nullptr,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     nullptr,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     nullptr,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     nullptr,
+                     ldOut,
+                     strideOut,
+                     batch_count));
 
         // quick return: if alpha == 0, both A & B can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          zero,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          *dOut,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     zero,
+                     nullptr,
+                     lda,
+                     strideA,
+                     nullptr,
+                     ldb,
+                     strideB,
+                     *dOut,
+                     ldOut,
+                     strideOut,
+                     batch_count));
 
         // quick return: if M == 0, then all ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          0,
-                                                          N,
-                                                          nullptr,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          nullptr,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     0,
+                     N,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     strideA,
+                     nullptr,
+                     ldb,
+                     strideB,
+                     nullptr,
+                     ldOut,
+                     strideOut,
+                     batch_count));
 
         // quick return: if N == 0, then all ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          0,
-                                                          nullptr,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          nullptr,
-                                                          ldOut,
-                                                          strideOut,
-                                                          batch_count),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     0,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     strideA,
+                     nullptr,
+                     ldb,
+                     strideB,
+                     nullptr,
+                     ldOut,
+                     strideOut,
+                     batch_count));
 
         // quick return: if batch_count == 0, then all ptrs can be nullptr
-        EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          nullptr,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          nullptr,
-                                                          ldOut,
-                                                          strideOut,
-                                                          0),
-                              HIPBLAS_STATUS_SUCCESS);
+        DAPI_EXPECT(HIPBLAS_STATUS_SUCCESS,
+                    hipblasTrmmStridedBatchedFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     nullptr,
+                     nullptr,
+                     lda,
+                     strideA,
+                     nullptr,
+                     ldb,
+                     strideB,
+                     nullptr,
+                     ldOut,
+                     strideOut,
+                     0));
 
         // in-place only checks
         if(inplace)
         {
             // if inplace, must have ldb == ldc
-            EXPECT_HIPBLAS_STATUS(hipblasTrmmStridedBatchedFn(handle,
-                                                              side,
-                                                              uplo,
-                                                              transA,
-                                                              diag,
-                                                              M,
-                                                              N,
-                                                              alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              *dOut,
-                                                              ldb + 1,
-                                                              strideOut,
-                                                              batch_count),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrmmStridedBatchedFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         dB,
+                         ldb,
+                         strideB,
+                         *dOut,
+                         ldb + 1,
+                         strideOut,
+                         batch_count));
         }
     }
 }
@@ -403,6 +420,9 @@ void testing_trmm_strided_batched(const Arguments& arg)
     auto hipblasTrmmStridedBatchedFn = arg.api == hipblas_client_api::FORTRAN
                                            ? hipblasTrmmStridedBatched<T, true>
                                            : hipblasTrmmStridedBatched<T, false>;
+    auto hipblasTrmmStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasTrmmStridedBatched_64<T, true>
+                                              : hipblasTrmmStridedBatched_64<T, false>;
     bool inplace                     = arg.inplace;
 
     hipblasSideMode_t  side         = char2hipblas_side(arg.side);
@@ -485,48 +505,50 @@ void testing_trmm_strided_batched(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasTrmmStridedBatchedFn(handle,
-                                                        side,
-                                                        uplo,
-                                                        transA,
-                                                        diag,
-                                                        M,
-                                                        N,
-                                                        &h_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dB,
-                                                        ldb,
-                                                        stride_B,
-                                                        *dOut,
-                                                        ldOut,
-                                                        stride_out,
-                                                        batch_count));
+        DAPI_CHECK(hipblasTrmmStridedBatchedFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    &h_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    *dOut,
+                    ldOut,
+                    stride_out,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hOut_host, *dOut, sizeof(T) * out_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasTrmmStridedBatchedFn(handle,
-                                                        side,
-                                                        uplo,
-                                                        transA,
-                                                        diag,
-                                                        M,
-                                                        N,
-                                                        d_alpha,
-                                                        dA,
-                                                        lda,
-                                                        stride_A,
-                                                        dB,
-                                                        ldb,
-                                                        stride_B,
-                                                        *dOut,
-                                                        ldOut,
-                                                        stride_out,
-                                                        batch_count));
+        DAPI_CHECK(hipblasTrmmStridedBatchedFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    d_alpha,
+                    dA,
+                    lda,
+                    stride_A,
+                    dB,
+                    ldb,
+                    stride_B,
+                    *dOut,
+                    ldOut,
+                    stride_out,
+                    batch_count));
 
         CHECK_HIP_ERROR(hipMemcpy(hOut_device, *dOut, sizeof(T) * out_size, hipMemcpyDeviceToHost));
 
@@ -579,24 +601,25 @@ void testing_trmm_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTrmmStridedBatchedFn(handle,
-                                                            side,
-                                                            uplo,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            N,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dB,
-                                                            ldb,
-                                                            stride_B,
-                                                            *dOut,
-                                                            ldOut,
-                                                            stride_out,
-                                                            batch_count));
+            DAPI_CHECK(hipblasTrmmStridedBatchedFn,
+                       (handle,
+                        side,
+                        uplo,
+                        transA,
+                        diag,
+                        M,
+                        N,
+                        d_alpha,
+                        dA,
+                        lda,
+                        stride_A,
+                        dB,
+                        ldb,
+                        stride_B,
+                        *dOut,
+                        ldOut,
+                        stride_out,
+                        batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
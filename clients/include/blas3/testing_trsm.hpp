@@ -43,6 +43,8 @@ void testing_trsm_bad_arg(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrsmFn = FORTRAN ? hipblasTrsm<T, true> : hipblasTrsm<T, false>;
+    auto hipblasTrsmFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrsm_64<T, true> : hipblasTrsm_64<T, false>;
 
     hipblasLocalHandle handle(arg);
 
@@ -78,77 +80,78 @@ void testing_trsm_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTrsmFn(nullptr, side, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTrsmFn,
+                    (nullptr, side, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb));
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTrsmFn(
-                handle, HIPBLAS_SIDE_BOTH, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb),
 #ifdef __HIP_PLATFORM_NVCC__
-            HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmFn,
+                    (handle, HIPBLAS_SIDE_BOTH, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb));
 #else
-            HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmFn,
+                    (handle, HIPBLAS_SIDE_BOTH, uplo, transA, diag, M, N, alpha, dA, lda, dB, ldb));
 #endif
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTrsmFn(
-                handle, side, HIPBLAS_FILL_MODE_FULL, transA, diag, M, N, alpha, dA, lda, dB, ldb),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmFn(handle,
-                                            side,
-                                            uplo,
-                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                            diag,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb),
-                              HIPBLAS_STATUS_INVALID_ENUM);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasTrsmFn,
+            (handle, side, HIPBLAS_FILL_MODE_FULL, transA, diag, M, N, alpha, dA, lda, dB, ldb));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmFn,
+                    (handle,
+                     side,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasTrsmFn(handle, side, uplo, transA, diag, M, N, nullptr, dA, lda, dB, ldb),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrsmFn,
+                        (handle, side, uplo, transA, diag, M, N, nullptr, dA, lda, dB, ldb));
 
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasTrsmFn(
-                        handle, side, uplo, transA, diag, M, N, alpha, nullptr, lda, dB, ldb),
-                    HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(
-                    hipblasTrsmFn(
-                        handle, side, uplo, transA, diag, M, N, alpha, dA, lda, nullptr, ldb),
-                    HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasTrsmFn,
+                            (handle, side, uplo, transA, diag, M, N, alpha, nullptr, lda, dB, ldb));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasTrsmFn,
+                            (handle, side, uplo, transA, diag, M, N, alpha, dA, lda, nullptr, ldb));
             }
 
             // If alpha == 0, then A can be nullptr
-            CHECK_HIPBLAS_ERROR(
-                hipblasTrsmFn(handle, side, uplo, transA, diag, M, N, zero, nullptr, lda, dB, ldb));
+            DAPI_CHECK(hipblasTrsmFn,
+                       (handle, side, uplo, transA, diag, M, N, zero, nullptr, lda, dB, ldb));
         }
 
         // If M == 0 || N == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTrsmFn(
-            handle, side, uplo, transA, diag, 0, N, nullptr, nullptr, lda, nullptr, ldb));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmFn(
-            handle, side, uplo, transA, diag, M, 0, nullptr, nullptr, lda, nullptr, ldb));
+        DAPI_CHECK(hipblasTrsmFn,
+                   (handle, side, uplo, transA, diag, 0, N, nullptr, nullptr, lda, nullptr, ldb));
+        DAPI_CHECK(hipblasTrsmFn,
+                   (handle, side, uplo, transA, diag, M, 0, nullptr, nullptr, lda, nullptr, ldb));
     }
 }
 
@@ -157,6 +160,8 @@ void testing_trsm(const Arguments& arg)
 {
     bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrsmFn = FORTRAN ? hipblasTrsm<T, true> : hipblasTrsm<T, false>;
+    auto hipblasTrsmFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrsm_64<T, true> : hipblasTrsm_64<T, false>;
 
     hipblasSideMode_t  side   = char2hipblas_side(arg.side);
     hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
@@ -227,15 +232,15 @@ void testing_trsm(const Arguments& arg)
     if(arg.unit_check || arg.norm_check)
     {
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(
-            hipblasTrsmFn(handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb));
+        DAPI_CHECK(
+            hipblasTrsmFn, (handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb));
 
         CHECK_HIP_ERROR(hipMemcpy(hB_host, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dB, hB_device, sizeof(T) * B_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(
-            hipblasTrsmFn(handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
+        DAPI_CHECK(
+            hipblasTrsmFn, (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
 
         CHECK_HIP_ERROR(hipMemcpy(hB_device, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
 
@@ -271,8 +276,8 @@ void testing_trsm(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(
-                hipblasTrsmFn(handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
+            DAPI_CHECK(
+                hipblasTrsmFn, (handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
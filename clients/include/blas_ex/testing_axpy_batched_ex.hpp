@@ -49,6 +49,8 @@ void testing_axpy_batched_ex_bad_arg(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasAxpyBatchedExFn = FORTRAN ? hipblasAxpyBatchedExFortran : hipblasAxpyBatchedEx;
+    auto hipblasAxpyBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasAxpyBatchedEx_64Fortran : hipblasAxpyBatchedEx_64;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -81,105 +83,112 @@ void testing_axpy_batched_ex_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasAxpyBatchedExFn(nullptr,
-                                                     N,
-                                                     alpha,
-                                                     alphaType,
-                                                     dx,
-                                                     xType,
-                                                     incx,
-                                                     dy,
-                                                     yType,
-                                                     incy,
-                                                     batch_count,
-                                                     executionType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasAxpyBatchedExFn,
+                    (nullptr,
+                     N,
+                     alpha,
+                     alphaType,
+                     dx,
+                     xType,
+                     incx,
+                     dy,
+                     yType,
+                     incy,
+                     batch_count,
+                     executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasAxpyBatchedExFn(handle,
-                                                         N,
-                                                         nullptr,
-                                                         alphaType,
-                                                         dx,
-                                                         xType,
-                                                         incx,
-                                                         dy,
-                                                         yType,
-                                                         incy,
-                                                         batch_count,
-                                                         executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasAxpyBatchedExFn,
+                        (handle,
+                         N,
+                         nullptr,
+                         alphaType,
+                         dx,
+                         xType,
+                         incx,
+                         dy,
+                         yType,
+                         incy,
+                         batch_count,
+                         executionType));
 
             // Can only check for nullptr for dx/dy with host mode because
             // device mode may not check as it could be quick-return success
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(hipblasAxpyBatchedExFn(handle,
-                                                             N,
-                                                             alpha,
-                                                             alphaType,
-                                                             nullptr,
-                                                             xType,
-                                                             incx,
-                                                             dy,
-                                                             yType,
-                                                             incy,
-                                                             batch_count,
-                                                             executionType),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasAxpyBatchedExFn(handle,
-                                                             N,
-                                                             alpha,
-                                                             alphaType,
-                                                             dx,
-                                                             xType,
-                                                             incx,
-                                                             nullptr,
-                                                             yType,
-                                                             incy,
-                                                             batch_count,
-                                                             executionType),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasAxpyBatchedExFn,
+                            (handle,
+                             N,
+                             alpha,
+                             alphaType,
+                             nullptr,
+                             xType,
+                             incx,
+                             dy,
+                             yType,
+                             incy,
+                             batch_count,
+                             executionType));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasAxpyBatchedExFn,
+                            (handle,
+                             N,
+                             alpha,
+                             alphaType,
+                             dx,
+                             xType,
+                             incx,
+                             nullptr,
+                             yType,
+                             incy,
+                             batch_count,
+                             executionType));
             }
         }
 
-        CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
-                                                   0,
-                                                   nullptr,
-                                                   alphaType,
-                                                   nullptr,
-                                                   xType,
-                                                   incx,
-                                                   nullptr,
-                                                   yType,
-                                                   incy,
-                                                   batch_count,
-                                                   executionType));
-        CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
-                                                   N,
-                                                   zero,
-                                                   alphaType,
-                                                   nullptr,
-                                                   xType,
-                                                   incx,
-                                                   nullptr,
-                                                   yType,
-                                                   incy,
-                                                   batch_count,
-                                                   executionType));
-        CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
-                                                   N,
-                                                   nullptr,
-                                                   alphaType,
-                                                   nullptr,
-                                                   xType,
-                                                   incx,
-                                                   nullptr,
-                                                   yType,
-                                                   incy,
-                                                   0,
-                                                   executionType));
+        DAPI_CHECK(hipblasAxpyBatchedExFn,
+                   (handle,
+                    0,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    batch_count,
+                    executionType));
+        DAPI_CHECK(hipblasAxpyBatchedExFn,
+                   (handle,
+                    N,
+                    zero,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    batch_count,
+                    executionType));
+        DAPI_CHECK(hipblasAxpyBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    0,
+                    executionType));
     }
 }
 
@@ -188,6 +197,8 @@ void testing_axpy_batched_ex(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasAxpyBatchedExFn = FORTRAN ? hipblasAxpyBatchedExFortran : hipblasAxpyBatchedEx;
+    auto hipblasAxpyBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasAxpyBatchedEx_64Fortran : hipblasAxpyBatchedEx_64;
 
     int N           = arg.N;
     int incx        = arg.incx;
@@ -205,18 +216,19 @@ void testing_axpy_batched_ex(const Arguments& arg)
     // memory
     if(N <= 0 || batch_count <= 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
-                                                   N,
-                                                   nullptr,
-                                                   alphaType,
-                                                   nullptr,
-                                                   xType,
-                                                   incx,
-                                                   nullptr,
-                                                   yType,
-                                                   incy,
-                                                   batch_count,
-                                                   executionType));
+        DAPI_CHECK(hipblasAxpyBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    batch_count,
+                    executionType));
         return;
     }
 
@@ -255,35 +267,37 @@ void testing_axpy_batched_ex(const Arguments& arg)
          HIPBLAS
     =================================================================== */
     CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-    CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
-                                               N,
-                                               &h_alpha,
-                                               alphaType,
-                                               dx.ptr_on_device(),
-                                               xType,
-                                               incx,
-                                               dy.ptr_on_device(),
-                                               yType,
-                                               incy,
-                                               batch_count,
-                                               executionType));
+    DAPI_CHECK(hipblasAxpyBatchedExFn,
+               (handle,
+                N,
+                &h_alpha,
+                alphaType,
+                dx.ptr_on_device(),
+                xType,
+                incx,
+                dy.ptr_on_device(),
+                yType,
+                incy,
+                batch_count,
+                executionType));
 
     CHECK_HIP_ERROR(hy_host.transfer_from(dy));
     CHECK_HIP_ERROR(dy.transfer_from(hy_device));
 
     CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-    CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
-                                               N,
-                                               d_alpha,
-                                               alphaType,
-                                               dx.ptr_on_device(),
-                                               xType,
-                                               incx,
-                                               dy.ptr_on_device(),
-                                               yType,
-                                               incy,
-                                               batch_count,
-                                               executionType));
+    DAPI_CHECK(hipblasAxpyBatchedExFn,
+               (handle,
+                N,
+                d_alpha,
+                alphaType,
+                dx.ptr_on_device(),
+                xType,
+                incx,
+                dy.ptr_on_device(),
+                yType,
+                incy,
+                batch_count,
+                executionType));
 
     CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
@@ -326,18 +340,19 @@ void testing_axpy_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
-                                                       N,
-                                                       d_alpha,
-                                                       alphaType,
-                                                       dx.ptr_on_device(),
-                                                       xType,
-                                                       incx,
-                                                       dy.ptr_on_device(),
-                                                       yType,
-                                                       incy,
-                                                       batch_count,
-                                                       executionType));
+            DAPI_CHECK(hipblasAxpyBatchedExFn,
+                       (handle,
+                        N,
+                        d_alpha,
+                        alphaType,
+                        dx.ptr_on_device(),
+                        xType,
+                        incx,
+                        dy.ptr_on_device(),
+                        yType,
+                        incy,
+                        batch_count,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -40,8 +40,9 @@ inline void testname_axpy_ex(const Arguments& arg, std::string& name)
 template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
 void testing_axpy_ex_bad_arg(const Arguments& arg)
 {
-    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasAxpyExFn = FORTRAN ? hipblasAxpyExFortran : hipblasAxpyEx;
+    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasAxpyExFn    = FORTRAN ? hipblasAxpyExFortran : hipblasAxpyEx;
+    auto hipblasAxpyExFn_64 = arg.api == FORTRAN_64 ? hipblasAxpyEx_64Fortran : hipblasAxpyEx_64;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -73,70 +74,84 @@ void testing_axpy_ex_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(
-            hipblasAxpyExFn(
-                nullptr, N, alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasAxpyExFn,
+            (nullptr, N, alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasAxpyExFn(
-                    handle, N, nullptr, alphaType, dx, xType, incx, dy, yType, incy, executionType),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasAxpyExFn,
+                (handle, N, nullptr, alphaType, dx, xType, incx, dy, yType, incy, executionType));
 
             // Can only check for nullptr for dx/dy with host mode because
             // device mode may not check as it could be quick-return success
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(hipblasAxpyExFn(handle,
-                                                      N,
-                                                      alpha,
-                                                      alphaType,
-                                                      nullptr,
-                                                      xType,
-                                                      incx,
-                                                      dy,
-                                                      yType,
-                                                      incy,
-                                                      executionType),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasAxpyExFn(handle,
-                                                      N,
-                                                      alpha,
-                                                      alphaType,
-                                                      dx,
-                                                      xType,
-                                                      incx,
-                                                      nullptr,
-                                                      yType,
-                                                      incy,
-                                                      executionType),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasAxpyExFn,
+                            (handle,
+                             N,
+                             alpha,
+                             alphaType,
+                             nullptr,
+                             xType,
+                             incx,
+                             dy,
+                             yType,
+                             incy,
+                             executionType));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasAxpyExFn,
+                            (handle,
+                             N,
+                             alpha,
+                             alphaType,
+                             dx,
+                             xType,
+                             incx,
+                             nullptr,
+                             yType,
+                             incy,
+                             executionType));
             }
         }
 
-        CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(handle,
-                                            0,
-                                            nullptr,
-                                            alphaType,
-                                            nullptr,
-                                            xType,
-                                            incx,
-                                            nullptr,
-                                            yType,
-                                            incy,
-                                            executionType));
-        CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(
-            handle, N, zero, alphaType, nullptr, xType, incx, nullptr, yType, incy, executionType));
+        DAPI_CHECK(hipblasAxpyExFn,
+                   (handle,
+                    0,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    executionType));
+        DAPI_CHECK(hipblasAxpyExFn,
+                   (handle,
+                    N,
+                    zero,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    executionType));
     }
 }
 
 template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
 void testing_axpy_ex(const Arguments& arg)
 {
-    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasAxpyExFn = FORTRAN ? hipblasAxpyExFortran : hipblasAxpyEx;
+    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasAxpyExFn    = FORTRAN ? hipblasAxpyExFortran : hipblasAxpyEx;
+    auto hipblasAxpyExFn_64 = arg.api == FORTRAN_64 ? hipblasAxpyEx_64Fortran : hipblasAxpyEx_64;
 
     int N    = arg.N;
     int incx = arg.incx;
@@ -153,17 +168,18 @@ void testing_axpy_ex(const Arguments& arg)
     // memory
     if(N <= 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(handle,
-                                            N,
-                                            nullptr,
-                                            alphaType,
-                                            nullptr,
-                                            xType,
-                                            incx,
-                                            nullptr,
-                                            yType,
-                                            incy,
-                                            executionType));
+        DAPI_CHECK(hipblasAxpyExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    executionType));
         return;
     }
 
@@ -208,16 +224,16 @@ void testing_axpy_ex(const Arguments& arg)
          HIPBLAS
     =================================================================== */
     CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-    CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(
-        handle, N, &h_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
+    DAPI_CHECK(hipblasAxpyExFn,
+               (handle, N, &h_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
 
     // copy output from device to CPU
     CHECK_HIP_ERROR(hipMemcpy(hy_host, dy, sizeof(Ty) * sizeY, hipMemcpyDeviceToHost));
     CHECK_HIP_ERROR(hipMemcpy(dy, hy_device, sizeof(Ty) * sizeY, hipMemcpyHostToDevice));
 
     CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-    CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(
-        handle, N, d_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
+    DAPI_CHECK(hipblasAxpyExFn,
+               (handle, N, d_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
     CHECK_HIP_ERROR(hipMemcpy(hy_device, dy, sizeof(Ty) * sizeY, hipMemcpyDeviceToHost));
 
     if(arg.unit_check || arg.norm_check)
@@ -254,8 +270,9 @@ void testing_axpy_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(
-                handle, N, d_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
+            DAPI_CHECK(
+                hipblasAxpyExFn,
+                (handle, N, d_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
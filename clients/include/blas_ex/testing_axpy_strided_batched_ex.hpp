@@ -51,6 +51,9 @@ void testing_axpy_strided_batched_ex_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasAxpyStridedBatchedExFn
         = FORTRAN ? hipblasAxpyStridedBatchedExFortran : hipblasAxpyStridedBatchedEx;
+    auto hipblasAxpyStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                                ? hipblasAxpyStridedBatchedEx_64Fortran
+                                                : hipblasAxpyStridedBatchedEx_64;
 
     for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
     {
@@ -86,119 +89,126 @@ void testing_axpy_strided_batched_ex_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasAxpyStridedBatchedExFn(nullptr,
-                                                            N,
-                                                            alpha,
-                                                            alphaType,
-                                                            dx,
-                                                            xType,
-                                                            incx,
-                                                            stridex,
-                                                            dy,
-                                                            yType,
-                                                            incy,
-                                                            stridey,
-                                                            batch_count,
-                                                            executionType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasAxpyStridedBatchedExFn,
+                    (nullptr,
+                     N,
+                     alpha,
+                     alphaType,
+                     dx,
+                     xType,
+                     incx,
+                     stridex,
+                     dy,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasAxpyStridedBatchedExFn(handle,
-                                                                N,
-                                                                nullptr,
-                                                                alphaType,
-                                                                dx,
-                                                                xType,
-                                                                incx,
-                                                                stridex,
-                                                                dy,
-                                                                yType,
-                                                                incy,
-                                                                stridey,
-                                                                batch_count,
-                                                                executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasAxpyStridedBatchedExFn,
+                        (handle,
+                         N,
+                         nullptr,
+                         alphaType,
+                         dx,
+                         xType,
+                         incx,
+                         stridex,
+                         dy,
+                         yType,
+                         incy,
+                         stridey,
+                         batch_count,
+                         executionType));
 
             // Can only check for nullptr for dx/dy with host mode because
             // device mode may not check as it could be quick-return success
             if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
             {
-                EXPECT_HIPBLAS_STATUS(hipblasAxpyStridedBatchedExFn(handle,
-                                                                    N,
-                                                                    alpha,
-                                                                    alphaType,
-                                                                    nullptr,
-                                                                    xType,
-                                                                    incx,
-                                                                    stridex,
-                                                                    dy,
-                                                                    yType,
-                                                                    incy,
-                                                                    stridey,
-                                                                    batch_count,
-                                                                    executionType),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
-                EXPECT_HIPBLAS_STATUS(hipblasAxpyStridedBatchedExFn(handle,
-                                                                    N,
-                                                                    alpha,
-                                                                    alphaType,
-                                                                    dx,
-                                                                    xType,
-                                                                    incx,
-                                                                    stridex,
-                                                                    nullptr,
-                                                                    yType,
-                                                                    incy,
-                                                                    stridey,
-                                                                    batch_count,
-                                                                    executionType),
-                                      HIPBLAS_STATUS_INVALID_VALUE);
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasAxpyStridedBatchedExFn,
+                            (handle,
+                             N,
+                             alpha,
+                             alphaType,
+                             nullptr,
+                             xType,
+                             incx,
+                             stridex,
+                             dy,
+                             yType,
+                             incy,
+                             stridey,
+                             batch_count,
+                             executionType));
+                DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                            hipblasAxpyStridedBatchedExFn,
+                            (handle,
+                             N,
+                             alpha,
+                             alphaType,
+                             dx,
+                             xType,
+                             incx,
+                             stridex,
+                             nullptr,
+                             yType,
+                             incy,
+                             stridey,
+                             batch_count,
+                             executionType));
             }
         }
 
-        CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
-                                                          0,
-                                                          nullptr,
-                                                          alphaType,
-                                                          nullptr,
-                                                          xType,
-                                                          incx,
-                                                          stridex,
-                                                          nullptr,
-                                                          yType,
-                                                          incy,
-                                                          stridey,
-                                                          batch_count,
-                                                          executionType));
-        CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
-                                                          N,
-                                                          zero,
-                                                          alphaType,
-                                                          nullptr,
-                                                          xType,
-                                                          incx,
-                                                          stridex,
-                                                          nullptr,
-                                                          yType,
-                                                          incy,
-                                                          stridey,
-                                                          batch_count,
-                                                          executionType));
-        CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
-                                                          N,
-                                                          nullptr,
-                                                          alphaType,
-                                                          nullptr,
-                                                          xType,
-                                                          incx,
-                                                          stridex,
-                                                          nullptr,
-                                                          yType,
-                                                          incy,
-                                                          stridey,
-                                                          0,
-                                                          executionType));
+        DAPI_CHECK(hipblasAxpyStridedBatchedExFn,
+                   (handle,
+                    0,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    stridex,
+                    nullptr,
+                    yType,
+                    incy,
+                    stridey,
+                    batch_count,
+                    executionType));
+        DAPI_CHECK(hipblasAxpyStridedBatchedExFn,
+                   (handle,
+                    N,
+                    zero,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    stridex,
+                    nullptr,
+                    yType,
+                    incy,
+                    stridey,
+                    batch_count,
+                    executionType));
+        DAPI_CHECK(hipblasAxpyStridedBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    stridex,
+                    nullptr,
+                    yType,
+                    incy,
+                    stridey,
+                    0,
+                    executionType));
     }
 }
 
@@ -208,6 +218,9 @@ void testing_axpy_strided_batched_ex(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasAxpyStridedBatchedExFn
         = FORTRAN ? hipblasAxpyStridedBatchedExFortran : hipblasAxpyStridedBatchedEx;
+    auto hipblasAxpyStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                                ? hipblasAxpyStridedBatchedEx_64Fortran
+                                                : hipblasAxpyStridedBatchedEx_64;
     hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
 
     int    N            = arg.N;
@@ -233,20 +246,21 @@ void testing_axpy_strided_batched_ex(const Arguments& arg)
     // memory
     if(N <= 0 || batch_count <= 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
-                                                          N,
-                                                          nullptr,
-                                                          alphaType,
-                                                          nullptr,
-                                                          xType,
-                                                          incx,
-                                                          stridex,
-                                                          nullptr,
-                                                          yType,
-                                                          incy,
-                                                          stridey,
-                                                          batch_count,
-                                                          executionType));
+        DAPI_CHECK(hipblasAxpyStridedBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    stridex,
+                    nullptr,
+                    yType,
+                    incy,
+                    stridey,
+                    batch_count,
+                    executionType));
         return;
     }
 
@@ -288,39 +302,41 @@ void testing_axpy_strided_batched_ex(const Arguments& arg)
          HIPBLAS
     =================================================================== */
     CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-    CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
-                                                      N,
-                                                      &h_alpha,
-                                                      alphaType,
-                                                      dx,
-                                                      xType,
-                                                      incx,
-                                                      stridex,
-                                                      dy,
-                                                      yType,
-                                                      incy,
-                                                      stridey,
-                                                      batch_count,
-                                                      executionType));
+    DAPI_CHECK(hipblasAxpyStridedBatchedExFn,
+               (handle,
+                N,
+                &h_alpha,
+                alphaType,
+                dx,
+                xType,
+                incx,
+                stridex,
+                dy,
+                yType,
+                incy,
+                stridey,
+                batch_count,
+                executionType));
 
     CHECK_HIP_ERROR(hipMemcpy(hy_host, dy, sizeof(Ty) * sizeY, hipMemcpyDeviceToHost));
     CHECK_HIP_ERROR(hipMemcpy(dy, hy_device, sizeof(Ty) * sizeY, hipMemcpyHostToDevice));
 
     CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-    CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
-                                                      N,
-                                                      d_alpha,
-                                                      alphaType,
-                                                      dx,
-                                                      xType,
-                                                      incx,
-                                                      stridex,
-                                                      dy,
-                                                      yType,
-                                                      incy,
-                                                      stridey,
-                                                      batch_count,
-                                                      executionType));
+    DAPI_CHECK(hipblasAxpyStridedBatchedExFn,
+               (handle,
+                N,
+                d_alpha,
+                alphaType,
+                dx,
+                xType,
+                incx,
+                stridex,
+                dy,
+                yType,
+                incy,
+                stridey,
+                batch_count,
+                executionType));
 
     CHECK_HIP_ERROR(hipMemcpy(hy_device, dy, sizeof(Ty) * sizeY, hipMemcpyDeviceToHost));
 
@@ -363,20 +379,21 @@ void testing_axpy_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
-                                                              N,
-                                                              d_alpha,
-                                                              alphaType,
-                                                              dx,
-                                                              xType,
-                                                              incx,
-                                                              stridex,
-                                                              dy,
-                                                              yType,
-                                                              incy,
-                                                              stridey,
-                                                              batch_count,
-                                                              executionType));
+            DAPI_CHECK(hipblasAxpyStridedBatchedExFn,
+                       (handle,
+                        N,
+                        d_alpha,
+                        alphaType,
+                        dx,
+                        xType,
+                        incx,
+                        stridex,
+                        dy,
+                        yType,
+                        incy,
+                        stridey,
+                        batch_count,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
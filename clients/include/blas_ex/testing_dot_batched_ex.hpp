@@ -55,6 +55,10 @@ void testing_dot_batched_ex_bad_arg(const Arguments& arg)
     auto hipblasDotBatchedExFn
         = FORTRAN ? (CONJ ? hipblasDotcBatchedExFortran : hipblasDotBatchedExFortran)
                   : (CONJ ? hipblasDotcBatchedEx : hipblasDotBatchedEx);
+    auto hipblasDotBatchedExFn_64 = arg.api == FORTRAN_64
+                                        ? (CONJ ? hipblasDotcBatchedEx_64Fortran
+                                                : hipblasDotBatchedEx_64Fortran)
+                                        : (CONJ ? hipblasDotcBatchedEx_64 : hipblasDotBatchedEx_64);
 
     hipblasDatatype_t xType         = arg.a_type;
     hipblasDatatype_t yType         = arg.b_type;
@@ -76,61 +80,65 @@ void testing_dot_batched_ex_bad_arg(const Arguments& arg)
         device_vector<Tr>       d_res(batch_count);
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(hipblasDotBatchedExFn(nullptr,
-                                                    N,
-                                                    dx,
-                                                    xType,
-                                                    incx,
-                                                    dy,
-                                                    yType,
-                                                    incy,
-                                                    batch_count,
-                                                    d_res,
-                                                    resultType,
-                                                    executionType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasDotBatchedExFn,
+                    (nullptr,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     dy,
+                     yType,
+                     incy,
+                     batch_count,
+                     d_res,
+                     resultType,
+                     executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasDotBatchedExFn(handle,
-                                                        N,
-                                                        nullptr,
-                                                        xType,
-                                                        incx,
-                                                        dy,
-                                                        yType,
-                                                        incy,
-                                                        batch_count,
-                                                        d_res,
-                                                        resultType,
-                                                        executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasDotBatchedExFn(handle,
-                                                        N,
-                                                        dx,
-                                                        xType,
-                                                        incx,
-                                                        nullptr,
-                                                        yType,
-                                                        incy,
-                                                        batch_count,
-                                                        d_res,
-                                                        resultType,
-                                                        executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasDotBatchedExFn(handle,
-                                                        N,
-                                                        dx,
-                                                        xType,
-                                                        incx,
-                                                        dy,
-                                                        yType,
-                                                        incy,
-                                                        batch_count,
-                                                        nullptr,
-                                                        resultType,
-                                                        executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotBatchedExFn,
+                        (handle,
+                         N,
+                         nullptr,
+                         xType,
+                         incx,
+                         dy,
+                         yType,
+                         incy,
+                         batch_count,
+                         d_res,
+                         resultType,
+                         executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotBatchedExFn,
+                        (handle,
+                         N,
+                         dx,
+                         xType,
+                         incx,
+                         nullptr,
+                         yType,
+                         incy,
+                         batch_count,
+                         d_res,
+                         resultType,
+                         executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotBatchedExFn,
+                        (handle,
+                         N,
+                         dx,
+                         xType,
+                         incx,
+                         dy,
+                         yType,
+                         incy,
+                         batch_count,
+                         nullptr,
+                         resultType,
+                         executionType));
         }
     }
 }
@@ -148,6 +156,10 @@ void testing_dot_batched_ex(const Arguments& arg)
     auto hipblasDotBatchedExFn
         = FORTRAN ? (CONJ ? hipblasDotcBatchedExFortran : hipblasDotBatchedExFortran)
                   : (CONJ ? hipblasDotcBatchedEx : hipblasDotBatchedEx);
+    auto hipblasDotBatchedExFn_64 = arg.api == FORTRAN_64
+                                        ? (CONJ ? hipblasDotcBatchedEx_64Fortran
+                                                : hipblasDotBatchedEx_64Fortran)
+                                        : (CONJ ? hipblasDotcBatchedEx_64 : hipblasDotBatchedEx_64);
 
     int N           = arg.N;
     int incx        = arg.incx;
@@ -173,18 +185,19 @@ void testing_dot_batched_ex(const Arguments& arg)
                                   hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasDotBatchedExFn(handle,
-                                                  N,
-                                                  nullptr,
-                                                  xType,
-                                                  incx,
-                                                  nullptr,
-                                                  yType,
-                                                  incy,
-                                                  batch_count,
-                                                  d_hipblas_result_0,
-                                                  resultType,
-                                                  executionType));
+        DAPI_CHECK(hipblasDotBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    batch_count,
+                    d_hipblas_result_0,
+                    resultType,
+                    executionType));
 
         if(batch_count > 0)
         {
@@ -228,32 +241,34 @@ void testing_dot_batched_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasDotBatchedExFn(handle,
-                                                  N,
-                                                  dx.ptr_on_device(),
-                                                  xType,
-                                                  incx,
-                                                  dy.ptr_on_device(),
-                                                  yType,
-                                                  incy,
-                                                  batch_count,
-                                                  h_hipblas_result_host,
-                                                  resultType,
-                                                  executionType));
+        DAPI_CHECK(hipblasDotBatchedExFn,
+                   (handle,
+                    N,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    dy.ptr_on_device(),
+                    yType,
+                    incy,
+                    batch_count,
+                    h_hipblas_result_host,
+                    resultType,
+                    executionType));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasDotBatchedExFn(handle,
-                                                  N,
-                                                  dx.ptr_on_device(),
-                                                  xType,
-                                                  incx,
-                                                  dy.ptr_on_device(),
-                                                  yType,
-                                                  incy,
-                                                  batch_count,
-                                                  d_hipblas_result,
-                                                  resultType,
-                                                  executionType));
+        DAPI_CHECK(hipblasDotBatchedExFn,
+                   (handle,
+                    N,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    dy.ptr_on_device(),
+                    yType,
+                    incy,
+                    batch_count,
+                    d_hipblas_result,
+                    resultType,
+                    executionType));
 
         CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
                                   d_hipblas_result,
@@ -318,18 +333,19 @@ void testing_dot_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasDotBatchedExFn(handle,
-                                                      N,
-                                                      dx.ptr_on_device(),
-                                                      xType,
-                                                      incx,
-                                                      dy.ptr_on_device(),
-                                                      yType,
-                                                      incy,
-                                                      batch_count,
-                                                      d_hipblas_result,
-                                                      resultType,
-                                                      executionType));
+            DAPI_CHECK(hipblasDotBatchedExFn,
+                       (handle,
+                        N,
+                        dx.ptr_on_device(),
+                        xType,
+                        incx,
+                        dy.ptr_on_device(),
+                        yType,
+                        incy,
+                        batch_count,
+                        d_hipblas_result,
+                        resultType,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
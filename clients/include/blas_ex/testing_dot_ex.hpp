@@ -48,6 +48,9 @@ void testing_dot_ex_bad_arg(const Arguments& arg)
     bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDotExFn = FORTRAN ? (CONJ ? hipblasDotcExFortran : hipblasDotExFortran)
                                   : (CONJ ? hipblasDotcEx : hipblasDotEx);
+    auto hipblasDotExFn_64 = arg.api == FORTRAN_64
+                                 ? (CONJ ? hipblasDotcEx_64Fortran : hipblasDotEx_64Fortran)
+                                 : (CONJ ? hipblasDotcEx_64 : hipblasDotEx_64);
 
     hipblasDatatype_t xType         = arg.a_type;
     hipblasDatatype_t yType         = arg.b_type;
@@ -68,49 +71,43 @@ void testing_dot_ex_bad_arg(const Arguments& arg)
         device_vector<Tr> d_res(1);
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(
-            hipblasDotExFn(
-                nullptr, N, dx, xType, incx, dy, yType, incy, d_res, resultType, executionType),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasDotExFn,
+            (nullptr, N, dx, xType, incx, dy, yType, incy, d_res, resultType, executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasDotExFn(handle,
-                                                 N,
-                                                 nullptr,
-                                                 xType,
-                                                 incx,
-                                                 dy,
-                                                 yType,
-                                                 incy,
-                                                 d_res,
-                                                 resultType,
-                                                 executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasDotExFn(handle,
-                                                 N,
-                                                 dx,
-                                                 xType,
-                                                 incx,
-                                                 nullptr,
-                                                 yType,
-                                                 incy,
-                                                 d_res,
-                                                 resultType,
-                                                 executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasDotExFn(handle,
-                                                 N,
-                                                 dx,
-                                                 xType,
-                                                 incx,
-                                                 dy,
-                                                 yType,
-                                                 incy,
-                                                 nullptr,
-                                                 resultType,
-                                                 executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotExFn,
+                        (handle,
+                         N,
+                         nullptr,
+                         xType,
+                         incx,
+                         dy,
+                         yType,
+                         incy,
+                         d_res,
+                         resultType,
+                         executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotExFn,
+                        (handle,
+                         N,
+                         dx,
+                         xType,
+                         incx,
+                         nullptr,
+                         yType,
+                         incy,
+                         d_res,
+                         resultType,
+                         executionType));
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasDotExFn,
+                (handle, N, dx, xType, incx, dy, yType, incy, nullptr, resultType, executionType));
         }
     }
 }
@@ -127,6 +124,9 @@ void testing_dot_ex(const Arguments& arg)
     bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasDotExFn = FORTRAN ? (CONJ ? hipblasDotcExFortran : hipblasDotExFortran)
                                   : (CONJ ? hipblasDotcEx : hipblasDotEx);
+    auto hipblasDotExFn_64 = arg.api == FORTRAN_64
+                                 ? (CONJ ? hipblasDotcEx_64Fortran : hipblasDotEx_64Fortran)
+                                 : (CONJ ? hipblasDotcEx_64 : hipblasDotEx_64);
 
     int N    = arg.N;
     int incx = arg.incx;
@@ -150,17 +150,18 @@ void testing_dot_ex(const Arguments& arg)
             hipMemcpy(d_hipblas_result_0, h_hipblas_result_0, sizeof(Tr), hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasDotExFn(handle,
-                                           N,
-                                           nullptr,
-                                           xType,
-                                           incx,
-                                           nullptr,
-                                           yType,
-                                           incy,
-                                           d_hipblas_result_0,
-                                           resultType,
-                                           executionType));
+        DAPI_CHECK(hipblasDotExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    d_hipblas_result_0,
+                    resultType,
+                    executionType));
 
         host_vector<Tr> cpu_0(1);
         host_vector<Tr> gpu_0(1);
@@ -204,30 +205,32 @@ void testing_dot_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasDotExFn(handle,
-                                           N,
-                                           dx,
-                                           xType,
-                                           incx,
-                                           dy,
-                                           yType,
-                                           incy,
-                                           &hipblas_result_host,
-                                           resultType,
-                                           executionType));
+        DAPI_CHECK(hipblasDotExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    dy,
+                    yType,
+                    incy,
+                    &hipblas_result_host,
+                    resultType,
+                    executionType));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasDotExFn(handle,
-                                           N,
-                                           dx,
-                                           xType,
-                                           incx,
-                                           dy,
-                                           yType,
-                                           incy,
-                                           d_hipblas_result,
-                                           resultType,
-                                           executionType));
+        DAPI_CHECK(hipblasDotExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    dy,
+                    yType,
+                    incy,
+                    d_hipblas_result,
+                    resultType,
+                    executionType));
 
         CHECK_HIP_ERROR(
             hipMemcpy(&hipblas_result_device, d_hipblas_result, sizeof(Tr), hipMemcpyDeviceToHost));
@@ -273,17 +276,18 @@ void testing_dot_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasDotExFn(handle,
-                                               N,
-                                               dx,
-                                               xType,
-                                               incx,
-                                               dy,
-                                               yType,
-                                               incy,
-                                               d_hipblas_result,
-                                               resultType,
-                                               executionType));
+            DAPI_CHECK(hipblasDotExFn,
+                       (handle,
+                        N,
+                        dx,
+                        xType,
+                        incx,
+                        dy,
+                        yType,
+                        incy,
+                        d_hipblas_result,
+                        resultType,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
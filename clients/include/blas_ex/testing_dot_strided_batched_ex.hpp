@@ -56,6 +56,11 @@ void testing_dot_strided_batched_ex_bad_arg(const Arguments& arg)
     auto hipblasDotStridedBatchedExFn
         = FORTRAN ? (CONJ ? hipblasDotcStridedBatchedExFortran : hipblasDotStridedBatchedExFortran)
                   : (CONJ ? hipblasDotcStridedBatchedEx : hipblasDotStridedBatchedEx);
+    auto hipblasDotStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                               ? (CONJ ? hipblasDotcStridedBatchedEx_64Fortran
+                                                       : hipblasDotStridedBatchedEx_64Fortran)
+                                               : (CONJ ? hipblasDotcStridedBatchedEx_64
+                                                       : hipblasDotStridedBatchedEx_64);
 
     hipblasDatatype_t xType         = arg.a_type;
     hipblasDatatype_t yType         = arg.b_type;
@@ -80,69 +85,73 @@ void testing_dot_strided_batched_ex_bad_arg(const Arguments& arg)
         device_vector<Tr> d_res(batch_count);
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(hipblasDotStridedBatchedExFn(nullptr,
-                                                           N,
-                                                           dx,
-                                                           xType,
-                                                           incx,
-                                                           stridex,
-                                                           dy,
-                                                           yType,
-                                                           incy,
-                                                           stridey,
-                                                           batch_count,
-                                                           d_res,
-                                                           resultType,
-                                                           executionType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasDotStridedBatchedExFn,
+                    (nullptr,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     stridex,
+                     dy,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     d_res,
+                     resultType,
+                     executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasDotStridedBatchedExFn(handle,
-                                                               N,
-                                                               nullptr,
-                                                               xType,
-                                                               incx,
-                                                               stridex,
-                                                               dy,
-                                                               yType,
-                                                               incy,
-                                                               stridey,
-                                                               batch_count,
-                                                               d_res,
-                                                               resultType,
-                                                               executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasDotStridedBatchedExFn(handle,
-                                                               N,
-                                                               dx,
-                                                               xType,
-                                                               incx,
-                                                               stridex,
-                                                               nullptr,
-                                                               yType,
-                                                               incy,
-                                                               stridey,
-                                                               batch_count,
-                                                               d_res,
-                                                               resultType,
-                                                               executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasDotStridedBatchedExFn(handle,
-                                                               N,
-                                                               dx,
-                                                               xType,
-                                                               incx,
-                                                               stridex,
-                                                               dy,
-                                                               yType,
-                                                               incy,
-                                                               stridey,
-                                                               batch_count,
-                                                               nullptr,
-                                                               resultType,
-                                                               executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotStridedBatchedExFn,
+                        (handle,
+                         N,
+                         nullptr,
+                         xType,
+                         incx,
+                         stridex,
+                         dy,
+                         yType,
+                         incy,
+                         stridey,
+                         batch_count,
+                         d_res,
+                         resultType,
+                         executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotStridedBatchedExFn,
+                        (handle,
+                         N,
+                         dx,
+                         xType,
+                         incx,
+                         stridex,
+                         nullptr,
+                         yType,
+                         incy,
+                         stridey,
+                         batch_count,
+                         d_res,
+                         resultType,
+                         executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasDotStridedBatchedExFn,
+                        (handle,
+                         N,
+                         dx,
+                         xType,
+                         incx,
+                         stridex,
+                         dy,
+                         yType,
+                         incy,
+                         stridey,
+                         batch_count,
+                         nullptr,
+                         resultType,
+                         executionType));
         }
     }
 }
@@ -160,6 +169,11 @@ void testing_dot_strided_batched_ex(const Arguments& arg)
     auto hipblasDotStridedBatchedExFn
         = FORTRAN ? (CONJ ? hipblasDotcStridedBatchedExFortran : hipblasDotStridedBatchedExFortran)
                   : (CONJ ? hipblasDotcStridedBatchedEx : hipblasDotStridedBatchedEx);
+    auto hipblasDotStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                               ? (CONJ ? hipblasDotcStridedBatchedEx_64Fortran
+                                                       : hipblasDotStridedBatchedEx_64Fortran)
+                                               : (CONJ ? hipblasDotcStridedBatchedEx_64
+                                                       : hipblasDotStridedBatchedEx_64);
 
     int    N            = arg.N;
     int    incx         = arg.incx;
@@ -198,20 +212,21 @@ void testing_dot_strided_batched_ex(const Arguments& arg)
                                   hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasDotStridedBatchedExFn(handle,
-                                                         N,
-                                                         nullptr,
-                                                         xType,
-                                                         incx,
-                                                         stridex,
-                                                         nullptr,
-                                                         yType,
-                                                         incy,
-                                                         stridey,
-                                                         batch_count,
-                                                         d_hipblas_result_0,
-                                                         resultType,
-                                                         executionType));
+        DAPI_CHECK(hipblasDotStridedBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    xType,
+                    incx,
+                    stridex,
+                    nullptr,
+                    yType,
+                    incy,
+                    stridey,
+                    batch_count,
+                    d_hipblas_result_0,
+                    resultType,
+                    executionType));
 
         if(batch_count > 0)
         {
@@ -253,36 +268,38 @@ void testing_dot_strided_batched_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasDotStridedBatchedExFn(handle,
-                                                         N,
-                                                         dx,
-                                                         xType,
-                                                         incx,
-                                                         stridex,
-                                                         dy,
-                                                         yType,
-                                                         incy,
-                                                         stridey,
-                                                         batch_count,
-                                                         h_hipblas_result_host,
-                                                         resultType,
-                                                         executionType));
+        DAPI_CHECK(hipblasDotStridedBatchedExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    stridex,
+                    dy,
+                    yType,
+                    incy,
+                    stridey,
+                    batch_count,
+                    h_hipblas_result_host,
+                    resultType,
+                    executionType));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasDotStridedBatchedExFn(handle,
-                                                         N,
-                                                         dx,
-                                                         xType,
-                                                         incx,
-                                                         stridex,
-                                                         dy,
-                                                         yType,
-                                                         incy,
-                                                         stridey,
-                                                         batch_count,
-                                                         d_hipblas_result,
-                                                         resultType,
-                                                         executionType));
+        DAPI_CHECK(hipblasDotStridedBatchedExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    stridex,
+                    dy,
+                    yType,
+                    incy,
+                    stridey,
+                    batch_count,
+                    d_hipblas_result,
+                    resultType,
+                    executionType));
 
         CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
                                   d_hipblas_result,
@@ -352,20 +369,21 @@ void testing_dot_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasDotStridedBatchedExFn(handle,
-                                                             N,
-                                                             dx,
-                                                             xType,
-                                                             incx,
-                                                             stridex,
-                                                             dy,
-                                                             yType,
-                                                             incy,
-                                                             stridey,
-                                                             batch_count,
-                                                             d_hipblas_result,
-                                                             resultType,
-                                                             executionType));
+            DAPI_CHECK(hipblasDotStridedBatchedExFn,
+                       (handle,
+                        N,
+                        dx,
+                        xType,
+                        incx,
+                        stridex,
+                        dy,
+                        yType,
+                        incy,
+                        stridey,
+                        batch_count,
+                        d_hipblas_result,
+                        resultType,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -46,9 +46,11 @@ using hipblasGemmBatchedExModel = ArgumentModel<e_a_type,
                                                 e_ldb,
                                                 e_beta,
                                                 e_ldc,
+                                                e_ldd,
                                                 e_batch_count,
                                                 e_with_flags,
-                                                e_flags>;
+                                                e_flags,
+                                                e_c_noalias_d>;
 
 inline void testname_gemm_batched_ex(const Arguments& arg, std::string& name)
 {
@@ -303,6 +305,48 @@ void testing_gemm_batched_ex_bad_arg(const Arguments& arg)
 
         // clang-format on
     }
+
+#ifdef HIPBLAS_V2
+    // hipblasGemmBatchedExWithD checks ldd and the type of D as well
+    device_batch_vector<To> dD(N * ldc, 1, batch_count);
+
+    auto hipblasGemmBatchedExWithDFn = [&](hipblasHandle_t h, int64_t ldd, hipDataType dType) {
+        return hipblasGemmBatchedExWithD(h,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         (const void**)dA.ptr_on_device(),
+                                         aType,
+                                         lda,
+                                         (const void**)dB.ptr_on_device(),
+                                         bType,
+                                         ldb,
+                                         &h_beta,
+                                         (const void**)dC.ptr_on_device(),
+                                         cType,
+                                         ldc,
+                                         (void**)dD.ptr_on_device(),
+                                         dType,
+                                         ldd,
+                                         batch_count,
+                                         computeTypeGemm,
+                                         algo,
+                                         flags);
+    };
+
+    hipDataType otherType = cType == HIP_R_16F ? HIP_R_32F : HIP_R_16F;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedExWithDFn(nullptr, ldc, cType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedExWithDFn(handle, M - 1, cType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedExWithDFn(handle, ldc, otherType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#endif
 }
 
 template <typename Ti, typename To = Ti, typename Tex = To>
@@ -310,6 +354,8 @@ void testing_gemm_batched_ex(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmBatchedExFn = FORTRAN ? hipblasGemmBatchedExFortran : hipblasGemmBatchedEx;
+    auto hipblasGemmBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasGemmBatchedEx_64Fortran : hipblasGemmBatchedEx_64;
     auto hipblasGemmBatchedExWithFlagsFn
         = FORTRAN ? hipblasGemmBatchedExWithFlagsFortran : hipblasGemmBatchedExWithFlags;
 
@@ -325,6 +371,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
     int lda = arg.lda;
     int ldb = arg.ldb;
     int ldc = arg.ldc;
+    int ldd = arg.ldd;
 
     int batch_count = arg.batch_count;
 
@@ -348,7 +395,8 @@ void testing_gemm_batched_ex(const Arguments& arg)
     int B_col = transB == HIPBLAS_OP_N ? N : K;
 
     // check here to prevent undefined memory allocation error
-    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0
+       || (arg.c_noalias_d && ldd < M))
     {
         return;
     }
@@ -357,9 +405,13 @@ void testing_gemm_batched_ex(const Arguments& arg)
     const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
     const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
 
+    // with c_noalias_d hipblasGemmBatchedExWithD writes the result to D instead of C
+    const size_t size_D = arg.c_noalias_d ? static_cast<size_t>(ldd) * static_cast<size_t>(N) : 0;
+
     device_batch_vector<Ti> dA(size_A, 1, batch_count);
     device_batch_vector<Ti> dB(size_B, 1, batch_count);
     device_batch_vector<To> dC(size_C, 1, batch_count);
+    device_batch_vector<To> dD(size_D, 1, batch_count);
     device_vector<Tex>      d_alpha(1);
     device_vector<Tex>      d_beta(1);
 
@@ -372,6 +424,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
     host_batch_vector<To> hC_host(size_C, 1, batch_count);
     host_batch_vector<To> hC_device(size_C, 1, batch_count);
     host_batch_vector<To> hC_gold(size_C, 1, batch_count);
+    host_batch_vector<To> hC_init(size_C, 1, batch_count);
 
     double             gpu_time_used, hipblas_error_host, hipblas_error_device;
     hipblasLocalHandle handle(arg);
@@ -382,6 +435,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
 
     hC_device.copy_from(hC_host);
     hC_gold.copy_from(hC_host);
+    hC_init.copy_from(hC_host);
 
     // Initial Data on CPU
     srand(1);
@@ -401,30 +455,31 @@ void testing_gemm_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
         if(!arg.with_flags)
         {
-            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       K,
-                                                       &h_alpha_Tex,
-                                                       (const void**)(Ti**)dA.ptr_on_device(),
-                                                       a_type,
-                                                       lda,
-                                                       (const void**)(Ti**)dB.ptr_on_device(),
-                                                       b_type,
-                                                       ldb,
-                                                       &h_beta_Tex,
-                                                       (void**)(To**)dC.ptr_on_device(),
-                                                       c_type,
-                                                       ldc,
-                                                       batch_count,
+            DAPI_CHECK(hipblasGemmBatchedExFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        &h_alpha_Tex,
+                        (const void**)(Ti**)dA.ptr_on_device(),
+                        a_type,
+                        lda,
+                        (const void**)(Ti**)dB.ptr_on_device(),
+                        b_type,
+                        ldb,
+                        &h_beta_Tex,
+                        (void**)(To**)dC.ptr_on_device(),
+                        c_type,
+                        ldc,
+                        batch_count,
 #ifdef HIPBLAS_V2
-                                                       compute_type_gemm,
+                        compute_type_gemm,
 #else
-                                                       compute_type,
+                        compute_type,
 #endif
-                                                       algo));
+                        algo));
         }
         else
         {
@@ -462,30 +517,31 @@ void testing_gemm_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         if(!arg.with_flags)
         {
-            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExFn(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       K,
-                                                       d_alpha,
-                                                       (const void**)(Ti**)dA.ptr_on_device(),
-                                                       a_type,
-                                                       lda,
-                                                       (const void**)(Ti**)dB.ptr_on_device(),
-                                                       b_type,
-                                                       ldb,
-                                                       d_beta,
-                                                       (void**)(To**)dC.ptr_on_device(),
-                                                       c_type,
-                                                       ldc,
-                                                       batch_count,
+            DAPI_CHECK(hipblasGemmBatchedExFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        d_alpha,
+                        (const void**)(Ti**)dA.ptr_on_device(),
+                        a_type,
+                        lda,
+                        (const void**)(Ti**)dB.ptr_on_device(),
+                        b_type,
+                        ldb,
+                        d_beta,
+                        (void**)(To**)dC.ptr_on_device(),
+                        c_type,
+                        ldc,
+                        batch_count,
 #ifdef HIPBLAS_V2
-                                                       compute_type_gemm,
+                        compute_type_gemm,
 #else
-                                                       compute_type,
+                        compute_type,
 #endif
-                                                       algo));
+                        algo));
         }
         else
         {
@@ -537,15 +593,18 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                   ldc);
         }
 
+        // check for float16/bfloat16 input
+        const bool near_check
+            = (getArchMajor() == 11)
+              && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                  || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                  || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{}));
+        const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+
         if(unit_check)
         {
-            // check for float16/bfloat16 input
-            if((getArchMajor() == 11)
-               && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
-                   || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
-                   || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
+            if(near_check)
             {
-                const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
                 near_check_general<To>(M, N, batch_count, ldc, hC_gold, hC_host, tol);
                 near_check_general<To>(M, N, batch_count, ldc, hC_gold, hC_device, tol);
             }
@@ -563,6 +622,125 @@ void testing_gemm_batched_ex(const Arguments& arg)
             hipblas_error_device
                 = norm_check_general<To>('F', M, N, ldc, hC_gold, hC_device, batch_count);
         }
+
+#ifdef HIPBLAS_V2
+        // Every solution listed for the problem computes the result of the default one
+        if(unit_check && !FORTRAN)
+        {
+            auto get_solutions = [&](int* solutions, int* count) {
+                return hipblasGemmBatchedExGetSolutions(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha_Tex,
+                                                        (const void**)(Ti**)dA.ptr_on_device(),
+                                                        a_type,
+                                                        lda,
+                                                        (const void**)(Ti**)dB.ptr_on_device(),
+                                                        b_type,
+                                                        ldb,
+                                                        &h_beta_Tex,
+                                                        (void**)(To**)dC.ptr_on_device(),
+                                                        c_type,
+                                                        ldc,
+                                                        batch_count,
+                                                        compute_type_gemm,
+                                                        flags,
+                                                        solutions,
+                                                        count);
+            };
+
+            int              solution_count = 0;
+            std::vector<int> solutions;
+            if(get_solutions(nullptr, &solution_count) != HIPBLAS_STATUS_NOT_SUPPORTED)
+            {
+                solutions.resize(solution_count);
+                CHECK_HIPBLAS_ERROR(get_solutions(solutions.data(), &solution_count));
+            }
+
+            auto check_flags = hipblasGemmFlags_t(flags | HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX);
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            for(int i = 0; i < solution_count; i++)
+            {
+                CHECK_HIP_ERROR(dC.transfer_from(hC_init));
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmBatchedExWithSolution(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha_Tex,
+                                                     (const void**)(Ti**)dA.ptr_on_device(),
+                                                     a_type,
+                                                     lda,
+                                                     (const void**)(Ti**)dB.ptr_on_device(),
+                                                     b_type,
+                                                     ldb,
+                                                     &h_beta_Tex,
+                                                     (void**)(To**)dC.ptr_on_device(),
+                                                     c_type,
+                                                     ldc,
+                                                     batch_count,
+                                                     compute_type_gemm,
+                                                     solutions[i],
+                                                     check_flags));
+                CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+                if(near_check)
+                    near_check_general<To>(M, N, batch_count, ldc, hC_gold, hC_host, tol);
+                else
+                    unit_check_general<To>(M, N, batch_count, ldc, hC_gold, hC_host);
+            }
+        }
+
+        // hipblasGemmBatchedExWithD writes the result to D and leaves C as it was
+        if(unit_check && arg.c_noalias_d && !FORTRAN)
+        {
+            host_batch_vector<To> hD(size_D, 1, batch_count), hD_gold(size_D, 1, batch_count);
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < M; i++)
+                        hD_gold[b][i + size_t(j) * ldd] = hC_gold[b][i + size_t(j) * ldc];
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC_init));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExWithD(handle,
+                                                          transA,
+                                                          transB,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          &h_alpha_Tex,
+                                                          (const void**)(Ti**)dA.ptr_on_device(),
+                                                          a_type,
+                                                          lda,
+                                                          (const void**)(Ti**)dB.ptr_on_device(),
+                                                          b_type,
+                                                          ldb,
+                                                          &h_beta_Tex,
+                                                          (const void**)(To**)dC.ptr_on_device(),
+                                                          c_type,
+                                                          ldc,
+                                                          (void**)(To**)dD.ptr_on_device(),
+                                                          c_type,
+                                                          ldd,
+                                                          batch_count,
+                                                          compute_type_gemm,
+                                                          algo,
+                                                          flags));
+            CHECK_HIP_ERROR(hD.transfer_from(dD));
+            CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+            unit_check_general<To>(M, N, batch_count, ldc, hC_init, hC_host);
+            if(near_check)
+                near_check_general<To>(M, N, batch_count, ldd, hD_gold, hD, tol);
+            else
+                unit_check_general<To>(M, N, batch_count, ldd, hD_gold, hD);
+        }
+#endif
     }
 
     if(timing)
@@ -577,32 +755,93 @@ void testing_gemm_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
+#ifdef HIPBLAS_V2
+            // --solution_index pins a solution listed by hipblasGemmBatchedExGetSolutions
+            if(arg.solution_index != 0 && !FORTRAN)
+            {
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmBatchedExWithSolution(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha_Tex,
+                                                     (const void**)(Ti**)dA.ptr_on_device(),
+                                                     a_type,
+                                                     lda,
+                                                     (const void**)(Ti**)dB.ptr_on_device(),
+                                                     b_type,
+                                                     ldb,
+                                                     &h_beta_Tex,
+                                                     (void**)(To**)dC.ptr_on_device(),
+                                                     c_type,
+                                                     ldc,
+                                                     batch_count,
+                                                     compute_type_gemm,
+                                                     arg.solution_index,
+                                                     flags));
+                continue;
+            }
+
+            if(arg.c_noalias_d && !FORTRAN)
+            {
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmBatchedExWithD(handle,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              &h_alpha_Tex,
+                                              (const void**)(Ti**)dA.ptr_on_device(),
+                                              a_type,
+                                              lda,
+                                              (const void**)(Ti**)dB.ptr_on_device(),
+                                              b_type,
+                                              ldb,
+                                              &h_beta_Tex,
+                                              (const void**)(To**)dC.ptr_on_device(),
+                                              c_type,
+                                              ldc,
+                                              (void**)(To**)dD.ptr_on_device(),
+                                              c_type,
+                                              ldd,
+                                              batch_count,
+                                              compute_type_gemm,
+                                              algo,
+                                              flags));
+                continue;
+            }
+#endif
+
             if(!arg.with_flags)
             {
-                CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExFn(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           N,
-                                                           K,
-                                                           &h_alpha_Tex,
-                                                           (const void**)(Ti**)dA.ptr_on_device(),
-                                                           a_type,
-                                                           lda,
-                                                           (const void**)(Ti**)dB.ptr_on_device(),
-                                                           b_type,
-                                                           ldb,
-                                                           &h_beta_Tex,
-                                                           (void**)(To**)dC.ptr_on_device(),
-                                                           c_type,
-                                                           ldc,
-                                                           batch_count,
+                DAPI_CHECK(hipblasGemmBatchedExFn,
+                           (handle,
+                            transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            &h_alpha_Tex,
+                            (const void**)(Ti**)dA.ptr_on_device(),
+                            a_type,
+                            lda,
+                            (const void**)(Ti**)dB.ptr_on_device(),
+                            b_type,
+                            ldb,
+                            &h_beta_Tex,
+                            (void**)(To**)dC.ptr_on_device(),
+                            c_type,
+                            ldc,
+                            batch_count,
 #ifdef HIPBLAS_V2
-                                                           compute_type_gemm,
+                            compute_type_gemm,
 #else
-                                                           compute_type,
+                            compute_type,
 #endif
-                                                           algo));
+                            algo));
             }
             else
             {
@@ -0,0 +1,408 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// hipblasGemmExWithEpilogue takes the HIPBLAS_V2 types only
+#ifdef HIPBLAS_V2
+
+using hipblasGemmEpilogueExModel = ArgumentModel<e_a_type,
+                                                 e_c_type,
+                                                 e_d_type,
+                                                 e_compute_type,
+                                                 e_transA,
+                                                 e_transB,
+                                                 e_M,
+                                                 e_N,
+                                                 e_K,
+                                                 e_alpha,
+                                                 e_lda,
+                                                 e_ldb,
+                                                 e_beta,
+                                                 e_ldc,
+                                                 e_ldd,
+                                                 e_epilogue,
+                                                 e_epilogue_scale>;
+
+inline void testname_gemm_epilogue_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmEpilogueExModel{}.test_name(arg, name);
+}
+
+// Values of the types the epilogue reads and writes, as doubles
+template <typename T>
+inline double gemm_epilogue_to_double(T x)
+{
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        return half_to_float(x);
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return bfloat16_to_float(x);
+    else if constexpr(is_complex<T>)
+        return x.real();
+    else
+        return double(x);
+}
+
+inline size_t gemm_epilogue_type_size(hipDataType type)
+{
+    return type == HIP_R_64F ? 8 : type == HIP_R_32F ? 4 : 2;
+}
+
+inline double gemm_epilogue_value(const std::vector<char>& buffer, hipDataType type, size_t i)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+        return half_to_float(reinterpret_cast<const hipblasHalf*>(buffer.data())[i]);
+    case HIP_R_16BF:
+        return bfloat16_to_float(reinterpret_cast<const hipblasBfloat16*>(buffer.data())[i]);
+    case HIP_R_32F:
+        return reinterpret_cast<const float*>(buffer.data())[i];
+    default:
+        return reinterpret_cast<const double*>(buffer.data())[i];
+    }
+}
+
+// Relative error of the epilogue, which computes in single precision unless a type is double
+inline double gemm_epilogue_tolerance(hipDataType out_type, hipDataType c_type)
+{
+    if(out_type == HIP_R_16BF)
+        return 1e-2;
+    if(out_type == HIP_R_16F)
+        return 2e-3;
+    if(out_type == HIP_R_64F || c_type == HIP_R_64F)
+        return 1e-12;
+    return 1e-5;
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_epilogue_ex_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+
+    int64_t M = 101, N = 100, K = 102, lda = 103, ldb = 104, ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_vector<Ti> dA(N * lda);
+    device_vector<Ti> dB(N * ldb);
+    device_vector<To> dC(N * ldc);
+    device_vector<To> dBias(M);
+
+    Tex alpha = 1, beta = 2;
+
+    hipblasGemmEpilogue_t epilogue = {};
+    epilogue.epilogue              = HIPBLAS_EPILOGUE_RELU_BIAS;
+    epilogue.bias                  = dBias;
+    epilogue.biasType              = cType;
+
+    auto gemm = [&](hipblasHandle_t h, int m, const hipblasGemmEpilogue_t* e) {
+        return hipblasGemmExWithEpilogue(h,
+                                         transA,
+                                         transB,
+                                         m,
+                                         N,
+                                         K,
+                                         &alpha,
+                                         dA,
+                                         aType,
+                                         lda,
+                                         dB,
+                                         bType,
+                                         ldb,
+                                         &beta,
+                                         dC,
+                                         cType,
+                                         ldc,
+                                         computeType,
+                                         algo,
+                                         e);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    EXPECT_HIPBLAS_STATUS(gemm(nullptr, M, &epilogue), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(gemm(handle, M, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasGemmEpilogue_t bad = epilogue;
+    bad.epilogue              = hipblasEpilogue_t(HIPBLAS_EPILOGUE_GELU_BIAS + 1);
+    EXPECT_HIPBLAS_STATUS(gemm(handle, M, &bad), HIPBLAS_STATUS_INVALID_ENUM);
+
+    bad      = epilogue;
+    bad.bias = nullptr;
+    EXPECT_HIPBLAS_STATUS(gemm(handle, M, &bad), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // out is checked before C is written
+    bad       = epilogue;
+    bad.out   = dC;
+    bad.ldout = M - 1;
+    EXPECT_HIPBLAS_STATUS(gemm(handle, M, &bad), HIPBLAS_STATUS_INVALID_VALUE);
+
+    bad         = epilogue;
+    bad.out     = dC;
+    bad.outType = HIP_C_32F;
+    bad.ldout   = M;
+    EXPECT_HIPBLAS_STATUS(gemm(handle, M, &bad), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // the bias is not read when there is nothing to compute
+    bad      = epilogue;
+    bad.bias = nullptr;
+    CHECK_HIPBLAS_ERROR(gemm(handle, 0, &bad));
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_epilogue_ex(const Arguments& arg)
+{
+    // the epilogue supports real types only, complex ones are covered by the bad_arg test
+    if constexpr(is_complex<To>)
+        return;
+
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+    int                ldd    = arg.ldd;
+
+    hipDataType          a_type            = arg.a_type;
+    hipDataType          b_type            = arg.b_type;
+    hipDataType          c_type            = arg.c_type;
+    hipDataType          d_type            = arg.d_type;
+    hipblasComputeType_t compute_type_gemm = arg.compute_type_gemm;
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    // in place the result has the type of C
+    bool inplace = arg.inplace;
+    if(inplace)
+    {
+        d_type = c_type;
+        ldd    = ldc;
+    }
+
+    hipblasEpilogue_t act      = hipblasEpilogue_t(arg.epilogue);
+    bool              has_bias = act & HIPBLAS_EPILOGUE_BIAS;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M)
+    {
+        return;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+    const size_t size_D = static_cast<size_t>(ldd) * static_cast<size_t>(N);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ti>    hA(size_A);
+    host_vector<Ti>    hB(size_B);
+    host_vector<To>    hC(size_C);
+    host_vector<To>    hC_gold(size_C);
+    host_vector<To>    hBias(M);
+    host_vector<float> hRowScale(M);
+    host_vector<float> hColScale(N);
+    std::vector<char>  hD(size_D * gemm_epilogue_type_size(d_type));
+
+    device_vector<Ti>    dA(size_A);
+    device_vector<Ti>    dB(size_B);
+    device_vector<To>    dC(size_C);
+    device_vector<To>    dBias(M);
+    device_vector<float> dRowScale(M);
+    device_vector<float> dColScale(N);
+    device_vector<char>  dD(hD.size());
+
+    double             gpu_time_used, hipblas_error_host = 0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC;
+
+    // biases of both signs, so that the activation clamps some results, and scales which are
+    // powers of 2
+    for(int i = 0; i < M; i++)
+    {
+        hBias[i]     = convert_alpha_beta<To>(i % 7 - 3, 0);
+        hRowScale[i] = i % 3 ? 2.0f : 0.5f;
+    }
+    for(int j = 0; j < N; j++)
+        hColScale[j] = j % 2 ? 0.25f : 1.0f;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Ti) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBias, hBias, sizeof(To) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dRowScale, hRowScale, sizeof(float) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dColScale, hColScale, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    hipblasGemmEpilogue_t epilogue = {};
+    epilogue.epilogue              = act;
+    epilogue.bias                  = has_bias ? (const To*)dBias : nullptr;
+    epilogue.biasType              = c_type;
+    epilogue.rowScale              = arg.epilogue_scale ? (const float*)dRowScale : nullptr;
+    epilogue.colScale              = arg.epilogue_scale ? (const float*)dColScale : nullptr;
+    epilogue.out                   = inplace ? nullptr : (char*)dD;
+    epilogue.outType               = d_type;
+    epilogue.ldout                 = ldd;
+
+    auto gemm = [&]() {
+        return hipblasGemmExWithEpilogue(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha_Tex,
+                                         dA,
+                                         a_type,
+                                         lda,
+                                         dB,
+                                         b_type,
+                                         ldb,
+                                         &h_beta_Tex,
+                                         dC,
+                                         c_type,
+                                         ldc,
+                                         compute_type_gemm,
+                                         algo,
+                                         &epilogue);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(gemm());
+
+        if(inplace)
+            CHECK_HIP_ERROR(hipMemcpy(hD.data(), dC, hD.size(), hipMemcpyDeviceToHost));
+        else
+            CHECK_HIP_ERROR(hipMemcpy(hD.data(), dD, hD.size(), hipMemcpyDeviceToHost));
+
+        // reference BLAS, then the epilogue applied to the result rounded to the type of C
+        ref_gemm<Ti, To, Tex>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha_Tex,
+                              hA.data(),
+                              lda,
+                              hB.data(),
+                              ldb,
+                              h_beta_Tex,
+                              hC_gold.data(),
+                              ldc);
+
+        const double tolerance = gemm_epilogue_tolerance(d_type, c_type);
+        const int    kind      = act & ~HIPBLAS_EPILOGUE_BIAS;
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < M; i++)
+            {
+                double x = gemm_epilogue_to_double(hC_gold[i + size_t(j) * ldc]);
+                if(arg.epilogue_scale)
+                    x *= double(hRowScale[i]) * hColScale[j];
+                if(has_bias)
+                    x += gemm_epilogue_to_double(hBias[i]);
+                if(kind == HIPBLAS_EPILOGUE_RELU)
+                    x = std::max(x, 0.0);
+                else if(kind == HIPBLAS_EPILOGUE_GELU)
+                    x = 0.5 * x * (1 + std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x)));
+
+                double result = gemm_epilogue_value(hD, d_type, i + size_t(j) * ldd);
+                double error  = std::abs(result - x) / std::max(1.0, std::abs(x));
+                if(unit_check)
+                    unit_check_error(error, tolerance);
+                hipblas_error_host = std::max(hipblas_error_host, error);
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(gemm());
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // the epilogue reads C once more and writes the result
+        double gbytes = gemm_gbyte_count<Tex>(M, N, K)
+                        + (double(sizeof(To)) * M * N
+                           + double(gemm_epilogue_type_size(d_type)) * M * N)
+                              / 1e9;
+
+        hipblasGemmEpilogueExModel{}.log_args<To>(std::cout,
+                                                  arg,
+                                                  gpu_time_used,
+                                                  gemm_gflop_count<Tex>(M, N, K),
+                                                  gbytes,
+                                                  hipblas_error_host);
+    }
+}
+
+#endif
@@ -46,8 +46,10 @@ using hipblasGemmExModel = ArgumentModel<e_a_type,
                                          e_ldb,
                                          e_beta,
                                          e_ldc,
+                                         e_ldd,
                                          e_with_flags,
-                                         e_flags>;
+                                         e_flags,
+                                         e_c_noalias_d>;
 
 inline void testname_gemm_ex(const Arguments& arg, std::string& name)
 {
@@ -290,13 +292,54 @@ void testing_gemm_ex_bad_arg(const Arguments& arg)
 
         // clang-format on
     }
+
+#ifdef HIPBLAS_V2
+    // hipblasGemmExWithD checks ldd and the type of D as well
+    device_vector<To> dD(N * ldc);
+
+    auto hipblasGemmExWithDFn = [&](hipblasHandle_t h, int64_t ldd, hipDataType dType) {
+        return hipblasGemmExWithD(h,
+                                  transA,
+                                  transB,
+                                  M,
+                                  N,
+                                  K,
+                                  &h_alpha,
+                                  dA,
+                                  aType,
+                                  lda,
+                                  dB,
+                                  bType,
+                                  ldb,
+                                  &h_beta,
+                                  dC,
+                                  cType,
+                                  ldc,
+                                  dD,
+                                  dType,
+                                  ldd,
+                                  computeTypeGemm,
+                                  algo,
+                                  flags);
+    };
+
+    hipDataType otherType = cType == HIP_R_16F ? HIP_R_32F : HIP_R_16F;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDFn(nullptr, ldc, cType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDFn(handle, M - 1, cType), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExWithDFn(handle, ldc, otherType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#endif
 }
 
 template <typename Ti, typename To = Ti, typename Tex = To>
 void testing_gemm_ex(const Arguments& arg)
 {
-    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGemmExFn = FORTRAN ? hipblasGemmExFortran : hipblasGemmEx;
+    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGemmExFn    = FORTRAN ? hipblasGemmExFortran : hipblasGemmEx;
+    auto hipblasGemmExFn_64 = arg.api == FORTRAN_64 ? hipblasGemmEx_64Fortran : hipblasGemmEx_64;
     auto hipblasGemmExWithFlagsFn
         = FORTRAN ? hipblasGemmExWithFlagsFortran : hipblasGemmExWithFlags;
 
@@ -312,6 +355,7 @@ void testing_gemm_ex(const Arguments& arg)
     int                lda    = arg.lda;
     int                ldb    = arg.ldb;
     int                ldc    = arg.ldc;
+    int                ldd    = arg.ldd;
 
     hipblasDatatype_t    a_type            = arg.a_type;
     hipblasDatatype_t    b_type            = arg.b_type;
@@ -333,7 +377,8 @@ void testing_gemm_ex(const Arguments& arg)
     int B_col = transB == HIPBLAS_OP_N ? N : K;
 
     // check here to prevent undefined memory allocation error
-    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+       || (arg.c_noalias_d && ldd < M))
     {
         return;
     }
@@ -342,6 +387,9 @@ void testing_gemm_ex(const Arguments& arg)
     const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
     const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
 
+    // with c_noalias_d hipblasGemmExWithD writes the result to D instead of C
+    const size_t size_D = arg.c_noalias_d ? static_cast<size_t>(ldd) * static_cast<size_t>(N) : 0;
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
     host_vector<Ti> hA(size_A);
     host_vector<Ti> hB(size_B);
@@ -352,6 +400,7 @@ void testing_gemm_ex(const Arguments& arg)
     device_vector<Ti>  dA(size_A);
     device_vector<Ti>  dB(size_B);
     device_vector<To>  dC(size_C);
+    device_vector<To>  dD(size_D);
     device_vector<Tex> d_alpha(1);
     device_vector<Tex> d_beta(1);
 
@@ -365,6 +414,7 @@ void testing_gemm_ex(const Arguments& arg)
     hipblas_init_matrix(hC_host, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
 
     hC_gold = hC_device = hC_host;
+    host_vector<To> hC_init(hC_host);
 
     // copy data from CPU to device
 
@@ -381,29 +431,30 @@ void testing_gemm_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
         if(!arg.with_flags)
         {
-            CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
-                                                transA,
-                                                transB,
-                                                M,
-                                                N,
-                                                K,
-                                                &h_alpha_Tex,
-                                                dA,
-                                                a_type,
-                                                lda,
-                                                dB,
-                                                b_type,
-                                                ldb,
-                                                &h_beta_Tex,
-                                                dC,
-                                                c_type,
-                                                ldc,
+            DAPI_CHECK(hipblasGemmExFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        &h_alpha_Tex,
+                        dA,
+                        a_type,
+                        lda,
+                        dB,
+                        b_type,
+                        ldb,
+                        &h_beta_Tex,
+                        dC,
+                        c_type,
+                        ldc,
 #ifdef HIPBLAS_V2
-                                                compute_type_gemm,
+                        compute_type_gemm,
 #else
-                                                compute_type,
+                        compute_type,
 #endif
-                                                algo));
+                        algo));
         }
         else
         {
@@ -439,29 +490,30 @@ void testing_gemm_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         if(!arg.with_flags)
         {
-            CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
-                                                transA,
-                                                transB,
-                                                M,
-                                                N,
-                                                K,
-                                                d_alpha,
-                                                dA,
-                                                a_type,
-                                                lda,
-                                                dB,
-                                                b_type,
-                                                ldb,
-                                                d_beta,
-                                                dC,
-                                                c_type,
-                                                ldc,
+            DAPI_CHECK(hipblasGemmExFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        d_alpha,
+                        dA,
+                        a_type,
+                        lda,
+                        dB,
+                        b_type,
+                        ldb,
+                        d_beta,
+                        dC,
+                        c_type,
+                        ldc,
 #ifdef HIPBLAS_V2
-                                                compute_type_gemm,
+                        compute_type_gemm,
 #else
-                                                compute_type,
+                        compute_type,
 #endif
-                                                algo));
+                        algo));
         }
         else
         {
@@ -508,15 +560,18 @@ void testing_gemm_ex(const Arguments& arg)
                               hC_gold.data(),
                               ldc);
 
+        // check for float16/bfloat16 input
+        const bool near_check
+            = (getArchMajor() == 11)
+              && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                  || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                  || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{}));
+        const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+
         if(unit_check)
         {
-            // check for float16/bfloat16 input
-            if((getArchMajor() == 11)
-               && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
-                   || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
-                   || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
+            if(near_check)
             {
-                const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
                 near_check_general<To>(M, N, ldc, hC_gold.data(), hC_host.data(), tol);
                 near_check_general<To>(M, N, ldc, hC_gold.data(), hC_device.data(), tol);
             }
@@ -533,6 +588,181 @@ void testing_gemm_ex(const Arguments& arg)
             hipblas_error_device
                 = hipblas_abs(norm_check_general<To>('F', M, N, ldc, hC_gold, hC_device));
         }
+
+#ifdef HIPBLAS_V2
+        // Every solution listed for the problem computes the result of the default one
+        if(unit_check && !FORTRAN)
+        {
+            auto get_solutions = [&](int* solutions, int* count) {
+                return hipblasGemmExGetSolutions(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &h_alpha_Tex,
+                                                 dA,
+                                                 a_type,
+                                                 lda,
+                                                 dB,
+                                                 b_type,
+                                                 ldb,
+                                                 &h_beta_Tex,
+                                                 dC,
+                                                 c_type,
+                                                 ldc,
+                                                 compute_type_gemm,
+                                                 flags,
+                                                 solutions,
+                                                 count);
+            };
+
+            int              solution_count = 0;
+            std::vector<int> solutions;
+            if(get_solutions(nullptr, &solution_count) != HIPBLAS_STATUS_NOT_SUPPORTED)
+            {
+                solutions.resize(solution_count);
+                CHECK_HIPBLAS_ERROR(get_solutions(solutions.data(), &solution_count));
+            }
+
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            for(int i = 0; i < solution_count; i++)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(To) * size_C, hipMemcpyHostToDevice));
+                CHECK_HIPBLAS_ERROR(hipblasGemmExWithSolution(
+                    handle,
+                    transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    &h_alpha_Tex,
+                    dA,
+                    a_type,
+                    lda,
+                    dB,
+                    b_type,
+                    ldb,
+                    &h_beta_Tex,
+                    dC,
+                    c_type,
+                    ldc,
+                    compute_type_gemm,
+                    solutions[i],
+                    hipblasGemmFlags_t(flags | HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX)));
+                CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+
+                if(near_check)
+                    near_check_general<To>(M, N, ldc, hC_gold.data(), hC_host.data(), tol);
+                else
+                    unit_check_general<To>(M, N, ldc, hC_gold, hC_host);
+            }
+        }
+
+        // hipblasGemmExWithD writes the result to D and leaves C as it was
+        if(unit_check && arg.c_noalias_d && !FORTRAN)
+        {
+            host_vector<To> hD(size_D), hD_gold(size_D);
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hD_gold[i + size_t(j) * ldd] = hC_gold[i + size_t(j) * ldc];
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(To) * size_C, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGemmExWithD(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &h_alpha_Tex,
+                                                   dA,
+                                                   a_type,
+                                                   lda,
+                                                   dB,
+                                                   b_type,
+                                                   ldb,
+                                                   &h_beta_Tex,
+                                                   dC,
+                                                   c_type,
+                                                   ldc,
+                                                   dD,
+                                                   c_type,
+                                                   ldd,
+                                                   compute_type_gemm,
+                                                   algo,
+                                                   flags));
+            CHECK_HIP_ERROR(hipMemcpy(hD, dD, sizeof(To) * size_D, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+
+            unit_check_general<To>(M, N, ldc, hC_init, hC_host);
+            if(near_check)
+                near_check_general<To>(M, N, ldd, hD_gold.data(), hD.data(), tol);
+            else
+                unit_check_general<To>(M, N, ldd, hD_gold, hD);
+        }
+
+        // hipblasGemmExWithScale folds the scales of FP8 A and B into alpha. Scales which are
+        // powers of two keep the result exact.
+        if constexpr(std::is_same_v<Ti, hipblas_f8> || std::is_same_v<Ti, hipblas_bf8>)
+        {
+            if(unit_check && !FORTRAN)
+            {
+                float                h_scale[2] = {2.0f, 4.0f};
+                device_vector<float> d_scale(2);
+                CHECK_HIP_ERROR(hipMemcpy(d_scale, h_scale, sizeof(h_scale), hipMemcpyHostToDevice));
+
+                host_vector<To> hC_scaled(hC_init);
+                ref_gemm<Ti, To, Tex>(transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      h_alpha_Tex * h_scale[0] * h_scale[1],
+                                      hA.data(),
+                                      lda,
+                                      hB.data(),
+                                      ldb,
+                                      h_beta_Tex,
+                                      hC_scaled.data(),
+                                      ldc);
+
+                for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+                {
+                    const bool   host    = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+                    const float* scale_A = host ? h_scale : (float*)d_scale;
+
+                    CHECK_HIP_ERROR(
+                        hipMemcpy(dC, hC_init, sizeof(To) * size_C, hipMemcpyHostToDevice));
+                    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
+                    CHECK_HIPBLAS_ERROR(hipblasGemmExWithScale(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               host ? &h_alpha_Tex : d_alpha,
+                                                               dA,
+                                                               a_type,
+                                                               lda,
+                                                               scale_A,
+                                                               dB,
+                                                               b_type,
+                                                               ldb,
+                                                               scale_A + 1,
+                                                               host ? &h_beta_Tex : d_beta,
+                                                               dC,
+                                                               c_type,
+                                                               ldc,
+                                                               compute_type_gemm,
+                                                               algo));
+                    CHECK_HIP_ERROR(
+                        hipMemcpy(hC_host, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+                    unit_check_general<To>(M, N, ldc, hC_scaled, hC_host);
+                }
+            }
+        }
+#endif
     }
 
     if(timing)
@@ -547,31 +777,88 @@ void testing_gemm_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
+#ifdef HIPBLAS_V2
+            // --solution_index pins a solution listed by hipblasGemmExGetSolutions
+            if(arg.solution_index != 0 && !FORTRAN)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasGemmExWithSolution(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              &h_alpha_Tex,
+                                                              dA,
+                                                              a_type,
+                                                              lda,
+                                                              dB,
+                                                              b_type,
+                                                              ldb,
+                                                              &h_beta_Tex,
+                                                              dC,
+                                                              c_type,
+                                                              ldc,
+                                                              compute_type_gemm,
+                                                              arg.solution_index,
+                                                              flags));
+                continue;
+            }
+
+            if(arg.c_noalias_d && !FORTRAN)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasGemmExWithD(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       &h_alpha_Tex,
+                                                       dA,
+                                                       a_type,
+                                                       lda,
+                                                       dB,
+                                                       b_type,
+                                                       ldb,
+                                                       &h_beta_Tex,
+                                                       dC,
+                                                       c_type,
+                                                       ldc,
+                                                       dD,
+                                                       c_type,
+                                                       ldd,
+                                                       compute_type_gemm,
+                                                       algo,
+                                                       flags));
+                continue;
+            }
+#endif
+
             if(!arg.with_flags)
             {
-                CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
-                                                    transA,
-                                                    transB,
-                                                    M,
-                                                    N,
-                                                    K,
-                                                    &h_alpha_Tex,
-                                                    dA,
-                                                    a_type,
-                                                    lda,
-                                                    dB,
-                                                    b_type,
-                                                    ldb,
-                                                    &h_beta_Tex,
-                                                    dC,
-                                                    c_type,
-                                                    ldc,
+                DAPI_CHECK(hipblasGemmExFn,
+                           (handle,
+                            transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            &h_alpha_Tex,
+                            dA,
+                            a_type,
+                            lda,
+                            dB,
+                            b_type,
+                            ldb,
+                            &h_beta_Tex,
+                            dC,
+                            c_type,
+                            ldc,
 #ifdef HIPBLAS_V2
-                                                    compute_type_gemm,
+                            compute_type_gemm,
 #else
-                                                    compute_type,
+                            compute_type,
 #endif
-                                                    algo));
+                            algo));
             }
             else
             {
@@ -0,0 +1,379 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// hipblasGemmGroupedEx takes the HIPBLAS_V2 types only
+#ifdef HIPBLAS_V2
+
+using hipblasGemmGroupedExModel = ArgumentModel<e_a_type,
+                                                e_c_type,
+                                                e_compute_type,
+                                                e_transA,
+                                                e_transB,
+                                                e_alpha,
+                                                e_beta,
+                                                e_group_count>;
+
+inline void testname_gemm_grouped_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedExModel{}.test_name(arg, name);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_ex_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = arg.a_type;
+    hipDataType          bType       = arg.b_type;
+    hipDataType          cType       = arg.c_type;
+    hipblasComputeType_t computeType = arg.compute_type_gemm;
+
+    const int groupCount  = 2;
+    int       M[]         = {101, 50};
+    int       N[]         = {100, 60};
+    int       K[]         = {102, 70};
+    int       lda[]       = {103, 71};
+    int       ldb[]       = {104, 72};
+    int       ldc[]       = {105, 73};
+    int       groupSize[] = {2, 1};
+
+    hipblasOperation_t transA[] = {HIPBLAS_OP_N, HIPBLAS_OP_T};
+    hipblasOperation_t transB[] = {HIPBLAS_OP_N, HIPBLAS_OP_N};
+
+    // the problems of both groups fit in buffers of the size of the first group
+    device_batch_vector<Ti> dA(N[0] * lda[0], 1, 3);
+    device_batch_vector<Ti> dB(N[0] * ldb[0], 1, 3);
+    device_batch_vector<To> dC(N[0] * ldc[0], 1, 3);
+
+    Tex alpha[] = {Tex(1), Tex(1)};
+    Tex beta[]  = {Tex(2), Tex(2)};
+
+    const void* const* A = (const void* const*)dA.ptr_on_device();
+    const void* const* B = (const void* const*)dB.ptr_on_device();
+    void* const*       C = (void* const*)dC.ptr_on_device();
+
+    auto grouped = [&](hipblasHandle_t           h,
+                       const hipblasOperation_t* tA,
+                       const int*                lda_,
+                       const void* const*        A_,
+                       int                       count) {
+        return hipblasGemmGroupedEx(h,
+                                    tA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    alpha,
+                                    A_,
+                                    aType,
+                                    lda_,
+                                    B,
+                                    bType,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    cType,
+                                    ldc,
+                                    count,
+                                    groupSize,
+                                    computeType);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    EXPECT_HIPBLAS_STATUS(grouped(nullptr, transA, lda, A, groupCount),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(grouped(handle, transA, lda, A, -1), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // quick return with no groups before the arrays are read
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGemmGroupedEx(handle,
+                             nullptr,
+                             nullptr,
+                             nullptr,
+                             nullptr,
+                             nullptr,
+                             nullptr,
+                             nullptr,
+                             aType,
+                             nullptr,
+                             nullptr,
+                             bType,
+                             nullptr,
+                             nullptr,
+                             nullptr,
+                             cType,
+                             nullptr,
+                             0,
+                             nullptr,
+                             computeType),
+        HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS(grouped(handle, nullptr, lda, A, groupCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(grouped(handle, transA, nullptr, A, groupCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(grouped(handle, transA, lda, nullptr, groupCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the second group is checked before the first one is launched
+    hipblasOperation_t bad_transA[] = {HIPBLAS_OP_N, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL};
+    EXPECT_HIPBLAS_STATUS(grouped(handle, bad_transA, lda, A, groupCount),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    int bad_lda[] = {103, 69};
+    EXPECT_HIPBLAS_STATUS(grouped(handle, transA, bad_lda, A, groupCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int group_count = arg.group_count;
+
+    hipDataType          a_type            = arg.a_type;
+    hipDataType          b_type            = arg.b_type;
+    hipDataType          c_type            = arg.c_type;
+    hipblasComputeType_t compute_type_gemm = arg.compute_type_gemm;
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    // check here to prevent undefined memory allocation error
+    if(group_count < 0 || group_count > int(std::size(arg.group_M)))
+        return;
+
+    std::vector<hipblasOperation_t> transA_array(group_count, transA);
+    std::vector<hipblasOperation_t> transB_array(group_count, transB);
+    std::vector<int>                lda(group_count), ldb(group_count), ldc(group_count);
+
+    // alpha and beta swap between the groups, so that each group must use its own scalars
+    std::vector<Tex> h_alpha(group_count), h_beta(group_count);
+
+    int    problem_count = 0;
+    size_t size_A = 0, size_B = 0, size_C = 0;
+    double gflops = 0, gbytes = 0;
+    for(int g = 0; g < group_count; g++)
+    {
+        int M = arg.group_M[g];
+        int N = arg.group_N[g];
+        int K = arg.group_K[g];
+        if(M < 0 || N < 0 || K < 0 || arg.group_size[g] < 0)
+            return;
+
+        int A_row = transA == HIPBLAS_OP_N ? M : K;
+        int A_col = transA == HIPBLAS_OP_N ? K : M;
+        int B_row = transB == HIPBLAS_OP_N ? K : N;
+        int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+        lda[g]     = std::max(1, A_row);
+        ldb[g]     = std::max(1, B_row);
+        ldc[g]     = std::max(1, M);
+        h_alpha[g] = g % 2 ? h_beta_Tex : h_alpha_Tex;
+        h_beta[g]  = g % 2 ? h_alpha_Tex : h_beta_Tex;
+
+        size_A = std::max(size_A, size_t(lda[g]) * A_col);
+        size_B = std::max(size_B, size_t(ldb[g]) * B_col);
+        size_C = std::max(size_C, size_t(ldc[g]) * N);
+
+        problem_count += arg.group_size[g];
+        gflops += arg.group_size[g] * gemm_gflop_count<Tex>(M, N, K);
+        gbytes += arg.group_size[g] * gemm_gbyte_count<Tex>(M, N, K);
+    }
+
+    // the problems of all groups are the batch of pointers in group order, each in a buffer of
+    // the size of the largest problem
+    device_batch_vector<Ti> dA(size_A, 1, problem_count);
+    device_batch_vector<Ti> dB(size_B, 1, problem_count);
+    device_batch_vector<To> dC(size_C, 1, problem_count);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+
+    host_batch_vector<Ti> hA(size_A, 1, problem_count);
+    host_batch_vector<Ti> hB(size_B, 1, problem_count);
+    host_batch_vector<To> hC_host(size_C, 1, problem_count);
+    host_batch_vector<To> hC_device(size_C, 1, problem_count);
+    host_batch_vector<To> hC_gold(size_C, 1, problem_count);
+
+    device_vector<Tex> d_alpha(group_count), d_beta(group_count);
+    CHECK_HIP_ERROR(d_alpha.memcheck());
+    CHECK_HIP_ERROR(d_beta.memcheck());
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_vector(hA, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hB, arg, hipblas_client_alpha_sets_nan);
+    hipblas_init_vector(hC_host, arg, hipblas_client_beta_sets_nan);
+
+    hC_device.copy_from(hC_host);
+    hC_gold.copy_from(hC_host);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(
+        d_alpha, h_alpha.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_beta, h_beta.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+
+    auto grouped = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasGemmGroupedEx(handle,
+                                    transA_array.data(),
+                                    transB_array.data(),
+                                    arg.group_M,
+                                    arg.group_N,
+                                    arg.group_K,
+                                    alpha,
+                                    (const void* const*)dA.ptr_on_device(),
+                                    a_type,
+                                    lda.data(),
+                                    (const void* const*)dB.ptr_on_device(),
+                                    b_type,
+                                    ldb.data(),
+                                    beta,
+                                    (void* const*)dC.ptr_on_device(),
+                                    c_type,
+                                    ldc.data(),
+                                    group_count,
+                                    arg.group_size,
+                                    compute_type_gemm);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS, alpha and beta are arrays of one scalar per group in both pointer modes
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(grouped(h_alpha.data(), h_beta.data()));
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(grouped(d_alpha, d_beta));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        // check for float16/bfloat16 input
+        const bool near_check
+            = (getArchMajor() == 11)
+              && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                  || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                  || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{}));
+
+        // CPU BLAS
+        for(int g = 0, p = 0; g < group_count; g++)
+        {
+            int M = arg.group_M[g];
+            int N = arg.group_N[g];
+            int K = arg.group_K[g];
+            for(int b = 0; b < arg.group_size[g]; b++, p++)
+            {
+                ref_gemm<Ti, To, Tex>(transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      h_alpha[g],
+                                      hA[p],
+                                      lda[g],
+                                      hB[p],
+                                      ldb[g],
+                                      h_beta[g],
+                                      hC_gold[p],
+                                      ldc[g]);
+
+                if(unit_check)
+                {
+                    double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+                    if(near_check)
+                    {
+                        near_check_general<To>(M, N, ldc[g], hC_gold[p], hC_host[p], tol);
+                        near_check_general<To>(M, N, ldc[g], hC_gold[p], hC_device[p], tol);
+                    }
+                    else
+                    {
+                        unit_check_general<To>(M, N, ldc[g], hC_gold[p], hC_host[p]);
+                        unit_check_general<To>(M, N, ldc[g], hC_gold[p], hC_device[p]);
+                    }
+                }
+
+                if(norm_check)
+                {
+                    hipblas_error_host = std::max(
+                        hipblas_error_host,
+                        norm_check_general<To>('F', M, N, ldc[g], hC_gold[p], hC_host[p]));
+                    hipblas_error_device = std::max(
+                        hipblas_error_device,
+                        norm_check_general<To>('F', M, N, ldc[g], hC_gold[p], hC_device[p]));
+                }
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(grouped(d_alpha, d_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmGroupedExModel{}.log_args<To>(std::cout,
+                                                 arg,
+                                                 gpu_time_used,
+                                                 gflops,
+                                                 gbytes,
+                                                 hipblas_error_host,
+                                                 hipblas_error_device);
+    }
+}
+
+#endif
@@ -46,10 +46,12 @@ using hipblasGemmStridedBatchedExModel = ArgumentModel<e_a_type,
                                                        e_ldb,
                                                        e_beta,
                                                        e_ldc,
+                                                       e_ldd,
                                                        e_stride_scale,
                                                        e_batch_count,
                                                        e_with_flags,
-                                                       e_flags>;
+                                                       e_flags,
+                                                       e_c_noalias_d>;
 // strides not logged
 
 inline void testname_gemm_strided_batched_ex(const Arguments& arg, std::string& name)
@@ -309,6 +311,53 @@ void testing_gemm_strided_batched_ex_bad_arg(const Arguments& arg)
 
         // clang-format on
     }
+
+#ifdef HIPBLAS_V2
+    // hipblasGemmStridedBatchedExWithD checks ldd and the type of D as well
+    device_vector<To> dD(strideC * batch_count);
+
+    auto hipblasGemmStridedBatchedExWithDFn
+        = [&](hipblasHandle_t h, int64_t ldd, hipDataType dType) {
+              return hipblasGemmStridedBatchedExWithD(h,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      dA,
+                                                      aType,
+                                                      lda,
+                                                      strideA,
+                                                      dB,
+                                                      bType,
+                                                      ldb,
+                                                      strideB,
+                                                      &h_beta,
+                                                      dC,
+                                                      cType,
+                                                      ldc,
+                                                      strideC,
+                                                      dD,
+                                                      dType,
+                                                      ldd,
+                                                      strideC,
+                                                      batch_count,
+                                                      computeTypeGemm,
+                                                      algo,
+                                                      flags);
+          };
+
+    hipDataType otherType = cType == HIP_R_16F ? HIP_R_32F : HIP_R_16F;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithDFn(nullptr, ldc, cType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithDFn(handle, M - 1, cType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedExWithDFn(handle, ldc, otherType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#endif
 }
 
 template <typename Ti, typename To = Ti, typename Tex = To>
@@ -316,7 +365,10 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
 {
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGemmStridedBatchedExFn
-        = FORTRAN ? hipblasGemmStridedBatchedExFortran : hipblasGemmStridedBatchedExFortran;
+        = FORTRAN ? hipblasGemmStridedBatchedExFortran : hipblasGemmStridedBatchedEx;
+    auto hipblasGemmStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                                ? hipblasGemmStridedBatchedEx_64Fortran
+                                                : hipblasGemmStridedBatchedEx_64;
     auto hipblasGemmStridedBatchedExWithFlagsFn = FORTRAN
                                                       ? hipblasGemmStridedBatchedExWithFlagsFortran
                                                       : hipblasGemmStridedBatchedExWithFlags;
@@ -331,6 +383,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     int                lda    = arg.lda;
     int                ldb    = arg.ldb;
     int                ldc    = arg.ldc;
+    int                ldd    = arg.ldd;
 
     hipblasDatatype_t    a_type            = arg.a_type;
     hipblasDatatype_t    b_type            = arg.b_type;
@@ -354,7 +407,8 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     int B_col = transB == HIPBLAS_OP_N ? N : K;
 
     // check here to prevent undefined memory allocation error
-    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0
+       || (arg.c_noalias_d && ldd < M))
     {
         return;
     }
@@ -363,13 +417,22 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     const size_t stride_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
     const size_t stride_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
 
+    // with c_noalias_d hipblasGemmStridedBatchedExWithD writes the result to D instead of C, at a
+    // stride of at least stride_d scaled by stride_scale, so that D is not laid out like C
+    const size_t stride_D
+        = arg.c_noalias_d
+              ? size_t(std::max(arg.stride_d, hipblasStride(ldd) * N) * arg.stride_scale)
+              : 0;
+
     const size_t size_A = stride_A * batch_count;
     const size_t size_B = stride_B * batch_count;
     const size_t size_C = stride_C * batch_count;
+    const size_t size_D = stride_D * batch_count;
 
     device_vector<Ti> dA(size_A);
     device_vector<Ti> dB(size_B);
     device_vector<To> dC(size_C);
+    device_vector<To> dD(size_D);
 
     device_vector<Tex> d_alpha(1);
     device_vector<Tex> d_beta(1);
@@ -398,6 +461,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     hipblas_init_matrix(
         hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
     hC_gold = hC_device = hC_host;
+    host_vector<To> hC_init(hC_host);
 
     // copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
@@ -413,33 +477,34 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
         if(!arg.with_flags)
         {
-            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              K,
-                                                              &h_alpha_Tex,
-                                                              dA,
-                                                              a_type,
-                                                              lda,
-                                                              stride_A,
-                                                              dB,
-                                                              b_type,
-                                                              ldb,
-                                                              stride_B,
-                                                              &h_beta_Tex,
-                                                              dC,
-                                                              c_type,
-                                                              ldc,
-                                                              stride_C,
-                                                              batch_count,
+            DAPI_CHECK(hipblasGemmStridedBatchedExFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        &h_alpha_Tex,
+                        dA,
+                        a_type,
+                        lda,
+                        stride_A,
+                        dB,
+                        b_type,
+                        ldb,
+                        stride_B,
+                        &h_beta_Tex,
+                        dC,
+                        c_type,
+                        ldc,
+                        stride_C,
+                        batch_count,
 #ifdef HIPBLAS_V2
-                                                              compute_type_gemm,
+                        compute_type_gemm,
 #else
-                                                              compute_type,
+                        compute_type,
 #endif
-                                                              algo));
+                        algo));
         }
         else
         {
@@ -479,33 +544,34 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         if(!arg.with_flags)
         {
-            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExFn(handle,
-                                                              transA,
-                                                              transB,
-                                                              M,
-                                                              N,
-                                                              K,
-                                                              d_alpha,
-                                                              dA,
-                                                              a_type,
-                                                              lda,
-                                                              stride_A,
-                                                              dB,
-                                                              b_type,
-                                                              ldb,
-                                                              stride_B,
-                                                              d_beta,
-                                                              dC,
-                                                              c_type,
-                                                              ldc,
-                                                              stride_C,
-                                                              batch_count,
+            DAPI_CHECK(hipblasGemmStridedBatchedExFn,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        d_alpha,
+                        dA,
+                        a_type,
+                        lda,
+                        stride_A,
+                        dB,
+                        b_type,
+                        ldb,
+                        stride_B,
+                        d_beta,
+                        dC,
+                        c_type,
+                        ldc,
+                        stride_C,
+                        batch_count,
 #ifdef HIPBLAS_V2
-                                                              compute_type_gemm,
+                        compute_type_gemm,
 #else
-                                                              compute_type,
+                        compute_type,
 #endif
-                                                              algo));
+                        algo));
         }
         else
         {
@@ -559,15 +625,18 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                                   ldc);
         }
 
+        // check for float16/bfloat16 input
+        const bool near_check
+            = (getArchMajor() == 11)
+              && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                  || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                  || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{}));
+        const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+
         if(unit_check)
         {
-            // check for float16/bfloat16 input
-            if((getArchMajor() == 11)
-               && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
-                   || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
-                   || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
+            if(near_check)
             {
-                const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
                 near_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_host, tol);
                 near_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device, tol);
             }
@@ -584,6 +653,137 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
             hipblas_error_device
                 = norm_check_general<To>('F', M, N, ldc, stride_C, hC_gold, hC_device, batch_count);
         }
+
+#ifdef HIPBLAS_V2
+        // Every solution listed for the problem computes the result of the default one
+        if(unit_check && !FORTRAN)
+        {
+            auto get_solutions = [&](int* solutions, int* count) {
+                return hipblasGemmStridedBatchedExGetSolutions(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               &h_alpha_Tex,
+                                                               dA,
+                                                               a_type,
+                                                               lda,
+                                                               stride_A,
+                                                               dB,
+                                                               b_type,
+                                                               ldb,
+                                                               stride_B,
+                                                               &h_beta_Tex,
+                                                               dC,
+                                                               c_type,
+                                                               ldc,
+                                                               stride_C,
+                                                               batch_count,
+                                                               compute_type_gemm,
+                                                               flags,
+                                                               solutions,
+                                                               count);
+            };
+
+            int              solution_count = 0;
+            std::vector<int> solutions;
+            if(get_solutions(nullptr, &solution_count) != HIPBLAS_STATUS_NOT_SUPPORTED)
+            {
+                solutions.resize(solution_count);
+                CHECK_HIPBLAS_ERROR(get_solutions(solutions.data(), &solution_count));
+            }
+
+            auto check_flags = hipblasGemmFlags_t(flags | HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX);
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            for(int i = 0; i < solution_count; i++)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(To) * size_C, hipMemcpyHostToDevice));
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmStridedBatchedExWithSolution(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            &h_alpha_Tex,
+                                                            dA,
+                                                            a_type,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            b_type,
+                                                            ldb,
+                                                            stride_B,
+                                                            &h_beta_Tex,
+                                                            dC,
+                                                            c_type,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count,
+                                                            compute_type_gemm,
+                                                            solutions[i],
+                                                            check_flags));
+                CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+
+                if(near_check)
+                    near_check_general<To>(
+                        M, N, batch_count, ldc, stride_C, hC_gold, hC_host, tol);
+                else
+                    unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+            }
+        }
+
+        // hipblasGemmStridedBatchedExWithD writes the result to D and leaves C as it was
+        if(unit_check && arg.c_noalias_d && !FORTRAN)
+        {
+            host_vector<To> hD(size_D), hD_gold(size_D);
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < M; i++)
+                        hD_gold[b * stride_D + i + size_t(j) * ldd]
+                            = hC_gold[b * stride_C + i + size_t(j) * ldc];
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(To) * size_C, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExWithD(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 &h_alpha_Tex,
+                                                                 dA,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_A,
+                                                                 dB,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_B,
+                                                                 &h_beta_Tex,
+                                                                 dC,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_C,
+                                                                 dD,
+                                                                 c_type,
+                                                                 ldd,
+                                                                 stride_D,
+                                                                 batch_count,
+                                                                 compute_type_gemm,
+                                                                 algo,
+                                                                 flags));
+            CHECK_HIP_ERROR(hipMemcpy(hD, dD, sizeof(To) * size_D, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+
+            unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_init, hC_host);
+            if(near_check)
+                near_check_general<To>(M, N, batch_count, ldd, stride_D, hD_gold, hD, tol);
+            else
+                unit_check_general<To>(M, N, batch_count, ldd, stride_D, hD_gold, hD);
+        }
+#endif
     }
 
     if(timing)
@@ -598,35 +798,101 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
+#ifdef HIPBLAS_V2
+            // --solution_index pins a solution listed by hipblasGemmStridedBatchedExGetSolutions
+            if(arg.solution_index != 0 && !FORTRAN)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExWithSolution(handle,
+                                                                            transA,
+                                                                            transB,
+                                                                            M,
+                                                                            N,
+                                                                            K,
+                                                                            &h_alpha_Tex,
+                                                                            dA,
+                                                                            a_type,
+                                                                            lda,
+                                                                            stride_A,
+                                                                            dB,
+                                                                            b_type,
+                                                                            ldb,
+                                                                            stride_B,
+                                                                            &h_beta_Tex,
+                                                                            dC,
+                                                                            c_type,
+                                                                            ldc,
+                                                                            stride_C,
+                                                                            batch_count,
+                                                                            compute_type_gemm,
+                                                                            arg.solution_index,
+                                                                            flags));
+                continue;
+            }
+
+            if(arg.c_noalias_d && !FORTRAN)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExWithD(handle,
+                                                                     transA,
+                                                                     transB,
+                                                                     M,
+                                                                     N,
+                                                                     K,
+                                                                     &h_alpha_Tex,
+                                                                     dA,
+                                                                     a_type,
+                                                                     lda,
+                                                                     stride_A,
+                                                                     dB,
+                                                                     b_type,
+                                                                     ldb,
+                                                                     stride_B,
+                                                                     &h_beta_Tex,
+                                                                     dC,
+                                                                     c_type,
+                                                                     ldc,
+                                                                     stride_C,
+                                                                     dD,
+                                                                     c_type,
+                                                                     ldd,
+                                                                     stride_D,
+                                                                     batch_count,
+                                                                     compute_type_gemm,
+                                                                     algo,
+                                                                     flags));
+                continue;
+            }
+#endif
+
             if(!arg.with_flags)
             {
-                CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExFn(handle,
-                                                                  transA,
-                                                                  transB,
-                                                                  M,
-                                                                  N,
-                                                                  K,
-                                                                  &h_alpha_Tex,
-                                                                  dA,
-                                                                  a_type,
-                                                                  lda,
-                                                                  stride_A,
-                                                                  dB,
-                                                                  b_type,
-                                                                  ldb,
-                                                                  stride_B,
-                                                                  &h_beta_Tex,
-                                                                  dC,
-                                                                  c_type,
-                                                                  ldc,
-                                                                  stride_C,
-                                                                  batch_count,
+                DAPI_CHECK(hipblasGemmStridedBatchedExFn,
+                           (handle,
+                            transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            &h_alpha_Tex,
+                            dA,
+                            a_type,
+                            lda,
+                            stride_A,
+                            dB,
+                            b_type,
+                            ldb,
+                            stride_B,
+                            &h_beta_Tex,
+                            dC,
+                            c_type,
+                            ldc,
+                            stride_C,
+                            batch_count,
 #ifdef HIPBLAS_V2
-                                                                  compute_type_gemm,
+                            compute_type_gemm,
 #else
-                                                                  compute_type,
+                            compute_type,
 #endif
-                                                                  algo));
+                            algo));
             }
             else
             {
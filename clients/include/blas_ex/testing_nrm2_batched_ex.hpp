@@ -42,6 +42,8 @@ void testing_nrm2_batched_ex_bad_arg(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasNrm2BatchedExFn = FORTRAN ? hipblasNrm2BatchedExFortran : hipblasNrm2BatchedEx;
+    auto hipblasNrm2BatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasNrm2BatchedEx_64Fortran : hipblasNrm2BatchedEx_64;
 
     int64_t N           = 100;
     int64_t incx        = 1;
@@ -61,21 +63,20 @@ void testing_nrm2_batched_ex_bad_arg(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(
-            hipblasNrm2BatchedExFn(
-                nullptr, N, dx, xType, incx, batch_count, d_res, resultType, executionType),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasNrm2BatchedExFn,
+                    (nullptr, N, dx, xType, incx, batch_count, d_res, resultType, executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasNrm2BatchedExFn(
-                    handle, N, nullptr, xType, incx, batch_count, d_res, resultType, executionType),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasNrm2BatchedExFn(
-                    handle, N, dx, xType, incx, batch_count, nullptr, resultType, executionType),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasNrm2BatchedExFn,
+                (handle, N, nullptr, xType, incx, batch_count, d_res, resultType, executionType));
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasNrm2BatchedExFn,
+                (handle, N, dx, xType, incx, batch_count, nullptr, resultType, executionType));
         }
     }
 }
@@ -85,6 +86,8 @@ void testing_nrm2_batched_ex(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasNrm2BatchedExFn = FORTRAN ? hipblasNrm2BatchedExFortran : hipblasNrm2BatchedEx;
+    auto hipblasNrm2BatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasNrm2BatchedEx_64Fortran : hipblasNrm2BatchedEx_64;
 
     int N           = arg.N;
     int incx        = arg.incx;
@@ -108,15 +111,16 @@ void testing_nrm2_batched_ex(const Arguments& arg)
                                   hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2BatchedExFn(handle,
-                                                   N,
-                                                   nullptr,
-                                                   xType,
-                                                   incx,
-                                                   batch_count,
-                                                   d_hipblas_result_0,
-                                                   resultType,
-                                                   executionType));
+        DAPI_CHECK(hipblasNrm2BatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    xType,
+                    incx,
+                    batch_count,
+                    d_hipblas_result_0,
+                    resultType,
+                    executionType));
 
         if(batch_count > 0)
         {
@@ -151,26 +155,28 @@ void testing_nrm2_batched_ex(const Arguments& arg)
     {
         // hipblasNrm2 accept both dev/host pointer for the scalar
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2BatchedExFn(handle,
-                                                   N,
-                                                   dx.ptr_on_device(),
-                                                   xType,
-                                                   incx,
-                                                   batch_count,
-                                                   d_hipblas_result,
-                                                   resultType,
-                                                   executionType));
+        DAPI_CHECK(hipblasNrm2BatchedExFn,
+                   (handle,
+                    N,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    batch_count,
+                    d_hipblas_result,
+                    resultType,
+                    executionType));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2BatchedExFn(handle,
-                                                   N,
-                                                   dx.ptr_on_device(),
-                                                   xType,
-                                                   incx,
-                                                   batch_count,
-                                                   h_hipblas_result_host,
-                                                   resultType,
-                                                   executionType));
+        DAPI_CHECK(hipblasNrm2BatchedExFn,
+                   (handle,
+                    N,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    batch_count,
+                    h_hipblas_result_host,
+                    resultType,
+                    executionType));
 
         CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
                                   d_hipblas_result,
@@ -230,15 +236,16 @@ void testing_nrm2_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasNrm2BatchedExFn(handle,
-                                                       N,
-                                                       dx.ptr_on_device(),
-                                                       xType,
-                                                       incx,
-                                                       batch_count,
-                                                       d_hipblas_result,
-                                                       resultType,
-                                                       executionType));
+            DAPI_CHECK(hipblasNrm2BatchedExFn,
+                       (handle,
+                        N,
+                        dx.ptr_on_device(),
+                        xType,
+                        incx,
+                        batch_count,
+                        d_hipblas_result,
+                        resultType,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
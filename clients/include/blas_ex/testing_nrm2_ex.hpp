@@ -39,8 +39,9 @@ inline void testname_nrm2_ex(const Arguments& arg, std::string& name)
 template <typename Tx, typename Tr = Tx, typename Tex = Tr>
 void testing_nrm2_ex_bad_arg(const Arguments& arg)
 {
-    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasNrm2ExFn = FORTRAN ? hipblasNrm2ExFortran : hipblasNrm2Ex;
+    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasNrm2ExFn    = FORTRAN ? hipblasNrm2ExFortran : hipblasNrm2Ex;
+    auto hipblasNrm2ExFn_64 = arg.api == FORTRAN_64 ? hipblasNrm2Ex_64Fortran : hipblasNrm2Ex_64;
 
     int64_t N    = 100;
     int64_t incx = 1;
@@ -59,18 +60,18 @@ void testing_nrm2_ex_bad_arg(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(
-            hipblasNrm2ExFn(nullptr, N, dx, xType, incx, d_res, resultType, executionType),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasNrm2ExFn,
+                    (nullptr, N, dx, xType, incx, d_res, resultType, executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasNrm2ExFn(handle, N, nullptr, xType, incx, d_res, resultType, executionType),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasNrm2ExFn(handle, N, dx, xType, incx, nullptr, resultType, executionType),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasNrm2ExFn,
+                        (handle, N, nullptr, xType, incx, d_res, resultType, executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasNrm2ExFn,
+                        (handle, N, dx, xType, incx, nullptr, resultType, executionType));
         }
     }
 }
@@ -78,8 +79,9 @@ void testing_nrm2_ex_bad_arg(const Arguments& arg)
 template <typename Tx, typename Tr = Tx, typename Tex = Tr>
 void testing_nrm2_ex(const Arguments& arg)
 {
-    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasNrm2ExFn = FORTRAN ? hipblasNrm2ExFortran : hipblasNrm2Ex;
+    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasNrm2ExFn    = FORTRAN ? hipblasNrm2ExFortran : hipblasNrm2Ex;
+    auto hipblasNrm2ExFn_64 = arg.api == FORTRAN_64 ? hipblasNrm2Ex_64Fortran : hipblasNrm2Ex_64;
 
     int N    = arg.N;
     int incx = arg.incx;
@@ -100,8 +102,9 @@ void testing_nrm2_ex(const Arguments& arg)
             hipMemcpy(d_hipblas_result_0, h_hipblas_result_0, sizeof(Tr), hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2ExFn(
-            handle, N, nullptr, xType, incx, d_hipblas_result_0, resultType, executionType));
+        DAPI_CHECK(
+            hipblasNrm2ExFn,
+            (handle, N, nullptr, xType, incx, d_hipblas_result_0, resultType, executionType));
 
         host_vector<Tr> cpu_0(1);
         host_vector<Tr> gpu_0(1);
@@ -132,12 +135,12 @@ void testing_nrm2_ex(const Arguments& arg)
     {
         // hipblasNrm2 accept both dev/host pointer for the scalar
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2ExFn(
-            handle, N, dx, xType, incx, d_hipblas_result, resultType, executionType));
+        DAPI_CHECK(hipblasNrm2ExFn,
+                   (handle, N, dx, xType, incx, d_hipblas_result, resultType, executionType));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2ExFn(
-            handle, N, dx, xType, incx, &hipblas_result_host, resultType, executionType));
+        DAPI_CHECK(hipblasNrm2ExFn,
+                   (handle, N, dx, xType, incx, &hipblas_result_host, resultType, executionType));
 
         CHECK_HIP_ERROR(
             hipMemcpy(&hipblas_result_device, d_hipblas_result, sizeof(Tr), hipMemcpyDeviceToHost));
@@ -183,8 +186,8 @@ void testing_nrm2_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasNrm2ExFn(
-                handle, N, dx, xType, incx, d_hipblas_result, resultType, executionType));
+            DAPI_CHECK(hipblasNrm2ExFn,
+                       (handle, N, dx, xType, incx, d_hipblas_result, resultType, executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -43,6 +43,9 @@ void testing_nrm2_strided_batched_ex_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasNrm2StridedBatchedExFn
         = FORTRAN ? hipblasNrm2StridedBatchedExFortran : hipblasNrm2StridedBatchedEx;
+    auto hipblasNrm2StridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                                ? hipblasNrm2StridedBatchedEx_64Fortran
+                                                : hipblasNrm2StridedBatchedEx_64;
 
     int64_t N           = 100;
     int64_t incx        = 1;
@@ -64,42 +67,37 @@ void testing_nrm2_strided_batched_ex_bad_arg(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(hipblasNrm2StridedBatchedExFn(nullptr,
-                                                            N,
-                                                            dx,
-                                                            xType,
-                                                            incx,
-                                                            stridex,
-                                                            batch_count,
-                                                            d_res,
-                                                            resultType,
-                                                            executionType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasNrm2StridedBatchedExFn,
+            (nullptr, N, dx, xType, incx, stridex, batch_count, d_res, resultType, executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasNrm2StridedBatchedExFn(handle,
-                                                                N,
-                                                                nullptr,
-                                                                xType,
-                                                                incx,
-                                                                stridex,
-                                                                batch_count,
-                                                                d_res,
-                                                                resultType,
-                                                                executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasNrm2StridedBatchedExFn(handle,
-                                                                N,
-                                                                dx,
-                                                                xType,
-                                                                incx,
-                                                                stridex,
-                                                                batch_count,
-                                                                nullptr,
-                                                                resultType,
-                                                                executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasNrm2StridedBatchedExFn,
+                        (handle,
+                         N,
+                         nullptr,
+                         xType,
+                         incx,
+                         stridex,
+                         batch_count,
+                         d_res,
+                         resultType,
+                         executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasNrm2StridedBatchedExFn,
+                        (handle,
+                         N,
+                         dx,
+                         xType,
+                         incx,
+                         stridex,
+                         batch_count,
+                         nullptr,
+                         resultType,
+                         executionType));
         }
     }
 }
@@ -110,6 +108,9 @@ void testing_nrm2_strided_batched_ex(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasNrm2StridedBatchedExFn
         = FORTRAN ? hipblasNrm2StridedBatchedExFortran : hipblasNrm2StridedBatchedEx;
+    auto hipblasNrm2StridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                                ? hipblasNrm2StridedBatchedEx_64Fortran
+                                                : hipblasNrm2StridedBatchedEx_64;
 
     int    N            = arg.N;
     int    incx         = arg.incx;
@@ -137,16 +138,17 @@ void testing_nrm2_strided_batched_ex(const Arguments& arg)
                                   hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2StridedBatchedExFn(handle,
-                                                          N,
-                                                          nullptr,
-                                                          xType,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count,
-                                                          d_hipblas_result_0,
-                                                          resultType,
-                                                          executionType));
+        DAPI_CHECK(hipblasNrm2StridedBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    xType,
+                    incx,
+                    stridex,
+                    batch_count,
+                    d_hipblas_result_0,
+                    resultType,
+                    executionType));
 
         if(batch_count > 0)
         {
@@ -182,28 +184,30 @@ void testing_nrm2_strided_batched_ex(const Arguments& arg)
     {
         // hipblasNrm2 accept both dev/host pointer for the scalar
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2StridedBatchedExFn(handle,
-                                                          N,
-                                                          dx,
-                                                          xType,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count,
-                                                          d_hipblas_result,
-                                                          resultType,
-                                                          executionType));
+        DAPI_CHECK(hipblasNrm2StridedBatchedExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    stridex,
+                    batch_count,
+                    d_hipblas_result,
+                    resultType,
+                    executionType));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasNrm2StridedBatchedExFn(handle,
-                                                          N,
-                                                          dx,
-                                                          xType,
-                                                          incx,
-                                                          stridex,
-                                                          batch_count,
-                                                          h_hipblas_result_host,
-                                                          resultType,
-                                                          executionType));
+        DAPI_CHECK(hipblasNrm2StridedBatchedExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    stridex,
+                    batch_count,
+                    h_hipblas_result_host,
+                    resultType,
+                    executionType));
 
         CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
                                   d_hipblas_result,
@@ -263,16 +267,17 @@ void testing_nrm2_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasNrm2StridedBatchedExFn(handle,
-                                                              N,
-                                                              dx,
-                                                              xType,
-                                                              incx,
-                                                              stridex,
-                                                              batch_count,
-                                                              d_hipblas_result,
-                                                              resultType,
-                                                              executionType));
+            DAPI_CHECK(hipblasNrm2StridedBatchedExFn,
+                       (handle,
+                        N,
+                        dx,
+                        xType,
+                        incx,
+                        stridex,
+                        batch_count,
+                        d_hipblas_result,
+                        resultType,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -48,6 +48,8 @@ void testing_rot_batched_ex_bad_arg(const Arguments& arg)
 {
     bool FORTRAN               = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasRotBatchedExFn = FORTRAN ? hipblasRotBatchedExFortran : hipblasRotBatchedEx;
+    auto hipblasRotBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasRotBatchedEx_64Fortran : hipblasRotBatchedEx_64;
 
     hipblasDatatype_t xType         = arg.a_type;
     hipblasDatatype_t yType         = arg.b_type;
@@ -66,79 +68,73 @@ void testing_rot_batched_ex_bad_arg(const Arguments& arg)
     device_vector<Tcs>      dc(batch_count);
     device_vector<Tcs>      ds(batch_count);
 
-    EXPECT_HIPBLAS_STATUS(hipblasRotBatchedExFn(nullptr,
-                                                N,
-                                                dx,
-                                                xType,
-                                                incx,
-                                                dy,
-                                                yType,
-                                                incy,
-                                                dc,
-                                                ds,
-                                                csType,
-                                                batch_count,
-                                                executionType),
-                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    DAPI_EXPECT(
+        HIPBLAS_STATUS_NOT_INITIALIZED,
+        hipblasRotBatchedExFn,
+        (nullptr, N, dx, xType, incx, dy, yType, incy, dc, ds, csType, batch_count, executionType));
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(hipblasRotBatchedExFn(handle,
-                                                    N,
-                                                    nullptr,
-                                                    xType,
-                                                    incx,
-                                                    dy,
-                                                    yType,
-                                                    incy,
-                                                    dc,
-                                                    ds,
-                                                    csType,
-                                                    batch_count,
-                                                    executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasRotBatchedExFn(handle,
-                                                    N,
-                                                    dx,
-                                                    xType,
-                                                    incx,
-                                                    nullptr,
-                                                    yType,
-                                                    incy,
-                                                    dc,
-                                                    ds,
-                                                    csType,
-                                                    batch_count,
-                                                    executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasRotBatchedExFn(handle,
-                                                    N,
-                                                    dx,
-                                                    xType,
-                                                    incx,
-                                                    dy,
-                                                    yType,
-                                                    incy,
-                                                    nullptr,
-                                                    ds,
-                                                    csType,
-                                                    batch_count,
-                                                    executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasRotBatchedExFn(handle,
-                                                    N,
-                                                    dx,
-                                                    xType,
-                                                    incx,
-                                                    dy,
-                                                    yType,
-                                                    incy,
-                                                    dc,
-                                                    nullptr,
-                                                    csType,
-                                                    batch_count,
-                                                    executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotBatchedExFn,
+                    (handle,
+                     N,
+                     nullptr,
+                     xType,
+                     incx,
+                     dy,
+                     yType,
+                     incy,
+                     dc,
+                     ds,
+                     csType,
+                     batch_count,
+                     executionType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotBatchedExFn,
+                    (handle,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     nullptr,
+                     yType,
+                     incy,
+                     dc,
+                     ds,
+                     csType,
+                     batch_count,
+                     executionType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotBatchedExFn,
+                    (handle,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     dy,
+                     yType,
+                     incy,
+                     nullptr,
+                     ds,
+                     csType,
+                     batch_count,
+                     executionType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotBatchedExFn,
+                    (handle,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     dy,
+                     yType,
+                     incy,
+                     dc,
+                     nullptr,
+                     csType,
+                     batch_count,
+                     executionType));
     }
 }
 
@@ -147,6 +143,8 @@ void testing_rot_batched_ex(const Arguments& arg)
 {
     bool FORTRAN               = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasRotBatchedExFn = FORTRAN ? hipblasRotBatchedExFortran : hipblasRotBatchedEx;
+    auto hipblasRotBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasRotBatchedEx_64Fortran : hipblasRotBatchedEx_64;
 
     int N           = arg.N;
     int incx        = arg.incx;
@@ -163,19 +161,20 @@ void testing_rot_batched_ex(const Arguments& arg)
     // check to prevent undefined memory allocation error
     if(N <= 0 || batch_count <= 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasRotBatchedExFn(handle,
-                                                  N,
-                                                  nullptr,
-                                                  xType,
-                                                  incx,
-                                                  nullptr,
-                                                  yType,
-                                                  incy,
-                                                  nullptr,
-                                                  nullptr,
-                                                  csType,
-                                                  batch_count,
-                                                  executionType));
+        DAPI_CHECK(hipblasRotBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    xType,
+                    incx,
+                    nullptr,
+                    yType,
+                    incy,
+                    nullptr,
+                    nullptr,
+                    csType,
+                    batch_count,
+                    executionType));
 
         return;
     }
@@ -219,19 +218,20 @@ void testing_rot_batched_ex(const Arguments& arg)
     {
         // HIPBLAS
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasRotBatchedExFn(handle,
-                                                  N,
-                                                  dx.ptr_on_device(),
-                                                  xType,
-                                                  incx,
-                                                  dy.ptr_on_device(),
-                                                  yType,
-                                                  incy,
-                                                  hc,
-                                                  hs,
-                                                  csType,
-                                                  batch_count,
-                                                  executionType));
+        DAPI_CHECK(hipblasRotBatchedExFn,
+                   (handle,
+                    N,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    dy.ptr_on_device(),
+                    yType,
+                    incy,
+                    hc,
+                    hs,
+                    csType,
+                    batch_count,
+                    executionType));
 
         CHECK_HIP_ERROR(hx_host.transfer_from(dx));
         CHECK_HIP_ERROR(hy_host.transfer_from(dy));
@@ -239,19 +239,20 @@ void testing_rot_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(dy.transfer_from(hy_device));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasRotBatchedExFn(handle,
-                                                  N,
-                                                  dx.ptr_on_device(),
-                                                  xType,
-                                                  incx,
-                                                  dy.ptr_on_device(),
-                                                  yType,
-                                                  incy,
-                                                  dc,
-                                                  ds,
-                                                  csType,
-                                                  batch_count,
-                                                  executionType));
+        DAPI_CHECK(hipblasRotBatchedExFn,
+                   (handle,
+                    N,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    dy.ptr_on_device(),
+                    yType,
+                    incy,
+                    dc,
+                    ds,
+                    csType,
+                    batch_count,
+                    executionType));
 
         CHECK_HIP_ERROR(hx_device.transfer_from(dx));
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
@@ -294,19 +295,20 @@ void testing_rot_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasRotBatchedExFn(handle,
-                                                      N,
-                                                      dx.ptr_on_device(),
-                                                      xType,
-                                                      incx,
-                                                      dy.ptr_on_device(),
-                                                      yType,
-                                                      incy,
-                                                      dc,
-                                                      ds,
-                                                      csType,
-                                                      batch_count,
-                                                      executionType));
+            DAPI_CHECK(hipblasRotBatchedExFn,
+                       (handle,
+                        N,
+                        dx.ptr_on_device(),
+                        xType,
+                        incx,
+                        dy.ptr_on_device(),
+                        yType,
+                        incy,
+                        dc,
+                        ds,
+                        csType,
+                        batch_count,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -50,6 +50,9 @@ void testing_rot_strided_batched_ex_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasRotStridedBatchedExFn
         = FORTRAN ? hipblasRotStridedBatchedExFortran : hipblasRotStridedBatchedEx;
+    auto hipblasRotStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasRotStridedBatchedEx_64Fortran
+                                               : hipblasRotStridedBatchedEx_64;
 
     hipblasDatatype_t xType         = arg.a_type;
     hipblasDatatype_t yType         = arg.b_type;
@@ -71,89 +74,94 @@ void testing_rot_strided_batched_ex_bad_arg(const Arguments& arg)
     device_vector<Tcs> dc(batch_count);
     device_vector<Tcs> ds(batch_count);
 
-    EXPECT_HIPBLAS_STATUS(hipblasRotStridedBatchedExFn(nullptr,
-                                                       N,
-                                                       dx,
-                                                       xType,
-                                                       incx,
-                                                       stridex,
-                                                       dy,
-                                                       yType,
-                                                       incy,
-                                                       stridey,
-                                                       dc,
-                                                       ds,
-                                                       csType,
-                                                       batch_count,
-                                                       executionType),
-                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                hipblasRotStridedBatchedExFn,
+                (nullptr,
+                 N,
+                 dx,
+                 xType,
+                 incx,
+                 stridex,
+                 dy,
+                 yType,
+                 incy,
+                 stridey,
+                 dc,
+                 ds,
+                 csType,
+                 batch_count,
+                 executionType));
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(hipblasRotStridedBatchedExFn(handle,
-                                                           N,
-                                                           nullptr,
-                                                           xType,
-                                                           incx,
-                                                           stridex,
-                                                           dy,
-                                                           yType,
-                                                           incy,
-                                                           stridey,
-                                                           dc,
-                                                           ds,
-                                                           csType,
-                                                           batch_count,
-                                                           executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasRotStridedBatchedExFn(handle,
-                                                           N,
-                                                           dx,
-                                                           xType,
-                                                           incx,
-                                                           stridex,
-                                                           nullptr,
-                                                           yType,
-                                                           incy,
-                                                           stridey,
-                                                           dc,
-                                                           ds,
-                                                           csType,
-                                                           batch_count,
-                                                           executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasRotStridedBatchedExFn(handle,
-                                                           N,
-                                                           dx,
-                                                           xType,
-                                                           incx,
-                                                           stridex,
-                                                           dy,
-                                                           yType,
-                                                           incy,
-                                                           stridey,
-                                                           nullptr,
-                                                           ds,
-                                                           csType,
-                                                           batch_count,
-                                                           executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasRotStridedBatchedExFn(handle,
-                                                           N,
-                                                           dx,
-                                                           xType,
-                                                           incx,
-                                                           stridex,
-                                                           dy,
-                                                           yType,
-                                                           incy,
-                                                           stridey,
-                                                           dc,
-                                                           nullptr,
-                                                           csType,
-                                                           batch_count,
-                                                           executionType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotStridedBatchedExFn,
+                    (handle,
+                     N,
+                     nullptr,
+                     xType,
+                     incx,
+                     stridex,
+                     dy,
+                     yType,
+                     incy,
+                     stridey,
+                     dc,
+                     ds,
+                     csType,
+                     batch_count,
+                     executionType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotStridedBatchedExFn,
+                    (handle,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     stridex,
+                     nullptr,
+                     yType,
+                     incy,
+                     stridey,
+                     dc,
+                     ds,
+                     csType,
+                     batch_count,
+                     executionType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotStridedBatchedExFn,
+                    (handle,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     stridex,
+                     dy,
+                     yType,
+                     incy,
+                     stridey,
+                     nullptr,
+                     ds,
+                     csType,
+                     batch_count,
+                     executionType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasRotStridedBatchedExFn,
+                    (handle,
+                     N,
+                     dx,
+                     xType,
+                     incx,
+                     stridex,
+                     dy,
+                     yType,
+                     incy,
+                     stridey,
+                     dc,
+                     nullptr,
+                     csType,
+                     batch_count,
+                     executionType));
     }
 }
 
@@ -163,6 +171,9 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasRotStridedBatchedExFn
         = FORTRAN ? hipblasRotStridedBatchedExFortran : hipblasRotStridedBatchedEx;
+    auto hipblasRotStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasRotStridedBatchedEx_64Fortran
+                                               : hipblasRotStridedBatchedEx_64;
 
     int    N            = arg.N;
     int    incx         = arg.incx;
@@ -192,21 +203,22 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
     // check to prevent undefined memory allocation error
     if(N <= 0 || batch_count <= 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasRotStridedBatchedExFn(handle,
-                                                         N,
-                                                         nullptr,
-                                                         xType,
-                                                         incx,
-                                                         stridex,
-                                                         nullptr,
-                                                         yType,
-                                                         incy,
-                                                         stridey,
-                                                         nullptr,
-                                                         nullptr,
-                                                         csType,
-                                                         batch_count,
-                                                         executionType));
+        DAPI_CHECK(hipblasRotStridedBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    xType,
+                    incx,
+                    stridex,
+                    nullptr,
+                    yType,
+                    incy,
+                    stridey,
+                    nullptr,
+                    nullptr,
+                    csType,
+                    batch_count,
+                    executionType));
 
         return;
     }
@@ -246,21 +258,22 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
     if(arg.unit_check || arg.norm_check)
     {
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasRotStridedBatchedExFn(handle,
-                                                         N,
-                                                         dx,
-                                                         xType,
-                                                         incx,
-                                                         stridex,
-                                                         dy,
-                                                         yType,
-                                                         incy,
-                                                         stridey,
-                                                         hc,
-                                                         hs,
-                                                         csType,
-                                                         batch_count,
-                                                         executionType));
+        DAPI_CHECK(hipblasRotStridedBatchedExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    stridex,
+                    dy,
+                    yType,
+                    incy,
+                    stridey,
+                    hc,
+                    hs,
+                    csType,
+                    batch_count,
+                    executionType));
 
         CHECK_HIP_ERROR(hipMemcpy(hx_host, dx, sizeof(Tx) * size_x, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hy_host, dy, sizeof(Ty) * size_y, hipMemcpyDeviceToHost));
@@ -268,21 +281,22 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(dy, hy_device, sizeof(Ty) * size_y, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasRotStridedBatchedExFn(handle,
-                                                         N,
-                                                         dx,
-                                                         xType,
-                                                         incx,
-                                                         stridex,
-                                                         dy,
-                                                         yType,
-                                                         incy,
-                                                         stridey,
-                                                         dc,
-                                                         ds,
-                                                         csType,
-                                                         batch_count,
-                                                         executionType));
+        DAPI_CHECK(hipblasRotStridedBatchedExFn,
+                   (handle,
+                    N,
+                    dx,
+                    xType,
+                    incx,
+                    stridex,
+                    dy,
+                    yType,
+                    incy,
+                    stridey,
+                    dc,
+                    ds,
+                    csType,
+                    batch_count,
+                    executionType));
 
         CHECK_HIP_ERROR(hipMemcpy(hx_device, dx, sizeof(Tx) * size_x, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hy_device, dy, sizeof(Ty) * size_y, hipMemcpyDeviceToHost));
@@ -326,21 +340,22 @@ void testing_rot_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasRotStridedBatchedExFn(handle,
-                                                             N,
-                                                             dx,
-                                                             xType,
-                                                             incx,
-                                                             stridex,
-                                                             dy,
-                                                             yType,
-                                                             incy,
-                                                             stridey,
-                                                             dc,
-                                                             ds,
-                                                             csType,
-                                                             batch_count,
-                                                             executionType));
+            DAPI_CHECK(hipblasRotStridedBatchedExFn,
+                       (handle,
+                        N,
+                        dx,
+                        xType,
+                        incx,
+                        stridex,
+                        dy,
+                        yType,
+                        incy,
+                        stridey,
+                        dc,
+                        ds,
+                        csType,
+                        batch_count,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
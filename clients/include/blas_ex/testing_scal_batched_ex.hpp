@@ -42,6 +42,8 @@ void testing_scal_batched_ex_bad_arg(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasScalBatchedExFn = FORTRAN ? hipblasScalBatchedExFortran : hipblasScalBatchedEx;
+    auto hipblasScalBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasScalBatchedEx_64Fortran : hipblasScalBatchedEx_64;
 
     hipblasDatatype_t alphaType     = arg.a_type;
     hipblasDatatype_t xType         = arg.b_type;
@@ -63,21 +65,20 @@ void testing_scal_batched_ex_bad_arg(const Arguments& arg)
         // Notably scal differs from axpy such that x can /never/ be a nullptr, regardless of alpha.
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(
-            hipblasScalBatchedExFn(
-                nullptr, N, &alpha, alphaType, dx, xType, incx, batch_count, executionType),
-            HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasScalBatchedExFn,
+                    (nullptr, N, &alpha, alphaType, dx, xType, incx, batch_count, executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(
-                hipblasScalBatchedExFn(
-                    handle, N, nullptr, alphaType, dx, xType, incx, batch_count, executionType),
-                HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(
-                hipblasScalBatchedExFn(
-                    handle, N, &alpha, alphaType, nullptr, xType, incx, batch_count, executionType),
-                HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasScalBatchedExFn,
+                (handle, N, nullptr, alphaType, dx, xType, incx, batch_count, executionType));
+            DAPI_EXPECT(
+                HIPBLAS_STATUS_INVALID_VALUE,
+                hipblasScalBatchedExFn,
+                (handle, N, &alpha, alphaType, nullptr, xType, incx, batch_count, executionType));
         }
     }
 }
@@ -87,6 +88,8 @@ void testing_scal_batched_ex(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasScalBatchedExFn = FORTRAN ? hipblasScalBatchedExFortran : hipblasScalBatchedEx;
+    auto hipblasScalBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasScalBatchedEx_64Fortran : hipblasScalBatchedEx_64;
 
     int N           = arg.N;
     int incx        = arg.incx;
@@ -108,8 +111,9 @@ void testing_scal_batched_ex(const Arguments& arg)
     // memory
     if(N <= 0 || incx <= 0 || batch_count <= 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasScalBatchedExFn(
-            handle, N, nullptr, alphaType, nullptr, xType, incx, batch_count, executionType));
+        DAPI_CHECK(
+            hipblasScalBatchedExFn,
+            (handle, N, nullptr, alphaType, nullptr, xType, incx, batch_count, executionType));
         return;
     }
 
@@ -144,29 +148,31 @@ void testing_scal_batched_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasScalBatchedExFn(handle,
-                                                   N,
-                                                   &h_alpha,
-                                                   alphaType,
-                                                   dx.ptr_on_device(),
-                                                   xType,
-                                                   incx,
-                                                   batch_count,
-                                                   executionType));
+        DAPI_CHECK(hipblasScalBatchedExFn,
+                   (handle,
+                    N,
+                    &h_alpha,
+                    alphaType,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    batch_count,
+                    executionType));
 
         CHECK_HIP_ERROR(hx_host.transfer_from(dx));
         CHECK_HIP_ERROR(dx.transfer_from(hx_device));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasScalBatchedExFn(handle,
-                                                   N,
-                                                   d_alpha,
-                                                   alphaType,
-                                                   dx.ptr_on_device(),
-                                                   xType,
-                                                   incx,
-                                                   batch_count,
-                                                   executionType));
+        DAPI_CHECK(hipblasScalBatchedExFn,
+                   (handle,
+                    N,
+                    d_alpha,
+                    alphaType,
+                    dx.ptr_on_device(),
+                    xType,
+                    incx,
+                    batch_count,
+                    executionType));
 
         CHECK_HIP_ERROR(hx_device.transfer_from(dx));
 
@@ -217,15 +223,16 @@ void testing_scal_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasScalBatchedExFn(handle,
-                                                       N,
-                                                       d_alpha,
-                                                       alphaType,
-                                                       dx.ptr_on_device(),
-                                                       xType,
-                                                       incx,
-                                                       batch_count,
-                                                       executionType));
+            DAPI_CHECK(hipblasScalBatchedExFn,
+                       (handle,
+                        N,
+                        d_alpha,
+                        alphaType,
+                        dx.ptr_on_device(),
+                        xType,
+                        incx,
+                        batch_count,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
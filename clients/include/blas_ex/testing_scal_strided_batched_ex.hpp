@@ -49,6 +49,9 @@ void testing_scal_strided_batched_ex_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasScalStridedBatchedExFn
         = FORTRAN ? hipblasScalStridedBatchedExFortran : hipblasScalStridedBatchedEx;
+    auto hipblasScalStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                                ? hipblasScalStridedBatchedEx_64Fortran
+                                                : hipblasScalStridedBatchedEx_64;
 
     hipblasDatatype_t alphaType     = arg.a_type;
     hipblasDatatype_t xType         = arg.b_type;
@@ -73,42 +76,37 @@ void testing_scal_strided_batched_ex_bad_arg(const Arguments& arg)
         // Notably scal differs from axpy such that x can /never/ be a nullptr, regardless of alpha.
 
         // None of these test cases will write to result so using device pointer is fine for both modes
-        EXPECT_HIPBLAS_STATUS(hipblasScalStridedBatchedExFn(nullptr,
-                                                            N,
-                                                            &alpha,
-                                                            alphaType,
-                                                            dx,
-                                                            xType,
-                                                            incx,
-                                                            stridex,
-                                                            batch_count,
-                                                            executionType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
+        DAPI_EXPECT(
+            HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasScalStridedBatchedExFn,
+            (nullptr, N, &alpha, alphaType, dx, xType, incx, stridex, batch_count, executionType));
 
         if(arg.bad_arg_all)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasScalStridedBatchedExFn(handle,
-                                                                N,
-                                                                nullptr,
-                                                                alphaType,
-                                                                dx,
-                                                                xType,
-                                                                incx,
-                                                                stridex,
-                                                                batch_count,
-                                                                executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasScalStridedBatchedExFn(handle,
-                                                                N,
-                                                                &alpha,
-                                                                alphaType,
-                                                                nullptr,
-                                                                xType,
-                                                                incx,
-                                                                stridex,
-                                                                batch_count,
-                                                                executionType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasScalStridedBatchedExFn,
+                        (handle,
+                         N,
+                         nullptr,
+                         alphaType,
+                         dx,
+                         xType,
+                         incx,
+                         stridex,
+                         batch_count,
+                         executionType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasScalStridedBatchedExFn,
+                        (handle,
+                         N,
+                         &alpha,
+                         alphaType,
+                         nullptr,
+                         xType,
+                         incx,
+                         stridex,
+                         batch_count,
+                         executionType));
         }
     }
 }
@@ -119,6 +117,9 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasScalStridedBatchedExFn
         = FORTRAN ? hipblasScalStridedBatchedExFortran : hipblasScalStridedBatchedEx;
+    auto hipblasScalStridedBatchedExFn_64 = arg.api == FORTRAN_64
+                                                ? hipblasScalStridedBatchedEx_64Fortran
+                                                : hipblasScalStridedBatchedEx_64;
 
     int    N            = arg.N;
     int    incx         = arg.incx;
@@ -144,16 +145,17 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
     // memory
     if(N <= 0 || incx <= 0 || batch_count <= 0)
     {
-        CHECK_HIPBLAS_ERROR(hipblasScalStridedBatchedExFn(handle,
-                                                          N,
-                                                          nullptr,
-                                                          alphaType,
-                                                          nullptr,
-                                                          xType,
-                                                          incx,
-                                                          stride_scale,
-                                                          batch_count,
-                                                          executionType));
+        DAPI_CHECK(hipblasScalStridedBatchedExFn,
+                   (handle,
+                    N,
+                    nullptr,
+                    alphaType,
+                    nullptr,
+                    xType,
+                    incx,
+                    stride_scale,
+                    batch_count,
+                    executionType));
         return;
     }
 
@@ -188,16 +190,18 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasScalStridedBatchedExFn(
-            handle, N, &h_alpha, alphaType, dx, xType, incx, stridex, batch_count, executionType));
+        DAPI_CHECK(
+            hipblasScalStridedBatchedExFn,
+            (handle, N, &h_alpha, alphaType, dx, xType, incx, stridex, batch_count, executionType));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hx_host, dx, sizeof(Tx) * sizeX, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dx, hx_device, sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasScalStridedBatchedExFn(
-            handle, N, d_alpha, alphaType, dx, xType, incx, stridex, batch_count, executionType));
+        DAPI_CHECK(
+            hipblasScalStridedBatchedExFn,
+            (handle, N, d_alpha, alphaType, dx, xType, incx, stridex, batch_count, executionType));
 
         CHECK_HIP_ERROR(hipMemcpy(hx_device, dx, sizeof(Tx) * sizeX, hipMemcpyDeviceToHost));
 
@@ -249,16 +253,17 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasScalStridedBatchedExFn(handle,
-                                                              N,
-                                                              d_alpha,
-                                                              alphaType,
-                                                              dx,
-                                                              xType,
-                                                              incx,
-                                                              stridex,
-                                                              batch_count,
-                                                              executionType));
+            DAPI_CHECK(hipblasScalStridedBatchedExFn,
+                       (handle,
+                        N,
+                        d_alpha,
+                        alphaType,
+                        dx,
+                        xType,
+                        incx,
+                        stridex,
+                        batch_count,
+                        executionType));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
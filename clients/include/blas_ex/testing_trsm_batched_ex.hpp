@@ -54,6 +54,8 @@ void testing_trsm_batched_ex_bad_arg(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrsmBatchedExFn = FORTRAN ? hipblasTrsmBatchedExFortran : hipblasTrsmBatchedEx;
+    auto hipblasTrsmBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrsmBatchedEx_64Fortran : hipblasTrsmBatchedEx_64;
 
     hipblasLocalHandle handle(arg);
 
@@ -93,252 +95,266 @@ void testing_trsm_batched_ex_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(nullptr,
-                                                     side,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     N,
-                                                     alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     batch_count,
-                                                     dInvA.ptr_on_device(),
-                                                     invAsize,
-                                                     computeType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                     HIPBLAS_SIDE_BOTH,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     N,
-                                                     alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     batch_count,
-                                                     dInvA.ptr_on_device(),
-                                                     invAsize,
-                                                     computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                     side,
-                                                     HIPBLAS_FILL_MODE_FULL,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     N,
-                                                     alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     batch_count,
-                                                     dInvA.ptr_on_device(),
-                                                     invAsize,
-                                                     computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                     side,
-                                                     uplo,
-                                                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                                     diag,
-                                                     M,
-                                                     N,
-                                                     alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     batch_count,
-                                                     dInvA.ptr_on_device(),
-                                                     invAsize,
-                                                     computeType),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                     side,
-                                                     uplo,
-                                                     transA,
-                                                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                                     M,
-                                                     N,
-                                                     alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     batch_count,
-                                                     dInvA.ptr_on_device(),
-                                                     invAsize,
-                                                     computeType),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                     side,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     N,
-                                                     alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     batch_count,
-                                                     dInvA.ptr_on_device(),
-                                                     invAsize,
-                                                     HIPBLAS_R_16F),
-                              HIPBLAS_STATUS_NOT_SUPPORTED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                     side,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     N,
-                                                     nullptr,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     batch_count,
-                                                     dInvA.ptr_on_device(),
-                                                     invAsize,
-                                                     computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTrsmBatchedExFn,
+                    (nullptr,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     batch_count,
+                     dInvA.ptr_on_device(),
+                     invAsize,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmBatchedExFn,
+                    (handle,
+                     HIPBLAS_SIDE_BOTH,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     batch_count,
+                     dInvA.ptr_on_device(),
+                     invAsize,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmBatchedExFn,
+                    (handle,
+                     side,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     batch_count,
+                     dInvA.ptr_on_device(),
+                     invAsize,
+                     computeType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     batch_count,
+                     dInvA.ptr_on_device(),
+                     invAsize,
+                     computeType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     batch_count,
+                     dInvA.ptr_on_device(),
+                     invAsize,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_SUPPORTED,
+                    hipblasTrsmBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     batch_count,
+                     dInvA.ptr_on_device(),
+                     invAsize,
+                     HIPBLAS_R_16F));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     nullptr,
+                     dA.ptr_on_device(),
+                     lda,
+                     dB.ptr_on_device(),
+                     ldb,
+                     batch_count,
+                     dInvA.ptr_on_device(),
+                     invAsize,
+                     computeType));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                         side,
-                                                         uplo,
-                                                         transA,
-                                                         diag,
-                                                         M,
-                                                         N,
-                                                         alpha,
-                                                         nullptr,
-                                                         lda,
-                                                         dB.ptr_on_device(),
-                                                         ldb,
-                                                         batch_count,
-                                                         dInvA.ptr_on_device(),
-                                                         invAsize,
-                                                         computeType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasTrsmBatchedExFn(handle,
-                                                         side,
-                                                         uplo,
-                                                         transA,
-                                                         diag,
-                                                         M,
-                                                         N,
-                                                         alpha,
-                                                         dA.ptr_on_device(),
-                                                         lda,
-                                                         nullptr,
-                                                         ldb,
-                                                         batch_count,
-                                                         dInvA.ptr_on_device(),
-                                                         invAsize,
-                                                         computeType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrsmBatchedExFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         nullptr,
+                         lda,
+                         dB.ptr_on_device(),
+                         ldb,
+                         batch_count,
+                         dInvA.ptr_on_device(),
+                         invAsize,
+                         computeType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrsmBatchedExFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         dA.ptr_on_device(),
+                         lda,
+                         nullptr,
+                         ldb,
+                         batch_count,
+                         dInvA.ptr_on_device(),
+                         invAsize,
+                         computeType));
         }
 
         // If alpha == 0, then A can be nullptr
-        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   zero,
-                                                   nullptr,
-                                                   lda,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   batch_count,
-                                                   dInvA.ptr_on_device(),
-                                                   invAsize,
-                                                   computeType));
+        DAPI_CHECK(hipblasTrsmBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    zero,
+                    nullptr,
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    batch_count,
+                    dInvA.ptr_on_device(),
+                    invAsize,
+                    computeType));
 
         // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   0,
-                                                   N,
-                                                   nullptr,
-                                                   nullptr,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   batch_count,
-                                                   nullptr,
-                                                   invAsize,
-                                                   computeType));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   0,
-                                                   nullptr,
-                                                   nullptr,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   batch_count,
-                                                   nullptr,
-                                                   invAsize,
-                                                   computeType));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   nullptr,
-                                                   nullptr,
-                                                   lda,
-                                                   nullptr,
-                                                   ldb,
-                                                   0,
-                                                   nullptr,
-                                                   invAsize,
-                                                   computeType));
-
-        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   batch_count,
-                                                   nullptr,
-                                                   invAsize,
-                                                   computeType));
+        DAPI_CHECK(hipblasTrsmBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    batch_count,
+                    nullptr,
+                    invAsize,
+                    computeType));
+        DAPI_CHECK(hipblasTrsmBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    batch_count,
+                    nullptr,
+                    invAsize,
+                    computeType));
+        DAPI_CHECK(hipblasTrsmBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    0,
+                    nullptr,
+                    invAsize,
+                    computeType));
+
+        DAPI_CHECK(hipblasTrsmBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    batch_count,
+                    nullptr,
+                    invAsize,
+                    computeType));
     }
 }
 
@@ -347,6 +363,8 @@ void testing_trsm_batched_ex(const Arguments& arg)
 {
     bool FORTRAN                = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrsmBatchedExFn = FORTRAN ? hipblasTrsmBatchedExFortran : hipblasTrsmBatchedEx;
+    auto hipblasTrsmBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrsmBatchedEx_64Fortran : hipblasTrsmBatchedEx_64;
 
     hipblasSideMode_t  side        = char2hipblas_side(arg.side);
     hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
@@ -477,43 +495,45 @@ void testing_trsm_batched_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   &h_alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   batch_count,
-                                                   dinvA.ptr_on_device(),
-                                                   TRSM_BLOCK * K,
-                                                   arg.compute_type));
+        DAPI_CHECK(hipblasTrsmBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    &h_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    batch_count,
+                    dinvA.ptr_on_device(),
+                    TRSM_BLOCK * K,
+                    arg.compute_type));
 
         CHECK_HIP_ERROR(hB_host.transfer_from(dB));
         CHECK_HIP_ERROR(dB.transfer_from(hB_device));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                   side,
-                                                   uplo,
-                                                   transA,
-                                                   diag,
-                                                   M,
-                                                   N,
-                                                   d_alpha,
-                                                   dA.ptr_on_device(),
-                                                   lda,
-                                                   dB.ptr_on_device(),
-                                                   ldb,
-                                                   batch_count,
-                                                   dinvA.ptr_on_device(),
-                                                   TRSM_BLOCK * K,
-                                                   arg.compute_type));
+        DAPI_CHECK(hipblasTrsmBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    d_alpha,
+                    dA.ptr_on_device(),
+                    lda,
+                    dB.ptr_on_device(),
+                    ldb,
+                    batch_count,
+                    dinvA.ptr_on_device(),
+                    TRSM_BLOCK * K,
+                    arg.compute_type));
 
         CHECK_HIP_ERROR(hB_device.transfer_from(dB));
 
@@ -555,22 +575,23 @@ void testing_trsm_batched_ex(const Arguments& arg)
                 gpu_time_used = get_time_us_sync(stream);
             }
 
-            CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                       side,
-                                                       uplo,
-                                                       transA,
-                                                       diag,
-                                                       M,
-                                                       N,
-                                                       d_alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       batch_count,
-                                                       dinvA.ptr_on_device(),
-                                                       TRSM_BLOCK * K,
-                                                       arg.compute_type));
+            DAPI_CHECK(hipblasTrsmBatchedExFn,
+                       (handle,
+                        side,
+                        uplo,
+                        transA,
+                        diag,
+                        M,
+                        N,
+                        d_alpha,
+                        dA.ptr_on_device(),
+                        lda,
+                        dB.ptr_on_device(),
+                        ldb,
+                        batch_count,
+                        dinvA.ptr_on_device(),
+                        TRSM_BLOCK * K,
+                        arg.compute_type));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -43,8 +43,9 @@ inline void testname_trsm_ex(const Arguments& arg, std::string& name)
 template <typename T>
 void testing_trsm_ex_bad_arg(const Arguments& arg)
 {
-    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasTrsmExFn = FORTRAN ? hipblasTrsmExFortran : hipblasTrsmEx;
+    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasTrsmExFn    = FORTRAN ? hipblasTrsmExFortran : hipblasTrsmEx;
+    auto hipblasTrsmExFn_64 = arg.api == FORTRAN_64 ? hipblasTrsmEx_64Fortran : hipblasTrsmEx_64;
 
     hipblasLocalHandle handle(arg);
 
@@ -83,232 +84,246 @@ void testing_trsm_ex_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(nullptr,
-                                              side,
-                                              uplo,
-                                              transA,
-                                              diag,
-                                              M,
-                                              N,
-                                              alpha,
-                                              dA,
-                                              lda,
-                                              dB,
-                                              ldb,
-                                              dInvA,
-                                              invAsize,
-                                              computeType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                              HIPBLAS_SIDE_BOTH,
-                                              uplo,
-                                              transA,
-                                              diag,
-                                              M,
-                                              N,
-                                              alpha,
-                                              dA,
-                                              lda,
-                                              dB,
-                                              ldb,
-                                              dInvA,
-                                              invAsize,
-                                              computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                              side,
-                                              HIPBLAS_FILL_MODE_FULL,
-                                              transA,
-                                              diag,
-                                              M,
-                                              N,
-                                              alpha,
-                                              dA,
-                                              lda,
-                                              dB,
-                                              ldb,
-                                              dInvA,
-                                              invAsize,
-                                              computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                              side,
-                                              uplo,
-                                              (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                              diag,
-                                              M,
-                                              N,
-                                              alpha,
-                                              dA,
-                                              lda,
-                                              dB,
-                                              ldb,
-                                              dInvA,
-                                              invAsize,
-                                              computeType),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                              side,
-                                              uplo,
-                                              transA,
-                                              (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                              M,
-                                              N,
-                                              alpha,
-                                              dA,
-                                              lda,
-                                              dB,
-                                              ldb,
-                                              dInvA,
-                                              invAsize,
-                                              computeType),
-                              HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                              side,
-                                              uplo,
-                                              transA,
-                                              diag,
-                                              M,
-                                              N,
-                                              alpha,
-                                              dA,
-                                              lda,
-                                              dB,
-                                              ldb,
-                                              dInvA,
-                                              invAsize,
-                                              HIPBLAS_R_16F),
-                              HIPBLAS_STATUS_NOT_SUPPORTED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                              side,
-                                              uplo,
-                                              transA,
-                                              diag,
-                                              M,
-                                              N,
-                                              nullptr,
-                                              dA,
-                                              lda,
-                                              dB,
-                                              ldb,
-                                              dInvA,
-                                              invAsize,
-                                              computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTrsmExFn,
+                    (nullptr,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     dInvA,
+                     invAsize,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmExFn,
+                    (handle,
+                     HIPBLAS_SIDE_BOTH,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     dInvA,
+                     invAsize,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmExFn,
+                    (handle,
+                     side,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     dInvA,
+                     invAsize,
+                     computeType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     dInvA,
+                     invAsize,
+                     computeType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     dInvA,
+                     invAsize,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_SUPPORTED,
+                    hipblasTrsmExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     dInvA,
+                     invAsize,
+                     HIPBLAS_R_16F));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     nullptr,
+                     dA,
+                     lda,
+                     dB,
+                     ldb,
+                     dInvA,
+                     invAsize,
+                     computeType));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                                  side,
-                                                  uplo,
-                                                  transA,
-                                                  diag,
-                                                  M,
-                                                  N,
-                                                  alpha,
-                                                  nullptr,
-                                                  lda,
-                                                  dB,
-                                                  ldb,
-                                                  dInvA,
-                                                  invAsize,
-                                                  computeType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasTrsmExFn(handle,
-                                                  side,
-                                                  uplo,
-                                                  transA,
-                                                  diag,
-                                                  M,
-                                                  N,
-                                                  alpha,
-                                                  dA,
-                                                  lda,
-                                                  nullptr,
-                                                  ldb,
-                                                  dInvA,
-                                                  invAsize,
-                                                  computeType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrsmExFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         nullptr,
+                         lda,
+                         dB,
+                         ldb,
+                         dInvA,
+                         invAsize,
+                         computeType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrsmExFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         nullptr,
+                         ldb,
+                         dInvA,
+                         invAsize,
+                         computeType));
         }
 
         // If alpha == 0, then A can be nullptr
-        CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            M,
-                                            N,
-                                            zero,
-                                            nullptr,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            dInvA,
-                                            invAsize,
-                                            computeType));
+        DAPI_CHECK(hipblasTrsmExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    zero,
+                    nullptr,
+                    lda,
+                    dB,
+                    ldb,
+                    dInvA,
+                    invAsize,
+                    computeType));
 
         // If M == 0 || N == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            0,
-                                            N,
-                                            nullptr,
-                                            nullptr,
-                                            lda,
-                                            nullptr,
-                                            ldb,
-                                            nullptr,
-                                            invAsize,
-                                            computeType));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            M,
-                                            0,
-                                            nullptr,
-                                            nullptr,
-                                            lda,
-                                            nullptr,
-                                            ldb,
-                                            nullptr,
-                                            invAsize,
-                                            computeType));
+        DAPI_CHECK(hipblasTrsmExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    invAsize,
+                    computeType));
+        DAPI_CHECK(hipblasTrsmExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    nullptr,
+                    ldb,
+                    nullptr,
+                    invAsize,
+                    computeType));
 
         // nullptr for invA => regular trsm
-        CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            M,
-                                            N,
-                                            alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            nullptr,
-                                            invAsize,
-                                            computeType));
+        DAPI_CHECK(hipblasTrsmExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    alpha,
+                    dA,
+                    lda,
+                    dB,
+                    ldb,
+                    nullptr,
+                    invAsize,
+                    computeType));
     }
 }
 
 template <typename T>
 void testing_trsm_ex(const Arguments& arg)
 {
-    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasTrsmExFn = FORTRAN ? hipblasTrsmExFortran : hipblasTrsmEx;
+    bool FORTRAN            = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasTrsmExFn    = FORTRAN ? hipblasTrsmExFortran : hipblasTrsmEx;
+    auto hipblasTrsmExFn_64 = arg.api == FORTRAN_64 ? hipblasTrsmEx_64Fortran : hipblasTrsmEx_64;
 
     hipblasSideMode_t  side   = char2hipblas_side(arg.side);
     hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
@@ -423,42 +438,44 @@ void testing_trsm_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            M,
-                                            N,
-                                            &h_alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            dinvA,
-                                            TRSM_BLOCK * K,
-                                            arg.compute_type));
+        DAPI_CHECK(hipblasTrsmExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    &h_alpha,
+                    dA,
+                    lda,
+                    dB,
+                    ldb,
+                    dinvA,
+                    TRSM_BLOCK * K,
+                    arg.compute_type));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hB_host, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dB, hB_device, sizeof(T) * B_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
-                                            side,
-                                            uplo,
-                                            transA,
-                                            diag,
-                                            M,
-                                            N,
-                                            d_alpha,
-                                            dA,
-                                            lda,
-                                            dB,
-                                            ldb,
-                                            dinvA,
-                                            TRSM_BLOCK * K,
-                                            arg.compute_type));
+        DAPI_CHECK(hipblasTrsmExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    d_alpha,
+                    dA,
+                    lda,
+                    dB,
+                    ldb,
+                    dinvA,
+                    TRSM_BLOCK * K,
+                    arg.compute_type));
 
         CHECK_HIP_ERROR(hipMemcpy(hB_device, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
 
@@ -494,21 +511,22 @@ void testing_trsm_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
-                                                side,
-                                                uplo,
-                                                transA,
-                                                diag,
-                                                M,
-                                                N,
-                                                d_alpha,
-                                                dA,
-                                                lda,
-                                                dB,
-                                                ldb,
-                                                dinvA,
-                                                TRSM_BLOCK * K,
-                                                arg.compute_type));
+            DAPI_CHECK(hipblasTrsmExFn,
+                       (handle,
+                        side,
+                        uplo,
+                        transA,
+                        diag,
+                        M,
+                        N,
+                        d_alpha,
+                        dA,
+                        lda,
+                        dB,
+                        ldb,
+                        dinvA,
+                        TRSM_BLOCK * K,
+                        arg.compute_type));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -56,6 +56,8 @@ void testing_trsm_strided_batched_ex_bad_arg(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrsmStridedBatchedExFn
         = FORTRAN ? hipblasTrsmStridedBatchedEx : hipblasTrsmStridedBatchedEx;
+    auto hipblasTrsmStridedBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrsmStridedBatchedEx_64 : hipblasTrsmStridedBatchedEx_64;
 
     hipblasLocalHandle handle(arg);
 
@@ -99,296 +101,308 @@ void testing_trsm_strided_batched_ex_bad_arg(const Arguments& arg)
             zero  = d_zero;
         }
 
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmStridedBatchedExFn(nullptr,
-                                                            side,
-                                                            uplo,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            N,
-                                                            alpha,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            dB,
-                                                            ldb,
-                                                            strideB,
-                                                            batch_count,
-                                                            dInvA,
-                                                            invAsize,
-                                                            strideInvA,
-                                                            computeType),
-                              HIPBLAS_STATUS_NOT_INITIALIZED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmStridedBatchedExFn(handle,
-                                                            HIPBLAS_SIDE_BOTH,
-                                                            uplo,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            N,
-                                                            alpha,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            dB,
-                                                            ldb,
-                                                            strideB,
-                                                            batch_count,
-                                                            dInvA,
-                                                            invAsize,
-                                                            strideInvA,
-                                                            computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmStridedBatchedExFn(handle,
-                                                            side,
-                                                            HIPBLAS_FILL_MODE_FULL,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            N,
-                                                            alpha,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            dB,
-                                                            ldb,
-                                                            strideB,
-                                                            batch_count,
-                                                            dInvA,
-                                                            invAsize,
-                                                            strideInvA,
-                                                            computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTrsmStridedBatchedExFn(handle,
-                                          side,
-                                          uplo,
-                                          (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
-                                          diag,
-                                          M,
-                                          N,
-                                          alpha,
-                                          dA,
-                                          lda,
-                                          strideA,
-                                          dB,
-                                          ldb,
-                                          strideB,
-                                          batch_count,
-                                          dInvA,
-                                          invAsize,
-                                          strideInvA,
-                                          computeType),
-            HIPBLAS_STATUS_INVALID_ENUM);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasTrsmStridedBatchedExFn(handle,
-                                          side,
-                                          uplo,
-                                          transA,
-                                          (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
-                                          M,
-                                          N,
-                                          alpha,
-                                          dA,
-                                          lda,
-                                          strideA,
-                                          dB,
-                                          ldb,
-                                          strideB,
-                                          batch_count,
-                                          dInvA,
-                                          invAsize,
-                                          strideInvA,
-                                          computeType),
-            HIPBLAS_STATUS_INVALID_ENUM);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmStridedBatchedExFn(handle,
-                                                            side,
-                                                            uplo,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            N,
-                                                            alpha,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            dB,
-                                                            ldb,
-                                                            strideB,
-                                                            batch_count,
-                                                            dInvA,
-                                                            invAsize,
-                                                            strideInvA,
-                                                            HIPBLAS_R_16F),
-                              HIPBLAS_STATUS_NOT_SUPPORTED);
-
-        EXPECT_HIPBLAS_STATUS(hipblasTrsmStridedBatchedExFn(handle,
-                                                            side,
-                                                            uplo,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            N,
-                                                            nullptr,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            dB,
-                                                            ldb,
-                                                            strideB,
-                                                            batch_count,
-                                                            dInvA,
-                                                            invAsize,
-                                                            strideInvA,
-                                                            computeType),
-                              HIPBLAS_STATUS_INVALID_VALUE);
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+                    hipblasTrsmStridedBatchedExFn,
+                    (nullptr,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     batch_count,
+                     dInvA,
+                     invAsize,
+                     strideInvA,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmStridedBatchedExFn,
+                    (handle,
+                     HIPBLAS_SIDE_BOTH,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     batch_count,
+                     dInvA,
+                     invAsize,
+                     strideInvA,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmStridedBatchedExFn,
+                    (handle,
+                     side,
+                     HIPBLAS_FILL_MODE_FULL,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     batch_count,
+                     dInvA,
+                     invAsize,
+                     strideInvA,
+                     computeType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmStridedBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     batch_count,
+                     dInvA,
+                     invAsize,
+                     strideInvA,
+                     computeType));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_ENUM,
+                    hipblasTrsmStridedBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     batch_count,
+                     dInvA,
+                     invAsize,
+                     strideInvA,
+                     computeType));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_SUPPORTED,
+                    hipblasTrsmStridedBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     alpha,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     batch_count,
+                     dInvA,
+                     invAsize,
+                     strideInvA,
+                     HIPBLAS_R_16F));
+
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasTrsmStridedBatchedExFn,
+                    (handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     M,
+                     N,
+                     nullptr,
+                     dA,
+                     lda,
+                     strideA,
+                     dB,
+                     ldb,
+                     strideB,
+                     batch_count,
+                     dInvA,
+                     invAsize,
+                     strideInvA,
+                     computeType));
 
         if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
         {
-            EXPECT_HIPBLAS_STATUS(hipblasTrsmStridedBatchedExFn(handle,
-                                                                side,
-                                                                uplo,
-                                                                transA,
-                                                                diag,
-                                                                M,
-                                                                N,
-                                                                alpha,
-                                                                nullptr,
-                                                                lda,
-                                                                strideA,
-                                                                dB,
-                                                                ldb,
-                                                                strideB,
-                                                                batch_count,
-                                                                dInvA,
-                                                                invAsize,
-                                                                strideInvA,
-                                                                computeType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
-            EXPECT_HIPBLAS_STATUS(hipblasTrsmStridedBatchedExFn(handle,
-                                                                side,
-                                                                uplo,
-                                                                transA,
-                                                                diag,
-                                                                M,
-                                                                N,
-                                                                alpha,
-                                                                dA,
-                                                                lda,
-                                                                strideA,
-                                                                nullptr,
-                                                                ldb,
-                                                                strideB,
-                                                                batch_count,
-                                                                dInvA,
-                                                                invAsize,
-                                                                strideInvA,
-                                                                computeType),
-                                  HIPBLAS_STATUS_INVALID_VALUE);
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrsmStridedBatchedExFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         nullptr,
+                         lda,
+                         strideA,
+                         dB,
+                         ldb,
+                         strideB,
+                         batch_count,
+                         dInvA,
+                         invAsize,
+                         strideInvA,
+                         computeType));
+            DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+                        hipblasTrsmStridedBatchedExFn,
+                        (handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         M,
+                         N,
+                         alpha,
+                         dA,
+                         lda,
+                         strideA,
+                         nullptr,
+                         ldb,
+                         strideB,
+                         batch_count,
+                         dInvA,
+                         invAsize,
+                         strideInvA,
+                         computeType));
         }
 
         // If alpha == 0, then A can be nullptr
-        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          zero,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          batch_count,
-                                                          dInvA,
-                                                          invAsize,
-                                                          strideInvA,
-                                                          computeType));
+        DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    zero,
+                    nullptr,
+                    lda,
+                    strideA,
+                    dB,
+                    ldb,
+                    strideB,
+                    batch_count,
+                    dInvA,
+                    invAsize,
+                    strideInvA,
+                    computeType));
 
         // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
-        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          0,
-                                                          N,
-                                                          nullptr,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          batch_count,
-                                                          nullptr,
-                                                          invAsize,
-                                                          strideInvA,
-                                                          computeType));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          0,
-                                                          nullptr,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          batch_count,
-                                                          nullptr,
-                                                          invAsize,
-                                                          strideInvA,
-                                                          computeType));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          nullptr,
-                                                          nullptr,
-                                                          lda,
-                                                          strideA,
-                                                          nullptr,
-                                                          ldb,
-                                                          strideB,
-                                                          0,
-                                                          nullptr,
-                                                          invAsize,
-                                                          strideInvA,
-                                                          computeType));
-
-        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          batch_count,
-                                                          nullptr,
-                                                          invAsize,
-                                                          strideInvA,
-                                                          computeType));
+        DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    0,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    ldb,
+                    strideB,
+                    batch_count,
+                    nullptr,
+                    invAsize,
+                    strideInvA,
+                    computeType));
+        DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    0,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    ldb,
+                    strideB,
+                    batch_count,
+                    nullptr,
+                    invAsize,
+                    strideInvA,
+                    computeType));
+        DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    nullptr,
+                    nullptr,
+                    lda,
+                    strideA,
+                    nullptr,
+                    ldb,
+                    strideB,
+                    0,
+                    nullptr,
+                    invAsize,
+                    strideInvA,
+                    computeType));
+
+        DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    alpha,
+                    dA,
+                    lda,
+                    strideA,
+                    dB,
+                    ldb,
+                    strideB,
+                    batch_count,
+                    nullptr,
+                    invAsize,
+                    strideInvA,
+                    computeType));
     }
 }
 
@@ -398,6 +412,8 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
     bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasTrsmStridedBatchedExFn
         = FORTRAN ? hipblasTrsmStridedBatchedEx : hipblasTrsmStridedBatchedEx;
+    auto hipblasTrsmStridedBatchedExFn_64
+        = arg.api == FORTRAN_64 ? hipblasTrsmStridedBatchedEx_64 : hipblasTrsmStridedBatchedEx_64;
 
     hipblasSideMode_t  side         = char2hipblas_side(arg.side);
     hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
@@ -525,50 +541,52 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
             HIPBLAS
         =================================================================== */
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          &h_alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          batch_count,
-                                                          dinvA,
-                                                          invA_size,
-                                                          stride_invA,
-                                                          arg.compute_type));
+        DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    &h_alpha,
+                    dA,
+                    lda,
+                    strideA,
+                    dB,
+                    ldb,
+                    strideB,
+                    batch_count,
+                    dinvA,
+                    invA_size,
+                    stride_invA,
+                    arg.compute_type));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hB_host, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(dB, hB_device, sizeof(T) * B_size, hipMemcpyHostToDevice));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                          side,
-                                                          uplo,
-                                                          transA,
-                                                          diag,
-                                                          M,
-                                                          N,
-                                                          d_alpha,
-                                                          dA,
-                                                          lda,
-                                                          strideA,
-                                                          dB,
-                                                          ldb,
-                                                          strideB,
-                                                          batch_count,
-                                                          dinvA,
-                                                          invA_size,
-                                                          stride_invA,
-                                                          arg.compute_type));
+        DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                   (handle,
+                    side,
+                    uplo,
+                    transA,
+                    diag,
+                    M,
+                    N,
+                    d_alpha,
+                    dA,
+                    lda,
+                    strideA,
+                    dB,
+                    ldb,
+                    strideB,
+                    batch_count,
+                    dinvA,
+                    invA_size,
+                    stride_invA,
+                    arg.compute_type));
 
         CHECK_HIP_ERROR(hipMemcpy(hB_device, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
 
@@ -619,25 +637,26 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
                 gpu_time_used = get_time_us_sync(stream);
             }
 
-            CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
-                                                              side,
-                                                              uplo,
-                                                              transA,
-                                                              diag,
-                                                              M,
-                                                              N,
-                                                              d_alpha,
-                                                              dA,
-                                                              lda,
-                                                              strideA,
-                                                              dB,
-                                                              ldb,
-                                                              strideB,
-                                                              batch_count,
-                                                              dinvA,
-                                                              invA_size,
-                                                              stride_invA,
-                                                              arg.compute_type));
+            DAPI_CHECK(hipblasTrsmStridedBatchedExFn,
+                       (handle,
+                        side,
+                        uplo,
+                        transA,
+                        diag,
+                        M,
+                        N,
+                        d_alpha,
+                        dA,
+                        lda,
+                        strideA,
+                        dB,
+                        ldb,
+                        strideB,
+                        batch_count,
+                        dinvA,
+                        invA_size,
+                        stride_invA,
+                        arg.compute_type));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -792,6 +792,23 @@ void ref_trmm(hipblasSideMode_t  side,
 template <typename T>
 int ref_potrf(char uplo, int m, T* A, int lda);
 
+// potrs
+template <typename T>
+int ref_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
+// potri
+template <typename T>
+int ref_potri(char uplo, int n, T* A, int lda);
+
+// syevd and heevd, W has the real type of T
+template <typename T>
+int ref_syevd(char jobz, char uplo, int n, T* A, int lda, real_t<T>* W);
+
+// gesvd, S has the real type of T and V holds the rows of V^H
+template <typename T>
+int ref_gesvd(
+    char jobu, char jobv, int m, int n, T* A, int lda, real_t<T>* S, T* U, int ldu, T* V, int ldv);
+
 template <typename T>
 int ref_getrf(int m, int n, T* A, int lda, int* ipiv);
 
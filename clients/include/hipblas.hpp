@@ -1556,6 +1556,102 @@ hipblasStatus_t hipblasZgbmvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stride_y,
                                                int                         batch_count);
 
+// gbmv_64
+hipblasStatus_t hipblasCgbmvCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    int64_t               kl,
+                                    int64_t               ku,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy);
+hipblasStatus_t hipblasZgbmvCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    int64_t                     kl,
+                                    int64_t                     ku,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy);
+hipblasStatus_t hipblasCgbmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           int64_t                     kl,
+                                           int64_t                     ku,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZgbmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           int64_t                           kl,
+                                           int64_t                           ku,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCgbmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  int64_t               kl,
+                                                  int64_t               ku,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stride_y,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZgbmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  int64_t                     kl,
+                                                  int64_t                     ku,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stride_y,
+                                                  int64_t                     batch_count);
+
 // gemv
 hipblasStatus_t hipblasCgemvCast(hipblasHandle_t       handle,
                                  hipblasOperation_t    transA,
@@ -1645,6 +1741,90 @@ hipblasStatus_t hipblasZgemvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridey,
                                                int                         batch_count);
 
+// gemv_64
+hipblasStatus_t hipblasCgemvCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy);
+hipblasStatus_t hipblasZgemvCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy);
+hipblasStatus_t hipblasCgemvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZgemvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCgemvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZgemvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batch_count);
+
 // ger
 hipblasStatus_t hipblasCgeruCast(hipblasHandle_t       handle,
                                  int                   m,
@@ -1798,6 +1978,148 @@ hipblasStatus_t hipblasZgercStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideA,
                                                int                         batch_count);
 
+// ger_64
+hipblasStatus_t hipblasCgeruCast_64(hipblasHandle_t       handle,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda);
+hipblasStatus_t hipblasCgercCast_64(hipblasHandle_t       handle,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda);
+hipblasStatus_t hipblasZgeruCast_64(hipblasHandle_t             handle,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda);
+hipblasStatus_t hipblasZgercCast_64(hipblasHandle_t             handle,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda);
+hipblasStatus_t hipblasCgeruBatchedCast_64(hipblasHandle_t             handle,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasCgercBatchedCast_64(hipblasHandle_t             handle,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZgeruBatchedCast_64(hipblasHandle_t                   handle,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasZgercBatchedCast_64(hipblasHandle_t                   handle,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCgeruStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasCgercStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZgeruStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batch_count);
+hipblasStatus_t hipblasZgercStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batch_count);
+
 // hbmv
 hipblasStatus_t hipblasChbmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -1887,6 +2209,90 @@ hipblasStatus_t hipblasZhbmvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridey,
                                                int                         batchCount);
 
+// hbmv_64
+hipblasStatus_t hipblasChbmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy);
+hipblasStatus_t hipblasZhbmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy);
+hipblasStatus_t hipblasChbmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZhbmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasChbmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZhbmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batchCount);
+
 // hemv
 hipblasStatus_t hipblasChemvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -1970,6 +2376,84 @@ hipblasStatus_t hipblasZhemvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stride_y,
                                                int                         batch_count);
 
+// hemv_64
+hipblasStatus_t hipblasChemvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy);
+hipblasStatus_t hipblasZhemvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy);
+hipblasStatus_t hipblasChemvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZhemvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasChemvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stride_y,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZhemvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stride_y,
+                                                  int64_t                     batch_count);
+
 // her
 hipblasStatus_t hipblasCherCast(hipblasHandle_t       handle,
                                 hipblasFillMode_t     uplo,
@@ -2033,6 +2517,64 @@ hipblasStatus_t hipblasZherStridedBatchedCast(hipblasHandle_t             handle
                                               hipblasStride               strideA,
                                               int                         batchCount);
 
+// her_64
+hipblasStatus_t hipblasCherCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const float*          alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       A,
+                                   int64_t               lda);
+hipblasStatus_t hipblasZherCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const double*               alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       A,
+                                   int64_t                     lda);
+hipblasStatus_t hipblasCherBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const float*                alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       A[],
+                                          int64_t                     lda,
+                                          int64_t                     batchCount);
+hipblasStatus_t hipblasZherBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const double*                     alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       A[],
+                                          int64_t                           lda,
+                                          int64_t                           batchCount);
+hipblasStatus_t hipblasCherStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const float*          alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       A,
+                                                 int64_t               lda,
+                                                 hipblasStride         strideA,
+                                                 int64_t               batchCount);
+hipblasStatus_t hipblasZherStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const double*               alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       A,
+                                                 int64_t                     lda,
+                                                 hipblasStride               strideA,
+                                                 int64_t                     batchCount);
+
 // her2
 hipblasStatus_t hipblasCher2Cast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2110,6 +2652,78 @@ hipblasStatus_t hipblasZher2StridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideA,
                                                int                         batchCount);
 
+// her2_64
+hipblasStatus_t hipblasCher2Cast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda);
+hipblasStatus_t hipblasZher2Cast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda);
+hipblasStatus_t hipblasCher2BatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZher2BatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCher2StridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZher2StridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batchCount);
+
 // hpmv
 hipblasStatus_t hipblasChpmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2187,6 +2801,78 @@ hipblasStatus_t hipblasZhpmvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridey,
                                                int                         batchCount);
 
+// hpmv_64
+hipblasStatus_t hipblasChpmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* AP,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy);
+hipblasStatus_t hipblasZhpmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* AP,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy);
+hipblasStatus_t hipblasChpmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const AP[],
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZhpmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const AP[],
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasChpmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* AP,
+                                                  hipblasStride         strideAP,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZhpmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* AP,
+                                                  hipblasStride               strideAP,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batchCount);
+
 // hpr
 hipblasStatus_t hipblasChprCast(hipblasHandle_t       handle,
                                 hipblasFillMode_t     uplo,
@@ -2244,6 +2930,58 @@ hipblasStatus_t hipblasZhprStridedBatchedCast(hipblasHandle_t             handle
                                               hipblasStride               strideAP,
                                               int                         batchCount);
 
+// hpr_64
+hipblasStatus_t hipblasChprCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const float*          alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       AP);
+hipblasStatus_t hipblasZhprCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const double*               alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       AP);
+hipblasStatus_t hipblasChprBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const float*                alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       AP[],
+                                          int64_t                     batchCount);
+hipblasStatus_t hipblasZhprBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const double*                     alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       AP[],
+                                          int64_t                           batchCount);
+hipblasStatus_t hipblasChprStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const float*          alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       AP,
+                                                 hipblasStride         strideAP,
+                                                 int64_t               batchCount);
+hipblasStatus_t hipblasZhprStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const double*               alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       AP,
+                                                 hipblasStride               strideAP,
+                                                 int64_t                     batchCount);
+
 // hpr2
 hipblasStatus_t hipblasChpr2Cast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2315,6 +3053,72 @@ hipblasStatus_t hipblasZhpr2StridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideAP,
                                                int                         batchCount);
 
+// hpr2_64
+hipblasStatus_t hipblasChpr2Cast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       AP);
+hipblasStatus_t hipblasZhpr2Cast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       AP);
+hipblasStatus_t hipblasChpr2BatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       AP[],
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZhpr2BatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       AP[],
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasChpr2StridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       AP,
+                                                  hipblasStride         strideAP,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZhpr2StridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       AP,
+                                                  hipblasStride               strideAP,
+                                                  int64_t                     batchCount);
+
 // sbmv, spmv, spr2 no complex versions
 
 // spr
@@ -2374,6 +3178,58 @@ hipblasStatus_t hipblasZsprStridedBatchedCast(hipblasHandle_t             handle
                                               hipblasStride               strideAP,
                                               int                         batchCount);
 
+// spr_64
+hipblasStatus_t hipblasCsprCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const hipblasComplex* alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       AP);
+hipblasStatus_t hipblasZsprCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       AP);
+hipblasStatus_t hipblasCsprBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const hipblasComplex*       alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       AP[],
+                                          int64_t                     batchCount);
+hipblasStatus_t hipblasZsprBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const hipblasDoubleComplex*       alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       AP[],
+                                          int64_t                           batchCount);
+hipblasStatus_t hipblasCsprStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const hipblasComplex* alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       AP,
+                                                 hipblasStride         strideAP,
+                                                 int64_t               batchCount);
+hipblasStatus_t hipblasZsprStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const hipblasDoubleComplex* alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       AP,
+                                                 hipblasStride               strideAP,
+                                                 int64_t                     batchCount);
+
 // symv
 hipblasStatus_t hipblasCsymvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2457,6 +3313,84 @@ hipblasStatus_t hipblasZsymvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridey,
                                                int                         batchCount);
 
+// symv_64
+hipblasStatus_t hipblasCsymvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       y,
+                                    int64_t               incy);
+hipblasStatus_t hipblasZsymvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       y,
+                                    int64_t                     incy);
+hipblasStatus_t hipblasCsymvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int64_t                     incy,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZsymvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int64_t                           incy,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCsymvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZsymvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  int64_t                     batchCount);
+
 // syr
 hipblasStatus_t hipblasCsyrCast(hipblasHandle_t       handle,
                                 hipblasFillMode_t     uplo,
@@ -2520,6 +3454,64 @@ hipblasStatus_t hipblasZsyrStridedBatchedCast(hipblasHandle_t             handle
                                               hipblasStride               strideA,
                                               int                         batch_count);
 
+// syr_64
+hipblasStatus_t hipblasCsyrCast_64(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int64_t               n,
+                                   const hipblasComplex* alpha,
+                                   const hipblasComplex* x,
+                                   int64_t               incx,
+                                   hipblasComplex*       A,
+                                   int64_t               lda);
+hipblasStatus_t hipblasZsyrCast_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasDoubleComplex*       A,
+                                   int64_t                     lda);
+hipblasStatus_t hipblasCsyrBatchedCast_64(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int64_t                     n,
+                                          const hipblasComplex*       alpha,
+                                          const hipblasComplex* const x[],
+                                          int64_t                     incx,
+                                          hipblasComplex* const       A[],
+                                          int64_t                     lda,
+                                          int64_t                     batch_count);
+hipblasStatus_t hipblasZsyrBatchedCast_64(hipblasHandle_t                   handle,
+                                          hipblasFillMode_t                 uplo,
+                                          int64_t                           n,
+                                          const hipblasDoubleComplex*       alpha,
+                                          const hipblasDoubleComplex* const x[],
+                                          int64_t                           incx,
+                                          hipblasDoubleComplex* const       A[],
+                                          int64_t                           lda,
+                                          int64_t                           batch_count);
+hipblasStatus_t hipblasCsyrStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int64_t               n,
+                                                 const hipblasComplex* alpha,
+                                                 const hipblasComplex* x,
+                                                 int64_t               incx,
+                                                 hipblasStride         stridex,
+                                                 hipblasComplex*       A,
+                                                 int64_t               lda,
+                                                 hipblasStride         strideA,
+                                                 int64_t               batch_count);
+hipblasStatus_t hipblasZsyrStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int64_t                     n,
+                                                 const hipblasDoubleComplex* alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int64_t                     incx,
+                                                 hipblasStride               stridex,
+                                                 hipblasDoubleComplex*       A,
+                                                 int64_t                     lda,
+                                                 hipblasStride               strideA,
+                                                 int64_t                     batch_count);
+
 // syr2
 hipblasStatus_t hipblasCsyr2Cast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2597,6 +3589,78 @@ hipblasStatus_t hipblasZsyr2StridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideA,
                                                int                         batchCount);
 
+// syr2_64
+hipblasStatus_t hipblasCsyr2Cast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    const hipblasComplex* y,
+                                    int64_t               incy,
+                                    hipblasComplex*       A,
+                                    int64_t               lda);
+hipblasStatus_t hipblasZsyr2Cast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    const hipblasDoubleComplex* y,
+                                    int64_t                     incy,
+                                    hipblasDoubleComplex*       A,
+                                    int64_t                     lda);
+hipblasStatus_t hipblasCsyr2BatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           const hipblasComplex* const y[],
+                                           int64_t                     incy,
+                                           hipblasComplex* const       A[],
+                                           int64_t                     lda,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZsyr2BatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           const hipblasDoubleComplex* const y[],
+                                           int64_t                           incy,
+                                           hipblasDoubleComplex* const       A[],
+                                           int64_t                           lda,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCsyr2StridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  const hipblasComplex* y,
+                                                  int64_t               incy,
+                                                  hipblasStride         stridey,
+                                                  hipblasComplex*       A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZsyr2StridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  const hipblasDoubleComplex* y,
+                                                  int64_t                     incy,
+                                                  hipblasStride               stridey,
+                                                  hipblasDoubleComplex*       A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  int64_t                     batchCount);
+
 // trsv
 hipblasStatus_t hipblasCtrsvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2666,6 +3730,70 @@ hipblasStatus_t hipblasZtrsvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridex,
                                                int                         batch_count);
 
+// trsv_64
+hipblasStatus_t hipblasCtrsvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx);
+hipblasStatus_t hipblasZtrsvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx);
+hipblasStatus_t hipblasCtrsvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZtrsvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCtrsvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZtrsvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batch_count);
+
 // tbmv
 hipblasStatus_t hipblasCtbmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2741,6 +3869,76 @@ hipblasStatus_t hipblasZtbmvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stride_x,
                                                int                         batch_count);
 
+// tbmv_64
+hipblasStatus_t hipblasCtbmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    int64_t               k,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx);
+hipblasStatus_t hipblasZtbmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx);
+hipblasStatus_t hipblasCtbmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           int64_t                     k,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZtbmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCtbmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  int64_t               k,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZtbmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  int64_t                     batch_count);
+
 // tbsv
 hipblasStatus_t hipblasCtbsvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2816,6 +4014,76 @@ hipblasStatus_t hipblasZtbsvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridex,
                                                int                         batchCount);
 
+// tbsv_64
+hipblasStatus_t hipblasCtbsvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx);
+hipblasStatus_t hipblasZtbsvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx);
+hipblasStatus_t hipblasCtbsvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZtbsvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCtbsvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZtbsvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batchCount);
+
 // tpmv
 hipblasStatus_t hipblasCtpmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2879,6 +4147,64 @@ hipblasStatus_t hipblasZtpmvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridex,
                                                int                         batchCount);
 
+// tpmv_64
+hipblasStatus_t hipblasCtpmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* AP,
+                                    hipblasComplex*       x,
+                                    int64_t               incx);
+hipblasStatus_t hipblasZtpmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* AP,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx);
+hipblasStatus_t hipblasCtpmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const AP[],
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZtpmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const AP[],
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCtpmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* AP,
+                                                  hipblasStride         strideAP,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZtpmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* AP,
+                                                  hipblasStride               strideAP,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batchCount);
+
 // tpsv
 hipblasStatus_t hipblasCtpsvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -2942,6 +4268,64 @@ hipblasStatus_t hipblasZtpsvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stridex,
                                                int                         batchCount);
 
+// tpsv_64
+hipblasStatus_t hipblasCtpsvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* AP,
+                                    hipblasComplex*       x,
+                                    int64_t               incx);
+hipblasStatus_t hipblasZtpsvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* AP,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx);
+hipblasStatus_t hipblasCtpsvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const AP[],
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZtpsvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const AP[],
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCtpsvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* AP,
+                                                  hipblasStride         strideAP,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stridex,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZtpsvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* AP,
+                                                  hipblasStride               strideAP,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stridex,
+                                                  int64_t                     batchCount);
+
 // trmv
 hipblasStatus_t hipblasCtrmvCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -3011,6 +4395,70 @@ hipblasStatus_t hipblasZtrmvStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stride_x,
                                                int                         batch_count);
 
+// trmv_64
+hipblasStatus_t hipblasCtrmvCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       x,
+                                    int64_t               incx);
+hipblasStatus_t hipblasZtrmvCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       x,
+                                    int64_t                     incx);
+hipblasStatus_t hipblasCtrmvBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       x[],
+                                           int64_t                     incx,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZtrmvBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       x[],
+                                           int64_t                           incx,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCtrmvStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_a,
+                                                  hipblasComplex*       x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZtrmvStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_a,
+                                                  hipblasDoubleComplex*       x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  int64_t                     batch_count);
+
 // trtri
 hipblasStatus_t hipblasCtrtriCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -3150,6 +4598,78 @@ hipblasStatus_t hipblasZdgmmStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               stride_C,
                                                int                         batch_count);
 
+// dgmm_64
+hipblasStatus_t hipblasCdgmmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* x,
+                                    int64_t               incx,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZdgmmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* x,
+                                    int64_t                     incx,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasCdgmmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const x[],
+                                           int64_t                     incx,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZdgmmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int64_t                           incx,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCdgmmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         stride_A,
+                                                  const hipblasComplex* x,
+                                                  int64_t               incx,
+                                                  hipblasStride         stride_x,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         stride_C,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZdgmmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               stride_A,
+                                                  const hipblasDoubleComplex* x,
+                                                  int64_t                     incx,
+                                                  hipblasStride               stride_x,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               stride_C,
+                                                  int64_t                     batch_count);
+
 // gemm
 hipblasStatus_t hipblasCgemmCast(hipblasHandle_t       handle,
                                  hipblasOperation_t    transA,
@@ -3251,6 +4771,102 @@ hipblasStatus_t hipblasZgemmStridedBatchedCast(hipblasHandle_t             handl
                                                int                         bsc,
                                                int                         batch_count);
 
+// gemm_64
+hipblasStatus_t hipblasCgemmCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    hipblasOperation_t    transB,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZgemmCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasCgemmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           hipblasOperation_t          transB,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZgemmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           hipblasOperation_t                transB,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCgemmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasOperation_t    transB,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  int64_t               bsa,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  int64_t               bsb,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  int64_t               bsc,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZgemmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasOperation_t          transB,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  int64_t                     bsa,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  int64_t                     bsb,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  int64_t                     bsc,
+                                                  int64_t                     batch_count);
+
 // herk
 hipblasStatus_t hipblasCherkCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -3332,6 +4948,82 @@ hipblasStatus_t hipblasZherkStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideC,
                                                int                         batchCount);
 
+// herk_64
+hipblasStatus_t hipblasCherkCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const float*          alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const float*          beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZherkCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const double*               alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const double*               beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasCherkBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const float*                alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const float*                beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZherkBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const double*                     alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const double*                     beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCherkStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const float*          alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const float*          beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZherkStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const double*               alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const double*               beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount);
+
 // her2k
 hipblasStatus_t hipblasCher2kCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -3427,6 +5119,96 @@ hipblasStatus_t hipblasZher2kStridedBatchedCast(hipblasHandle_t             hand
                                                 hipblasStride               strideC,
                                                 int                         batchCount);
 
+// her2k_64
+hipblasStatus_t hipblasCher2kCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const float*          beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc);
+hipblasStatus_t hipblasZher2kCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const double*               beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc);
+hipblasStatus_t hipblasCher2kBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const float*                beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount);
+hipblasStatus_t hipblasZher2kBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const double*                     beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount);
+hipblasStatus_t hipblasCher2kStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const float*          beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount);
+hipblasStatus_t hipblasZher2kStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const double*               beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount);
+
 // herkx
 hipblasStatus_t hipblasCherkxCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -3522,6 +5304,96 @@ hipblasStatus_t hipblasZherkxStridedBatchedCast(hipblasHandle_t             hand
                                                 hipblasStride               strideC,
                                                 int                         batchCount);
 
+// herkx_64
+hipblasStatus_t hipblasCherkxCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const float*          beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc);
+hipblasStatus_t hipblasZherkxCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const double*               beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc);
+hipblasStatus_t hipblasCherkxBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const float*                beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount);
+hipblasStatus_t hipblasZherkxBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const double*                     beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount);
+hipblasStatus_t hipblasCherkxStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const float*          beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount);
+hipblasStatus_t hipblasZherkxStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const double*               beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount);
+
 // symm
 hipblasStatus_t hipblasCsymmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -3617,6 +5489,96 @@ hipblasStatus_t hipblasZsymmStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideC,
                                                int                         batchCount);
 
+// symm_64
+hipblasStatus_t hipblasCsymmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZsymmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasCsymmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZsymmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCsymmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZsymmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount);
+
 // syrk
 hipblasStatus_t hipblasCsyrkCast(hipblasHandle_t       handle,
                                  hipblasFillMode_t     uplo,
@@ -3698,6 +5660,82 @@ hipblasStatus_t hipblasZsyrkStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideC,
                                                int                         batchCount);
 
+// syrk_64
+hipblasStatus_t hipblasCsyrkCast_64(hipblasHandle_t       handle,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZsyrkCast_64(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasCsyrkBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZsyrkBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCsyrkStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZsyrkStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount);
+
 // syr2k
 hipblasStatus_t hipblasCsyr2kCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -3793,6 +5831,96 @@ hipblasStatus_t hipblasZsyr2kStridedBatchedCast(hipblasHandle_t             hand
                                                 hipblasStride               strideC,
                                                 int                         batchCount);
 
+// syr2k_64
+hipblasStatus_t hipblasCsyr2kCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc);
+hipblasStatus_t hipblasZsyr2kCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc);
+hipblasStatus_t hipblasCsyr2kBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount);
+hipblasStatus_t hipblasZsyr2kBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount);
+hipblasStatus_t hipblasCsyr2kStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const hipblasComplex* beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount);
+hipblasStatus_t hipblasZsyr2kStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount);
+
 // syrkx
 hipblasStatus_t hipblasCsyrkxCast(hipblasHandle_t       handle,
                                   hipblasFillMode_t     uplo,
@@ -3888,6 +6016,96 @@ hipblasStatus_t hipblasZsyrkxStridedBatchedCast(hipblasHandle_t             hand
                                                 hipblasStride               strideC,
                                                 int                         batchCount);
 
+// syrkx_64
+hipblasStatus_t hipblasCsyrkxCast_64(hipblasHandle_t       handle,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     int64_t               n,
+                                     int64_t               k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int64_t               lda,
+                                     const hipblasComplex* B,
+                                     int64_t               ldb,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       C,
+                                     int64_t               ldc);
+hipblasStatus_t hipblasZsyrkxCast_64(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     int64_t                     n,
+                                     int64_t                     k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int64_t                     lda,
+                                     const hipblasDoubleComplex* B,
+                                     int64_t                     ldb,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       C,
+                                     int64_t                     ldc);
+hipblasStatus_t hipblasCsyrkxBatchedCast_64(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int64_t                     n,
+                                            int64_t                     k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int64_t                     lda,
+                                            const hipblasComplex* const B[],
+                                            int64_t                     ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int64_t                     ldc,
+                                            int64_t                     batchCount);
+hipblasStatus_t hipblasZsyrkxBatchedCast_64(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int64_t                           n,
+                                            int64_t                           k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int64_t                           lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int64_t                           ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int64_t                           ldc,
+                                            int64_t                           batchCount);
+hipblasStatus_t hipblasCsyrkxStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   int64_t               n,
+                                                   int64_t               k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   int64_t               lda,
+                                                   hipblasStride         strideA,
+                                                   const hipblasComplex* B,
+                                                   int64_t               ldb,
+                                                   hipblasStride         strideB,
+                                                   const hipblasComplex* beta,
+                                                   hipblasComplex*       C,
+                                                   int64_t               ldc,
+                                                   hipblasStride         strideC,
+                                                   int64_t               batchCount);
+hipblasStatus_t hipblasZsyrkxStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int64_t                     n,
+                                                   int64_t                     k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int64_t                     lda,
+                                                   hipblasStride               strideA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int64_t                     ldb,
+                                                   hipblasStride               strideB,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int64_t                     ldc,
+                                                   hipblasStride               strideC,
+                                                   int64_t                     batchCount);
+
 // hemm
 hipblasStatus_t hipblasChemmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -3983,6 +6201,96 @@ hipblasStatus_t hipblasZhemmStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideC,
                                                int                         batchCount);
 
+// hemm_64
+hipblasStatus_t hipblasChemmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    int64_t               n,
+                                    int64_t               k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZhemmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    int64_t                     n,
+                                    int64_t                     k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasChemmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           int64_t                     n,
+                                           int64_t                     k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZhemmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           int64_t                           n,
+                                           int64_t                           k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasChemmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  int64_t               n,
+                                                  int64_t               k,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZhemmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  int64_t                     n,
+                                                  int64_t                     k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount);
+
 // trmm
 hipblasStatus_t hipblasCtrmmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -4084,6 +6392,102 @@ hipblasStatus_t hipblasZtrmmStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideC,
                                                int                         batchCount);
 
+// trmm_64
+hipblasStatus_t hipblasCtrmmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZtrmmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasCtrmmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZtrmmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCtrmmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZtrmmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount);
+
 // trsm
 hipblasStatus_t hipblasCtrsmCast(hipblasHandle_t       handle,
                                  hipblasSideMode_t     side,
@@ -4171,6 +6575,88 @@ hipblasStatus_t hipblasZtrsmStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideB,
                                                int                         batch_count);
 
+// trsm_64
+hipblasStatus_t hipblasCtrsmCast_64(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    hipblasComplex*       B,
+                                    int64_t               ldb);
+hipblasStatus_t hipblasZtrsmCast_64(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    hipblasDoubleComplex*       B,
+                                    int64_t                     ldb);
+hipblasStatus_t hipblasCtrsmBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           hipblasComplex* const       B[],
+                                           int64_t                     ldb,
+                                           int64_t                     batch_count);
+hipblasStatus_t hipblasZtrsmBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasSideMode_t                 side,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           hipblasDiagType_t                 diag,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           hipblasDoubleComplex* const       B[],
+                                           int64_t                           ldb,
+                                           int64_t                           batch_count);
+hipblasStatus_t hipblasCtrsmStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  hipblasComplex*       B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  int64_t               batch_count);
+hipblasStatus_t hipblasZtrsmStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  hipblasDoubleComplex*       B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  int64_t                     batch_count);
+
 // geam
 hipblasStatus_t hipblasCgeamCast(hipblasHandle_t       handle,
                                  hipblasOperation_t    transA,
@@ -4266,6 +6752,96 @@ hipblasStatus_t hipblasZgeamStridedBatchedCast(hipblasHandle_t             handl
                                                hipblasStride               strideC,
                                                int                         batchCount);
 
+// geam_64
+hipblasStatus_t hipblasCgeamCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    hipblasOperation_t    transB,
+                                    int64_t               m,
+                                    int64_t               n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    int64_t               lda,
+                                    const hipblasComplex* beta,
+                                    const hipblasComplex* B,
+                                    int64_t               ldb,
+                                    hipblasComplex*       C,
+                                    int64_t               ldc);
+hipblasStatus_t hipblasZgeamCast_64(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int64_t                     m,
+                                    int64_t                     n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    int64_t                     lda,
+                                    const hipblasDoubleComplex* beta,
+                                    const hipblasDoubleComplex* B,
+                                    int64_t                     ldb,
+                                    hipblasDoubleComplex*       C,
+                                    int64_t                     ldc);
+hipblasStatus_t hipblasCgeamBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           hipblasOperation_t          transB,
+                                           int64_t                     m,
+                                           int64_t                     n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int64_t                     lda,
+                                           const hipblasComplex*       beta,
+                                           const hipblasComplex* const B[],
+                                           int64_t                     ldb,
+                                           hipblasComplex* const       C[],
+                                           int64_t                     ldc,
+                                           int64_t                     batchCount);
+hipblasStatus_t hipblasZgeamBatchedCast_64(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           hipblasOperation_t                transB,
+                                           int64_t                           m,
+                                           int64_t                           n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int64_t                           lda,
+                                           const hipblasDoubleComplex*       beta,
+                                           const hipblasDoubleComplex* const B[],
+                                           int64_t                           ldb,
+                                           hipblasDoubleComplex* const       C[],
+                                           int64_t                           ldc,
+                                           int64_t                           batchCount);
+hipblasStatus_t hipblasCgeamStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasOperation_t    transB,
+                                                  int64_t               m,
+                                                  int64_t               n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int64_t               lda,
+                                                  hipblasStride         strideA,
+                                                  const hipblasComplex* beta,
+                                                  const hipblasComplex* B,
+                                                  int64_t               ldb,
+                                                  hipblasStride         strideB,
+                                                  hipblasComplex*       C,
+                                                  int64_t               ldc,
+                                                  hipblasStride         strideC,
+                                                  int64_t               batchCount);
+hipblasStatus_t hipblasZgeamStridedBatchedCast_64(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasOperation_t          transB,
+                                                  int64_t                     m,
+                                                  int64_t                     n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int64_t                     lda,
+                                                  hipblasStride               strideA,
+                                                  const hipblasDoubleComplex* beta,
+                                                  const hipblasDoubleComplex* B,
+                                                  int64_t                     ldb,
+                                                  hipblasStride               strideB,
+                                                  hipblasDoubleComplex*       C,
+                                                  int64_t                     ldc,
+                                                  hipblasStride               strideC,
+                                                  int64_t                     batchCount);
+
 // getrf
 hipblasStatus_t hipblasCgetrfCast(
     hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info);
@@ -4313,6 +6889,57 @@ hipblasStatus_t hipblasZgetrfStridedBatchedCast(hipblasHandle_t       handle,
                                                 int*                  info,
                                                 const int             batchCount);
 
+// getrf_64
+hipblasStatus_t hipblasCgetrfCast_64(hipblasHandle_t handle,
+                                     const int64_t   n,
+                                     hipblasComplex* A,
+                                     const int64_t   lda,
+                                     int64_t*        ipiv,
+                                     int64_t*        info);
+
+hipblasStatus_t hipblasZgetrfCast_64(hipblasHandle_t       handle,
+                                     const int64_t         n,
+                                     hipblasDoubleComplex* A,
+                                     const int64_t         lda,
+                                     int64_t*              ipiv,
+                                     int64_t*              info);
+
+hipblasStatus_t hipblasCgetrfBatchedCast_64(hipblasHandle_t       handle,
+                                            const int64_t         n,
+                                            hipblasComplex* const A[],
+                                            const int64_t         lda,
+                                            int64_t*              ipiv,
+                                            int64_t*              info,
+                                            const int64_t         batchCount);
+
+hipblasStatus_t hipblasZgetrfBatchedCast_64(hipblasHandle_t             handle,
+                                            const int64_t               n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int64_t               lda,
+                                            int64_t*                    ipiv,
+                                            int64_t*                    info,
+                                            const int64_t               batchCount);
+
+hipblasStatus_t hipblasCgetrfStridedBatchedCast_64(hipblasHandle_t     handle,
+                                                   const int64_t       n,
+                                                   hipblasComplex*     A,
+                                                   const int64_t       lda,
+                                                   const hipblasStride strideA,
+                                                   int64_t*            ipiv,
+                                                   const hipblasStride strideP,
+                                                   int64_t*            info,
+                                                   const int64_t       batchCount);
+
+hipblasStatus_t hipblasZgetrfStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   const int64_t         n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int64_t         lda,
+                                                   const hipblasStride   strideA,
+                                                   int64_t*              ipiv,
+                                                   const hipblasStride   strideP,
+                                                   int64_t*              info,
+                                                   const int64_t         batchCount);
+
 // getrs
 hipblasStatus_t hipblasCgetrsCast(hipblasHandle_t          handle,
                                   const hipblasOperation_t trans,
@@ -4410,6 +7037,608 @@ hipblasStatus_t hipblasZgetriBatchedCast(hipblasHandle_t             handle,
                                          int*                        info,
                                          const int                   batchCount);
 
+// potrf
+hipblasStatus_t hipblasCpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info);
+
+// potrf_batched
+hipblasStatus_t hipblasCpotrfBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// potrf_strided_batched
+hipblasStatus_t hipblasCpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// potrs
+hipblasStatus_t hipblasCpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  hipblasComplex*         B,
+                                  const int               ldb,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  hipblasDoubleComplex*   B,
+                                  const int               ldb,
+                                  int*                    info);
+
+// potrs_batched
+hipblasStatus_t hipblasCpotrsBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         const int               nrhs,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         hipblasComplex* const   B[],
+                                         const int               ldb,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const int                   nrhs,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const B[],
+                                         const int                   ldb,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// potrs_strided_batched
+hipblasStatus_t hipblasCpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasComplex*         B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasDoubleComplex*   B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// potri
+hipblasStatus_t hipblasCpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info);
+
+// potri_batched
+hipblasStatus_t hipblasCpotriBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotriBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// potri_strided_batched
+hipblasStatus_t hipblasCpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// heevd
+hipblasStatus_t hipblasCheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEigMode_t  jobz,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  float*                  W,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZheevdCast(hipblasHandle_t         handle,
+                                  const hipblasEigMode_t  jobz,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  double*                 W,
+                                  int*                    info);
+
+// heevd_batched
+hipblasStatus_t hipblasCheevdBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasEigMode_t  jobz,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         float*                  W,
+                                         const hipblasStride     strideW,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZheevdBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasEigMode_t      jobz,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         double*                     W,
+                                         const hipblasStride         strideW,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// heevd_strided_batched
+hipblasStatus_t hipblasCheevdStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEigMode_t  jobz,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                float*                  W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZheevdStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasEigMode_t  jobz,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                double*                 W,
+                                                const hipblasStride     strideW,
+                                                int*                    info,
+                                                const int               batchCount);
+
+
+// gesvd
+hipblasStatus_t hipblasCgesvdCast(hipblasHandle_t        handle,
+                                  const hipblasSvdMode_t jobu,
+                                  const hipblasSvdMode_t jobv,
+                                  const int              m,
+                                  const int              n,
+                                  hipblasComplex*        A,
+                                  const int              lda,
+                                  float*                 S,
+                                  hipblasComplex*        U,
+                                  const int              ldu,
+                                  hipblasComplex*        V,
+                                  const int              ldv,
+                                  int*                   info);
+
+hipblasStatus_t hipblasZgesvdCast(hipblasHandle_t        handle,
+                                  const hipblasSvdMode_t jobu,
+                                  const hipblasSvdMode_t jobv,
+                                  const int              m,
+                                  const int              n,
+                                  hipblasDoubleComplex*  A,
+                                  const int              lda,
+                                  double*                S,
+                                  hipblasDoubleComplex*  U,
+                                  const int              ldu,
+                                  hipblasDoubleComplex*  V,
+                                  const int              ldv,
+                                  int*                   info);
+
+// gesvd_batched
+hipblasStatus_t hipblasCgesvdBatchedCast(hipblasHandle_t        handle,
+                                         const hipblasSvdMode_t jobu,
+                                         const hipblasSvdMode_t jobv,
+                                         const int              m,
+                                         const int              n,
+                                         hipblasComplex* const  A[],
+                                         const int              lda,
+                                         float*                 S,
+                                         const hipblasStride    strideS,
+                                         hipblasComplex*        U,
+                                         const int              ldu,
+                                         const hipblasStride    strideU,
+                                         hipblasComplex*        V,
+                                         const int              ldv,
+                                         const hipblasStride    strideV,
+                                         int*                   info,
+                                         const int              batchCount);
+
+hipblasStatus_t hipblasZgesvdBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasSvdMode_t      jobu,
+                                         const hipblasSvdMode_t      jobv,
+                                         const int                   m,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         double*                     S,
+                                         const hipblasStride         strideS,
+                                         hipblasDoubleComplex*       U,
+                                         const int                   ldu,
+                                         const hipblasStride         strideU,
+                                         hipblasDoubleComplex*       V,
+                                         const int                   ldv,
+                                         const hipblasStride         strideV,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// gesvd_strided_batched
+hipblasStatus_t hipblasCgesvdStridedBatchedCast(hipblasHandle_t        handle,
+                                                const hipblasSvdMode_t jobu,
+                                                const hipblasSvdMode_t jobv,
+                                                const int              m,
+                                                const int              n,
+                                                hipblasComplex*        A,
+                                                const int              lda,
+                                                const hipblasStride    strideA,
+                                                float*                 S,
+                                                const hipblasStride    strideS,
+                                                hipblasComplex*        U,
+                                                const int              ldu,
+                                                const hipblasStride    strideU,
+                                                hipblasComplex*        V,
+                                                const int              ldv,
+                                                const hipblasStride    strideV,
+                                                int*                   info,
+                                                const int              batchCount);
+
+hipblasStatus_t hipblasZgesvdStridedBatchedCast(hipblasHandle_t        handle,
+                                                const hipblasSvdMode_t jobu,
+                                                const hipblasSvdMode_t jobv,
+                                                const int              m,
+                                                const int              n,
+                                                hipblasDoubleComplex*  A,
+                                                const int              lda,
+                                                const hipblasStride    strideA,
+                                                double*                S,
+                                                const hipblasStride    strideS,
+                                                hipblasDoubleComplex*  U,
+                                                const int              ldu,
+                                                const hipblasStride    strideU,
+                                                hipblasDoubleComplex*  V,
+                                                const int              ldv,
+                                                const hipblasStride    strideV,
+                                                int*                   info,
+                                                const int              batchCount);
+
+// gesvdj
+hipblasStatus_t hipblasCgesvdjCast(hipblasHandle_t        handle,
+                                   const hipblasSvdMode_t jobu,
+                                   const hipblasSvdMode_t jobv,
+                                   const int              m,
+                                   const int              n,
+                                   hipblasComplex*        A,
+                                   const int              lda,
+                                   const float            abstol,
+                                   float*                 residual,
+                                   const int              maxSweeps,
+                                   int*                   nSweeps,
+                                   float*                 S,
+                                   hipblasComplex*        U,
+                                   const int              ldu,
+                                   hipblasComplex*        V,
+                                   const int              ldv,
+                                   int*                   info);
+
+hipblasStatus_t hipblasZgesvdjCast(hipblasHandle_t        handle,
+                                   const hipblasSvdMode_t jobu,
+                                   const hipblasSvdMode_t jobv,
+                                   const int              m,
+                                   const int              n,
+                                   hipblasDoubleComplex*  A,
+                                   const int              lda,
+                                   const double           abstol,
+                                   double*                residual,
+                                   const int              maxSweeps,
+                                   int*                   nSweeps,
+                                   double*                S,
+                                   hipblasDoubleComplex*  U,
+                                   const int              ldu,
+                                   hipblasDoubleComplex*  V,
+                                   const int              ldv,
+                                   int*                   info);
+
+// gesvdj_batched
+hipblasStatus_t hipblasCgesvdjBatchedCast(hipblasHandle_t        handle,
+                                          const hipblasSvdMode_t jobu,
+                                          const hipblasSvdMode_t jobv,
+                                          const int              m,
+                                          const int              n,
+                                          hipblasComplex* const  A[],
+                                          const int              lda,
+                                          const float            abstol,
+                                          float*                 residual,
+                                          const int              maxSweeps,
+                                          int*                   nSweeps,
+                                          float*                 S,
+                                          const hipblasStride    strideS,
+                                          hipblasComplex*        U,
+                                          const int              ldu,
+                                          const hipblasStride    strideU,
+                                          hipblasComplex*        V,
+                                          const int              ldv,
+                                          const hipblasStride    strideV,
+                                          int*                   info,
+                                          const int              batchCount);
+
+hipblasStatus_t hipblasZgesvdjBatchedCast(hipblasHandle_t             handle,
+                                          const hipblasSvdMode_t      jobu,
+                                          const hipblasSvdMode_t      jobv,
+                                          const int                   m,
+                                          const int                   n,
+                                          hipblasDoubleComplex* const A[],
+                                          const int                   lda,
+                                          const double                abstol,
+                                          double*                     residual,
+                                          const int                   maxSweeps,
+                                          int*                        nSweeps,
+                                          double*                     S,
+                                          const hipblasStride         strideS,
+                                          hipblasDoubleComplex*       U,
+                                          const int                   ldu,
+                                          const hipblasStride         strideU,
+                                          hipblasDoubleComplex*       V,
+                                          const int                   ldv,
+                                          const hipblasStride         strideV,
+                                          int*                        info,
+                                          const int                   batchCount);
+
+// gesvdj_strided_batched
+hipblasStatus_t hipblasCgesvdjStridedBatchedCast(hipblasHandle_t        handle,
+                                                 const hipblasSvdMode_t jobu,
+                                                 const hipblasSvdMode_t jobv,
+                                                 const int              m,
+                                                 const int              n,
+                                                 hipblasComplex*        A,
+                                                 const int              lda,
+                                                 const hipblasStride    strideA,
+                                                 const float            abstol,
+                                                 float*                 residual,
+                                                 const int              maxSweeps,
+                                                 int*                   nSweeps,
+                                                 float*                 S,
+                                                 const hipblasStride    strideS,
+                                                 hipblasComplex*        U,
+                                                 const int              ldu,
+                                                 const hipblasStride    strideU,
+                                                 hipblasComplex*        V,
+                                                 const int              ldv,
+                                                 const hipblasStride    strideV,
+                                                 int*                   info,
+                                                 const int              batchCount);
+
+hipblasStatus_t hipblasZgesvdjStridedBatchedCast(hipblasHandle_t        handle,
+                                                 const hipblasSvdMode_t jobu,
+                                                 const hipblasSvdMode_t jobv,
+                                                 const int              m,
+                                                 const int              n,
+                                                 hipblasDoubleComplex*  A,
+                                                 const int              lda,
+                                                 const hipblasStride    strideA,
+                                                 const double           abstol,
+                                                 double*                residual,
+                                                 const int              maxSweeps,
+                                                 int*                   nSweeps,
+                                                 double*                S,
+                                                 const hipblasStride    strideS,
+                                                 hipblasDoubleComplex*  U,
+                                                 const int              ldu,
+                                                 const hipblasStride    strideU,
+                                                 hipblasDoubleComplex*  V,
+                                                 const int              ldv,
+                                                 const hipblasStride    strideV,
+                                                 int*                   info,
+                                                 const int              batchCount);
+// gesv
+hipblasStatus_t hipblasZCgesvCast(hipblasHandle_t             handle,
+                                  const int                   n,
+                                  const int                   nrhs,
+                                  hipblasDoubleComplex*       A,
+                                  const int                   lda,
+                                  int*                        ipiv,
+                                  const hipblasDoubleComplex* B,
+                                  const int                   ldb,
+                                  hipblasDoubleComplex*       X,
+                                  const int                   ldx,
+                                  int*                        iter,
+                                  int*                        info,
+                                  int*                        deviceInfo);
+
+// gesv_batched
+hipblasStatus_t hipblasZCgesvBatchedCast(hipblasHandle_t                   handle,
+                                         const int                         n,
+                                         const int                         nrhs,
+                                         hipblasDoubleComplex* const       A[],
+                                         const int                         lda,
+                                         int*                              ipiv,
+                                         const hipblasDoubleComplex* const B[],
+                                         const int                         ldb,
+                                         hipblasDoubleComplex* const       X[],
+                                         const int                         ldx,
+                                         int*                              iter,
+                                         int*                              info,
+                                         int*                              deviceInfo,
+                                         const int                         batchCount);
+
+// gesv_strided_batched
+hipblasStatus_t hipblasZCgesvStridedBatchedCast(hipblasHandle_t             handle,
+                                                const int                   n,
+                                                const int                   nrhs,
+                                                hipblasDoubleComplex*       A,
+                                                const int                   lda,
+                                                const hipblasStride         strideA,
+                                                int*                        ipiv,
+                                                const hipblasStride         strideP,
+                                                const hipblasDoubleComplex* B,
+                                                const int                   ldb,
+                                                const hipblasStride         strideB,
+                                                hipblasDoubleComplex*       X,
+                                                const int                   ldx,
+                                                const hipblasStride         strideX,
+                                                int*                        iter,
+                                                int*                        info,
+                                                int*                        deviceInfo,
+                                                const int                   batchCount);
+
+// getrs_64
+hipblasStatus_t hipblasCgetrsCast_64(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int64_t            n,
+                                     const int64_t            nrhs,
+                                     hipblasComplex*          A,
+                                     const int64_t            lda,
+                                     const int64_t*           ipiv,
+                                     hipblasComplex*          B,
+                                     const int64_t            ldb,
+                                     int64_t*                 info);
+
+hipblasStatus_t hipblasZgetrsCast_64(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int64_t            n,
+                                     const int64_t            nrhs,
+                                     hipblasDoubleComplex*    A,
+                                     const int64_t            lda,
+                                     const int64_t*           ipiv,
+                                     hipblasDoubleComplex*    B,
+                                     const int64_t            ldb,
+                                     int64_t*                 info);
+
+hipblasStatus_t hipblasCgetrsBatchedCast_64(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int64_t            n,
+                                            const int64_t            nrhs,
+                                            hipblasComplex* const    A[],
+                                            const int64_t            lda,
+                                            const int64_t*           ipiv,
+                                            hipblasComplex* const    B[],
+                                            const int64_t            ldb,
+                                            int64_t*                 info,
+                                            const int64_t            batchCount);
+
+hipblasStatus_t hipblasZgetrsBatchedCast_64(hipblasHandle_t             handle,
+                                            const hipblasOperation_t    trans,
+                                            const int64_t               n,
+                                            const int64_t               nrhs,
+                                            hipblasDoubleComplex* const A[],
+                                            const int64_t               lda,
+                                            const int64_t*              ipiv,
+                                            hipblasDoubleComplex* const B[],
+                                            const int64_t               ldb,
+                                            int64_t*                    info,
+                                            const int64_t               batchCount);
+
+hipblasStatus_t hipblasCgetrsStridedBatchedCast_64(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int64_t            n,
+                                                   const int64_t            nrhs,
+                                                   hipblasComplex*          A,
+                                                   const int64_t            lda,
+                                                   const hipblasStride      strideA,
+                                                   const int64_t*           ipiv,
+                                                   const hipblasStride      strideP,
+                                                   hipblasComplex*          B,
+                                                   const int64_t            ldb,
+                                                   const hipblasStride      strideB,
+                                                   int64_t*                 info,
+                                                   const int64_t            batchCount);
+
+hipblasStatus_t hipblasZgetrsStridedBatchedCast_64(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int64_t            n,
+                                                   const int64_t            nrhs,
+                                                   hipblasDoubleComplex*    A,
+                                                   const int64_t            lda,
+                                                   const hipblasStride      strideA,
+                                                   const int64_t*           ipiv,
+                                                   const hipblasStride      strideP,
+                                                   hipblasDoubleComplex*    B,
+                                                   const int64_t            ldb,
+                                                   const hipblasStride      strideB,
+                                                   int64_t*                 info,
+                                                   const int64_t            batchCount);
+
 // geqrf
 hipblasStatus_t hipblasCgeqrfCast(hipblasHandle_t handle,
                                   const int       m,
@@ -4467,6 +7696,63 @@ hipblasStatus_t hipblasZgeqrfStridedBatchedCast(hipblasHandle_t       handle,
                                                 int*                  info,
                                                 const int             batchCount);
 
+// geqrf_64
+hipblasStatus_t hipblasCgeqrfCast_64(hipblasHandle_t handle,
+                                     const int64_t   m,
+                                     const int64_t   n,
+                                     hipblasComplex* A,
+                                     const int64_t   lda,
+                                     hipblasComplex* ipiv,
+                                     int64_t*        info);
+
+hipblasStatus_t hipblasZgeqrfCast_64(hipblasHandle_t       handle,
+                                     const int64_t         m,
+                                     const int64_t         n,
+                                     hipblasDoubleComplex* A,
+                                     const int64_t         lda,
+                                     hipblasDoubleComplex* ipiv,
+                                     int64_t*              info);
+
+hipblasStatus_t hipblasCgeqrfBatchedCast_64(hipblasHandle_t       handle,
+                                            const int64_t         m,
+                                            const int64_t         n,
+                                            hipblasComplex* const A[],
+                                            const int64_t         lda,
+                                            hipblasComplex* const ipiv[],
+                                            int64_t*              info,
+                                            const int64_t         batchCount);
+
+hipblasStatus_t hipblasZgeqrfBatchedCast_64(hipblasHandle_t             handle,
+                                            const int64_t               m,
+                                            const int64_t               n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int64_t               lda,
+                                            hipblasDoubleComplex* const ipiv[],
+                                            int64_t*                    info,
+                                            const int64_t               batchCount);
+
+hipblasStatus_t hipblasCgeqrfStridedBatchedCast_64(hipblasHandle_t     handle,
+                                                   const int64_t       m,
+                                                   const int64_t       n,
+                                                   hipblasComplex*     A,
+                                                   const int64_t       lda,
+                                                   const hipblasStride strideA,
+                                                   hipblasComplex*     ipiv,
+                                                   const hipblasStride strideP,
+                                                   int64_t*            info,
+                                                   const int64_t       batchCount);
+
+hipblasStatus_t hipblasZgeqrfStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                   const int64_t         m,
+                                                   const int64_t         n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int64_t         lda,
+                                                   const hipblasStride   strideA,
+                                                   hipblasDoubleComplex* ipiv,
+                                                   const hipblasStride   strideP,
+                                                   int64_t*              info,
+                                                   const int64_t         batchCount);
+
 // gels
 hipblasStatus_t hipblasCgelsCast(hipblasHandle_t    handle,
                                  hipblasOperation_t trans,
@@ -4548,6 +7834,87 @@ hipblasStatus_t hipblasZgelsStridedBatchedCast(hipblasHandle_t       handle,
                                                int*                  deviceInfo,
                                                const int             batchCount);
 
+// gels_64
+hipblasStatus_t hipblasCgelsCast_64(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int64_t      m,
+                                    const int64_t      n,
+                                    const int64_t      nrhs,
+                                    hipblasComplex*    A,
+                                    const int64_t      lda,
+                                    hipblasComplex*    B,
+                                    const int64_t      ldb,
+                                    int64_t*           info,
+                                    int64_t*           deviceInfo);
+
+hipblasStatus_t hipblasZgelsCast_64(hipblasHandle_t       handle,
+                                    hipblasOperation_t    trans,
+                                    const int64_t         m,
+                                    const int64_t         n,
+                                    const int64_t         nrhs,
+                                    hipblasDoubleComplex* A,
+                                    const int64_t         lda,
+                                    hipblasDoubleComplex* B,
+                                    const int64_t         ldb,
+                                    int64_t*              info,
+                                    int64_t*              deviceInfo);
+
+hipblasStatus_t hipblasCgelsBatchedCast_64(hipblasHandle_t       handle,
+                                           hipblasOperation_t    trans,
+                                           const int64_t         m,
+                                           const int64_t         n,
+                                           const int64_t         nrhs,
+                                           hipblasComplex* const A[],
+                                           const int64_t         lda,
+                                           hipblasComplex* const B[],
+                                           const int64_t         ldb,
+                                           int64_t*              info,
+                                           int64_t*              deviceInfo,
+                                           const int64_t         batchCount);
+
+hipblasStatus_t hipblasZgelsBatchedCast_64(hipblasHandle_t             handle,
+                                           hipblasOperation_t          trans,
+                                           const int64_t               m,
+                                           const int64_t               n,
+                                           const int64_t               nrhs,
+                                           hipblasDoubleComplex* const A[],
+                                           const int64_t               lda,
+                                           hipblasDoubleComplex* const B[],
+                                           const int64_t               ldb,
+                                           int64_t*                    info,
+                                           int64_t*                    deviceInfo,
+                                           const int64_t               batchCount);
+
+hipblasStatus_t hipblasCgelsStridedBatchedCast_64(hipblasHandle_t     handle,
+                                                  hipblasOperation_t  trans,
+                                                  const int64_t       m,
+                                                  const int64_t       n,
+                                                  const int64_t       nrhs,
+                                                  hipblasComplex*     A,
+                                                  const int64_t       lda,
+                                                  const hipblasStride strideA,
+                                                  hipblasComplex*     B,
+                                                  const int64_t       ldb,
+                                                  const hipblasStride strideB,
+                                                  int64_t*            info,
+                                                  int64_t*            deviceInfo,
+                                                  const int64_t       batchCount);
+
+hipblasStatus_t hipblasZgelsStridedBatchedCast_64(hipblasHandle_t       handle,
+                                                  hipblasOperation_t    trans,
+                                                  const int64_t         m,
+                                                  const int64_t         n,
+                                                  const int64_t         nrhs,
+                                                  hipblasDoubleComplex* A,
+                                                  const int64_t         lda,
+                                                  const hipblasStride   strideA,
+                                                  hipblasDoubleComplex* B,
+                                                  const int64_t         ldb,
+                                                  const hipblasStride   strideB,
+                                                  int64_t*              info,
+                                                  int64_t*              deviceInfo,
+                                                  const int64_t         batchCount);
+
 #endif
 
 namespace
@@ -5517,26 +8884,68 @@ namespace
                                                 hipblasStride   strideA,
                                                 int             batch_count);
 
-    MAP2CF(hipblasGer, float, false, hipblasSger);
-    MAP2CF(hipblasGer, double, false, hipblasDger);
-    MAP2CF_V2(hipblasGer, hipblasComplex, false, hipblasCgeru);
-    MAP2CF_V2(hipblasGer, hipblasDoubleComplex, false, hipblasZgeru);
-    MAP2CF_V2(hipblasGer, hipblasComplex, true, hipblasCgerc);
-    MAP2CF_V2(hipblasGer, hipblasDoubleComplex, true, hipblasZgerc);
-
-    MAP2CF(hipblasGerBatched, float, false, hipblasSgerBatched);
-    MAP2CF(hipblasGerBatched, double, false, hipblasDgerBatched);
-    MAP2CF_V2(hipblasGerBatched, hipblasComplex, false, hipblasCgeruBatched);
-    MAP2CF_V2(hipblasGerBatched, hipblasDoubleComplex, false, hipblasZgeruBatched);
-    MAP2CF_V2(hipblasGerBatched, hipblasComplex, true, hipblasCgercBatched);
-    MAP2CF_V2(hipblasGerBatched, hipblasDoubleComplex, true, hipblasZgercBatched);
-
-    MAP2CF(hipblasGerStridedBatched, float, false, hipblasSgerStridedBatched);
-    MAP2CF(hipblasGerStridedBatched, double, false, hipblasDgerStridedBatched);
-    MAP2CF_V2(hipblasGerStridedBatched, hipblasComplex, false, hipblasCgeruStridedBatched);
-    MAP2CF_V2(hipblasGerStridedBatched, hipblasDoubleComplex, false, hipblasZgeruStridedBatched);
-    MAP2CF_V2(hipblasGerStridedBatched, hipblasComplex, true, hipblasCgercStridedBatched);
-    MAP2CF_V2(hipblasGerStridedBatched, hipblasDoubleComplex, true, hipblasZgercStridedBatched);
+    template <typename T, bool CONJ, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGer_64)(hipblasHandle_t handle,
+                                     int64_t         m,
+                                     int64_t         n,
+                                     const T*        alpha,
+                                     const T*        x,
+                                     int64_t         incx,
+                                     const T*        y,
+                                     int64_t         incy,
+                                     T*              A,
+                                     int64_t         lda);
+
+    template <typename T, bool CONJ, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGerBatched_64)(hipblasHandle_t handle,
+                                            int64_t         m,
+                                            int64_t         n,
+                                            const T*        alpha,
+                                            const T* const  x[],
+                                            int64_t         incx,
+                                            const T* const  y[],
+                                            int64_t         incy,
+                                            T* const        A[],
+                                            int64_t         lda,
+                                            int64_t         batch_count);
+
+    template <typename T, bool CONJ, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGerStridedBatched_64)(hipblasHandle_t handle,
+                                                   int64_t         m,
+                                                   int64_t         n,
+                                                   const T*        alpha,
+                                                   const T*        x,
+                                                   int64_t         incx,
+                                                   hipblasStride   stridex,
+                                                   const T*        y,
+                                                   int64_t         incy,
+                                                   hipblasStride   stridey,
+                                                   T*              A,
+                                                   int64_t         lda,
+                                                   hipblasStride   strideA,
+                                                   int64_t         batch_count);
+
+    MAP2CF_D64(hipblasGer, float, false, hipblasSger);
+    MAP2CF_D64(hipblasGer, double, false, hipblasDger);
+    MAP2CF_D64_V2(hipblasGer, hipblasComplex, false, hipblasCgeru);
+    MAP2CF_D64_V2(hipblasGer, hipblasDoubleComplex, false, hipblasZgeru);
+    MAP2CF_D64_V2(hipblasGer, hipblasComplex, true, hipblasCgerc);
+    MAP2CF_D64_V2(hipblasGer, hipblasDoubleComplex, true, hipblasZgerc);
+
+    MAP2CF_D64(hipblasGerBatched, float, false, hipblasSgerBatched);
+    MAP2CF_D64(hipblasGerBatched, double, false, hipblasDgerBatched);
+    MAP2CF_D64_V2(hipblasGerBatched, hipblasComplex, false, hipblasCgeruBatched);
+    MAP2CF_D64_V2(hipblasGerBatched, hipblasDoubleComplex, false, hipblasZgeruBatched);
+    MAP2CF_D64_V2(hipblasGerBatched, hipblasComplex, true, hipblasCgercBatched);
+    MAP2CF_D64_V2(hipblasGerBatched, hipblasDoubleComplex, true, hipblasZgercBatched);
+
+    MAP2CF_D64(hipblasGerStridedBatched, float, false, hipblasSgerStridedBatched);
+    MAP2CF_D64(hipblasGerStridedBatched, double, false, hipblasDgerStridedBatched);
+    MAP2CF_D64_V2(hipblasGerStridedBatched, hipblasComplex, false, hipblasCgeruStridedBatched);
+    MAP2CF_D64_V2(
+        hipblasGerStridedBatched, hipblasDoubleComplex, false, hipblasZgeruStridedBatched);
+    MAP2CF_D64_V2(hipblasGerStridedBatched, hipblasComplex, true, hipblasCgercStridedBatched);
+    MAP2CF_D64_V2(hipblasGerStridedBatched, hipblasDoubleComplex, true, hipblasZgercStridedBatched);
 
     // hbmv
     template <typename T, bool FORTRAN = false>
@@ -5586,14 +8995,61 @@ namespace
                                                  hipblasStride     stridey,
                                                  int               batchCount);
 
-    MAP2CF_V2(hipblasHbmv, hipblasComplex, hipblasChbmv);
-    MAP2CF_V2(hipblasHbmv, hipblasDoubleComplex, hipblasZhbmv);
-
-    MAP2CF_V2(hipblasHbmvBatched, hipblasComplex, hipblasChbmvBatched);
-    MAP2CF_V2(hipblasHbmvBatched, hipblasDoubleComplex, hipblasZhbmvBatched);
-
-    MAP2CF_V2(hipblasHbmvStridedBatched, hipblasComplex, hipblasChbmvStridedBatched);
-    MAP2CF_V2(hipblasHbmvStridedBatched, hipblasDoubleComplex, hipblasZhbmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHbmv_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      int64_t           k,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      int64_t           lda,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          beta,
+                                      T*                y,
+                                      int64_t           incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHbmvBatched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             int64_t           k,
+                                             const T*          alpha,
+                                             const T* const    A[],
+                                             int64_t           lda,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T*          beta,
+                                             T* const          y[],
+                                             int64_t           incy,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHbmvStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    int64_t           k,
+                                                    const T*          alpha,
+                                                    const T*          A,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          beta,
+                                                    T*                y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64_V2(hipblasHbmv, hipblasComplex, hipblasChbmv);
+    MAP2CF_D64_V2(hipblasHbmv, hipblasDoubleComplex, hipblasZhbmv);
+
+    MAP2CF_D64_V2(hipblasHbmvBatched, hipblasComplex, hipblasChbmvBatched);
+    MAP2CF_D64_V2(hipblasHbmvBatched, hipblasDoubleComplex, hipblasZhbmvBatched);
+
+    MAP2CF_D64_V2(hipblasHbmvStridedBatched, hipblasComplex, hipblasChbmvStridedBatched);
+    MAP2CF_D64_V2(hipblasHbmvStridedBatched, hipblasDoubleComplex, hipblasZhbmvStridedBatched);
 
     // hemv
     template <typename T, bool FORTRAN = false>
@@ -5640,14 +9096,58 @@ namespace
                                                  hipblasStride     stride_y,
                                                  int               batch_count);
 
-    MAP2CF_V2(hipblasHemv, hipblasComplex, hipblasChemv);
-    MAP2CF_V2(hipblasHemv, hipblasDoubleComplex, hipblasZhemv);
-
-    MAP2CF_V2(hipblasHemvBatched, hipblasComplex, hipblasChemvBatched);
-    MAP2CF_V2(hipblasHemvBatched, hipblasDoubleComplex, hipblasZhemvBatched);
-
-    MAP2CF_V2(hipblasHemvStridedBatched, hipblasComplex, hipblasChemvStridedBatched);
-    MAP2CF_V2(hipblasHemvStridedBatched, hipblasDoubleComplex, hipblasZhemvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHemv_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      int64_t           lda,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          beta,
+                                      T*                y,
+                                      int64_t           incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHemvBatched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    A[],
+                                             int64_t           lda,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T*          beta,
+                                             T* const          y[],
+                                             int64_t           incy,
+                                             int64_t           batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHemvStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          A,
+                                                    int64_t           lda,
+                                                    hipblasStride     stride_a,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stride_x,
+                                                    const T*          beta,
+                                                    T*                y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stride_y,
+                                                    int64_t           batch_count);
+
+    MAP2CF_D64_V2(hipblasHemv, hipblasComplex, hipblasChemv);
+    MAP2CF_D64_V2(hipblasHemv, hipblasDoubleComplex, hipblasZhemv);
+
+    MAP2CF_D64_V2(hipblasHemvBatched, hipblasComplex, hipblasChemvBatched);
+    MAP2CF_D64_V2(hipblasHemvBatched, hipblasDoubleComplex, hipblasZhemvBatched);
+
+    MAP2CF_D64_V2(hipblasHemvStridedBatched, hipblasComplex, hipblasChemvStridedBatched);
+    MAP2CF_D64_V2(hipblasHemvStridedBatched, hipblasDoubleComplex, hipblasZhemvStridedBatched);
 
     // her
     template <typename T, typename U, bool FORTRAN = false>
@@ -5684,14 +9184,49 @@ namespace
                                                 hipblasStride     strideA,
                                                 int               batchCount);
 
-    MAP2CF_V2(hipblasHer, hipblasComplex, float, hipblasCher);
-    MAP2CF_V2(hipblasHer, hipblasDoubleComplex, double, hipblasZher);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHer_64)(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     int64_t           n,
+                                     const U*          alpha,
+                                     const T*          x,
+                                     int64_t           incx,
+                                     T*                A,
+                                     int64_t           lda);
 
-    MAP2CF_V2(hipblasHerBatched, hipblasComplex, float, hipblasCherBatched);
-    MAP2CF_V2(hipblasHerBatched, hipblasDoubleComplex, double, hipblasZherBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerBatched_64)(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int64_t           n,
+                                            const U*          alpha,
+                                            const T* const    x[],
+                                            int64_t           incx,
+                                            T* const          A[],
+                                            int64_t           lda,
+                                            int64_t           batchCount);
 
-    MAP2CF_V2(hipblasHerStridedBatched, hipblasComplex, float, hipblasCherStridedBatched);
-    MAP2CF_V2(hipblasHerStridedBatched, hipblasDoubleComplex, double, hipblasZherStridedBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerStridedBatched_64)(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int64_t           n,
+                                                   const U*          alpha,
+                                                   const T*          x,
+                                                   int64_t           incx,
+                                                   hipblasStride     stridex,
+                                                   T*                A,
+                                                   int64_t           lda,
+                                                   hipblasStride     strideA,
+                                                   int64_t           batchCount);
+
+    MAP2CF_D64_V2(hipblasHer, hipblasComplex, float, hipblasCher);
+    MAP2CF_D64_V2(hipblasHer, hipblasDoubleComplex, double, hipblasZher);
+
+    MAP2CF_D64_V2(hipblasHerBatched, hipblasComplex, float, hipblasCherBatched);
+    MAP2CF_D64_V2(hipblasHerBatched, hipblasDoubleComplex, double, hipblasZherBatched);
+
+    MAP2CF_D64_V2(hipblasHerStridedBatched, hipblasComplex, float, hipblasCherStridedBatched);
+    MAP2CF_D64_V2(
+        hipblasHerStridedBatched, hipblasDoubleComplex, double, hipblasZherStridedBatched);
 
     // her2
     template <typename T, bool FORTRAN = false>
@@ -5735,14 +9270,55 @@ namespace
                                                  hipblasStride     strideA,
                                                  int               batchCount);
 
-    MAP2CF_V2(hipblasHer2, hipblasComplex, hipblasCher2);
-    MAP2CF_V2(hipblasHer2, hipblasDoubleComplex, hipblasZher2);
-
-    MAP2CF_V2(hipblasHer2Batched, hipblasComplex, hipblasCher2Batched);
-    MAP2CF_V2(hipblasHer2Batched, hipblasDoubleComplex, hipblasZher2Batched);
-
-    MAP2CF_V2(hipblasHer2StridedBatched, hipblasComplex, hipblasCher2StridedBatched);
-    MAP2CF_V2(hipblasHer2StridedBatched, hipblasDoubleComplex, hipblasZher2StridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHer2_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          y,
+                                      int64_t           incy,
+                                      T*                A,
+                                      int64_t           lda);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHer2Batched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T* const    y[],
+                                             int64_t           incy,
+                                             T* const          A[],
+                                             int64_t           lda,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHer2StridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    T*                A,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64_V2(hipblasHer2, hipblasComplex, hipblasCher2);
+    MAP2CF_D64_V2(hipblasHer2, hipblasDoubleComplex, hipblasZher2);
+
+    MAP2CF_D64_V2(hipblasHer2Batched, hipblasComplex, hipblasCher2Batched);
+    MAP2CF_D64_V2(hipblasHer2Batched, hipblasDoubleComplex, hipblasZher2Batched);
+
+    MAP2CF_D64_V2(hipblasHer2StridedBatched, hipblasComplex, hipblasCher2StridedBatched);
+    MAP2CF_D64_V2(hipblasHer2StridedBatched, hipblasDoubleComplex, hipblasZher2StridedBatched);
 
     // hpmv
     template <typename T, bool FORTRAN = false>
@@ -5786,14 +9362,55 @@ namespace
                                                  hipblasStride     stridey,
                                                  int               batchCount);
 
-    MAP2CF_V2(hipblasHpmv, hipblasComplex, hipblasChpmv);
-    MAP2CF_V2(hipblasHpmv, hipblasDoubleComplex, hipblasZhpmv);
-
-    MAP2CF_V2(hipblasHpmvBatched, hipblasComplex, hipblasChpmvBatched);
-    MAP2CF_V2(hipblasHpmvBatched, hipblasDoubleComplex, hipblasZhpmvBatched);
-
-    MAP2CF_V2(hipblasHpmvStridedBatched, hipblasComplex, hipblasChpmvStridedBatched);
-    MAP2CF_V2(hipblasHpmvStridedBatched, hipblasDoubleComplex, hipblasZhpmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHpmv_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          AP,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          beta,
+                                      T*                y,
+                                      int64_t           incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHpmvBatched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    AP[],
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T*          beta,
+                                             T* const          y[],
+                                             int64_t           incy,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHpmvStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          AP,
+                                                    hipblasStride     strideAP,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          beta,
+                                                    T*                y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64_V2(hipblasHpmv, hipblasComplex, hipblasChpmv);
+    MAP2CF_D64_V2(hipblasHpmv, hipblasDoubleComplex, hipblasZhpmv);
+
+    MAP2CF_D64_V2(hipblasHpmvBatched, hipblasComplex, hipblasChpmvBatched);
+    MAP2CF_D64_V2(hipblasHpmvBatched, hipblasDoubleComplex, hipblasZhpmvBatched);
+
+    MAP2CF_D64_V2(hipblasHpmvStridedBatched, hipblasComplex, hipblasChpmvStridedBatched);
+    MAP2CF_D64_V2(hipblasHpmvStridedBatched, hipblasDoubleComplex, hipblasZhpmvStridedBatched);
 
     // hpr
     template <typename T, typename U, bool FORTRAN = false>
@@ -5827,14 +9444,46 @@ namespace
                                                 hipblasStride     strideAP,
                                                 int               batchCount);
 
-    MAP2CF_V2(hipblasHpr, hipblasComplex, float, hipblasChpr);
-    MAP2CF_V2(hipblasHpr, hipblasDoubleComplex, double, hipblasZhpr);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHpr_64)(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     int64_t           n,
+                                     const U*          alpha,
+                                     const T*          x,
+                                     int64_t           incx,
+                                     T*                AP);
 
-    MAP2CF_V2(hipblasHprBatched, hipblasComplex, float, hipblasChprBatched);
-    MAP2CF_V2(hipblasHprBatched, hipblasDoubleComplex, double, hipblasZhprBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHprBatched_64)(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int64_t           n,
+                                            const U*          alpha,
+                                            const T* const    x[],
+                                            int64_t           incx,
+                                            T* const          AP[],
+                                            int64_t           batchCount);
 
-    MAP2CF_V2(hipblasHprStridedBatched, hipblasComplex, float, hipblasChprStridedBatched);
-    MAP2CF_V2(hipblasHprStridedBatched, hipblasDoubleComplex, double, hipblasZhprStridedBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHprStridedBatched_64)(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int64_t           n,
+                                                   const U*          alpha,
+                                                   const T*          x,
+                                                   int64_t           incx,
+                                                   hipblasStride     stridex,
+                                                   T*                AP,
+                                                   hipblasStride     strideAP,
+                                                   int64_t           batchCount);
+
+    MAP2CF_D64_V2(hipblasHpr, hipblasComplex, float, hipblasChpr);
+    MAP2CF_D64_V2(hipblasHpr, hipblasDoubleComplex, double, hipblasZhpr);
+
+    MAP2CF_D64_V2(hipblasHprBatched, hipblasComplex, float, hipblasChprBatched);
+    MAP2CF_D64_V2(hipblasHprBatched, hipblasDoubleComplex, double, hipblasZhprBatched);
+
+    MAP2CF_D64_V2(hipblasHprStridedBatched, hipblasComplex, float, hipblasChprStridedBatched);
+    MAP2CF_D64_V2(
+        hipblasHprStridedBatched, hipblasDoubleComplex, double, hipblasZhprStridedBatched);
 
     // hpr2
     template <typename T, bool FORTRAN = false>
@@ -5875,14 +9524,52 @@ namespace
                                                  hipblasStride     strideAP,
                                                  int               batchCount);
 
-    MAP2CF_V2(hipblasHpr2, hipblasComplex, hipblasChpr2);
-    MAP2CF_V2(hipblasHpr2, hipblasDoubleComplex, hipblasZhpr2);
-
-    MAP2CF_V2(hipblasHpr2Batched, hipblasComplex, hipblasChpr2Batched);
-    MAP2CF_V2(hipblasHpr2Batched, hipblasDoubleComplex, hipblasZhpr2Batched);
-
-    MAP2CF_V2(hipblasHpr2StridedBatched, hipblasComplex, hipblasChpr2StridedBatched);
-    MAP2CF_V2(hipblasHpr2StridedBatched, hipblasDoubleComplex, hipblasZhpr2StridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHpr2_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          y,
+                                      int64_t           incy,
+                                      T*                AP);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHpr2Batched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T* const    y[],
+                                             int64_t           incy,
+                                             T* const          AP[],
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHpr2StridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    T*                AP,
+                                                    hipblasStride     strideAP,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64_V2(hipblasHpr2, hipblasComplex, hipblasChpr2);
+    MAP2CF_D64_V2(hipblasHpr2, hipblasDoubleComplex, hipblasZhpr2);
+
+    MAP2CF_D64_V2(hipblasHpr2Batched, hipblasComplex, hipblasChpr2Batched);
+    MAP2CF_D64_V2(hipblasHpr2Batched, hipblasDoubleComplex, hipblasZhpr2Batched);
+
+    MAP2CF_D64_V2(hipblasHpr2StridedBatched, hipblasComplex, hipblasChpr2StridedBatched);
+    MAP2CF_D64_V2(hipblasHpr2StridedBatched, hipblasDoubleComplex, hipblasZhpr2StridedBatched);
 
     // sbmv
     template <typename T, bool FORTRAN = false>
@@ -5932,14 +9619,61 @@ namespace
                                                  hipblasStride     stridey,
                                                  int               batchCount);
 
-    MAP2CF(hipblasSbmv, float, hipblasSsbmv);
-    MAP2CF(hipblasSbmv, double, hipblasDsbmv);
-
-    MAP2CF(hipblasSbmvBatched, float, hipblasSsbmvBatched);
-    MAP2CF(hipblasSbmvBatched, double, hipblasDsbmvBatched);
-
-    MAP2CF(hipblasSbmvStridedBatched, float, hipblasSsbmvStridedBatched);
-    MAP2CF(hipblasSbmvStridedBatched, double, hipblasDsbmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSbmv_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      int64_t           k,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      int64_t           lda,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          beta,
+                                      T*                y,
+                                      int64_t           incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSbmvBatched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             int64_t           k,
+                                             const T*          alpha,
+                                             const T* const    A[],
+                                             int64_t           lda,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T*          beta,
+                                             T* const          y[],
+                                             int64_t           incy,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSbmvStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    int64_t           k,
+                                                    const T*          alpha,
+                                                    const T*          A,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          beta,
+                                                    T*                y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64(hipblasSbmv, float, hipblasSsbmv);
+    MAP2CF_D64(hipblasSbmv, double, hipblasDsbmv);
+
+    MAP2CF_D64(hipblasSbmvBatched, float, hipblasSsbmvBatched);
+    MAP2CF_D64(hipblasSbmvBatched, double, hipblasDsbmvBatched);
+
+    MAP2CF_D64(hipblasSbmvStridedBatched, float, hipblasSsbmvStridedBatched);
+    MAP2CF_D64(hipblasSbmvStridedBatched, double, hipblasDsbmvStridedBatched);
 
     // spmv
     template <typename T, bool FORTRAN = false>
@@ -5983,14 +9717,55 @@ namespace
                                                  hipblasStride     stridey,
                                                  int               batchCount);
 
-    MAP2CF(hipblasSpmv, float, hipblasSspmv);
-    MAP2CF(hipblasSpmv, double, hipblasDspmv);
-
-    MAP2CF(hipblasSpmvBatched, float, hipblasSspmvBatched);
-    MAP2CF(hipblasSpmvBatched, double, hipblasDspmvBatched);
-
-    MAP2CF(hipblasSpmvStridedBatched, float, hipblasSspmvStridedBatched);
-    MAP2CF(hipblasSpmvStridedBatched, double, hipblasDspmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSpmv_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          AP,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          beta,
+                                      T*                y,
+                                      int64_t           incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSpmvBatched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    AP[],
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T*          beta,
+                                             T* const          y[],
+                                             int64_t           incy,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSpmvStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          AP,
+                                                    hipblasStride     strideAP,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          beta,
+                                                    T*                y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64(hipblasSpmv, float, hipblasSspmv);
+    MAP2CF_D64(hipblasSpmv, double, hipblasDspmv);
+
+    MAP2CF_D64(hipblasSpmvBatched, float, hipblasSspmvBatched);
+    MAP2CF_D64(hipblasSpmvBatched, double, hipblasDspmvBatched);
+
+    MAP2CF_D64(hipblasSpmvStridedBatched, float, hipblasSspmvStridedBatched);
+    MAP2CF_D64(hipblasSpmvStridedBatched, double, hipblasDspmvStridedBatched);
 
     // spr
     template <typename T, bool FORTRAN = false>
@@ -6024,20 +9799,51 @@ namespace
                                                 hipblasStride     strideAP,
                                                 int               batchCount);
 
-    MAP2CF(hipblasSpr, float, hipblasSspr);
-    MAP2CF(hipblasSpr, double, hipblasDspr);
-    MAP2CF_V2(hipblasSpr, hipblasComplex, hipblasCspr);
-    MAP2CF_V2(hipblasSpr, hipblasDoubleComplex, hipblasZspr);
-
-    MAP2CF(hipblasSprBatched, float, hipblasSsprBatched);
-    MAP2CF(hipblasSprBatched, double, hipblasDsprBatched);
-    MAP2CF_V2(hipblasSprBatched, hipblasComplex, hipblasCsprBatched);
-    MAP2CF_V2(hipblasSprBatched, hipblasDoubleComplex, hipblasZsprBatched);
-
-    MAP2CF(hipblasSprStridedBatched, float, hipblasSsprStridedBatched);
-    MAP2CF(hipblasSprStridedBatched, double, hipblasDsprStridedBatched);
-    MAP2CF_V2(hipblasSprStridedBatched, hipblasComplex, hipblasCsprStridedBatched);
-    MAP2CF_V2(hipblasSprStridedBatched, hipblasDoubleComplex, hipblasZsprStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSpr_64)(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     int64_t           n,
+                                     const T*          alpha,
+                                     const T*          x,
+                                     int64_t           incx,
+                                     T*                AP);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSprBatched_64)(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int64_t           n,
+                                            const T*          alpha,
+                                            const T* const    x[],
+                                            int64_t           incx,
+                                            T* const          AP[],
+                                            int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSprStridedBatched_64)(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int64_t           n,
+                                                   const T*          alpha,
+                                                   const T*          x,
+                                                   int64_t           incx,
+                                                   hipblasStride     stridex,
+                                                   T*                AP,
+                                                   hipblasStride     strideAP,
+                                                   int64_t           batchCount);
+
+    MAP2CF_D64(hipblasSpr, float, hipblasSspr);
+    MAP2CF_D64(hipblasSpr, double, hipblasDspr);
+    MAP2CF_D64_V2(hipblasSpr, hipblasComplex, hipblasCspr);
+    MAP2CF_D64_V2(hipblasSpr, hipblasDoubleComplex, hipblasZspr);
+
+    MAP2CF_D64(hipblasSprBatched, float, hipblasSsprBatched);
+    MAP2CF_D64(hipblasSprBatched, double, hipblasDsprBatched);
+    MAP2CF_D64_V2(hipblasSprBatched, hipblasComplex, hipblasCsprBatched);
+    MAP2CF_D64_V2(hipblasSprBatched, hipblasDoubleComplex, hipblasZsprBatched);
+
+    MAP2CF_D64(hipblasSprStridedBatched, float, hipblasSsprStridedBatched);
+    MAP2CF_D64(hipblasSprStridedBatched, double, hipblasDsprStridedBatched);
+    MAP2CF_D64_V2(hipblasSprStridedBatched, hipblasComplex, hipblasCsprStridedBatched);
+    MAP2CF_D64_V2(hipblasSprStridedBatched, hipblasDoubleComplex, hipblasZsprStridedBatched);
 
     // spr2
     template <typename T, bool FORTRAN = false>
@@ -6078,14 +9884,52 @@ namespace
                                                  hipblasStride     strideAP,
                                                  int               batchCount);
 
-    MAP2CF(hipblasSpr2, float, hipblasSspr2);
-    MAP2CF(hipblasSpr2, double, hipblasDspr2);
-
-    MAP2CF(hipblasSpr2Batched, float, hipblasSspr2Batched);
-    MAP2CF(hipblasSpr2Batched, double, hipblasDspr2Batched);
-
-    MAP2CF(hipblasSpr2StridedBatched, float, hipblasSspr2StridedBatched);
-    MAP2CF(hipblasSpr2StridedBatched, double, hipblasDspr2StridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSpr2_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          y,
+                                      int64_t           incy,
+                                      T*                AP);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSpr2Batched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T* const    y[],
+                                             int64_t           incy,
+                                             T* const          AP[],
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSpr2StridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    T*                AP,
+                                                    hipblasStride     strideAP,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64(hipblasSpr2, float, hipblasSspr2);
+    MAP2CF_D64(hipblasSpr2, double, hipblasDspr2);
+
+    MAP2CF_D64(hipblasSpr2Batched, float, hipblasSspr2Batched);
+    MAP2CF_D64(hipblasSpr2Batched, double, hipblasDspr2Batched);
+
+    MAP2CF_D64(hipblasSpr2StridedBatched, float, hipblasSspr2StridedBatched);
+    MAP2CF_D64(hipblasSpr2StridedBatched, double, hipblasDspr2StridedBatched);
 
     // symv
     template <typename T, bool FORTRAN = false>
@@ -6132,20 +9976,64 @@ namespace
                                                  hipblasStride     stridey,
                                                  int               batchCount);
 
-    MAP2CF(hipblasSymv, float, hipblasSsymv);
-    MAP2CF(hipblasSymv, double, hipblasDsymv);
-    MAP2CF_V2(hipblasSymv, hipblasComplex, hipblasCsymv);
-    MAP2CF_V2(hipblasSymv, hipblasDoubleComplex, hipblasZsymv);
-
-    MAP2CF(hipblasSymvBatched, float, hipblasSsymvBatched);
-    MAP2CF(hipblasSymvBatched, double, hipblasDsymvBatched);
-    MAP2CF_V2(hipblasSymvBatched, hipblasComplex, hipblasCsymvBatched);
-    MAP2CF_V2(hipblasSymvBatched, hipblasDoubleComplex, hipblasZsymvBatched);
-
-    MAP2CF(hipblasSymvStridedBatched, float, hipblasSsymvStridedBatched);
-    MAP2CF(hipblasSymvStridedBatched, double, hipblasDsymvStridedBatched);
-    MAP2CF_V2(hipblasSymvStridedBatched, hipblasComplex, hipblasCsymvStridedBatched);
-    MAP2CF_V2(hipblasSymvStridedBatched, hipblasDoubleComplex, hipblasZsymvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSymv_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      int64_t           lda,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          beta,
+                                      T*                y,
+                                      int64_t           incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSymvBatched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    A[],
+                                             int64_t           lda,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T*          beta,
+                                             T* const          y[],
+                                             int64_t           incy,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSymvStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          A,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          beta,
+                                                    T*                y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64(hipblasSymv, float, hipblasSsymv);
+    MAP2CF_D64(hipblasSymv, double, hipblasDsymv);
+    MAP2CF_D64_V2(hipblasSymv, hipblasComplex, hipblasCsymv);
+    MAP2CF_D64_V2(hipblasSymv, hipblasDoubleComplex, hipblasZsymv);
+
+    MAP2CF_D64(hipblasSymvBatched, float, hipblasSsymvBatched);
+    MAP2CF_D64(hipblasSymvBatched, double, hipblasDsymvBatched);
+    MAP2CF_D64_V2(hipblasSymvBatched, hipblasComplex, hipblasCsymvBatched);
+    MAP2CF_D64_V2(hipblasSymvBatched, hipblasDoubleComplex, hipblasZsymvBatched);
+
+    MAP2CF_D64(hipblasSymvStridedBatched, float, hipblasSsymvStridedBatched);
+    MAP2CF_D64(hipblasSymvStridedBatched, double, hipblasDsymvStridedBatched);
+    MAP2CF_D64_V2(hipblasSymvStridedBatched, hipblasComplex, hipblasCsymvStridedBatched);
+    MAP2CF_D64_V2(hipblasSymvStridedBatched, hipblasDoubleComplex, hipblasZsymvStridedBatched);
 
     // syr
     template <typename T, bool FORTRAN = false>
@@ -6182,20 +10070,54 @@ namespace
                                                 hipblasStride     strideA,
                                                 int               batch_count);
 
-    MAP2CF(hipblasSyr, float, hipblasSsyr);
-    MAP2CF(hipblasSyr, double, hipblasDsyr);
-    MAP2CF_V2(hipblasSyr, hipblasComplex, hipblasCsyr);
-    MAP2CF_V2(hipblasSyr, hipblasDoubleComplex, hipblasZsyr);
-
-    MAP2CF(hipblasSyrBatched, float, hipblasSsyrBatched);
-    MAP2CF(hipblasSyrBatched, double, hipblasDsyrBatched);
-    MAP2CF_V2(hipblasSyrBatched, hipblasComplex, hipblasCsyrBatched);
-    MAP2CF_V2(hipblasSyrBatched, hipblasDoubleComplex, hipblasZsyrBatched);
-
-    MAP2CF(hipblasSyrStridedBatched, float, hipblasSsyrStridedBatched);
-    MAP2CF(hipblasSyrStridedBatched, double, hipblasDsyrStridedBatched);
-    MAP2CF_V2(hipblasSyrStridedBatched, hipblasComplex, hipblasCsyrStridedBatched);
-    MAP2CF_V2(hipblasSyrStridedBatched, hipblasDoubleComplex, hipblasZsyrStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyr_64)(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     int64_t           n,
+                                     const T*          alpha,
+                                     const T*          x,
+                                     int64_t           incx,
+                                     T*                A,
+                                     int64_t           lda);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrBatched_64)(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int64_t           n,
+                                            const T*          alpha,
+                                            const T* const    x[],
+                                            int64_t           incx,
+                                            T* const          A[],
+                                            int64_t           lda,
+                                            int64_t           batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrStridedBatched_64)(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int64_t           n,
+                                                   const T*          alpha,
+                                                   const T*          x,
+                                                   int64_t           incx,
+                                                   hipblasStride     stridex,
+                                                   T*                A,
+                                                   int64_t           lda,
+                                                   hipblasStride     strideA,
+                                                   int64_t           batch_count);
+
+    MAP2CF_D64(hipblasSyr, float, hipblasSsyr);
+    MAP2CF_D64(hipblasSyr, double, hipblasDsyr);
+    MAP2CF_D64_V2(hipblasSyr, hipblasComplex, hipblasCsyr);
+    MAP2CF_D64_V2(hipblasSyr, hipblasDoubleComplex, hipblasZsyr);
+
+    MAP2CF_D64(hipblasSyrBatched, float, hipblasSsyrBatched);
+    MAP2CF_D64(hipblasSyrBatched, double, hipblasDsyrBatched);
+    MAP2CF_D64_V2(hipblasSyrBatched, hipblasComplex, hipblasCsyrBatched);
+    MAP2CF_D64_V2(hipblasSyrBatched, hipblasDoubleComplex, hipblasZsyrBatched);
+
+    MAP2CF_D64(hipblasSyrStridedBatched, float, hipblasSsyrStridedBatched);
+    MAP2CF_D64(hipblasSyrStridedBatched, double, hipblasDsyrStridedBatched);
+    MAP2CF_D64_V2(hipblasSyrStridedBatched, hipblasComplex, hipblasCsyrStridedBatched);
+    MAP2CF_D64_V2(hipblasSyrStridedBatched, hipblasDoubleComplex, hipblasZsyrStridedBatched);
 
     // syr2
     template <typename T, bool FORTRAN = false>
@@ -6239,20 +10161,61 @@ namespace
                                                  hipblasStride     strideA,
                                                  int               batchCount);
 
-    MAP2CF(hipblasSyr2, float, hipblasSsyr2);
-    MAP2CF(hipblasSyr2, double, hipblasDsyr2);
-    MAP2CF_V2(hipblasSyr2, hipblasComplex, hipblasCsyr2);
-    MAP2CF_V2(hipblasSyr2, hipblasDoubleComplex, hipblasZsyr2);
-
-    MAP2CF(hipblasSyr2Batched, float, hipblasSsyr2Batched);
-    MAP2CF(hipblasSyr2Batched, double, hipblasDsyr2Batched);
-    MAP2CF_V2(hipblasSyr2Batched, hipblasComplex, hipblasCsyr2Batched);
-    MAP2CF_V2(hipblasSyr2Batched, hipblasDoubleComplex, hipblasZsyr2Batched);
-
-    MAP2CF(hipblasSyr2StridedBatched, float, hipblasSsyr2StridedBatched);
-    MAP2CF(hipblasSyr2StridedBatched, double, hipblasDsyr2StridedBatched);
-    MAP2CF_V2(hipblasSyr2StridedBatched, hipblasComplex, hipblasCsyr2StridedBatched);
-    MAP2CF_V2(hipblasSyr2StridedBatched, hipblasDoubleComplex, hipblasZsyr2StridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyr2_64)(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      const T*          y,
+                                      int64_t           incy,
+                                      T*                A,
+                                      int64_t           lda);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyr2Batched_64)(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             const T* const    y[],
+                                             int64_t           incy,
+                                             T* const          A[],
+                                             int64_t           lda,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyr2StridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stridex,
+                                                    const T*          y,
+                                                    int64_t           incy,
+                                                    hipblasStride     stridey,
+                                                    T*                A,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64(hipblasSyr2, float, hipblasSsyr2);
+    MAP2CF_D64(hipblasSyr2, double, hipblasDsyr2);
+    MAP2CF_D64_V2(hipblasSyr2, hipblasComplex, hipblasCsyr2);
+    MAP2CF_D64_V2(hipblasSyr2, hipblasDoubleComplex, hipblasZsyr2);
+
+    MAP2CF_D64(hipblasSyr2Batched, float, hipblasSsyr2Batched);
+    MAP2CF_D64(hipblasSyr2Batched, double, hipblasDsyr2Batched);
+    MAP2CF_D64_V2(hipblasSyr2Batched, hipblasComplex, hipblasCsyr2Batched);
+    MAP2CF_D64_V2(hipblasSyr2Batched, hipblasDoubleComplex, hipblasZsyr2Batched);
+
+    MAP2CF_D64(hipblasSyr2StridedBatched, float, hipblasSsyr2StridedBatched);
+    MAP2CF_D64(hipblasSyr2StridedBatched, double, hipblasDsyr2StridedBatched);
+    MAP2CF_D64_V2(hipblasSyr2StridedBatched, hipblasComplex, hipblasCsyr2StridedBatched);
+    MAP2CF_D64_V2(hipblasSyr2StridedBatched, hipblasDoubleComplex, hipblasZsyr2StridedBatched);
 
     // tbmv
     template <typename T, bool FORTRAN = false>
@@ -6295,20 +10258,60 @@ namespace
                                                  hipblasStride      stride_x,
                                                  int                batch_count);
 
-    MAP2CF(hipblasTbmv, float, hipblasStbmv);
-    MAP2CF(hipblasTbmv, double, hipblasDtbmv);
-    MAP2CF_V2(hipblasTbmv, hipblasComplex, hipblasCtbmv);
-    MAP2CF_V2(hipblasTbmv, hipblasDoubleComplex, hipblasZtbmv);
-
-    MAP2CF(hipblasTbmvBatched, float, hipblasStbmvBatched);
-    MAP2CF(hipblasTbmvBatched, double, hipblasDtbmvBatched);
-    MAP2CF_V2(hipblasTbmvBatched, hipblasComplex, hipblasCtbmvBatched);
-    MAP2CF_V2(hipblasTbmvBatched, hipblasDoubleComplex, hipblasZtbmvBatched);
-
-    MAP2CF(hipblasTbmvStridedBatched, float, hipblasStbmvStridedBatched);
-    MAP2CF(hipblasTbmvStridedBatched, double, hipblasDtbmvStridedBatched);
-    MAP2CF_V2(hipblasTbmvStridedBatched, hipblasComplex, hipblasCtbmvStridedBatched);
-    MAP2CF_V2(hipblasTbmvStridedBatched, hipblasDoubleComplex, hipblasZtbmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTbmv_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      int64_t            k,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      T*                 x,
+                                      int64_t            incx);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTbmvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             int64_t            k,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             T* const           x[],
+                                             int64_t            incx,
+                                             int64_t            batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTbmvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    int64_t            k,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      stride_a,
+                                                    T*                 x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stride_x,
+                                                    int64_t            batch_count);
+
+    MAP2CF_D64(hipblasTbmv, float, hipblasStbmv);
+    MAP2CF_D64(hipblasTbmv, double, hipblasDtbmv);
+    MAP2CF_D64_V2(hipblasTbmv, hipblasComplex, hipblasCtbmv);
+    MAP2CF_D64_V2(hipblasTbmv, hipblasDoubleComplex, hipblasZtbmv);
+
+    MAP2CF_D64(hipblasTbmvBatched, float, hipblasStbmvBatched);
+    MAP2CF_D64(hipblasTbmvBatched, double, hipblasDtbmvBatched);
+    MAP2CF_D64_V2(hipblasTbmvBatched, hipblasComplex, hipblasCtbmvBatched);
+    MAP2CF_D64_V2(hipblasTbmvBatched, hipblasDoubleComplex, hipblasZtbmvBatched);
+
+    MAP2CF_D64(hipblasTbmvStridedBatched, float, hipblasStbmvStridedBatched);
+    MAP2CF_D64(hipblasTbmvStridedBatched, double, hipblasDtbmvStridedBatched);
+    MAP2CF_D64_V2(hipblasTbmvStridedBatched, hipblasComplex, hipblasCtbmvStridedBatched);
+    MAP2CF_D64_V2(hipblasTbmvStridedBatched, hipblasDoubleComplex, hipblasZtbmvStridedBatched);
 
     // tbsv
     template <typename T, bool FORTRAN = false>
@@ -6351,20 +10354,60 @@ namespace
                                                  hipblasStride      stridex,
                                                  int                batchCount);
 
-    MAP2CF(hipblasTbsv, float, hipblasStbsv);
-    MAP2CF(hipblasTbsv, double, hipblasDtbsv);
-    MAP2CF_V2(hipblasTbsv, hipblasComplex, hipblasCtbsv);
-    MAP2CF_V2(hipblasTbsv, hipblasDoubleComplex, hipblasZtbsv);
-
-    MAP2CF(hipblasTbsvBatched, float, hipblasStbsvBatched);
-    MAP2CF(hipblasTbsvBatched, double, hipblasDtbsvBatched);
-    MAP2CF_V2(hipblasTbsvBatched, hipblasComplex, hipblasCtbsvBatched);
-    MAP2CF_V2(hipblasTbsvBatched, hipblasDoubleComplex, hipblasZtbsvBatched);
-
-    MAP2CF(hipblasTbsvStridedBatched, float, hipblasStbsvStridedBatched);
-    MAP2CF(hipblasTbsvStridedBatched, double, hipblasDtbsvStridedBatched);
-    MAP2CF_V2(hipblasTbsvStridedBatched, hipblasComplex, hipblasCtbsvStridedBatched);
-    MAP2CF_V2(hipblasTbsvStridedBatched, hipblasDoubleComplex, hipblasZtbsvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTbsv_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      int64_t            k,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      T*                 x,
+                                      int64_t            incx);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTbsvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             int64_t            k,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             T* const           x[],
+                                             int64_t            incx,
+                                             int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTbsvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    int64_t            k,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    T*                 x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stridex,
+                                                    int64_t            batchCount);
+
+    MAP2CF_D64(hipblasTbsv, float, hipblasStbsv);
+    MAP2CF_D64(hipblasTbsv, double, hipblasDtbsv);
+    MAP2CF_D64_V2(hipblasTbsv, hipblasComplex, hipblasCtbsv);
+    MAP2CF_D64_V2(hipblasTbsv, hipblasDoubleComplex, hipblasZtbsv);
+
+    MAP2CF_D64(hipblasTbsvBatched, float, hipblasStbsvBatched);
+    MAP2CF_D64(hipblasTbsvBatched, double, hipblasDtbsvBatched);
+    MAP2CF_D64_V2(hipblasTbsvBatched, hipblasComplex, hipblasCtbsvBatched);
+    MAP2CF_D64_V2(hipblasTbsvBatched, hipblasDoubleComplex, hipblasZtbsvBatched);
+
+    MAP2CF_D64(hipblasTbsvStridedBatched, float, hipblasStbsvStridedBatched);
+    MAP2CF_D64(hipblasTbsvStridedBatched, double, hipblasDtbsvStridedBatched);
+    MAP2CF_D64_V2(hipblasTbsvStridedBatched, hipblasComplex, hipblasCtbsvStridedBatched);
+    MAP2CF_D64_V2(hipblasTbsvStridedBatched, hipblasDoubleComplex, hipblasZtbsvStridedBatched);
 
     // tpmv
     template <typename T, bool FORTRAN = false>
@@ -6401,20 +10444,54 @@ namespace
                                                  hipblasStride      stridex,
                                                  int                batchCount);
 
-    MAP2CF(hipblasTpmv, float, hipblasStpmv);
-    MAP2CF(hipblasTpmv, double, hipblasDtpmv);
-    MAP2CF_V2(hipblasTpmv, hipblasComplex, hipblasCtpmv);
-    MAP2CF_V2(hipblasTpmv, hipblasDoubleComplex, hipblasZtpmv);
-
-    MAP2CF(hipblasTpmvBatched, float, hipblasStpmvBatched);
-    MAP2CF(hipblasTpmvBatched, double, hipblasDtpmvBatched);
-    MAP2CF_V2(hipblasTpmvBatched, hipblasComplex, hipblasCtpmvBatched);
-    MAP2CF_V2(hipblasTpmvBatched, hipblasDoubleComplex, hipblasZtpmvBatched);
-
-    MAP2CF(hipblasTpmvStridedBatched, float, hipblasStpmvStridedBatched);
-    MAP2CF(hipblasTpmvStridedBatched, double, hipblasDtpmvStridedBatched);
-    MAP2CF_V2(hipblasTpmvStridedBatched, hipblasComplex, hipblasCtpmvStridedBatched);
-    MAP2CF_V2(hipblasTpmvStridedBatched, hipblasDoubleComplex, hipblasZtpmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTpmv_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      const T*           AP,
+                                      T*                 x,
+                                      int64_t            incx);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTpmvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             const T* const     AP[],
+                                             T* const           x[],
+                                             int64_t            incx,
+                                             int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTpmvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    const T*           AP,
+                                                    hipblasStride      strideAP,
+                                                    T*                 x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stridex,
+                                                    int64_t            batchCount);
+
+    MAP2CF_D64(hipblasTpmv, float, hipblasStpmv);
+    MAP2CF_D64(hipblasTpmv, double, hipblasDtpmv);
+    MAP2CF_D64_V2(hipblasTpmv, hipblasComplex, hipblasCtpmv);
+    MAP2CF_D64_V2(hipblasTpmv, hipblasDoubleComplex, hipblasZtpmv);
+
+    MAP2CF_D64(hipblasTpmvBatched, float, hipblasStpmvBatched);
+    MAP2CF_D64(hipblasTpmvBatched, double, hipblasDtpmvBatched);
+    MAP2CF_D64_V2(hipblasTpmvBatched, hipblasComplex, hipblasCtpmvBatched);
+    MAP2CF_D64_V2(hipblasTpmvBatched, hipblasDoubleComplex, hipblasZtpmvBatched);
+
+    MAP2CF_D64(hipblasTpmvStridedBatched, float, hipblasStpmvStridedBatched);
+    MAP2CF_D64(hipblasTpmvStridedBatched, double, hipblasDtpmvStridedBatched);
+    MAP2CF_D64_V2(hipblasTpmvStridedBatched, hipblasComplex, hipblasCtpmvStridedBatched);
+    MAP2CF_D64_V2(hipblasTpmvStridedBatched, hipblasDoubleComplex, hipblasZtpmvStridedBatched);
 
     // tpsv
     template <typename T, bool FORTRAN = false>
@@ -6451,20 +10528,54 @@ namespace
                                                  hipblasStride      stridex,
                                                  int                batchCount);
 
-    MAP2CF(hipblasTpsv, float, hipblasStpsv);
-    MAP2CF(hipblasTpsv, double, hipblasDtpsv);
-    MAP2CF_V2(hipblasTpsv, hipblasComplex, hipblasCtpsv);
-    MAP2CF_V2(hipblasTpsv, hipblasDoubleComplex, hipblasZtpsv);
-
-    MAP2CF(hipblasTpsvBatched, float, hipblasStpsvBatched);
-    MAP2CF(hipblasTpsvBatched, double, hipblasDtpsvBatched);
-    MAP2CF_V2(hipblasTpsvBatched, hipblasComplex, hipblasCtpsvBatched);
-    MAP2CF_V2(hipblasTpsvBatched, hipblasDoubleComplex, hipblasZtpsvBatched);
-
-    MAP2CF(hipblasTpsvStridedBatched, float, hipblasStpsvStridedBatched);
-    MAP2CF(hipblasTpsvStridedBatched, double, hipblasDtpsvStridedBatched);
-    MAP2CF_V2(hipblasTpsvStridedBatched, hipblasComplex, hipblasCtpsvStridedBatched);
-    MAP2CF_V2(hipblasTpsvStridedBatched, hipblasDoubleComplex, hipblasZtpsvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTpsv_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      const T*           AP,
+                                      T*                 x,
+                                      int64_t            incx);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTpsvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             const T* const     AP[],
+                                             T* const           x[],
+                                             int64_t            incx,
+                                             int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTpsvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    const T*           AP,
+                                                    hipblasStride      strideAP,
+                                                    T*                 x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stridex,
+                                                    int64_t            batchCount);
+
+    MAP2CF_D64(hipblasTpsv, float, hipblasStpsv);
+    MAP2CF_D64(hipblasTpsv, double, hipblasDtpsv);
+    MAP2CF_D64_V2(hipblasTpsv, hipblasComplex, hipblasCtpsv);
+    MAP2CF_D64_V2(hipblasTpsv, hipblasDoubleComplex, hipblasZtpsv);
+
+    MAP2CF_D64(hipblasTpsvBatched, float, hipblasStpsvBatched);
+    MAP2CF_D64(hipblasTpsvBatched, double, hipblasDtpsvBatched);
+    MAP2CF_D64_V2(hipblasTpsvBatched, hipblasComplex, hipblasCtpsvBatched);
+    MAP2CF_D64_V2(hipblasTpsvBatched, hipblasDoubleComplex, hipblasZtpsvBatched);
+
+    MAP2CF_D64(hipblasTpsvStridedBatched, float, hipblasStpsvStridedBatched);
+    MAP2CF_D64(hipblasTpsvStridedBatched, double, hipblasDtpsvStridedBatched);
+    MAP2CF_D64_V2(hipblasTpsvStridedBatched, hipblasComplex, hipblasCtpsvStridedBatched);
+    MAP2CF_D64_V2(hipblasTpsvStridedBatched, hipblasDoubleComplex, hipblasZtpsvStridedBatched);
 
     // trmv
     template <typename T, bool FORTRAN = false>
@@ -6504,20 +10615,57 @@ namespace
                                                  hipblasStride      stride_x,
                                                  int                batch_count);
 
-    MAP2CF(hipblasTrmv, float, hipblasStrmv);
-    MAP2CF(hipblasTrmv, double, hipblasDtrmv);
-    MAP2CF_V2(hipblasTrmv, hipblasComplex, hipblasCtrmv);
-    MAP2CF_V2(hipblasTrmv, hipblasDoubleComplex, hipblasZtrmv);
-
-    MAP2CF(hipblasTrmvBatched, float, hipblasStrmvBatched);
-    MAP2CF(hipblasTrmvBatched, double, hipblasDtrmvBatched);
-    MAP2CF_V2(hipblasTrmvBatched, hipblasComplex, hipblasCtrmvBatched);
-    MAP2CF_V2(hipblasTrmvBatched, hipblasDoubleComplex, hipblasZtrmvBatched);
-
-    MAP2CF(hipblasTrmvStridedBatched, float, hipblasStrmvStridedBatched);
-    MAP2CF(hipblasTrmvStridedBatched, double, hipblasDtrmvStridedBatched);
-    MAP2CF_V2(hipblasTrmvStridedBatched, hipblasComplex, hipblasCtrmvStridedBatched);
-    MAP2CF_V2(hipblasTrmvStridedBatched, hipblasDoubleComplex, hipblasZtrmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrmv_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      T*                 x,
+                                      int64_t            incx);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrmvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             T* const           x[],
+                                             int64_t            incx,
+                                             int64_t            batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrmvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      stride_a,
+                                                    T*                 x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stride_x,
+                                                    int64_t            batch_count);
+
+    MAP2CF_D64(hipblasTrmv, float, hipblasStrmv);
+    MAP2CF_D64(hipblasTrmv, double, hipblasDtrmv);
+    MAP2CF_D64_V2(hipblasTrmv, hipblasComplex, hipblasCtrmv);
+    MAP2CF_D64_V2(hipblasTrmv, hipblasDoubleComplex, hipblasZtrmv);
+
+    MAP2CF_D64(hipblasTrmvBatched, float, hipblasStrmvBatched);
+    MAP2CF_D64(hipblasTrmvBatched, double, hipblasDtrmvBatched);
+    MAP2CF_D64_V2(hipblasTrmvBatched, hipblasComplex, hipblasCtrmvBatched);
+    MAP2CF_D64_V2(hipblasTrmvBatched, hipblasDoubleComplex, hipblasZtrmvBatched);
+
+    MAP2CF_D64(hipblasTrmvStridedBatched, float, hipblasStrmvStridedBatched);
+    MAP2CF_D64(hipblasTrmvStridedBatched, double, hipblasDtrmvStridedBatched);
+    MAP2CF_D64_V2(hipblasTrmvStridedBatched, hipblasComplex, hipblasCtrmvStridedBatched);
+    MAP2CF_D64_V2(hipblasTrmvStridedBatched, hipblasDoubleComplex, hipblasZtrmvStridedBatched);
 
     // trsv
     template <typename T, bool FORTRAN = false>
@@ -6557,20 +10705,57 @@ namespace
                                                  hipblasStride      stridex,
                                                  int                batch_count);
 
-    MAP2CF(hipblasTrsv, float, hipblasStrsv);
-    MAP2CF(hipblasTrsv, double, hipblasDtrsv);
-    MAP2CF_V2(hipblasTrsv, hipblasComplex, hipblasCtrsv);
-    MAP2CF_V2(hipblasTrsv, hipblasDoubleComplex, hipblasZtrsv);
-
-    MAP2CF(hipblasTrsvBatched, float, hipblasStrsvBatched);
-    MAP2CF(hipblasTrsvBatched, double, hipblasDtrsvBatched);
-    MAP2CF_V2(hipblasTrsvBatched, hipblasComplex, hipblasCtrsvBatched);
-    MAP2CF_V2(hipblasTrsvBatched, hipblasDoubleComplex, hipblasZtrsvBatched);
-
-    MAP2CF(hipblasTrsvStridedBatched, float, hipblasStrsvStridedBatched);
-    MAP2CF(hipblasTrsvStridedBatched, double, hipblasDtrsvStridedBatched);
-    MAP2CF_V2(hipblasTrsvStridedBatched, hipblasComplex, hipblasCtrsvStridedBatched);
-    MAP2CF_V2(hipblasTrsvStridedBatched, hipblasDoubleComplex, hipblasZtrsvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrsv_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      T*                 x,
+                                      int64_t            incx);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrsvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             T* const           x[],
+                                             int64_t            incx,
+                                             int64_t            batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrsvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    T*                 x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stridex,
+                                                    int64_t            batch_count);
+
+    MAP2CF_D64(hipblasTrsv, float, hipblasStrsv);
+    MAP2CF_D64(hipblasTrsv, double, hipblasDtrsv);
+    MAP2CF_D64_V2(hipblasTrsv, hipblasComplex, hipblasCtrsv);
+    MAP2CF_D64_V2(hipblasTrsv, hipblasDoubleComplex, hipblasZtrsv);
+
+    MAP2CF_D64(hipblasTrsvBatched, float, hipblasStrsvBatched);
+    MAP2CF_D64(hipblasTrsvBatched, double, hipblasDtrsvBatched);
+    MAP2CF_D64_V2(hipblasTrsvBatched, hipblasComplex, hipblasCtrsvBatched);
+    MAP2CF_D64_V2(hipblasTrsvBatched, hipblasDoubleComplex, hipblasZtrsvBatched);
+
+    MAP2CF_D64(hipblasTrsvStridedBatched, float, hipblasStrsvStridedBatched);
+    MAP2CF_D64(hipblasTrsvStridedBatched, double, hipblasDtrsvStridedBatched);
+    MAP2CF_D64_V2(hipblasTrsvStridedBatched, hipblasComplex, hipblasCtrsvStridedBatched);
+    MAP2CF_D64_V2(hipblasTrsvStridedBatched, hipblasDoubleComplex, hipblasZtrsvStridedBatched);
 
     // gbmv
     template <typename T, bool FORTRAN = false>
@@ -6626,20 +10811,73 @@ namespace
                                                  hipblasStride      stride_y,
                                                  int                batch_count);
 
-    MAP2CF(hipblasGbmv, float, hipblasSgbmv);
-    MAP2CF(hipblasGbmv, double, hipblasDgbmv);
-    MAP2CF_V2(hipblasGbmv, hipblasComplex, hipblasCgbmv);
-    MAP2CF_V2(hipblasGbmv, hipblasDoubleComplex, hipblasZgbmv);
-
-    MAP2CF(hipblasGbmvBatched, float, hipblasSgbmvBatched);
-    MAP2CF(hipblasGbmvBatched, double, hipblasDgbmvBatched);
-    MAP2CF_V2(hipblasGbmvBatched, hipblasComplex, hipblasCgbmvBatched);
-    MAP2CF_V2(hipblasGbmvBatched, hipblasDoubleComplex, hipblasZgbmvBatched);
-
-    MAP2CF(hipblasGbmvStridedBatched, float, hipblasSgbmvStridedBatched);
-    MAP2CF(hipblasGbmvStridedBatched, double, hipblasDgbmvStridedBatched);
-    MAP2CF_V2(hipblasGbmvStridedBatched, hipblasComplex, hipblasCgbmvStridedBatched);
-    MAP2CF_V2(hipblasGbmvStridedBatched, hipblasDoubleComplex, hipblasZgbmvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGbmv_64)(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            kl,
+                                      int64_t            ku,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      const T*           x,
+                                      int64_t            incx,
+                                      const T*           beta,
+                                      T*                 y,
+                                      int64_t            incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGbmvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             int64_t            kl,
+                                             int64_t            ku,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             const T* const     x[],
+                                             int64_t            incx,
+                                             const T*           beta,
+                                             T* const           y[],
+                                             int64_t            incy,
+                                             int64_t            batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGbmvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    int64_t            kl,
+                                                    int64_t            ku,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      stride_a,
+                                                    const T*           x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stride_x,
+                                                    const T*           beta,
+                                                    T*                 y,
+                                                    int64_t            incy,
+                                                    hipblasStride      stride_y,
+                                                    int64_t            batch_count);
+
+    MAP2CF_D64(hipblasGbmv, float, hipblasSgbmv);
+    MAP2CF_D64(hipblasGbmv, double, hipblasDgbmv);
+    MAP2CF_D64_V2(hipblasGbmv, hipblasComplex, hipblasCgbmv);
+    MAP2CF_D64_V2(hipblasGbmv, hipblasDoubleComplex, hipblasZgbmv);
+
+    MAP2CF_D64(hipblasGbmvBatched, float, hipblasSgbmvBatched);
+    MAP2CF_D64(hipblasGbmvBatched, double, hipblasDgbmvBatched);
+    MAP2CF_D64_V2(hipblasGbmvBatched, hipblasComplex, hipblasCgbmvBatched);
+    MAP2CF_D64_V2(hipblasGbmvBatched, hipblasDoubleComplex, hipblasZgbmvBatched);
+
+    MAP2CF_D64(hipblasGbmvStridedBatched, float, hipblasSgbmvStridedBatched);
+    MAP2CF_D64(hipblasGbmvStridedBatched, double, hipblasDgbmvStridedBatched);
+    MAP2CF_D64_V2(hipblasGbmvStridedBatched, hipblasComplex, hipblasCgbmvStridedBatched);
+    MAP2CF_D64_V2(hipblasGbmvStridedBatched, hipblasDoubleComplex, hipblasZgbmvStridedBatched);
 
     // gemv
     template <typename T, bool FORTRAN = false>
@@ -6689,20 +10927,67 @@ namespace
                                                  hipblasStride      stride_y,
                                                  int                batch_count);
 
-    MAP2CF(hipblasGemv, float, hipblasSgemv);
-    MAP2CF(hipblasGemv, double, hipblasDgemv);
-    MAP2CF_V2(hipblasGemv, hipblasComplex, hipblasCgemv);
-    MAP2CF_V2(hipblasGemv, hipblasDoubleComplex, hipblasZgemv);
-
-    MAP2CF(hipblasGemvBatched, float, hipblasSgemvBatched);
-    MAP2CF(hipblasGemvBatched, double, hipblasDgemvBatched);
-    MAP2CF_V2(hipblasGemvBatched, hipblasComplex, hipblasCgemvBatched);
-    MAP2CF_V2(hipblasGemvBatched, hipblasDoubleComplex, hipblasZgemvBatched);
-
-    MAP2CF(hipblasGemvStridedBatched, float, hipblasSgemvStridedBatched);
-    MAP2CF(hipblasGemvStridedBatched, double, hipblasDgemvStridedBatched);
-    MAP2CF_V2(hipblasGemvStridedBatched, hipblasComplex, hipblasCgemvStridedBatched);
-    MAP2CF_V2(hipblasGemvStridedBatched, hipblasDoubleComplex, hipblasZgemvStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGemv_64)(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      const T*           x,
+                                      int64_t            incx,
+                                      const T*           beta,
+                                      T*                 y,
+                                      int64_t            incy);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGemvBatched_64)(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             const T* const     x[],
+                                             int64_t            incx,
+                                             const T*           beta,
+                                             T* const           y[],
+                                             int64_t            incy,
+                                             int64_t            batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGemvStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      stride_a,
+                                                    const T*           x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stride_x,
+                                                    const T*           beta,
+                                                    T*                 y,
+                                                    int64_t            incy,
+                                                    hipblasStride      stride_y,
+                                                    int64_t            batch_count);
+
+    MAP2CF_D64(hipblasGemv, float, hipblasSgemv);
+    MAP2CF_D64(hipblasGemv, double, hipblasDgemv);
+    MAP2CF_D64_V2(hipblasGemv, hipblasComplex, hipblasCgemv);
+    MAP2CF_D64_V2(hipblasGemv, hipblasDoubleComplex, hipblasZgemv);
+
+    MAP2CF_D64(hipblasGemvBatched, float, hipblasSgemvBatched);
+    MAP2CF_D64(hipblasGemvBatched, double, hipblasDgemvBatched);
+    MAP2CF_D64_V2(hipblasGemvBatched, hipblasComplex, hipblasCgemvBatched);
+    MAP2CF_D64_V2(hipblasGemvBatched, hipblasDoubleComplex, hipblasZgemvBatched);
+
+    MAP2CF_D64(hipblasGemvStridedBatched, float, hipblasSgemvStridedBatched);
+    MAP2CF_D64(hipblasGemvStridedBatched, double, hipblasDgemvStridedBatched);
+    MAP2CF_D64_V2(hipblasGemvStridedBatched, hipblasComplex, hipblasCgemvStridedBatched);
+    MAP2CF_D64_V2(hipblasGemvStridedBatched, hipblasDoubleComplex, hipblasZgemvStridedBatched);
 
     template <typename T, bool FORTRAN = false>
     hipblasStatus_t (*hipblasGemm)(hipblasHandle_t    handle,
@@ -6757,23 +11042,76 @@ namespace
                                           int                ldc,
                                           int                batch_count);
 
-    MAP2CF(hipblasGemm, hipblasHalf, hipblasHgemm);
-    MAP2CF(hipblasGemm, float, hipblasSgemm);
-    MAP2CF(hipblasGemm, double, hipblasDgemm);
-    MAP2CF_V2(hipblasGemm, hipblasComplex, hipblasCgemm);
-    MAP2CF_V2(hipblasGemm, hipblasDoubleComplex, hipblasZgemm);
-
-    MAP2CF(hipblasGemmBatched, hipblasHalf, hipblasHgemmBatched);
-    MAP2CF(hipblasGemmBatched, float, hipblasSgemmBatched);
-    MAP2CF(hipblasGemmBatched, double, hipblasDgemmBatched);
-    MAP2CF_V2(hipblasGemmBatched, hipblasComplex, hipblasCgemmBatched);
-    MAP2CF_V2(hipblasGemmBatched, hipblasDoubleComplex, hipblasZgemmBatched);
-
-    MAP2CF(hipblasGemmStridedBatched, hipblasHalf, hipblasHgemmStridedBatched);
-    MAP2CF(hipblasGemmStridedBatched, float, hipblasSgemmStridedBatched);
-    MAP2CF(hipblasGemmStridedBatched, double, hipblasDgemmStridedBatched);
-    MAP2CF_V2(hipblasGemmStridedBatched, hipblasComplex, hipblasCgemmStridedBatched);
-    MAP2CF_V2(hipblasGemmStridedBatched, hipblasDoubleComplex, hipblasZgemmStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGemm_64)(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      const T*           B,
+                                      int64_t            ldb,
+                                      const T*           beta,
+                                      T*                 C,
+                                      int64_t            ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGemmStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    int64_t            k,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    int64_t            bsa,
+                                                    const T*           B,
+                                                    int64_t            ldb,
+                                                    int64_t            bsb,
+                                                    const T*           beta,
+                                                    T*                 C,
+                                                    int64_t            ldc,
+                                                    int64_t            bsc,
+                                                    int64_t            batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGemmBatched_64)(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             int64_t            k,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             const T* const     B[],
+                                             int64_t            ldb,
+                                             const T*           beta,
+                                             T* const           C[],
+                                             int64_t            ldc,
+                                             int64_t            batch_count);
+
+    MAP2CF_D64(hipblasGemm, hipblasHalf, hipblasHgemm);
+    MAP2CF_D64(hipblasGemm, float, hipblasSgemm);
+    MAP2CF_D64(hipblasGemm, double, hipblasDgemm);
+    MAP2CF_D64_V2(hipblasGemm, hipblasComplex, hipblasCgemm);
+    MAP2CF_D64_V2(hipblasGemm, hipblasDoubleComplex, hipblasZgemm);
+
+    MAP2CF_D64(hipblasGemmBatched, hipblasHalf, hipblasHgemmBatched);
+    MAP2CF_D64(hipblasGemmBatched, float, hipblasSgemmBatched);
+    MAP2CF_D64(hipblasGemmBatched, double, hipblasDgemmBatched);
+    MAP2CF_D64_V2(hipblasGemmBatched, hipblasComplex, hipblasCgemmBatched);
+    MAP2CF_D64_V2(hipblasGemmBatched, hipblasDoubleComplex, hipblasZgemmBatched);
+
+    MAP2CF_D64(hipblasGemmStridedBatched, hipblasHalf, hipblasHgemmStridedBatched);
+    MAP2CF_D64(hipblasGemmStridedBatched, float, hipblasSgemmStridedBatched);
+    MAP2CF_D64(hipblasGemmStridedBatched, double, hipblasDgemmStridedBatched);
+    MAP2CF_D64_V2(hipblasGemmStridedBatched, hipblasComplex, hipblasCgemmStridedBatched);
+    MAP2CF_D64_V2(hipblasGemmStridedBatched, hipblasDoubleComplex, hipblasZgemmStridedBatched);
 
     // herk
     template <typename T, typename U, bool FORTRAN = false>
@@ -6819,14 +11157,58 @@ namespace
                                                  hipblasStride      strideC,
                                                  int                batchCount);
 
-    MAP2CF_V2(hipblasHerk, hipblasComplex, float, hipblasCherk);
-    MAP2CF_V2(hipblasHerk, hipblasDoubleComplex, double, hipblasZherk);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerk_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const U*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      const U*           beta,
+                                      T*                 C,
+                                      int64_t            ldc);
 
-    MAP2CF_V2(hipblasHerkBatched, hipblasComplex, float, hipblasCherkBatched);
-    MAP2CF_V2(hipblasHerkBatched, hipblasDoubleComplex, double, hipblasZherkBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerkBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             int64_t            n,
+                                             int64_t            k,
+                                             const U*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             const U*           beta,
+                                             T* const           C[],
+                                             int64_t            ldc,
+                                             int64_t            batchCount);
 
-    MAP2CF_V2(hipblasHerkStridedBatched, hipblasComplex, float, hipblasCherkStridedBatched);
-    MAP2CF_V2(hipblasHerkStridedBatched, hipblasDoubleComplex, double, hipblasZherkStridedBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerkStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    int64_t            n,
+                                                    int64_t            k,
+                                                    const U*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const U*           beta,
+                                                    T*                 C,
+                                                    int64_t            ldc,
+                                                    hipblasStride      strideC,
+                                                    int64_t            batchCount);
+
+    MAP2CF_D64_V2(hipblasHerk, hipblasComplex, float, hipblasCherk);
+    MAP2CF_D64_V2(hipblasHerk, hipblasDoubleComplex, double, hipblasZherk);
+
+    MAP2CF_D64_V2(hipblasHerkBatched, hipblasComplex, float, hipblasCherkBatched);
+    MAP2CF_D64_V2(hipblasHerkBatched, hipblasDoubleComplex, double, hipblasZherkBatched);
+
+    MAP2CF_D64_V2(hipblasHerkStridedBatched, hipblasComplex, float, hipblasCherkStridedBatched);
+    MAP2CF_D64_V2(
+        hipblasHerkStridedBatched, hipblasDoubleComplex, double, hipblasZherkStridedBatched);
 
     // her2k
     template <typename T, typename U, bool FORTRAN = false>
@@ -6879,17 +11261,65 @@ namespace
                                                   hipblasStride      strideC,
                                                   int                batchCount);
 
-    MAP2CF_V2(hipblasHer2k, hipblasComplex, float, hipblasCher2k);
-    MAP2CF_V2(hipblasHer2k, hipblasDoubleComplex, double, hipblasZher2k);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHer2k_64)(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int64_t            lda,
+                                       const T*           B,
+                                       int64_t            ldb,
+                                       const U*           beta,
+                                       T*                 C,
+                                       int64_t            ldc);
 
-    MAP2CF_V2(hipblasHer2kBatched, hipblasComplex, float, hipblasCher2kBatched);
-    MAP2CF_V2(hipblasHer2kBatched, hipblasDoubleComplex, double, hipblasZher2kBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHer2kBatched_64)(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const T*           alpha,
+                                              const T* const     A[],
+                                              int64_t            lda,
+                                              const T* const     B[],
+                                              int64_t            ldb,
+                                              const U*           beta,
+                                              T* const           C[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
 
-    MAP2CF_V2(hipblasHer2kStridedBatched, hipblasComplex, float, hipblasCher2kStridedBatched);
-    MAP2CF_V2(hipblasHer2kStridedBatched,
-              hipblasDoubleComplex,
-              double,
-              hipblasZher2kStridedBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHer2kStridedBatched_64)(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const T*           alpha,
+                                                     const T*           A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const T*           B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     const U*           beta,
+                                                     T*                 C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+    MAP2CF_D64_V2(hipblasHer2k, hipblasComplex, float, hipblasCher2k);
+    MAP2CF_D64_V2(hipblasHer2k, hipblasDoubleComplex, double, hipblasZher2k);
+
+    MAP2CF_D64_V2(hipblasHer2kBatched, hipblasComplex, float, hipblasCher2kBatched);
+    MAP2CF_D64_V2(hipblasHer2kBatched, hipblasDoubleComplex, double, hipblasZher2kBatched);
+
+    MAP2CF_D64_V2(hipblasHer2kStridedBatched, hipblasComplex, float, hipblasCher2kStridedBatched);
+    MAP2CF_D64_V2(
+        hipblasHer2kStridedBatched, hipblasDoubleComplex, double, hipblasZher2kStridedBatched);
 
     // herkx
     template <typename T, typename U, bool FORTRAN = false>
@@ -6942,17 +11372,65 @@ namespace
                                                   hipblasStride      strideC,
                                                   int                batchCount);
 
-    MAP2CF_V2(hipblasHerkx, hipblasComplex, float, hipblasCherkx);
-    MAP2CF_V2(hipblasHerkx, hipblasDoubleComplex, double, hipblasZherkx);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerkx_64)(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int64_t            lda,
+                                       const T*           B,
+                                       int64_t            ldb,
+                                       const U*           beta,
+                                       T*                 C,
+                                       int64_t            ldc);
 
-    MAP2CF_V2(hipblasHerkxBatched, hipblasComplex, float, hipblasCherkxBatched);
-    MAP2CF_V2(hipblasHerkxBatched, hipblasDoubleComplex, double, hipblasZherkxBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerkxBatched_64)(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const T*           alpha,
+                                              const T* const     A[],
+                                              int64_t            lda,
+                                              const T* const     B[],
+                                              int64_t            ldb,
+                                              const U*           beta,
+                                              T* const           C[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
 
-    MAP2CF_V2(hipblasHerkxStridedBatched, hipblasComplex, float, hipblasCherkxStridedBatched);
-    MAP2CF_V2(hipblasHerkxStridedBatched,
-              hipblasDoubleComplex,
-              double,
-              hipblasZherkxStridedBatched);
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHerkxStridedBatched_64)(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const T*           alpha,
+                                                     const T*           A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const T*           B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     const U*           beta,
+                                                     T*                 C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+    MAP2CF_D64_V2(hipblasHerkx, hipblasComplex, float, hipblasCherkx);
+    MAP2CF_D64_V2(hipblasHerkx, hipblasDoubleComplex, double, hipblasZherkx);
+
+    MAP2CF_D64_V2(hipblasHerkxBatched, hipblasComplex, float, hipblasCherkxBatched);
+    MAP2CF_D64_V2(hipblasHerkxBatched, hipblasDoubleComplex, double, hipblasZherkxBatched);
+
+    MAP2CF_D64_V2(hipblasHerkxStridedBatched, hipblasComplex, float, hipblasCherkxStridedBatched);
+    MAP2CF_D64_V2(
+        hipblasHerkxStridedBatched, hipblasDoubleComplex, double, hipblasZherkxStridedBatched);
 
     // symm
     template <typename T, bool FORTRAN = false>
@@ -7005,20 +11483,70 @@ namespace
                                                  hipblasStride     strideC,
                                                  int               batchCount);
 
-    MAP2CF(hipblasSymm, float, hipblasSsymm);
-    MAP2CF(hipblasSymm, double, hipblasDsymm);
-    MAP2CF_V2(hipblasSymm, hipblasComplex, hipblasCsymm);
-    MAP2CF_V2(hipblasSymm, hipblasDoubleComplex, hipblasZsymm);
-
-    MAP2CF(hipblasSymmBatched, float, hipblasSsymmBatched);
-    MAP2CF(hipblasSymmBatched, double, hipblasDsymmBatched);
-    MAP2CF_V2(hipblasSymmBatched, hipblasComplex, hipblasCsymmBatched);
-    MAP2CF_V2(hipblasSymmBatched, hipblasDoubleComplex, hipblasZsymmBatched);
-
-    MAP2CF(hipblasSymmStridedBatched, float, hipblasSsymmStridedBatched);
-    MAP2CF(hipblasSymmStridedBatched, double, hipblasDsymmStridedBatched);
-    MAP2CF_V2(hipblasSymmStridedBatched, hipblasComplex, hipblasCsymmStridedBatched);
-    MAP2CF_V2(hipblasSymmStridedBatched, hipblasDoubleComplex, hipblasZsymmStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSymm_64)(hipblasHandle_t   handle,
+                                      hipblasSideMode_t side,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           m,
+                                      int64_t           n,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      int64_t           lda,
+                                      const T*          B,
+                                      int64_t           ldb,
+                                      const T*          beta,
+                                      T*                C,
+                                      int64_t           ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSymmBatched_64)(hipblasHandle_t   handle,
+                                             hipblasSideMode_t side,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           m,
+                                             int64_t           n,
+                                             const T*          alpha,
+                                             const T* const    A[],
+                                             int64_t           lda,
+                                             const T* const    B[],
+                                             int64_t           ldb,
+                                             const T*          beta,
+                                             T* const          C[],
+                                             int64_t           ldc,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSymmStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasSideMode_t side,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           m,
+                                                    int64_t           n,
+                                                    const T*          alpha,
+                                                    const T*          A,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    const T*          B,
+                                                    int64_t           ldb,
+                                                    hipblasStride     strideB,
+                                                    const T*          beta,
+                                                    T*                C,
+                                                    int64_t           ldc,
+                                                    hipblasStride     strideC,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64(hipblasSymm, float, hipblasSsymm);
+    MAP2CF_D64(hipblasSymm, double, hipblasDsymm);
+    MAP2CF_D64_V2(hipblasSymm, hipblasComplex, hipblasCsymm);
+    MAP2CF_D64_V2(hipblasSymm, hipblasDoubleComplex, hipblasZsymm);
+
+    MAP2CF_D64(hipblasSymmBatched, float, hipblasSsymmBatched);
+    MAP2CF_D64(hipblasSymmBatched, double, hipblasDsymmBatched);
+    MAP2CF_D64_V2(hipblasSymmBatched, hipblasComplex, hipblasCsymmBatched);
+    MAP2CF_D64_V2(hipblasSymmBatched, hipblasDoubleComplex, hipblasZsymmBatched);
+
+    MAP2CF_D64(hipblasSymmStridedBatched, float, hipblasSsymmStridedBatched);
+    MAP2CF_D64(hipblasSymmStridedBatched, double, hipblasDsymmStridedBatched);
+    MAP2CF_D64_V2(hipblasSymmStridedBatched, hipblasComplex, hipblasCsymmStridedBatched);
+    MAP2CF_D64_V2(hipblasSymmStridedBatched, hipblasDoubleComplex, hipblasZsymmStridedBatched);
 
     // syrk
     template <typename T, bool FORTRAN = false>
@@ -7064,20 +11592,63 @@ namespace
                                                  hipblasStride      strideC,
                                                  int                batchCount);
 
-    MAP2CF(hipblasSyrk, float, hipblasSsyrk);
-    MAP2CF(hipblasSyrk, double, hipblasDsyrk);
-    MAP2CF_V2(hipblasSyrk, hipblasComplex, hipblasCsyrk);
-    MAP2CF_V2(hipblasSyrk, hipblasDoubleComplex, hipblasZsyrk);
-
-    MAP2CF(hipblasSyrkBatched, float, hipblasSsyrkBatched);
-    MAP2CF(hipblasSyrkBatched, double, hipblasDsyrkBatched);
-    MAP2CF_V2(hipblasSyrkBatched, hipblasComplex, hipblasCsyrkBatched);
-    MAP2CF_V2(hipblasSyrkBatched, hipblasDoubleComplex, hipblasZsyrkBatched);
-
-    MAP2CF(hipblasSyrkStridedBatched, float, hipblasSsyrkStridedBatched);
-    MAP2CF(hipblasSyrkStridedBatched, double, hipblasDsyrkStridedBatched);
-    MAP2CF_V2(hipblasSyrkStridedBatched, hipblasComplex, hipblasCsyrkStridedBatched);
-    MAP2CF_V2(hipblasSyrkStridedBatched, hipblasDoubleComplex, hipblasZsyrkStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrk_64)(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      const T*           beta,
+                                      T*                 C,
+                                      int64_t            ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrkBatched_64)(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             int64_t            n,
+                                             int64_t            k,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             const T*           beta,
+                                             T* const           C[],
+                                             int64_t            ldc,
+                                             int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrkStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    int64_t            n,
+                                                    int64_t            k,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const T*           beta,
+                                                    T*                 C,
+                                                    int64_t            ldc,
+                                                    hipblasStride      strideC,
+                                                    int64_t            batchCount);
+
+    MAP2CF_D64(hipblasSyrk, float, hipblasSsyrk);
+    MAP2CF_D64(hipblasSyrk, double, hipblasDsyrk);
+    MAP2CF_D64_V2(hipblasSyrk, hipblasComplex, hipblasCsyrk);
+    MAP2CF_D64_V2(hipblasSyrk, hipblasDoubleComplex, hipblasZsyrk);
+
+    MAP2CF_D64(hipblasSyrkBatched, float, hipblasSsyrkBatched);
+    MAP2CF_D64(hipblasSyrkBatched, double, hipblasDsyrkBatched);
+    MAP2CF_D64_V2(hipblasSyrkBatched, hipblasComplex, hipblasCsyrkBatched);
+    MAP2CF_D64_V2(hipblasSyrkBatched, hipblasDoubleComplex, hipblasZsyrkBatched);
+
+    MAP2CF_D64(hipblasSyrkStridedBatched, float, hipblasSsyrkStridedBatched);
+    MAP2CF_D64(hipblasSyrkStridedBatched, double, hipblasDsyrkStridedBatched);
+    MAP2CF_D64_V2(hipblasSyrkStridedBatched, hipblasComplex, hipblasCsyrkStridedBatched);
+    MAP2CF_D64_V2(hipblasSyrkStridedBatched, hipblasDoubleComplex, hipblasZsyrkStridedBatched);
 
     // syr2k
     template <typename T, bool FORTRAN = false>
@@ -7130,20 +11701,70 @@ namespace
                                                   hipblasStride      strideC,
                                                   int                batchCount);
 
-    MAP2CF(hipblasSyr2k, float, hipblasSsyr2k);
-    MAP2CF(hipblasSyr2k, double, hipblasDsyr2k);
-    MAP2CF_V2(hipblasSyr2k, hipblasComplex, hipblasCsyr2k);
-    MAP2CF_V2(hipblasSyr2k, hipblasDoubleComplex, hipblasZsyr2k);
-
-    MAP2CF(hipblasSyr2kBatched, float, hipblasSsyr2kBatched);
-    MAP2CF(hipblasSyr2kBatched, double, hipblasDsyr2kBatched);
-    MAP2CF_V2(hipblasSyr2kBatched, hipblasComplex, hipblasCsyr2kBatched);
-    MAP2CF_V2(hipblasSyr2kBatched, hipblasDoubleComplex, hipblasZsyr2kBatched);
-
-    MAP2CF(hipblasSyr2kStridedBatched, float, hipblasSsyr2kStridedBatched);
-    MAP2CF(hipblasSyr2kStridedBatched, double, hipblasDsyr2kStridedBatched);
-    MAP2CF_V2(hipblasSyr2kStridedBatched, hipblasComplex, hipblasCsyr2kStridedBatched);
-    MAP2CF_V2(hipblasSyr2kStridedBatched, hipblasDoubleComplex, hipblasZsyr2kStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyr2k_64)(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int64_t            lda,
+                                       const T*           B,
+                                       int64_t            ldb,
+                                       const T*           beta,
+                                       T*                 C,
+                                       int64_t            ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyr2kBatched_64)(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const T*           alpha,
+                                              const T* const     A[],
+                                              int64_t            lda,
+                                              const T* const     B[],
+                                              int64_t            ldb,
+                                              const T*           beta,
+                                              T* const           C[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyr2kStridedBatched_64)(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const T*           alpha,
+                                                     const T*           A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const T*           B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     const T*           beta,
+                                                     T*                 C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+    MAP2CF_D64(hipblasSyr2k, float, hipblasSsyr2k);
+    MAP2CF_D64(hipblasSyr2k, double, hipblasDsyr2k);
+    MAP2CF_D64_V2(hipblasSyr2k, hipblasComplex, hipblasCsyr2k);
+    MAP2CF_D64_V2(hipblasSyr2k, hipblasDoubleComplex, hipblasZsyr2k);
+
+    MAP2CF_D64(hipblasSyr2kBatched, float, hipblasSsyr2kBatched);
+    MAP2CF_D64(hipblasSyr2kBatched, double, hipblasDsyr2kBatched);
+    MAP2CF_D64_V2(hipblasSyr2kBatched, hipblasComplex, hipblasCsyr2kBatched);
+    MAP2CF_D64_V2(hipblasSyr2kBatched, hipblasDoubleComplex, hipblasZsyr2kBatched);
+
+    MAP2CF_D64(hipblasSyr2kStridedBatched, float, hipblasSsyr2kStridedBatched);
+    MAP2CF_D64(hipblasSyr2kStridedBatched, double, hipblasDsyr2kStridedBatched);
+    MAP2CF_D64_V2(hipblasSyr2kStridedBatched, hipblasComplex, hipblasCsyr2kStridedBatched);
+    MAP2CF_D64_V2(hipblasSyr2kStridedBatched, hipblasDoubleComplex, hipblasZsyr2kStridedBatched);
 
     // syrkx
     template <typename T, bool FORTRAN = false>
@@ -7196,20 +11817,70 @@ namespace
                                                   hipblasStride      strideC,
                                                   int                batchCount);
 
-    MAP2CF(hipblasSyrkx, float, hipblasSsyrkx);
-    MAP2CF(hipblasSyrkx, double, hipblasDsyrkx);
-    MAP2CF_V2(hipblasSyrkx, hipblasComplex, hipblasCsyrkx);
-    MAP2CF_V2(hipblasSyrkx, hipblasDoubleComplex, hipblasZsyrkx);
-
-    MAP2CF(hipblasSyrkxBatched, float, hipblasSsyrkxBatched);
-    MAP2CF(hipblasSyrkxBatched, double, hipblasDsyrkxBatched);
-    MAP2CF_V2(hipblasSyrkxBatched, hipblasComplex, hipblasCsyrkxBatched);
-    MAP2CF_V2(hipblasSyrkxBatched, hipblasDoubleComplex, hipblasZsyrkxBatched);
-
-    MAP2CF(hipblasSyrkxStridedBatched, float, hipblasSsyrkxStridedBatched);
-    MAP2CF(hipblasSyrkxStridedBatched, double, hipblasDsyrkxStridedBatched);
-    MAP2CF_V2(hipblasSyrkxStridedBatched, hipblasComplex, hipblasCsyrkxStridedBatched);
-    MAP2CF_V2(hipblasSyrkxStridedBatched, hipblasDoubleComplex, hipblasZsyrkxStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrkx_64)(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int64_t            lda,
+                                       const T*           B,
+                                       int64_t            ldb,
+                                       const T*           beta,
+                                       T*                 C,
+                                       int64_t            ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrkxBatched_64)(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const T*           alpha,
+                                              const T* const     A[],
+                                              int64_t            lda,
+                                              const T* const     B[],
+                                              int64_t            ldb,
+                                              const T*           beta,
+                                              T* const           C[],
+                                              int64_t            ldc,
+                                              int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyrkxStridedBatched_64)(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const T*           alpha,
+                                                     const T*           A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const T*           B,
+                                                     int64_t            ldb,
+                                                     hipblasStride      strideB,
+                                                     const T*           beta,
+                                                     T*                 C,
+                                                     int64_t            ldc,
+                                                     hipblasStride      strideC,
+                                                     int64_t            batchCount);
+
+    MAP2CF_D64(hipblasSyrkx, float, hipblasSsyrkx);
+    MAP2CF_D64(hipblasSyrkx, double, hipblasDsyrkx);
+    MAP2CF_D64_V2(hipblasSyrkx, hipblasComplex, hipblasCsyrkx);
+    MAP2CF_D64_V2(hipblasSyrkx, hipblasDoubleComplex, hipblasZsyrkx);
+
+    MAP2CF_D64(hipblasSyrkxBatched, float, hipblasSsyrkxBatched);
+    MAP2CF_D64(hipblasSyrkxBatched, double, hipblasDsyrkxBatched);
+    MAP2CF_D64_V2(hipblasSyrkxBatched, hipblasComplex, hipblasCsyrkxBatched);
+    MAP2CF_D64_V2(hipblasSyrkxBatched, hipblasDoubleComplex, hipblasZsyrkxBatched);
+
+    MAP2CF_D64(hipblasSyrkxStridedBatched, float, hipblasSsyrkxStridedBatched);
+    MAP2CF_D64(hipblasSyrkxStridedBatched, double, hipblasDsyrkxStridedBatched);
+    MAP2CF_D64_V2(hipblasSyrkxStridedBatched, hipblasComplex, hipblasCsyrkxStridedBatched);
+    MAP2CF_D64_V2(hipblasSyrkxStridedBatched, hipblasDoubleComplex, hipblasZsyrkxStridedBatched);
 
     // geam
     template <typename T, bool FORTRAN = false>
@@ -7262,20 +11933,70 @@ namespace
                                                  hipblasStride      strideC,
                                                  int                batchCount);
 
-    MAP2CF(hipblasGeam, float, hipblasSgeam);
-    MAP2CF(hipblasGeam, double, hipblasDgeam);
-    MAP2CF_V2(hipblasGeam, hipblasComplex, hipblasCgeam);
-    MAP2CF_V2(hipblasGeam, hipblasDoubleComplex, hipblasZgeam);
-
-    MAP2CF(hipblasGeamBatched, float, hipblasSgeamBatched);
-    MAP2CF(hipblasGeamBatched, double, hipblasDgeamBatched);
-    MAP2CF_V2(hipblasGeamBatched, hipblasComplex, hipblasCgeamBatched);
-    MAP2CF_V2(hipblasGeamBatched, hipblasDoubleComplex, hipblasZgeamBatched);
-
-    MAP2CF(hipblasGeamStridedBatched, float, hipblasSgeamStridedBatched);
-    MAP2CF(hipblasGeamStridedBatched, double, hipblasDgeamStridedBatched);
-    MAP2CF_V2(hipblasGeamStridedBatched, hipblasComplex, hipblasCgeamStridedBatched);
-    MAP2CF_V2(hipblasGeamStridedBatched, hipblasDoubleComplex, hipblasZgeamStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGeam_64)(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      const T*           beta,
+                                      const T*           B,
+                                      int64_t            ldb,
+                                      T*                 C,
+                                      int64_t            ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGeamBatched_64)(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             const T*           beta,
+                                             const T* const     B[],
+                                             int64_t            ldb,
+                                             T* const           C[],
+                                             int64_t            ldc,
+                                             int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGeamStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const T*           beta,
+                                                    const T*           B,
+                                                    int64_t            ldb,
+                                                    hipblasStride      strideB,
+                                                    T*                 C,
+                                                    int64_t            ldc,
+                                                    hipblasStride      strideC,
+                                                    int64_t            batchCount);
+
+    MAP2CF_D64(hipblasGeam, float, hipblasSgeam);
+    MAP2CF_D64(hipblasGeam, double, hipblasDgeam);
+    MAP2CF_D64_V2(hipblasGeam, hipblasComplex, hipblasCgeam);
+    MAP2CF_D64_V2(hipblasGeam, hipblasDoubleComplex, hipblasZgeam);
+
+    MAP2CF_D64(hipblasGeamBatched, float, hipblasSgeamBatched);
+    MAP2CF_D64(hipblasGeamBatched, double, hipblasDgeamBatched);
+    MAP2CF_D64_V2(hipblasGeamBatched, hipblasComplex, hipblasCgeamBatched);
+    MAP2CF_D64_V2(hipblasGeamBatched, hipblasDoubleComplex, hipblasZgeamBatched);
+
+    MAP2CF_D64(hipblasGeamStridedBatched, float, hipblasSgeamStridedBatched);
+    MAP2CF_D64(hipblasGeamStridedBatched, double, hipblasDgeamStridedBatched);
+    MAP2CF_D64_V2(hipblasGeamStridedBatched, hipblasComplex, hipblasCgeamStridedBatched);
+    MAP2CF_D64_V2(hipblasGeamStridedBatched, hipblasDoubleComplex, hipblasZgeamStridedBatched);
 
     // hemm
     template <typename T, bool FORTRAN = false>
@@ -7328,14 +12049,64 @@ namespace
                                                  hipblasStride     strideC,
                                                  int               batchCount);
 
-    MAP2CF_V2(hipblasHemm, hipblasComplex, hipblasChemm);
-    MAP2CF_V2(hipblasHemm, hipblasDoubleComplex, hipblasZhemm);
-
-    MAP2CF_V2(hipblasHemmBatched, hipblasComplex, hipblasChemmBatched);
-    MAP2CF_V2(hipblasHemmBatched, hipblasDoubleComplex, hipblasZhemmBatched);
-
-    MAP2CF_V2(hipblasHemmStridedBatched, hipblasComplex, hipblasChemmStridedBatched);
-    MAP2CF_V2(hipblasHemmStridedBatched, hipblasDoubleComplex, hipblasZhemmStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHemm_64)(hipblasHandle_t   handle,
+                                      hipblasSideMode_t side,
+                                      hipblasFillMode_t uplo,
+                                      int64_t           n,
+                                      int64_t           k,
+                                      const T*          alpha,
+                                      const T*          A,
+                                      int64_t           lda,
+                                      const T*          B,
+                                      int64_t           ldb,
+                                      const T*          beta,
+                                      T*                C,
+                                      int64_t           ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHemmBatched_64)(hipblasHandle_t   handle,
+                                             hipblasSideMode_t side,
+                                             hipblasFillMode_t uplo,
+                                             int64_t           n,
+                                             int64_t           k,
+                                             const T*          alpha,
+                                             const T* const    A[],
+                                             int64_t           lda,
+                                             const T* const    B[],
+                                             int64_t           ldb,
+                                             const T*          beta,
+                                             T* const          C[],
+                                             int64_t           ldc,
+                                             int64_t           batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasHemmStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasSideMode_t side,
+                                                    hipblasFillMode_t uplo,
+                                                    int64_t           n,
+                                                    int64_t           k,
+                                                    const T*          alpha,
+                                                    const T*          A,
+                                                    int64_t           lda,
+                                                    hipblasStride     strideA,
+                                                    const T*          B,
+                                                    int64_t           ldb,
+                                                    hipblasStride     strideB,
+                                                    const T*          beta,
+                                                    T*                C,
+                                                    int64_t           ldc,
+                                                    hipblasStride     strideC,
+                                                    int64_t           batchCount);
+
+    MAP2CF_D64_V2(hipblasHemm, hipblasComplex, hipblasChemm);
+    MAP2CF_D64_V2(hipblasHemm, hipblasDoubleComplex, hipblasZhemm);
+
+    MAP2CF_D64_V2(hipblasHemmBatched, hipblasComplex, hipblasChemmBatched);
+    MAP2CF_D64_V2(hipblasHemmBatched, hipblasDoubleComplex, hipblasZhemmBatched);
+
+    MAP2CF_D64_V2(hipblasHemmStridedBatched, hipblasComplex, hipblasChemmStridedBatched);
+    MAP2CF_D64_V2(hipblasHemmStridedBatched, hipblasDoubleComplex, hipblasZhemmStridedBatched);
 
     // trmm
     template <typename T, bool FORTRAN = false>
@@ -7391,20 +12162,73 @@ namespace
                                                  hipblasStride      strideC,
                                                  int                batchCount);
 
-    MAP2CF(hipblasTrmm, float, hipblasStrmm);
-    MAP2CF(hipblasTrmm, double, hipblasDtrmm);
-    MAP2CF_V2(hipblasTrmm, hipblasComplex, hipblasCtrmm);
-    MAP2CF_V2(hipblasTrmm, hipblasDoubleComplex, hipblasZtrmm);
-
-    MAP2CF(hipblasTrmmBatched, float, hipblasStrmmBatched);
-    MAP2CF(hipblasTrmmBatched, double, hipblasDtrmmBatched);
-    MAP2CF_V2(hipblasTrmmBatched, hipblasComplex, hipblasCtrmmBatched);
-    MAP2CF_V2(hipblasTrmmBatched, hipblasDoubleComplex, hipblasZtrmmBatched);
-
-    MAP2CF(hipblasTrmmStridedBatched, float, hipblasStrmmStridedBatched);
-    MAP2CF(hipblasTrmmStridedBatched, double, hipblasDtrmmStridedBatched);
-    MAP2CF_V2(hipblasTrmmStridedBatched, hipblasComplex, hipblasCtrmmStridedBatched);
-    MAP2CF_V2(hipblasTrmmStridedBatched, hipblasDoubleComplex, hipblasZtrmmStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrmm_64)(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      const T*           B,
+                                      int64_t            ldb,
+                                      T*                 C,
+                                      int64_t            ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrmmBatched_64)(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             const T* const     B[],
+                                             int64_t            ldb,
+                                             T* const           C[],
+                                             int64_t            ldc,
+                                             int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrmmStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasSideMode_t  side,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const T*           B,
+                                                    int64_t            ldb,
+                                                    hipblasStride      strideB,
+                                                    T*                 C,
+                                                    int64_t            ldc,
+                                                    hipblasStride      strideC,
+                                                    int64_t            batchCount);
+
+    MAP2CF_D64(hipblasTrmm, float, hipblasStrmm);
+    MAP2CF_D64(hipblasTrmm, double, hipblasDtrmm);
+    MAP2CF_D64_V2(hipblasTrmm, hipblasComplex, hipblasCtrmm);
+    MAP2CF_D64_V2(hipblasTrmm, hipblasDoubleComplex, hipblasZtrmm);
+
+    MAP2CF_D64(hipblasTrmmBatched, float, hipblasStrmmBatched);
+    MAP2CF_D64(hipblasTrmmBatched, double, hipblasDtrmmBatched);
+    MAP2CF_D64_V2(hipblasTrmmBatched, hipblasComplex, hipblasCtrmmBatched);
+    MAP2CF_D64_V2(hipblasTrmmBatched, hipblasDoubleComplex, hipblasZtrmmBatched);
+
+    MAP2CF_D64(hipblasTrmmStridedBatched, float, hipblasStrmmStridedBatched);
+    MAP2CF_D64(hipblasTrmmStridedBatched, double, hipblasDtrmmStridedBatched);
+    MAP2CF_D64_V2(hipblasTrmmStridedBatched, hipblasComplex, hipblasCtrmmStridedBatched);
+    MAP2CF_D64_V2(hipblasTrmmStridedBatched, hipblasDoubleComplex, hipblasZtrmmStridedBatched);
 
     // trsm
     template <typename T, bool FORTRAN = false>
@@ -7453,20 +12277,66 @@ namespace
                                                  hipblasStride      strideB,
                                                  int                batch_count);
 
-    MAP2CF(hipblasTrsm, float, hipblasStrsm);
-    MAP2CF(hipblasTrsm, double, hipblasDtrsm);
-    MAP2CF_V2(hipblasTrsm, hipblasComplex, hipblasCtrsm);
-    MAP2CF_V2(hipblasTrsm, hipblasDoubleComplex, hipblasZtrsm);
-
-    MAP2CF(hipblasTrsmBatched, float, hipblasStrsmBatched);
-    MAP2CF(hipblasTrsmBatched, double, hipblasDtrsmBatched);
-    MAP2CF_V2(hipblasTrsmBatched, hipblasComplex, hipblasCtrsmBatched);
-    MAP2CF_V2(hipblasTrsmBatched, hipblasDoubleComplex, hipblasZtrsmBatched);
-
-    MAP2CF(hipblasTrsmStridedBatched, float, hipblasStrsmStridedBatched);
-    MAP2CF(hipblasTrsmStridedBatched, double, hipblasDtrsmStridedBatched);
-    MAP2CF_V2(hipblasTrsmStridedBatched, hipblasComplex, hipblasCtrsmStridedBatched);
-    MAP2CF_V2(hipblasTrsmStridedBatched, hipblasDoubleComplex, hipblasZtrsmStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrsm_64)(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int64_t            lda,
+                                      T*                 B,
+                                      int64_t            ldb);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrsmBatched_64)(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const T*           alpha,
+                                             const T* const     A[],
+                                             int64_t            lda,
+                                             T* const           B[],
+                                             int64_t            ldb,
+                                             int64_t            batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasTrsmStridedBatched_64)(hipblasHandle_t    handle,
+                                                    hipblasSideMode_t  side,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    T*                 B,
+                                                    int64_t            ldb,
+                                                    hipblasStride      strideB,
+                                                    int64_t            batch_count);
+
+    MAP2CF_D64(hipblasTrsm, float, hipblasStrsm);
+    MAP2CF_D64(hipblasTrsm, double, hipblasDtrsm);
+    MAP2CF_D64_V2(hipblasTrsm, hipblasComplex, hipblasCtrsm);
+    MAP2CF_D64_V2(hipblasTrsm, hipblasDoubleComplex, hipblasZtrsm);
+
+    MAP2CF_D64(hipblasTrsmBatched, float, hipblasStrsmBatched);
+    MAP2CF_D64(hipblasTrsmBatched, double, hipblasDtrsmBatched);
+    MAP2CF_D64_V2(hipblasTrsmBatched, hipblasComplex, hipblasCtrsmBatched);
+    MAP2CF_D64_V2(hipblasTrsmBatched, hipblasDoubleComplex, hipblasZtrsmBatched);
+
+    MAP2CF_D64(hipblasTrsmStridedBatched, float, hipblasStrsmStridedBatched);
+    MAP2CF_D64(hipblasTrsmStridedBatched, double, hipblasDtrsmStridedBatched);
+    MAP2CF_D64_V2(hipblasTrsmStridedBatched, hipblasComplex, hipblasCtrsmStridedBatched);
+    MAP2CF_D64_V2(hipblasTrsmStridedBatched, hipblasDoubleComplex, hipblasZtrsmStridedBatched);
 
     // dgmm
     template <typename T, bool FORTRAN = false>
@@ -7510,20 +12380,61 @@ namespace
                                                  hipblasStride     stride_C,
                                                  int               batch_count);
 
-    MAP2CF(hipblasDgmm, float, hipblasSdgmm);
-    MAP2CF(hipblasDgmm, double, hipblasDdgmm);
-    MAP2CF_V2(hipblasDgmm, hipblasComplex, hipblasCdgmm);
-    MAP2CF_V2(hipblasDgmm, hipblasDoubleComplex, hipblasZdgmm);
-
-    MAP2CF(hipblasDgmmBatched, float, hipblasSdgmmBatched);
-    MAP2CF(hipblasDgmmBatched, double, hipblasDdgmmBatched);
-    MAP2CF_V2(hipblasDgmmBatched, hipblasComplex, hipblasCdgmmBatched);
-    MAP2CF_V2(hipblasDgmmBatched, hipblasDoubleComplex, hipblasZdgmmBatched);
-
-    MAP2CF(hipblasDgmmStridedBatched, float, hipblasSdgmmStridedBatched);
-    MAP2CF(hipblasDgmmStridedBatched, double, hipblasDdgmmStridedBatched);
-    MAP2CF_V2(hipblasDgmmStridedBatched, hipblasComplex, hipblasCdgmmStridedBatched);
-    MAP2CF_V2(hipblasDgmmStridedBatched, hipblasDoubleComplex, hipblasZdgmmStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasDgmm_64)(hipblasHandle_t   handle,
+                                      hipblasSideMode_t side,
+                                      int64_t           m,
+                                      int64_t           n,
+                                      const T*          A,
+                                      int64_t           lda,
+                                      const T*          x,
+                                      int64_t           incx,
+                                      T*                C,
+                                      int64_t           ldc);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasDgmmBatched_64)(hipblasHandle_t   handle,
+                                             hipblasSideMode_t side,
+                                             int64_t           m,
+                                             int64_t           n,
+                                             const T* const    A[],
+                                             int64_t           lda,
+                                             const T* const    x[],
+                                             int64_t           incx,
+                                             T* const          C[],
+                                             int64_t           ldc,
+                                             int64_t           batch_count);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasDgmmStridedBatched_64)(hipblasHandle_t   handle,
+                                                    hipblasSideMode_t side,
+                                                    int64_t           m,
+                                                    int64_t           n,
+                                                    const T*          A,
+                                                    int64_t           lda,
+                                                    hipblasStride     stride_A,
+                                                    const T*          x,
+                                                    int64_t           incx,
+                                                    hipblasStride     stride_x,
+                                                    T*                C,
+                                                    int64_t           ldc,
+                                                    hipblasStride     stride_C,
+                                                    int64_t           batch_count);
+
+    MAP2CF_D64(hipblasDgmm, float, hipblasSdgmm);
+    MAP2CF_D64(hipblasDgmm, double, hipblasDdgmm);
+    MAP2CF_D64_V2(hipblasDgmm, hipblasComplex, hipblasCdgmm);
+    MAP2CF_D64_V2(hipblasDgmm, hipblasDoubleComplex, hipblasZdgmm);
+
+    MAP2CF_D64(hipblasDgmmBatched, float, hipblasSdgmmBatched);
+    MAP2CF_D64(hipblasDgmmBatched, double, hipblasDdgmmBatched);
+    MAP2CF_D64_V2(hipblasDgmmBatched, hipblasComplex, hipblasCdgmmBatched);
+    MAP2CF_D64_V2(hipblasDgmmBatched, hipblasDoubleComplex, hipblasZdgmmBatched);
+
+    MAP2CF_D64(hipblasDgmmStridedBatched, float, hipblasSdgmmStridedBatched);
+    MAP2CF_D64(hipblasDgmmStridedBatched, double, hipblasDdgmmStridedBatched);
+    MAP2CF_D64_V2(hipblasDgmmStridedBatched, hipblasComplex, hipblasCdgmmStridedBatched);
+    MAP2CF_D64_V2(hipblasDgmmStridedBatched, hipblasDoubleComplex, hipblasZdgmmStridedBatched);
 
     // trtri
     template <typename T, bool FORTRAN = false>
@@ -7602,20 +12513,48 @@ namespace
                                                   int*                info,
                                                   const int           batchCount);
 
-    MAP2CF(hipblasGetrf, float, hipblasSgetrf);
-    MAP2CF(hipblasGetrf, double, hipblasDgetrf);
-    MAP2CF_V2(hipblasGetrf, hipblasComplex, hipblasCgetrf);
-    MAP2CF_V2(hipblasGetrf, hipblasDoubleComplex, hipblasZgetrf);
-
-    MAP2CF(hipblasGetrfBatched, float, hipblasSgetrfBatched);
-    MAP2CF(hipblasGetrfBatched, double, hipblasDgetrfBatched);
-    MAP2CF_V2(hipblasGetrfBatched, hipblasComplex, hipblasCgetrfBatched);
-    MAP2CF_V2(hipblasGetrfBatched, hipblasDoubleComplex, hipblasZgetrfBatched);
-
-    MAP2CF(hipblasGetrfStridedBatched, float, hipblasSgetrfStridedBatched);
-    MAP2CF(hipblasGetrfStridedBatched, double, hipblasDgetrfStridedBatched);
-    MAP2CF_V2(hipblasGetrfStridedBatched, hipblasComplex, hipblasCgetrfStridedBatched);
-    MAP2CF_V2(hipblasGetrfStridedBatched, hipblasDoubleComplex, hipblasZgetrfStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGetrf_64)(hipblasHandle_t handle,
+                                       const int64_t   n,
+                                       T*              A,
+                                       const int64_t   lda,
+                                       int64_t*        ipiv,
+                                       int64_t*        info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGetrfBatched_64)(hipblasHandle_t handle,
+                                              const int64_t   n,
+                                              T* const        A[],
+                                              const int64_t   lda,
+                                              int64_t*        ipiv,
+                                              int64_t*        info,
+                                              const int64_t   batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGetrfStridedBatched_64)(hipblasHandle_t     handle,
+                                                     const int64_t       n,
+                                                     T*                  A,
+                                                     const int64_t       lda,
+                                                     const hipblasStride strideA,
+                                                     int64_t*            ipiv,
+                                                     const hipblasStride strideP,
+                                                     int64_t*            info,
+                                                     const int64_t       batchCount);
+
+    MAP2CF_D64(hipblasGetrf, float, hipblasSgetrf);
+    MAP2CF_D64(hipblasGetrf, double, hipblasDgetrf);
+    MAP2CF_D64_V2(hipblasGetrf, hipblasComplex, hipblasCgetrf);
+    MAP2CF_D64_V2(hipblasGetrf, hipblasDoubleComplex, hipblasZgetrf);
+
+    MAP2CF_D64(hipblasGetrfBatched, float, hipblasSgetrfBatched);
+    MAP2CF_D64(hipblasGetrfBatched, double, hipblasDgetrfBatched);
+    MAP2CF_D64_V2(hipblasGetrfBatched, hipblasComplex, hipblasCgetrfBatched);
+    MAP2CF_D64_V2(hipblasGetrfBatched, hipblasDoubleComplex, hipblasZgetrfBatched);
+
+    MAP2CF_D64(hipblasGetrfStridedBatched, float, hipblasSgetrfStridedBatched);
+    MAP2CF_D64(hipblasGetrfStridedBatched, double, hipblasDgetrfStridedBatched);
+    MAP2CF_D64_V2(hipblasGetrfStridedBatched, hipblasComplex, hipblasCgetrfStridedBatched);
+    MAP2CF_D64_V2(hipblasGetrfStridedBatched, hipblasDoubleComplex, hipblasZgetrfStridedBatched);
 
     // getrs
     template <typename T, bool FORTRAN = false>
@@ -7659,20 +12598,61 @@ namespace
                                                   int*                     info,
                                                   const int                batchCount);
 
-    MAP2CF(hipblasGetrs, float, hipblasSgetrs);
-    MAP2CF(hipblasGetrs, double, hipblasDgetrs);
-    MAP2CF_V2(hipblasGetrs, hipblasComplex, hipblasCgetrs);
-    MAP2CF_V2(hipblasGetrs, hipblasDoubleComplex, hipblasZgetrs);
-
-    MAP2CF(hipblasGetrsBatched, float, hipblasSgetrsBatched);
-    MAP2CF(hipblasGetrsBatched, double, hipblasDgetrsBatched);
-    MAP2CF_V2(hipblasGetrsBatched, hipblasComplex, hipblasCgetrsBatched);
-    MAP2CF_V2(hipblasGetrsBatched, hipblasDoubleComplex, hipblasZgetrsBatched);
-
-    MAP2CF(hipblasGetrsStridedBatched, float, hipblasSgetrsStridedBatched);
-    MAP2CF(hipblasGetrsStridedBatched, double, hipblasDgetrsStridedBatched);
-    MAP2CF_V2(hipblasGetrsStridedBatched, hipblasComplex, hipblasCgetrsStridedBatched);
-    MAP2CF_V2(hipblasGetrsStridedBatched, hipblasDoubleComplex, hipblasZgetrsStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGetrs_64)(hipblasHandle_t          handle,
+                                       const hipblasOperation_t trans,
+                                       const int64_t            n,
+                                       const int64_t            nrhs,
+                                       T*                       A,
+                                       const int64_t            lda,
+                                       const int64_t*           ipiv,
+                                       T*                       B,
+                                       const int64_t            ldb,
+                                       int64_t*                 info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGetrsBatched_64)(hipblasHandle_t          handle,
+                                              const hipblasOperation_t trans,
+                                              const int64_t            n,
+                                              const int64_t            nrhs,
+                                              T* const                 A[],
+                                              const int64_t            lda,
+                                              const int64_t*           ipiv,
+                                              T* const                 B[],
+                                              const int64_t            ldb,
+                                              int64_t*                 info,
+                                              const int64_t            batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGetrsStridedBatched_64)(hipblasHandle_t          handle,
+                                                     const hipblasOperation_t trans,
+                                                     const int64_t            n,
+                                                     const int64_t            nrhs,
+                                                     T*                       A,
+                                                     const int64_t            lda,
+                                                     const hipblasStride      strideA,
+                                                     const int64_t*           ipiv,
+                                                     const hipblasStride      strideP,
+                                                     T*                       B,
+                                                     const int64_t            ldb,
+                                                     const hipblasStride      strideB,
+                                                     int64_t*                 info,
+                                                     const int64_t            batchCount);
+
+    MAP2CF_D64(hipblasGetrs, float, hipblasSgetrs);
+    MAP2CF_D64(hipblasGetrs, double, hipblasDgetrs);
+    MAP2CF_D64_V2(hipblasGetrs, hipblasComplex, hipblasCgetrs);
+    MAP2CF_D64_V2(hipblasGetrs, hipblasDoubleComplex, hipblasZgetrs);
+
+    MAP2CF_D64(hipblasGetrsBatched, float, hipblasSgetrsBatched);
+    MAP2CF_D64(hipblasGetrsBatched, double, hipblasDgetrsBatched);
+    MAP2CF_D64_V2(hipblasGetrsBatched, hipblasComplex, hipblasCgetrsBatched);
+    MAP2CF_D64_V2(hipblasGetrsBatched, hipblasDoubleComplex, hipblasZgetrsBatched);
+
+    MAP2CF_D64(hipblasGetrsStridedBatched, float, hipblasSgetrsStridedBatched);
+    MAP2CF_D64(hipblasGetrsStridedBatched, double, hipblasDgetrsStridedBatched);
+    MAP2CF_D64_V2(hipblasGetrsStridedBatched, hipblasComplex, hipblasCgetrsStridedBatched);
+    MAP2CF_D64_V2(hipblasGetrsStridedBatched, hipblasDoubleComplex, hipblasZgetrsStridedBatched);
 
     // getri
     template <typename T, bool FORTRAN = false>
@@ -7691,6 +12671,462 @@ namespace
     MAP2CF_V2(hipblasGetriBatched, hipblasComplex, hipblasCgetriBatched);
     MAP2CF_V2(hipblasGetriBatched, hipblasDoubleComplex, hipblasZgetriBatched);
 
+    // potrf
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrf)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrfBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrfStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotrf, float, hipblasSpotrf);
+    MAP2CF(hipblasPotrf, double, hipblasDpotrf);
+    MAP2CF_V2(hipblasPotrf, hipblasComplex, hipblasCpotrf);
+    MAP2CF_V2(hipblasPotrf, hipblasDoubleComplex, hipblasZpotrf);
+
+    MAP2CF(hipblasPotrfBatched, float, hipblasSpotrfBatched);
+    MAP2CF(hipblasPotrfBatched, double, hipblasDpotrfBatched);
+    MAP2CF_V2(hipblasPotrfBatched, hipblasComplex, hipblasCpotrfBatched);
+    MAP2CF_V2(hipblasPotrfBatched, hipblasDoubleComplex, hipblasZpotrfBatched);
+
+    MAP2CF(hipblasPotrfStridedBatched, float, hipblasSpotrfStridedBatched);
+    MAP2CF(hipblasPotrfStridedBatched, double, hipblasDpotrfStridedBatched);
+    MAP2CF_V2(hipblasPotrfStridedBatched, hipblasComplex, hipblasCpotrfStridedBatched);
+    MAP2CF_V2(hipblasPotrfStridedBatched, hipblasDoubleComplex, hipblasZpotrfStridedBatched);
+
+    // potrs
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrs)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T*                      A,
+                                    const int               lda,
+                                    T*                      B,
+                                    const int               ldb,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrsBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T* const                A[],
+                                           const int               lda,
+                                           T* const                B[],
+                                           const int               ldb,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrsStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  T*                      B,
+                                                  const int               ldb,
+                                                  const hipblasStride     strideB,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotrs, float, hipblasSpotrs);
+    MAP2CF(hipblasPotrs, double, hipblasDpotrs);
+    MAP2CF_V2(hipblasPotrs, hipblasComplex, hipblasCpotrs);
+    MAP2CF_V2(hipblasPotrs, hipblasDoubleComplex, hipblasZpotrs);
+
+    MAP2CF(hipblasPotrsBatched, float, hipblasSpotrsBatched);
+    MAP2CF(hipblasPotrsBatched, double, hipblasDpotrsBatched);
+    MAP2CF_V2(hipblasPotrsBatched, hipblasComplex, hipblasCpotrsBatched);
+    MAP2CF_V2(hipblasPotrsBatched, hipblasDoubleComplex, hipblasZpotrsBatched);
+
+    MAP2CF(hipblasPotrsStridedBatched, float, hipblasSpotrsStridedBatched);
+    MAP2CF(hipblasPotrsStridedBatched, double, hipblasDpotrsStridedBatched);
+    MAP2CF_V2(hipblasPotrsStridedBatched, hipblasComplex, hipblasCpotrsStridedBatched);
+    MAP2CF_V2(hipblasPotrsStridedBatched, hipblasDoubleComplex, hipblasZpotrsStridedBatched);
+
+    // potri
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotri)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotriBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotriStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotri, float, hipblasSpotri);
+    MAP2CF(hipblasPotri, double, hipblasDpotri);
+    MAP2CF_V2(hipblasPotri, hipblasComplex, hipblasCpotri);
+    MAP2CF_V2(hipblasPotri, hipblasDoubleComplex, hipblasZpotri);
+
+    MAP2CF(hipblasPotriBatched, float, hipblasSpotriBatched);
+    MAP2CF(hipblasPotriBatched, double, hipblasDpotriBatched);
+    MAP2CF_V2(hipblasPotriBatched, hipblasComplex, hipblasCpotriBatched);
+    MAP2CF_V2(hipblasPotriBatched, hipblasDoubleComplex, hipblasZpotriBatched);
+
+    MAP2CF(hipblasPotriStridedBatched, float, hipblasSpotriStridedBatched);
+    MAP2CF(hipblasPotriStridedBatched, double, hipblasDpotriStridedBatched);
+    MAP2CF_V2(hipblasPotriStridedBatched, hipblasComplex, hipblasCpotriStridedBatched);
+    MAP2CF_V2(hipblasPotriStridedBatched, hipblasDoubleComplex, hipblasZpotriStridedBatched);
+
+    // syevd
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevd)(hipblasHandle_t         handle,
+                                    const hipblasEigMode_t  jobz,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    U*                      W,
+                                    int*                    info);
+
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevdBatched)(hipblasHandle_t         handle,
+                                           const hipblasEigMode_t  jobz,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           U*                      W,
+                                           const hipblasStride     strideW,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, typename U, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevdStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasEigMode_t  jobz,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  U*                      W,
+                                                  const hipblasStride     strideW,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasSyevdWorkspaceSize)(hipblasHandle_t         handle,
+                                                 const hipblasEigMode_t  jobz,
+                                                 const hipblasFillMode_t uplo,
+                                                 const int               n,
+                                                 const int               lda,
+                                                 size_t*                 workspaceSizeInBytes);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t
+        (*hipblasSyevdBatchedWorkspaceSize)(hipblasHandle_t         handle,
+                                            const hipblasEigMode_t  jobz,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               lda,
+                                            const int               batchCount,
+                                            size_t*                 workspaceSizeInBytes);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t
+        (*hipblasSyevdStridedBatchedWorkspaceSize)(hipblasHandle_t         handle,
+                                                   const hipblasEigMode_t  jobz,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               lda,
+                                                   const int               batchCount,
+                                                   size_t*                 workspaceSizeInBytes);
+
+    MAP2CF(hipblasSyevd, float, float, hipblasSsyevd);
+    MAP2CF(hipblasSyevd, double, double, hipblasDsyevd);
+    MAP2CF_V2(hipblasSyevd, hipblasComplex, float, hipblasCheevd);
+    MAP2CF_V2(hipblasSyevd, hipblasDoubleComplex, double, hipblasZheevd);
+
+    MAP2CF(hipblasSyevdBatched, float, float, hipblasSsyevdBatched);
+    MAP2CF(hipblasSyevdBatched, double, double, hipblasDsyevdBatched);
+    MAP2CF_V2(hipblasSyevdBatched, hipblasComplex, float, hipblasCheevdBatched);
+    MAP2CF_V2(hipblasSyevdBatched, hipblasDoubleComplex, double, hipblasZheevdBatched);
+
+    MAP2CF(hipblasSyevdStridedBatched, float, float, hipblasSsyevdStridedBatched);
+    MAP2CF(hipblasSyevdStridedBatched, double, double, hipblasDsyevdStridedBatched);
+    MAP2CF_V2(hipblasSyevdStridedBatched, hipblasComplex, float, hipblasCheevdStridedBatched);
+    MAP2CF_V2(
+        hipblasSyevdStridedBatched, hipblasDoubleComplex, double, hipblasZheevdStridedBatched);
+
+    MAP2CF(hipblasSyevdWorkspaceSize, float, hipblasSsyevdWorkspaceSize);
+    MAP2CF(hipblasSyevdWorkspaceSize, double, hipblasDsyevdWorkspaceSize);
+    MAP2CF(hipblasSyevdWorkspaceSize, hipblasComplex, hipblasCheevdWorkspaceSize);
+    MAP2CF(hipblasSyevdWorkspaceSize, hipblasDoubleComplex, hipblasZheevdWorkspaceSize);
+
+    MAP2CF(hipblasSyevdBatchedWorkspaceSize, float, hipblasSsyevdBatchedWorkspaceSize);
+    MAP2CF(hipblasSyevdBatchedWorkspaceSize, double, hipblasDsyevdBatchedWorkspaceSize);
+    MAP2CF(hipblasSyevdBatchedWorkspaceSize, hipblasComplex, hipblasCheevdBatchedWorkspaceSize);
+    MAP2CF(
+        hipblasSyevdBatchedWorkspaceSize, hipblasDoubleComplex, hipblasZheevdBatchedWorkspaceSize);
+
+    MAP2CF(
+        hipblasSyevdStridedBatchedWorkspaceSize, float, hipblasSsyevdStridedBatchedWorkspaceSize);
+    MAP2CF(
+        hipblasSyevdStridedBatchedWorkspaceSize, double, hipblasDsyevdStridedBatchedWorkspaceSize);
+    MAP2CF(hipblasSyevdStridedBatchedWorkspaceSize,
+           hipblasComplex,
+           hipblasCheevdStridedBatchedWorkspaceSize);
+    MAP2CF(hipblasSyevdStridedBatchedWorkspaceSize,
+           hipblasDoubleComplex,
+           hipblasZheevdStridedBatchedWorkspaceSize);
+
+    // gesvd
+    template <typename T, typename R, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvd)(hipblasHandle_t        handle,
+                                    const hipblasSvdMode_t jobu,
+                                    const hipblasSvdMode_t jobv,
+                                    const int              m,
+                                    const int              n,
+                                    T*                     A,
+                                    const int              lda,
+                                    R*                     S,
+                                    T*                     U,
+                                    const int              ldu,
+                                    T*                     V,
+                                    const int              ldv,
+                                    int*                   info);
+
+    template <typename T, typename R, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvdBatched)(hipblasHandle_t        handle,
+                                           const hipblasSvdMode_t jobu,
+                                           const hipblasSvdMode_t jobv,
+                                           const int              m,
+                                           const int              n,
+                                           T* const               A[],
+                                           const int              lda,
+                                           R*                     S,
+                                           const hipblasStride    strideS,
+                                           T*                     U,
+                                           const int              ldu,
+                                           const hipblasStride    strideU,
+                                           T*                     V,
+                                           const int              ldv,
+                                           const hipblasStride    strideV,
+                                           int*                   info,
+                                           const int              batchCount);
+
+    template <typename T, typename R, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvdStridedBatched)(hipblasHandle_t        handle,
+                                                  const hipblasSvdMode_t jobu,
+                                                  const hipblasSvdMode_t jobv,
+                                                  const int              m,
+                                                  const int              n,
+                                                  T*                     A,
+                                                  const int              lda,
+                                                  const hipblasStride    strideA,
+                                                  R*                     S,
+                                                  const hipblasStride    strideS,
+                                                  T*                     U,
+                                                  const int              ldu,
+                                                  const hipblasStride    strideU,
+                                                  T*                     V,
+                                                  const int              ldv,
+                                                  const hipblasStride    strideV,
+                                                  int*                   info,
+                                                  const int              batchCount);
+
+    MAP2CF(hipblasGesvd, float, float, hipblasSgesvd);
+    MAP2CF(hipblasGesvd, double, double, hipblasDgesvd);
+    MAP2CF_V2(hipblasGesvd, hipblasComplex, float, hipblasCgesvd);
+    MAP2CF_V2(hipblasGesvd, hipblasDoubleComplex, double, hipblasZgesvd);
+
+    MAP2CF(hipblasGesvdBatched, float, float, hipblasSgesvdBatched);
+    MAP2CF(hipblasGesvdBatched, double, double, hipblasDgesvdBatched);
+    MAP2CF_V2(hipblasGesvdBatched, hipblasComplex, float, hipblasCgesvdBatched);
+    MAP2CF_V2(hipblasGesvdBatched, hipblasDoubleComplex, double, hipblasZgesvdBatched);
+
+    MAP2CF(hipblasGesvdStridedBatched, float, float, hipblasSgesvdStridedBatched);
+    MAP2CF(hipblasGesvdStridedBatched, double, double, hipblasDgesvdStridedBatched);
+    MAP2CF_V2(hipblasGesvdStridedBatched, hipblasComplex, float, hipblasCgesvdStridedBatched);
+    MAP2CF_V2(
+        hipblasGesvdStridedBatched, hipblasDoubleComplex, double, hipblasZgesvdStridedBatched);
+
+    // gesvdj
+    template <typename T, typename R, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvdj)(hipblasHandle_t        handle,
+                                     const hipblasSvdMode_t jobu,
+                                     const hipblasSvdMode_t jobv,
+                                     const int              m,
+                                     const int              n,
+                                     T*                     A,
+                                     const int              lda,
+                                     const R                abstol,
+                                     R*                     residual,
+                                     const int              maxSweeps,
+                                     int*                   nSweeps,
+                                     R*                     S,
+                                     T*                     U,
+                                     const int              ldu,
+                                     T*                     V,
+                                     const int              ldv,
+                                     int*                   info);
+
+    template <typename T, typename R, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvdjBatched)(hipblasHandle_t        handle,
+                                            const hipblasSvdMode_t jobu,
+                                            const hipblasSvdMode_t jobv,
+                                            const int              m,
+                                            const int              n,
+                                            T* const               A[],
+                                            const int              lda,
+                                            const R                abstol,
+                                            R*                     residual,
+                                            const int              maxSweeps,
+                                            int*                   nSweeps,
+                                            R*                     S,
+                                            const hipblasStride    strideS,
+                                            T*                     U,
+                                            const int              ldu,
+                                            const hipblasStride    strideU,
+                                            T*                     V,
+                                            const int              ldv,
+                                            const hipblasStride    strideV,
+                                            int*                   info,
+                                            const int              batchCount);
+
+    template <typename T, typename R, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvdjStridedBatched)(hipblasHandle_t        handle,
+                                                   const hipblasSvdMode_t jobu,
+                                                   const hipblasSvdMode_t jobv,
+                                                   const int              m,
+                                                   const int              n,
+                                                   T*                     A,
+                                                   const int              lda,
+                                                   const hipblasStride    strideA,
+                                                   const R                abstol,
+                                                   R*                     residual,
+                                                   const int              maxSweeps,
+                                                   int*                   nSweeps,
+                                                   R*                     S,
+                                                   const hipblasStride    strideS,
+                                                   T*                     U,
+                                                   const int              ldu,
+                                                   const hipblasStride    strideU,
+                                                   T*                     V,
+                                                   const int              ldv,
+                                                   const hipblasStride    strideV,
+                                                   int*                   info,
+                                                   const int              batchCount);
+
+    MAP2CF(hipblasGesvdj, float, float, hipblasSgesvdj);
+    MAP2CF(hipblasGesvdj, double, double, hipblasDgesvdj);
+    MAP2CF_V2(hipblasGesvdj, hipblasComplex, float, hipblasCgesvdj);
+    MAP2CF_V2(hipblasGesvdj, hipblasDoubleComplex, double, hipblasZgesvdj);
+
+    MAP2CF(hipblasGesvdjBatched, float, float, hipblasSgesvdjBatched);
+    MAP2CF(hipblasGesvdjBatched, double, double, hipblasDgesvdjBatched);
+    MAP2CF_V2(hipblasGesvdjBatched, hipblasComplex, float, hipblasCgesvdjBatched);
+    MAP2CF_V2(hipblasGesvdjBatched, hipblasDoubleComplex, double, hipblasZgesvdjBatched);
+
+    MAP2CF(hipblasGesvdjStridedBatched, float, float, hipblasSgesvdjStridedBatched);
+    MAP2CF(hipblasGesvdjStridedBatched, double, double, hipblasDgesvdjStridedBatched);
+    MAP2CF_V2(hipblasGesvdjStridedBatched, hipblasComplex, float, hipblasCgesvdjStridedBatched);
+    MAP2CF_V2(
+        hipblasGesvdjStridedBatched, hipblasDoubleComplex, double, hipblasZgesvdjStridedBatched);
+
+    // gesv
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesv)(hipblasHandle_t handle,
+                                   const int       n,
+                                   const int       nrhs,
+                                   T*              A,
+                                   const int       lda,
+                                   int*            ipiv,
+                                   const T*        B,
+                                   const int       ldb,
+                                   T*              X,
+                                   const int       ldx,
+                                   int*            iter,
+                                   int*            info,
+                                   int*            deviceInfo);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvBatched)(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       nrhs,
+                                          T* const        A[],
+                                          const int       lda,
+                                          int*            ipiv,
+                                          const T* const  B[],
+                                          const int       ldb,
+                                          T* const        X[],
+                                          const int       ldx,
+                                          int*            iter,
+                                          int*            info,
+                                          int*            deviceInfo,
+                                          const int       batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGesvStridedBatched)(hipblasHandle_t     handle,
+                                                 const int           n,
+                                                 const int           nrhs,
+                                                 T*                  A,
+                                                 const int           lda,
+                                                 const hipblasStride strideA,
+                                                 int*                ipiv,
+                                                 const hipblasStride strideP,
+                                                 const T*            B,
+                                                 const int           ldb,
+                                                 const hipblasStride strideB,
+                                                 T*                  X,
+                                                 const int           ldx,
+                                                 const hipblasStride strideX,
+                                                 int*                iter,
+                                                 int*                info,
+                                                 int*                deviceInfo,
+                                                 const int           batchCount);
+
+    MAP2CF(hipblasGesv, double, hipblasDSgesv);
+    MAP2CF_V2(hipblasGesv, hipblasDoubleComplex, hipblasZCgesv);
+
+    MAP2CF(hipblasGesvBatched, double, hipblasDSgesvBatched);
+    MAP2CF_V2(hipblasGesvBatched, hipblasDoubleComplex, hipblasZCgesvBatched);
+
+    MAP2CF(hipblasGesvStridedBatched, double, hipblasDSgesvStridedBatched);
+    MAP2CF_V2(hipblasGesvStridedBatched, hipblasDoubleComplex, hipblasZCgesvStridedBatched);
+
     // geqrf
     template <typename T, bool FORTRAN = false>
     hipblasStatus_t (*hipblasGeqrf)(
@@ -7718,20 +13154,51 @@ namespace
                                                   int*                info,
                                                   const int           batchCount);
 
-    MAP2CF(hipblasGeqrf, float, hipblasSgeqrf);
-    MAP2CF(hipblasGeqrf, double, hipblasDgeqrf);
-    MAP2CF_V2(hipblasGeqrf, hipblasComplex, hipblasCgeqrf);
-    MAP2CF_V2(hipblasGeqrf, hipblasDoubleComplex, hipblasZgeqrf);
-
-    MAP2CF(hipblasGeqrfBatched, float, hipblasSgeqrfBatched);
-    MAP2CF(hipblasGeqrfBatched, double, hipblasDgeqrfBatched);
-    MAP2CF_V2(hipblasGeqrfBatched, hipblasComplex, hipblasCgeqrfBatched);
-    MAP2CF_V2(hipblasGeqrfBatched, hipblasDoubleComplex, hipblasZgeqrfBatched);
-
-    MAP2CF(hipblasGeqrfStridedBatched, float, hipblasSgeqrfStridedBatched);
-    MAP2CF(hipblasGeqrfStridedBatched, double, hipblasDgeqrfStridedBatched);
-    MAP2CF_V2(hipblasGeqrfStridedBatched, hipblasComplex, hipblasCgeqrfStridedBatched);
-    MAP2CF_V2(hipblasGeqrfStridedBatched, hipblasDoubleComplex, hipblasZgeqrfStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGeqrf_64)(hipblasHandle_t handle,
+                                       const int64_t   m,
+                                       const int64_t   n,
+                                       T*              A,
+                                       const int64_t   lda,
+                                       T*              ipiv,
+                                       int64_t*        info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGeqrfBatched_64)(hipblasHandle_t handle,
+                                              const int64_t   m,
+                                              const int64_t   n,
+                                              T* const        A[],
+                                              const int64_t   lda,
+                                              T* const        ipiv[],
+                                              int64_t*        info,
+                                              const int64_t   batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGeqrfStridedBatched_64)(hipblasHandle_t     handle,
+                                                     const int64_t       m,
+                                                     const int64_t       n,
+                                                     T*                  A,
+                                                     const int64_t       lda,
+                                                     const hipblasStride strideA,
+                                                     T*                  ipiv,
+                                                     const hipblasStride strideP,
+                                                     int64_t*            info,
+                                                     const int64_t       batchCount);
+
+    MAP2CF_D64(hipblasGeqrf, float, hipblasSgeqrf);
+    MAP2CF_D64(hipblasGeqrf, double, hipblasDgeqrf);
+    MAP2CF_D64_V2(hipblasGeqrf, hipblasComplex, hipblasCgeqrf);
+    MAP2CF_D64_V2(hipblasGeqrf, hipblasDoubleComplex, hipblasZgeqrf);
+
+    MAP2CF_D64(hipblasGeqrfBatched, float, hipblasSgeqrfBatched);
+    MAP2CF_D64(hipblasGeqrfBatched, double, hipblasDgeqrfBatched);
+    MAP2CF_D64_V2(hipblasGeqrfBatched, hipblasComplex, hipblasCgeqrfBatched);
+    MAP2CF_D64_V2(hipblasGeqrfBatched, hipblasDoubleComplex, hipblasZgeqrfBatched);
+
+    MAP2CF_D64(hipblasGeqrfStridedBatched, float, hipblasSgeqrfStridedBatched);
+    MAP2CF_D64(hipblasGeqrfStridedBatched, double, hipblasDgeqrfStridedBatched);
+    MAP2CF_D64_V2(hipblasGeqrfStridedBatched, hipblasComplex, hipblasCgeqrfStridedBatched);
+    MAP2CF_D64_V2(hipblasGeqrfStridedBatched, hipblasDoubleComplex, hipblasZgeqrfStridedBatched);
 
     // gels
     template <typename T, bool FORTRAN = false>
@@ -7777,20 +13244,63 @@ namespace
                                                  int*                deviceInfo,
                                                  const int           batchCount);
 
-    MAP2CF(hipblasGels, float, hipblasSgels);
-    MAP2CF(hipblasGels, double, hipblasDgels);
-    MAP2CF_V2(hipblasGels, hipblasComplex, hipblasCgels);
-    MAP2CF_V2(hipblasGels, hipblasDoubleComplex, hipblasZgels);
-
-    MAP2CF(hipblasGelsBatched, float, hipblasSgelsBatched);
-    MAP2CF(hipblasGelsBatched, double, hipblasDgelsBatched);
-    MAP2CF_V2(hipblasGelsBatched, hipblasComplex, hipblasCgelsBatched);
-    MAP2CF_V2(hipblasGelsBatched, hipblasDoubleComplex, hipblasZgelsBatched);
-
-    MAP2CF(hipblasGelsStridedBatched, float, hipblasSgelsStridedBatched);
-    MAP2CF(hipblasGelsStridedBatched, double, hipblasDgelsStridedBatched);
-    MAP2CF_V2(hipblasGelsStridedBatched, hipblasComplex, hipblasCgelsStridedBatched);
-    MAP2CF_V2(hipblasGelsStridedBatched, hipblasDoubleComplex, hipblasZgelsStridedBatched);
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGels_64)(hipblasHandle_t    handle,
+                                      hipblasOperation_t trans,
+                                      const int64_t      m,
+                                      const int64_t      n,
+                                      const int64_t      nrhs,
+                                      T*                 A,
+                                      const int64_t      lda,
+                                      T*                 B,
+                                      const int64_t      ldb,
+                                      int64_t*           info,
+                                      int64_t*           deviceInfo);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGelsBatched_64)(hipblasHandle_t    handle,
+                                             hipblasOperation_t trans,
+                                             const int64_t      m,
+                                             const int64_t      n,
+                                             const int64_t      nrhs,
+                                             T* const           A[],
+                                             const int64_t      lda,
+                                             T* const           B[],
+                                             const int64_t      ldb,
+                                             int64_t*           info,
+                                             int64_t*           deviceInfo,
+                                             const int64_t      batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasGelsStridedBatched_64)(hipblasHandle_t     handle,
+                                                    hipblasOperation_t  trans,
+                                                    const int64_t       m,
+                                                    const int64_t       n,
+                                                    const int64_t       nrhs,
+                                                    T*                  A,
+                                                    const int64_t       lda,
+                                                    const hipblasStride strideA,
+                                                    T*                  B,
+                                                    const int64_t       ldb,
+                                                    const hipblasStride strideB,
+                                                    int64_t*            info,
+                                                    int64_t*            deviceInfo,
+                                                    const int64_t       batchCount);
+
+    MAP2CF_D64(hipblasGels, float, hipblasSgels);
+    MAP2CF_D64(hipblasGels, double, hipblasDgels);
+    MAP2CF_D64_V2(hipblasGels, hipblasComplex, hipblasCgels);
+    MAP2CF_D64_V2(hipblasGels, hipblasDoubleComplex, hipblasZgels);
+
+    MAP2CF_D64(hipblasGelsBatched, float, hipblasSgelsBatched);
+    MAP2CF_D64(hipblasGelsBatched, double, hipblasDgelsBatched);
+    MAP2CF_D64_V2(hipblasGelsBatched, hipblasComplex, hipblasCgelsBatched);
+    MAP2CF_D64_V2(hipblasGelsBatched, hipblasDoubleComplex, hipblasZgelsBatched);
+
+    MAP2CF_D64(hipblasGelsStridedBatched, float, hipblasSgelsStridedBatched);
+    MAP2CF_D64(hipblasGelsStridedBatched, double, hipblasDgelsStridedBatched);
+    MAP2CF_D64_V2(hipblasGelsStridedBatched, hipblasComplex, hipblasCgelsStridedBatched);
+    MAP2CF_D64_V2(hipblasGelsStridedBatched, hipblasDoubleComplex, hipblasZgelsStridedBatched);
 
 #endif
 }
@@ -58,7 +58,8 @@ typedef enum hipblas_backend_
 {
     AMD         = 1,
     NVIDIA      = 2,
-    ALL_BACKEND = 3
+    HOST        = 4,
+    ALL_BACKEND = 7
 } hipblas_backend;
 
 typedef enum hipblas_client_api_
@@ -162,12 +163,28 @@ struct Arguments
     char side   = 'L';
     char uplo   = 'L';
     char diag   = 'N';
+    char jobz   = 'V';
+    char jobu   = 'S';
+    char jobv   = 'S';
 
     int     apiCallCount = 1;
     int64_t batch_count  = 10;
 
-    bool inplace    = false; // only for trmm
-    bool with_flags = false;
+    // gemm_grouped_ex: group_count groups of group_size[g] problems of size
+    // group_M[g] x group_N[g] x group_K[g]
+    int group_count = 0;
+    int group_M[16];
+    int group_N[16];
+    int group_K[16];
+    int group_size[16];
+
+    // gemm_epilogue_ex: the hipblasEpilogue_t applied, and whether rows and columns are scaled
+    int  epilogue       = HIPBLAS_EPILOGUE_DEFAULT;
+    bool epilogue_scale = false;
+
+    bool inplace     = false; // trmm and gemm_epilogue_ex
+    bool with_flags  = false;
+    bool c_noalias_d = false; // the gemm_ex_with_d functions write D apart from C
 
     int      norm_check = 0;
     int      unit_check = 1;
@@ -198,6 +215,10 @@ struct Arguments
     // these tests are often not supported with cuBLAS backend
     bool bad_arg_all;
 
+    // if nonzero, size in bytes of a workspace allocated by the client and set with
+    // hipblasSetWorkspace
+    size_t user_allocated_workspace;
+
     // clang-format off
 
 // Generic macro which operates over the list of arguments in order of declaration
@@ -242,10 +263,21 @@ struct Arguments
     OPER(side) SEP                   \
     OPER(uplo) SEP                   \
     OPER(diag) SEP                   \
+    OPER(jobz) SEP                   \
+    OPER(jobu) SEP                   \
+    OPER(jobv) SEP                   \
     OPER(apiCallCount) SEP           \
     OPER(batch_count) SEP            \
+    OPER(group_count) SEP            \
+    OPER(group_M) SEP                \
+    OPER(group_N) SEP                \
+    OPER(group_K) SEP                \
+    OPER(group_size) SEP             \
+    OPER(epilogue) SEP               \
+    OPER(epilogue_scale) SEP         \
     OPER(inplace) SEP                \
     OPER(with_flags) SEP             \
+    OPER(c_noalias_d) SEP            \
     OPER(norm_check) SEP             \
     OPER(unit_check) SEP             \
     OPER(timing) SEP                 \
@@ -263,7 +295,8 @@ struct Arguments
     OPER(backend_flags) SEP          \
     OPER(api) SEP                    \
     OPER(initialization) SEP         \
-    OPER(bad_arg_all)
+    OPER(bad_arg_all) SEP            \
+    OPER(user_allocated_workspace)
 
     // clang-format on
 
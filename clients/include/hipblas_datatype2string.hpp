@@ -91,6 +91,10 @@ hipblasDiagType_t char2hipblas_diagonal(char value);
 
 hipblasSideMode_t char2hipblas_side(char value);
 
+hipblasEigMode_t char2hipblas_eig_mode(char value);
+
+hipblasSvdMode_t char2hipblas_svd_mode(char value);
+
 hipblasDatatype_t string2hipblas_datatype(const std::string& value);
 
 hipblasComputeType_t string2hipblas_computetype(const std::string& value);
@@ -132,6 +136,12 @@ inline constexpr auto hipblas_datatype2string(hipblasDatatype_t type)
         return "bf16_r";
     case HIPBLAS_C_16B:
         return "bf16_c";
+#ifdef HIPBLAS_V2
+    case HIP_R_8F_E4M3_FNUZ:
+        return "f8_r";
+    case HIP_R_8F_E5M2_FNUZ:
+        return "bf8_r";
+#endif
 #ifndef HIPBLAS_V2
     case HIPBLAS_DATATYPE_INVALID:
         return "invalid";
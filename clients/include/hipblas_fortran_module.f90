@@ -29,5 +29,6 @@ contains
     include 'hipblas_fortran_blas.f90'
     include 'hipblas_fortran_blas_64.f90'
     include 'hipblas_fortran_solver.f90'
+    include 'hipblas_fortran_solver_64.f90'
 
 end module hipblas_interface
@@ -608,6 +608,2066 @@ function hipblasZgetriBatchedFortran(handle, n, A, lda, ipiv, C, ldc, info, batc
         hipblasZgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batch_count)
 end function hipblasZgetriBatchedFortran
 
+! potrf
+function hipblasSpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasSpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotrfFortran = &
+        hipblasSpotrf(handle, uplo, n, A, lda, info)
+end function hipblasSpotrfFortran
+
+function hipblasDpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasDpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotrfFortran = &
+        hipblasDpotrf(handle, uplo, n, A, lda, info)
+end function hipblasDpotrfFortran
+
+function hipblasCpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasCpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotrfFortran = &
+        hipblasCpotrf(handle, uplo, n, A, lda, info)
+end function hipblasCpotrfFortran
+
+function hipblasZpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasZpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotrfFortran = &
+        hipblasZpotrf(handle, uplo, n, A, lda, info)
+end function hipblasZpotrfFortran
+
+! potrf_batched
+function hipblasSpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasSpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrfBatchedFortran = &
+        hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasSpotrfBatchedFortran
+
+function hipblasDpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasDpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrfBatchedFortran = &
+        hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasDpotrfBatchedFortran
+
+function hipblasCpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasCpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrfBatchedFortran = &
+        hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasCpotrfBatchedFortran
+
+function hipblasZpotrfBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasZpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrfBatchedFortran = &
+        hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasZpotrfBatchedFortran
+
+! potrf_strided_batched
+function hipblasSpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasSpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrfStridedBatchedFortran = &
+        hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasSpotrfStridedBatchedFortran
+
+function hipblasDpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasDpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrfStridedBatchedFortran = &
+        hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasDpotrfStridedBatchedFortran
+
+function hipblasCpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasCpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrfStridedBatchedFortran = &
+        hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasCpotrfStridedBatchedFortran
+
+function hipblasZpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasZpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrfStridedBatchedFortran = &
+        hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasZpotrfStridedBatchedFortran
+
+! potrs
+function hipblasSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasSpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasSpotrsFortran = &
+        hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasSpotrsFortran
+
+function hipblasDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasDpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasDpotrsFortran = &
+        hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasDpotrsFortran
+
+function hipblasCpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasCpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasCpotrsFortran = &
+        hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasCpotrsFortran
+
+function hipblasZpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+    bind(c, name='hipblasZpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasZpotrsFortran = &
+        hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info)
+end function hipblasZpotrsFortran
+
+! potrs_batched
+function hipblasSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batch_count) &
+    bind(c, name='hipblasSpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrsBatchedFortran = &
+        hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasSpotrsBatchedFortran
+
+function hipblasDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batch_count) &
+    bind(c, name='hipblasDpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrsBatchedFortran = &
+        hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasDpotrsBatchedFortran
+
+function hipblasCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batch_count) &
+    bind(c, name='hipblasCpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrsBatchedFortran = &
+        hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasCpotrsBatchedFortran
+
+function hipblasZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                     batch_count) &
+    bind(c, name='hipblasZpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrsBatchedFortran = &
+        hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count)
+end function hipblasZpotrsBatchedFortran
+
+! potrs_strided_batched
+function hipblasSpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasSpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotrsStridedBatchedFortran = &
+        hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                                    info, batch_count)
+end function hipblasSpotrsStridedBatchedFortran
+
+function hipblasDpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasDpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotrsStridedBatchedFortran = &
+        hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                                    info, batch_count)
+end function hipblasDpotrsStridedBatchedFortran
+
+function hipblasCpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasCpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotrsStridedBatchedFortran = &
+        hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                                    info, batch_count)
+end function hipblasCpotrsStridedBatchedFortran
+
+function hipblasZpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, &
+                                            strideB, info, batch_count) &
+    bind(c, name='hipblasZpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotrsStridedBatchedFortran = &
+        hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                                    info, batch_count)
+end function hipblasZpotrsStridedBatchedFortran
+
+! potri
+function hipblasSpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasSpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotriFortran = &
+        hipblasSpotri(handle, uplo, n, A, lda, info)
+end function hipblasSpotriFortran
+
+function hipblasDpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasDpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotriFortran = &
+        hipblasDpotri(handle, uplo, n, A, lda, info)
+end function hipblasDpotriFortran
+
+function hipblasCpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasCpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotriFortran = &
+        hipblasCpotri(handle, uplo, n, A, lda, info)
+end function hipblasCpotriFortran
+
+function hipblasZpotriFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasZpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotriFortran = &
+        hipblasZpotri(handle, uplo, n, A, lda, info)
+end function hipblasZpotriFortran
+
+! potri_batched
+function hipblasSpotriBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasSpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotriBatchedFortran = &
+        hipblasSpotriBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasSpotriBatchedFortran
+
+function hipblasDpotriBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasDpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotriBatchedFortran = &
+        hipblasDpotriBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasDpotriBatchedFortran
+
+function hipblasCpotriBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasCpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotriBatchedFortran = &
+        hipblasCpotriBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasCpotriBatchedFortran
+
+function hipblasZpotriBatchedFortran(handle, uplo, n, A, lda, info, batch_count) &
+    bind(c, name='hipblasZpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotriBatchedFortran = &
+        hipblasZpotriBatched(handle, uplo, n, A, lda, info, batch_count)
+end function hipblasZpotriBatchedFortran
+
+! potri_strided_batched
+function hipblasSpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasSpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSpotriStridedBatchedFortran = &
+        hipblasSpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasSpotriStridedBatchedFortran
+
+function hipblasDpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasDpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDpotriStridedBatchedFortran = &
+        hipblasDpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasDpotriStridedBatchedFortran
+
+function hipblasCpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasCpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCpotriStridedBatchedFortran = &
+        hipblasCpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasCpotriStridedBatchedFortran
+
+function hipblasZpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, &
+                                            batch_count) &
+    bind(c, name='hipblasZpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZpotriStridedBatchedFortran = &
+        hipblasZpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batch_count)
+end function hipblasZpotriStridedBatchedFortran
+
+! gesv
+function hipblasDSgesvFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, &
+                              deviceInfo) &
+    bind(c, name='hipblasDSgesvFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasDSgesvFortran = &
+        hipblasDSgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo)
+end function hipblasDSgesvFortran
+
+function hipblasZCgesvFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, &
+                              deviceInfo) &
+    bind(c, name='hipblasZCgesvFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasZCgesvFortran = &
+        hipblasZCgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo)
+end function hipblasZCgesvFortran
+
+! gesv_batched
+function hipblasDSgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, &
+                                     info, deviceInfo, batch_count) &
+    bind(c, name='hipblasDSgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasDSgesvBatchedFortran = &
+        hipblasDSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, &
+                             deviceInfo, batch_count)
+end function hipblasDSgesvBatchedFortran
+
+function hipblasZCgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, &
+                                     info, deviceInfo, batch_count) &
+    bind(c, name='hipblasZCgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasZCgesvBatchedFortran = &
+        hipblasZCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, &
+                             deviceInfo, batch_count)
+end function hipblasZCgesvBatchedFortran
+
+! gesv_strided_batched
+function hipblasDSgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                                            B, ldb, strideB, X, ldx, strideX, iter, info, &
+                                            deviceInfo, batch_count) &
+    bind(c, name='hipblasDSgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    integer(c_int64_t), value :: strideX
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasDSgesvStridedBatchedFortran = &
+        hipblasDSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                    strideB, X, ldx, strideX, iter, info, deviceInfo, &
+                                    batch_count)
+end function hipblasDSgesvStridedBatchedFortran
+
+function hipblasZCgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                                            B, ldb, strideB, X, ldx, strideX, iter, info, &
+                                            deviceInfo, batch_count) &
+    bind(c, name='hipblasZCgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    integer(c_int64_t), value :: strideX
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batch_count
+    hipblasZCgesvStridedBatchedFortran = &
+        hipblasZCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                                    strideB, X, ldx, strideX, iter, info, deviceInfo, &
+                                    batch_count)
+end function hipblasZCgesvStridedBatchedFortran
+
+! syevd
+function hipblasSsyevdFortran(handle, jobz, uplo, n, A, lda, W, info) &
+    bind(c, name='hipblasSsyevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasSsyevdFortran = &
+        hipblasSsyevd(handle, jobz, uplo, n, A, lda, W, info)
+end function hipblasSsyevdFortran
+
+function hipblasDsyevdFortran(handle, jobz, uplo, n, A, lda, W, info) &
+    bind(c, name='hipblasDsyevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasDsyevdFortran = &
+        hipblasDsyevd(handle, jobz, uplo, n, A, lda, W, info)
+end function hipblasDsyevdFortran
+
+function hipblasCheevdFortran(handle, jobz, uplo, n, A, lda, W, info) &
+    bind(c, name='hipblasCheevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasCheevdFortran = &
+        hipblasCheevd(handle, jobz, uplo, n, A, lda, W, info)
+end function hipblasCheevdFortran
+
+function hipblasZheevdFortran(handle, jobz, uplo, n, A, lda, W, info) &
+    bind(c, name='hipblasZheevdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    type(c_ptr), value :: info
+    hipblasZheevdFortran = &
+        hipblasZheevd(handle, jobz, uplo, n, A, lda, W, info)
+end function hipblasZheevdFortran
+
+! syevd_workspace_size
+function hipblasSsyevdWorkspaceSizeFortran(handle, jobz, uplo, n, lda, workspaceSizeInBytes) &
+    bind(c, name='hipblasSsyevdWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevdWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasSsyevdWorkspaceSizeFortran = &
+        hipblasSsyevdWorkspaceSize(handle, jobz, uplo, n, lda, workspaceSizeInBytes)
+end function hipblasSsyevdWorkspaceSizeFortran
+
+function hipblasDsyevdWorkspaceSizeFortran(handle, jobz, uplo, n, lda, workspaceSizeInBytes) &
+    bind(c, name='hipblasDsyevdWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevdWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasDsyevdWorkspaceSizeFortran = &
+        hipblasDsyevdWorkspaceSize(handle, jobz, uplo, n, lda, workspaceSizeInBytes)
+end function hipblasDsyevdWorkspaceSizeFortran
+
+function hipblasCheevdWorkspaceSizeFortran(handle, jobz, uplo, n, lda, workspaceSizeInBytes) &
+    bind(c, name='hipblasCheevdWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevdWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasCheevdWorkspaceSizeFortran = &
+        hipblasCheevdWorkspaceSize(handle, jobz, uplo, n, lda, workspaceSizeInBytes)
+end function hipblasCheevdWorkspaceSizeFortran
+
+function hipblasZheevdWorkspaceSizeFortran(handle, jobz, uplo, n, lda, workspaceSizeInBytes) &
+    bind(c, name='hipblasZheevdWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevdWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasZheevdWorkspaceSizeFortran = &
+        hipblasZheevdWorkspaceSize(handle, jobz, uplo, n, lda, workspaceSizeInBytes)
+end function hipblasZheevdWorkspaceSizeFortran
+
+! syevd_batched
+function hipblasSsyevdBatchedFortran(handle, jobz, uplo, n, A, lda, W, strideW, info, &
+                                     batch_count) &
+    bind(c, name='hipblasSsyevdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSsyevdBatchedFortran = &
+        hipblasSsyevdBatched(handle, jobz, uplo, n, A, lda, W, strideW, info, batch_count)
+end function hipblasSsyevdBatchedFortran
+
+function hipblasDsyevdBatchedFortran(handle, jobz, uplo, n, A, lda, W, strideW, info, &
+                                     batch_count) &
+    bind(c, name='hipblasDsyevdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDsyevdBatchedFortran = &
+        hipblasDsyevdBatched(handle, jobz, uplo, n, A, lda, W, strideW, info, batch_count)
+end function hipblasDsyevdBatchedFortran
+
+function hipblasCheevdBatchedFortran(handle, jobz, uplo, n, A, lda, W, strideW, info, &
+                                     batch_count) &
+    bind(c, name='hipblasCheevdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCheevdBatchedFortran = &
+        hipblasCheevdBatched(handle, jobz, uplo, n, A, lda, W, strideW, info, batch_count)
+end function hipblasCheevdBatchedFortran
+
+function hipblasZheevdBatchedFortran(handle, jobz, uplo, n, A, lda, W, strideW, info, &
+                                     batch_count) &
+    bind(c, name='hipblasZheevdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZheevdBatchedFortran = &
+        hipblasZheevdBatched(handle, jobz, uplo, n, A, lda, W, strideW, info, batch_count)
+end function hipblasZheevdBatchedFortran
+
+! syevd_batched_workspace_size
+function hipblasSsyevdBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, batch_count, &
+                                                  workspaceSizeInBytes) &
+    bind(c, name='hipblasSsyevdBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevdBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasSsyevdBatchedWorkspaceSizeFortran = &
+        hipblasSsyevdBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                          workspaceSizeInBytes)
+end function hipblasSsyevdBatchedWorkspaceSizeFortran
+
+function hipblasDsyevdBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, batch_count, &
+                                                  workspaceSizeInBytes) &
+    bind(c, name='hipblasDsyevdBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevdBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasDsyevdBatchedWorkspaceSizeFortran = &
+        hipblasDsyevdBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                          workspaceSizeInBytes)
+end function hipblasDsyevdBatchedWorkspaceSizeFortran
+
+function hipblasCheevdBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, batch_count, &
+                                                  workspaceSizeInBytes) &
+    bind(c, name='hipblasCheevdBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevdBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasCheevdBatchedWorkspaceSizeFortran = &
+        hipblasCheevdBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                          workspaceSizeInBytes)
+end function hipblasCheevdBatchedWorkspaceSizeFortran
+
+function hipblasZheevdBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, batch_count, &
+                                                  workspaceSizeInBytes) &
+    bind(c, name='hipblasZheevdBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevdBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasZheevdBatchedWorkspaceSizeFortran = &
+        hipblasZheevdBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                          workspaceSizeInBytes)
+end function hipblasZheevdBatchedWorkspaceSizeFortran
+
+! syevd_strided_batched
+function hipblasSsyevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, W, &
+                                            strideW, info, batch_count) &
+    bind(c, name='hipblasSsyevdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSsyevdStridedBatchedFortran = &
+        hipblasSsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                                    info, batch_count)
+end function hipblasSsyevdStridedBatchedFortran
+
+function hipblasDsyevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, W, &
+                                            strideW, info, batch_count) &
+    bind(c, name='hipblasDsyevdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDsyevdStridedBatchedFortran = &
+        hipblasDsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                                    info, batch_count)
+end function hipblasDsyevdStridedBatchedFortran
+
+function hipblasCheevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, W, &
+                                            strideW, info, batch_count) &
+    bind(c, name='hipblasCheevdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCheevdStridedBatchedFortran = &
+        hipblasCheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                                    info, batch_count)
+end function hipblasCheevdStridedBatchedFortran
+
+function hipblasZheevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, W, &
+                                            strideW, info, batch_count) &
+    bind(c, name='hipblasZheevdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: W
+    integer(c_int64_t), value :: strideW
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZheevdStridedBatchedFortran = &
+        hipblasZheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, W, strideW, &
+                                    info, batch_count)
+end function hipblasZheevdStridedBatchedFortran
+
+! syevd_strided_batched_workspace_size
+function hipblasSsyevdStridedBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, &
+                                                         batch_count, workspaceSizeInBytes) &
+    bind(c, name='hipblasSsyevdStridedBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyevdStridedBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasSsyevdStridedBatchedWorkspaceSizeFortran = &
+        hipblasSsyevdStridedBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                                 workspaceSizeInBytes)
+end function hipblasSsyevdStridedBatchedWorkspaceSizeFortran
+
+function hipblasDsyevdStridedBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, &
+                                                         batch_count, workspaceSizeInBytes) &
+    bind(c, name='hipblasDsyevdStridedBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyevdStridedBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasDsyevdStridedBatchedWorkspaceSizeFortran = &
+        hipblasDsyevdStridedBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                                 workspaceSizeInBytes)
+end function hipblasDsyevdStridedBatchedWorkspaceSizeFortran
+
+function hipblasCheevdStridedBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, &
+                                                         batch_count, workspaceSizeInBytes) &
+    bind(c, name='hipblasCheevdStridedBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCheevdStridedBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasCheevdStridedBatchedWorkspaceSizeFortran = &
+        hipblasCheevdStridedBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                                 workspaceSizeInBytes)
+end function hipblasCheevdStridedBatchedWorkspaceSizeFortran
+
+function hipblasZheevdStridedBatchedWorkspaceSizeFortran(handle, jobz, uplo, n, lda, &
+                                                         batch_count, workspaceSizeInBytes) &
+    bind(c, name='hipblasZheevdStridedBatchedWorkspaceSizeFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZheevdStridedBatchedWorkspaceSizeFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_EIG_MODE_NOVECTOR)), value :: jobz
+    integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: lda
+    integer(c_int), value :: batch_count
+    type(c_ptr), value :: workspaceSizeInBytes
+    hipblasZheevdStridedBatchedWorkspaceSizeFortran = &
+        hipblasZheevdStridedBatchedWorkspaceSize(handle, jobz, uplo, n, lda, batch_count, &
+                                                 workspaceSizeInBytes)
+end function hipblasZheevdStridedBatchedWorkspaceSizeFortran
+
+! gesvd
+function hipblasSgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasSgesvdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasSgesvdFortran = &
+        hipblasSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info)
+end function hipblasSgesvdFortran
+
+function hipblasDgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasDgesvdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasDgesvdFortran = &
+        hipblasDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info)
+end function hipblasDgesvdFortran
+
+function hipblasCgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasCgesvdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasCgesvdFortran = &
+        hipblasCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info)
+end function hipblasCgesvdFortran
+
+function hipblasZgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasZgesvdFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasZgesvdFortran = &
+        hipblasZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, info)
+end function hipblasZgesvdFortran
+
+! gesvd_batched
+function hipblasSgesvdBatchedFortran(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasSgesvdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgesvdBatchedFortran = &
+        hipblasSgesvdBatched(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, strideU, &
+                             V, ldv, strideV, info, batch_count)
+end function hipblasSgesvdBatchedFortran
+
+function hipblasDgesvdBatchedFortran(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasDgesvdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgesvdBatchedFortran = &
+        hipblasDgesvdBatched(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, strideU, &
+                             V, ldv, strideV, info, batch_count)
+end function hipblasDgesvdBatchedFortran
+
+function hipblasCgesvdBatchedFortran(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasCgesvdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgesvdBatchedFortran = &
+        hipblasCgesvdBatched(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, strideU, &
+                             V, ldv, strideV, info, batch_count)
+end function hipblasCgesvdBatchedFortran
+
+function hipblasZgesvdBatchedFortran(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasZgesvdBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgesvdBatchedFortran = &
+        hipblasZgesvdBatched(handle, jobu, jobv, m, n, A, lda, S, strideS, U, ldu, strideU, &
+                             V, ldv, strideV, info, batch_count)
+end function hipblasZgesvdBatchedFortran
+
+! gesvd_strided_batched
+function hipblasSgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                                            strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                                            batch_count) &
+    bind(c, name='hipblasSgesvdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgesvdStridedBatchedFortran = &
+        hipblasSgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, &
+                                    U, ldu, strideU, V, ldv, strideV, info, batch_count)
+end function hipblasSgesvdStridedBatchedFortran
+
+function hipblasDgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                                            strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                                            batch_count) &
+    bind(c, name='hipblasDgesvdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgesvdStridedBatchedFortran = &
+        hipblasDgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, &
+                                    U, ldu, strideU, V, ldv, strideV, info, batch_count)
+end function hipblasDgesvdStridedBatchedFortran
+
+function hipblasCgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                                            strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                                            batch_count) &
+    bind(c, name='hipblasCgesvdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgesvdStridedBatchedFortran = &
+        hipblasCgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, &
+                                    U, ldu, strideU, V, ldv, strideV, info, batch_count)
+end function hipblasCgesvdStridedBatchedFortran
+
+function hipblasZgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, &
+                                            strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                                            batch_count) &
+    bind(c, name='hipblasZgesvdStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgesvdStridedBatchedFortran = &
+        hipblasZgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, &
+                                    U, ldu, strideU, V, ldv, strideV, info, batch_count)
+end function hipblasZgesvdStridedBatchedFortran
+
+! gesvdj
+function hipblasSgesvdjFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                               maxSweeps, nSweeps, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasSgesvdjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasSgesvdjFortran = &
+        hipblasSgesvdj(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                       nSweeps, S, U, ldu, V, ldv, info)
+end function hipblasSgesvdjFortran
+
+function hipblasDgesvdjFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                               maxSweeps, nSweeps, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasDgesvdjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasDgesvdjFortran = &
+        hipblasDgesvdj(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                       nSweeps, S, U, ldu, V, ldv, info)
+end function hipblasDgesvdjFortran
+
+function hipblasCgesvdjFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                               maxSweeps, nSweeps, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasCgesvdjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasCgesvdjFortran = &
+        hipblasCgesvdj(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                       nSweeps, S, U, ldu, V, ldv, info)
+end function hipblasCgesvdjFortran
+
+function hipblasZgesvdjFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                               maxSweeps, nSweeps, S, U, ldu, V, ldv, info) &
+    bind(c, name='hipblasZgesvdjFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdjFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    type(c_ptr), value :: info
+    hipblasZgesvdjFortran = &
+        hipblasZgesvdj(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                       nSweeps, S, U, ldu, V, ldv, info)
+end function hipblasZgesvdjFortran
+
+! gesvdj_batched
+function hipblasSgesvdjBatchedFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                                      ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasSgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgesvdjBatchedFortran = &
+        hipblasSgesvdjBatched(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                              batch_count)
+end function hipblasSgesvdjBatchedFortran
+
+function hipblasDgesvdjBatchedFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                                      ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasDgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgesvdjBatchedFortran = &
+        hipblasDgesvdjBatched(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                              batch_count)
+end function hipblasDgesvdjBatchedFortran
+
+function hipblasCgesvdjBatchedFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                                      ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasCgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgesvdjBatchedFortran = &
+        hipblasCgesvdjBatched(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                              batch_count)
+end function hipblasCgesvdjBatchedFortran
+
+function hipblasZgesvdjBatchedFortran(handle, jobu, jobv, m, n, A, lda, abstol, residual, &
+                                      maxSweeps, nSweeps, S, strideS, U, ldu, strideU, V, &
+                                      ldv, strideV, info, batch_count) &
+    bind(c, name='hipblasZgesvdjBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdjBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgesvdjBatchedFortran = &
+        hipblasZgesvdjBatched(handle, jobu, jobv, m, n, A, lda, abstol, residual, maxSweeps, &
+                              nSweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, &
+                              batch_count)
+end function hipblasZgesvdjBatchedFortran
+
+! gesvdj_strided_batched
+function hipblasSgesvdjStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, S, &
+                                             strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batch_count) &
+    bind(c, name='hipblasSgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgesvdjStridedBatchedFortran = &
+        hipblasSgesvdjStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, abstol, &
+                                     residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count)
+end function hipblasSgesvdjStridedBatchedFortran
+
+function hipblasDgesvdjStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, S, &
+                                             strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batch_count) &
+    bind(c, name='hipblasDgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgesvdjStridedBatchedFortran = &
+        hipblasDgesvdjStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, abstol, &
+                                     residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count)
+end function hipblasDgesvdjStridedBatchedFortran
+
+function hipblasCgesvdjStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, S, &
+                                             strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batch_count) &
+    bind(c, name='hipblasCgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_float), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgesvdjStridedBatchedFortran = &
+        hipblasCgesvdjStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, abstol, &
+                                     residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count)
+end function hipblasCgesvdjStridedBatchedFortran
+
+function hipblasZgesvdjStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, &
+                                             abstol, residual, maxSweeps, nSweeps, S, &
+                                             strideS, U, ldu, strideU, V, ldv, strideV, &
+                                             info, batch_count) &
+    bind(c, name='hipblasZgesvdjStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvdjStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobu
+    integer(kind(HIPBLAS_SVD_MODE_NOVECTOR)), value :: jobv
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    real(c_double), value :: abstol
+    type(c_ptr), value :: residual
+    integer(c_int), value :: maxSweeps
+    type(c_ptr), value :: nSweeps
+    type(c_ptr), value :: S
+    integer(c_int64_t), value :: strideS
+    type(c_ptr), value :: U
+    integer(c_int), value :: ldu
+    integer(c_int64_t), value :: strideU
+    type(c_ptr), value :: V
+    integer(c_int), value :: ldv
+    integer(c_int64_t), value :: strideV
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgesvdjStridedBatchedFortran = &
+        hipblasZgesvdjStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, abstol, &
+                                     residual, maxSweeps, nSweeps, S, strideS, U, ldu, &
+                                     strideU, V, ldv, strideV, info, batch_count)
+end function hipblasZgesvdjStridedBatchedFortran
+
 ! geqrf
 function hipblasSgeqrfFortran(handle, m, n, A, lda, tau, info) &
     bind(c, name='hipblasSgeqrfFortran')
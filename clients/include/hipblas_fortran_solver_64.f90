@@ -0,0 +1,1046 @@
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+! Copyright (c) 2020-2022 Advanced Micro Devices, Inc. All rights reserved.
+!
+! Permission is hereby granted, free of charge, to any person obtaining a copy
+! of this software and associated documentation files (the "Software"), to deal
+! in the Software without restriction, including without limitation the rights
+! to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+! copies of the Software, and to permit persons to whom the Software is
+! furnished to do so, subject to the following conditions:
+!
+! The above copyright notice and this permission notice shall be included in
+! all copies or substantial portions of the Software.
+!
+! THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+! IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+! FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+! AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+! LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+! OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+! THE SOFTWARE.
+!
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+
+!--------! 
+! Solver !
+!--------!
+
+! getrf
+function hipblasSgetrf_64Fortran(handle, n, A, lda, ipiv, info) &
+    bind(c, name='hipblasSgetrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasSgetrf_64Fortran = &
+        hipblasSgetrf_64(handle, n, A, lda, ipiv, info)
+end function hipblasSgetrf_64Fortran
+
+function hipblasDgetrf_64Fortran(handle, n, A, lda, ipiv, info) &
+    bind(c, name='hipblasDgetrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasDgetrf_64Fortran = &
+        hipblasDgetrf_64(handle, n, A, lda, ipiv, info)
+end function hipblasDgetrf_64Fortran
+
+function hipblasCgetrf_64Fortran(handle, n, A, lda, ipiv, info) &
+    bind(c, name='hipblasCgetrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasCgetrf_64Fortran = &
+        hipblasCgetrf_64(handle, n, A, lda, ipiv, info)
+end function hipblasCgetrf_64Fortran
+
+function hipblasZgetrf_64Fortran(handle, n, A, lda, ipiv, info) &
+    bind(c, name='hipblasZgetrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasZgetrf_64Fortran = &
+        hipblasZgetrf_64(handle, n, A, lda, ipiv, info)
+end function hipblasZgetrf_64Fortran
+
+! getrf_batched
+function hipblasSgetrfBatched_64Fortran(handle, n, A, lda, ipiv, info, batch_count) &
+    bind(c, name='hipblasSgetrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasSgetrfBatched_64Fortran = &
+        hipblasSgetrfBatched_64(handle, n, A, lda, ipiv, info, batch_count)
+end function hipblasSgetrfBatched_64Fortran
+
+function hipblasDgetrfBatched_64Fortran(handle, n, A, lda, ipiv, info, batch_count) &
+    bind(c, name='hipblasDgetrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasDgetrfBatched_64Fortran = &
+        hipblasDgetrfBatched_64(handle, n, A, lda, ipiv, info, batch_count)
+end function hipblasDgetrfBatched_64Fortran
+
+function hipblasCgetrfBatched_64Fortran(handle, n, A, lda, ipiv, info, batch_count) &
+    bind(c, name='hipblasCgetrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasCgetrfBatched_64Fortran = &
+        hipblasCgetrfBatched_64(handle, n, A, lda, ipiv, info, batch_count)
+end function hipblasCgetrfBatched_64Fortran
+
+function hipblasZgetrfBatched_64Fortran(handle, n, A, lda, ipiv, info, batch_count) &
+    bind(c, name='hipblasZgetrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasZgetrfBatched_64Fortran = &
+        hipblasZgetrfBatched_64(handle, n, A, lda, ipiv, info, batch_count)
+end function hipblasZgetrfBatched_64Fortran
+
+! getrf_strided_batched
+function hipblasSgetrfStridedBatched_64Fortran(handle, n, A, lda, stride_A, &
+                                            ipiv, stride_P, info, batch_count) &
+    bind(c, name='hipblasSgetrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasSgetrfStridedBatched_64Fortran = &
+        hipblasSgetrfStridedBatched_64(handle, n, A, lda, stride_A, &
+                                    ipiv, stride_P, info, batch_count)
+end function hipblasSgetrfStridedBatched_64Fortran
+
+function hipblasDgetrfStridedBatched_64Fortran(handle, n, A, lda, stride_A, &
+                                            ipiv, stride_P, info, batch_count) &
+    bind(c, name='hipblasDgetrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasDgetrfStridedBatched_64Fortran = &
+        hipblasDgetrfStridedBatched_64(handle, n, A, lda, stride_A, &
+                                    ipiv, stride_P, info, batch_count)
+end function hipblasDgetrfStridedBatched_64Fortran
+
+function hipblasCgetrfStridedBatched_64Fortran(handle, n, A, lda, stride_A, &
+                                            ipiv, stride_P, info, batch_count) &
+    bind(c, name='hipblasCgetrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasCgetrfStridedBatched_64Fortran = &
+        hipblasCgetrfStridedBatched_64(handle, n, A, lda, stride_A, &
+                                    ipiv, stride_P, info, batch_count)
+end function hipblasCgetrfStridedBatched_64Fortran
+
+function hipblasZgetrfStridedBatched_64Fortran(handle, n, A, lda, stride_A, &
+                                            ipiv, stride_P, info, batch_count) &
+    bind(c, name='hipblasZgetrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasZgetrfStridedBatched_64Fortran = &
+        hipblasZgetrfStridedBatched_64(handle, n, A, lda, stride_A, &
+                                    ipiv, stride_P, info, batch_count)
+end function hipblasZgetrfStridedBatched_64Fortran
+
+! getrs
+function hipblasSgetrs_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                B, ldb, info) &
+    bind(c, name='hipblasSgetrs_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrs_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    hipblasSgetrs_64Fortran = &
+        hipblasSgetrs_64(handle, trans, n, nrhs, A, lda, &
+                        ipiv, B, ldb, info)
+end function hipblasSgetrs_64Fortran
+
+function hipblasDgetrs_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                B, ldb, info) &
+    bind(c, name='hipblasDgetrs_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrs_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    hipblasDgetrs_64Fortran = &
+        hipblasDgetrs_64(handle, trans, n, nrhs, A, lda, &
+                        ipiv, B, ldb, info)
+end function hipblasDgetrs_64Fortran
+
+function hipblasCgetrs_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                B, ldb, info) &
+    bind(c, name='hipblasCgetrs_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrs_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    hipblasCgetrs_64Fortran = &
+        hipblasCgetrs_64(handle, trans, n, nrhs, A, lda, &
+                        ipiv, B, ldb, info)
+end function hipblasCgetrs_64Fortran
+
+function hipblasZgetrs_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                B, ldb, info) &
+    bind(c, name='hipblasZgetrs_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrs_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    hipblasZgetrs_64Fortran = &
+        hipblasZgetrs_64(handle, trans, n, nrhs, A, lda, &
+                        ipiv, B, ldb, info)
+end function hipblasZgetrs_64Fortran
+
+! getrs_batched
+function hipblasSgetrsBatched_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                        B, ldb, info, batch_count) &
+    bind(c, name='hipblasSgetrsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasSgetrsBatched_64Fortran = &
+        hipblasSgetrsBatched_64(handle, trans, n, nrhs, A, lda, &
+                                ipiv, B, ldb, info, batch_count)
+end function hipblasSgetrsBatched_64Fortran
+
+function hipblasDgetrsBatched_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                        B, ldb, info, batch_count) &
+    bind(c, name='hipblasDgetrsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasDgetrsBatched_64Fortran = &
+        hipblasDgetrsBatched_64(handle, trans, n, nrhs, A, lda, &
+                                ipiv, B, ldb, info, batch_count)
+end function hipblasDgetrsBatched_64Fortran
+
+function hipblasCgetrsBatched_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                        B, ldb, info, batch_count) &
+    bind(c, name='hipblasCgetrsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasCgetrsBatched_64Fortran = &
+        hipblasCgetrsBatched_64(handle, trans, n, nrhs, A, lda, &
+                                ipiv, B, ldb, info, batch_count)
+end function hipblasCgetrsBatched_64Fortran
+
+function hipblasZgetrsBatched_64Fortran(handle, trans, n, nrhs, A, lda, ipiv, &
+                                        B, ldb, info, batch_count) &
+    bind(c, name='hipblasZgetrsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasZgetrsBatched_64Fortran = &
+        hipblasZgetrsBatched_64(handle, trans, n, nrhs, A, lda, &
+                                ipiv, B, ldb, info, batch_count)
+end function hipblasZgetrsBatched_64Fortran
+
+! getrs_strided_batched
+function hipblasSgetrsStridedBatched_64Fortran(handle, trans, n, nrhs, A, lda, stride_A, ipiv, &
+                                            stride_P, B, ldb, stride_B, info, batch_count) &
+    bind(c, name='hipblasSgetrsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: stride_B
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasSgetrsStridedBatched_64Fortran = &
+        hipblasSgetrsStridedBatched_64(handle, trans, n, nrhs, A, lda, stride_A, &
+                                    ipiv, stride_P, B, ldb, stride_B, info, batch_count)
+end function hipblasSgetrsStridedBatched_64Fortran
+
+function hipblasDgetrsStridedBatched_64Fortran(handle, trans, n, nrhs, A, lda, stride_A, ipiv, &
+                                            stride_P, B, ldb, stride_B, info, batch_count) &
+    bind(c, name='hipblasDgetrsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: stride_B
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasDgetrsStridedBatched_64Fortran = &
+        hipblasDgetrsStridedBatched_64(handle, trans, n, nrhs, A, lda, stride_A, &
+                                    ipiv, stride_P, B, ldb, stride_B, info, batch_count)
+end function hipblasDgetrsStridedBatched_64Fortran
+
+function hipblasCgetrsStridedBatched_64Fortran(handle, trans, n, nrhs, A, lda, stride_A, ipiv, &
+                                            stride_P, B, ldb, stride_B, info, batch_count) &
+    bind(c, name='hipblasCgetrsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: stride_B
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasCgetrsStridedBatched_64Fortran = &
+        hipblasCgetrsStridedBatched_64(handle, trans, n, nrhs, A, lda, stride_A, &
+                                    ipiv, stride_P, B, ldb, stride_B, info, batch_count)
+end function hipblasCgetrsStridedBatched_64Fortran
+
+function hipblasZgetrsStridedBatched_64Fortran(handle, trans, n, nrhs, A, lda, stride_A, ipiv, &
+                                            stride_P, B, ldb, stride_B, info, batch_count) &
+    bind(c, name='hipblasZgetrsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: stride_P
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: stride_B
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasZgetrsStridedBatched_64Fortran = &
+        hipblasZgetrsStridedBatched_64(handle, trans, n, nrhs, A, lda, stride_A, &
+                                    ipiv, stride_P, B, ldb, stride_B, info, batch_count)
+end function hipblasZgetrsStridedBatched_64Fortran
+
+! geqrf
+function hipblasSgeqrf_64Fortran(handle, m, n, A, lda, tau, info) &
+    bind(c, name='hipblasSgeqrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeqrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    hipblasSgeqrf_64Fortran = &
+        hipblasSgeqrf_64(handle, m, n, A, lda, tau, info)
+end function hipblasSgeqrf_64Fortran
+
+function hipblasDgeqrf_64Fortran(handle, m, n, A, lda, tau, info) &
+    bind(c, name='hipblasDgeqrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeqrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    hipblasDgeqrf_64Fortran = &
+        hipblasDgeqrf_64(handle, m, n, A, lda, tau, info)
+end function hipblasDgeqrf_64Fortran
+
+function hipblasCgeqrf_64Fortran(handle, m, n, A, lda, tau, info) &
+    bind(c, name='hipblasCgeqrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeqrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    hipblasCgeqrf_64Fortran = &
+        hipblasCgeqrf_64(handle, m, n, A, lda, tau, info)
+end function hipblasCgeqrf_64Fortran
+
+function hipblasZgeqrf_64Fortran(handle, m, n, A, lda, tau, info) &
+    bind(c, name='hipblasZgeqrf_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeqrf_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    hipblasZgeqrf_64Fortran = &
+        hipblasZgeqrf_64(handle, m, n, A, lda, tau, info)
+end function hipblasZgeqrf_64Fortran
+
+! geqrf_batched
+function hipblasSgeqrfBatched_64Fortran(handle, m, n, A, lda, tau, info, batch_count) &
+    bind(c, name='hipblasSgeqrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeqrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasSgeqrfBatched_64Fortran = &
+        hipblasSgeqrfBatched_64(handle, m, n, A, lda, tau, info, batch_count)
+end function hipblasSgeqrfBatched_64Fortran
+
+function hipblasDgeqrfBatched_64Fortran(handle, m, n, A, lda, tau, info, batch_count) &
+    bind(c, name='hipblasDgeqrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeqrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasDgeqrfBatched_64Fortran = &
+        hipblasDgeqrfBatched_64(handle, m, n, A, lda, tau, info, batch_count)
+end function hipblasDgeqrfBatched_64Fortran
+
+function hipblasCgeqrfBatched_64Fortran(handle, m, n, A, lda, tau, info, batch_count) &
+    bind(c, name='hipblasCgeqrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeqrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasCgeqrfBatched_64Fortran = &
+        hipblasCgeqrfBatched_64(handle, m, n, A, lda, tau, info, batch_count)
+end function hipblasCgeqrfBatched_64Fortran
+
+function hipblasZgeqrfBatched_64Fortran(handle, m, n, A, lda, tau, info, batch_count) &
+    bind(c, name='hipblasZgeqrfBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeqrfBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: tau
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasZgeqrfBatched_64Fortran = &
+        hipblasZgeqrfBatched_64(handle, m, n, A, lda, tau, info, batch_count)
+end function hipblasZgeqrfBatched_64Fortran
+
+! geqrf_strided_batched
+function hipblasSgeqrfStridedBatched_64Fortran(handle, m, n, A, lda, stride_A, &
+                                            tau, stride_T, info, batch_count) &
+    bind(c, name='hipblasSgeqrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeqrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: stride_T
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasSgeqrfStridedBatched_64Fortran = &
+        hipblasSgeqrfStridedBatched_64(handle, m, n, A, lda, stride_A, &
+                                    tau, stride_T, info, batch_count)
+end function hipblasSgeqrfStridedBatched_64Fortran
+
+function hipblasDgeqrfStridedBatched_64Fortran(handle, m, n, A, lda, stride_A, &
+                                            tau, stride_T, info, batch_count) &
+    bind(c, name='hipblasDgeqrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeqrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: stride_T
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasDgeqrfStridedBatched_64Fortran = &
+        hipblasDgeqrfStridedBatched_64(handle, m, n, A, lda, stride_A, &
+                                    tau, stride_T, info, batch_count)
+end function hipblasDgeqrfStridedBatched_64Fortran
+
+function hipblasCgeqrfStridedBatched_64Fortran(handle, m, n, A, lda, stride_A, &
+                                            tau, stride_T, info, batch_count) &
+    bind(c, name='hipblasCgeqrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeqrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: stride_T
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasCgeqrfStridedBatched_64Fortran = &
+        hipblasCgeqrfStridedBatched_64(handle, m, n, A, lda, stride_A, &
+                                    tau, stride_T, info, batch_count)
+end function hipblasCgeqrfStridedBatched_64Fortran
+
+function hipblasZgeqrfStridedBatched_64Fortran(handle, m, n, A, lda, stride_A, &
+                                            tau, stride_T, info, batch_count) &
+    bind(c, name='hipblasZgeqrfStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeqrfStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: stride_A
+    type(c_ptr), value :: tau
+    integer(c_int64_t), value :: stride_T
+    type(c_ptr), value :: info
+    integer(c_int64_t), value :: batch_count
+    hipblasZgeqrfStridedBatched_64Fortran = &
+        hipblasZgeqrfStridedBatched_64(handle, m, n, A, lda, stride_A, &
+                                    tau, stride_T, info, batch_count)
+end function hipblasZgeqrfStridedBatched_64Fortran
+
+! gels
+function hipblasSgels_64Fortran(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
+    bind(c, name='hipblasSgels_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgels_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasSgels_64Fortran = &
+        hipblasSgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo)
+end function hipblasSgels_64Fortran
+
+function hipblasDgels_64Fortran(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
+    bind(c, name='hipblasDgels_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgels_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasDgels_64Fortran = &
+        hipblasDgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo)
+end function hipblasDgels_64Fortran
+
+function hipblasCgels_64Fortran(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
+    bind(c, name='hipblasCgels_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgels_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasCgels_64Fortran = &
+        hipblasCgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo)
+end function hipblasCgels_64Fortran
+
+function hipblasZgels_64Fortran(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo) &
+    bind(c, name='hipblasZgels_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgels_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasZgels_64Fortran = &
+        hipblasZgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo)
+end function hipblasZgels_64Fortran
+
+! gelsBatched
+function hipblasSgelsBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, B, ldb, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasSgelsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgelsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasSgelsBatched_64Fortran = &
+        hipblasSgelsBatched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount)
+end function hipblasSgelsBatched_64Fortran
+
+function hipblasDgelsBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, B, ldb, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasDgelsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgelsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasDgelsBatched_64Fortran = &
+        hipblasDgelsBatched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount)
+end function hipblasDgelsBatched_64Fortran
+
+function hipblasCgelsBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, B, ldb, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasCgelsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgelsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasCgelsBatched_64Fortran = &
+        hipblasCgelsBatched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount)
+end function hipblasCgelsBatched_64Fortran
+
+function hipblasZgelsBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, B, ldb, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasZgelsBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgelsBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasZgelsBatched_64Fortran = &
+        hipblasZgelsBatched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount)
+end function hipblasZgelsBatched_64Fortran
+
+! gelsStridedBatched
+function hipblasSgelsStridedBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasSgelsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgelsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasSgelsStridedBatched_64Fortran = &
+        hipblasSgelsStridedBatched_64(handle, trans, m, n, nrhs, A, lda, strideA, &
+    B, ldb, strideB, info, deviceInfo, batchCount)
+end function hipblasSgelsStridedBatched_64Fortran
+
+function hipblasDgelsStridedBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasDgelsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgelsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasDgelsStridedBatched_64Fortran = &
+        hipblasDgelsStridedBatched_64(handle, trans, m, n, nrhs, A, lda, strideA, &
+    B, ldb, strideB, info, deviceInfo, batchCount)
+end function hipblasDgelsStridedBatched_64Fortran
+
+function hipblasCgelsStridedBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasCgelsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgelsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasCgelsStridedBatched_64Fortran = &
+        hipblasCgelsStridedBatched_64(handle, trans, m, n, nrhs, A, lda, strideA, &
+    B, ldb, strideB, info, deviceInfo, batchCount)
+end function hipblasCgelsStridedBatched_64Fortran
+
+function hipblasZgelsStridedBatched_64Fortran(handle, trans, m, n, nrhs, A, &
+    lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount) &
+        bind(c, name = 'hipblasZgelsStridedBatched_64Fortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgelsStridedBatched_64Fortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_OP_N)), value :: trans
+    integer(c_int64_t), value :: m
+    integer(c_int64_t), value :: n
+    integer(c_int64_t), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int64_t), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int64_t), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int64_t), value :: batchCount
+    hipblasZgelsStridedBatched_64Fortran = &
+        hipblasZgelsStridedBatched_64(handle, trans, m, n, nrhs, A, lda, strideA, &
+    B, ldb, strideB, info, deviceInfo, batchCount)
+end function hipblasZgelsStridedBatched_64Fortran
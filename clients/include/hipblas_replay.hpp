@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef _HIPBLAS_REPLAY_H
+#define _HIPBLAS_REPLAY_H
+
+#include "hipblas_arguments.hpp"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// One call of a trace written with HIPBLAS_LAYER=1
+struct hipblas_replay_record
+{
+    uint64_t             call = 0;
+    std::string          function;
+    std::string          handle;
+    int                  device = 0;
+    std::string          stream;
+    hipblasPointerMode_t pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+    hipblasAtomicsMode_t atomics_mode = HIPBLAS_ATOMICS_ALLOWED;
+    hipblasMath_t        math_mode    = HIPBLAS_DEFAULT_MATH;
+
+    // Arguments after the handle, named as in hipblas.h
+    std::vector<std::pair<std::string, std::string>> args;
+
+    const std::string* find(const std::string& name) const
+    {
+        for(auto& arg : args)
+            if(arg.first == name)
+                return &arg.second;
+        return nullptr;
+    }
+
+    int64_t integer(const std::string& name, int64_t missing) const
+    {
+        const std::string* value = find(name);
+        return value ? std::stoll(*value) : missing;
+    }
+};
+
+// Parses "- { call: 0, thread: 1, function: hipblasSgemm, ... }" into record, false for other
+// lines. Throws std::invalid_argument for a malformed record.
+bool hipblas_replay_parse(const std::string& line, hipblas_replay_record& record);
+
+// Replays the calls of a trace written with HIPBLAS_LAYER=1 in the order they were made, on
+// the handles and streams they were made on. Device buffers are allocated so that arguments
+// which overlapped in the traced application overlap in the replay. arg.cold_iters passes
+// warm up, arg.iters passes are timed per call and end to end.
+int hipblas_bench_replay(const std::string& path, const Arguments& arg);
+
+#endif
@@ -69,6 +69,18 @@ public:
         return data != nullptr;
     }
 
+    //!
+    //! @brief Check if memory exists.
+    //! @return hipSuccess if memory exists, hipErrorOutOfMemory otherwise.
+    //!
+    hipError_t memcheck() const
+    {
+        if(*this)
+            return hipSuccess;
+        else
+            return hipErrorOutOfMemory;
+    }
+
     // Disallow copying or assigning
     device_vector(const device_vector&) = delete;
     device_vector& operator=(const device_vector&) = delete;
@@ -186,4 +186,59 @@ double vector_norm_1(int64_t M, int64_t incx, T* hx_gold, T* hx)
     return max_err / max_err_scal;
 }
 
+/*! \brief  Residual ||A V - V diag(W)||_F / (N ||A||_F) of the eigenvalues W and eigenvectors V
+    of the N x N Hermitian matrix A. Eigenvectors are only unique up to a factor of modulus one,
+    so they are checked through the residual rather than against a reference. */
+template <typename T>
+double norm_check_eigen(
+    int64_t N, const T* A, int64_t lda, const T* V, int64_t ldv, const real_t<T>* W)
+{
+    double residual = 0.0, norm_A = 0.0;
+    for(int64_t j = 0; j < N; j++)
+        for(int64_t i = 0; i < N; i++)
+        {
+            T r = V[i + j * ldv] * T(-W[j]);
+            for(int64_t k = 0; k < N; k++)
+                r += A[i + k * lda] * V[k + j * ldv];
+
+            double abs_r = hipblas_abs(r), abs_a = hipblas_abs(A[i + j * lda]);
+            residual += abs_r * abs_r;
+            norm_A += abs_a * abs_a;
+        }
+
+    return norm_A ? std::sqrt(residual / norm_A) / N : 0.0;
+}
+
+/*! \brief  Residual ||A - U diag(S) V^H||_F / (max(M, N) ||A||_F) of the first min(M, N) singular
+    values S and vectors U and V of the M x N matrix A, where V holds the rows of V^H. Singular
+    vectors are only unique up to a factor of modulus one, so they are checked through the
+    residual rather than against a reference. */
+template <typename T>
+double norm_check_svd(int64_t          M,
+                      int64_t          N,
+                      const T*         A,
+                      int64_t          lda,
+                      const real_t<T>* S,
+                      const T*         U,
+                      int64_t          ldu,
+                      const T*         V,
+                      int64_t          ldv)
+{
+    int64_t K        = std::min(M, N);
+    double  residual = 0.0, norm_A = 0.0;
+    for(int64_t j = 0; j < N; j++)
+        for(int64_t i = 0; i < M; i++)
+        {
+            T r = A[i + j * lda];
+            for(int64_t k = 0; k < K; k++)
+                r -= U[i + k * ldu] * T(S[k]) * V[k + j * ldv];
+
+            double abs_r = hipblas_abs(r), abs_a = hipblas_abs(A[i + j * lda]);
+            residual += abs_r * abs_r;
+            norm_A += abs_a * abs_a;
+        }
+
+    return norm_A ? std::sqrt(residual / norm_A) / std::max(M, N) : 0.0;
+}
+
 #endif
@@ -36,12 +36,9 @@ inline void testname_gels(const Arguments& arg, std::string& name)
     hipblasGelsModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void testing_gels_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_gels_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGelsFn
-        = arg.api == hipblas_client_api::FORTRAN ? hipblasGels<T, true> : hipblasGels<T, false>;
-
     hipblasLocalHandle       handle(arg);
     const int                M     = 100;
     const int                N     = 101;
@@ -54,103 +51,107 @@ void testing_gels_bad_arg(const Arguments& arg)
     const size_t A_size = size_t(lda) * N;
     const size_t B_size = size_t(ldb) * nrhs;
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dInfo(1);
-    int                info = 0;
-    int                expectedInfo;
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dInfo(1);
+    I                info = 0;
+    I                expectedInfo;
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opN, M, N, nrhs, dA, lda, dB, ldb, nullptr, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, nrhs, dA, lda, dB, ldb, nullptr, dInfo),
                           HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opBad, M, N, nrhs, dA, lda, dB, ldb, &info, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(handle, opBad, M, N, nrhs, dA, lda, dB, ldb, &info, dInfo),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -1;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opN, -1, N, nrhs, dA, lda, dB, ldb, &info, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, -1, N, nrhs, dA, lda, dB, ldb, &info, dInfo),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opN, M, -1, nrhs, dA, lda, dB, ldb, &info, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, -1, nrhs, dA, lda, dB, ldb, &info, dInfo),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opN, M, N, -1, dA, lda, dB, ldb, &info, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, -1, dA, lda, dB, ldb, &info, dInfo),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsFn(handle, opN, M, N, nrhs, nullptr, lda, dB, ldb, &info, dInfo),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, nrhs, nullptr, lda, dB, ldb, &info, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -5;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opN, M, N, nrhs, dA, M - 1, dB, ldb, &info, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, nrhs, dA, M - 1, dB, ldb, &info, dInfo),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -6;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsFn(handle, opN, M, N, nrhs, dA, lda, nullptr, ldb, &info, dInfo),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, nrhs, dA, lda, nullptr, ldb, &info, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -7;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // Explicit values to check for ldb < M and ldb < N
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsFn(handle, opN, 100, 200, nrhs, dA, lda, dB, 199, &info, dInfo),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, 100, 200, nrhs, dA, lda, dB, 199, &info, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -8;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsFn(handle, opN, 200, 100, nrhs, dA, 201, dB, 199, &info, dInfo),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, 200, 100, nrhs, dA, 201, dB, 199, &info, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -8;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opN, M, N, nrhs, dA, lda, dB, ldb, &info, nullptr),
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, nrhs, dA, lda, dB, ldb, &info, nullptr),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -10;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If M == 0 || N == 0, A can be nullptr
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsFn(handle, opN, 0, N, nrhs, nullptr, lda, dB, ldb, &info, dInfo),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, 0, N, nrhs, nullptr, lda, dB, ldb, &info, dInfo),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsFn(handle, opN, M, 0, nrhs, nullptr, lda, dB, ldb, &info, dInfo),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, 0, nrhs, nullptr, lda, dB, ldb, &info, dInfo),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If nrhs == 0, B can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGelsFn(handle, opN, M, N, 0, dA, lda, nullptr, ldb, &info, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, 0, dA, lda, nullptr, ldb, &info, dInfo),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If M == 0 && N == 0, B can be nullptr
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsFn(handle, opN, 0, 0, nrhs, nullptr, lda, nullptr, ldb, &info, dInfo),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, 0, 0, nrhs, nullptr, lda, nullptr, ldb, &info, dInfo),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 }
 
 template <typename T>
-void testing_gels(const Arguments& arg)
+void testing_gels_bad_arg(const Arguments& arg)
+{
+    auto hipblasGelsFn = arg.api == FORTRAN ? hipblasGels<T, true> : hipblasGels<T, false>;
+    auto hipblasGelsFn_64
+        = arg.api == FORTRAN_64 ? hipblasGels_64<T, true> : hipblasGels_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_gels_bad_arg_template<T, int64_t>(arg, hipblasGelsFn_64);
+    else
+        testing_gels_bad_arg_template<T, int>(arg, hipblasGelsFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_gels_template(const Arguments& arg, FUNC func)
 {
-    using U            = real_t<T>;
-    bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGelsFn = FORTRAN ? hipblasGels<T, true> : hipblasGels<T, false>;
+    using U = real_t<T>;
 
     char transc = arg.transA;
     int  N      = arg.N;
@@ -179,12 +180,13 @@ void testing_gels(const Arguments& arg)
     host_vector<T> hA(A_size);
     host_vector<T> hB(B_size);
     host_vector<T> hB_res(B_size);
-    int            info, info_res;
-    int            info_input(-1);
+    int            info;
+    I              info_res;
+    I              info_input(-1);
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dInfo(1);
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dInfo(1);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -216,12 +218,11 @@ void testing_gels(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(
-            hipblasGelsFn(handle, trans, M, N, nrhs, dA, lda, dB, ldb, &info_input, dInfo));
+        CHECK_HIPBLAS_ERROR(func(handle, trans, M, N, nrhs, dA, lda, dB, ldb, &info_input, dInfo));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hB_res, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(&info_res, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&info_res, dInfo, sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -243,7 +244,7 @@ void testing_gels(const Arguments& arg)
         {
             double eps       = std::numeric_limits<U>::epsilon();
             double tolerance = N * eps * 100;
-            int    zero      = 0;
+            I      zero      = 0;
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info_input);
@@ -262,7 +263,7 @@ void testing_gels(const Arguments& arg)
                 gpu_time_used = get_time_us_sync(stream);
 
             CHECK_HIPBLAS_ERROR(
-                hipblasGelsFn(handle, trans, M, N, nrhs, dA, lda, dB, ldb, &info_input, dInfo));
+                func(handle, trans, M, N, nrhs, dA, lda, dB, ldb, &info_input, dInfo));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -274,3 +275,16 @@ void testing_gels(const Arguments& arg)
                                        hipblas_error);
     }
 }
+
+template <typename T>
+void testing_gels(const Arguments& arg)
+{
+    auto hipblasGelsFn = arg.api == FORTRAN ? hipblasGels<T, true> : hipblasGels<T, false>;
+    auto hipblasGelsFn_64
+        = arg.api == FORTRAN_64 ? hipblasGels_64<T, true> : hipblasGels_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_gels_template<T, int64_t>(arg, hipblasGelsFn_64);
+    else
+        testing_gels_template<T, int>(arg, hipblasGelsFn);
+}
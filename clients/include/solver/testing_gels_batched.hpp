@@ -37,13 +37,9 @@ inline void testname_gels_batched(const Arguments& arg, std::string& name)
     hipblasGelsBatchedModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void testing_gels_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_gels_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGelsBatchedFn = arg.api == hipblas_client_api::FORTRAN
-                                    ? hipblasGelsBatched<T, true>
-                                    : hipblasGelsBatched<T, false>;
-
     hipblasLocalHandle       handle(arg);
     const int                M          = 100;
     const int                N          = 101;
@@ -59,21 +55,19 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
 
     device_batch_vector<T> dA(A_size, 1, batchCount);
     device_batch_vector<T> dB(B_size, 1, batchCount);
-    device_vector<int>     dInfo(batchCount);
-    int                    info = 0;
-    int                    expectedInfo;
+    device_vector<I>       dInfo(batchCount);
+    I                      info = 0;
+    I                      expectedInfo;
 
     T* const* dAp = dA.ptr_on_device();
     T* const* dBp = dB.ptr_on_device();
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, nullptr, dInfo, batchCount),
+        func(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, nullptr, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, -1, N, nrhs, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
+        func(handle, opN, -1, N, nrhs, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
 
     if(arg.bad_arg_all)
@@ -83,15 +77,13 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
     }
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, M, -1, nrhs, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
+        func(handle, opN, M, -1, nrhs, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(handle, opN, M, N, -1, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, -1, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
+                          HIPBLAS_STATUS_INVALID_VALUE);
 
     if(arg.bad_arg_all)
     {
@@ -100,8 +92,7 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
     }
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, M, N, nrhs, dAp, M - 1, dBp, ldb, &info, dInfo, batchCount),
+        func(handle, opN, M, N, nrhs, dAp, M - 1, dBp, ldb, &info, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
 
     if(arg.bad_arg_all)
@@ -112,8 +103,7 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
 
     // Explicit values to check for ldb < M and ldb < N
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, 200, 100, nrhs, dAp, 201, dBp, 199, &info, dInfo, batchCount),
+        func(handle, opN, 200, 100, nrhs, dAp, 201, dBp, 199, &info, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
 
     if(arg.bad_arg_all)
@@ -122,9 +112,8 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
         unit_check_general(1, 1, 1, &expectedInfo, &info);
     }
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, &info, dInfo, -1),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, &info, dInfo, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
 
     if(arg.bad_arg_all)
     {
@@ -134,31 +123,27 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
 
     // If M == 0 || N == 0, A can be nullptr
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, 0, N, nrhs, nullptr, lda, dBp, ldb, &info, dInfo, batchCount),
+        func(handle, opN, 0, N, nrhs, nullptr, lda, dBp, ldb, &info, dInfo, batchCount),
         HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, M, 0, nrhs, nullptr, lda, dBp, ldb, &info, dInfo, batchCount),
+        func(handle, opN, M, 0, nrhs, nullptr, lda, dBp, ldb, &info, dInfo, batchCount),
         HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If M == 0 && N == 0, B can be nullptr
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(
-            handle, opN, 0, 0, nrhs, nullptr, lda, nullptr, ldb, &info, dInfo, batchCount),
+        func(handle, opN, 0, 0, nrhs, nullptr, lda, nullptr, ldb, &info, dInfo, batchCount),
         HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If batchCount == 0, dInfo can be nullptr
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGelsBatchedFn(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, &info, nullptr, 0),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, &info, nullptr, 0),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
@@ -166,44 +151,38 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
     {
         // cuBLAS returns HIPBLAS_STATUS_NOT_SUPPORTED for these cases, not checking  for now.
         EXPECT_HIPBLAS_STATUS(
-            hipblasGelsBatchedFn(
-                handle, opBad, M, N, nrhs, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
+            func(handle, opBad, M, N, nrhs, dAp, lda, dBp, ldb, &info, dInfo, batchCount),
             HIPBLAS_STATUS_INVALID_VALUE);
         expectedInfo = -1;
         unit_check_general(1, 1, 1, &expectedInfo, &info);
 
         EXPECT_HIPBLAS_STATUS(
-            hipblasGelsBatchedFn(
-                handle, opN, M, N, nrhs, nullptr, lda, dBp, ldb, &info, dInfo, batchCount),
+            func(handle, opN, M, N, nrhs, nullptr, lda, dBp, ldb, &info, dInfo, batchCount),
             HIPBLAS_STATUS_INVALID_VALUE);
         expectedInfo = -5;
         unit_check_general(1, 1, 1, &expectedInfo, &info);
 
         EXPECT_HIPBLAS_STATUS(
-            hipblasGelsBatchedFn(
-                handle, opN, M, N, nrhs, dAp, lda, nullptr, ldb, &info, dInfo, batchCount),
+            func(handle, opN, M, N, nrhs, dAp, lda, nullptr, ldb, &info, dInfo, batchCount),
             HIPBLAS_STATUS_INVALID_VALUE);
         expectedInfo = -7;
         unit_check_general(1, 1, 1, &expectedInfo, &info);
 
         EXPECT_HIPBLAS_STATUS(
-            hipblasGelsBatchedFn(
-                handle, opN, 100, 200, nrhs, dAp, lda, dBp, 199, &info, dInfo, batchCount),
+            func(handle, opN, 100, 200, nrhs, dAp, lda, dBp, 199, &info, dInfo, batchCount),
             HIPBLAS_STATUS_INVALID_VALUE);
         expectedInfo = -8;
         unit_check_general(1, 1, 1, &expectedInfo, &info);
 
         EXPECT_HIPBLAS_STATUS(
-            hipblasGelsBatchedFn(
-                handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, &info, nullptr, batchCount),
+            func(handle, opN, M, N, nrhs, dAp, lda, dBp, ldb, &info, nullptr, batchCount),
             HIPBLAS_STATUS_INVALID_VALUE);
         expectedInfo = -10;
         unit_check_general(1, 1, 1, &expectedInfo, &info);
 
         // If nrhs == 0, B can be nullptr
         EXPECT_HIPBLAS_STATUS(
-            hipblasGelsBatchedFn(
-                handle, opN, M, N, 0, dAp, lda, nullptr, ldb, &info, dInfo, batchCount),
+            func(handle, opN, M, N, 0, dAp, lda, nullptr, ldb, &info, dInfo, batchCount),
             HIPBLAS_STATUS_SUCCESS);
         expectedInfo = 0;
         unit_check_general(1, 1, 1, &expectedInfo, &info);
@@ -211,12 +190,23 @@ void testing_gels_batched_bad_arg(const Arguments& arg)
 }
 
 template <typename T>
-void testing_gels_batched(const Arguments& arg)
+void testing_gels_batched_bad_arg(const Arguments& arg)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGelsBatchedFn
-        = FORTRAN ? hipblasGelsBatched<T, true> : hipblasGelsBatched<T, false>;
+        = arg.api == FORTRAN ? hipblasGelsBatched<T, true> : hipblasGelsBatched<T, false>;
+    auto hipblasGelsBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGelsBatched_64<T, true> : hipblasGelsBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_gels_batched_bad_arg_template<T, int64_t>(arg, hipblasGelsBatchedFn_64);
+    else
+        testing_gels_batched_bad_arg_template<T, int>(arg, hipblasGelsBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_gels_batched_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     char transc     = arg.transA;
     int  N          = arg.N;
@@ -250,13 +240,13 @@ void testing_gels_batched(const Arguments& arg)
     host_batch_vector<T> hA(A_size, 1, batchCount);
     host_batch_vector<T> hB(B_size, 1, batchCount);
     host_batch_vector<T> hB_res(B_size, 1, batchCount);
-    host_vector<T>       info_res(batchCount);
-    host_vector<T>       info(batchCount);
-    int                  info_input(-1);
+    host_vector<I>       info_res(batchCount);
+    host_vector<int>     info(batchCount);
+    I                    info_input(-1);
 
     device_batch_vector<T> dA(A_size, 1, batchCount);
     device_batch_vector<T> dB(B_size, 1, batchCount);
-    device_vector<int>     dInfo(batchCount);
+    device_vector<I>       dInfo(batchCount);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -290,23 +280,23 @@ void testing_gels_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGelsBatchedFn(handle,
-                                                 trans,
-                                                 M,
-                                                 N,
-                                                 nrhs,
-                                                 dA.ptr_on_device(),
-                                                 lda,
-                                                 dB.ptr_on_device(),
-                                                 ldb,
-                                                 &info_input,
-                                                 dInfo,
-                                                 batchCount));
+        CHECK_HIPBLAS_ERROR(func(handle,
+                                 trans,
+                                 M,
+                                 N,
+                                 nrhs,
+                                 dA.ptr_on_device(),
+                                 lda,
+                                 dB.ptr_on_device(),
+                                 ldb,
+                                 &info_input,
+                                 dInfo,
+                                 batchCount));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hB_res.transfer_from(dB));
         CHECK_HIP_ERROR(
-            hipMemcpy(info_res.data(), dInfo, sizeof(int) * batchCount, hipMemcpyDeviceToHost));
+            hipMemcpy(info_res.data(), dInfo, sizeof(I) * batchCount, hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -334,7 +324,7 @@ void testing_gels_batched(const Arguments& arg)
         {
             double eps       = std::numeric_limits<U>::epsilon();
             double tolerance = N * eps * 100;
-            int    zero      = 0;
+            I      zero      = 0;
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info_input);
@@ -352,18 +342,18 @@ void testing_gels_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGelsBatchedFn(handle,
-                                                     trans,
-                                                     M,
-                                                     N,
-                                                     nrhs,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dB.ptr_on_device(),
-                                                     ldb,
-                                                     &info_input,
-                                                     dInfo,
-                                                     batchCount));
+            CHECK_HIPBLAS_ERROR(func(handle,
+                                     trans,
+                                     M,
+                                     N,
+                                     nrhs,
+                                     dA.ptr_on_device(),
+                                     lda,
+                                     dB.ptr_on_device(),
+                                     ldb,
+                                     &info_input,
+                                     dInfo,
+                                     batchCount));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -375,3 +365,17 @@ void testing_gels_batched(const Arguments& arg)
                                               hipblas_error);
     }
 }
+
+template <typename T>
+void testing_gels_batched(const Arguments& arg)
+{
+    auto hipblasGelsBatchedFn
+        = arg.api == FORTRAN ? hipblasGelsBatched<T, true> : hipblasGelsBatched<T, false>;
+    auto hipblasGelsBatchedFn_64
+        = arg.api == FORTRAN_64 ? hipblasGelsBatched_64<T, true> : hipblasGelsBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_gels_batched_template<T, int64_t>(arg, hipblasGelsBatchedFn_64);
+    else
+        testing_gels_batched_template<T, int>(arg, hipblasGelsBatchedFn);
+}
@@ -37,13 +37,9 @@ inline void testname_gels_strided_batched(const Arguments& arg, std::string& nam
     hipblasGelsStridedBatchedModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void testing_gels_strided_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_gels_strided_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGelsStridedBatchedFn = arg.api == hipblas_client_api::FORTRAN
-                                           ? hipblasGelsStridedBatched<T, true>
-                                           : hipblasGelsStridedBatched<T, false>;
-
     hipblasLocalHandle       handle(arg);
     const int                M          = 100;
     const int                N          = 101;
@@ -59,273 +55,284 @@ void testing_gels_strided_batched_bad_arg(const Arguments& arg)
     const size_t        A_size  = strideA * batchCount;
     const size_t        B_size  = strideB * batchCount;
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dInfo(batchCount);
-    int                info = 0;
-    int                expectedInfo;
-
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      M,
-                                                      N,
-                                                      nrhs,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      dB,
-                                                      ldb,
-                                                      strideB,
-                                                      nullptr,
-                                                      dInfo,
-                                                      batchCount),
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dInfo(batchCount);
+    I                info = 0;
+    I                expectedInfo;
+
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               M,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dB,
+                               ldb,
+                               strideB,
+                               nullptr,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opBad,
-                                                      M,
-                                                      N,
-                                                      nrhs,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      dB,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opBad,
+                               M,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -1;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsStridedBatchedFn(
+        func(
             handle, opN, -1, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsStridedBatchedFn(
+        func(
             handle, opN, M, -1, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsStridedBatchedFn(
-            handle, opN, M, N, -1, dA, lda, strideA, dB, ldb, strideB, &info, dInfo, batchCount),
+        func(handle, opN, M, N, -1, dA, lda, strideA, dB, ldb, strideB, &info, dInfo, batchCount),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      M,
-                                                      N,
-                                                      nrhs,
-                                                      nullptr,
-                                                      lda,
-                                                      strideA,
-                                                      dB,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               M,
+                               N,
+                               nrhs,
+                               nullptr,
+                               lda,
+                               strideA,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -5;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      M,
-                                                      N,
-                                                      nrhs,
-                                                      dA,
-                                                      M - 1,
-                                                      strideA,
-                                                      dB,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               M,
+                               N,
+                               nrhs,
+                               dA,
+                               M - 1,
+                               strideA,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -6;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      M,
-                                                      N,
-                                                      nrhs,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      nullptr,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               M,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -8;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // Explicit values to check for ldb < M and ldb < N
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      100,
-                                                      200,
-                                                      nrhs,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      dB,
-                                                      199,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               100,
+                               200,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dB,
+                               199,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -9;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      200,
-                                                      100,
-                                                      nrhs,
-                                                      dA,
-                                                      201,
-                                                      strideA,
-                                                      dB,
-                                                      199,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               200,
+                               100,
+                               nrhs,
+                               dA,
+                               201,
+                               strideA,
+                               dB,
+                               199,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -9;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      M,
-                                                      N,
-                                                      nrhs,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      dB,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      nullptr,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               M,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               nullptr,
+                               batchCount),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -12;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsStridedBatchedFn(
-            handle, opN, M, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, dInfo, -1),
+        func(handle, opN, M, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, dInfo, -1),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -13;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If M == 0 || N == 0, A can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      0,
-                                                      N,
-                                                      nrhs,
-                                                      nullptr,
-                                                      lda,
-                                                      strideA,
-                                                      dB,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               0,
+                               N,
+                               nrhs,
+                               nullptr,
+                               lda,
+                               strideA,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      M,
-                                                      0,
-                                                      nrhs,
-                                                      nullptr,
-                                                      lda,
-                                                      strideA,
-                                                      dB,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               M,
+                               0,
+                               nrhs,
+                               nullptr,
+                               lda,
+                               strideA,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // if nrhs == 0, B can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      M,
-                                                      N,
-                                                      0,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      nullptr,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               M,
+                               N,
+                               0,
+                               dA,
+                               lda,
+                               strideA,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // if M == 0 && N == 0, B can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGelsStridedBatchedFn(handle,
-                                                      opN,
-                                                      0,
-                                                      0,
-                                                      nrhs,
-                                                      dA,
-                                                      lda,
-                                                      strideA,
-                                                      nullptr,
-                                                      ldb,
-                                                      strideB,
-                                                      &info,
-                                                      dInfo,
-                                                      batchCount),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               opN,
+                               0,
+                               0,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               &info,
+                               dInfo,
+                               batchCount),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // if batchCount == 0, dInfo can be nullptr
     EXPECT_HIPBLAS_STATUS(
-        hipblasGelsStridedBatchedFn(
-            handle, opN, M, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, nullptr, 0),
+        func(handle, opN, M, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, nullptr, 0),
         HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 }
 
 template <typename T>
-void testing_gels_strided_batched(const Arguments& arg)
+void testing_gels_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGelsStridedBatchedFn = arg.api == FORTRAN
+                                           ? hipblasGelsStridedBatched<T, true>
+                                           : hipblasGelsStridedBatched<T, false>;
+    auto hipblasGelsStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGelsStridedBatched_64<T, true>
+                                              : hipblasGelsStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_gels_strided_batched_bad_arg_template<T, int64_t>(arg,
+                                                                  hipblasGelsStridedBatchedFn_64);
+    else
+        testing_gels_strided_batched_bad_arg_template<T, int>(arg, hipblasGelsStridedBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_gels_strided_batched_template(const Arguments& arg, FUNC func)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGelsStridedBatchedFn
-        = FORTRAN ? hipblasGelsStridedBatched<T, true> : hipblasGelsStridedBatched<T, false>;
+    using U = real_t<T>;
 
     char   transc      = arg.transA;
     int    N           = arg.N;
@@ -363,13 +370,13 @@ void testing_gels_strided_batched(const Arguments& arg)
     host_vector<T>   hA(A_size);
     host_vector<T>   hB(B_size);
     host_vector<T>   hB_res(B_size);
-    host_vector<int> info_res(batchCount);
+    host_vector<I>   info_res(batchCount);
     host_vector<int> info(batchCount);
-    int              info_input(-1);
+    I                info_input(-1);
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dInfo(batchCount);
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dInfo(batchCount);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -406,25 +413,25 @@ void testing_gels_strided_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGelsStridedBatchedFn(handle,
-                                                        trans,
-                                                        M,
-                                                        N,
-                                                        nrhs,
-                                                        dA,
-                                                        lda,
-                                                        strideA,
-                                                        dB,
-                                                        ldb,
-                                                        strideB,
-                                                        &info_input,
-                                                        dInfo,
-                                                        batchCount));
+        CHECK_HIPBLAS_ERROR(func(handle,
+                                 trans,
+                                 M,
+                                 N,
+                                 nrhs,
+                                 dA,
+                                 lda,
+                                 strideA,
+                                 dB,
+                                 ldb,
+                                 strideB,
+                                 &info_input,
+                                 dInfo,
+                                 batchCount));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hB_res, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(
-            hipMemcpy(info_res.data(), dInfo, sizeof(int) * batchCount, hipMemcpyDeviceToHost));
+            hipMemcpy(info_res.data(), dInfo, sizeof(I) * batchCount, hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -461,7 +468,7 @@ void testing_gels_strided_batched(const Arguments& arg)
         {
             double eps       = std::numeric_limits<U>::epsilon();
             double tolerance = N * eps * 100;
-            int    zero      = 0;
+            I      zero      = 0;
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info_input);
@@ -479,20 +486,20 @@ void testing_gels_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGelsStridedBatchedFn(handle,
-                                                            trans,
-                                                            M,
-                                                            N,
-                                                            nrhs,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            dB,
-                                                            ldb,
-                                                            strideB,
-                                                            &info_input,
-                                                            dInfo,
-                                                            batchCount));
+            CHECK_HIPBLAS_ERROR(func(handle,
+                                     trans,
+                                     M,
+                                     N,
+                                     nrhs,
+                                     dA,
+                                     lda,
+                                     strideA,
+                                     dB,
+                                     ldb,
+                                     strideB,
+                                     &info_input,
+                                     dInfo,
+                                     batchCount));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -504,3 +511,19 @@ void testing_gels_strided_batched(const Arguments& arg)
                                                      hipblas_error);
     }
 }
+
+template <typename T>
+void testing_gels_strided_batched(const Arguments& arg)
+{
+    auto hipblasGelsStridedBatchedFn = arg.api == FORTRAN
+                                           ? hipblasGelsStridedBatched<T, true>
+                                           : hipblasGelsStridedBatched<T, false>;
+    auto hipblasGelsStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                              ? hipblasGelsStridedBatched_64<T, true>
+                                              : hipblasGelsStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_gels_strided_batched_template<T, int64_t>(arg, hipblasGelsStridedBatchedFn_64);
+    else
+        testing_gels_strided_batched_template<T, int>(arg, hipblasGelsStridedBatchedFn);
+}
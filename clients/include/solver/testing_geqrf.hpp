@@ -64,12 +64,9 @@ void setup_geqrf_testing(
     CHECK_HIP_ERROR(hipMemset(dIpiv, 0, K * sizeof(T)));
 }
 
-template <typename T>
-void testing_geqrf_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_geqrf_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGeqrfFn
-        = arg.api == hipblas_client_api::FORTRAN ? hipblasGeqrf<T, true> : hipblasGeqrf<T, false>;
-
     hipblasLocalHandle handle(arg);
     const int          M      = 100;
     const int          N      = 101;
@@ -81,57 +78,64 @@ void testing_geqrf_bad_arg(const Arguments& arg)
 
     device_vector<T> dA(A_size);
     device_vector<T> dIpiv(K);
-    int              info         = 0;
-    int              expectedInfo = 0;
+    I                info         = 0;
+    I                expectedInfo = 0;
 
     setup_geqrf_testing(hA, dA, dIpiv, M, N, lda);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, M, N, dA, lda, dIpiv, nullptr),
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dA, lda, dIpiv, nullptr),
                           HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, -1, N, dA, lda, dIpiv, &info),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, -1, N, dA, lda, dIpiv, &info), HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -1;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, M, -1, dA, lda, dIpiv, &info),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, -1, dA, lda, dIpiv, &info), HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, M, N, nullptr, lda, dIpiv, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, nullptr, lda, dIpiv, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, M, N, dA, M - 1, dIpiv, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dA, M - 1, dIpiv, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, M, N, dA, lda, nullptr, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dA, lda, nullptr, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -5;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If M == 0 || N == 0, A and ipiv can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, 0, N, nullptr, lda, nullptr, &info),
-                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, 0, N, nullptr, lda, nullptr, &info), HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfFn(handle, M, 0, nullptr, lda, nullptr, &info),
-                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, 0, nullptr, lda, nullptr, &info), HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 }
 
 template <typename T>
-void testing_geqrf(const Arguments& arg)
+void testing_geqrf_bad_arg(const Arguments& arg)
 {
-    using U             = real_t<T>;
-    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGeqrfFn = FORTRAN ? hipblasGeqrf<T, true> : hipblasGeqrf<T, false>;
+    auto hipblasGeqrfFn = arg.api == FORTRAN ? hipblasGeqrf<T, true> : hipblasGeqrf<T, false>;
+    auto hipblasGeqrfFn_64
+        = arg.api == FORTRAN_64 ? hipblasGeqrf_64<T, true> : hipblasGeqrf_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_geqrf_bad_arg_template<T, int64_t>(arg, hipblasGeqrfFn_64);
+    else
+        testing_geqrf_bad_arg_template<T, int>(arg, hipblasGeqrfFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_geqrf_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int M   = arg.M;
     int N   = arg.N;
@@ -140,7 +144,7 @@ void testing_geqrf(const Arguments& arg)
 
     size_t A_size    = size_t(lda) * N;
     int    Ipiv_size = K;
-    int    info;
+    I      info;
 
     hipblasLocalHandle handle(arg);
 
@@ -167,7 +171,7 @@ void testing_geqrf(const Arguments& arg)
     /* =====================================================================
            HIPBLAS
     =================================================================== */
-    CHECK_HIPBLAS_ERROR(hipblasGeqrfFn(handle, M, N, dA, lda, dIpiv, &info));
+    CHECK_HIPBLAS_ERROR(func(handle, M, N, dA, lda, dIpiv, &info));
 
     // Copy output from device to CPU
     CHECK_HIP_ERROR(hipMemcpy(hA1, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
@@ -199,7 +203,7 @@ void testing_geqrf(const Arguments& arg)
 
             unit_check_error(e1, tolerance);
             unit_check_error(e2, tolerance);
-            int zero = 0;
+            I zero = 0;
             unit_check_general(1, 1, 1, &zero, &info);
         }
     }
@@ -215,7 +219,7 @@ void testing_geqrf(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGeqrfFn(handle, M, N, dA, lda, dIpiv, &info));
+            CHECK_HIPBLAS_ERROR(func(handle, M, N, dA, lda, dIpiv, &info));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -227,3 +231,16 @@ void testing_geqrf(const Arguments& arg)
                                         hipblas_error);
     }
 }
+
+template <typename T>
+void testing_geqrf(const Arguments& arg)
+{
+    auto hipblasGeqrfFn = arg.api == FORTRAN ? hipblasGeqrf<T, true> : hipblasGeqrf<T, false>;
+    auto hipblasGeqrfFn_64
+        = arg.api == FORTRAN_64 ? hipblasGeqrf_64<T, true> : hipblasGeqrf_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_geqrf_template<T, int64_t>(arg, hipblasGeqrfFn_64);
+    else
+        testing_geqrf_template<T, int>(arg, hipblasGeqrfFn);
+}
@@ -68,13 +68,9 @@ void setup_geqrf_batched_testing(host_batch_vector<T>&   hA,
     CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
 }
 
-template <typename T>
-void testing_geqrf_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_geqrf_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGeqrfBatchedFn = arg.api == hipblas_client_api::FORTRAN
-                                     ? hipblasGeqrfBatched<T, true>
-                                     : hipblasGeqrfBatched<T, false>;
-
     hipblasLocalHandle handle(arg);
     const int          M           = 100;
     const int          N           = 101;
@@ -88,51 +84,45 @@ void testing_geqrf_batched_bad_arg(const Arguments& arg)
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
     device_batch_vector<T> dIpiv(K, 1, batch_count);
-    int                    info = 0;
-    int                    expectedInfo;
+    I                      info = 0;
+    I                      expectedInfo;
 
     T* const* dAp    = dA.ptr_on_device();
     T* const* dIpivp = dIpiv.ptr_on_device();
 
     setup_geqrf_batched_testing(hA, hIpiv, dA, dIpiv, M, N, lda, batch_count);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, M, N, dAp, lda, dIpivp, nullptr, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dAp, lda, dIpivp, nullptr, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, -1, N, dAp, lda, dIpivp, &info, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, -1, N, dAp, lda, dIpivp, &info, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -1;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, M, -1, dAp, lda, dIpivp, &info, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, -1, dAp, lda, dIpivp, &info, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, M, N, dAp, M - 1, dIpivp, &info, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dAp, M - 1, dIpivp, &info, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfBatchedFn(handle, M, N, dAp, lda, dIpivp, &info, -1),
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dAp, lda, dIpivp, &info, -1),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -7;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If M == 0 || N == 0, A and ipiv can be nullptr
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, 0, N, nullptr, lda, nullptr, &info, batch_count),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, 0, N, nullptr, lda, nullptr, &info, batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, M, 0, nullptr, lda, nullptr, &info, batch_count),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, 0, nullptr, lda, nullptr, &info, batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
@@ -140,27 +130,37 @@ void testing_geqrf_batched_bad_arg(const Arguments& arg)
 
     // cuBLAS beckend doesn't check for nullptrs for A and ipiv
 #ifndef __HIP_PLATFORM_NVCC__
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, M, N, nullptr, lda, dIpivp, &info, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, nullptr, lda, dIpivp, &info, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfBatchedFn(handle, M, N, dAp, lda, nullptr, &info, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dAp, lda, nullptr, &info, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -5;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 #endif
 }
 
 template <typename T>
-void testing_geqrf_batched(const Arguments& arg)
+void testing_geqrf_batched_bad_arg(const Arguments& arg)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGeqrfBatchedFn
-        = FORTRAN ? hipblasGeqrfBatched<T, true> : hipblasGeqrfBatched<T, false>;
+        = arg.api == FORTRAN ? hipblasGeqrfBatched<T, true> : hipblasGeqrfBatched<T, false>;
+    auto hipblasGeqrfBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasGeqrfBatched_64<T, true>
+                                        : hipblasGeqrfBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_geqrf_batched_bad_arg_template<T, int64_t>(arg, hipblasGeqrfBatchedFn_64);
+    else
+        testing_geqrf_batched_bad_arg_template<T, int>(arg, hipblasGeqrfBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_geqrf_batched_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int M           = arg.M;
     int N           = arg.N;
@@ -170,7 +170,7 @@ void testing_geqrf_batched(const Arguments& arg)
 
     size_t A_size    = size_t(lda) * N;
     int    Ipiv_size = K;
-    int    info;
+    I      info;
 
     hipblasLocalHandle handle(arg);
 
@@ -198,8 +198,8 @@ void testing_geqrf_batched(const Arguments& arg)
            HIPBLAS
     =================================================================== */
 
-    CHECK_HIPBLAS_ERROR(hipblasGeqrfBatchedFn(
-        handle, M, N, dA.ptr_on_device(), lda, dIpiv.ptr_on_device(), &info, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        func(handle, M, N, dA.ptr_on_device(), lda, dIpiv.ptr_on_device(), &info, batch_count));
 
     CHECK_HIP_ERROR(hIpiv1.transfer_from(dIpiv));
     CHECK_HIP_ERROR(hA1.transfer_from(dA));
@@ -233,7 +233,7 @@ void testing_geqrf_batched(const Arguments& arg)
 
             unit_check_error(e1, tolerance);
             unit_check_error(e2, tolerance);
-            int zero = 0;
+            I zero = 0;
             unit_check_general(1, 1, 1, &zero, &info);
         }
     }
@@ -249,7 +249,7 @@ void testing_geqrf_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGeqrfBatchedFn(
+            CHECK_HIPBLAS_ERROR(func(
                 handle, M, N, dA.ptr_on_device(), lda, dIpiv.ptr_on_device(), &info, batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
@@ -262,3 +262,18 @@ void testing_geqrf_batched(const Arguments& arg)
                                                hipblas_error);
     }
 }
+
+template <typename T>
+void testing_geqrf_batched(const Arguments& arg)
+{
+    auto hipblasGeqrfBatchedFn
+        = arg.api == FORTRAN ? hipblasGeqrfBatched<T, true> : hipblasGeqrfBatched<T, false>;
+    auto hipblasGeqrfBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasGeqrfBatched_64<T, true>
+                                        : hipblasGeqrfBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_geqrf_batched_template<T, int64_t>(arg, hipblasGeqrfBatchedFn_64);
+    else
+        testing_geqrf_batched_template<T, int>(arg, hipblasGeqrfBatchedFn);
+}
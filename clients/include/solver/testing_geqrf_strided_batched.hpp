@@ -76,13 +76,9 @@ void setup_geqrf_strided_batched_testing(host_vector<T>&   hA,
     CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(T)));
 }
 
-template <typename T>
-void testing_geqrf_strided_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_geqrf_strided_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGeqrfStridedBatchedFn = arg.api == hipblas_client_api::FORTRAN
-                                            ? hipblasGeqrfStridedBatched<T, true>
-                                            : hipblasGeqrfStridedBatched<T, false>;
-
     hipblasLocalHandle handle(arg);
     const int          M           = 100;
     const int          N           = 101;
@@ -99,63 +95,57 @@ void testing_geqrf_strided_batched_bad_arg(const Arguments& arg)
 
     device_vector<T> dA(A_size);
     device_vector<T> dIpiv(Ipiv_size);
-    int              info = 0;
-    int              expectedInfo;
+    I                info = 0;
+    I                expectedInfo;
 
     setup_geqrf_strided_batched_testing(hA, dA, dIpiv, M, N, lda, strideA, strideP, batch_count);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfStridedBatchedFn(
-                              handle, M, N, dA, lda, strideA, dIpiv, strideP, nullptr, batch_count),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        func(handle, M, N, dA, lda, strideA, dIpiv, strideP, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfStridedBatchedFn(
-                              handle, -1, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle, -1, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -1;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfStridedBatchedFn(
-                              handle, M, -1, dA, lda, strideA, dIpiv, strideP, &info, batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle, M, -1, dA, lda, strideA, dIpiv, strideP, &info, batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfStridedBatchedFn(
-            handle, M, N, nullptr, lda, strideA, dIpiv, strideP, &info, batch_count),
+        func(handle, M, N, nullptr, lda, strideA, dIpiv, strideP, &info, batch_count),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfStridedBatchedFn(
-                              handle, M, N, dA, M - 1, strideA, dIpiv, strideP, &info, batch_count),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        func(handle, M, N, dA, M - 1, strideA, dIpiv, strideP, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGeqrfStridedBatchedFn(
-                              handle, M, N, dA, lda, strideA, nullptr, strideP, &info, batch_count),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        func(handle, M, N, dA, lda, strideA, nullptr, strideP, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -6;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfStridedBatchedFn(handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, -1),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -9;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If M == 0 || N == 0, A and ipiv can be nullptr
     EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfStridedBatchedFn(
-            handle, 0, N, nullptr, lda, strideA, nullptr, strideP, &info, batch_count),
+        func(handle, 0, N, nullptr, lda, strideA, nullptr, strideP, &info, batch_count),
         HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGeqrfStridedBatchedFn(
-            handle, M, 0, nullptr, lda, strideA, nullptr, strideP, &info, batch_count),
+        func(handle, M, 0, nullptr, lda, strideA, nullptr, strideP, &info, batch_count),
         HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
@@ -164,12 +154,26 @@ void testing_geqrf_strided_batched_bad_arg(const Arguments& arg)
 }
 
 template <typename T>
-void testing_geqrf_strided_batched(const Arguments& arg)
+void testing_geqrf_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGeqrfStridedBatchedFn = arg.api == FORTRAN
+                                            ? hipblasGeqrfStridedBatched<T, true>
+                                            : hipblasGeqrfStridedBatched<T, false>;
+    auto hipblasGeqrfStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasGeqrfStridedBatched_64<T, true>
+                                               : hipblasGeqrfStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_geqrf_strided_batched_bad_arg_template<T, int64_t>(arg,
+                                                                   hipblasGeqrfStridedBatchedFn_64);
+    else
+        testing_geqrf_strided_batched_bad_arg_template<T, int>(arg, hipblasGeqrfStridedBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_geqrf_strided_batched_template(const Arguments& arg, FUNC func)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGeqrfStridedBatchedFn
-        = FORTRAN ? hipblasGeqrfStridedBatched<T, true> : hipblasGeqrfStridedBatched<T, false>;
+    using U = real_t<T>;
 
     int    M            = arg.M;
     int    N            = arg.N;
@@ -182,7 +186,7 @@ void testing_geqrf_strided_batched(const Arguments& arg)
     hipblasStride strideP   = K * stride_scale;
     int           A_size    = strideA * batch_count;
     int           Ipiv_size = strideP * batch_count;
-    int           info;
+    I             info;
 
     hipblasLocalHandle handle(arg);
 
@@ -193,12 +197,12 @@ void testing_geqrf_strided_batched(const Arguments& arg)
         // including pointers so can test other params
         device_vector<T> dA(1);
         device_vector<T> dIpiv(1);
-        hipblasStatus_t  status = hipblasGeqrfStridedBatchedFn(
-            handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count);
+        hipblasStatus_t  status
+            = func(handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count);
         EXPECT_HIPBLAS_STATUS(
             status, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
 
-        int expected_info = 0;
+        I expected_info = 0;
         if(M < 0)
             expected_info = -1;
         else if(N < 0)
@@ -228,8 +232,7 @@ void testing_geqrf_strided_batched(const Arguments& arg)
     /* =====================================================================
            HIPBLAS
     =================================================================== */
-    CHECK_HIPBLAS_ERROR(hipblasGeqrfStridedBatchedFn(
-        handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count));
+    CHECK_HIPBLAS_ERROR(func(handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count));
 
     // Copy output from device to CPU
     CHECK_HIP_ERROR(hipMemcpy(hA1.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
@@ -265,7 +268,7 @@ void testing_geqrf_strided_batched(const Arguments& arg)
 
             unit_check_error(e1, tolerance);
             unit_check_error(e2, tolerance);
-            int zero = 0;
+            I zero = 0;
             unit_check_general(1, 1, 1, &zero, &info);
         }
     }
@@ -281,8 +284,8 @@ void testing_geqrf_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGeqrfStridedBatchedFn(
-                handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count));
+            CHECK_HIPBLAS_ERROR(
+                func(handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -294,3 +297,19 @@ void testing_geqrf_strided_batched(const Arguments& arg)
                                                       hipblas_error);
     }
 }
+
+template <typename T>
+void testing_geqrf_strided_batched(const Arguments& arg)
+{
+    auto hipblasGeqrfStridedBatchedFn = arg.api == FORTRAN
+                                            ? hipblasGeqrfStridedBatched<T, true>
+                                            : hipblasGeqrfStridedBatched<T, false>;
+    auto hipblasGeqrfStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasGeqrfStridedBatched_64<T, true>
+                                               : hipblasGeqrfStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_geqrf_strided_batched_template<T, int64_t>(arg, hipblasGeqrfStridedBatchedFn_64);
+    else
+        testing_geqrf_strided_batched_template<T, int>(arg, hipblasGeqrfStridedBatchedFn);
+}
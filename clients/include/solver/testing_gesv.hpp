@@ -0,0 +1,316 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvModel = ArgumentModel<e_a_type, e_N, e_lda, e_ldb, e_ldc, e_alpha>;
+
+inline void testname_gesv(const Arguments& arg, std::string& name)
+{
+    hipblasGesvModel{}.test_name(arg, name);
+}
+
+// Fills a diagonally dominant A scaled by alpha and B = A * X. An alpha beyond the
+// single precision range makes the solver fall back to a double precision factorization.
+template <typename T>
+void setup_gesv_testing(host_vector<T>&   hA,
+                        host_vector<T>&   hB,
+                        host_vector<T>&   hX,
+                        device_vector<T>& dA,
+                        device_vector<T>& dB,
+                        double            alpha,
+                        int               N,
+                        int               lda,
+                        int               ldb)
+{
+    const size_t A_size = size_t(N) * lda;
+    const size_t B_size = ldb;
+
+    // Initial hA, hB, hX on CPU
+    srand(1);
+    hipblas_init<T>(hA, N, N, lda);
+    hipblas_init<T>(hX, N, 1, ldb);
+
+    // scale A to avoid singularities
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                hA[i + j * lda] += 400;
+            else
+                hA[i + j * lda] -= 4;
+            hA[i + j * lda] = hA[i + j * lda] * T(alpha);
+        }
+    }
+
+    // Calculate hB = hA*hX;
+    hipblasOperation_t opN = HIPBLAS_OP_N;
+    ref_gemm<T>(opN, opN, N, 1, N, (T)1, hA.data(), lda, hX.data(), ldb, (T)0, hB.data(), ldb);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+}
+
+template <typename T>
+void testing_gesv_bad_arg(const Arguments& arg)
+{
+    auto hipblasGesvFn
+        = arg.api == hipblas_client_api::FORTRAN ? hipblasGesv<T, true> : hipblasGesv<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N      = 100;
+    const int          nrhs   = 1;
+    const int          lda    = 101;
+    const int          ldb    = 102;
+    const int          ldx    = 103;
+    const size_t       A_size = size_t(N) * lda;
+    const size_t       B_size = ldb;
+    const size_t       X_size = ldx;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hX(B_size);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(X_size);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dIter(1);
+    device_vector<int> dInfo(1);
+    int                info = 0;
+    int                expectedInfo;
+
+    // Need initialization code because even with bad params we call roc/cu-solver
+    // so want to give reasonable data
+
+    setup_gesv_testing(hA, hB, hX, dA, dB, 1.0, N, lda, ldb);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, nullptr, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, -1, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, -1, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, nullptr, lda, dIpiv, dB, ldb, dX, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, N - 1, dIpiv, dB, ldb, dX, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, nullptr, dB, ldb, dX, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, dIpiv, nullptr, ldb, dX, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, N - 1, dX, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -7;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, N - 1, dIter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -9;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, nullptr, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -10;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, &info, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -12;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If N == 0, A, ipiv, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblasGesvFn(handle,
+                                        0,
+                                        nrhs,
+                                        nullptr,
+                                        lda,
+                                        nullptr,
+                                        nullptr,
+                                        ldb,
+                                        nullptr,
+                                        ldx,
+                                        dIter,
+                                        &info,
+                                        dInfo),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // if nrhs == 0, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvFn(
+            handle, N, 0, dA, lda, dIpiv, nullptr, ldb, nullptr, ldx, dIter, &info, dInfo),
+        HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_gesv(const Arguments& arg)
+{
+    bool FORTRAN       = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvFn = FORTRAN ? hipblasGesv<T, true> : hipblasGesv<T, false>;
+
+    int    N     = arg.N;
+    int    lda   = arg.lda;
+    int    ldb   = arg.ldb;
+    int    ldx   = arg.ldc;
+    double alpha = arg.alpha;
+
+    size_t A_size = size_t(lda) * N;
+    size_t B_size = size_t(ldb) * 1;
+    size_t X_size = size_t(ldx) * 1;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || ldx < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hX1(X_size);
+    host_vector<int> hIpiv(N);
+    int              info, hIter, hInfo;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(X_size);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dIter(1);
+    device_vector<int> dInfo(1);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_gesv_testing(hA, hB, hX, dA, dB, alpha, N, lda, ldb);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(
+            hipblasGesvFn(handle, N, 1, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, &info, dInfo));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dX, X_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&hIter, dIter, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        ref_getrf<T>(N, N, hA.data(), lda, hIpiv.data());
+        ref_getrs<T>('N', N, 1, hA.data(), lda, hIpiv.data(), hB.data(), ldb);
+
+        // a single right hand side, so the leading dimensions of B and X do not matter
+        hipblas_error = norm_check_general<T>('F', N, 1, ldx, hB.data(), hX1.data());
+
+        if(arg.unit_check)
+        {
+            double eps       = std::numeric_limits<double>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            // iter counts the refinement steps, or is negative when the solver fell back
+            int overflow = alpha > std::numeric_limits<float>::max() ? -2 : 0;
+            int fallback = hIter < 0 ? hIter : 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, 1, 1, &zero, &hInfo);
+            unit_check_general(1, 1, 1, &overflow, &fallback);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvFn(
+                handle, N, 1, dA, lda, dIpiv, dB, ldb, dX, ldx, dIter, &info, dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvModel{}.log_args<T>(std::cout,
+                                       arg,
+                                       gpu_time_used,
+                                       gesv_gflop_count<T>(N, 1),
+                                       ArgumentLogging::NA_value,
+                                       hipblas_error);
+    }
+}
@@ -0,0 +1,632 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvStridedBatchedModel
+    = ArgumentModel<e_a_type, e_N, e_lda, e_ldb, e_ldc, e_alpha, e_stride_scale, e_batch_count>;
+
+inline void testname_gesv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void setup_gesv_strided_batched_testing(host_vector<T>&   hA,
+                                        host_vector<T>&   hB,
+                                        host_vector<T>&   hX,
+                                        device_vector<T>& dA,
+                                        device_vector<T>& dB,
+                                        double            alpha,
+                                        int               N,
+                                        int               lda,
+                                        int               ldb,
+                                        hipblasStride     strideA,
+                                        hipblasStride     strideB,
+                                        int               batch_count)
+{
+    size_t A_size = strideA * batch_count;
+    size_t B_size = strideB * batch_count;
+
+    // Initial hA, hB, hX on CPU
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, 1, ldb);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] += 400;
+                else
+                    hAb[i + j * lda] -= 4;
+                hAb[i + j * lda] = hAb[i + j * lda] * T(alpha);
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        ref_gemm<T>(op, op, N, 1, N, (T)1, hAb, lda, hXb, ldb, (T)0, hBb, ldb);
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+}
+
+template <typename T>
+void testing_gesv_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGesvStridedBatchedFn = arg.api == hipblas_client_api::FORTRAN
+                                           ? hipblasGesvStridedBatched<T, true>
+                                           : hipblasGesvStridedBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 100;
+    const int          nrhs        = 1;
+    const int          lda         = 101;
+    const int          ldb         = 102;
+    const int          ldx         = 103;
+    const int          batch_count = 2;
+    hipblasStride      strideA     = size_t(lda) * N;
+    hipblasStride      strideB     = size_t(ldb) * 1;
+    hipblasStride      strideX     = size_t(ldx) * 1;
+    hipblasStride      strideP     = size_t(N);
+    size_t             A_size      = strideA * batch_count;
+    size_t             B_size      = strideB * batch_count;
+    size_t             X_size      = strideX * batch_count;
+    size_t             Ipiv_size   = strideP * batch_count;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hX(B_size);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(X_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dIter(batch_count);
+    device_vector<int> dInfo(batch_count);
+    int                info = 0;
+    int                expectedInfo;
+
+    // Need initialization code because even with bad params we call roc/cu-solver
+    // so want to give reasonable data
+
+    setup_gesv_strided_batched_testing(
+        hA, hB, hX, dA, dB, 1.0, N, lda, ldb, strideA, strideB, batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      nullptr,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      -1,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      -1,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      nullptr,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      N - 1,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      nullptr,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      nullptr,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      N - 1,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -9;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      nullptr,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -11;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      N - 1,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -12;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      nullptr,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -14;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      nullptr,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -16;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      nrhs,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      dX,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -17;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If N == 0, A, ipiv, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      0,
+                                                      nrhs,
+                                                      nullptr,
+                                                      lda,
+                                                      strideA,
+                                                      nullptr,
+                                                      strideP,
+                                                      nullptr,
+                                                      ldb,
+                                                      strideB,
+                                                      nullptr,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // if nrhs == 0, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblasGesvStridedBatchedFn(handle,
+                                                      N,
+                                                      0,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dIpiv,
+                                                      strideP,
+                                                      nullptr,
+                                                      ldb,
+                                                      strideB,
+                                                      nullptr,
+                                                      ldx,
+                                                      strideX,
+                                                      dIter,
+                                                      &info,
+                                                      dInfo,
+                                                      batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_gesv_strided_batched(const Arguments& arg)
+{
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvStridedBatchedFn
+        = FORTRAN ? hipblasGesvStridedBatched<T, true> : hipblasGesvStridedBatched<T, false>;
+
+    int    N            = arg.N;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    int    ldx          = arg.ldc;
+    double alpha        = arg.alpha;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride strideA   = size_t(lda) * N * stride_scale;
+    hipblasStride strideB   = size_t(ldb) * 1 * stride_scale;
+    hipblasStride strideX   = size_t(ldx) * 1 * stride_scale;
+    hipblasStride strideP   = size_t(N) * stride_scale;
+    size_t        A_size    = strideA * batch_count;
+    size_t        B_size    = strideB * batch_count;
+    size_t        X_size    = strideX * batch_count;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || ldx < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hX1(X_size);
+    host_vector<T>   hX_gold(X_size);
+    host_vector<int> hIpiv(N);
+    host_vector<int> hIter(batch_count);
+    host_vector<int> hInfo(batch_count);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(X_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dIter(batch_count);
+    device_vector<int> dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_gesv_strided_batched_testing(
+        hA, hB, hX, dA, dB, alpha, N, lda, ldb, strideA, strideB, batch_count);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                        N,
+                                                        1,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        dIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dX, X_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hIter, dIter, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo, dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            T* hAb = hA.data() + b * strideA;
+            T* hBb = hB.data() + b * strideB;
+
+            ref_getrf<T>(N, N, hAb, lda, hIpiv.data());
+            ref_getrs<T>('N', N, 1, hAb, lda, hIpiv.data(), hBb, ldb);
+
+            // lay the solution out with the strides of X
+            for(int i = 0; i < N; i++)
+                hX_gold[b * strideX + i] = hBb[i];
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldx, strideX, hX_gold, hX1, batch_count);
+
+        if(arg.unit_check)
+        {
+            double eps       = std::numeric_limits<double>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            // iter counts the refinement steps, or is negative when the solver fell back
+            host_vector<int> hOverflow(batch_count);
+            host_vector<int> hZero(batch_count);
+            for(int b = 0; b < batch_count; b++)
+            {
+                hOverflow[b] = alpha > std::numeric_limits<float>::max() ? -2 : 0;
+                hIter[b]     = hIter[b] < 0 ? hIter[b] : 0;
+                hZero[b]     = 0;
+            }
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, batch_count, 1, hZero.data(), hInfo.data());
+            unit_check_general(1, batch_count, 1, hOverflow.data(), hIter.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                            N,
+                                                            1,
+                                                            dA,
+                                                            lda,
+                                                            strideA,
+                                                            dIpiv,
+                                                            strideP,
+                                                            dB,
+                                                            ldb,
+                                                            strideB,
+                                                            dX,
+                                                            ldx,
+                                                            strideX,
+                                                            dIter,
+                                                            &info,
+                                                            dInfo,
+                                                            batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvStridedBatchedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     gesv_gflop_count<T>(N, 1),
+                                                     ArgumentLogging::NA_value,
+                                                     hipblas_error);
+    }
+}
@@ -0,0 +1,545 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvdjModel = ArgumentModel<e_a_type, e_jobu, e_jobv, e_M, e_N, e_lda, e_ldb, e_ldc>;
+
+inline void testname_gesvdj(const Arguments& arg, std::string& name)
+{
+    hipblasGesvdjModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_gesvdj_bad_arg(const Arguments& arg)
+{
+    using R              = real_t<T>;
+    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvdjFn = FORTRAN ? hipblasGesvdj<T, R, true> : hipblasGesvdj<T, R, false>;
+
+    hipblasLocalHandle handle(arg);
+    hipblasSvdMode_t   jobu      = HIPBLAS_SVD_MODE_SINGULAR;
+    hipblasSvdMode_t   jobv      = HIPBLAS_SVD_MODE_SINGULAR;
+    int64_t            M         = 101;
+    int64_t            N         = 100;
+    int64_t            lda       = 102;
+    int64_t            ldu       = 102;
+    int64_t            ldv       = 101;
+    int64_t            K         = std::min(M, N);
+    R                  abstol    = 0;
+    int64_t            maxSweeps = 100;
+
+    device_vector<T>   dA(N * lda);
+    device_vector<R>   dS(K);
+    device_vector<T>   dU(K * ldu);
+    device_vector<T>   dV(N * ldv);
+    device_vector<R>   dResidual(1);
+    device_vector<int> dSweeps(1);
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(nullptr,
+                                          jobu,
+                                          jobv,
+                                          M,
+                                          N,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          hipblasSvdMode_t(-1),
+                                          jobv,
+                                          M,
+                                          N,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          jobu,
+                                          hipblasSvdMode_t(-1),
+                                          M,
+                                          N,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          jobu,
+                                          jobv,
+                                          -1,
+                                          N,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          jobu,
+                                          jobv,
+                                          M,
+                                          -1,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          jobu,
+                                          jobv,
+                                          M,
+                                          N,
+                                          dA,
+                                          M - 1,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          jobu,
+                                          jobv,
+                                          M,
+                                          N,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          M - 1,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          jobu,
+                                          jobv,
+                                          M,
+                                          N,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          maxSweeps,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          K - 1,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                          jobu,
+                                          jobv,
+                                          M,
+                                          N,
+                                          dA,
+                                          lda,
+                                          abstol,
+                                          dResidual,
+                                          0,
+                                          dSweeps,
+                                          dS,
+                                          dU,
+                                          ldu,
+                                          dV,
+                                          ldv,
+                                          dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If M == 0, A, S, U and V can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGesvdjFn(handle,
+                                        jobu,
+                                        jobv,
+                                        0,
+                                        N,
+                                        nullptr,
+                                        lda,
+                                        abstol,
+                                        dResidual,
+                                        maxSweeps,
+                                        dSweeps,
+                                        nullptr,
+                                        nullptr,
+                                        ldu,
+                                        nullptr,
+                                        ldv,
+                                        dInfo));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                              jobu,
+                                              jobv,
+                                              M,
+                                              N,
+                                              nullptr,
+                                              lda,
+                                              abstol,
+                                              dResidual,
+                                              maxSweeps,
+                                              dSweeps,
+                                              dS,
+                                              dU,
+                                              ldu,
+                                              dV,
+                                              ldv,
+                                              dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                              jobu,
+                                              jobv,
+                                              M,
+                                              N,
+                                              dA,
+                                              lda,
+                                              abstol,
+                                              dResidual,
+                                              maxSweeps,
+                                              dSweeps,
+                                              nullptr,
+                                              dU,
+                                              ldu,
+                                              dV,
+                                              ldv,
+                                              dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                              jobu,
+                                              jobv,
+                                              M,
+                                              N,
+                                              dA,
+                                              lda,
+                                              abstol,
+                                              dResidual,
+                                              maxSweeps,
+                                              dSweeps,
+                                              dS,
+                                              nullptr,
+                                              ldu,
+                                              dV,
+                                              ldv,
+                                              dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                              jobu,
+                                              jobv,
+                                              M,
+                                              N,
+                                              dA,
+                                              lda,
+                                              abstol,
+                                              dResidual,
+                                              maxSweeps,
+                                              dSweeps,
+                                              dS,
+                                              dU,
+                                              ldu,
+                                              nullptr,
+                                              ldv,
+                                              dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                              jobu,
+                                              jobv,
+                                              M,
+                                              N,
+                                              dA,
+                                              lda,
+                                              abstol,
+                                              nullptr,
+                                              maxSweeps,
+                                              dSweeps,
+                                              dS,
+                                              dU,
+                                              ldu,
+                                              dV,
+                                              ldv,
+                                              dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                              jobu,
+                                              jobv,
+                                              M,
+                                              N,
+                                              dA,
+                                              lda,
+                                              abstol,
+                                              dResidual,
+                                              maxSweeps,
+                                              nullptr,
+                                              dS,
+                                              dU,
+                                              ldu,
+                                              dV,
+                                              ldv,
+                                              dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGesvdjFn(handle,
+                                              jobu,
+                                              jobv,
+                                              M,
+                                              N,
+                                              dA,
+                                              lda,
+                                              abstol,
+                                              dResidual,
+                                              maxSweeps,
+                                              dSweeps,
+                                              dS,
+                                              dU,
+                                              ldu,
+                                              dV,
+                                              ldv,
+                                              nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_gesvdj(const Arguments& arg)
+{
+    using R              = real_t<T>;
+    bool FORTRAN         = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasGesvdjFn = FORTRAN ? hipblasGesvdj<T, R, true> : hipblasGesvdj<T, R, false>;
+
+    hipblasSvdMode_t jobu      = char2hipblas_svd_mode(arg.jobu);
+    hipblasSvdMode_t jobv      = char2hipblas_svd_mode(arg.jobv);
+    int              M         = arg.M;
+    int              N         = arg.N;
+    int              lda       = arg.lda;
+    int              ldu       = arg.ldb;
+    int              ldv       = arg.ldc;
+    R                abstol    = 0;
+    int              maxSweeps = 100;
+
+    int    K      = std::min(M, N);
+    int    U_cols = jobu == HIPBLAS_SVD_MODE_ALL ? M : K;
+    size_t A_size = size_t(lda) * N;
+    size_t S_size = K;
+    size_t U_size = size_t(ldu) * U_cols;
+    size_t V_size = size_t(ldv) * N;
+
+    // U and V are only referenced with singular vectors
+    int min_ldu = jobu == HIPBLAS_SVD_MODE_NOVECTOR ? 1 : M;
+    int min_ldv = 1;
+    if(jobv == HIPBLAS_SVD_MODE_ALL)
+        min_ldv = N;
+    else if(jobv == HIPBLAS_SVD_MODE_SINGULAR)
+        min_ldv = K;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < std::max(1, M) || ldu < std::max(1, min_ldu)
+       || ldv < std::max(1, min_ldv))
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hA0(A_size);
+    host_vector<R>   hS(S_size);
+    host_vector<R>   hS1(S_size);
+    host_vector<T>   hU(U_size);
+    host_vector<T>   hU1(U_size);
+    host_vector<T>   hV(V_size);
+    host_vector<T>   hV1(V_size);
+    host_vector<int> hInfo(1);
+    host_vector<int> hInfo1(1);
+
+    device_vector<T>   dA(A_size);
+    device_vector<R>   dS(S_size);
+    device_vector<T>   dU(U_size);
+    device_vector<T>   dV(V_size);
+    device_vector<R>   dResidual(1);
+    device_vector<int> dSweeps(1);
+    device_vector<int> dInfo(1);
+
+    double             gpu_time_used, hipblas_error, svd_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU. hA0 keeps it for the reconstruction residual, gesvdj destroys A.
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+    hA0 = hA;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGesvdjFn(handle,
+                                            jobu,
+                                            jobv,
+                                            M,
+                                            N,
+                                            dA,
+                                            lda,
+                                            abstol,
+                                            dResidual,
+                                            maxSweeps,
+                                            dSweeps,
+                                            dS,
+                                            dU,
+                                            ldu,
+                                            dV,
+                                            ldv,
+                                            dInfo));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hS1, dS, S_size * sizeof(R), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hU1, dU, U_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hV1, dV, V_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo1.data(), dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        hInfo[0] = ref_gesvd(
+            arg.jobu, arg.jobv, M, N, hA.data(), lda, hS.data(), hU.data(), ldu, hV.data(), ldv);
+        if(jobu != HIPBLAS_SVD_MODE_NOVECTOR && jobv != HIPBLAS_SVD_MODE_NOVECTOR)
+            svd_error = norm_check_svd(
+                M, N, hA0.data(), lda, hS1.data(), hU1.data(), ldu, hV1.data(), ldv);
+
+        hipblas_error = norm_check_general<R>('F', 1, K, 1, hS, hS1);
+        if(arg.unit_check)
+        {
+            R      eps       = std::numeric_limits<R>::epsilon();
+            double tolerance = eps * 100 * std::max(1, std::max(M, N));
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_error(svd_error, tolerance);
+            unit_check_general(1, 1, 1, hInfo.data(), hInfo1.data());
+        }
+        hipblas_error = std::max(hipblas_error, svd_error);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvdjFn(handle,
+                                                jobu,
+                                                jobv,
+                                                M,
+                                                N,
+                                                dA,
+                                                lda,
+                                                abstol,
+                                                dResidual,
+                                                maxSweeps,
+                                                dSweeps,
+                                                dS,
+                                                dU,
+                                                ldu,
+                                                dV,
+                                                ldv,
+                                                dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvdjModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         gesvd_gflop_count<T>(arg.jobu, arg.jobv, M, N),
+                                         ArgumentLogging::NA_value,
+                                         hipblas_error);
+    }
+}
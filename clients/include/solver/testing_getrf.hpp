@@ -35,12 +35,9 @@ inline void testname_getrf(const Arguments& arg, std::string& name)
     hipblasGetrfModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void testing_getrf_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_getrf_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrfFn = FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
-
     hipblasLocalHandle handle(arg);
     int64_t            N         = 101;
     int64_t            M         = N;
@@ -48,37 +45,45 @@ void testing_getrf_bad_arg(const Arguments& arg)
     int64_t            A_size    = N * lda;
     int64_t            Ipiv_size = std::min(M, N);
 
-    device_vector<T>   dA(A_size);
-    device_vector<int> dIpiv(Ipiv_size);
-    device_vector<int> dInfo(1);
+    device_vector<T> dA(A_size);
+    device_vector<I> dIpiv(Ipiv_size);
+    device_vector<I> dInfo(1);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(nullptr, N, dA, lda, dIpiv, dInfo),
-                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(func(nullptr, N, dA, lda, dIpiv, dInfo), HIPBLAS_STATUS_NOT_INITIALIZED);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, -1, dA, lda, dIpiv, dInfo),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, -1, dA, lda, dIpiv, dInfo), HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, N, dA, N - 1, dIpiv, dInfo),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, N, dA, N - 1, dIpiv, dInfo), HIPBLAS_STATUS_INVALID_VALUE);
 
     // If N == 0, A and ipiv can be nullptr
-    CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, 0, nullptr, lda, nullptr, dInfo));
+    CHECK_HIPBLAS_ERROR(func(handle, 0, nullptr, lda, nullptr, dInfo));
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, N, nullptr, lda, dIpiv, dInfo),
+        EXPECT_HIPBLAS_STATUS(func(handle, N, nullptr, lda, dIpiv, dInfo),
                               HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, N, dA, lda, dIpiv, nullptr),
+        EXPECT_HIPBLAS_STATUS(func(handle, N, dA, lda, dIpiv, nullptr),
                               HIPBLAS_STATUS_INVALID_VALUE);
     }
 }
 
 template <typename T>
-void testing_getrf(const Arguments& arg)
+void testing_getrf_bad_arg(const Arguments& arg)
 {
-    using U             = real_t<T>;
-    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrfFn = FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
+    auto hipblasGetrfFn = arg.api == FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
+    auto hipblasGetrfFn_64
+        = arg.api == FORTRAN_64 ? hipblasGetrf_64<T, true> : hipblasGetrf_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_bad_arg_template<T, int64_t>(arg, hipblasGetrfFn_64);
+    else
+        testing_getrf_bad_arg_template<T, int>(arg, hipblasGetrfFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_getrf_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int M   = arg.N;
     int N   = arg.N;
@@ -97,13 +102,13 @@ void testing_getrf(const Arguments& arg)
     host_vector<T>   hA(A_size);
     host_vector<T>   hA1(A_size);
     host_vector<int> hIpiv(Ipiv_size);
-    host_vector<int> hIpiv1(Ipiv_size);
+    host_vector<I>   hIpiv1(Ipiv_size);
     host_vector<int> hInfo(1);
-    host_vector<int> hInfo1(1);
+    host_vector<I>   hInfo1(1);
 
-    device_vector<T>   dA(A_size);
-    device_vector<int> dIpiv(Ipiv_size);
-    device_vector<int> dInfo(1);
+    device_vector<T> dA(A_size);
+    device_vector<I> dIpiv(Ipiv_size);
+    device_vector<I> dInfo(1);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -126,20 +131,20 @@ void testing_getrf(const Arguments& arg)
 
     // Copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
-    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(I)));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(I)));
 
     if(arg.unit_check || arg.norm_check)
     {
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, N, dA, lda, dIpiv, dInfo));
+        CHECK_HIPBLAS_ERROR(func(handle, N, dA, lda, dIpiv, dInfo));
 
         // Copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hA1, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hIpiv1, dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hInfo1, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hIpiv1, dIpiv, Ipiv_size * sizeof(I), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo1, dInfo, sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -167,7 +172,7 @@ void testing_getrf(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, N, dA, lda, dIpiv, dInfo));
+            CHECK_HIPBLAS_ERROR(func(handle, N, dA, lda, dIpiv, dInfo));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -179,3 +184,16 @@ void testing_getrf(const Arguments& arg)
                                         hipblas_error);
     }
 }
+
+template <typename T>
+void testing_getrf(const Arguments& arg)
+{
+    auto hipblasGetrfFn = arg.api == FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
+    auto hipblasGetrfFn_64
+        = arg.api == FORTRAN_64 ? hipblasGetrf_64<T, true> : hipblasGetrf_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_template<T, int64_t>(arg, hipblasGetrfFn_64);
+    else
+        testing_getrf_template<T, int>(arg, hipblasGetrfFn);
+}
@@ -35,13 +35,9 @@ inline void testname_getrf_batched(const Arguments& arg, std::string& name)
     hipblasGetrfBatchedModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void testing_getrf_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_getrf_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrfBatchedFn
-        = FORTRAN ? hipblasGetrfBatched<T, true> : hipblasGetrfBatched<T, false>;
-
     hipblasLocalHandle handle(arg);
     int64_t            N           = 101;
     int64_t            M           = N;
@@ -51,47 +47,52 @@ void testing_getrf_batched_bad_arg(const Arguments& arg)
     int64_t            Ipiv_size   = std::min(M, N) * batch_count;
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
-    device_vector<int>     dIpiv(Ipiv_size);
-    device_vector<int>     dInfo(batch_count);
+    device_vector<I>       dIpiv(Ipiv_size);
+    device_vector<I>       dInfo(batch_count);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrfBatchedFn(nullptr, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count),
-        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(func(nullptr, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrfBatchedFn(handle, -1, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, -1, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrfBatchedFn(handle, N, dA.ptr_on_device(), N - 1, dIpiv, dInfo, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, N, dA.ptr_on_device(), N - 1, dIpiv, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrfBatchedFn(handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, -1),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
 
     // If N == 0, A and ipiv can be nullptr. rocSolver doesn't allow nullptr with batch_count == 0
-    CHECK_HIPBLAS_ERROR(
-        hipblasGetrfBatchedFn(handle, 0, nullptr, lda, nullptr, dInfo, batch_count));
+    CHECK_HIPBLAS_ERROR(func(handle, 0, nullptr, lda, nullptr, dInfo, batch_count));
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGetrfBatchedFn(handle, N, nullptr, lda, dIpiv, dInfo, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(
-            hipblasGetrfBatchedFn(handle, N, dA.ptr_on_device(), lda, dIpiv, nullptr, batch_count),
-            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(func(handle, N, nullptr, lda, dIpiv, dInfo, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(func(handle, N, dA.ptr_on_device(), lda, dIpiv, nullptr, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
     }
 }
 
 template <typename T>
-void testing_getrf_batched(const Arguments& arg)
+void testing_getrf_batched_bad_arg(const Arguments& arg)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGetrfBatchedFn
-        = FORTRAN ? hipblasGetrfBatched<T, true> : hipblasGetrfBatched<T, false>;
+        = arg.api == FORTRAN ? hipblasGetrfBatched<T, true> : hipblasGetrfBatched<T, false>;
+    auto hipblasGetrfBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasGetrfBatched_64<T, true>
+                                        : hipblasGetrfBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_batched_bad_arg_template<T, int64_t>(arg, hipblasGetrfBatchedFn_64);
+    else
+        testing_getrf_batched_bad_arg_template<T, int>(arg, hipblasGetrfBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_getrf_batched_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int M           = arg.N;
     int N           = arg.N;
@@ -116,13 +117,13 @@ void testing_getrf_batched(const Arguments& arg)
     host_batch_vector<T> hA(A_size, 1, batch_count);
     host_batch_vector<T> hA1(A_size, 1, batch_count);
     host_vector<int>     hIpiv(Ipiv_size);
-    host_vector<int>     hIpiv1(Ipiv_size);
+    host_vector<I>       hIpiv1(Ipiv_size);
     host_vector<int>     hInfo(batch_count);
-    host_vector<int>     hInfo1(batch_count);
+    host_vector<I>       hInfo1(batch_count);
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
-    device_vector<int>     dIpiv(Ipiv_size);
-    device_vector<int>     dInfo(batch_count);
+    device_vector<I>       dIpiv(Ipiv_size);
+    device_vector<I>       dInfo(batch_count);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -145,23 +146,22 @@ void testing_getrf_batched(const Arguments& arg)
     }
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
-    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(I)));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(I)));
 
     if(arg.unit_check || arg.norm_check)
     {
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(
-            hipblasGetrfBatchedFn(handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count));
+        CHECK_HIPBLAS_ERROR(func(handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count));
 
         // Copy output from device to CPU
         CHECK_HIP_ERROR(hA1.transfer_from(dA));
         CHECK_HIP_ERROR(
-            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(I), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(
-            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -192,8 +192,8 @@ void testing_getrf_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGetrfBatchedFn(
-                handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count));
+            CHECK_HIPBLAS_ERROR(
+                func(handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -205,3 +205,18 @@ void testing_getrf_batched(const Arguments& arg)
                                                hipblas_error);
     }
 }
+
+template <typename T>
+void testing_getrf_batched(const Arguments& arg)
+{
+    auto hipblasGetrfBatchedFn
+        = arg.api == FORTRAN ? hipblasGetrfBatched<T, true> : hipblasGetrfBatched<T, false>;
+    auto hipblasGetrfBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasGetrfBatched_64<T, true>
+                                        : hipblasGetrfBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_batched_template<T, int64_t>(arg, hipblasGetrfBatchedFn_64);
+    else
+        testing_getrf_batched_template<T, int>(arg, hipblasGetrfBatchedFn);
+}
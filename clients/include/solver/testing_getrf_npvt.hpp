@@ -35,45 +35,51 @@ inline void testname_getrf_npvt(const Arguments& arg, std::string& name)
     hipblasGetrfNpvtModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void testing_getrf_npvt_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_getrf_npvt_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrfFn = FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
-
     hipblasLocalHandle handle(arg);
     int64_t            N      = 101;
     int64_t            M      = N;
     int64_t            lda    = 102;
     int64_t            A_size = N * lda;
 
-    device_vector<T>   dA(A_size);
-    device_vector<int> dInfo(1);
+    device_vector<T> dA(A_size);
+    device_vector<I> dInfo(1);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(nullptr, N, dA, lda, nullptr, dInfo),
+    EXPECT_HIPBLAS_STATUS(func(nullptr, N, dA, lda, nullptr, dInfo),
                           HIPBLAS_STATUS_NOT_INITIALIZED);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, -1, dA, lda, nullptr, dInfo),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, -1, dA, lda, nullptr, dInfo), HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, N, dA, N - 1, nullptr, dInfo),
-                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, N, dA, N - 1, nullptr, dInfo), HIPBLAS_STATUS_INVALID_VALUE);
 
     if(arg.bad_arg_all)
     {
-        EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, N, nullptr, lda, nullptr, dInfo),
+        EXPECT_HIPBLAS_STATUS(func(handle, N, nullptr, lda, nullptr, dInfo),
                               HIPBLAS_STATUS_INVALID_VALUE);
-        EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle, N, dA, lda, nullptr, nullptr),
+        EXPECT_HIPBLAS_STATUS(func(handle, N, dA, lda, nullptr, nullptr),
                               HIPBLAS_STATUS_INVALID_VALUE);
     }
 }
 
 template <typename T>
-void testing_getrf_npvt(const Arguments& arg)
+void testing_getrf_npvt_bad_arg(const Arguments& arg)
 {
-    using U             = real_t<T>;
-    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrfFn = FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
+    auto hipblasGetrfFn = arg.api == FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
+    auto hipblasGetrfFn_64
+        = arg.api == FORTRAN_64 ? hipblasGetrf_64<T, true> : hipblasGetrf_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_npvt_bad_arg_template<T, int64_t>(arg, hipblasGetrfFn_64);
+    else
+        testing_getrf_npvt_bad_arg_template<T, int>(arg, hipblasGetrfFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_getrf_npvt_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int M   = arg.N;
     int N   = arg.N;
@@ -93,10 +99,10 @@ void testing_getrf_npvt(const Arguments& arg)
     host_vector<T>   hA1(A_size);
     host_vector<int> hIpiv(Ipiv_size);
     host_vector<int> hInfo(1);
-    host_vector<int> hInfo1(1);
+    host_vector<I>   hInfo1(1);
 
-    device_vector<T>   dA(A_size);
-    device_vector<int> dInfo(1);
+    device_vector<T> dA(A_size);
+    device_vector<I> dInfo(1);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -119,18 +125,18 @@ void testing_getrf_npvt(const Arguments& arg)
 
     // Copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(I)));
 
     if(arg.unit_check || arg.norm_check)
     {
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, N, dA, lda, nullptr, dInfo));
+        CHECK_HIPBLAS_ERROR(func(handle, N, dA, lda, nullptr, dInfo));
 
         // Copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hA1.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hInfo1.data(), dInfo, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo1.data(), dInfo, sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -158,7 +164,7 @@ void testing_getrf_npvt(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, N, dA, lda, nullptr, dInfo));
+            CHECK_HIPBLAS_ERROR(func(handle, N, dA, lda, nullptr, dInfo));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -170,3 +176,16 @@ void testing_getrf_npvt(const Arguments& arg)
                                             hipblas_error);
     }
 }
+
+template <typename T>
+void testing_getrf_npvt(const Arguments& arg)
+{
+    auto hipblasGetrfFn = arg.api == FORTRAN ? hipblasGetrf<T, true> : hipblasGetrf<T, false>;
+    auto hipblasGetrfFn_64
+        = arg.api == FORTRAN_64 ? hipblasGetrf_64<T, true> : hipblasGetrf_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_npvt_template<T, int64_t>(arg, hipblasGetrfFn_64);
+    else
+        testing_getrf_npvt_template<T, int>(arg, hipblasGetrfFn);
+}
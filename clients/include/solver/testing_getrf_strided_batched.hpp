@@ -36,13 +36,9 @@ inline void testname_getrf_strided_batched(const Arguments& arg, std::string& na
     hipblasGetrfStridedBatchedModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void testing_getrf_strided_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_getrf_strided_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrfStridedBatchedFn
-        = FORTRAN ? hipblasGetrfStridedBatched<T, true> : hipblasGetrfStridedBatched<T, false>;
-
     hipblasLocalHandle handle(arg);
     int64_t            N           = 101;
     int64_t            M           = N;
@@ -51,50 +47,58 @@ void testing_getrf_strided_batched_bad_arg(const Arguments& arg)
     hipblasStride      strideA     = N * lda;
     hipblasStride      strideP     = std::min(M, N);
 
-    device_vector<T>   dA(strideA * batch_count);
-    device_vector<int> dIpiv(strideP * batch_count);
-    device_vector<int> dInfo(batch_count);
+    device_vector<T> dA(strideA * batch_count);
+    device_vector<I> dIpiv(strideP * batch_count);
+    device_vector<I> dInfo(batch_count);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfStridedBatchedFn(
-                              nullptr, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count),
+    EXPECT_HIPBLAS_STATUS(func(nullptr, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count),
                           HIPBLAS_STATUS_NOT_INITIALIZED);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfStridedBatchedFn(
-                              handle, -1, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle, -1, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrfStridedBatchedFn(
-                              handle, N, dA, N - 1, strideA, dIpiv, strideP, dInfo, batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle, N, dA, N - 1, strideA, dIpiv, strideP, dInfo, batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrfStridedBatchedFn(handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, -1),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
 
     // If N == 0 || batch_count == 0, A and ipiv can be nullptr. rocSolver doesn't allow nullptr with batch_count == 0
-    CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
-        handle, 0, nullptr, lda, strideA, nullptr, strideP, dInfo, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        func(handle, 0, nullptr, lda, strideA, nullptr, strideP, dInfo, batch_count));
 
     if(arg.bad_arg_all)
     {
         EXPECT_HIPBLAS_STATUS(
-            hipblasGetrfStridedBatchedFn(
-                handle, N, nullptr, lda, strideA, dIpiv, strideP, dInfo, batch_count),
+            func(handle, N, nullptr, lda, strideA, dIpiv, strideP, dInfo, batch_count),
             HIPBLAS_STATUS_INVALID_VALUE);
         EXPECT_HIPBLAS_STATUS(
-            hipblasGetrfStridedBatchedFn(
-                handle, N, dA, lda, strideA, dIpiv, strideP, nullptr, batch_count),
+            func(handle, N, dA, lda, strideA, dIpiv, strideP, nullptr, batch_count),
             HIPBLAS_STATUS_INVALID_VALUE);
     }
 }
 
 template <typename T>
-void testing_getrf_strided_batched(const Arguments& arg)
+void testing_getrf_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGetrfStridedBatchedFn = arg.api == FORTRAN
+                                            ? hipblasGetrfStridedBatched<T, true>
+                                            : hipblasGetrfStridedBatched<T, false>;
+    auto hipblasGetrfStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasGetrfStridedBatched_64<T, true>
+                                               : hipblasGetrfStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_strided_batched_bad_arg_template<T, int64_t>(arg,
+                                                                   hipblasGetrfStridedBatchedFn_64);
+    else
+        testing_getrf_strided_batched_bad_arg_template<T, int>(arg, hipblasGetrfStridedBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_getrf_strided_batched_template(const Arguments& arg, FUNC func)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrfStridedBatchedFn
-        = FORTRAN ? hipblasGetrfStridedBatched<T, true> : hipblasGetrfStridedBatched<T, false>;
+    using U = real_t<T>;
 
     int    M            = arg.N;
     int    N            = arg.N;
@@ -121,13 +125,13 @@ void testing_getrf_strided_batched(const Arguments& arg)
     host_vector<T>   hA(A_size);
     host_vector<T>   hA1(A_size);
     host_vector<int> hIpiv(Ipiv_size);
-    host_vector<int> hIpiv1(Ipiv_size);
+    host_vector<I>   hIpiv1(Ipiv_size);
     host_vector<int> hInfo(batch_count);
-    host_vector<int> hInfo1(batch_count);
+    host_vector<I>   hInfo1(batch_count);
 
-    device_vector<T>   dA(A_size);
-    device_vector<int> dIpiv(Ipiv_size);
-    device_vector<int> dInfo(batch_count);
+    device_vector<T> dA(A_size);
+    device_vector<I> dIpiv(Ipiv_size);
+    device_vector<I> dInfo(batch_count);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -155,23 +159,22 @@ void testing_getrf_strided_batched(const Arguments& arg)
 
     // Copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
-    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(I)));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(I)));
 
     if(arg.unit_check || arg.norm_check)
     {
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
-            handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
+        CHECK_HIPBLAS_ERROR(func(handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
 
         // Copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hA1.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(
-            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(I), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(
-            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -203,8 +206,8 @@ void testing_getrf_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
-                handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
+            CHECK_HIPBLAS_ERROR(
+                func(handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -216,3 +219,19 @@ void testing_getrf_strided_batched(const Arguments& arg)
                                                       hipblas_error);
     }
 }
+
+template <typename T>
+void testing_getrf_strided_batched(const Arguments& arg)
+{
+    auto hipblasGetrfStridedBatchedFn = arg.api == FORTRAN
+                                            ? hipblasGetrfStridedBatched<T, true>
+                                            : hipblasGetrfStridedBatched<T, false>;
+    auto hipblasGetrfStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasGetrfStridedBatched_64<T, true>
+                                               : hipblasGetrfStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrf_strided_batched_template<T, int64_t>(arg, hipblasGetrfStridedBatchedFn_64);
+    else
+        testing_getrf_strided_batched_template<T, int>(arg, hipblasGetrfStridedBatchedFn);
+}
@@ -36,17 +36,17 @@ inline void testname_getrs(const Arguments& arg, std::string& name)
     hipblasGetrsModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void setup_getrs_testing(host_vector<T>&     hA,
-                         host_vector<T>&     hB,
-                         host_vector<T>&     hX,
-                         host_vector<int>&   hIpiv,
-                         device_vector<T>&   dA,
-                         device_vector<T>&   dB,
-                         device_vector<int>& dIpiv,
-                         int                 N,
-                         int                 lda,
-                         int                 ldb)
+template <typename T, typename I>
+void setup_getrs_testing(host_vector<T>&   hA,
+                         host_vector<T>&   hB,
+                         host_vector<T>&   hX,
+                         host_vector<int>& hIpiv,
+                         device_vector<T>& dA,
+                         device_vector<T>& dB,
+                         device_vector<I>& dIpiv,
+                         int               N,
+                         int               lda,
+                         int               ldb)
 {
     const size_t A_size    = size_t(N) * lda;
     const size_t B_size    = ldb;
@@ -82,18 +82,19 @@ void setup_getrs_testing(host_vector<T>&     hA,
         unit_check_general(1, 1, 1, &expectedInfo, &info);
     }
 
-    // Copy data from CPU to device
+    // Copy data from CPU to device, with the pivots in the index type of the interface
+    host_vector<I> hIpivI(Ipiv_size);
+    for(size_t i = 0; i < Ipiv_size; i++)
+        hIpivI[i] = hIpiv[i];
+
     CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv, Ipiv_size * sizeof(int), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpivI, Ipiv_size * sizeof(I), hipMemcpyHostToDevice));
 }
 
-template <typename T>
-void testing_getrs_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_getrs_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGetrsFn
-        = arg.api == hipblas_client_api::FORTRAN ? hipblasGetrs<T, true> : hipblasGetrs<T, false>;
-
     hipblasLocalHandle handle(arg);
     const int          N         = 100;
     const int          nrhs      = 1;
@@ -110,74 +111,84 @@ void testing_getrs_bad_arg(const Arguments& arg)
     host_vector<T>   hX(B_size);
     host_vector<int> hIpiv(Ipiv_size);
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dIpiv(Ipiv_size);
-    int                info = 0;
-    int                expectedInfo;
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dIpiv(Ipiv_size);
+    I                info = 0;
+    I                expectedInfo;
 
     // Need initialization code because even with bad params we call roc/cu-solver
     // so want to give reasonable data
     setup_getrs_testing(hA, hB, hX, hIpiv, dA, dB, dIpiv, N, lda, ldb);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr),
                           HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, -1, nrhs, dA, lda, dIpiv, dB, ldb, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, -1, nrhs, dA, lda, dIpiv, dB, ldb, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, -1, dA, lda, dIpiv, dB, ldb, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, -1, dA, lda, dIpiv, dB, ldb, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, nullptr, lda, dIpiv, dB, ldb, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, nrhs, nullptr, lda, dIpiv, dB, ldb, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, N - 1, dIpiv, dB, ldb, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, nrhs, dA, N - 1, dIpiv, dB, ldb, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -5;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, nullptr, dB, ldb, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, nrhs, dA, lda, nullptr, dB, ldb, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -6;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, dIpiv, nullptr, ldb, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, nrhs, dA, lda, dIpiv, nullptr, ldb, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -7;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, dIpiv, dB, N - 1, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, nrhs, dA, lda, dIpiv, dB, N - 1, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -8;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If N == 0, A, B, and ipiv can be nullptr
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsFn(handle, op, 0, nrhs, nullptr, lda, nullptr, nullptr, ldb, &info),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, op, 0, nrhs, nullptr, lda, nullptr, nullptr, ldb, &info),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // if nrhs == 0, B can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, 0, dA, lda, dIpiv, nullptr, ldb, &info),
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, 0, dA, lda, dIpiv, nullptr, ldb, &info),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 }
 
 template <typename T>
-void testing_getrs(const Arguments& arg)
+void testing_getrs_bad_arg(const Arguments& arg)
 {
-    using U             = real_t<T>;
-    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrsFn = FORTRAN ? hipblasGetrs<T, true> : hipblasGetrs<T, false>;
+    auto hipblasGetrsFn = arg.api == FORTRAN ? hipblasGetrs<T, true> : hipblasGetrs<T, false>;
+    auto hipblasGetrsFn_64
+        = arg.api == FORTRAN_64 ? hipblasGetrs_64<T, true> : hipblasGetrs_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrs_bad_arg_template<T, int64_t>(arg, hipblasGetrsFn_64);
+    else
+        testing_getrs_bad_arg_template<T, int>(arg, hipblasGetrsFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_getrs_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int N   = arg.N;
     int lda = arg.lda;
@@ -199,12 +210,12 @@ void testing_getrs(const Arguments& arg)
     host_vector<T>   hB(B_size);
     host_vector<T>   hB1(B_size);
     host_vector<int> hIpiv(Ipiv_size);
-    host_vector<int> hIpiv1(Ipiv_size);
-    int              info;
+    host_vector<I>   hIpiv1(Ipiv_size);
+    I                info;
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dIpiv(Ipiv_size);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -217,11 +228,11 @@ void testing_getrs(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGetrsFn(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info));
+        CHECK_HIPBLAS_ERROR(func(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hB1, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hIpiv1, dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hIpiv1, dIpiv, Ipiv_size * sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -234,7 +245,7 @@ void testing_getrs(const Arguments& arg)
         {
             U      eps       = std::numeric_limits<U>::epsilon();
             double tolerance = N * eps * 100;
-            int    zero      = 0;
+            I      zero      = 0;
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info);
@@ -252,7 +263,7 @@ void testing_getrs(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGetrsFn(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info));
+            CHECK_HIPBLAS_ERROR(func(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -264,3 +275,16 @@ void testing_getrs(const Arguments& arg)
                                         hipblas_error);
     }
 }
+
+template <typename T>
+void testing_getrs(const Arguments& arg)
+{
+    auto hipblasGetrsFn = arg.api == FORTRAN ? hipblasGetrs<T, true> : hipblasGetrs<T, false>;
+    auto hipblasGetrsFn_64
+        = arg.api == FORTRAN_64 ? hipblasGetrs_64<T, true> : hipblasGetrs_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrs_template<T, int64_t>(arg, hipblasGetrsFn_64);
+    else
+        testing_getrs_template<T, int>(arg, hipblasGetrsFn);
+}
@@ -35,14 +35,14 @@ inline void testname_getrs_batched(const Arguments& arg, std::string& name)
     hipblasGetrsBatchedModel{}.test_name(arg, name);
 }
 
-template <typename T>
+template <typename T, typename I>
 void setup_getrs_batched_testing(host_batch_vector<T>&   hA,
                                  host_batch_vector<T>&   hB,
                                  host_batch_vector<T>&   hX,
                                  host_vector<int>&       hIpiv,
                                  device_batch_vector<T>& dA,
                                  device_batch_vector<T>& dB,
-                                 device_vector<int>&     dIpiv,
+                                 device_vector<I>&       dIpiv,
                                  int                     N,
                                  int                     lda,
                                  int                     ldb,
@@ -85,18 +85,19 @@ void setup_getrs_batched_testing(host_batch_vector<T>&   hA,
         }
     }
 
+    // Copy the pivots in the index type of the interface
+    host_vector<I> hIpivI(Ipiv_size);
+    for(size_t i = 0; i < Ipiv_size; i++)
+        hIpivI[i] = hIpiv[i];
+
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv.data(), Ipiv_size * sizeof(int), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpivI.data(), Ipiv_size * sizeof(I), hipMemcpyHostToDevice));
 }
 
-template <typename T>
-void testing_getrs_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_getrs_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGetrsBatchedFn = arg.api == hipblas_client_api::FORTRAN
-                                     ? hipblasGetrsBatched<T, true>
-                                     : hipblasGetrsBatched<T, false>;
-
     hipblasLocalHandle handle(arg);
     const int          N           = 100;
     const int          nrhs        = 1;
@@ -117,9 +118,9 @@ void testing_getrs_batched_bad_arg(const Arguments& arg)
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
     device_batch_vector<T> dB(B_size, 1, batch_count);
-    device_vector<int>     dIpiv(Ipiv_size);
-    int                    info         = 0;
-    int                    expectedInfo = 0;
+    device_vector<I>       dIpiv(Ipiv_size);
+    I                      info         = 0;
+    I                      expectedInfo = 0;
 
     T* const* dAp = dA.ptr_on_device();
     T* const* dBp = dB.ptr_on_device();
@@ -129,51 +130,46 @@ void testing_getrs_batched_bad_arg(const Arguments& arg)
 
     setup_getrs_batched_testing(hA, hB, hX, hIpiv, dA, dB, dIpiv, N, lda, ldb, batch_count);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, -1, nrhs, dAp, lda, dIpiv, dBp, ldb, &info, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, op, -1, nrhs, dAp, lda, dIpiv, dBp, ldb, &info, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, N, -1, dAp, lda, dIpiv, dBp, ldb, &info, batch_count),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, -1, dAp, lda, dIpiv, dBp, ldb, &info, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, N, nrhs, dAp, N - 1, dIpiv, dBp, ldb, &info, batch_count),
+        func(handle, op, N, nrhs, dAp, N - 1, dIpiv, dBp, ldb, &info, batch_count),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -5;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, N, nrhs, dAp, lda, dIpiv, dBp, N - 1, &info, batch_count),
+        func(handle, op, N, nrhs, dAp, lda, dIpiv, dBp, N - 1, &info, batch_count),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -8;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // cuBLAS returns HIPBLAS_STATUS_EXECUTION_FAILED and gives info == 0
 #ifndef __HIP_PLATFORM_NVCC__
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, N, nrhs, dAp, lda, dIpiv, dBp, ldb, &info, -1),
-        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, nrhs, dAp, lda, dIpiv, dBp, ldb, &info, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -10;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 #endif
 
     // If N == 0, A, B, and ipiv can be nullptr
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(
-            handle, op, 0, nrhs, nullptr, lda, nullptr, nullptr, ldb, &info, batch_count),
+        func(handle, op, 0, nrhs, nullptr, lda, nullptr, nullptr, ldb, &info, batch_count),
         HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // if nrhs == 0, B can be nullptr
-    EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, N, 0, dAp, lda, dIpiv, nullptr, ldb, &info, batch_count),
-        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(func(handle, op, N, 0, dAp, lda, dIpiv, nullptr, ldb, &info, batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
@@ -182,25 +178,23 @@ void testing_getrs_batched_bad_arg(const Arguments& arg)
     // cuBLAS beckend doesn't check for nullptrs, including info, hipBLAS/rocSOLVER does
 #ifndef __HIP_PLATFORM_NVCC__
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, N, nrhs, dAp, lda, dIpiv, dBp, ldb, nullptr, batch_count),
+        func(handle, op, N, nrhs, dAp, lda, dIpiv, dBp, ldb, nullptr, batch_count),
         HIPBLAS_STATUS_INVALID_VALUE);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(
-            handle, op, N, nrhs, nullptr, lda, dIpiv, dBp, ldb, &info, batch_count),
+        func(handle, op, N, nrhs, nullptr, lda, dIpiv, dBp, ldb, &info, batch_count),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(handle, op, N, nrhs, dAp, lda, nullptr, dBp, ldb, &info, batch_count),
+        func(handle, op, N, nrhs, dAp, lda, nullptr, dBp, ldb, &info, batch_count),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -6;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsBatchedFn(
-            handle, op, N, nrhs, dAp, lda, dIpiv, nullptr, ldb, &info, batch_count),
+        func(handle, op, N, nrhs, dAp, lda, dIpiv, nullptr, ldb, &info, batch_count),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -7;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
@@ -208,12 +202,24 @@ void testing_getrs_batched_bad_arg(const Arguments& arg)
 }
 
 template <typename T>
-void testing_getrs_batched(const Arguments& arg)
+void testing_getrs_batched_bad_arg(const Arguments& arg)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
     auto hipblasGetrsBatchedFn
-        = FORTRAN ? hipblasGetrsBatched<T, true> : hipblasGetrsBatched<T, false>;
+        = arg.api == FORTRAN ? hipblasGetrsBatched<T, true> : hipblasGetrsBatched<T, false>;
+    auto hipblasGetrsBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasGetrsBatched_64<T, true>
+                                        : hipblasGetrsBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrs_batched_bad_arg_template<T, int64_t>(arg, hipblasGetrsBatchedFn_64);
+    else
+        testing_getrs_batched_bad_arg_template<T, int>(arg, hipblasGetrsBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_getrs_batched_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int N           = arg.N;
     int lda         = arg.lda;
@@ -241,12 +247,12 @@ void testing_getrs_batched(const Arguments& arg)
     host_batch_vector<T> hB(B_size, 1, batch_count);
     host_batch_vector<T> hB1(B_size, 1, batch_count);
     host_vector<int>     hIpiv(Ipiv_size);
-    host_vector<int>     hIpiv1(Ipiv_size);
-    int                  info;
+    host_vector<I>       hIpiv1(Ipiv_size);
+    I                    info;
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
     device_batch_vector<T> dB(B_size, 1, batch_count);
-    device_vector<int>     dIpiv(Ipiv_size);
+    device_vector<I>       dIpiv(Ipiv_size);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -259,22 +265,22 @@ void testing_getrs_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGetrsBatchedFn(handle,
-                                                  op,
-                                                  N,
-                                                  1,
-                                                  dA.ptr_on_device(),
-                                                  lda,
-                                                  dIpiv,
-                                                  dB.ptr_on_device(),
-                                                  ldb,
-                                                  &info,
-                                                  batch_count));
+        CHECK_HIPBLAS_ERROR(func(handle,
+                                 op,
+                                 N,
+                                 1,
+                                 dA.ptr_on_device(),
+                                 lda,
+                                 dIpiv,
+                                 dB.ptr_on_device(),
+                                 ldb,
+                                 &info,
+                                 batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hB1.transfer_from(dB));
         CHECK_HIP_ERROR(
-            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -290,7 +296,7 @@ void testing_getrs_batched(const Arguments& arg)
         {
             U      eps       = std::numeric_limits<U>::epsilon();
             double tolerance = N * eps * 100;
-            int    zero      = 0;
+            I      zero      = 0;
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info);
@@ -308,17 +314,17 @@ void testing_getrs_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGetrsBatchedFn(handle,
-                                                      op,
-                                                      N,
-                                                      1,
-                                                      dA.ptr_on_device(),
-                                                      lda,
-                                                      dIpiv,
-                                                      dB.ptr_on_device(),
-                                                      ldb,
-                                                      &info,
-                                                      batch_count));
+            CHECK_HIPBLAS_ERROR(func(handle,
+                                     op,
+                                     N,
+                                     1,
+                                     dA.ptr_on_device(),
+                                     lda,
+                                     dIpiv,
+                                     dB.ptr_on_device(),
+                                     ldb,
+                                     &info,
+                                     batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -330,3 +336,18 @@ void testing_getrs_batched(const Arguments& arg)
                                                hipblas_error);
     }
 }
+
+template <typename T>
+void testing_getrs_batched(const Arguments& arg)
+{
+    auto hipblasGetrsBatchedFn
+        = arg.api == FORTRAN ? hipblasGetrsBatched<T, true> : hipblasGetrsBatched<T, false>;
+    auto hipblasGetrsBatchedFn_64 = arg.api == FORTRAN_64
+                                        ? hipblasGetrsBatched_64<T, true>
+                                        : hipblasGetrsBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrs_batched_template<T, int64_t>(arg, hipblasGetrsBatchedFn_64);
+    else
+        testing_getrs_batched_template<T, int>(arg, hipblasGetrsBatchedFn);
+}
@@ -36,21 +36,21 @@ inline void testname_getrs_strided_batched(const Arguments& arg, std::string& na
     hipblasGetrsStridedBatchedModel{}.test_name(arg, name);
 }
 
-template <typename T>
-void setup_getrs_strided_batched_testing(host_vector<T>&     hA,
-                                         host_vector<T>&     hB,
-                                         host_vector<T>&     hX,
-                                         host_vector<int>&   hIpiv,
-                                         device_vector<T>&   dA,
-                                         device_vector<T>&   dB,
-                                         device_vector<int>& dIpiv,
-                                         int                 N,
-                                         int                 lda,
-                                         int                 ldb,
-                                         hipblasStride       strideA,
-                                         hipblasStride       strideB,
-                                         hipblasStride       strideP,
-                                         int                 batch_count)
+template <typename T, typename I>
+void setup_getrs_strided_batched_testing(host_vector<T>&   hA,
+                                         host_vector<T>&   hB,
+                                         host_vector<T>&   hX,
+                                         host_vector<int>& hIpiv,
+                                         device_vector<T>& dA,
+                                         device_vector<T>& dB,
+                                         device_vector<I>& dIpiv,
+                                         int               N,
+                                         int               lda,
+                                         int               ldb,
+                                         hipblasStride     strideA,
+                                         hipblasStride     strideB,
+                                         hipblasStride     strideP,
+                                         int               batch_count)
 {
     size_t A_size    = strideA * batch_count;
     size_t B_size    = strideB * batch_count;
@@ -94,19 +94,19 @@ void setup_getrs_strided_batched_testing(host_vector<T>&     hA,
         }
     }
 
-    // Copy data from CPU to device
+    // Copy data from CPU to device, with the pivots in the index type of the interface
+    host_vector<I> hIpivI(Ipiv_size);
+    for(size_t i = 0; i < Ipiv_size; i++)
+        hIpivI[i] = hIpiv[i];
+
     CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv, Ipiv_size * sizeof(int), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpivI, Ipiv_size * sizeof(I), hipMemcpyHostToDevice));
 }
 
-template <typename T>
-void testing_getrs_strided_batched_bad_arg(const Arguments& arg)
+template <typename T, typename I, typename FUNC>
+void testing_getrs_strided_batched_bad_arg_template(const Arguments& arg, FUNC func)
 {
-    auto hipblasGetrsStridedBatchedFn = arg.api == hipblas_client_api::FORTRAN
-                                            ? hipblasGetrsStridedBatched<T, true>
-                                            : hipblasGetrsStridedBatched<T, false>;
-
     hipblasLocalHandle handle(arg);
     const int          N           = 100;
     const int          nrhs        = 1;
@@ -127,11 +127,11 @@ void testing_getrs_strided_batched_bad_arg(const Arguments& arg)
     host_vector<T>   hX(B_size);
     host_vector<int> hIpiv(Ipiv_size);
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dIpiv(Ipiv_size);
-    int                info = 0;
-    int                expectedInfo;
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dIpiv(Ipiv_size);
+    I                info = 0;
+    I                expectedInfo;
 
     // Need initialization code because even with bad params we call roc/cu-solver
     // so want to give reasonable data
@@ -139,189 +139,188 @@ void testing_getrs_strided_batched_bad_arg(const Arguments& arg)
     setup_getrs_strided_batched_testing(
         hA, hB, hX, hIpiv, dA, dB, dIpiv, N, lda, ldb, strideA, strideB, strideP, batch_count);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       nrhs,
-                                                       dA,
-                                                       lda,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       dB,
-                                                       ldb,
-                                                       strideB,
-                                                       nullptr,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               dB,
+                               ldb,
+                               strideB,
+                               nullptr,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       -1,
-                                                       nrhs,
-                                                       dA,
-                                                       lda,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       dB,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               -1,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -2;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       -1,
-                                                       dA,
-                                                       lda,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       dB,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               -1,
+                               dA,
+                               lda,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -3;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       nrhs,
-                                                       nullptr,
-                                                       lda,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       dB,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               nrhs,
+                               nullptr,
+                               lda,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -4;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       nrhs,
-                                                       dA,
-                                                       N - 1,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       dB,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               nrhs,
+                               dA,
+                               N - 1,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -5;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       nrhs,
-                                                       dA,
-                                                       lda,
-                                                       strideA,
-                                                       nullptr,
-                                                       strideP,
-                                                       dB,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               nullptr,
+                               strideP,
+                               dB,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -7;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       nrhs,
-                                                       dA,
-                                                       lda,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       nullptr,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -9;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       nrhs,
-                                                       dA,
-                                                       lda,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       dB,
-                                                       N - 1,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               nrhs,
+                               dA,
+                               lda,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               dB,
+                               N - 1,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -10;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     EXPECT_HIPBLAS_STATUS(
-        hipblasGetrsStridedBatchedFn(
-            handle, op, N, nrhs, dA, lda, strideA, dIpiv, strideP, dB, ldb, strideB, &info, -1),
+        func(handle, op, N, nrhs, dA, lda, strideA, dIpiv, strideP, dB, ldb, strideB, &info, -1),
         HIPBLAS_STATUS_INVALID_VALUE);
     expectedInfo = -13;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // If N == 0, A, B, and ipiv can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       0,
-                                                       nrhs,
-                                                       nullptr,
-                                                       lda,
-                                                       strideA,
-                                                       nullptr,
-                                                       strideP,
-                                                       nullptr,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               0,
+                               nrhs,
+                               nullptr,
+                               lda,
+                               strideA,
+                               nullptr,
+                               strideP,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
 
     // if nrhs == 0, B can be nullptr
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsStridedBatchedFn(handle,
-                                                       op,
-                                                       N,
-                                                       0,
-                                                       dA,
-                                                       lda,
-                                                       strideA,
-                                                       dIpiv,
-                                                       strideP,
-                                                       nullptr,
-                                                       ldb,
-                                                       strideB,
-                                                       &info,
-                                                       batch_count),
+    EXPECT_HIPBLAS_STATUS(func(handle,
+                               op,
+                               N,
+                               0,
+                               dA,
+                               lda,
+                               strideA,
+                               dIpiv,
+                               strideP,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               &info,
+                               batch_count),
                           HIPBLAS_STATUS_SUCCESS);
     expectedInfo = 0;
     unit_check_general(1, 1, 1, &expectedInfo, &info);
@@ -330,12 +329,26 @@ void testing_getrs_strided_batched_bad_arg(const Arguments& arg)
 }
 
 template <typename T>
-void testing_getrs_strided_batched(const Arguments& arg)
+void testing_getrs_strided_batched_bad_arg(const Arguments& arg)
 {
-    using U      = real_t<T>;
-    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
-    auto hipblasGetrsStridedBatchedFn
-        = FORTRAN ? hipblasGetrsStridedBatched<T, true> : hipblasGetrsStridedBatched<T, false>;
+    auto hipblasGetrsStridedBatchedFn = arg.api == FORTRAN
+                                            ? hipblasGetrsStridedBatched<T, true>
+                                            : hipblasGetrsStridedBatched<T, false>;
+    auto hipblasGetrsStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasGetrsStridedBatched_64<T, true>
+                                               : hipblasGetrsStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrs_strided_batched_bad_arg_template<T, int64_t>(arg,
+                                                                   hipblasGetrsStridedBatchedFn_64);
+    else
+        testing_getrs_strided_batched_bad_arg_template<T, int>(arg, hipblasGetrsStridedBatchedFn);
+}
+
+template <typename T, typename I, typename FUNC>
+void testing_getrs_strided_batched_template(const Arguments& arg, FUNC func)
+{
+    using U = real_t<T>;
 
     int    N            = arg.N;
     int    lda          = arg.lda;
@@ -366,12 +379,12 @@ void testing_getrs_strided_batched(const Arguments& arg)
     host_vector<T>   hB(B_size);
     host_vector<T>   hB1(B_size);
     host_vector<int> hIpiv(Ipiv_size);
-    host_vector<int> hIpiv1(Ipiv_size);
-    int              info;
+    host_vector<I>   hIpiv1(Ipiv_size);
+    I                info;
 
-    device_vector<T>   dA(A_size);
-    device_vector<T>   dB(B_size);
-    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<I> dIpiv(Ipiv_size);
 
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
@@ -385,25 +398,25 @@ void testing_getrs_strided_batched(const Arguments& arg)
         /* =====================================================================
             HIPBLAS
         =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedFn(handle,
-                                                         op,
-                                                         N,
-                                                         1,
-                                                         dA,
-                                                         lda,
-                                                         strideA,
-                                                         dIpiv,
-                                                         strideP,
-                                                         dB,
-                                                         ldb,
-                                                         strideB,
-                                                         &info,
-                                                         batch_count));
+        CHECK_HIPBLAS_ERROR(func(handle,
+                                 op,
+                                 N,
+                                 1,
+                                 dA,
+                                 lda,
+                                 strideA,
+                                 dIpiv,
+                                 strideP,
+                                 dB,
+                                 ldb,
+                                 strideB,
+                                 &info,
+                                 batch_count));
 
         // copy output from device to CPU
         CHECK_HIP_ERROR(hipMemcpy(hB1.data(), dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(
-            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
+            hipMemcpy(hIpiv1.data(), dIpiv, Ipiv_size * sizeof(I), hipMemcpyDeviceToHost));
 
         /* =====================================================================
            CPU LAPACK
@@ -426,7 +439,7 @@ void testing_getrs_strided_batched(const Arguments& arg)
         {
             U      eps       = std::numeric_limits<U>::epsilon();
             double tolerance = N * eps * 100;
-            int    zero      = 0;
+            I      zero      = 0;
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info);
@@ -444,20 +457,20 @@ void testing_getrs_strided_batched(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedFn(handle,
-                                                             op,
-                                                             N,
-                                                             1,
-                                                             dA,
-                                                             lda,
-                                                             strideA,
-                                                             dIpiv,
-                                                             strideP,
-                                                             dB,
-                                                             ldb,
-                                                             strideB,
-                                                             &info,
-                                                             batch_count));
+            CHECK_HIPBLAS_ERROR(func(handle,
+                                     op,
+                                     N,
+                                     1,
+                                     dA,
+                                     lda,
+                                     strideA,
+                                     dIpiv,
+                                     strideP,
+                                     dB,
+                                     ldb,
+                                     strideB,
+                                     &info,
+                                     batch_count));
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
@@ -469,3 +482,19 @@ void testing_getrs_strided_batched(const Arguments& arg)
                                                       hipblas_error);
     }
 }
+
+template <typename T>
+void testing_getrs_strided_batched(const Arguments& arg)
+{
+    auto hipblasGetrsStridedBatchedFn = arg.api == FORTRAN
+                                            ? hipblasGetrsStridedBatched<T, true>
+                                            : hipblasGetrsStridedBatched<T, false>;
+    auto hipblasGetrsStridedBatchedFn_64 = arg.api == FORTRAN_64
+                                               ? hipblasGetrsStridedBatched_64<T, true>
+                                               : hipblasGetrsStridedBatched_64<T, false>;
+
+    if(arg.api & c_API_64)
+        testing_getrs_strided_batched_template<T, int64_t>(arg, hipblasGetrsStridedBatchedFn_64);
+    else
+        testing_getrs_strided_batched_template<T, int>(arg, hipblasGetrsStridedBatchedFn);
+}
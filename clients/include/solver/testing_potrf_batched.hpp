@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotrfBatchedModel = ArgumentModel<e_a_type, e_uplo, e_N, e_lda, e_batch_count>;
+
+inline void testname_potrf_batched(const Arguments& arg, std::string& name)
+{
+    hipblasPotrfBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_potrf_batched_bad_arg(const Arguments& arg)
+{
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotrfBatchedFn
+        = FORTRAN ? hipblasPotrfBatched<T, true> : hipblasPotrfBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    hipblasFillMode_t  uplo        = HIPBLAS_FILL_MODE_UPPER;
+    int64_t            N           = 101;
+    int64_t            lda         = 102;
+    int64_t            batch_count = 2;
+    int64_t            A_size      = N * lda;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrfBatchedFn(nullptr, uplo, N, dA.ptr_on_device(), lda, dInfo, batch_count),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrfBatchedFn(handle, uplo, -1, dA.ptr_on_device(), lda, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrfBatchedFn(handle, uplo, N, dA.ptr_on_device(), N - 1, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrfBatchedFn(handle, uplo, N, dA.ptr_on_device(), lda, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A can be nullptr. rocSolver doesn't allow nullptr with batch_count == 0
+    CHECK_HIPBLAS_ERROR(hipblasPotrfBatchedFn(handle, uplo, 0, nullptr, lda, dInfo, batch_count));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(
+            hipblasPotrfBatchedFn(handle, uplo, N, nullptr, lda, dInfo, batch_count),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasPotrfBatchedFn(handle, uplo, N, dA.ptr_on_device(), lda, nullptr, batch_count),
+            HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_potrf_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotrfBatchedFn
+        = FORTRAN ? hipblasPotrfBatched<T, true> : hipblasPotrfBatched<T, false>;
+
+    hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
+    int               N           = arg.N;
+    int               lda         = arg.lda;
+    int               batch_count = arg.batch_count;
+
+    size_t A_size = size_t(lda) * N;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hA1(A_size, 1, batch_count);
+    host_vector<int>     hInfo(batch_count);
+    host_vector<int>     hInfo1(batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+        hipblas_init_hpd<T>(hA[b], N, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasPotrfBatchedFn(
+            handle, uplo, N, dA.ptr_on_device(), lda, dInfo, batch_count));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            hInfo[b] = ref_potrf(arg.uplo, N, hA[b], lda);
+
+            hipblas_error = norm_check_general<T>('F', N, N, lda, hA[b], hA1[b]);
+            if(arg.unit_check)
+            {
+                U      eps       = std::numeric_limits<U>::epsilon();
+                double tolerance = eps * 2000;
+                unit_check_error(hipblas_error, tolerance);
+            }
+        }
+
+        if(arg.unit_check)
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasPotrfBatchedFn(
+                handle, uplo, N, dA.ptr_on_device(), lda, dInfo, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasPotrfBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               potrf_gflop_count<T>(N),
+                                               ArgumentLogging::NA_value,
+                                               hipblas_error);
+    }
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotriModel = ArgumentModel<e_a_type, e_uplo, e_N, e_lda>;
+
+inline void testname_potri(const Arguments& arg, std::string& name)
+{
+    hipblasPotriModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_potri_bad_arg(const Arguments& arg)
+{
+    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotriFn = FORTRAN ? hipblasPotri<T, true> : hipblasPotri<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    hipblasFillMode_t  uplo   = HIPBLAS_FILL_MODE_UPPER;
+    int64_t            N      = 101;
+    int64_t            lda    = 102;
+    int64_t            A_size = N * lda;
+
+    device_vector<T>   dA(A_size);
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotriFn(nullptr, uplo, N, dA, lda, dInfo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotriFn(handle, uplo, -1, dA, lda, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotriFn(handle, uplo, N, dA, N - 1, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasPotriFn(handle, uplo, 0, nullptr, lda, dInfo));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasPotriFn(handle, uplo, N, nullptr, lda, dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasPotriFn(handle, uplo, N, dA, lda, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_potri(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotriFn = FORTRAN ? hipblasPotri<T, true> : hipblasPotri<T, false>;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
+    int               N    = arg.N;
+    int               lda  = arg.lda;
+
+    size_t A_size = size_t(lda) * N;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hA1(A_size);
+    host_vector<int> hInfo(1);
+    host_vector<int> hInfo1(1);
+
+    device_vector<T>   dA(A_size);
+    device_vector<int> dInfo(1);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    srand(1);
+    hipblas_init_hpd<T>(hA, N, lda);
+
+    // Cholesky factorize hA on the CPU, potri takes the factor as input
+    ref_potrf(arg.uplo, N, hA.data(), lda);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasPotriFn(handle, uplo, N, dA, lda, dInfo));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hA1, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo1, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        hInfo[0] = ref_potri(arg.uplo, N, hA.data(), lda);
+
+        hipblas_error = norm_check_general<T>('F', N, N, lda, hA, hA1);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasPotriFn(handle, uplo, N, dA, lda, dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasPotriModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        potri_gflop_count<T>(N),
+                                        ArgumentLogging::NA_value,
+                                        hipblas_error);
+    }
+}
@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotriStridedBatchedModel
+    = ArgumentModel<e_a_type, e_uplo, e_N, e_lda, e_stride_scale, e_batch_count>;
+
+inline void testname_potri_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasPotriStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_potri_strided_batched_bad_arg(const Arguments& arg)
+{
+    bool FORTRAN                      = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotriStridedBatchedFn = FORTRAN ? hipblasPotriStridedBatched<T, true>
+                                                : hipblasPotriStridedBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    hipblasFillMode_t  uplo        = HIPBLAS_FILL_MODE_UPPER;
+    int64_t            N           = 101;
+    int64_t            lda         = 102;
+    int64_t            batch_count = 2;
+    hipblasStride      strideA     = N * lda;
+    int64_t            A_size      = strideA * batch_count;
+
+    device_vector<T>   dA(A_size);
+    device_vector<int> dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotriStridedBatchedFn(nullptr, uplo, N, dA, lda, strideA, dInfo, batch_count),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotriStridedBatchedFn(handle, uplo, -1, dA, lda, strideA, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotriStridedBatchedFn(handle, uplo, N, dA, N - 1, strideA, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotriStridedBatchedFn(handle, uplo, N, dA, lda, strideA, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A can be nullptr. rocSolver doesn't allow nullptr with batch_count == 0
+    CHECK_HIPBLAS_ERROR(
+        hipblasPotriStridedBatchedFn(handle, uplo, 0, nullptr, lda, strideA, dInfo, batch_count));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(
+            hipblasPotriStridedBatchedFn(
+                handle, uplo, N, nullptr, lda, strideA, dInfo, batch_count),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasPotriStridedBatchedFn(handle, uplo, N, dA, lda, strideA, nullptr, batch_count),
+            HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_potri_strided_batched(const Arguments& arg)
+{
+    using U                           = real_t<T>;
+    bool FORTRAN                      = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasPotriStridedBatchedFn = FORTRAN ? hipblasPotriStridedBatched<T, true>
+                                                : hipblasPotriStridedBatched<T, false>;
+
+    hipblasFillMode_t uplo         = char2hipblas_fill(arg.uplo);
+    int               N            = arg.N;
+    int               lda          = arg.lda;
+    double            stride_scale = arg.stride_scale;
+    int               batch_count  = arg.batch_count;
+
+    hipblasStride strideA = size_t(lda) * N * stride_scale;
+    size_t        A_size  = strideA * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hA1(A_size);
+    host_vector<int> hInfo(batch_count);
+    host_vector<int> hInfo1(batch_count);
+
+    device_vector<T>   dA(A_size);
+    device_vector<int> dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipblas_init_hpd<T>(hA.data() + b * strideA, N, lda);
+
+        // Cholesky factorize hA on the CPU, potri takes the factor as input
+        ref_potrf(arg.uplo, N, hA.data() + b * strideA, lda);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(
+            hipblasPotriStridedBatchedFn(handle, uplo, N, dA, lda, strideA, dInfo, batch_count));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hA1, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+            hInfo[b] = ref_potri(arg.uplo, N, hA.data() + b * strideA, lda);
+
+        hipblas_error = norm_check_general<T>('F', N, N, lda, strideA, hA, hA1, batch_count);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasPotriStridedBatchedFn(
+                handle, uplo, N, dA, lda, strideA, dInfo, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasPotriStridedBatchedModel{}.log_args<T>(std::cout,
+                                                      arg,
+                                                      gpu_time_used,
+                                                      potri_gflop_count<T>(N),
+                                                      ArgumentLogging::NA_value,
+                                                      hipblas_error);
+    }
+}
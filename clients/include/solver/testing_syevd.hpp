@@ -0,0 +1,202 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasSyevdModel = ArgumentModel<e_a_type, e_jobz, e_uplo, e_N, e_lda>;
+
+inline void testname_syevd(const Arguments& arg, std::string& name)
+{
+    hipblasSyevdModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_syevd_bad_arg(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasSyevdFn = FORTRAN ? hipblasSyevd<T, U, true> : hipblasSyevd<T, U, false>;
+    auto hipblasSyevdWorkspaceSizeFn
+        = FORTRAN ? hipblasSyevdWorkspaceSize<T, true> : hipblasSyevdWorkspaceSize<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    hipblasEigMode_t   jobz   = HIPBLAS_EIG_MODE_VECTOR;
+    hipblasFillMode_t  uplo   = HIPBLAS_FILL_MODE_UPPER;
+    int64_t            N      = 101;
+    int64_t            lda    = 102;
+    int64_t            A_size = N * lda;
+    size_t             workspace_size;
+
+    device_vector<T>   dA(A_size);
+    device_vector<U>   dW(N);
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSyevdFn(nullptr, jobz, uplo, N, dA, lda, dW, dInfo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdFn(handle, hipblasEigMode_t(-1), uplo, N, dA, lda, dW, dInfo),
+        HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSyevdFn(handle, jobz, uplo, -1, dA, lda, dW, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSyevdFn(handle, jobz, uplo, N, dA, N - 1, dW, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSyevdWorkspaceSizeFn(handle, jobz, uplo, N, lda, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdWorkspaceSizeFn(handle, jobz, uplo, N, N - 1, &workspace_size),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A and W can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasSyevdFn(handle, jobz, uplo, 0, nullptr, lda, nullptr, dInfo));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasSyevdFn(handle, jobz, uplo, N, nullptr, lda, dW, dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSyevdFn(handle, jobz, uplo, N, dA, lda, nullptr, dInfo),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSyevdFn(handle, jobz, uplo, N, dA, lda, dW, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_syevd(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    bool FORTRAN        = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasSyevdFn = FORTRAN ? hipblasSyevd<T, U, true> : hipblasSyevd<T, U, false>;
+    auto hipblasSyevdWorkspaceSizeFn
+        = FORTRAN ? hipblasSyevdWorkspaceSize<T, true> : hipblasSyevdWorkspaceSize<T, false>;
+
+    hipblasEigMode_t  jobz = char2hipblas_eig_mode(arg.jobz);
+    hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
+    int               N    = arg.N;
+    int               lda  = arg.lda;
+
+    size_t A_size = size_t(lda) * N;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hA0(A_size);
+    host_vector<T>   hA1(A_size);
+    host_vector<U>   hW(N);
+    host_vector<U>   hW1(N);
+    host_vector<int> hInfo(1);
+    host_vector<int> hInfo1(1);
+
+    device_vector<T>   dA(A_size);
+    device_vector<U>   dW(N);
+    device_vector<int> dInfo(1);
+
+    double             gpu_time_used, hipblas_error, eigen_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU, a Hermitian matrix. hA0 keeps it for the eigenvector residual.
+    srand(1);
+    hipblas_init_hpd<T>(hA, N, lda);
+    hA0 = hA;
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+
+    // The queried size is set as the workspace, unless the test runs with a user workspace
+    size_t workspace_size = 0;
+    CHECK_HIPBLAS_ERROR(hipblasSyevdWorkspaceSizeFn(handle, jobz, uplo, N, lda, &workspace_size));
+    device_vector<char> dWorkspace(arg.user_allocated_workspace ? 0 : workspace_size);
+    if(!arg.user_allocated_workspace && workspace_size)
+        CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, dWorkspace, workspace_size));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSyevdFn(handle, jobz, uplo, N, dA, lda, dW, dInfo));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hA1, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hW1, dW, N * sizeof(U), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo1, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        hInfo[0] = ref_syevd(arg.jobz, arg.uplo, N, hA.data(), lda, hW.data());
+
+        hipblas_error = norm_check_general<U>('F', 1, N, 1, hW, hW1);
+        if(jobz == HIPBLAS_EIG_MODE_VECTOR)
+            eigen_error = norm_check_eigen(N, hA0.data(), lda, hA1.data(), lda, hW1.data());
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 100 * std::max(1, N);
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_error(eigen_error, tolerance);
+            unit_check_general(1, 1, 1, hInfo.data(), hInfo1.data());
+        }
+        hipblas_error = std::max(hipblas_error, eigen_error);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSyevdFn(handle, jobz, uplo, N, dA, lda, dW, dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSyevdModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        syevd_gflop_count<T>(arg.jobz, N),
+                                        ArgumentLogging::NA_value,
+                                        hipblas_error);
+    }
+}
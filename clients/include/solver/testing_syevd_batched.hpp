@@ -0,0 +1,263 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasSyevdBatchedModel
+    = ArgumentModel<e_a_type, e_jobz, e_uplo, e_N, e_lda, e_batch_count>;
+
+inline void testname_syevd_batched(const Arguments& arg, std::string& name)
+{
+    hipblasSyevdBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_syevd_batched_bad_arg(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasSyevdBatchedFn
+        = FORTRAN ? hipblasSyevdBatched<T, U, true> : hipblasSyevdBatched<T, U, false>;
+    auto hipblasSyevdBatchedWorkspaceSizeFn = FORTRAN ? hipblasSyevdBatchedWorkspaceSize<T, true>
+                                                      : hipblasSyevdBatchedWorkspaceSize<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    hipblasEigMode_t   jobz        = HIPBLAS_EIG_MODE_VECTOR;
+    hipblasFillMode_t  uplo        = HIPBLAS_FILL_MODE_UPPER;
+    int64_t            N           = 101;
+    int64_t            lda         = 102;
+    int64_t            batch_count = 2;
+    hipblasStride      strideW     = N;
+    int64_t            A_size      = N * lda;
+    size_t             workspace_size;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dW(strideW * batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdBatchedFn(
+            nullptr, jobz, uplo, N, dA.ptr_on_device(), lda, dW, strideW, dInfo, batch_count),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSyevdBatchedFn(handle,
+                                                hipblasEigMode_t(-1),
+                                                uplo,
+                                                N,
+                                                dA.ptr_on_device(),
+                                                lda,
+                                                dW,
+                                                strideW,
+                                                dInfo,
+                                                batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdBatchedFn(
+            handle, jobz, uplo, -1, dA.ptr_on_device(), lda, dW, strideW, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdBatchedFn(
+            handle, jobz, uplo, N, dA.ptr_on_device(), N - 1, dW, strideW, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdBatchedFn(
+            handle, jobz, uplo, N, dA.ptr_on_device(), lda, dW, strideW, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdBatchedWorkspaceSizeFn(handle, jobz, uplo, N, lda, batch_count, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSyevdBatchedWorkspaceSizeFn(handle, jobz, uplo, N, lda, -1, &workspace_size),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A and W can be nullptr. rocSolver doesn't allow nullptr with batch_count == 0
+    CHECK_HIPBLAS_ERROR(hipblasSyevdBatchedFn(
+        handle, jobz, uplo, 0, nullptr, lda, nullptr, strideW, dInfo, batch_count));
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(
+            hipblasSyevdBatchedFn(
+                handle, jobz, uplo, N, nullptr, lda, dW, strideW, dInfo, batch_count),
+            HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSyevdBatchedFn(handle,
+                                                    jobz,
+                                                    uplo,
+                                                    N,
+                                                    dA.ptr_on_device(),
+                                                    lda,
+                                                    nullptr,
+                                                    strideW,
+                                                    dInfo,
+                                                    batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasSyevdBatchedFn(handle,
+                                                    jobz,
+                                                    uplo,
+                                                    N,
+                                                    dA.ptr_on_device(),
+                                                    lda,
+                                                    dW,
+                                                    strideW,
+                                                    nullptr,
+                                                    batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+}
+
+template <typename T>
+void testing_syevd_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.api == hipblas_client_api::FORTRAN;
+    auto hipblasSyevdBatchedFn
+        = FORTRAN ? hipblasSyevdBatched<T, U, true> : hipblasSyevdBatched<T, U, false>;
+    auto hipblasSyevdBatchedWorkspaceSizeFn = FORTRAN ? hipblasSyevdBatchedWorkspaceSize<T, true>
+                                                      : hipblasSyevdBatchedWorkspaceSize<T, false>;
+
+    hipblasEigMode_t  jobz        = char2hipblas_eig_mode(arg.jobz);
+    hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
+    int               N           = arg.N;
+    int               lda         = arg.lda;
+    int               batch_count = arg.batch_count;
+
+    size_t        A_size  = size_t(lda) * N;
+    hipblasStride strideW = N;
+    size_t        W_size  = strideW * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hA0(A_size, 1, batch_count);
+    host_batch_vector<T> hA1(A_size, 1, batch_count);
+    host_vector<U>       hW(W_size);
+    host_vector<U>       hW1(W_size);
+    host_vector<int>     hInfo(batch_count);
+    host_vector<int>     hInfo1(batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dW(W_size);
+    device_vector<int>     dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error, eigen_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU, Hermitian matrices. hA0 keeps them for the eigenvector residual.
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+        hipblas_init_hpd<T>(hA[b], N, lda);
+    hA0.copy_from(hA);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+
+    // The queried size is set as the workspace, unless the test runs with a user workspace
+    size_t workspace_size = 0;
+    CHECK_HIPBLAS_ERROR(hipblasSyevdBatchedWorkspaceSizeFn(
+        handle, jobz, uplo, N, lda, batch_count, &workspace_size));
+    device_vector<char> dWorkspace(arg.user_allocated_workspace ? 0 : workspace_size);
+    if(!arg.user_allocated_workspace && workspace_size)
+        CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, dWorkspace, workspace_size));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSyevdBatchedFn(
+            handle, jobz, uplo, N, dA.ptr_on_device(), lda, dW, strideW, dInfo, batch_count));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(hipMemcpy(hW1, dW, W_size * sizeof(U), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            hInfo[b] = ref_syevd(arg.jobz, arg.uplo, N, hA[b], lda, hW.data() + b * strideW);
+            if(jobz == HIPBLAS_EIG_MODE_VECTOR)
+                eigen_error = std::max(
+                    eigen_error,
+                    norm_check_eigen(N, hA0[b], lda, hA1[b], lda, hW1.data() + b * strideW));
+        }
+
+        hipblas_error = norm_check_general<U>('F', 1, N, 1, strideW, hW, hW1, batch_count);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 100 * std::max(1, N);
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_error(eigen_error, tolerance);
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+        }
+        hipblas_error = std::max(hipblas_error, eigen_error);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSyevdBatchedFn(
+                handle, jobz, uplo, N, dA.ptr_on_device(), lda, dW, strideW, dInfo, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSyevdBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               syevd_gflop_count<T>(arg.jobz, N),
+                                               ArgumentLogging::NA_value,
+                                               hipblas_error);
+    }
+}
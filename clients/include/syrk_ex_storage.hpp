@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstring>
+
+#include "testing_common.hpp"
+
+// hipblasCsyrkEx and hipblasCherkEx read A as HIP_C_8I, HIP_C_16F, or HIP_C_32F. The tests make A
+// in hipblasComplex, store it in the bytes of a_type, and read the stored values back so that
+// the reference computes with the values the library reads.
+inline size_t syrk_ex_type_size(hipDataType a_type)
+{
+    if(a_type == HIP_C_8I)
+        return 2 * sizeof(int8_t);
+    if(a_type == HIP_C_16F)
+        return 2 * sizeof(hipblasHalf);
+    return sizeof(hipComplex);
+}
+
+inline void syrk_ex_store(hipDataType a_type, size_t size, hipblasComplex* A, int8_t* storage)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        float re = A[i].real(), im = A[i].imag();
+        if(a_type == HIP_C_8I)
+        {
+            int8_t* p = storage + 2 * i;
+            p[0]      = int8_t(std::max(-128.0f, std::min(127.0f, re)));
+            p[1]      = int8_t(std::max(-128.0f, std::min(127.0f, im)));
+            A[i]      = hipblasComplex(p[0], p[1]);
+        }
+        else if(a_type == HIP_C_16F)
+        {
+            hipblasHalf p[2] = {float_to_half(re), float_to_half(im)};
+            memcpy(storage + i * sizeof(p), p, sizeof(p));
+            A[i] = hipblasComplex(half_to_float(p[0]), half_to_float(p[1]));
+        }
+        else
+            memcpy(storage + i * sizeof(hipComplex), &A[i], sizeof(hipComplex));
+    }
+}
@@ -244,18 +244,46 @@ auto hipblas_rot_dispatch(const Arguments& arg)
     return TEST<void>{}(arg);
 }
 
+#ifdef HIPBLAS_V2
+// gemm with FP8 inputs of type Ti accumulated in float, by the type of C
+template <template <typename...> class TEST, typename Ti>
+auto hipblas_gemm_f8_dispatch(const Arguments& arg)
+{
+    switch(arg.c_type)
+    {
+    case HIPBLAS_R_32F:
+        return TEST<Ti, float, float>{}(arg);
+    case HIPBLAS_R_16F:
+        return TEST<Ti, hipblasHalf, float>{}(arg);
+    case HIPBLAS_R_16B:
+        return TEST<Ti, hipblasBfloat16, float>{}(arg);
+    default:
+        return TEST<void>{}(arg);
+    }
+}
+#endif
+
 // gemm functions
 template <template <typename...> class TEST>
 auto hipblas_gemm_dispatch(const Arguments& arg)
 {
     const auto Ti = arg.a_type, To = arg.c_type, Tc = arg.compute_type;
 
-    if(arg.b_type == Ti && arg.d_type == To)
+    // gemm_epilogue_ex converts its result to d_type, which need not be the type of C
+    const bool d_type_free = !strncmp(arg.function, "gemm_epilogue_ex", 16);
+
+    if(arg.b_type == Ti && (arg.d_type == To || d_type_free))
     {
         if(Ti != To)
         {
             if(Ti == HIPBLAS_R_8I && To == HIPBLAS_R_32I && Tc == To)
                 return TEST<int8_t, int32_t, int32_t>{}(arg);
+#ifdef HIPBLAS_V2
+            else if(Ti == HIP_R_8F_E4M3_FNUZ && Tc == HIPBLAS_R_32F)
+                return hipblas_gemm_f8_dispatch<TEST, hipblas_f8>(arg);
+            else if(Ti == HIP_R_8F_E5M2_FNUZ && Tc == HIPBLAS_R_32F)
+                return hipblas_gemm_f8_dispatch<TEST, hipblas_bf8>(arg);
+#endif
         }
         else if(Tc != To)
         {
@@ -276,4 +304,15 @@ auto hipblas_gemm_dispatch(const Arguments& arg)
     return TEST<void>{}(arg);
 }
 
+// syrk_ex and herk_ex functions, dispatched on the type of C as A may be stored more narrowly
+template <template <typename...> class TEST>
+auto hipblas_syrk_ex_dispatch(const Arguments& arg)
+{
+    const auto Ta = arg.a_type, Tc = arg.c_type;
+    if((Ta == HIPBLAS_C_8I || Ta == HIPBLAS_C_16F || Ta == HIPBLAS_C_32F) && Tc == HIPBLAS_C_32F)
+        return TEST<hipblasComplex>{}(arg);
+
+    return TEST<void>{}(arg);
+}
+
 #endif
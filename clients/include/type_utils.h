@@ -28,6 +28,7 @@
 
 #ifdef __cplusplus
 #include "complex.hpp"
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <immintrin.h>
@@ -120,6 +121,101 @@ inline float half_to_float(hipblasHalf val)
 #endif
 }
 
+/* =============================================================================================== */
+/* FP8                                                                                             */
+// FP8 value with EXP exponent bits and 7 - EXP mantissa bits in the FNUZ encoding of
+// HIP_R_8F_E4M3_FNUZ and HIP_R_8F_E5M2_FNUZ: the exponent bias is 2^(EXP - 1), there are no
+// infinities and no negative zero, and 0x80 is the only NaN. Conversion from float rounds to
+// nearest even and saturates to the largest finite value.
+template <int EXP>
+struct hipblas_fnuz8
+{
+    static constexpr int MANT = 7 - EXP;
+    static constexpr int BIAS = 1 << (EXP - 1);
+
+    uint8_t data;
+
+    hipblas_fnuz8() = default;
+
+    hipblas_fnuz8(float f)
+    {
+        if(std::isnan(f))
+        {
+            data = 0x80;
+            return;
+        }
+
+        const uint8_t sign = std::signbit(f) ? 0x80 : 0;
+        const float   a    = std::fabs(f);
+        if(std::isinf(a))
+        {
+            data = sign | 0x7f;
+            return;
+        }
+
+        // a is rounded to a multiple of 2^(e - MANT), where 2^e <= a or e is the exponent of the
+        // subnormals
+        int e;
+        std::frexp(a, &e);
+        e        = std::max(e - 1, 1 - BIAS);
+        int mant = int(std::nearbyint(std::ldexp(a, MANT - e)));
+        if(mant == 2 << MANT)
+        {
+            mant >>= 1;
+            e++;
+        }
+
+        const int exp = mant >> MANT ? e + BIAS : 0;
+        if(!mant)
+            data = 0;
+        else if(exp >= 1 << EXP)
+            data = sign | 0x7f;
+        else
+            data = sign | uint8_t(exp << MANT) | uint8_t(mant & ((1 << MANT) - 1));
+    }
+
+    explicit operator float() const
+    {
+        if(data == 0x80)
+            return NAN;
+
+        const int   exp  = (data >> MANT) & ((1 << EXP) - 1);
+        const int   mant = data & ((1 << MANT) - 1);
+        const float v    = exp ? std::ldexp(float((1 << MANT) | mant), exp - BIAS - MANT)
+                               : std::ldexp(float(mant), 1 - BIAS - MANT);
+        return data & 0x80 ? -v : v;
+    }
+
+    hipblas_fnuz8 operator-() const
+    {
+        return hipblas_fnuz8(-float(*this));
+    }
+
+    // arithmetic is done in float, as by the matrix initialization helpers
+    friend hipblas_fnuz8 operator+(hipblas_fnuz8 a, hipblas_fnuz8 b)
+    {
+        return hipblas_fnuz8(float(a) + float(b));
+    }
+
+    friend hipblas_fnuz8 operator*(hipblas_fnuz8 a, hipblas_fnuz8 b)
+    {
+        return hipblas_fnuz8(float(a) * float(b));
+    }
+
+    hipblas_fnuz8& operator+=(hipblas_fnuz8 b)
+    {
+        return *this = *this + b;
+    }
+
+    friend bool operator==(hipblas_fnuz8 a, hipblas_fnuz8 b)
+    {
+        return float(a) == float(b);
+    }
+};
+
+using hipblas_f8  = hipblas_fnuz8<4>; // HIP_R_8F_E4M3_FNUZ
+using hipblas_bf8 = hipblas_fnuz8<5>; // HIP_R_8F_E5M2_FNUZ
+
 /* =============================================================================================== */
 /* Absolute values                                                                                 */
 // template <typename T>
@@ -147,6 +243,13 @@ inline hipblasBfloat16 hipblas_abs(hipblasBfloat16 x)
     return x;
 }
 
+template <int EXP>
+inline hipblas_fnuz8<EXP> hipblas_abs(hipblas_fnuz8<EXP> x)
+{
+    x.data &= x.data == 0x80 ? 0xff : 0x7f;
+    return x;
+}
+
 // rocblas_half
 inline hipblasHalf hipblas_abs(hipblasHalf x)
 {
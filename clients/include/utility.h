@@ -163,6 +163,15 @@ public:
         return random_nan_data<hipblasBfloat16, uint16_t, 7, 8>();
     }
 
+    // NaN FP8, which is the one encoding 0x80 in the FNUZ types
+    template <int EXP>
+    explicit operator hipblas_fnuz8<EXP>()
+    {
+        hipblas_fnuz8<EXP> x;
+        x.data = 0x80;
+        return x;
+    }
+
     // Random NaN Complex
     explicit operator hipblasComplex()
     {
@@ -587,6 +596,29 @@ void hipblas_init_hermitian(std::vector<T>& A, int64_t N, int64_t lda)
                 A[j + i * lda] = A[i + j * lda] = random_generator<T>();
 }
 
+/*! \brief  hermitian positive definite matrix initialization: */
+// the real diagonal is made strictly dominant, which keeps the matrix well conditioned for the
+// Cholesky factorization
+template <typename T>
+void hipblas_init_hpd(T* A, int64_t N, int64_t lda)
+{
+    for(int64_t j = 0; j < N; ++j)
+        for(int64_t i = 0; i < j; ++i)
+        {
+            A[i + j * lda] = random_generator<T>();
+            A[j + i * lda] = hipblas_conjugate(A[i + j * lda]);
+        }
+
+    for(int64_t i = 0; i < N; ++i)
+    {
+        double abs_sum_off_diagonal = 0;
+        for(int64_t j = 0; j < N; ++j)
+            if(j != i)
+                abs_sum_off_diagonal += hipblas_abs(A[i + j * lda]);
+        A[i + i * lda] = T(real_t<T>(abs_sum_off_diagonal + N));
+    }
+}
+
 /* ============================================================================================ */
 /*! \brief  Initialize an array with random data, with NaN where appropriate */
 
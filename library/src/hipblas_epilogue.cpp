@@ -0,0 +1,262 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "half_convert.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int      HIPBLAS_EPILOGUE_BLOCK = 256;
+    constexpr unsigned HIPBLAS_EPILOGUE_GRID  = 65535;
+
+    template <typename Tcomp>
+    __device__ inline Tcomp hipblas_epilogue_load(const void* p, hipDataType type, int64_t i)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            return Tcomp(hipblas_half_to_float(static_cast<const uint16_t*>(p)[i]));
+        case HIP_R_16BF:
+            return Tcomp(hipblas_bfloat16_to_float(static_cast<const uint16_t*>(p)[i]));
+        case HIP_R_32F:
+            return Tcomp(static_cast<const float*>(p)[i]);
+        default:
+            return Tcomp(static_cast<const double*>(p)[i]);
+        }
+    }
+
+    template <typename Tcomp>
+    __device__ inline void hipblas_epilogue_store(void* p, hipDataType type, int64_t i, Tcomp x)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            static_cast<uint16_t*>(p)[i] = hipblas_float_to_half(float(x));
+            break;
+        case HIP_R_16BF:
+            static_cast<uint16_t*>(p)[i] = hipblas_float_to_bfloat16(float(x));
+            break;
+        case HIP_R_32F:
+            static_cast<float*>(p)[i] = float(x);
+            break;
+        default:
+            static_cast<double*>(p)[i] = double(x);
+            break;
+        }
+    }
+
+    // Threads of a block take consecutive rows, the blocks along y take every gridDim.y-th
+    // column. The types are uniform over the grid, so switching on them does not diverge.
+    template <typename Tcomp>
+    __global__ void hipblas_gemm_epilogue_kernel(int               m,
+                                                 int               n,
+                                                 const void*       C,
+                                                 hipDataType       c_type,
+                                                 int64_t           ldc,
+                                                 void*             out,
+                                                 hipDataType       out_type,
+                                                 int64_t           ldout,
+                                                 hipblasEpilogue_t epilogue,
+                                                 const void*       bias,
+                                                 hipDataType       bias_type,
+                                                 const float*      row_scale,
+                                                 const float*      col_scale)
+    {
+        const int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        const Tcomp row = row_scale ? Tcomp(row_scale[i]) : Tcomp(1);
+        const Tcomp b   = bias ? hipblas_epilogue_load<Tcomp>(bias, bias_type, i) : Tcomp(0);
+        const int   act = epilogue & ~HIPBLAS_EPILOGUE_BIAS;
+
+        for(int64_t j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            Tcomp x = hipblas_epilogue_load<Tcomp>(C, c_type, i + j * ldc);
+            if(row_scale || col_scale)
+                x *= row * (col_scale ? Tcomp(col_scale[j]) : Tcomp(1));
+            x += b;
+            if(act == HIPBLAS_EPILOGUE_RELU)
+                x = x > Tcomp(0) ? x : Tcomp(0);
+            else if(act == HIPBLAS_EPILOGUE_GELU)
+                x = Tcomp(0.5) * x
+                    * (Tcomp(1)
+                       + tanh(Tcomp(0.7978845608028654) * (x + Tcomp(0.044715) * x * x * x)));
+            hipblas_epilogue_store<Tcomp>(out, out_type, i + j * ldout, x);
+        }
+    }
+
+    bool hipblas_epilogue_valid(hipblasEpilogue_t epilogue)
+    {
+        switch(epilogue)
+        {
+        case HIPBLAS_EPILOGUE_DEFAULT:
+        case HIPBLAS_EPILOGUE_RELU:
+        case HIPBLAS_EPILOGUE_BIAS:
+        case HIPBLAS_EPILOGUE_RELU_BIAS:
+        case HIPBLAS_EPILOGUE_GELU:
+        case HIPBLAS_EPILOGUE_GELU_BIAS:
+            return true;
+        }
+        return false;
+    }
+
+    bool hipblas_epilogue_type(hipDataType type)
+    {
+        return type == HIP_R_16F || type == HIP_R_16BF || type == HIP_R_32F || type == HIP_R_64F;
+    }
+}
+
+hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t              handle,
+                                          hipblasOperation_t           transA,
+                                          hipblasOperation_t           transB,
+                                          int                          m,
+                                          int                          n,
+                                          int                          k,
+                                          const void*                  alpha,
+                                          const void*                  A,
+                                          hipDataType                  aType,
+                                          int                          lda,
+                                          const void*                  B,
+                                          hipDataType                  bType,
+                                          int                          ldb,
+                                          const void*                  beta,
+                                          void*                        C,
+                                          hipDataType                  cType,
+                                          int                          ldc,
+                                          hipblasComputeType_t         computeType,
+                                          hipblasGemmAlgo_t            algo,
+                                          const hipblasGemmEpilogue_t* epilogue)
+try
+{
+    HIPBLAS_LOG(handle, transA, transB, m, n, k, alpha, A, aType, lda, B, bType, ldb, beta, C,
+                cType, ldc, computeType, algo, epilogue);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!epilogue)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasEpilogue_t act = epilogue->epilogue ? epilogue->epilogue : HIPBLAS_EPILOGUE_DEFAULT;
+    if(!hipblas_epilogue_valid(act))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    const bool  has_bias = act & HIPBLAS_EPILOGUE_BIAS;
+    void*       out      = epilogue->out ? epilogue->out : C;
+    hipDataType out_type = epilogue->out ? epilogue->outType : cType;
+    int64_t     ldout    = epilogue->out ? epilogue->ldout : ldc;
+    if(!hipblas_epilogue_type(cType) || !hipblas_epilogue_type(out_type)
+       || (has_bias && epilogue->biasType != cType && epilogue->biasType != out_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The epilogue arguments are checked before C is written
+    if(m < 0 || n < 0 || ldout < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m && n && has_bias && !epilogue->bias)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = hipblasGemmEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              aType,
+                                              lda,
+                                              B,
+                                              bType,
+                                              ldb,
+                                              beta,
+                                              C,
+                                              cType,
+                                              ldc,
+                                              computeType,
+                                              algo);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n)
+        return status;
+
+    // Nothing left to do in place
+    if(act == HIPBLAS_EPILOGUE_DEFAULT && !epilogue->rowScale && !epilogue->colScale && out == C)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t stream;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    dim3 grid((m - 1) / HIPBLAS_EPILOGUE_BLOCK + 1, std::min(unsigned(n), HIPBLAS_EPILOGUE_GRID));
+    dim3 block(HIPBLAS_EPILOGUE_BLOCK);
+
+    const void* bias      = has_bias ? epilogue->bias : nullptr;
+    const bool  is_double = cType == HIP_R_64F || out_type == HIP_R_64F
+                           || (has_bias && epilogue->biasType == HIP_R_64F);
+    if(is_double)
+        hipLaunchKernelGGL(hipblas_gemm_epilogue_kernel<double>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           C,
+                           cType,
+                           int64_t(ldc),
+                           out,
+                           out_type,
+                           ldout,
+                           act,
+                           bias,
+                           epilogue->biasType,
+                           epilogue->rowScale,
+                           epilogue->colScale);
+    else
+        hipLaunchKernelGGL(hipblas_gemm_epilogue_kernel<float>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           C,
+                           cType,
+                           int64_t(ldc),
+                           out,
+                           out_type,
+                           ldout,
+                           act,
+                           bias,
+                           epilogue->biasType,
+                           epilogue->rowScale,
+                           epilogue->colScale);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,275 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gemm_f8.hpp"
+#include "half_convert.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int      HIPBLAS_CONVERT_F8_BLOCK = 256;
+    constexpr unsigned HIPBLAS_CONVERT_F8_GRID  = 65535;
+
+    // Decodes an FNUZ FP8 value with EXP exponent bits and 7 - EXP mantissa bits. The exponent
+    // bias is 2^(EXP - 1) and 0x80, the encoding of negative zero in IEEE types, is the only NaN.
+    template <int EXP>
+    __device__ inline float hipblas_f8_to_float(uint8_t x)
+    {
+        constexpr int MANT = 7 - EXP;
+        constexpr int BIAS = 1 << (EXP - 1);
+
+        if(x == 0x80)
+            return NAN;
+
+        const int   exp  = (x >> MANT) & ((1 << EXP) - 1);
+        const int   mant = x & ((1 << MANT) - 1);
+        const float v    = exp ? ldexpf(float((1 << MANT) | mant), exp - BIAS - MANT)
+                               : ldexpf(float(mant), 1 - BIAS - MANT);
+        return x & 0x80 ? -v : v;
+    }
+
+    // Threads of a block take consecutive rows, the blocks along y every gridDim.y-th column
+    // and the blocks along z every gridDim.z-th matrix of the batch
+    template <int EXP>
+    __global__ void hipblas_convert_f8_kernel(int64_t       rows,
+                                              int64_t       cols,
+                                              const void*   A,
+                                              int64_t       lda,
+                                              hipblasStride stride_A,
+                                              bool          is_array,
+                                              bool          to_bfloat16,
+                                              uint16_t*     B,
+                                              int64_t       ldb,
+                                              hipblasStride stride_B,
+                                              int64_t       batch_count)
+    {
+        const int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const uint8_t* a = is_array ? static_cast<const uint8_t* const*>(A)[b]
+                                        : static_cast<const uint8_t*>(A) + b * stride_A;
+            uint16_t*      o = B + b * stride_B;
+            for(int64_t j = blockIdx.y; j < cols; j += gridDim.y)
+            {
+                const float x = hipblas_f8_to_float<EXP>(a[i + j * lda]);
+                // Both types hold every FP8 value exactly, so the conversions do not round
+                o[i + j * ldb]
+                    = to_bfloat16 ? hipblas_float_to_bfloat16(x) : hipblas_float_to_half(x);
+            }
+        }
+    }
+
+    __global__ void hipblas_scale_alpha_kernel(const float* alpha,
+                                               const float* scale_A,
+                                               const float* scale_B,
+                                               float*       alpha_scaled)
+    {
+        *alpha_scaled = *alpha * (scale_A ? *scale_A : 1.0f) * (scale_B ? *scale_B : 1.0f);
+    }
+
+    // The scalars of these compute types are floats
+    bool hipblas_float_scalars(hipblasComputeType_t compute_type)
+    {
+        switch(compute_type)
+        {
+        case HIPBLAS_COMPUTE_32F:
+        case HIPBLAS_COMPUTE_32F_PEDANTIC:
+        case HIPBLAS_COMPUTE_32F_FAST_16F:
+        case HIPBLAS_COMPUTE_32F_FAST_16BF:
+        case HIPBLAS_COMPUTE_32F_FAST_TF32:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
+
+hipblasStatus_t hipblasConvertF8(hipStream_t   stream,
+                                 int64_t       rows,
+                                 int64_t       cols,
+                                 hipDataType   from_type,
+                                 const void*   A,
+                                 int64_t       lda,
+                                 hipblasStride stride_A,
+                                 bool          is_array,
+                                 hipDataType   to_type,
+                                 void*         B,
+                                 int64_t       ldb,
+                                 hipblasStride stride_B,
+                                 int64_t       batch_count)
+{
+    if(!hipblas_is_f8(from_type) || (to_type != HIP_R_16F && to_type != HIP_R_16BF))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!rows || !cols || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid(unsigned((rows - 1) / HIPBLAS_CONVERT_F8_BLOCK + 1),
+              unsigned(std::min<int64_t>(cols, HIPBLAS_CONVERT_F8_GRID)),
+              unsigned(std::min<int64_t>(batch_count, HIPBLAS_CONVERT_F8_GRID)));
+    dim3 block(HIPBLAS_CONVERT_F8_BLOCK);
+
+    const bool to_bfloat16 = to_type == HIP_R_16BF;
+    if(from_type == HIP_R_8F_E4M3_FNUZ)
+        hipLaunchKernelGGL(hipblas_convert_f8_kernel<4>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           rows,
+                           cols,
+                           A,
+                           lda,
+                           stride_A,
+                           is_array,
+                           to_bfloat16,
+                           static_cast<uint16_t*>(B),
+                           ldb,
+                           stride_B,
+                           batch_count);
+    else
+        hipLaunchKernelGGL(hipblas_convert_f8_kernel<5>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           rows,
+                           cols,
+                           A,
+                           lda,
+                           stride_A,
+                           is_array,
+                           to_bfloat16,
+                           static_cast<uint16_t*>(B),
+                           ldb,
+                           stride_B,
+                           batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasGemmExWithScale(hipblasHandle_t      handle,
+                                       hipblasOperation_t   transA,
+                                       hipblasOperation_t   transB,
+                                       int                  m,
+                                       int                  n,
+                                       int                  k,
+                                       const void*          alpha,
+                                       const void*          A,
+                                       hipDataType          aType,
+                                       int                  lda,
+                                       const float*         scaleA,
+                                       const void*          B,
+                                       hipDataType          bType,
+                                       int                  ldb,
+                                       const float*         scaleB,
+                                       const void*          beta,
+                                       void*                C,
+                                       hipDataType          cType,
+                                       int                  ldc,
+                                       hipblasComputeType_t computeType,
+                                       hipblasGemmAlgo_t    algo)
+try
+{
+    HIPBLAS_LOG(handle, transA, transB, m, n, k, alpha, A, aType, lda, scaleA, B, bType, ldb,
+                scaleB, beta, C, cType, ldc, computeType, algo);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblas_float_scalars(computeType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto gemm = [&](const void* alpha_scaled) {
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha_scaled,
+                                A,
+                                aType,
+                                lda,
+                                B,
+                                bType,
+                                ldb,
+                                beta,
+                                C,
+                                cType,
+                                ldc,
+                                computeType,
+                                algo);
+    };
+
+    // Without scales, or without alpha for the gemm to reject, there is nothing to fold
+    if((!scaleA && !scaleB) || !alpha)
+        return gemm(alpha);
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The scales are folded into alpha, where they are on the host
+    if(mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        float alpha_scaled = *static_cast<const float*>(alpha) * (scaleA ? *scaleA : 1.0f)
+                             * (scaleB ? *scaleB : 1.0f);
+        return gemm(&alpha_scaled);
+    }
+
+    // and by a kernel on the stream where they are on the device, so that no synchronization
+    // with the host is needed to read them
+    hipStream_t stream;
+    if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    float* alpha_scaled;
+    if(hipMallocAsync((void**)&alpha_scaled, sizeof(float), stream) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipLaunchKernelGGL(hipblas_scale_alpha_kernel,
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       static_cast<const float*>(alpha),
+                       scaleA,
+                       scaleB,
+                       alpha_scaled);
+    status = hipGetLastError() == hipSuccess ? gemm(alpha_scaled) : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    if(hipFreeAsync(alpha_scaled, stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
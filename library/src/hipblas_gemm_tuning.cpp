@@ -0,0 +1,427 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "enum_table.hpp"
+#include "exceptions.hpp"
+#include "gemm_tuning.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr char     hipblas_gemm_tuning_magic[8] = {'H', 'I', 'P', 'B', 'L', 'A', 'S', 'T'};
+    constexpr uint32_t hipblas_gemm_tuning_version  = 1;
+
+    // A tuning file is this header followed by a hash table of capacity records, a power of 2
+    // at least twice the count so that lookups probe few records
+    struct hipblasGemmTuningHeader
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t count;
+        uint32_t record_size;
+        uint32_t reserved[2];
+    };
+
+    // A record with solution_index 0 is empty
+    struct hipblasGemmTuningRecord
+    {
+        hipblasGemmTuningKey key;
+        int32_t              solution_index;
+        int32_t              reserved;
+    };
+
+    static_assert(sizeof(hipblasGemmTuningHeader) == 32, "tuning file header is 32 bytes");
+    static_assert(sizeof(hipblasGemmTuningRecord) == 64, "tuning file records are 64 bytes");
+
+    // FNV-1a over the words of the key
+    uint64_t hipblas_gemm_tuning_hash(const hipblasGemmTuningKey& key)
+    {
+        auto*    words = reinterpret_cast<const int32_t*>(&key);
+        uint64_t hash  = 0xcbf29ce484222325;
+        for(size_t i = 0; i < sizeof(key) / sizeof(int32_t); i++)
+        {
+            hash ^= uint32_t(words[i]);
+            hash *= 0x100000001b3;
+        }
+        return hash ^ (hash >> 32);
+    }
+
+    bool operator==(const hipblasGemmTuningKey& a, const hipblasGemmTuningKey& b)
+    {
+        return !memcmp(&a, &b, sizeof(a));
+    }
+
+    // Tuning file mapped read only, or read into memory where mapping is not available
+    class hipblasGemmTuningFile
+    {
+        const hipblasGemmTuningHeader* header  = nullptr;
+        const hipblasGemmTuningRecord* records = nullptr;
+        void*                          mapped  = nullptr;
+        size_t                         size    = 0;
+        std::vector<char>              data;
+
+    public:
+        hipblasGemmTuningFile()                             = default;
+        hipblasGemmTuningFile(const hipblasGemmTuningFile&) = delete;
+        hipblasGemmTuningFile& operator=(const hipblasGemmTuningFile&) = delete;
+
+        ~hipblasGemmTuningFile()
+        {
+#ifndef _WIN32
+            if(mapped)
+                munmap(mapped, size);
+#endif
+        }
+
+        // Maps path, false if it cannot be read or is not a tuning file
+        bool open(const char* path)
+        {
+            const char* bytes = nullptr;
+#ifdef _WIN32
+            std::ifstream file(path, std::ios::binary);
+            if(!file.is_open())
+                return false;
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            size  = data.size();
+            bytes = data.data();
+#else
+            int fd = ::open(path, O_RDONLY);
+            if(fd < 0)
+                return false;
+            struct stat st;
+            if(fstat(fd, &st) || size_t(st.st_size) < sizeof(hipblasGemmTuningHeader))
+            {
+                close(fd);
+                return false;
+            }
+            size   = st.st_size;
+            mapped = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+            if(mapped == MAP_FAILED)
+            {
+                mapped = nullptr;
+                return false;
+            }
+            bytes = static_cast<const char*>(mapped);
+#endif
+            if(size < sizeof(hipblasGemmTuningHeader))
+                return false;
+
+            auto* h = reinterpret_cast<const hipblasGemmTuningHeader*>(bytes);
+            if(memcmp(h->magic, hipblas_gemm_tuning_magic, sizeof(h->magic))
+               || h->version != hipblas_gemm_tuning_version
+               || h->record_size != sizeof(hipblasGemmTuningRecord) || !h->capacity
+               || (h->capacity & (h->capacity - 1)) || h->count > h->capacity / 2
+               || size != sizeof(*h) + size_t(h->capacity) * sizeof(hipblasGemmTuningRecord))
+                return false;
+
+            header  = h;
+            records = reinterpret_cast<const hipblasGemmTuningRecord*>(h + 1);
+            return true;
+        }
+
+        // The probe visits each slot at most once, a damaged file may have no empty slot to stop it
+        int32_t find(const hipblasGemmTuningKey& key) const
+        {
+            uint32_t mask = header->capacity - 1;
+            uint32_t i    = uint32_t(hipblas_gemm_tuning_hash(key)) & mask;
+            for(uint32_t probes = 0; probes < header->capacity; probes++, i = (i + 1) & mask)
+            {
+                const hipblasGemmTuningRecord& record = records[i];
+                if(!record.solution_index)
+                    return 0;
+                if(record.key == key)
+                    return record.solution_index;
+            }
+            return 0;
+        }
+
+        uint32_t count() const
+        {
+            return header->count;
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for(uint32_t i = 0; i < header->capacity; i++)
+                if(records[i].solution_index)
+                    f(records[i]);
+        }
+    };
+
+    // Mapped by the first lookup. Never unmapped, gemm calls may still be made during static
+    // destruction.
+    const hipblasGemmTuningFile* hipblas_gemm_tuning_file()
+    {
+        static const hipblasGemmTuningFile* file = [] {
+            const char* path = getenv("HIPBLAS_TUNING_PATH");
+            if(!path || !*path)
+                return (hipblasGemmTuningFile*)nullptr;
+
+            auto* file = new hipblasGemmTuningFile;
+            if(!file->open(path))
+            {
+                std::cerr << "hipBLAS: cannot read HIPBLAS_TUNING_PATH " << path
+                          << " as a gemm tuning file, using the default solutions" << std::endl;
+                delete file;
+                return (hipblasGemmTuningFile*)nullptr;
+            }
+            return file;
+        }();
+        return file;
+    }
+
+    hipblasGemmTuningEntry_t hipblas_gemm_tuning_entry(const hipblasGemmTuningRecord& record)
+    {
+        const hipblasGemmTuningKey& key = record.key;
+        return {hipblasGemmTuningFunction_t(key.function),
+                hipblasOperation_t(key.trans_a),
+                hipblasOperation_t(key.trans_b),
+                key.m,
+                key.n,
+                key.k,
+                key.lda,
+                key.ldb,
+                key.ldc,
+                hipDataType(key.a_type),
+                hipDataType(key.b_type),
+                hipDataType(key.c_type),
+                hipblasComputeType_t(key.compute_type),
+                key.batch_count,
+                record.solution_index};
+    }
+
+    // The types of the HIPBLAS_V2 functions for those of the functions taking hipblasDatatype_t
+    constexpr std::pair<hipblasDatatype_t, hipDataType> hipblas_v2_datatypes[] = {
+        {HIPBLAS_R_16F, HIP_R_16F},
+        {HIPBLAS_R_32F, HIP_R_32F},
+        {HIPBLAS_R_64F, HIP_R_64F},
+        {HIPBLAS_C_16F, HIP_C_16F},
+        {HIPBLAS_C_32F, HIP_C_32F},
+        {HIPBLAS_C_64F, HIP_C_64F},
+        {HIPBLAS_R_8I, HIP_R_8I},
+        {HIPBLAS_R_8U, HIP_R_8U},
+        {HIPBLAS_R_32I, HIP_R_32I},
+        {HIPBLAS_R_32U, HIP_R_32U},
+        {HIPBLAS_C_8I, HIP_C_8I},
+        {HIPBLAS_C_8U, HIP_C_8U},
+        {HIPBLAS_C_32I, HIP_C_32I},
+        {HIPBLAS_C_32U, HIP_C_32U},
+        {HIPBLAS_R_16B, HIP_R_16BF},
+        {HIPBLAS_C_16B, HIP_C_16BF},
+    };
+
+    constexpr std::pair<hipblasDatatype_t, hipblasComputeType_t> hipblas_v2_compute_types[] = {
+        {HIPBLAS_R_16F, HIPBLAS_COMPUTE_16F},
+        {HIPBLAS_R_32F, HIPBLAS_COMPUTE_32F},
+        {HIPBLAS_R_64F, HIPBLAS_COMPUTE_64F},
+        {HIPBLAS_C_32F, HIPBLAS_COMPUTE_32F},
+        {HIPBLAS_C_64F, HIPBLAS_COMPUTE_64F},
+        {HIPBLAS_R_32I, HIPBLAS_COMPUTE_32I},
+    };
+
+    constexpr hipblasEnumTable<hipblasDatatype_t, hipDataType> hipblas_to_v2_datatype(
+        hipblas_v2_datatypes);
+    constexpr hipblasEnumTable<hipblasDatatype_t, hipblasComputeType_t>
+        hipblas_to_v2_compute_type(hipblas_v2_compute_types);
+}
+
+hipblasGemmTuningKey hipblas_gemm_tuning_key(hipblasGemmTuningFunction_t function,
+                                             hipblasOperation_t          trans_a,
+                                             hipblasOperation_t          trans_b,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             int                         lda,
+                                             int                         ldb,
+                                             int                         ldc,
+                                             hipblasDatatype_t           a_type,
+                                             hipblasDatatype_t           b_type,
+                                             hipblasDatatype_t           c_type,
+                                             hipblasDatatype_t           compute_type,
+                                             int                         batch_count)
+{
+    return hipblas_gemm_tuning_key(function,
+                                   trans_a,
+                                   trans_b,
+                                   m,
+                                   n,
+                                   k,
+                                   lda,
+                                   ldb,
+                                   ldc,
+                                   hipblas_to_v2_datatype[a_type],
+                                   hipblas_to_v2_datatype[b_type],
+                                   hipblas_to_v2_datatype[c_type],
+                                   hipblas_to_v2_compute_type[compute_type],
+                                   batch_count);
+}
+
+int32_t hipblas_gemm_tuned_solution(const hipblasGemmTuningKey& key)
+{
+    const hipblasGemmTuningFile* file = hipblas_gemm_tuning_file();
+    return file ? file->find(key) : 0;
+}
+
+hipblasStatus_t
+    hipblasGemmTuningRead(const char* path, hipblasGemmTuningEntry_t* entries, int* count)
+try
+{
+    if(!path || !count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasGemmTuningFile file;
+    if(!file.open(path))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int size = *count;
+    *count   = int(file.count());
+    if(!entries)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(*count > size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    file.for_each([&](const hipblasGemmTuningRecord& record) {
+        *entries++ = hipblas_gemm_tuning_entry(record);
+    });
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasGemmTuningWrite(const char* path, const hipblasGemmTuningEntry_t* entries, int count)
+try
+{
+    if(!path || count < 0 || (count && !entries))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < count; i++)
+        if(entries[i].solutionIndex <= 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The entries of the file come first so that the new ones replace them
+    std::vector<hipblasGemmTuningRecord> added;
+    {
+        hipblasGemmTuningFile file;
+        if(file.open(path))
+            file.for_each([&](const hipblasGemmTuningRecord& record) { added.push_back(record); });
+    }
+    for(int i = 0; i < count; i++)
+    {
+        const hipblasGemmTuningEntry_t& e = entries[i];
+        added.push_back({hipblas_gemm_tuning_key(e.function,
+                                                 e.transA,
+                                                 e.transB,
+                                                 e.m,
+                                                 e.n,
+                                                 e.k,
+                                                 e.lda,
+                                                 e.ldb,
+                                                 e.ldc,
+                                                 e.aType,
+                                                 e.bType,
+                                                 e.cType,
+                                                 e.computeType,
+                                                 e.batchCount),
+                         e.solutionIndex,
+                         0});
+    }
+
+    uint32_t capacity = 16;
+    while(capacity < 2 * added.size())
+        capacity *= 2;
+
+    hipblasGemmTuningHeader header = {};
+    memcpy(header.magic, hipblas_gemm_tuning_magic, sizeof(header.magic));
+    header.version     = hipblas_gemm_tuning_version;
+    header.capacity    = capacity;
+    header.record_size = sizeof(hipblasGemmTuningRecord);
+
+    std::vector<hipblasGemmTuningRecord> records(capacity);
+    for(const hipblasGemmTuningRecord& record : added)
+    {
+        uint32_t mask = capacity - 1;
+        uint32_t i    = uint32_t(hipblas_gemm_tuning_hash(record.key)) & mask;
+        while(records[i].solution_index && !(records[i].key == record.key))
+            i = (i + 1) & mask;
+        if(!records[i].solution_index)
+            header.count++;
+        records[i] = record;
+    }
+
+    // Written next to path and renamed over it, a process mapping the previous file keeps its
+    // pages and one opening path sees either file whole
+#ifdef _WIN32
+    std::string temp = std::string(path) + ".tmp" + std::to_string(_getpid());
+#else
+    std::string temp = std::string(path) + ".tmp" + std::to_string(getpid());
+#endif
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        if(!file.is_open())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(records.data()),
+                   records.size() * sizeof(hipblasGemmTuningRecord));
+        if(!file.good())
+        {
+            file.close();
+            std::remove(temp.c_str());
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+#ifdef _WIN32
+    // rename does not replace an existing file on Windows
+    std::remove(path);
+#endif
+    if(std::rename(temp.c_str(), path))
+    {
+        std::remove(temp.c_str());
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
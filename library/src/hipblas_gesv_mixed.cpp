@@ -0,0 +1,1422 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    constexpr int      HIPBLAS_GESV_BLOCK = 256;
+    constexpr unsigned HIPBLAS_GESV_GRID  = 65535;
+
+    // Refinement steps before falling back to a double precision factorization, as in dsgesv
+    constexpr int HIPBLAS_GESV_ITERMAX = 30;
+
+    // State of each system of the batch
+    constexpr int HIPBLAS_GESV_REFINING  = 0;
+    constexpr int HIPBLAS_GESV_CONVERGED = 1;
+    constexpr int HIPBLAS_GESV_FALLBACK  = 2;
+
+    // Values of iter for the reasons to fall back, those of dsgesv
+    constexpr int HIPBLAS_GESV_ITER_OVERFLOW = -2;
+    constexpr int HIPBLAS_GESV_ITER_SINGULAR = -3;
+
+    // The kernels see a complex matrix as a real one with two components per element
+    template <typename T>
+    struct hipblas_gesv_type
+    {
+        using real                 = T;
+        static constexpr int COMPS = 1;
+    };
+
+    template <>
+    struct hipblas_gesv_type<hipComplex>
+    {
+        using real                 = float;
+        static constexpr int COMPS = 2;
+    };
+
+    template <>
+    struct hipblas_gesv_type<hipDoubleComplex>
+    {
+        using real                 = double;
+        static constexpr int COMPS = 2;
+    };
+
+    // |a| for the infinity norm of A and |Re(a)| + |Im(a)| for the largest elements of X and
+    // the residual, as zlange and izamax do
+    template <int COMPS>
+    __device__ inline double hipblas_gesv_abs(const double* a)
+    {
+        return COMPS == 1 ? fabs(a[0]) : hypot(a[0], a[1]);
+    }
+
+    template <int COMPS>
+    __device__ inline double hipblas_gesv_abs1(const double* a)
+    {
+        return COMPS == 1 ? fabs(a[0]) : fabs(a[0]) + fabs(a[1]);
+    }
+
+    // Largest of the values of the threads of the block, for thread 0
+    __device__ inline double hipblas_gesv_block_max(double v, double* shared)
+    {
+        shared[threadIdx.x] = v;
+        __syncthreads();
+        for(int s = HIPBLAS_GESV_BLOCK / 2; s > 0; s /= 2)
+        {
+            if(threadIdx.x < s)
+                shared[threadIdx.x] = fmax(shared[threadIdx.x], shared[threadIdx.x + s]);
+            __syncthreads();
+        }
+        v = shared[0];
+        __syncthreads();
+        return v;
+    }
+
+    // Infinity norm of each A_i, one block per matrix, and the initial state of the system
+    template <int COMPS>
+    __global__ void hipblas_gesv_init_kernel(int                  n,
+                                             const double* const* A,
+                                             int64_t              lda,
+                                             double*              anrm,
+                                             int*                 state,
+                                             int*                 iter,
+                                             int*                 device_info,
+                                             int                  batch_count)
+    {
+        __shared__ double shared[HIPBLAS_GESV_BLOCK];
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const double* a   = A[b];
+            double        row = 0;
+            for(int i = threadIdx.x; i < n; i += HIPBLAS_GESV_BLOCK)
+            {
+                double sum = 0;
+                for(int j = 0; j < n; j++)
+                    sum += hipblas_gesv_abs<COMPS>(a + COMPS * (i + j * lda));
+                row = fmax(row, sum);
+            }
+            row = hipblas_gesv_block_max(row, shared);
+
+            if(threadIdx.x == 0)
+            {
+                anrm[b]        = row;
+                state[b]       = HIPBLAS_GESV_REFINING;
+                iter[b]        = 0;
+                device_info[b] = 0;
+            }
+        }
+    }
+
+    // Converts the matrices of the systems still refining to single precision. A value out of
+    // the range of float makes its system fall back, as dlag2s does for dsgesv.
+    template <int COMPS>
+    __global__ void hipblas_gesv_narrow_kernel(int                  rows,
+                                               int                  cols,
+                                               const double* const* S,
+                                               int64_t              lds,
+                                               float* const*        D,
+                                               int64_t              ldd,
+                                               int*                 state,
+                                               int*                 iter,
+                                               int                  batch_count)
+    {
+        const int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            if(state[b] != HIPBLAS_GESV_REFINING)
+                continue;
+
+            const double* s = S[b];
+            float*        d = D[b];
+            for(int j = blockIdx.y; j < cols; j += gridDim.y)
+                for(int c = 0; c < COMPS; c++)
+                {
+                    const double v = s[COMPS * (i + j * lds) + c];
+                    if(v > FLT_MAX || v < -FLT_MAX)
+                    {
+                        state[b] = HIPBLAS_GESV_FALLBACK;
+                        iter[b]  = HIPBLAS_GESV_ITER_OVERFLOW;
+                    }
+                    d[COMPS * (i + j * ldd) + c] = float(v);
+                }
+        }
+    }
+
+    // X_i = S_i, or X_i += S_i with accumulate, for the systems still refining
+    template <int COMPS>
+    __global__ void hipblas_gesv_widen_kernel(int                 rows,
+                                              int                 cols,
+                                              const float* const* S,
+                                              int64_t             lds,
+                                              double* const*      X,
+                                              int64_t             ldx,
+                                              bool                accumulate,
+                                              const int*          state,
+                                              int                 batch_count)
+    {
+        const int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            if(state[b] != HIPBLAS_GESV_REFINING)
+                continue;
+
+            const float* s = S[b];
+            double*      x = X[b];
+            for(int j = blockIdx.y; j < cols; j += gridDim.y)
+                for(int c = 0; c < COMPS; c++)
+                {
+                    double& v = x[COMPS * (i + j * ldx) + c];
+                    v         = (accumulate ? v : 0) + double(s[COMPS * (i + j * lds) + c]);
+                }
+        }
+    }
+
+    // D_i = S_i for the systems in state select
+    template <int COMPS>
+    __global__ void hipblas_gesv_copy_kernel(int                  rows,
+                                             int                  cols,
+                                             const double* const* S,
+                                             int64_t              lds,
+                                             double* const*       D,
+                                             int64_t              ldd,
+                                             const int*           state,
+                                             int                  select,
+                                             int                  batch_count)
+    {
+        const int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            if(state[b] != select)
+                continue;
+
+            const double* s = S[b];
+            double*       d = D[b];
+            for(int j = blockIdx.y; j < cols; j += gridDim.y)
+                for(int c = 0; c < COMPS; c++)
+                    d[COMPS * (i + j * ldd) + c] = s[COMPS * (i + j * lds) + c];
+        }
+    }
+
+    // Systems whose single precision factorization found an exactly singular U fall back
+    __global__ void
+        hipblas_gesv_getrf_info_kernel(const int* info, int* state, int* iter, int batch_count)
+    {
+        const int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b < batch_count && state[b] == HIPBLAS_GESV_REFINING && info[b] > 0)
+        {
+            state[b] = HIPBLAS_GESV_FALLBACK;
+            iter[b]  = HIPBLAS_GESV_ITER_SINGULAR;
+        }
+    }
+
+    // Tests the solution of each system still refining after step refinement steps, one block per
+    // system. The systems which are neither converged nor out of steps are counted in refining.
+    template <int COMPS>
+    __global__ void hipblas_gesv_check_kernel(int                  n,
+                                              int                  nrhs,
+                                              const double* const* X,
+                                              int64_t              ldx,
+                                              const double* const* R,
+                                              int64_t              ldr,
+                                              const double*        anrm,
+                                              double               eps_sqrt_n,
+                                              int                  step,
+                                              int*                 state,
+                                              int*                 iter,
+                                              int*                 refining,
+                                              int                  batch_count)
+    {
+        __shared__ double shared[HIPBLAS_GESV_BLOCK];
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            if(state[b] != HIPBLAS_GESV_REFINING)
+                continue;
+
+            const double  cte       = anrm[b] * eps_sqrt_n;
+            const double* x         = X[b];
+            const double* r         = R[b];
+            bool          converged = true;
+            for(int k = 0; k < nrhs; k++)
+            {
+                double xnrm = 0, rnrm = 0;
+                for(int i = threadIdx.x; i < n; i += HIPBLAS_GESV_BLOCK)
+                {
+                    xnrm = fmax(xnrm, hipblas_gesv_abs1<COMPS>(x + COMPS * (i + k * ldx)));
+                    rnrm = fmax(rnrm, hipblas_gesv_abs1<COMPS>(r + COMPS * (i + k * ldr)));
+                }
+                xnrm = hipblas_gesv_block_max(xnrm, shared);
+                rnrm = hipblas_gesv_block_max(rnrm, shared);
+
+                // written so that a NaN residual does not pass
+                if(!(rnrm <= xnrm * cte))
+                {
+                    converged = false;
+                    break;
+                }
+            }
+
+            if(threadIdx.x == 0)
+            {
+                if(converged)
+                {
+                    state[b] = HIPBLAS_GESV_CONVERGED;
+                    iter[b]  = step;
+                }
+                else if(step == HIPBLAS_GESV_ITERMAX)
+                {
+                    state[b] = HIPBLAS_GESV_FALLBACK;
+                    iter[b]  = -HIPBLAS_GESV_ITERMAX - 1;
+                }
+                else
+                    atomicAdd(refining, 1);
+            }
+        }
+    }
+
+    __global__ void hipblas_gesv_ipiv_kernel(
+        int n, const int* src, int* dst, hipblasStride stride_P, int batch_count)
+    {
+        const int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            dst[i + b * stride_P] = src[i + int64_t(b) * n];
+    }
+
+    // Copies the pointers of the systems still refining from each of the arrays pointer arrays
+    // of P to the front of those of C, in batch order, and their indices to active. One block.
+    __global__ void hipblas_gesv_compact_kernel(void* const* P,
+                                                void**       C,
+                                                int          arrays,
+                                                int*         active,
+                                                const int*   state,
+                                                int          batch_count)
+    {
+        __shared__ int shared[HIPBLAS_GESV_BLOCK];
+
+        int count = 0;
+        for(int base = 0; base < batch_count; base += HIPBLAS_GESV_BLOCK)
+        {
+            const int  b    = base + threadIdx.x;
+            const bool keep = b < batch_count && state[b] == HIPBLAS_GESV_REFINING;
+
+            // inclusive prefix sum of keep over the block
+            shared[threadIdx.x] = keep;
+            __syncthreads();
+            for(int s = 1; s < HIPBLAS_GESV_BLOCK; s *= 2)
+            {
+                const int v = threadIdx.x >= s ? shared[threadIdx.x - s] : 0;
+                __syncthreads();
+                shared[threadIdx.x] += v;
+                __syncthreads();
+            }
+
+            if(keep)
+            {
+                const int k = count + shared[threadIdx.x] - 1;
+                for(int a = 0; a < arrays; a++)
+                    C[int64_t(a) * batch_count + k] = P[int64_t(a) * batch_count + b];
+                active[k] = b;
+            }
+            count += shared[HIPBLAS_GESV_BLOCK - 1];
+            __syncthreads();
+        }
+    }
+
+    // The pivots of system active[k] to the k-th vector of dst
+    __global__ void hipblas_gesv_gather_ipiv_kernel(
+        int n, const int* src, int* dst, const int* active, int count)
+    {
+        const int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int k = blockIdx.z; k < count; k += gridDim.z)
+            dst[i + int64_t(k) * n] = src[i + int64_t(active[k]) * n];
+    }
+
+    // The backend functions the refinement is built on, all in their batched forms as those are
+    // the ones every backend has
+    hipblasStatus_t hipblas_gesv_getrf(
+        hipblasHandle_t handle, int n, float* const A[], int lda, int* ipiv, int* info, int batch)
+    {
+        return hipblasSgetrfBatched(handle, n, A, lda, ipiv, info, batch);
+    }
+
+    hipblasStatus_t hipblas_gesv_getrf(
+        hipblasHandle_t handle, int n, double* const A[], int lda, int* ipiv, int* info, int batch)
+    {
+        return hipblasDgetrfBatched(handle, n, A, lda, ipiv, info, batch);
+    }
+
+    hipblasStatus_t hipblas_gesv_getrf(hipblasHandle_t  handle,
+                                       int              n,
+                                       hipComplex* const A[],
+                                       int              lda,
+                                       int*             ipiv,
+                                       int*             info,
+                                       int              batch)
+    {
+        return hipblasCgetrfBatched_v2(handle, n, A, lda, ipiv, info, batch);
+    }
+
+    hipblasStatus_t hipblas_gesv_getrf(hipblasHandle_t        handle,
+                                       int                    n,
+                                       hipDoubleComplex* const A[],
+                                       int                    lda,
+                                       int*                   ipiv,
+                                       int*                   info,
+                                       int                    batch)
+    {
+        return hipblasZgetrfBatched_v2(handle, n, A, lda, ipiv, info, batch);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblas_gesv_getrs(hipblasHandle_t handle,
+                                       int             n,
+                                       int             nrhs,
+                                       T* const        A[],
+                                       int             lda,
+                                       const int*      ipiv,
+                                       T* const        B[],
+                                       int             ldb,
+                                       int             batch)
+    {
+        int             info = 0;
+        hipblasStatus_t status;
+        if constexpr(std::is_same_v<T, float>)
+            status = hipblasSgetrsBatched(
+                handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, &info, batch);
+        else if constexpr(std::is_same_v<T, double>)
+            status = hipblasDgetrsBatched(
+                handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, &info, batch);
+        else if constexpr(std::is_same_v<T, hipComplex>)
+            status = hipblasCgetrsBatched_v2(
+                handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, &info, batch);
+        else
+            status = hipblasZgetrsBatched_v2(
+                handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, &info, batch);
+        return status == HIPBLAS_STATUS_SUCCESS && info ? HIPBLAS_STATUS_INTERNAL_ERROR : status;
+    }
+
+    // R_i -= A_i X_i
+    hipblasStatus_t hipblas_gesv_residual(hipblasHandle_t     handle,
+                                          int                 n,
+                                          int                 nrhs,
+                                          const double* const A[],
+                                          int                 lda,
+                                          const double* const X[],
+                                          int                 ldx,
+                                          double* const       R[],
+                                          int                 ldr,
+                                          int                 batch)
+    {
+        const double alpha = -1, beta = 1;
+        return hipblasDgemmBatched(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   n,
+                                   nrhs,
+                                   n,
+                                   &alpha,
+                                   A,
+                                   lda,
+                                   X,
+                                   ldx,
+                                   &beta,
+                                   R,
+                                   ldr,
+                                   batch);
+    }
+
+    hipblasStatus_t hipblas_gesv_residual(hipblasHandle_t               handle,
+                                          int                           n,
+                                          int                           nrhs,
+                                          const hipDoubleComplex* const A[],
+                                          int                           lda,
+                                          const hipDoubleComplex* const X[],
+                                          int                           ldx,
+                                          hipDoubleComplex* const       R[],
+                                          int                           ldr,
+                                          int                           batch)
+    {
+        const hipDoubleComplex alpha = {-1, 0}, beta = {1, 0};
+        return hipblasZgemmBatched_v2(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      n,
+                                      nrhs,
+                                      n,
+                                      &alpha,
+                                      A,
+                                      lda,
+                                      X,
+                                      ldx,
+                                      &beta,
+                                      R,
+                                      ldr,
+                                      batch);
+    }
+
+    // The gemm takes its scalars from the host, whatever pointer mode the caller set
+    class hipblas_gesv_host_pointer_mode
+    {
+        hipblasHandle_t      handle;
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+
+    public:
+        explicit hipblas_gesv_host_pointer_mode(hipblasHandle_t handle)
+            : handle(handle)
+        {
+            hipblasGetPointerMode(handle, &mode);
+            if(mode != HIPBLAS_POINTER_MODE_HOST)
+                hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        }
+
+        ~hipblas_gesv_host_pointer_mode()
+        {
+            if(mode != HIPBLAS_POINTER_MODE_HOST)
+                hipblasSetPointerMode(handle, mode);
+        }
+    };
+
+    // Device memory of the call. With a workspace set by hipblasSetWorkspace it is the end of
+    // that workspace, the backend keeping the rest for the getrf, getrs and gemm calls until
+    // the call returns. Otherwise it is allocated on the stream and released when the call
+    // returns.
+    class hipblas_gesv_workspace
+    {
+        hipblasHandle_t handle;
+        hipStream_t     stream;
+        void*           ptr       = nullptr;
+        void*           user_ptr  = nullptr;
+        size_t          user_size = 0;
+
+    public:
+        hipblas_gesv_workspace(hipblasHandle_t handle, hipStream_t stream)
+            : handle(handle)
+            , stream(stream)
+        {
+        }
+
+        ~hipblas_gesv_workspace()
+        {
+            if(ptr)
+                (void)hipFreeAsync(ptr, stream);
+            if(user_ptr)
+                (void)hipblasSetWorkspace(handle, user_ptr, user_size);
+        }
+
+        char* allocate(size_t size)
+        {
+            const hipblasHandleState& state = hipblas_handle_state(handle);
+            if(!state.workspace)
+                return hipMallocAsync(&ptr, size, stream) == hipSuccess ? static_cast<char*>(ptr)
+                                                                        : nullptr;
+
+            // The backend keeps a non-empty, 256 byte aligned beginning of the workspace
+            if(state.workspace_size <= size)
+                return nullptr;
+            const size_t offset = (state.workspace_size - size) / 256 * 256;
+            if(!offset)
+                return nullptr;
+
+            void* const  workspace      = state.workspace;
+            const size_t workspace_size = state.workspace_size;
+            if(hipblasSetWorkspace(handle, workspace, offset) != HIPBLAS_STATUS_SUCCESS)
+                return nullptr;
+            user_ptr  = workspace;
+            user_size = workspace_size;
+            return static_cast<char*>(workspace) + offset;
+        }
+    };
+
+    // Arguments are checked into info as getrs does, the strided forms having four strides
+    // in between the others. A, B and X are arrays of batch_count pointers with is_array and
+    // strided from the first matrix otherwise.
+    template <typename Td, typename Ts>
+    hipblasStatus_t hipblasGesvMixedTemplate(hipblasHandle_t handle,
+                                             int             n,
+                                             int             nrhs,
+                                             void*           A,
+                                             int             lda,
+                                             hipblasStride   stride_A,
+                                             int*            ipiv,
+                                             hipblasStride   stride_P,
+                                             const void*     B,
+                                             int             ldb,
+                                             hipblasStride   stride_B,
+                                             void*           X,
+                                             int             ldx,
+                                             hipblasStride   stride_X,
+                                             int*            iter,
+                                             int*            info,
+                                             int*            device_info,
+                                             bool            is_array,
+                                             bool            strided,
+                                             int             batch_count)
+    {
+        constexpr int COMPS = hipblas_gesv_type<Td>::COMPS;
+        const int     s     = strided;
+
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        if(info == NULL)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        else if(n < 0)
+            *info = -1;
+        else if(nrhs < 0)
+            *info = -2;
+        else if(A == NULL && n)
+            *info = -3;
+        else if(lda < std::max(1, n))
+            *info = -4;
+        else if(ipiv == NULL && n)
+            *info = -5 - s;
+        else if(B == NULL && n && nrhs)
+            *info = -6 - 2 * s;
+        else if(ldb < std::max(1, n))
+            *info = -7 - 2 * s;
+        else if(X == NULL && n && nrhs)
+            *info = -8 - 3 * s;
+        else if(ldx < std::max(1, n))
+            *info = -9 - 3 * s;
+        else if(iter == NULL)
+            *info = -10 - 4 * s;
+        else if(device_info == NULL)
+            *info = -12 - 4 * s;
+        else if(batch_count < 0)
+            *info = -13 - 4 * s;
+        else
+            *info = 0;
+
+        if(*info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(!n || !nrhs)
+        {
+            if(hipMemsetAsync(iter, 0, sizeof(int) * batch_count, stream) != hipSuccess
+               || hipMemsetAsync(device_info, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        // The refinement synchronizes with the host once per step
+        if(hipblasSafeCapturing(handle))
+            return HIPBLAS_STATUS_CAPTURE_UNSAFE;
+
+        // Workspace: the pointer arrays of the user matrices and of the single precision copy of
+        // A, the single precision solution and the residual, followed by the matrices themselves
+        // with a leading dimension of n, the pivots and the state of each system, and the same
+        // pointer arrays and pivots compacted to the systems still refining with their indices
+        const size_t batch = batch_count;
+        const size_t sizes[]
+            = {6 * batch * sizeof(void*),
+               batch * n * n * sizeof(Ts),
+               batch * n * nrhs * sizeof(Ts),
+               batch * n * nrhs * sizeof(Td),
+               batch * n * sizeof(int),
+               batch * sizeof(int),
+               batch * sizeof(int),
+               batch * sizeof(double),
+               sizeof(int),
+               6 * batch * sizeof(void*),
+               batch * n * sizeof(int),
+               batch * sizeof(int)};
+        char*  chunks[std::size(sizes)];
+        size_t size = 0;
+        for(size_t c = 0; c < std::size(sizes); c++)
+            size += (sizes[c] + 255) / 256 * 256;
+
+        hipblas_gesv_workspace workspace(handle, stream);
+        char*                  base = workspace.allocate(size);
+        if(!base)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        for(size_t c = 0; c < std::size(sizes); c++)
+        {
+            chunks[c] = base;
+            base += (sizes[c] + 255) / 256 * 256;
+        }
+
+        Td** pA  = reinterpret_cast<Td**>(chunks[0]);
+        Td** pB  = pA + batch;
+        Td** pX  = pB + batch;
+        Ts** pSA = reinterpret_cast<Ts**>(pX + batch);
+        Ts** pSX = pSA + batch;
+        Td** pR  = reinterpret_cast<Td**>(pSX + batch);
+
+        Ts*     SA       = reinterpret_cast<Ts*>(chunks[1]);
+        Ts*     SX       = reinterpret_cast<Ts*>(chunks[2]);
+        Td*     R        = reinterpret_cast<Td*>(chunks[3]);
+        int*    work_piv = reinterpret_cast<int*>(chunks[4]);
+        int*    sinfo    = reinterpret_cast<int*>(chunks[5]);
+        int*    state    = reinterpret_cast<int*>(chunks[6]);
+        double* anrm     = reinterpret_cast<double*>(chunks[7]);
+        int*    refining = reinterpret_cast<int*>(chunks[8]);
+
+        Td** cA  = reinterpret_cast<Td**>(chunks[9]);
+        Td** cX  = cA + 2 * batch;
+        Ts** cSA = reinterpret_cast<Ts**>(cX + batch);
+        Ts** cSX = cSA + batch;
+        Td** cR  = reinterpret_cast<Td**>(cSX + batch);
+
+        int* compact_piv = reinterpret_cast<int*>(chunks[10]);
+        int* active      = reinterpret_cast<int*>(chunks[11]);
+
+        auto build = [&](void* array, const void* first, size_t elem, hipblasStride stride) {
+            return hipblasBuildPointerArrayStrided(
+                handle, static_cast<void**>(array), first, int(elem), stride, batch_count);
+        };
+
+        if(is_array)
+        {
+            if(hipMemcpyAsync(pA, A, batch * sizeof(void*), hipMemcpyDeviceToDevice, stream)
+                   != hipSuccess
+               || hipMemcpyAsync(pB, B, batch * sizeof(void*), hipMemcpyDeviceToDevice, stream)
+                      != hipSuccess
+               || hipMemcpyAsync(pX, X, batch * sizeof(void*), hipMemcpyDeviceToDevice, stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        else if((status = build(pA, A, sizeof(Td), stride_A)) != HIPBLAS_STATUS_SUCCESS
+                || (status = build(pB, B, sizeof(Td), stride_B)) != HIPBLAS_STATUS_SUCCESS
+                || (status = build(pX, X, sizeof(Td), stride_X)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if((status = build(pSA, SA, sizeof(Ts), hipblasStride(n) * n)) != HIPBLAS_STATUS_SUCCESS
+           || (status = build(pSX, SX, sizeof(Ts), hipblasStride(n) * nrhs))
+                  != HIPBLAS_STATUS_SUCCESS
+           || (status = build(pR, R, sizeof(Td), hipblasStride(n) * nrhs))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_gesv_host_pointer_mode host_mode(handle);
+
+        using Rd                 = typename hipblas_gesv_type<Td>::real;
+        auto real_array          = [](auto p) { return reinterpret_cast<Rd* const*>(p); };
+        auto single_array        = [](auto p) { return reinterpret_cast<float* const*>(p); };
+        const unsigned batches   = std::min(unsigned(batch_count), HIPBLAS_GESV_GRID);
+        const dim3     row_block = dim3(HIPBLAS_GESV_BLOCK);
+        auto           grid      = [&](int cols) {
+            return dim3((n - 1) / HIPBLAS_GESV_BLOCK + 1,
+                        std::min(unsigned(cols), HIPBLAS_GESV_GRID),
+                        batches);
+        };
+
+        auto launched = [] { return hipGetLastError() == hipSuccess; };
+
+        hipLaunchKernelGGL(hipblas_gesv_init_kernel<COMPS>,
+                           dim3(1, 1, batches),
+                           row_block,
+                           0,
+                           stream,
+                           n,
+                           real_array(pA),
+                           int64_t(lda),
+                           anrm,
+                           state,
+                           iter,
+                           device_info,
+                           batch_count);
+
+        // Single precision factorization and first solution
+        hipLaunchKernelGGL(hipblas_gesv_narrow_kernel<COMPS>,
+                           grid(n),
+                           row_block,
+                           0,
+                           stream,
+                           n,
+                           n,
+                           real_array(pA),
+                           int64_t(lda),
+                           single_array(pSA),
+                           int64_t(n),
+                           state,
+                           iter,
+                           batch_count);
+        hipLaunchKernelGGL(hipblas_gesv_narrow_kernel<COMPS>,
+                           grid(nrhs),
+                           row_block,
+                           0,
+                           stream,
+                           n,
+                           nrhs,
+                           real_array(pB),
+                           int64_t(ldb),
+                           single_array(pSX),
+                           int64_t(n),
+                           state,
+                           iter,
+                           batch_count);
+        if(!launched())
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if((status = hipblas_gesv_getrf(handle, n, pSA, n, work_piv, sinfo, batch_count))
+           != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipLaunchKernelGGL(hipblas_gesv_getrf_info_kernel,
+                           dim3((batch_count - 1) / HIPBLAS_GESV_BLOCK + 1),
+                           row_block,
+                           0,
+                           stream,
+                           sinfo,
+                           state,
+                           iter,
+                           batch_count);
+        if(!launched())
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if((status = hipblas_gesv_getrs(handle, n, nrhs, pSA, n, work_piv, pSX, n, batch_count))
+           != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Refinement, one step more after each check until every system converged or fell back.
+        // The gemm and getrs of a step only see the systems still refining, gathered to the
+        // front of the compacted arrays whenever some of them stopped.
+        Td* const* rA     = pA;
+        Td* const* rX     = pX;
+        Td* const* rR     = pR;
+        Ts* const* rSA    = pSA;
+        Ts* const* rSX    = pSX;
+        int*       rpiv   = work_piv;
+        int        rcount = batch_count;
+
+        const double eps_sqrt_n = DBL_EPSILON / 2 * std::sqrt(double(n));
+        for(int step = 0;; step++)
+        {
+            hipLaunchKernelGGL(hipblas_gesv_widen_kernel<COMPS>,
+                               grid(nrhs),
+                               row_block,
+                               0,
+                               stream,
+                               n,
+                               nrhs,
+                               single_array(pSX),
+                               int64_t(n),
+                               real_array(pX),
+                               int64_t(ldx),
+                               step > 0,
+                               state,
+                               batch_count);
+            hipLaunchKernelGGL(hipblas_gesv_copy_kernel<COMPS>,
+                               grid(nrhs),
+                               row_block,
+                               0,
+                               stream,
+                               n,
+                               nrhs,
+                               real_array(pB),
+                               int64_t(ldb),
+                               real_array(pR),
+                               int64_t(n),
+                               state,
+                               HIPBLAS_GESV_REFINING,
+                               batch_count);
+            if(!launched())
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+            if((status = hipblas_gesv_residual(handle, n, nrhs, rA, lda, rX, ldx, rR, n, rcount))
+               != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            int count = 0;
+            if(hipMemsetAsync(refining, 0, sizeof(int), stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            hipLaunchKernelGGL(hipblas_gesv_check_kernel<COMPS>,
+                               dim3(1, 1, batches),
+                               row_block,
+                               0,
+                               stream,
+                               n,
+                               nrhs,
+                               real_array(pX),
+                               int64_t(ldx),
+                               real_array(pR),
+                               int64_t(n),
+                               anrm,
+                               eps_sqrt_n,
+                               step,
+                               state,
+                               iter,
+                               refining,
+                               batch_count);
+            if(!launched()
+               || hipMemcpyAsync(&count, refining, sizeof(int), hipMemcpyDeviceToHost, stream)
+                      != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            if(!count)
+                break;
+
+            if(count < rcount)
+            {
+                hipLaunchKernelGGL(hipblas_gesv_compact_kernel,
+                                   dim3(1),
+                                   row_block,
+                                   0,
+                                   stream,
+                                   reinterpret_cast<void* const*>(pA),
+                                   reinterpret_cast<void**>(cA),
+                                   6,
+                                   active,
+                                   state,
+                                   batch_count);
+                hipLaunchKernelGGL(hipblas_gesv_gather_ipiv_kernel,
+                                   dim3((n - 1) / HIPBLAS_GESV_BLOCK + 1,
+                                        1,
+                                        std::min(unsigned(count), HIPBLAS_GESV_GRID)),
+                                   row_block,
+                                   0,
+                                   stream,
+                                   n,
+                                   work_piv,
+                                   compact_piv,
+                                   active,
+                                   count);
+                if(!launched())
+                    return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+                rA     = cA;
+                rX     = cX;
+                rR     = cR;
+                rSA    = cSA;
+                rSX    = cSX;
+                rpiv   = compact_piv;
+                rcount = count;
+            }
+
+            hipLaunchKernelGGL(hipblas_gesv_narrow_kernel<COMPS>,
+                               grid(nrhs),
+                               row_block,
+                               0,
+                               stream,
+                               n,
+                               nrhs,
+                               real_array(pR),
+                               int64_t(n),
+                               single_array(pSX),
+                               int64_t(n),
+                               state,
+                               iter,
+                               batch_count);
+            if(!launched())
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+            if((status = hipblas_gesv_getrs(handle, n, nrhs, rSA, n, rpiv, rSX, n, rcount))
+               != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        // Double precision factorization of the systems which fell back, all at once when the
+        // whole batch did and one at a time otherwise
+        std::vector<int> states(batch);
+        if(hipMemcpyAsync(
+               states.data(), state, batch * sizeof(int), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        const size_t fallbacks = std::count(states.begin(), states.end(), HIPBLAS_GESV_FALLBACK);
+        if(fallbacks)
+        {
+            hipLaunchKernelGGL(hipblas_gesv_copy_kernel<COMPS>,
+                               grid(nrhs),
+                               row_block,
+                               0,
+                               stream,
+                               n,
+                               nrhs,
+                               real_array(pB),
+                               int64_t(ldb),
+                               real_array(pX),
+                               int64_t(ldx),
+                               state,
+                               HIPBLAS_GESV_FALLBACK,
+                               batch_count);
+            if(!launched())
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+            const bool all = fallbacks == batch;
+            for(int b = 0; b < (all ? 1 : batch_count); b++)
+            {
+                if(!all && states[b] != HIPBLAS_GESV_FALLBACK)
+                    continue;
+
+                const int systems = all ? batch_count : 1;
+                int*      piv     = work_piv + size_t(b) * n;
+                if((status = hipblas_gesv_getrf(
+                        handle, n, pA + b, lda, piv, device_info + b, systems))
+                       != HIPBLAS_STATUS_SUCCESS
+                   || (status = hipblas_gesv_getrs(
+                           handle, n, nrhs, pA + b, lda, piv, pX + b, ldx, systems))
+                          != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+
+        hipLaunchKernelGGL(hipblas_gesv_ipiv_kernel,
+                           dim3((n - 1) / HIPBLAS_GESV_BLOCK + 1, 1, batches),
+                           row_block,
+                           0,
+                           stream,
+                           n,
+                           work_piv,
+                           ipiv,
+                           strided ? stride_P : hipblasStride(n),
+                           batch_count);
+        return launched() ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+// gesv
+hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              double*         A,
+                              const int       lda,
+                              int*            ipiv,
+                              const double*   B,
+                              const int       ldb,
+                              double*         X,
+                              const int       ldx,
+                              int*            iter,
+                              int*            info,
+                              int*            deviceInfo)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+    return hipblasGesvMixedTemplate<double, float>(handle,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   0,
+                                                   ipiv,
+                                                   0,
+                                                   B,
+                                                   ldb,
+                                                   0,
+                                                   X,
+                                                   ldx,
+                                                   0,
+                                                   iter,
+                                                   info,
+                                                   deviceInfo,
+                                                   false,
+                                                   false,
+                                                   1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesv(hipblasHandle_t             handle,
+                              const int                   n,
+                              const int                   nrhs,
+                              hipblasDoubleComplex*       A,
+                              const int                   lda,
+                              int*                        ipiv,
+                              const hipblasDoubleComplex* B,
+                              const int                   ldb,
+                              hipblasDoubleComplex*       X,
+                              const int                   ldx,
+                              int*                        iter,
+                              int*                        info,
+                              int*                        deviceInfo)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+    return hipblasGesvMixedTemplate<hipDoubleComplex, hipComplex>(handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  A,
+                                                                  lda,
+                                                                  0,
+                                                                  ipiv,
+                                                                  0,
+                                                                  B,
+                                                                  ldb,
+                                                                  0,
+                                                                  X,
+                                                                  ldx,
+                                                                  0,
+                                                                  iter,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  false,
+                                                                  false,
+                                                                  1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesv_v2(hipblasHandle_t         handle,
+                                 const int               n,
+                                 const int               nrhs,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 int*                    ipiv,
+                                 const hipDoubleComplex* B,
+                                 const int               ldb,
+                                 hipDoubleComplex*       X,
+                                 const int               ldx,
+                                 int*                    iter,
+                                 int*                    info,
+                                 int*                    deviceInfo)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+    return hipblasGesvMixedTemplate<hipDoubleComplex, hipComplex>(handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  A,
+                                                                  lda,
+                                                                  0,
+                                                                  ipiv,
+                                                                  0,
+                                                                  B,
+                                                                  ldb,
+                                                                  0,
+                                                                  X,
+                                                                  ldx,
+                                                                  0,
+                                                                  iter,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  false,
+                                                                  false,
+                                                                  1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gesv_batched
+hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t     handle,
+                                     const int           n,
+                                     const int           nrhs,
+                                     double* const       A[],
+                                     const int           lda,
+                                     int*                ipiv,
+                                     const double* const B[],
+                                     const int           ldb,
+                                     double* const       X[],
+                                     const int           ldx,
+                                     int*                iter,
+                                     int*                info,
+                                     int*                deviceInfo,
+                                     const int           batchCount)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+    return hipblasGesvMixedTemplate<double, float>(handle,
+                                                   n,
+                                                   nrhs,
+                                                   (void*)A,
+                                                   lda,
+                                                   0,
+                                                   ipiv,
+                                                   0,
+                                                   B,
+                                                   ldb,
+                                                   0,
+                                                   (void*)X,
+                                                   ldx,
+                                                   0,
+                                                   iter,
+                                                   info,
+                                                   deviceInfo,
+                                                   true,
+                                                   false,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t                   handle,
+                                     const int                         n,
+                                     const int                         nrhs,
+                                     hipblasDoubleComplex* const       A[],
+                                     const int                         lda,
+                                     int*                              ipiv,
+                                     const hipblasDoubleComplex* const B[],
+                                     const int                         ldb,
+                                     hipblasDoubleComplex* const       X[],
+                                     const int                         ldx,
+                                     int*                              iter,
+                                     int*                              info,
+                                     int*                              deviceInfo,
+                                     const int                         batchCount)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+    return hipblasGesvMixedTemplate<hipDoubleComplex, hipComplex>(handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (void*)A,
+                                                                  lda,
+                                                                  0,
+                                                                  ipiv,
+                                                                  0,
+                                                                  B,
+                                                                  ldb,
+                                                                  0,
+                                                                  (void*)X,
+                                                                  ldx,
+                                                                  0,
+                                                                  iter,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  true,
+                                                                  false,
+                                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvBatched_v2(hipblasHandle_t               handle,
+                                        const int                     n,
+                                        const int                     nrhs,
+                                        hipDoubleComplex* const       A[],
+                                        const int                     lda,
+                                        int*                          ipiv,
+                                        const hipDoubleComplex* const B[],
+                                        const int                     ldb,
+                                        hipDoubleComplex* const       X[],
+                                        const int                     ldx,
+                                        int*                          iter,
+                                        int*                          info,
+                                        int*                          deviceInfo,
+                                        const int                     batchCount)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+    return hipblasGesvMixedTemplate<hipDoubleComplex, hipComplex>(handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  (void*)A,
+                                                                  lda,
+                                                                  0,
+                                                                  ipiv,
+                                                                  0,
+                                                                  B,
+                                                                  ldb,
+                                                                  0,
+                                                                  (void*)X,
+                                                                  ldx,
+                                                                  0,
+                                                                  iter,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  true,
+                                                                  false,
+                                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gesv_strided_batched
+hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            const int           nrhs,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            const double*       B,
+                                            const int           ldb,
+                                            const hipblasStride strideB,
+                                            double*             X,
+                                            const int           ldx,
+                                            const hipblasStride strideX,
+                                            int*                iter,
+                                            int*                info,
+                                            int*                deviceInfo,
+                                            const int           batchCount)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, X, ldx, strideX,
+                iter, info, deviceInfo, batchCount);
+    return hipblasGesvMixedTemplate<double, float>(handle,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   ipiv,
+                                                   strideP,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   X,
+                                                   ldx,
+                                                   strideX,
+                                                   iter,
+                                                   info,
+                                                   deviceInfo,
+                                                   false,
+                                                   true,
+                                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t             handle,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex*       A,
+                                            const int                   lda,
+                                            const hipblasStride         strideA,
+                                            int*                        ipiv,
+                                            const hipblasStride         strideP,
+                                            const hipblasDoubleComplex* B,
+                                            const int                   ldb,
+                                            const hipblasStride         strideB,
+                                            hipblasDoubleComplex*       X,
+                                            const int                   ldx,
+                                            const hipblasStride         strideX,
+                                            int*                        iter,
+                                            int*                        info,
+                                            int*                        deviceInfo,
+                                            const int                   batchCount)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, X, ldx, strideX,
+                iter, info, deviceInfo, batchCount);
+    return hipblasGesvMixedTemplate<hipDoubleComplex, hipComplex>(handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  B,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  X,
+                                                                  ldx,
+                                                                  strideX,
+                                                                  iter,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  false,
+                                                                  true,
+                                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvStridedBatched_v2(hipblasHandle_t         handle,
+                                               const int               n,
+                                               const int               nrhs,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    ipiv,
+                                               const hipblasStride     strideP,
+                                               const hipDoubleComplex* B,
+                                               const int               ldb,
+                                               const hipblasStride     strideB,
+                                               hipDoubleComplex*       X,
+                                               const int               ldx,
+                                               const hipblasStride     strideX,
+                                               int*                    iter,
+                                               int*                    info,
+                                               int*                    deviceInfo,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_LOG(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, X, ldx, strideX,
+                iter, info, deviceInfo, batchCount);
+    return hipblasGesvMixedTemplate<hipDoubleComplex, hipComplex>(handle,
+                                                                  n,
+                                                                  nrhs,
+                                                                  A,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  strideP,
+                                                                  B,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  X,
+                                                                  ldx,
+                                                                  strideX,
+                                                                  iter,
+                                                                  info,
+                                                                  deviceInfo,
+                                                                  false,
+                                                                  true,
+                                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
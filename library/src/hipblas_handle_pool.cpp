@@ -0,0 +1,426 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    // A handle created by a pool and the settings restored when it is released
+    struct hipblasPooledHandle
+    {
+        hipblasHandle_t      handle;
+        int                  device;
+        hipStream_t          stream;
+        hipblasPointerMode_t pointer_mode;
+        hipblasMath_t        math_mode;
+        hipblasAtomicsMode_t atomics_mode;
+        std::atomic<bool>    in_use{false};
+    };
+
+    // Idle handle cached by one thread. Acquire and release of the thread exchange it without
+    // locking; the pool drains it when destroyed and the thread returns it when exiting.
+    struct hipblasHandlePoolSlot
+    {
+        std::atomic<hipblasPooledHandle*> idle{nullptr};
+    };
+}
+
+// Shared by the pool and the caches of the threads which used it, so a thread exiting after
+// the pool was destroyed does not touch freed memory
+struct hipblasHandlePoolState
+{
+    std::mutex mutex;
+    bool       destroyed = false;
+
+    // Every handle created by the pool, acquired or idle
+    std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasPooledHandle>> handles;
+
+    // Idle handles not cached by a thread, by device
+    std::unordered_map<int, std::vector<hipblasPooledHandle*>> idle;
+
+    // Handles destroyed because their settings could not be restored. Their entries are kept
+    // until the pool is destroyed, the thread which acquired one may still point to it.
+    std::vector<std::unique_ptr<hipblasPooledHandle>> retired;
+
+    std::vector<std::shared_ptr<hipblasHandlePoolSlot>> slots;
+
+    std::atomic<size_t> created{0};
+    std::atomic<size_t> acquires{0};
+    std::atomic<size_t> thread_cache_hits{0};
+    std::atomic<size_t> shared_hits{0};
+    std::atomic<size_t> releases{0};
+    std::atomic<size_t> in_use{0};
+
+    // Must be called with mutex locked
+    void push_idle(hipblasPooledHandle* entry)
+    {
+        idle[entry->device].push_back(entry);
+    }
+
+    // Must be called with mutex locked. Prefers a handle last used with stream, so its
+    // stream need not be set again.
+    hipblasPooledHandle* pop_idle(int device, hipStream_t stream)
+    {
+        auto list = idle.find(device);
+        if(list == idle.end() || list->second.empty())
+            return nullptr;
+
+        auto& entries = list->second;
+        auto  match   = std::find_if(entries.rbegin(), entries.rend(), [=](auto entry) {
+            return entry->stream == stream;
+        });
+        auto  pos     = match == entries.rend() ? entries.end() - 1 : match.base() - 1;
+        auto  entry   = *pos;
+        entries.erase(pos);
+        return entry;
+    }
+};
+
+struct hipblasHandlePool
+{
+    // Identifies the pool in the caches of the threads, unlike its address it is never reused
+    uint64_t                                id;
+    std::shared_ptr<hipblasHandlePoolState> state;
+};
+
+namespace
+{
+    struct hipblasThreadHandleCache
+    {
+        struct entry
+        {
+            std::shared_ptr<hipblasHandlePoolState> state;
+            std::shared_ptr<hipblasHandlePoolSlot>  slot;
+
+            // Handle last acquired by the thread, released without looking it up
+            hipblasPooledHandle* acquired = nullptr;
+        };
+
+        std::unordered_map<uint64_t, entry> pools;
+
+        // Returns the cached handle of the thread to its pool
+        static void flush(entry& cache)
+        {
+            std::lock_guard<std::mutex> lock(cache.state->mutex);
+            if(cache.state->destroyed)
+                return;
+
+            if(auto idle = cache.slot->idle.exchange(nullptr))
+                cache.state->push_idle(idle);
+
+            auto& slots = cache.state->slots;
+            slots.erase(std::remove(slots.begin(), slots.end(), cache.slot), slots.end());
+        }
+
+        ~hipblasThreadHandleCache()
+        {
+            for(auto& pool : pools)
+                flush(pool.second);
+        }
+
+        entry& get(hipblasHandlePool_t pool)
+        {
+            auto cache = pools.find(pool->id);
+            if(cache != pools.end())
+                return cache->second;
+
+            // Forget the pools destroyed since the thread last registered with a pool
+            for(auto it = pools.begin(); it != pools.end();)
+            {
+                bool destroyed;
+                {
+                    std::lock_guard<std::mutex> lock(it->second.state->mutex);
+                    destroyed = it->second.state->destroyed;
+                }
+                // Erasing may free the state, so only once its mutex is unlocked
+                it = destroyed ? pools.erase(it) : std::next(it);
+            }
+
+            entry new_cache{pool->state, std::make_shared<hipblasHandlePoolSlot>()};
+            {
+                std::lock_guard<std::mutex> lock(pool->state->mutex);
+                pool->state->slots.push_back(new_cache.slot);
+            }
+            return pools.emplace(pool->id, std::move(new_cache)).first->second;
+        }
+    };
+
+    hipblasThreadHandleCache::entry& hipblas_thread_handle_cache(hipblasHandlePool_t pool)
+    {
+        thread_local hipblasThreadHandleCache cache;
+        return cache.get(pool);
+    }
+
+    // Creates a handle for device, which is made current while the backend sets it up
+    hipblasStatus_t hipblasPoolCreateHandle(int device, std::unique_ptr<hipblasPooledHandle>& entry)
+    {
+        int current_device;
+        if(hipGetDevice(&current_device) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(device != current_device && hipSetDevice(device) != hipSuccess)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        entry         = std::make_unique<hipblasPooledHandle>();
+        entry->device = device;
+
+        hipblasStatus_t status = hipblasCreate(&entry->handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            if((status = hipblasGetStream(entry->handle, &entry->stream)) == HIPBLAS_STATUS_SUCCESS
+               && (status = hipblasGetPointerMode(entry->handle, &entry->pointer_mode))
+                      == HIPBLAS_STATUS_SUCCESS
+               && (status = hipblasGetMathMode(entry->handle, &entry->math_mode))
+                      == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGetAtomicsMode(entry->handle, &entry->atomics_mode);
+
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                hipblasDestroy(entry->handle);
+        }
+
+        if(device != current_device)
+            hipSetDevice(current_device);
+        return status;
+    }
+
+    // Restores the settings the handle was created with
+    hipblasStatus_t hipblasPoolResetHandle(const hipblasPooledHandle& entry)
+    {
+        hipblasStatus_t status = hipblasSetPointerMode(entry.handle, entry.pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetMathMode(entry.handle, entry.math_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(entry.handle, entry.atomics_mode);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool)
+try
+{
+    static std::atomic<uint64_t> next_id{0};
+
+    if(!pool)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *pool = new hipblasHandlePool{next_id++, std::make_shared<hipblasHandlePoolState>()};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    auto& state = *pool->state;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if(state.in_use)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        state.destroyed = true;
+        for(auto& slot : state.slots)
+            slot->idle.store(nullptr);
+        for(auto& entry : state.handles)
+            hipblasDestroy(entry.first);
+
+        state.slots.clear();
+        state.idle.clear();
+        state.handles.clear();
+        state.retired.clear();
+    }
+
+    delete pool;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                         int                 device,
+                                         hipStream_t         stream,
+                                         hipblasHandle_t*    handle)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!handle || device < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto& state = *pool->state;
+    auto& cache = hipblas_thread_handle_cache(pool);
+
+    hipblasPooledHandle* entry = cache.slot->idle.exchange(nullptr);
+    if(entry && entry->device == device)
+    {
+        state.thread_cache_hits++;
+    }
+    else
+    {
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if(entry)
+                state.push_idle(entry);
+
+            entry = state.pop_idle(device, stream);
+        }
+
+        if(entry)
+        {
+            state.shared_hits++;
+        }
+        else
+        {
+            // Created without holding the lock, creation is what the pool keeps other threads
+            // from waiting for
+            std::unique_ptr<hipblasPooledHandle> new_entry;
+            hipblasStatus_t                      status = hipblasPoolCreateHandle(device, new_entry);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            entry = new_entry.get();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.handles.emplace(entry->handle, std::move(new_entry));
+            state.created++;
+        }
+    }
+
+    if(entry->stream != stream)
+    {
+        hipblasStatus_t status = hipblasSetStream(entry->handle, stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.push_idle(entry);
+            return status;
+        }
+        entry->stream = stream;
+    }
+
+    entry->in_use  = true;
+    cache.acquired = entry;
+    state.acquires++;
+    state.in_use++;
+
+    *handle = entry->handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool, hipblasHandle_t handle)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+
+    auto& state = *pool->state;
+    auto& cache = hipblas_thread_handle_cache(pool);
+
+    // Handles released by the thread which acquired them are found without locking
+    hipblasPooledHandle* entry = cache.acquired;
+    if(entry && entry->handle == handle)
+    {
+        cache.acquired = nullptr;
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto                        found = state.handles.find(handle);
+        if(found == state.handles.end())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        entry = found->second.get();
+    }
+
+    if(!entry->in_use.exchange(false))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    state.releases++;
+    state.in_use--;
+
+    // A handle whose settings cannot be restored is not handed out again
+    hipblasStatus_t status = hipblasPoolResetHandle(*entry);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto                        found = state.handles.find(handle);
+        hipblasDestroy(handle);
+        entry->handle = nullptr;
+        state.retired.push_back(std::move(found->second));
+        state.handles.erase(found);
+        return status;
+    }
+
+    // Keep the handle in the cache of the thread, the handle it replaces goes to the pool
+    if(auto idle = cache.slot->idle.exchange(entry))
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.push_idle(idle);
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolGetStats(hipblasHandlePool_t pool, hipblasHandlePoolStats_t* stats)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!stats)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto&                       state = *pool->state;
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    stats->handlesCreated  = state.created;
+    stats->acquires        = state.acquires;
+    stats->threadCacheHits = state.thread_cache_hits;
+    stats->sharedHits      = state.shared_hits;
+    stats->releases        = state.releases;
+    stats->handlesInUse    = state.in_use;
+    stats->handlesIdle     = state.handles.size() - state.in_use;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
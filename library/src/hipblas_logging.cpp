@@ -0,0 +1,978 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "logging.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+int hipblas_layer_from_env()
+{
+    const char* layer = getenv("HIPBLAS_LAYER");
+    return layer ? int(strtol(layer, nullptr, 0)) : hipblas_layer_mode_none;
+}
+
+hipblasLogNames::hipblasLogNames(const char* list)
+{
+    std::string name;
+    for(const char* c = list;; ++c)
+    {
+        if(*c == ',' || !*c)
+        {
+            names.push_back(name);
+            name.clear();
+            if(!*c)
+                break;
+        }
+        else if(!isspace(static_cast<unsigned char>(*c)))
+            name += *c;
+    }
+}
+
+namespace
+{
+    // Records of one thread. The thread is the only writer of head and the flushing thread
+    // the only writer of tail, so neither side locks.
+    class hipblasLogRing
+    {
+        static constexpr size_t capacity = 256;
+
+        hipblasLogRecord    records[capacity];
+        std::atomic<size_t> head{0};
+        std::atomic<size_t> tail{0};
+
+    public:
+        const int thread;
+
+        explicit hipblasLogRing(int thread)
+            : thread(thread)
+        {
+        }
+
+        bool empty() const
+        {
+            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+        }
+
+        bool full() const
+        {
+            return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire)
+                   == capacity;
+        }
+
+        // Only valid when not full
+        hipblasLogRecord& next()
+        {
+            return records[head.load(std::memory_order_relaxed) % capacity];
+        }
+
+        void commit()
+        {
+            head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        template <typename F>
+        void drain(F&& write)
+        {
+            size_t end = head.load(std::memory_order_acquire);
+            for(size_t i = tail.load(std::memory_order_relaxed); i != end; ++i)
+            {
+                write(*this, records[i % capacity]);
+                tail.store(i + 1, std::memory_order_release);
+            }
+        }
+    };
+
+    const char* hipblas_log_operation(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_OP_N:
+            return "N";
+        case HIPBLAS_OP_T:
+            return "T";
+        case HIPBLAS_OP_C:
+            return "C";
+        }
+        return nullptr;
+    }
+
+    const char* hipblas_log_fill(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_FILL_MODE_UPPER:
+            return "U";
+        case HIPBLAS_FILL_MODE_LOWER:
+            return "L";
+        case HIPBLAS_FILL_MODE_FULL:
+            return "F";
+        }
+        return nullptr;
+    }
+
+    const char* hipblas_log_diagonal(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_DIAG_NON_UNIT:
+            return "N";
+        case HIPBLAS_DIAG_UNIT:
+            return "U";
+        }
+        return nullptr;
+    }
+
+    const char* hipblas_log_side(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_SIDE_LEFT:
+            return "L";
+        case HIPBLAS_SIDE_RIGHT:
+            return "R";
+        case HIPBLAS_SIDE_BOTH:
+            return "B";
+        }
+        return nullptr;
+    }
+
+    const char* hipblas_log_data_type(int64_t value)
+    {
+        switch(value)
+        {
+        case HIP_R_16F:
+            return "f16_r";
+        case HIP_R_32F:
+            return "f32_r";
+        case HIP_R_64F:
+            return "f64_r";
+        case HIP_C_16F:
+            return "f16_c";
+        case HIP_C_32F:
+            return "f32_c";
+        case HIP_C_64F:
+            return "f64_c";
+        case HIP_R_8I:
+            return "i8_r";
+        case HIP_R_8U:
+            return "u8_r";
+        case HIP_R_32I:
+            return "i32_r";
+        case HIP_R_32U:
+            return "u32_r";
+        case HIP_C_8I:
+            return "i8_c";
+        case HIP_C_8U:
+            return "u8_c";
+        case HIP_C_32I:
+            return "i32_c";
+        case HIP_C_32U:
+            return "u32_c";
+        case HIP_R_16BF:
+            return "bf16_r";
+        case HIP_C_16BF:
+            return "bf16_c";
+        }
+        return nullptr;
+    }
+
+#ifndef HIPBLAS_V2
+    const char* hipblas_log_datatype(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_R_16F:
+            return "f16_r";
+        case HIPBLAS_R_32F:
+            return "f32_r";
+        case HIPBLAS_R_64F:
+            return "f64_r";
+        case HIPBLAS_C_16F:
+            return "f16_c";
+        case HIPBLAS_C_32F:
+            return "f32_c";
+        case HIPBLAS_C_64F:
+            return "f64_c";
+        case HIPBLAS_R_8I:
+            return "i8_r";
+        case HIPBLAS_R_8U:
+            return "u8_r";
+        case HIPBLAS_R_32I:
+            return "i32_r";
+        case HIPBLAS_R_32U:
+            return "u32_r";
+        case HIPBLAS_C_8I:
+            return "i8_c";
+        case HIPBLAS_C_8U:
+            return "u8_c";
+        case HIPBLAS_C_32I:
+            return "i32_c";
+        case HIPBLAS_C_32U:
+            return "u32_c";
+        case HIPBLAS_R_16B:
+            return "bf16_r";
+        case HIPBLAS_C_16B:
+            return "bf16_c";
+        }
+        return nullptr;
+    }
+#else
+    const char* hipblas_log_datatype(int64_t value)
+    {
+        return hipblas_log_data_type(value);
+    }
+#endif
+
+    const char* hipblas_log_compute_type(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_COMPUTE_16F:
+            return "c16f";
+        case HIPBLAS_COMPUTE_16F_PEDANTIC:
+            return "c16f_pedantic";
+        case HIPBLAS_COMPUTE_32F:
+            return "c32f";
+        case HIPBLAS_COMPUTE_32F_PEDANTIC:
+            return "c32f_pedantic";
+        case HIPBLAS_COMPUTE_32F_FAST_16F:
+            return "c32f_fast_16f";
+        case HIPBLAS_COMPUTE_32F_FAST_16BF:
+            return "c32f_fast_16Bf";
+        case HIPBLAS_COMPUTE_32F_FAST_TF32:
+            return "c32f_fast_tf32";
+        case HIPBLAS_COMPUTE_64F:
+            return "c64f";
+        case HIPBLAS_COMPUTE_64F_PEDANTIC:
+            return "c64f_pedantic";
+        case HIPBLAS_COMPUTE_32I:
+            return "c32i";
+        case HIPBLAS_COMPUTE_32I_PEDANTIC:
+            return "c32i_pedantic";
+        }
+        return nullptr;
+    }
+
+    const char* hipblas_log_pointer_mode(int64_t value)
+    {
+        return value == HIPBLAS_POINTER_MODE_DEVICE ? "device" : "host";
+    }
+
+    const char* hipblas_log_atomics_mode(int64_t value)
+    {
+        return value == HIPBLAS_ATOMICS_ALLOWED ? "allowed" : "not_allowed";
+    }
+
+    const char* hipblas_log_eig_mode(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_EIG_MODE_NOVECTOR:
+            return "N";
+        case HIPBLAS_EIG_MODE_VECTOR:
+            return "V";
+        }
+        return nullptr;
+    }
+
+    const char* hipblas_log_svd_mode(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_SVD_MODE_NOVECTOR:
+            return "N";
+        case HIPBLAS_SVD_MODE_SINGULAR:
+            return "S";
+        case HIPBLAS_SVD_MODE_ALL:
+            return "A";
+        }
+        return nullptr;
+    }
+}
+
+const char* hipblas_log_enum(const hipblasLogArg& arg)
+{
+    switch(arg.kind)
+    {
+    case hipblasLogKind::operation:
+        return hipblas_log_operation(arg.i);
+    case hipblasLogKind::fill:
+        return hipblas_log_fill(arg.i);
+    case hipblasLogKind::diagonal:
+        return hipblas_log_diagonal(arg.i);
+    case hipblasLogKind::side:
+        return hipblas_log_side(arg.i);
+    case hipblasLogKind::datatype:
+        return hipblas_log_datatype(arg.i);
+    case hipblasLogKind::data_type:
+        return hipblas_log_data_type(arg.i);
+    case hipblasLogKind::compute_type:
+        return hipblas_log_compute_type(arg.i);
+    case hipblasLogKind::pointer_mode:
+        return hipblas_log_pointer_mode(arg.i);
+    case hipblasLogKind::atomics_mode:
+        return hipblas_log_atomics_mode(arg.i);
+    case hipblasLogKind::eig_mode:
+        return hipblas_log_eig_mode(arg.i);
+    case hipblasLogKind::svd_mode:
+        return hipblas_log_svd_mode(arg.i);
+    default:
+        return nullptr;
+    }
+}
+
+void hipblas_bench_function(const char*  function,
+                            std::string& bench_function,
+                            std::string& precision,
+                            bool&        ilp64)
+{
+    auto ends_with = [](const std::string& s, const char* suffix) {
+        size_t len = strlen(suffix);
+        return s.size() > len && !s.compare(s.size() - len, len, suffix);
+    };
+    auto starts_with = [](const std::string& s, const char* prefix) {
+        return !s.compare(0, strlen(prefix), prefix);
+    };
+
+    std::string name = function + strlen("hipblas");
+
+    ilp64 = ends_with(name, "_64");
+    if(ilp64)
+        name.erase(name.size() - 3);
+    if(ends_with(name, "_v2"))
+        name.erase(name.size() - 3);
+    if(ends_with(name, "WithFlags"))
+        name.erase(name.size() - strlen("WithFlags"));
+
+    precision.clear();
+    auto letter_precision = [&](char c) {
+        switch(tolower(c))
+        {
+        case 'h':
+            precision = "f16_r";
+            break;
+        case 's':
+            precision = "f32_r";
+            break;
+        case 'd':
+            precision = "f64_r";
+            break;
+        case 'c':
+            precision = "f32_c";
+            break;
+        case 'z':
+            precision = "f64_c";
+            break;
+        }
+    };
+
+    if(name.size() > 2 && name[0] == 'I' && islower(name[1]))
+    {
+        // Isamax, Icamin
+        letter_precision(name[1]);
+        name = "i" + name.substr(2);
+    }
+    else if(starts_with(name, "Bf") && name.size() > 2 && islower(name[2]))
+    {
+        precision = "bf16_r";
+        name.erase(0, 2);
+    }
+    else if(name.size() > 1 && strchr("HSDCZ", name[0]) && islower(name[1]))
+    {
+        letter_precision(name[0]);
+        name.erase(0, 1);
+
+        // Scasum and Dznrm2 work on complex vectors, Csscal and Zdrot on complex vectors
+        // with a real scalar
+        if((precision == "f32_r" && starts_with(name, "c"))
+           || (precision == "f64_r" && starts_with(name, "z")))
+        {
+            if(starts_with(name.substr(1), "asum") || starts_with(name.substr(1), "nrm2"))
+            {
+                precision[precision.size() - 1] = 'c';
+                name.erase(0, 1);
+            }
+        }
+        else if((precision == "f32_c" && (starts_with(name, "sscal") || starts_with(name, "srot")))
+                || (precision == "f64_c"
+                    && (starts_with(name, "dscal") || starts_with(name, "drot"))))
+            name.erase(0, 1);
+    }
+
+    // CamelCase suffixes to snake case: gemmStridedBatched to gemm_strided_batched, and
+    // GemmBatchedEx to gemm_batched_ex
+    bench_function.clear();
+    for(char c : name)
+    {
+        if(isupper(static_cast<unsigned char>(c)))
+        {
+            if(!bench_function.empty())
+                bench_function += '_';
+            bench_function += char(tolower(c));
+        }
+        else
+            bench_function += c;
+    }
+}
+
+namespace
+{
+    // Scalar type of an argument of datatype kind, untyped if it names no real or complex type
+    hipblasLogScalar hipblas_log_scalar_of(const hipblasLogArg& arg, bool complex)
+    {
+        const char* type = arg.kind == hipblasLogKind::compute_type ? nullptr : hipblas_log_enum(arg);
+        if(arg.kind == hipblasLogKind::compute_type)
+        {
+            switch(arg.i)
+            {
+            case HIPBLAS_COMPUTE_16F:
+            case HIPBLAS_COMPUTE_16F_PEDANTIC:
+                return hipblasLogScalar::f16;
+            case HIPBLAS_COMPUTE_64F:
+            case HIPBLAS_COMPUTE_64F_PEDANTIC:
+                return complex ? hipblasLogScalar::c64 : hipblasLogScalar::f64;
+            case HIPBLAS_COMPUTE_32I:
+            case HIPBLAS_COMPUTE_32I_PEDANTIC:
+                return hipblasLogScalar::untyped;
+            default:
+                return complex ? hipblasLogScalar::c32 : hipblasLogScalar::f32;
+            }
+        }
+        if(!type)
+            return hipblasLogScalar::untyped;
+
+        static const std::pair<const char*, hipblasLogScalar> types[] = {
+            {"f16_r", hipblasLogScalar::f16},
+            {"bf16_r", hipblasLogScalar::bf16},
+            {"f32_r", hipblasLogScalar::f32},
+            {"f64_r", hipblasLogScalar::f64},
+            {"f32_c", hipblasLogScalar::c32},
+            {"f64_c", hipblasLogScalar::c64},
+        };
+        for(auto& t : types)
+            if(!strcmp(type, t.first))
+                return t.second;
+        return hipblasLogScalar::untyped;
+    }
+
+    float hipblas_log_half_to_float(uint16_t h)
+    {
+        uint32_t sign     = uint32_t(h & 0x8000) << 16;
+        uint32_t exponent = (h >> 10) & 0x1f;
+        uint32_t mantissa = h & 0x3ff;
+        uint32_t bits;
+
+        if(exponent == 0x1f)
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        else if(exponent)
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        else if(mantissa)
+        {
+            // Subnormal half, normalize it
+            exponent = 113;
+            while(!(mantissa & 0x400))
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+        }
+        else
+            bits = sign;
+
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    // Replaces a pointer to a host scalar by its value
+    void hipblas_log_read_scalar(hipblasLogArg& arg, hipblasLogScalar scalar)
+    {
+        const void* p = arg.p;
+        switch(scalar)
+        {
+        case hipblasLogScalar::f16:
+        case hipblasLogScalar::bf16:
+        {
+            uint16_t bits;
+            memcpy(&bits, p, sizeof(bits));
+            arg.d[0] = scalar == hipblasLogScalar::f16 ? hipblas_log_half_to_float(bits) : [&] {
+                uint32_t fbits = uint32_t(bits) << 16;
+                float    f;
+                memcpy(&f, &fbits, sizeof(f));
+                return f;
+            }();
+            arg.kind = hipblasLogKind::real;
+            break;
+        }
+        case hipblasLogScalar::f32:
+            arg.d[0] = *static_cast<const float*>(p);
+            arg.kind = hipblasLogKind::real;
+            break;
+        case hipblasLogScalar::f64:
+            arg.d[0] = *static_cast<const double*>(p);
+            arg.kind = hipblasLogKind::real;
+            break;
+        case hipblasLogScalar::c32:
+            arg.d[0] = static_cast<const float*>(p)[0];
+            arg.d[1] = static_cast<const float*>(p)[1];
+            arg.kind = hipblasLogKind::complex;
+            break;
+        case hipblasLogScalar::c64:
+            arg.d[0] = static_cast<const double*>(p)[0];
+            arg.d[1] = static_cast<const double*>(p)[1];
+            arg.kind = hipblasLogKind::complex;
+            break;
+        default:
+            return;
+        }
+        arg.scalar = scalar;
+    }
+
+    // Names of the datatype arguments giving the type of untyped alpha and beta, by priority
+    constexpr const char* hipblas_log_scalar_type_names[]
+        = {"alphaType", "executionType", "compute_type", "computeType"};
+
+    // hipblas-bench options of the integer and enum arguments, by argument name
+    constexpr std::pair<const char*, const char*> hipblas_bench_options[] = {
+        {"m", "-m"},
+        {"n", "-n"},
+        {"k", "-k"},
+        {"kl", "--kl"},
+        {"ku", "--ku"},
+        {"lda", "--lda"},
+        {"ldb", "--ldb"},
+        {"ldc", "--ldc"},
+        {"incx", "--incx"},
+        {"incy", "--incy"},
+        {"trans", "--transposeA"},
+        {"transa", "--transposeA"},
+        {"transA", "--transposeA"},
+        {"transb", "--transposeB"},
+        {"transB", "--transposeB"},
+        {"side", "--side"},
+        {"uplo", "--uplo"},
+        {"diag", "--diag"},
+        {"jobz", "--jobz"},
+        {"jobu", "--jobu"},
+        {"jobv", "--jobv"},
+        {"ldu", "--ldb"}, // hipblas-bench gesvd takes ldu and ldv from ldb and ldc
+        {"ldv", "--ldc"},
+        {"batchCount", "--batch_count"},
+        {"batch_count", "--batch_count"},
+        {"flags", "--flags"},
+    };
+
+    // hipblas-bench option of a stride argument, strideA, stride_A and strideAP are all --stride_a
+    const char* hipblas_bench_stride_option(const std::string& name)
+    {
+        if(name.compare(0, 6, "stride"))
+            return nullptr;
+
+        std::string matrix = name.substr(6);
+        matrix.erase(std::remove(matrix.begin(), matrix.end(), '_'), matrix.end());
+        std::transform(matrix.begin(), matrix.end(), matrix.begin(), ::tolower);
+        if(matrix == "a" || matrix == "ap")
+            return "--stride_a";
+        if(matrix == "b")
+            return "--stride_b";
+        if(matrix == "c")
+            return "--stride_c";
+        if(matrix == "x")
+            return "--stride_x";
+        if(matrix == "y")
+            return "--stride_y";
+        return nullptr;
+    }
+
+    class hipblasLogger
+    {
+        std::mutex              mutex;
+        std::mutex              flush_mutex;
+        std::condition_variable wake;
+        std::thread             flusher;
+        bool                    stop = false;
+
+        std::vector<std::shared_ptr<hipblasLogRing>> rings;
+        int                                          threads = 0;
+
+        std::unique_ptr<std::ofstream> trace_file, bench_file;
+        std::ostream*                  trace_os = nullptr;
+        std::ostream*                  bench_os = nullptr;
+
+        static std::ostream* open(const char* variable, std::unique_ptr<std::ofstream>& file)
+        {
+            const char* path = getenv(variable);
+            if(path && *path)
+            {
+                file = std::make_unique<std::ofstream>(path);
+                if(file->is_open())
+                    return file.get();
+                std::cerr << "hipBLAS: cannot open " << variable << " " << path
+                          << ", logging to standard error" << std::endl;
+            }
+            return &std::cerr;
+        }
+
+        void write_trace(const hipblasLogRing& ring, const hipblasLogRecord& record, std::ostream& os)
+        {
+            const auto& names = record.names->names;
+
+            os << "- { call: " << record.call << ", thread: " << ring.thread
+               << ", function: " << record.function << ", handle: " << record.handle
+               << ", device: " << record.device << ", stream: " << record.stream
+               << ", pointer_mode: " << hipblas_log_pointer_mode(record.pointer_mode)
+               << ", atomics_mode: " << hipblas_log_atomics_mode(record.atomics_mode)
+               << ", math_mode: " << int(record.math_mode);
+
+            for(int i = 0; i < record.nargs; i++)
+            {
+                const hipblasLogArg& arg = record.args[i];
+                os << ", " << names[i + 1] << ": ";
+                switch(arg.kind)
+                {
+                case hipblasLogKind::integer:
+                case hipblasLogKind::gemm_algo:
+                case hipblasLogKind::gemm_flags:
+                case hipblasLogKind::math_mode:
+                case hipblasLogKind::capture_mode:
+                    os << arg.i;
+                    break;
+                case hipblasLogKind::pointer:
+                    os << arg.p;
+                    break;
+                case hipblasLogKind::real:
+                    write_real(os, arg.d[0], arg.scalar);
+                    break;
+                case hipblasLogKind::complex:
+                    os << "'(";
+                    write_real(os, arg.d[0], arg.scalar);
+                    os << ":";
+                    write_real(os, arg.d[1], arg.scalar);
+                    os << ")'";
+                    break;
+                default:
+                    if(const char* value = hipblas_log_enum(arg))
+                        os << value;
+                    else
+                        os << arg.i;
+                }
+            }
+            os << " }\n";
+        }
+
+        static void write_real(std::ostream& os, double value, hipblasLogScalar scalar)
+        {
+            bool single = scalar != hipblasLogScalar::f64 && scalar != hipblasLogScalar::c64;
+            auto precision = os.precision(single ? 9 : 17);
+            os << value;
+            os.precision(precision);
+        }
+
+        void write_bench(const hipblasLogRecord& record, std::ostream& os)
+        {
+            const auto& names = record.names->names;
+
+            // The auxiliary functions and workspace queries have no hipblas-bench equivalent
+            size_t length = strlen(record.function);
+            if(!strcmp(record.function, "hipblasDestroy")
+               || !strncmp(record.function, "hipblasSet", strlen("hipblasSet"))
+               || (length > strlen("WorkspaceSize")
+                   && !strcmp(record.function + length - strlen("WorkspaceSize"), "WorkspaceSize")))
+                return;
+
+            std::string function, precision;
+            bool        ilp64;
+            hipblas_bench_function(record.function, function, precision, ilp64);
+
+            // getrf with a null pivot array is the getrf_npvt test
+            for(int i = 0; i < record.nargs; i++)
+                if(names[i + 1] == "ipiv" && !record.args[i].p && !function.compare(0, 5, "getrf"))
+                    function.insert(5, "_npvt");
+
+            std::ostringstream options;
+            const char*        type_options[] = {"--a_type", "--b_type", "--c_type"};
+            int                types          = 0;
+
+            for(int i = 0; i < record.nargs; i++)
+            {
+                const hipblasLogArg& arg  = record.args[i];
+                const std::string&   name = names[i + 1];
+
+                if(arg.kind == hipblasLogKind::real || arg.kind == hipblasLogKind::complex)
+                {
+                    if(name != "alpha" && name != "beta")
+                        continue;
+                    options << " --" << name << " ";
+                    write_real(options, arg.d[0], arg.scalar);
+                    if(arg.kind == hipblasLogKind::complex)
+                    {
+                        options << " --" << name << "i ";
+                        write_real(options, arg.d[1], arg.scalar);
+                    }
+                }
+                else if(arg.kind == hipblasLogKind::datatype
+                        || arg.kind == hipblasLogKind::data_type)
+                {
+                    const char* type = hipblas_log_enum(arg);
+                    if(!type)
+                        continue;
+                    if(name == "executionType" || name == "compute_type" || name == "computeType")
+                        options << " --compute_type " << type;
+                    else if(types < 3)
+                    {
+                        if(!types && precision.empty())
+                            precision = type;
+                        options << " " << type_options[types++] << " " << type;
+                    }
+                }
+                else if(arg.kind == hipblasLogKind::compute_type)
+                {
+                    if(const char* type = hipblas_log_enum(arg))
+                        options << " --compute_type_gemm " << type;
+                }
+                else if(arg.kind != hipblasLogKind::pointer)
+                {
+                    const char* option = hipblas_bench_stride_option(name);
+                    for(auto& o : hipblas_bench_options)
+                        if(name == o.first)
+                            option = o.second;
+                    if(!option)
+                        continue;
+
+                    options << " " << option << " ";
+                    if(const char* value = hipblas_log_enum(arg))
+                        options << value;
+                    else
+                        options << arg.i;
+                }
+            }
+
+            os << "hipblas-bench -f " << function;
+            if(!precision.empty())
+                os << " -r " << precision;
+            os << options.str();
+            if(ilp64)
+                os << " --api 1";
+            if(record.atomics_mode == HIPBLAS_ATOMICS_NOT_ALLOWED)
+                os << " --atomics_not_allowed";
+            os << "\n";
+        }
+
+    public:
+        // Writes the records of all rings, forgetting the rings of exited threads once empty.
+        // Only one thread drains the rings at a time.
+        void flush()
+        {
+            std::lock_guard<std::mutex>                  flush_lock(flush_mutex);
+            std::vector<std::shared_ptr<hipblasLogRing>> current;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                rings.erase(std::remove_if(rings.begin(),
+                                           rings.end(),
+                                           [](const auto& ring) {
+                                               return ring.use_count() == 1 && ring->empty();
+                                           }),
+                            rings.end());
+                current = rings;
+            }
+
+            for(auto& ring : current)
+                ring->drain([&](const hipblasLogRing& r, const hipblasLogRecord& record) {
+                    if(trace_os)
+                        write_trace(r, record, *trace_os);
+                    if(bench_os)
+                        write_bench(record, *bench_os);
+                });
+
+            if(trace_os)
+                trace_os->flush();
+            if(bench_os)
+                bench_os->flush();
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(!stop)
+            {
+                wake.wait_for(lock, std::chrono::milliseconds(100));
+                lock.unlock();
+                flush();
+                lock.lock();
+            }
+        }
+
+    public:
+        std::atomic<uint64_t> calls{0};
+        std::atomic<bool>     stopped{false};
+
+        hipblasLogger()
+        {
+            int layer = hipblas_layer();
+            if(layer & hipblas_layer_mode_log_trace)
+                trace_os = open("HIPBLAS_LOG_TRACE_PATH", trace_file);
+            if(layer & hipblas_layer_mode_log_bench)
+                bench_os = open("HIPBLAS_LOG_BENCH_PATH", bench_file);
+        }
+
+        // Called at exit. Later calls are written by the calling thread.
+        void stop_flusher()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            wake.notify_one();
+            if(flusher.joinable())
+                flusher.join();
+            stopped = true;
+            flush();
+        }
+
+        std::shared_ptr<hipblasLogRing> add_ring()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!flusher.joinable() && !stop)
+                flusher = std::thread(&hipblasLogger::run, this);
+
+            rings.push_back(std::make_shared<hipblasLogRing>(threads++));
+            return rings.back();
+        }
+
+        void notify()
+        {
+            wake.notify_one();
+        }
+    };
+
+    // Never destroyed, functions may still be called during static destruction
+    hipblasLogger& hipblas_logger()
+    {
+        static auto* logger = new hipblasLogger;
+        static struct stop_at_exit
+        {
+            ~stop_at_exit()
+            {
+                logger->stop_flusher();
+            }
+        } stop;
+        return *logger;
+    }
+
+    hipblasLogRing& hipblas_log_ring()
+    {
+        thread_local std::shared_ptr<hipblasLogRing> ring = hipblas_logger().add_ring();
+        return *ring;
+    }
+}
+
+hipblasLogRecord&
+    hipblas_log_begin(const char* function, const hipblasLogNames& names, hipblasHandle_t handle)
+{
+    hipblasLogger&  logger = hipblas_logger();
+    hipblasLogRing& ring   = hipblas_log_ring();
+
+    // Never drop a record, a trace with gaps cannot be replayed
+    while(ring.full())
+    {
+        if(logger.stopped)
+            logger.flush();
+        logger.notify();
+        std::this_thread::yield();
+    }
+
+    hipblasLogRecord& record = ring.next();
+    record.call              = logger.calls++;
+    record.function          = function;
+    record.names             = &names;
+    record.handle            = handle;
+    record.stream            = nullptr;
+    record.device            = -1;
+    record.pointer_mode      = HIPBLAS_POINTER_MODE_HOST;
+    record.atomics_mode      = HIPBLAS_ATOMICS_ALLOWED;
+    record.math_mode         = HIPBLAS_DEFAULT_MATH;
+
+    if(handle)
+    {
+        hipblasGetStream(handle, &record.stream);
+        hipblasGetPointerMode(handle, &record.pointer_mode);
+        hipblasGetAtomicsMode(handle, &record.atomics_mode);
+        hipblasGetMathMode(handle, &record.math_mode);
+    }
+    if(hipGetDevice(&record.device) != hipSuccess)
+        record.device = -1;
+
+    return record;
+}
+
+void hipblas_log_end(hipblasLogRecord& record)
+{
+    const auto& names = record.names->names;
+
+    if(record.pointer_mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        bool complex = false;
+        for(int i = 0; i < record.nargs; i++)
+            if(record.args[i].kind == hipblasLogKind::datatype
+               || record.args[i].kind == hipblasLogKind::data_type)
+                complex |= hipblas_log_scalar_of(record.args[i], false) == hipblasLogScalar::c32
+                           || hipblas_log_scalar_of(record.args[i], false) == hipblasLogScalar::c64;
+
+        for(int i = 0; i < record.nargs; i++)
+        {
+            hipblasLogArg& arg = record.args[i];
+            if(arg.kind != hipblasLogKind::pointer || !arg.p
+               || (names[i + 1] != "alpha" && names[i + 1] != "beta"))
+                continue;
+
+            hipblasLogScalar scalar = arg.scalar;
+            for(const char* type_name : hipblas_log_scalar_type_names)
+            {
+                if(scalar != hipblasLogScalar::untyped)
+                    break;
+                for(int j = 0; j < record.nargs; j++)
+                    if(names[j + 1] == type_name)
+                        scalar = hipblas_log_scalar_of(record.args[j], complex);
+            }
+            hipblas_log_read_scalar(arg, scalar);
+        }
+    }
+
+    hipblas_log_ring().commit();
+
+    hipblasLogger& logger = hipblas_logger();
+    if(logger.stopped)
+        logger.flush();
+}
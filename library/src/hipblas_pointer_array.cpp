@@ -0,0 +1,283 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "pointer_array.hpp"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int     HIPBLAS_POINTER_ARRAY_BLOCK = 256;
+    constexpr int64_t HIPBLAS_POINTER_ARRAY_GRID  = 65535;
+
+    // Each thread writes every (gridDim.x * blockDim.x)th pointer of the array
+    __global__ void hipblas_pointer_array_strided_kernel(void**      array,
+                                                         const char* base,
+                                                         int64_t     stride_bytes,
+                                                         int64_t     batch_count)
+    {
+        const int64_t step = int64_t(gridDim.x) * blockDim.x;
+        for(int64_t b = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; b < batch_count; b += step)
+            array[b] = (void*)(base + b * stride_bytes);
+    }
+
+    __global__ void hipblas_pointer_array_offsets_kernel(void**               array,
+                                                         const char*          base,
+                                                         int                  elem_size,
+                                                         const hipblasStride* offsets,
+                                                         int64_t              batch_count)
+    {
+        const int64_t step = int64_t(gridDim.x) * blockDim.x;
+        for(int64_t b = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; b < batch_count; b += step)
+            array[b] = (void*)(base + offsets[b] * elem_size);
+    }
+
+    // Each block copies a column of the matrix, bytes of a column in steps of the block
+    __device__ void hipblas_copy_matrix(int64_t     row_bytes,
+                                        int64_t     cols,
+                                        const char* a,
+                                        int64_t     lda_bytes,
+                                        char*       b,
+                                        int64_t     ldb_bytes)
+    {
+        for(int64_t col = blockIdx.y; col < cols; col += gridDim.y)
+            for(int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; i < row_bytes;
+                i += int64_t(gridDim.x) * blockDim.x)
+                b[col * ldb_bytes + i] = a[col * lda_bytes + i];
+    }
+
+    __global__ void hipblas_copy_matrix_batched_kernel(int64_t           row_bytes,
+                                                       int64_t           cols,
+                                                       const void* const A[],
+                                                       int64_t           lda_bytes,
+                                                       void* const       B[],
+                                                       int64_t           ldb_bytes)
+    {
+        hipblas_copy_matrix(row_bytes,
+                            cols,
+                            static_cast<const char*>(A[blockIdx.z]),
+                            lda_bytes,
+                            static_cast<char*>(B[blockIdx.z]),
+                            ldb_bytes);
+    }
+
+    __global__ void hipblas_copy_matrix_strided_batched_kernel(int64_t     row_bytes,
+                                                               int64_t     cols,
+                                                               const char* A,
+                                                               int64_t     lda_bytes,
+                                                               int64_t     stride_a_bytes,
+                                                               char*       B,
+                                                               int64_t     ldb_bytes,
+                                                               int64_t     stride_b_bytes)
+    {
+        hipblas_copy_matrix(row_bytes,
+                            cols,
+                            A + blockIdx.z * stride_a_bytes,
+                            lda_bytes,
+                            B + blockIdx.z * stride_b_bytes,
+                            ldb_bytes);
+    }
+
+    // Grid of the copy kernels for up to 65535 matrices of row_bytes x cols bytes
+    dim3 hipblas_copy_matrix_grid(int64_t row_bytes, int64_t cols, int64_t batches)
+    {
+        return dim3(unsigned(std::min((row_bytes - 1) / HIPBLAS_POINTER_ARRAY_BLOCK + 1,
+                                      HIPBLAS_POINTER_ARRAY_GRID)),
+                    unsigned(std::min(cols, HIPBLAS_POINTER_ARRAY_GRID)),
+                    unsigned(batches));
+    }
+
+    // Stream of the handle and grid size of the kernels for batch_count > 0 pointers
+    hipblasStatus_t hipblas_pointer_array_grid(hipblasHandle_t handle,
+                                               int64_t         batch_count,
+                                               hipStream_t&    stream,
+                                               dim3&           grid)
+    {
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        grid = dim3(unsigned(std::min((batch_count - 1) / HIPBLAS_POINTER_ARRAY_BLOCK + 1,
+                                      HIPBLAS_POINTER_ARRAY_GRID)));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasBuildPointerArrayStrided(hipblasHandle_t handle,
+                                                void*           ptrArray[],
+                                                const void*     base,
+                                                int             elemSize,
+                                                hipblasStride   stride,
+                                                int64_t         batchCount)
+try
+{
+    HIPBLAS_LOG(handle, ptrArray, base, elemSize, stride, batchCount);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(elemSize <= 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!ptrArray || !base)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    dim3            grid;
+    hipblasStatus_t status = hipblas_pointer_array_grid(handle, batchCount, stream, grid);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipLaunchKernelGGL(hipblas_pointer_array_strided_kernel,
+                       grid,
+                       dim3(HIPBLAS_POINTER_ARRAY_BLOCK),
+                       0,
+                       stream,
+                       ptrArray,
+                       static_cast<const char*>(base),
+                       stride * elemSize,
+                       batchCount);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasBuildPointerArrayOffsets(hipblasHandle_t     handle,
+                                                void*               ptrArray[],
+                                                const void*         base,
+                                                int                 elemSize,
+                                                const hipblasStride offsets[],
+                                                int64_t             batchCount)
+try
+{
+    HIPBLAS_LOG(handle, ptrArray, base, elemSize, offsets, batchCount);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(elemSize <= 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!ptrArray || !base || !offsets)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    dim3            grid;
+    hipblasStatus_t status = hipblas_pointer_array_grid(handle, batchCount, stream, grid);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipLaunchKernelGGL(hipblas_pointer_array_offsets_kernel,
+                       grid,
+                       dim3(HIPBLAS_POINTER_ARRAY_BLOCK),
+                       0,
+                       stream,
+                       ptrArray,
+                       static_cast<const char*>(base),
+                       elemSize,
+                       offsets,
+                       batchCount);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCopyMatrixBatched(hipStream_t       stream,
+                                         int64_t           rows,
+                                         int64_t           cols,
+                                         int               elem_size,
+                                         const void* const A[],
+                                         int64_t           lda,
+                                         void* const       B[],
+                                         int64_t           ldb,
+                                         int64_t           batch_count)
+{
+    if(!rows || !cols || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // batches beyond the grid limit of 65535 in z are copied by further launches
+    const int64_t row_bytes = rows * elem_size;
+    for(int64_t b = 0; b < batch_count; b += HIPBLAS_POINTER_ARRAY_GRID)
+    {
+        const int64_t batches = std::min(batch_count - b, HIPBLAS_POINTER_ARRAY_GRID);
+        hipLaunchKernelGGL(hipblas_copy_matrix_batched_kernel,
+                           hipblas_copy_matrix_grid(row_bytes, cols, batches),
+                           dim3(HIPBLAS_POINTER_ARRAY_BLOCK),
+                           0,
+                           stream,
+                           row_bytes,
+                           cols,
+                           A + b,
+                           lda * elem_size,
+                           B + b,
+                           ldb * elem_size);
+        if(hipGetLastError() != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasCopyMatrixStridedBatched(hipStream_t   stream,
+                                                int64_t       rows,
+                                                int64_t       cols,
+                                                int           elem_size,
+                                                const void*   A,
+                                                int64_t       lda,
+                                                hipblasStride stride_A,
+                                                void*         B,
+                                                int64_t       ldb,
+                                                hipblasStride stride_B,
+                                                int64_t       batch_count)
+{
+    if(!rows || !cols || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    const int64_t row_bytes = rows * elem_size;
+    for(int64_t b = 0; b < batch_count; b += HIPBLAS_POINTER_ARRAY_GRID)
+    {
+        const int64_t batches = std::min(batch_count - b, HIPBLAS_POINTER_ARRAY_GRID);
+        hipLaunchKernelGGL(hipblas_copy_matrix_strided_batched_kernel,
+                           hipblas_copy_matrix_grid(row_bytes, cols, batches),
+                           dim3(HIPBLAS_POINTER_ARRAY_BLOCK),
+                           0,
+                           stream,
+                           row_bytes,
+                           cols,
+                           static_cast<const char*>(A) + b * stride_A * elem_size,
+                           lda * elem_size,
+                           stride_A * elem_size,
+                           static_cast<char*>(B) + b * stride_B * elem_size,
+                           ldb * elem_size,
+                           stride_B * elem_size);
+        if(hipGetLastError() != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
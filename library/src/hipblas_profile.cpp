@@ -0,0 +1,613 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "logging.hpp"
+
+// The flop and byte counts, shared with hipblas-bench
+#include "bytes.hpp"
+#include "flops.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+// A call being timed, its events are reused once its time is read
+struct hipblasProfileCall
+{
+    struct hipblasProfile* profile = nullptr;
+    hipEvent_t             start   = nullptr;
+    hipEvent_t             stop    = nullptr;
+    hipStream_t            stream  = nullptr;
+    const char*            function;
+    const hipblasLogNames* names;
+    int                    nargs;
+    hipblasLogArg          args[HIPBLAS_LOG_MAX_ARGS];
+};
+
+namespace
+{
+    // Times are binned in 8 bins per power of 2 of microseconds, from 2^-10 to 2^22 us, so
+    // percentiles are within 9% without keeping every time
+    constexpr int hipblas_profile_bins_per_octave = 8;
+    constexpr int hipblas_profile_min_octave      = -10;
+    constexpr int hipblas_profile_bins            = 32 * hipblas_profile_bins_per_octave;
+
+    int hipblas_profile_bin(double us)
+    {
+        if(!(us > 0))
+            return 0;
+        int bin = int(std::floor((std::log2(us) - hipblas_profile_min_octave)
+                                 * hipblas_profile_bins_per_octave));
+        return std::min(std::max(bin, 0), hipblas_profile_bins - 1);
+    }
+
+    // Geometric middle of a bin
+    double hipblas_profile_bin_us(int bin)
+    {
+        return std::exp2((bin + 0.5) / hipblas_profile_bins_per_octave
+                         + hipblas_profile_min_octave);
+    }
+
+    // Calls of one function with the same data types and integer and enum arguments
+    struct hipblasProfileEntry
+    {
+        std::string function;
+        std::string shape;
+        uint64_t    calls    = 0;
+        double      total_us = 0;
+        double      min_us   = 0;
+        double      max_us   = 0;
+        double      gflop    = 0; // per call, 0 if the function has no model
+        double      gbyte    = 0;
+        uint32_t    bins[hipblas_profile_bins]{};
+
+        double percentile(double p) const
+        {
+            uint64_t rank = uint64_t(std::ceil(p * calls));
+            uint64_t seen = 0;
+            for(int bin = 0; bin < hipblas_profile_bins; bin++)
+            {
+                seen += bins[bin];
+                if(seen >= rank && seen)
+                    return std::min(std::max(hipblas_profile_bin_us(bin), min_us), max_us);
+            }
+            return max_us;
+        }
+    };
+
+    int64_t hipblas_profile_int(const hipblasLogNames& names,
+                                const hipblasLogArg*   args,
+                                int                    nargs,
+                                std::initializer_list<const char*> candidates,
+                                int64_t                            missing = 0)
+    {
+        for(const char* name : candidates)
+            for(int i = 0; i < nargs; i++)
+                if(names.names[i + 1] == name && args[i].kind != hipblasLogKind::pointer)
+                    return args[i].i;
+        return missing;
+    }
+
+    // Flop and byte counts of one call with element type T, false if the function has no model
+    template <typename T>
+    bool hipblas_profile_model(const std::string&     routine,
+                               const hipblasLogNames& names,
+                               const hipblasLogArg*   args,
+                               int                    nargs,
+                               double&                gflop,
+                               double&                gbyte)
+    {
+        auto arg = [&](std::initializer_list<const char*> candidates) {
+            return hipblas_profile_int(names, args, nargs, candidates);
+        };
+
+        int64_t m = arg({"m"}), n = arg({"n"}), k = arg({"k"});
+        auto    trans = hipblasOperation_t(arg({"trans", "transa", "transA"}));
+        auto    side  = hipblasSideMode_t(arg({"side"}));
+        int64_t ka    = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+        if(routine == "asum")
+            gflop = asum_gflop_count<T>(n), gbyte = asum_gbyte_count<T>(n);
+        else if(routine == "axpy")
+            gflop = axpy_gflop_count<T>(n), gbyte = axpy_gbyte_count<T>(n);
+        else if(routine == "copy")
+            gflop = copy_gflop_count<T>(n), gbyte = copy_gbyte_count<T>(n);
+        else if(routine == "dot" || routine == "dotu")
+            gflop = dot_gflop_count<false, T>(n), gbyte = dot_gbyte_count<T>(n);
+        else if(routine == "dotc")
+            gflop = dot_gflop_count<true, T>(n), gbyte = dot_gbyte_count<T>(n);
+        else if(routine == "iamax" || routine == "iamin")
+            gflop = iamax_gflop_count<T>(n), gbyte = iamax_gbyte_count<T>(n);
+        else if(routine == "nrm2")
+            gflop = nrm2_gflop_count<T>(n), gbyte = nrm2_gbyte_count<T>(n);
+        else if(routine == "scal")
+            gflop = scal_gflop_count<T, T>(n), gbyte = scal_gbyte_count<T>(n);
+        else if(routine == "swap")
+            gflop = swap_gflop_count<T>(n), gbyte = swap_gbyte_count<T>(n);
+        else if(routine == "gemv")
+            gflop = gemv_gflop_count<T>(trans, m, n), gbyte = gemv_gbyte_count<T>(trans, m, n);
+        else if(routine == "gbmv")
+        {
+            int64_t kl = arg({"kl"}), ku = arg({"ku"});
+            gflop      = gbmv_gflop_count<T>(trans, m, n, kl, ku);
+            gbyte      = gbmv_gbyte_count<T>(trans, m, n, kl, ku);
+        }
+        else if(routine == "ger" || routine == "geru" || routine == "gerc")
+            gflop = ger_gflop_count<T>(m, n), gbyte = ger_gbyte_count<T>(m, n);
+        else if(routine == "symv")
+            gflop = symv_gflop_count<T>(n), gbyte = symv_gbyte_count<T>(n);
+        else if(routine == "hemv")
+            gflop = hemv_gflop_count<T>(n), gbyte = hemv_gbyte_count<T>(n);
+        else if(routine == "trmv")
+            gflop = trmv_gflop_count<T>(n), gbyte = trmv_gbyte_count<T>(n);
+        else if(routine == "trsv")
+            gflop = trsv_gflop_count<T>(n), gbyte = trsv_gbyte_count<T>(n);
+        else if(routine == "gemm")
+            gflop = gemm_gflop_count<T>(m, n, k), gbyte = gemm_gbyte_count<T>(m, n, k);
+        else if(routine == "symm")
+            gflop = symm_gflop_count<T>(m, n, ka), gbyte = symm_gbyte_count<T>(m, n, ka);
+        else if(routine == "hemm")
+            gflop = hemm_gflop_count<T>(m, n, ka), gbyte = hemm_gbyte_count<T>(m, n, ka);
+        else if(routine == "syrk")
+            gflop = syrk_gflop_count<T>(n, k), gbyte = syrk_gbyte_count<T>(n, k);
+        else if(routine == "herk")
+            gflop = herk_gflop_count<T>(n, k), gbyte = herk_gbyte_count<T>(n, k);
+        else if(routine == "syr2k")
+            gflop = syr2k_gflop_count<T>(n, k), gbyte = syr2k_gbyte_count<T>(n, k);
+        else if(routine == "her2k")
+            gflop = her2k_gflop_count<T>(n, k), gbyte = her2k_gbyte_count<T>(n, k);
+        else if(routine == "trmm")
+            gflop = trmm_gflop_count<T>(m, n, ka), gbyte = trmm_gbyte_count<T>(m, n, ka);
+        else if(routine == "trsm")
+            gflop = trsm_gflop_count<T>(m, n, ka), gbyte = trsm_gbyte_count<T>(m, n, ka);
+        else if(routine == "geam")
+            gflop = geam_gflop_count<T>(m, n), gbyte = geam_gbyte_count<T>(m, n);
+        else if(routine == "dgmm")
+            gflop = dgmm_gflop_count<T>(m, n), gbyte = dgmm_gbyte_count<T>(m, n, ka);
+        else if(routine == "getrf")
+            gflop = getrf_gflop_count<T>(n, n);
+        else if(routine == "getrs")
+            gflop = getrs_gflop_count<T>(n, arg({"nrhs"}));
+        else
+            return false;
+        return true;
+    }
+
+    // Flop and byte counts of a call, batched functions count every problem of the batch
+    void hipblas_profile_model(const char*            function,
+                               const hipblasLogNames& names,
+                               const hipblasLogArg*   args,
+                               int                    nargs,
+                               double&                gflop,
+                               double&                gbyte)
+    {
+        gflop = gbyte = 0;
+
+        std::string routine, precision;
+        bool        ilp64;
+        hipblas_bench_function(function, routine, precision, ilp64);
+
+        // Ex functions are counted with the type of their first matrix or vector
+        for(int i = 0; i < nargs && precision.empty(); i++)
+            if(args[i].kind == hipblasLogKind::datatype || args[i].kind == hipblasLogKind::data_type)
+                if(const char* type = hipblas_log_enum(args[i]))
+                    precision = type;
+
+        for(const char* suffix : {"_ex", "_strided_batched", "_batched"})
+        {
+            size_t len = strlen(suffix);
+            if(routine.size() > len && !routine.compare(routine.size() - len, len, suffix))
+                routine.erase(routine.size() - len);
+        }
+
+        bool known = false;
+        if(precision == "f16_r")
+            known = hipblas_profile_model<hipblasHalf>(routine, names, args, nargs, gflop, gbyte);
+        else if(precision == "bf16_r")
+            known
+                = hipblas_profile_model<hipblasBfloat16>(routine, names, args, nargs, gflop, gbyte);
+        else if(precision == "f32_r")
+            known = hipblas_profile_model<float>(routine, names, args, nargs, gflop, gbyte);
+        else if(precision == "f64_r")
+            known = hipblas_profile_model<double>(routine, names, args, nargs, gflop, gbyte);
+        else if(precision == "f32_c")
+            known
+                = hipblas_profile_model<hipblasComplex>(routine, names, args, nargs, gflop, gbyte);
+        else if(precision == "f64_c")
+            known = hipblas_profile_model<hipblasDoubleComplex>(
+                routine, names, args, nargs, gflop, gbyte);
+
+        if(!known)
+            gflop = gbyte = 0;
+
+        int64_t batch_count = hipblas_profile_int(names, args, nargs, {"batchCount", "batch_count"}, 1);
+        gflop *= batch_count;
+        gbyte *= batch_count;
+    }
+}
+
+// Timing of the calls of one handle
+struct hipblasProfile
+{
+    std::mutex mutex;
+    bool       active  = true;
+    bool       counted = false; // started with hipblasProfileStart, counted in hipblas_profiled_handles
+    int        device  = -1;
+
+    std::vector<std::unique_ptr<hipblasProfileCall>> calls;
+    std::vector<hipblasProfileCall*>                 idle;
+    std::deque<hipblasProfileCall*>                  pending;
+
+    std::unordered_map<std::string, hipblasProfileEntry> entries;
+
+    ~hipblasProfile()
+    {
+        for(auto& call : calls)
+        {
+            (void)hipEventDestroy(call->start);
+            (void)hipEventDestroy(call->stop);
+        }
+    }
+
+    // Must be called with mutex locked
+    hipblasProfileCall* acquire()
+    {
+        if(!idle.empty())
+        {
+            hipblasProfileCall* call = idle.back();
+            idle.pop_back();
+            return call;
+        }
+
+        auto call = std::make_unique<hipblasProfileCall>();
+        if(hipEventCreate(&call->start) != hipSuccess)
+            return nullptr;
+        if(hipEventCreate(&call->stop) != hipSuccess)
+        {
+            (void)hipEventDestroy(call->start);
+            return nullptr;
+        }
+        call->profile = this;
+        calls.push_back(std::move(call));
+        return calls.back().get();
+    }
+
+    // Must be called with mutex locked
+    void add(const hipblasProfileCall& call, double us)
+    {
+        std::ostringstream shape;
+        for(int i = 0; i < call.nargs; i++)
+        {
+            const hipblasLogArg& arg = call.args[i];
+            if(arg.kind == hipblasLogKind::pointer)
+                continue;
+            shape << ", " << call.names->names[i + 1] << ": ";
+            if(const char* value = hipblas_log_enum(arg))
+                shape << value;
+            else if(arg.kind == hipblasLogKind::real)
+                shape << arg.d[0];
+            else
+                shape << arg.i;
+        }
+
+        std::string key   = call.function + shape.str();
+        auto        found = entries.find(key);
+        if(found == entries.end())
+        {
+            found                  = entries.emplace(key, hipblasProfileEntry{}).first;
+            found->second.function = call.function;
+            found->second.shape    = shape.str();
+            found->second.min_us   = us;
+            hipblas_profile_model(call.function,
+                                  *call.names,
+                                  call.args,
+                                  call.nargs,
+                                  found->second.gflop,
+                                  found->second.gbyte);
+        }
+
+        hipblasProfileEntry& entry = found->second;
+        entry.calls++;
+        entry.total_us += us;
+        entry.min_us = std::min(entry.min_us, us);
+        entry.max_us = std::max(entry.max_us, us);
+        entry.bins[hipblas_profile_bin(us)]++;
+    }
+
+    // Reads the times of the finished calls, waiting for all of them if wait is true.
+    // Must be called with mutex locked.
+    void collect(bool wait)
+    {
+        while(!pending.empty())
+        {
+            hipblasProfileCall* call   = pending.front();
+            hipError_t          status = wait ? hipEventSynchronize(call->stop)
+                                              : hipEventQuery(call->stop);
+            if(status == hipErrorNotReady)
+                break;
+
+            float ms;
+            if(status == hipSuccess && hipEventElapsedTime(&ms, call->start, call->stop) == hipSuccess)
+                add(*call, ms * 1e3);
+
+            pending.pop_front();
+            idle.push_back(call);
+        }
+    }
+
+    // Must be called with mutex locked
+    void write(hipblasHandle_t handle, std::ostream& os)
+    {
+        collect(true);
+
+        std::vector<const hipblasProfileEntry*> sorted;
+        for(auto& entry : entries)
+            sorted.push_back(&entry.second);
+        std::sort(sorted.begin(), sorted.end(), [](auto a, auto b) {
+            return a->total_us > b->total_us;
+        });
+
+        os << "# hipBLAS profile of handle " << handle << ", device " << device << "\n";
+        for(const hipblasProfileEntry* entry : sorted)
+        {
+            double mean_us = entry->total_us / entry->calls;
+            os << "- { function: " << entry->function << entry->shape
+               << ", calls: " << entry->calls << ", total_us: " << entry->total_us
+               << ", mean_us: " << mean_us << ", min_us: " << entry->min_us
+               << ", p50_us: " << entry->percentile(0.5) << ", p90_us: " << entry->percentile(0.9)
+               << ", p99_us: " << entry->percentile(0.99) << ", max_us: " << entry->max_us;
+            if(entry->gflop)
+                os << ", gflops: " << entry->gflop / mean_us * 1e6;
+            if(entry->gbyte)
+                os << ", gbytes: " << entry->gbyte / mean_us * 1e6;
+            os << " }\n";
+        }
+        os.flush();
+    }
+
+    // Writes to path, or to HIPBLAS_PROFILE_PATH or standard error if path is nullptr.
+    // Must be called with mutex locked.
+    bool write(hipblasHandle_t handle, const char* path)
+    {
+        if(!path)
+            path = getenv("HIPBLAS_PROFILE_PATH");
+        if(!path || !*path)
+        {
+            write(handle, std::cerr);
+            return true;
+        }
+
+        std::ofstream file(path, std::ios::app);
+        if(!file.is_open())
+            return false;
+        write(handle, file);
+        return true;
+    }
+};
+
+namespace
+{
+    class hipblasProfileTable
+    {
+        std::mutex                                                           mutex;
+        std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasProfile>> profiles;
+
+    public:
+        // Returns the profile of handle, creating it if create is true
+        hipblasProfile* get(hipblasHandle_t handle, bool create)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto found = profiles.find(handle);
+            if(found != profiles.end())
+                return found->second.get();
+            if(!create)
+                return nullptr;
+
+            auto& profile = profiles[handle];
+            profile       = std::make_unique<hipblasProfile>();
+            if(hipGetDevice(&profile->device) != hipSuccess)
+                profile->device = -1;
+            return profile.get();
+        }
+
+        std::unique_ptr<hipblasProfile> erase(hipblasHandle_t handle)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            std::unique_ptr<hipblasProfile> profile;
+            auto                            found = profiles.find(handle);
+            if(found != profiles.end())
+            {
+                profile = std::move(found->second);
+                profiles.erase(found);
+            }
+            return profile;
+        }
+    };
+
+    // Never destroyed, handles may still be destroyed during static destruction
+    hipblasProfileTable& hipblas_profiles()
+    {
+        static auto* table = new hipblasProfileTable;
+        return *table;
+    }
+
+    // Setting the modes or the stream of a handle and destroying it are not timed
+    bool hipblas_profiled_function(const char* function)
+    {
+        return strcmp(function, "hipblasDestroy")
+               && strncmp(function, "hipblasSet", strlen("hipblasSet"));
+    }
+}
+
+hipblasProfileCall* hipblas_profile_begin(const char*            function,
+                                          const hipblasLogNames& names,
+                                          hipblasHandle_t        handle,
+                                          const hipblasLogArg*   args,
+                                          int                    nargs)
+{
+    if(!handle || !hipblas_profiled_function(function))
+        return nullptr;
+
+    hipblasProfile* profile
+        = hipblas_profiles().get(handle, hipblas_layer() & hipblas_layer_mode_profile);
+    if(!profile)
+        return nullptr;
+
+    hipStream_t stream;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return nullptr;
+
+#ifndef __HIP_PLATFORM_HOST__
+    // Events recorded into a hipGraph cannot be queried
+    hipStreamCaptureStatus capture_status;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return nullptr;
+#endif
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    if(!profile->active)
+        return nullptr;
+
+    profile->collect(false);
+
+    hipblasProfileCall* call = profile->acquire();
+    if(!call)
+        return nullptr;
+
+    call->stream   = stream;
+    call->function = function;
+    call->names    = &names;
+    call->nargs    = nargs;
+    std::copy(args, args + nargs, call->args);
+
+    if(hipEventRecord(call->start, stream) != hipSuccess)
+    {
+        profile->idle.push_back(call);
+        return nullptr;
+    }
+    return call;
+}
+
+void hipblas_profile_end(hipblasProfileCall* call)
+{
+    hipblasProfile&             profile = *call->profile;
+    std::lock_guard<std::mutex> lock(profile.mutex);
+
+    if(hipEventRecord(call->stop, call->stream) == hipSuccess)
+        profile.pending.push_back(call);
+    else
+        profile.idle.push_back(call);
+}
+
+void hipblas_profile_destroy(hipblasHandle_t handle)
+{
+    std::unique_ptr<hipblasProfile> profile = hipblas_profiles().erase(handle);
+    if(!profile)
+        return;
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    if(profile->counted)
+        hipblas_profiled_handles()--;
+
+    profile->collect(true);
+    if(!profile->entries.empty())
+        profile->write(handle, nullptr);
+}
+
+hipblasStatus_t hipblasProfileStart(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasProfile&             profile = *hipblas_profiles().get(handle, true);
+    std::lock_guard<std::mutex> lock(profile.mutex);
+
+    profile.collect(true);
+    profile.entries.clear();
+    profile.active = true;
+    if(!profile.counted)
+    {
+        profile.counted = true;
+        hipblas_profiled_handles()++;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasProfileStop(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasProfile* profile = hipblas_profiles().get(handle, false);
+    if(!profile)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    profile->active = false;
+    if(profile->counted)
+    {
+        profile->counted = false;
+        hipblas_profiled_handles()--;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasProfileDump(hipblasHandle_t handle, const char* path)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasProfile* profile = hipblas_profiles().get(handle, false);
+    if(!profile)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    return profile->write(handle, path) ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,585 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "half_convert.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int      HIPBLAS_SYRK_EX_TILE = 16;
+    constexpr unsigned HIPBLAS_SYRK_EX_GRID = 65535;
+
+    struct hipblas_complex_f
+    {
+        float x, y;
+    };
+
+    __device__ inline hipblas_complex_f operator*(hipblas_complex_f a, hipblas_complex_f b)
+    {
+        return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+    }
+
+    __device__ inline hipblas_complex_f operator+(hipblas_complex_f a, hipblas_complex_f b)
+    {
+        return {a.x + b.x, a.y + b.y};
+    }
+
+    // Element i of a complex matrix of type HIP_C_8I, HIP_C_16F or HIP_C_32F
+    __device__ inline hipblas_complex_f
+        hipblas_syrk_ex_load(const void* A, hipDataType type, int64_t i)
+    {
+        switch(type)
+        {
+        case HIP_C_8I:
+        {
+            const int8_t* p = static_cast<const int8_t*>(A) + 2 * i;
+            return {float(p[0]), float(p[1])};
+        }
+        case HIP_C_16F:
+        {
+            const uint16_t* p = static_cast<const uint16_t*>(A) + 2 * i;
+            return {hipblas_half_to_float(p[0]), hipblas_half_to_float(p[1])};
+        }
+        default:
+        {
+            const float* p = static_cast<const float*>(A) + 2 * i;
+            return {p[0], p[1]};
+        }
+        }
+    }
+
+    // The scalars are passed by value in host pointer mode and read by every block in device
+    // pointer mode. The scalars of herk are real.
+    struct hipblas_syrk_ex_scalar
+    {
+        hipblas_complex_f value;
+        const float*      ptr;
+    };
+
+    template <bool HERK>
+    __device__ inline hipblas_complex_f hipblas_syrk_ex_scalar_value(hipblas_syrk_ex_scalar s)
+    {
+        if(!s.ptr)
+            return s.value;
+        return {s.ptr[0], HERK ? 0.0f : s.ptr[1]};
+    }
+
+    // Each block of TILE x TILE threads computes a tile of C, and blocks of tiles outside the
+    // triangle of uplo return at once. The tiles of op(A) are converted to float as they are
+    // loaded to shared memory, so A is read in its own type, and the products are accumulated
+    // in float. Blocks along z take every gridDim.z-th problem of a batch.
+    template <bool HERK>
+    __global__ void hipblas_syrk_ex_kernel(hipblasFillMode_t      uplo,
+                                           hipblasOperation_t     trans,
+                                           int                    n,
+                                           int                    k,
+                                           hipblas_syrk_ex_scalar alpha_arg,
+                                           const void*            A,
+                                           hipDataType            a_type,
+                                           int64_t                lda,
+                                           hipblasStride          stride_A,
+                                           hipblas_syrk_ex_scalar beta_arg,
+                                           void*                  C,
+                                           int64_t                ldc,
+                                           hipblasStride          stride_C,
+                                           bool                   is_array,
+                                           int                    batch_count)
+    {
+        constexpr int TILE = HIPBLAS_SYRK_EX_TILE;
+
+        __shared__ hipblas_complex_f sA[TILE][TILE + 1];
+        __shared__ hipblas_complex_f sB[TILE][TILE + 1];
+
+        const int64_t i0 = int64_t(blockIdx.x) * TILE;
+        const int64_t j0 = int64_t(blockIdx.y) * TILE;
+        if(uplo == HIPBLAS_FILL_MODE_LOWER ? j0 >= i0 + TILE : i0 >= j0 + TILE)
+            return;
+
+        const hipblas_complex_f alpha      = hipblas_syrk_ex_scalar_value<HERK>(alpha_arg);
+        const hipblas_complex_f beta       = hipblas_syrk_ex_scalar_value<HERK>(beta_arg);
+        const bool              alpha_zero = (alpha.x == 0 && alpha.y == 0) || !k;
+        if(alpha_zero && beta.x == 1 && beta.y == 0)
+            return;
+
+        // Threads along x load consecutive elements of A in memory
+        const bool    trans_n = trans == HIPBLAS_OP_N;
+        const int     r       = trans_n ? threadIdx.x : threadIdx.y;
+        const int     l       = trans_n ? threadIdx.y : threadIdx.x;
+        const int64_t i       = i0 + threadIdx.x;
+        const int64_t j       = j0 + threadIdx.y;
+        const bool    in_C
+            = i < n && j < n && (uplo == HIPBLAS_FILL_MODE_LOWER ? i >= j : i <= j);
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const void* Ab = is_array ? static_cast<const void* const*>(A)[b] : A;
+            auto*       Cb = static_cast<hipblas_complex_f*>(
+                is_array ? static_cast<void* const*>(C)[b] : C);
+            const int64_t offset_A = is_array ? 0 : b * stride_A;
+            Cb += is_array ? 0 : b * stride_C;
+
+            hipblas_complex_f sum = {0, 0};
+            for(int64_t l0 = 0; !alpha_zero && l0 < k; l0 += TILE)
+            {
+                // op(A)(row, col) for the rows of C and of C^T in this tile
+                for(int t = 0; t < 2; t++)
+                {
+                    const int64_t     row = (t ? j0 : i0) + r;
+                    const int64_t     col = l0 + l;
+                    hipblas_complex_f a   = {0, 0};
+                    if(row < n && col < k)
+                        a = hipblas_syrk_ex_load(
+                            Ab, a_type, offset_A + (trans_n ? row + col * lda : col + row * lda));
+                    if(trans == HIPBLAS_OP_C)
+                        a.y = -a.y;
+                    (t ? sB : sA)[r][l] = a;
+                }
+                __syncthreads();
+
+                for(int p = 0; p < TILE; p++)
+                {
+                    hipblas_complex_f a2 = sB[threadIdx.y][p];
+                    if(HERK)
+                        a2.y = -a2.y;
+                    sum = sum + sA[threadIdx.x][p] * a2;
+                }
+                __syncthreads();
+            }
+
+            if(in_C)
+            {
+                hipblas_complex_f c = {0, 0};
+                if(beta.x != 0 || beta.y != 0)
+                    c = beta * Cb[i + j * ldc];
+                if(!alpha_zero)
+                    c = c + alpha * sum;
+                if(HERK && i == j)
+                    c.y = 0;
+                Cb[i + j * ldc] = c;
+            }
+        }
+    }
+
+    hipblas_syrk_ex_scalar hipblas_syrk_ex_host_scalar(const hipComplex* s)
+    {
+        return {{s->x, s->y}, nullptr};
+    }
+
+    hipblas_syrk_ex_scalar hipblas_syrk_ex_host_scalar(const float* s)
+    {
+        return {{*s, 0}, nullptr};
+    }
+
+    // Checks the arguments and runs the update. A of type HIP_C_32F goes to the csyrk or cherk
+    // function given by native, the narrower types are converted by hipblas_syrk_ex_kernel.
+    template <bool HERK, typename Ts, typename F>
+    hipblasStatus_t hipblasSyrkExTemplate(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t trans,
+                                          int                n,
+                                          int                k,
+                                          const Ts*          alpha,
+                                          const void*        A,
+                                          hipDataType        a_type,
+                                          int                lda,
+                                          hipblasStride      stride_A,
+                                          const Ts*          beta,
+                                          void*              C,
+                                          hipDataType        c_type,
+                                          int                ldc,
+                                          hipblasStride      stride_C,
+                                          bool               is_array,
+                                          int                batch_count,
+                                          F&&                native)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        if(uplo == HIPBLAS_FILL_MODE_FULL)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        // syrk takes N or T and herk takes N or C
+        const hipblasOperation_t other_trans = HERK ? HIPBLAS_OP_T : HIPBLAS_OP_C;
+        if(trans == other_trans)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        if((a_type != HIP_C_8I && a_type != HIP_C_16F && a_type != HIP_C_32F)
+           || c_type != HIP_C_32F)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        if(n < 0 || k < 0 || batch_count < 0 || ldc < std::max(1, n)
+           || lda < std::max(1, trans == HIPBLAS_OP_N ? n : k))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(a_type == HIP_C_32F)
+            return native();
+
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_syrk_ex_scalar alpha_arg = {{0, 0}, reinterpret_cast<const float*>(alpha)};
+        hipblas_syrk_ex_scalar beta_arg  = {{0, 0}, reinterpret_cast<const float*>(beta)};
+        if(mode == HIPBLAS_POINTER_MODE_HOST)
+        {
+            alpha_arg = hipblas_syrk_ex_host_scalar(alpha);
+            beta_arg  = hipblas_syrk_ex_host_scalar(beta);
+
+            const bool alpha_zero = (alpha_arg.value.x == 0 && alpha_arg.value.y == 0) || !k;
+            if(alpha_zero && beta_arg.value.x == 1 && beta_arg.value.y == 0)
+                return HIPBLAS_STATUS_SUCCESS;
+            if(!C || (!alpha_zero && !A))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        hipStream_t stream;
+        if((status = hipblasGetStream(handle, &stream)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        const unsigned tiles = (n - 1) / HIPBLAS_SYRK_EX_TILE + 1;
+        dim3 grid(tiles, tiles, std::min(unsigned(batch_count), HIPBLAS_SYRK_EX_GRID));
+        dim3 block(HIPBLAS_SYRK_EX_TILE, HIPBLAS_SYRK_EX_TILE);
+
+        hipLaunchKernelGGL(hipblas_syrk_ex_kernel<HERK>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           uplo,
+                           trans,
+                           n,
+                           k,
+                           alpha_arg,
+                           A,
+                           a_type,
+                           int64_t(lda),
+                           stride_A,
+                           beta_arg,
+                           C,
+                           int64_t(ldc),
+                           stride_C,
+                           is_array,
+                           batch_count);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+// syrk_ex
+hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t    handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               int                n,
+                               int                k,
+                               const hipComplex*  alpha,
+                               const void*        A,
+                               hipDataType        Atype,
+                               int                lda,
+                               const hipComplex*  beta,
+                               hipComplex*        C,
+                               hipDataType        Ctype,
+                               int                ldc)
+try
+{
+    HIPBLAS_LOG(handle, uplo, trans, n, k, alpha, A, Atype, lda, beta, C, Ctype, ldc);
+    return hipblasSyrkExTemplate<false>(
+        handle, uplo, trans, n, k, alpha, A, Atype, lda, 0, beta, C, Ctype, ldc, 0, false, 1, [&] {
+            return hipblasCsyrk_v2(
+                handle, uplo, trans, n, k, alpha, (const hipComplex*)A, lda, beta, C, ldc);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkBatchedEx(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t trans,
+                                      int                n,
+                                      int                k,
+                                      const hipComplex*  alpha,
+                                      const void* const  A[],
+                                      hipDataType        Atype,
+                                      int                lda,
+                                      const hipComplex*  beta,
+                                      hipComplex* const  C[],
+                                      hipDataType        Ctype,
+                                      int                ldc,
+                                      int                batchCount)
+try
+{
+    HIPBLAS_LOG(handle, uplo, trans, n, k, alpha, A, Atype, lda, beta, C, Ctype, ldc, batchCount);
+    return hipblasSyrkExTemplate<false>(handle,
+                                        uplo,
+                                        trans,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        Atype,
+                                        lda,
+                                        0,
+                                        beta,
+                                        (void*)C,
+                                        Ctype,
+                                        ldc,
+                                        0,
+                                        true,
+                                        batchCount,
+                                        [&] {
+                                            return hipblasCsyrkBatched_v2(
+                                                handle,
+                                                uplo,
+                                                trans,
+                                                n,
+                                                k,
+                                                alpha,
+                                                (const hipComplex* const*)A,
+                                                lda,
+                                                beta,
+                                                C,
+                                                ldc,
+                                                batchCount);
+                                        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkStridedBatchedEx(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t trans,
+                                             int                n,
+                                             int                k,
+                                             const hipComplex*  alpha,
+                                             const void*        A,
+                                             hipDataType        Atype,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             const hipComplex*  beta,
+                                             hipComplex*        C,
+                                             hipDataType        Ctype,
+                                             int                ldc,
+                                             hipblasStride      strideC,
+                                             int                batchCount)
+try
+{
+    HIPBLAS_LOG(handle, uplo, trans, n, k, alpha, A, Atype, lda, strideA, beta, C, Ctype, ldc,
+                strideC, batchCount);
+    return hipblasSyrkExTemplate<false>(handle,
+                                        uplo,
+                                        trans,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        Atype,
+                                        lda,
+                                        strideA,
+                                        beta,
+                                        C,
+                                        Ctype,
+                                        ldc,
+                                        strideC,
+                                        false,
+                                        batchCount,
+                                        [&] {
+                                            return hipblasCsyrkStridedBatched_v2(
+                                                handle,
+                                                uplo,
+                                                trans,
+                                                n,
+                                                k,
+                                                alpha,
+                                                (const hipComplex*)A,
+                                                lda,
+                                                strideA,
+                                                beta,
+                                                C,
+                                                ldc,
+                                                strideC,
+                                                batchCount);
+                                        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// herk_ex
+hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               int                n,
+                               int                k,
+                               const float*       alpha,
+                               const void*        A,
+                               hipDataType        Atype,
+                               int                lda,
+                               const float*       beta,
+                               hipComplex*        C,
+                               hipDataType        Ctype,
+                               int                ldc)
+try
+{
+    HIPBLAS_LOG(handle, uplo, trans, n, k, alpha, A, Atype, lda, beta, C, Ctype, ldc);
+    return hipblasSyrkExTemplate<true>(
+        handle, uplo, trans, n, k, alpha, A, Atype, lda, 0, beta, C, Ctype, ldc, 0, false, 1, [&] {
+            return hipblasCherk_v2(
+                handle, uplo, trans, n, k, alpha, (const hipComplex*)A, lda, beta, C, ldc);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkBatchedEx(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t trans,
+                                      int                n,
+                                      int                k,
+                                      const float*       alpha,
+                                      const void* const  A[],
+                                      hipDataType        Atype,
+                                      int                lda,
+                                      const float*       beta,
+                                      hipComplex* const  C[],
+                                      hipDataType        Ctype,
+                                      int                ldc,
+                                      int                batchCount)
+try
+{
+    HIPBLAS_LOG(handle, uplo, trans, n, k, alpha, A, Atype, lda, beta, C, Ctype, ldc, batchCount);
+    return hipblasSyrkExTemplate<true>(handle,
+                                       uplo,
+                                       trans,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       Atype,
+                                       lda,
+                                       0,
+                                       beta,
+                                       (void*)C,
+                                       Ctype,
+                                       ldc,
+                                       0,
+                                       true,
+                                       batchCount,
+                                       [&] {
+                                           return hipblasCherkBatched_v2(
+                                               handle,
+                                               uplo,
+                                               trans,
+                                               n,
+                                               k,
+                                               alpha,
+                                               (const hipComplex* const*)A,
+                                               lda,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               batchCount);
+                                       });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkStridedBatchedEx(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t trans,
+                                             int                n,
+                                             int                k,
+                                             const float*       alpha,
+                                             const void*        A,
+                                             hipDataType        Atype,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             const float*       beta,
+                                             hipComplex*        C,
+                                             hipDataType        Ctype,
+                                             int                ldc,
+                                             hipblasStride      strideC,
+                                             int                batchCount)
+try
+{
+    HIPBLAS_LOG(handle, uplo, trans, n, k, alpha, A, Atype, lda, strideA, beta, C, Ctype, ldc,
+                strideC, batchCount);
+    return hipblasSyrkExTemplate<true>(handle,
+                                       uplo,
+                                       trans,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       Atype,
+                                       lda,
+                                       strideA,
+                                       beta,
+                                       C,
+                                       Ctype,
+                                       ldc,
+                                       strideC,
+                                       false,
+                                       batchCount,
+                                       [&] {
+                                           return hipblasCherkStridedBatched_v2(
+                                               handle,
+                                               uplo,
+                                               trans,
+                                               n,
+                                               k,
+                                               alpha,
+                                               (const hipComplex*)A,
+                                               lda,
+                                               strideA,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               strideC,
+                                               batchCount);
+                                       });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
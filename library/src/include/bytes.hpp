@@ -363,7 +363,7 @@ template <typename T>
 constexpr double syr2k_gbyte_count(int n, int k)
 {
     // Read A, B, C, write C
-    return (sizeof(T) * (2 * n * k + 2 * tri_count(n)));
+    return (sizeof(T) * (2 * n * k + 2 * tri_count(n))) / 1e9;
 }
 
 /* \brief byte counts of HERK */
@@ -398,7 +398,7 @@ template <typename T>
 constexpr double dgmm_gbyte_count(int n, int m, int k)
 {
     // read A, read x, write C
-    return (sizeof(T) * (2 * m * n) + (k));
+    return (sizeof(T) * (2 * m * n + k)) / 1e9;
 }
 
 /* \brief byte counts of GEAM */
@@ -406,7 +406,7 @@ template <typename T>
 constexpr double geam_gbyte_count(int n, int m)
 {
     // read A, read B, write to C
-    return (sizeof(T) * 3 * m * n);
+    return (sizeof(T) * 3 * m * n) / 1e9;
 }
 
 /* \brief byte counts of HEMM */
@@ -414,7 +414,7 @@ template <typename T>
 constexpr double hemm_gbyte_count(int n, int m, int k)
 {
     // read A, B, C, write C
-    return (sizeof(T) * (3 * m * n + tri_count(k)));
+    return (sizeof(T) * (3 * m * n + tri_count(k))) / 1e9;
 }
 
 /* \brief byte counts of SYMM */
@@ -422,7 +422,7 @@ template <typename T>
 constexpr double symm_gbyte_count(int n, int m, int k)
 {
     // read A, B, C, write C
-    return (sizeof(T) * (3 * m * n + tri_count(k)));
+    return (sizeof(T) * (3 * m * n + tri_count(k))) / 1e9;
 }
 
 /* \brief byte counts of TRTRI */
@@ -430,7 +430,7 @@ template <typename T>
 constexpr double trtri_gbyte_count(int n)
 {
     // read A, write invA
-    return (sizeof(T) * (2 * tri_count(n)));
+    return (sizeof(T) * (2 * tri_count(n))) / 1e9;
 }
 
 #endif /* _HIPBLAS_BYTES_H_ */
@@ -0,0 +1,110 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+struct hipblasEnumInverse
+{
+};
+
+// Selects the constructor of hipblasEnumTable which maps the second enum of the pairs to the first
+constexpr hipblasEnumInverse hipblas_enum_inverse{};
+
+// Translation between two enums through an array indexed by the value of the source enum,
+// built at compile time from (From, To) pairs. The values of From must lie within Span of
+// each other, otherwise the table is not a constant expression and does not compile.
+template <typename From, typename To, size_t Span = 32>
+class hipblasEnumTable
+{
+    int64_t first_ = 0;
+    To      to_[Span]{};
+    bool    valid_[Span]{};
+
+    constexpr size_t index(From value) const
+    {
+        return size_t(int64_t(value) - first_);
+    }
+
+    template <typename Pair, size_t N, typename Key, typename Value>
+    constexpr void build(const Pair (&pairs)[N], Key key, Value value)
+    {
+        first_ = int64_t(key(pairs[0]));
+        for(size_t i = 1; i < N; i++)
+            if(int64_t(key(pairs[i])) < first_)
+                first_ = int64_t(key(pairs[i]));
+
+        for(size_t i = 0; i < N; i++)
+        {
+            size_t j  = index(key(pairs[i]));
+            to_[j]    = value(pairs[i]);
+            valid_[j] = true;
+        }
+    }
+
+public:
+    template <size_t N>
+    constexpr explicit hipblasEnumTable(const std::pair<From, To> (&pairs)[N])
+    {
+        build(
+            pairs,
+            [](const std::pair<From, To>& p) { return p.first; },
+            [](const std::pair<From, To>& p) { return p.second; });
+    }
+
+    template <size_t N>
+    constexpr hipblasEnumTable(const std::pair<To, From> (&pairs)[N], hipblasEnumInverse)
+    {
+        build(
+            pairs,
+            [](const std::pair<To, From>& p) { return p.second; },
+            [](const std::pair<To, From>& p) { return p.first; });
+    }
+
+    // True if value has an entry. A single unsigned comparison covers values below and above
+    // the range.
+    constexpr bool contains(From value) const
+    {
+        size_t i = index(value);
+        return i < Span && valid_[i];
+    }
+
+    // Translation of value, To{} if value has no entry
+    constexpr To operator[](From value) const
+    {
+        size_t i = index(value);
+        return i < Span ? to_[i] : To{};
+    }
+};
+
+// hipblasValidEnum is overloaded by every backend for the enums it translates. Checking the
+// arguments of a function up front lets the translations run without checks, and lets an
+// invalid argument return HIPBLAS_STATUS_INVALID_ENUM without throwing.
+template <typename... Ts>
+inline bool hipblasValidEnums(Ts... values)
+{
+    return (hipblasValidEnum(values) && ...);
+}
@@ -905,4 +905,125 @@ constexpr double gels_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n)
     return 4 * gels_gflop_count<float>(m, n);
 }
 
+/* \brief floating point counts of POTRF */
+template <typename T>
+constexpr double potrf_gflop_count(int64_t n)
+{
+    return ((1.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasComplex>(int64_t n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasDoubleComplex>(int64_t n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+/* \brief floating point counts of POTRS */
+template <typename T>
+constexpr double potrs_gflop_count(int64_t n, int64_t nrhs)
+{
+    return (2.0 * n * n * nrhs) / 1e9;
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasComplex>(int64_t n, int64_t nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasDoubleComplex>(int64_t n, int64_t nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
+/* \brief floating point counts of POTRI */
+template <typename T>
+constexpr double potri_gflop_count(int64_t n)
+{
+    return ((2.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasComplex>(int64_t n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasDoubleComplex>(int64_t n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
+/* \brief floating point counts of SYEVD and HEEVD, the reduction to tridiagonal form and, with
+   the eigenvectors, their back-transformation. The divide and conquer cost depends on deflation
+   and is not counted. */
+template <typename T>
+constexpr double syevd_gflop_count(char jobz, int64_t n)
+{
+    double reduction = (4.0 / 3.0) * n * n * n;
+    return (jobz == 'N' || jobz == 'n' ? reduction : reduction + 2.0 * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double syevd_gflop_count<hipblasComplex>(char jobz, int64_t n)
+{
+    return 4.0 * syevd_gflop_count<float>(jobz, n);
+}
+
+template <>
+constexpr double syevd_gflop_count<hipblasDoubleComplex>(char jobz, int64_t n)
+{
+    return 4.0 * syevd_gflop_count<float>(jobz, n);
+}
+
+/* \brief floating point counts of GESVD from the Golub-Reinsch table of Golub and Van Loan, for
+   m >= n and with the roles of U and V exchanged otherwise. The iteration on the bidiagonal form
+   is counted at its usual cost. */
+template <typename T>
+constexpr double gesvd_gflop_count(char jobu, char jobv, int64_t m, int64_t n)
+{
+    if(m < n)
+        return gesvd_gflop_count<T>(jobv, jobu, n, m);
+
+    bool   left   = jobu != 'N' && jobu != 'n';
+    bool   full   = jobu == 'A' || jobu == 'a';
+    bool   right  = jobv != 'N' && jobv != 'n';
+    double mn2    = double(m) * n * n;
+    double m2n    = double(m) * m * n;
+    double n3     = double(n) * n * n;
+    double values = 4.0 * mn2 - (4.0 / 3.0) * n3;
+    if(!left)
+        return (right ? 4.0 * mn2 + 8.0 * n3 : values) / 1e9;
+    if(full)
+        return (right ? 4.0 * m2n + 8.0 * mn2 + 9.0 * n3 : 4.0 * m2n + 8.0 * mn2) / 1e9;
+    return (right ? 14.0 * mn2 + 8.0 * n3 : 14.0 * mn2 - 2.0 * n3) / 1e9;
+}
+
+template <>
+constexpr double gesvd_gflop_count<hipblasComplex>(char jobu, char jobv, int64_t m, int64_t n)
+{
+    return 4.0 * gesvd_gflop_count<float>(jobu, jobv, m, n);
+}
+
+template <>
+constexpr double gesvd_gflop_count<hipblasDoubleComplex>(char jobu, char jobv, int64_t m, int64_t n)
+{
+    return 4.0 * gesvd_gflop_count<float>(jobu, jobv, m, n);
+}
+
+/* \brief floating point counts of GESV, the factorization and one solve in working precision */
+template <typename T>
+constexpr double gesv_gflop_count(int64_t n, int64_t nrhs)
+{
+    return getrf_gflop_count<T>(n, n) + getrs_gflop_count<T>(n, nrhs);
+}
+
 #endif /* _HIPBLAS_FLOPS_H_ */
@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+
+// FP8 types with the finite, no negative zero (FNUZ) encoding of AMD GPUs, which the gemm_ex
+// functions accept for A and B
+inline bool hipblas_is_f8(hipDataType type)
+{
+    return type == HIP_R_8F_E4M3_FNUZ || type == HIP_R_8F_E5M2_FNUZ;
+}
+
+// The type combinations with FP8 inputs: A and B of either FP8 type, C of a 16 or 32-bit float
+// type, and products accumulated in float
+inline bool hipblas_gemm_f8_types(hipDataType          a_type,
+                                  hipDataType          b_type,
+                                  hipDataType          c_type,
+                                  hipblasComputeType_t compute_type)
+{
+    return hipblas_is_f8(a_type) && hipblas_is_f8(b_type)
+           && (c_type == HIP_R_16F || c_type == HIP_R_16BF || c_type == HIP_R_32F)
+           && compute_type == HIPBLAS_COMPUTE_32F;
+}
+
+// Converts batch_count rows x cols FP8 matrices to_type (HIP_R_16F or HIP_R_16BF) matrices on
+// the stream. Both 16-bit types hold every FP8 value exactly. The source matrices are
+// A + b * stride_A, or A[b] when is_array is set, and the destinations B + b * stride_B.
+hipblasStatus_t hipblasConvertF8(hipStream_t   stream,
+                                 int64_t       rows,
+                                 int64_t       cols,
+                                 hipDataType   from_type,
+                                 const void*   A,
+                                 int64_t       lda,
+                                 hipblasStride stride_A,
+                                 bool          is_array,
+                                 hipDataType   to_type,
+                                 void*         B,
+                                 int64_t       ldb,
+                                 hipblasStride stride_B,
+                                 int64_t       batch_count);
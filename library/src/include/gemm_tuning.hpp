@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+
+// Gemm problem as stored in a tuning file. Every member is 32 bits so that the key has no
+// padding and is compared and hashed as words.
+struct hipblasGemmTuningKey
+{
+    int32_t function;
+    int32_t trans_a;
+    int32_t trans_b;
+    int32_t m;
+    int32_t n;
+    int32_t k;
+    int32_t lda;
+    int32_t ldb;
+    int32_t ldc;
+    int32_t a_type;
+    int32_t b_type;
+    int32_t c_type;
+    int32_t compute_type;
+    int32_t batch_count;
+};
+
+inline hipblasGemmTuningKey hipblas_gemm_tuning_key(hipblasGemmTuningFunction_t function,
+                                                    hipblasOperation_t          trans_a,
+                                                    hipblasOperation_t          trans_b,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    int                         lda,
+                                                    int                         ldb,
+                                                    int                         ldc,
+                                                    hipDataType                 a_type,
+                                                    hipDataType                 b_type,
+                                                    hipDataType                 c_type,
+                                                    hipblasComputeType_t        compute_type,
+                                                    int                         batch_count)
+{
+    return {function,
+            trans_a,
+            trans_b,
+            m,
+            n,
+            k,
+            lda,
+            ldb,
+            ldc,
+            a_type,
+            b_type,
+            c_type,
+            compute_type,
+            batch_count};
+}
+
+// Key of a call of the functions taking hipblasDatatype_t, with the types translated to those
+// of the HIPBLAS_V2 functions the file is written with. The types are assumed to be valid.
+hipblasGemmTuningKey hipblas_gemm_tuning_key(hipblasGemmTuningFunction_t function,
+                                             hipblasOperation_t          trans_a,
+                                             hipblasOperation_t          trans_b,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             int                         lda,
+                                             int                         ldb,
+                                             int                         ldc,
+                                             hipblasDatatype_t           a_type,
+                                             hipblasDatatype_t           b_type,
+                                             hipblasDatatype_t           c_type,
+                                             hipblasDatatype_t           compute_type,
+                                             int                         batch_count);
+
+// Solution index of the entry for key in the file named by HIPBLAS_TUNING_PATH, 0 if there is
+// no file or no entry. The file is mapped by the first call.
+int32_t hipblas_gemm_tuned_solution(const hipblasGemmTuningKey& key);
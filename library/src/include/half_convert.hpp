@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+// Bit conversions between float and the 16-bit IEEE half and bfloat16 types for the kernels of
+// the library, which do not depend on the __half and bfloat16 types of the platform.
+
+__host__ __device__ inline uint32_t hipblas_float_bits(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+__host__ __device__ inline float hipblas_bits_float(uint32_t u)
+{
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// Exact, every half is a float
+__host__ __device__ inline float hipblas_half_to_float(uint16_t h)
+{
+    const uint32_t shifted_exp = 0x7c00u << 13;
+
+    uint32_t o   = uint32_t(h & 0x7fff) << 13;
+    uint32_t exp = o & shifted_exp;
+    o += (127 - 15) << 23;
+    if(exp == shifted_exp) // Inf or NaN
+        o += (128 - 16) << 23;
+    else if(exp == 0) // zero or subnormal, renormalized by the float subtraction
+        o = hipblas_float_bits(hipblas_bits_float(o + (1 << 23)) - hipblas_bits_float(113u << 23));
+    return hipblas_bits_float(o | uint32_t(h & 0x8000) << 16);
+}
+
+// Rounds to nearest even, overflowing to Inf and keeping NaN a quiet NaN
+__host__ __device__ inline uint16_t hipblas_float_to_half(float f)
+{
+    const uint32_t denorm_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    uint32_t u    = hipblas_float_bits(f);
+    uint32_t sign = u & 0x80000000u;
+    uint16_t o;
+    u ^= sign;
+    if(u >= (127 + 16) << 23) // overflows to Inf, or NaN
+        o = u > 0x7f800000u ? 0x7e00 : 0x7c00;
+    else if(u < 113u << 23) // subnormal or zero, rounded by the float addition
+        o = uint16_t(hipblas_float_bits(hipblas_bits_float(u) + hipblas_bits_float(denorm_magic))
+                     - denorm_magic);
+    else
+    {
+        uint32_t mant_odd = (u >> 13) & 1;
+        u += 0xfff + mant_odd - ((127 - 15) << 23);
+        o = uint16_t(u >> 13);
+    }
+    return o | uint16_t(sign >> 16);
+}
+
+// bfloat16 is the upper half of a float, so the conversion to float is a shift
+__host__ __device__ inline float hipblas_bfloat16_to_float(uint16_t h)
+{
+    return hipblas_bits_float(uint32_t(h) << 16);
+}
+
+// Rounds to nearest even, keeping NaN a quiet NaN
+__host__ __device__ inline uint16_t hipblas_float_to_bfloat16(float f)
+{
+    uint32_t u = hipblas_float_bits(f);
+    if((u & 0x7fffffffu) > 0x7f800000u)
+        return uint16_t(u >> 16) | 0x40;
+    return uint16_t((u + 0x7fff + ((u >> 16) & 1)) >> 16);
+}
@@ -0,0 +1,195 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// State kept by hipBLAS for a handle which the backend library has no place for.
+// The hipblasHandle_t of the GPU backends is the rocBLAS or cuBLAS handle itself,
+// so the state is looked up in a table keyed by the handle.
+struct hipblasHandleState
+{
+    // Workspace set with hipblasSetWorkspace, nullptr when the backend manages its own memory
+    void*  workspace      = nullptr;
+    size_t workspace_size = 0;
+
+    // Largest device memory size each function was measured to need when the backend had
+    // to grow its memory, keyed by function name
+    std::unordered_map<std::string, size_t> required_workspace_sizes;
+
+    hipblasCaptureMode_t capture_mode = HIPBLAS_CAPTURE_MODE_DEFAULT;
+
+    // Internal streams, each with a backend handle, on which a call computes independent
+    // problems concurrently. group_events[0] forks them from the stream of the handle and
+    // group_events[1 + i] joins stream i back. Created by the backend on first use and
+    // destroyed with the handle.
+    std::vector<hipStream_t>     group_streams;
+    std::vector<hipblasHandle_t> group_handles;
+    std::vector<hipEvent_t>      group_events;
+
+    // Device memory hipBLAS allocates for the temporaries of calls which the backend library
+    // does not provide, see hipblasHandleDeviceMemory. Freed with the handle.
+    void*  device_memory      = nullptr;
+    size_t device_memory_size = 0;
+
+    // Largest device memory of the handle the calls measured by hipblasReserveWorkspace need
+    size_t reserved_device_memory_size = 0;
+
+    // cuSOLVER handle of the cuBLAS backend and the params of its 64-bit functions, created on
+    // first use and destroyed with the handle
+    void* solver_handle = nullptr;
+    void* solver_params = nullptr;
+};
+
+class hipblasHandleStateTable
+{
+    std::mutex                                                               mutex;
+    std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasHandleState>> states;
+
+public:
+    // Number of handles in HIPBLAS_CAPTURE_MODE_SAFE, calls skip the capture check when 0
+    std::atomic<int> safe_capture_handles{0};
+
+    // Returns the state of handle, creating it the first time handle is seen
+    hipblasHandleState& get(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto& state = states[handle];
+        if(!state)
+            state = std::make_unique<hipblasHandleState>();
+        return *state;
+    }
+
+    // Forgets the state of handle, called when the handle is destroyed
+    void erase(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto state = states.find(handle);
+        if(state == states.end())
+            return;
+        if(state->second->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            safe_capture_handles--;
+        states.erase(state);
+    }
+
+    // Sets the capture mode of handle, keeping safe_capture_handles in step
+    void set_capture_mode(hipblasHandle_t handle, hipblasCaptureMode_t mode)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto& state = states[handle];
+        if(!state)
+            state = std::make_unique<hipblasHandleState>();
+        if(state->capture_mode != mode)
+            safe_capture_handles += mode == HIPBLAS_CAPTURE_MODE_SAFE ? 1 : -1;
+        state->capture_mode = mode;
+    }
+};
+
+// Never destroyed, handles may still be destroyed during static destruction
+inline hipblasHandleStateTable& hipblas_handle_states()
+{
+    static auto* table = new hipblasHandleStateTable;
+    return *table;
+}
+
+inline hipblasHandleState& hipblas_handle_state(hipblasHandle_t handle)
+{
+    return hipblas_handle_states().get(handle);
+}
+
+// True if the stream of the handle is being captured into a hipGraph. The HIP-CPU runtime of
+// the host backend has no graphs.
+inline bool hipblasStreamCapturing(hipblasHandle_t handle)
+{
+#ifndef __HIP_PLATFORM_HOST__
+    hipStream_t            stream;
+    hipStreamCaptureStatus capture_status;
+    return hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS
+           && hipStreamIsCapturing(stream, &capture_status) == hipSuccess
+           && capture_status == hipStreamCaptureStatusActive;
+#else
+    return false;
+#endif
+}
+
+// True if the handle is in HIPBLAS_CAPTURE_MODE_SAFE and its stream is being captured
+inline bool hipblasSafeCapturing(hipblasHandle_t handle)
+{
+    return hipblas_handle_states().safe_capture_handles.load(std::memory_order_relaxed)
+           && hipblas_handle_state(handle).capture_mode == HIPBLAS_CAPTURE_MODE_SAFE
+           && hipblasStreamCapturing(handle);
+}
+
+// Returns in memory the device memory of the handle, grown to at least size bytes. It grows by
+// at least half its size, so a sequence of growing problems only reallocates a logarithmic
+// number of times, and never while the stream is captured: the call then fails with
+// HIPBLAS_STATUS_CAPTURE_UNSAFE in HIPBLAS_CAPTURE_MODE_SAFE and HIPBLAS_STATUS_ALLOC_FAILED
+// otherwise.
+inline hipblasStatus_t hipblasHandleDeviceMemory(hipblasHandle_t handle, size_t size, void** memory)
+{
+    hipblasHandleState& state = hipblas_handle_state(handle);
+    if(size > state.device_memory_size)
+    {
+        if(hipblasStreamCapturing(handle))
+            return state.capture_mode == HIPBLAS_CAPTURE_MODE_SAFE ? HIPBLAS_STATUS_CAPTURE_UNSAFE
+                                                                   : HIPBLAS_STATUS_ALLOC_FAILED;
+
+        // hipFree waits for the work queued on the old memory
+        const size_t grown
+            = std::max(size, state.device_memory_size + state.device_memory_size / 2);
+        if(state.device_memory)
+            (void)hipFree(state.device_memory);
+        state.device_memory      = nullptr;
+        state.device_memory_size = 0;
+        if(hipMalloc(&state.device_memory, grown) == hipSuccess)
+            state.device_memory_size = grown;
+        else if(hipMalloc(&state.device_memory, size) == hipSuccess)
+            state.device_memory_size = size;
+        else
+        {
+            state.device_memory = nullptr;
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+    }
+    *memory = state.device_memory;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Frees the device memory of the handle, called when the handle is destroyed
+inline void hipblasFreeDeviceMemory(hipblasHandleState& state)
+{
+    if(state.device_memory)
+        (void)hipFree(state.device_memory);
+    state.device_memory      = nullptr;
+    state.device_memory_size = 0;
+}
@@ -0,0 +1,496 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+
+// The Level-3 _64 functions use these when the backend library only has the 32-bit API.
+// A call is split into tiles whose sizes, leading dimensions and batch counts fit in int,
+// and the tiles are issued one after the other through the 32-bit function, so they run
+// in order on the handle's stream. Each tile struct holds the int arguments of one call and
+// the element offsets of its matrices, including the offset of its first batch.
+//
+// A matrix whose leading dimension does not fit in int is split into single columns, for
+// which the leading dimension is not used and is passed as the number of rows. Matrices
+// which cannot be split, like the triangular matrix of trsm, must fit in int as they are.
+
+constexpr int64_t c_hipblas_tile_max = std::numeric_limits<int>::max();
+
+// Returns true if all values can be passed to the 32-bit API as they are
+inline bool hipblasTileFits(std::initializer_list<int64_t> values)
+{
+    return std::all_of(values.begin(), values.end(), [](int64_t value) {
+        return value >= std::numeric_limits<int>::min() && value <= c_hipblas_tile_max;
+    });
+}
+
+// Most columns of a tile of a matrix with leading dimension ld
+inline int64_t hipblasTileCols(int64_t ld)
+{
+    return ld > c_hipblas_tile_max ? 1 : c_hipblas_tile_max;
+}
+
+// Leading dimension of a tile with the given number of rows
+inline int hipblasTileLd(int64_t ld, int64_t rows)
+{
+    return ld > c_hipblas_tile_max ? int(std::max<int64_t>(rows, 1)) : int(ld);
+}
+
+// Calls f(start, size) for consecutive tiles of at most max_size covering [0, n). A size of
+// 0 is still issued as one tile, so the backend applies its quick return and argument checks.
+// Stops at the first tile which fails.
+template <typename F>
+hipblasStatus_t hipblasForEachTile(int64_t n, int64_t max_size, F&& f)
+{
+    int64_t start = 0;
+    do
+    {
+        int64_t         size   = std::min(max_size, n - start);
+        hipblasStatus_t status = f(start, int(size));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        start += size;
+    } while(start < n);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// 1 in the scalar type T, hipblasHalf or a complex type with the real part first
+template <typename T>
+T hipblasTileOne()
+{
+    if constexpr(std::is_floating_point<T>{})
+        return T(1);
+    else
+    {
+        T one;
+        std::memset(static_cast<void*>(&one), 0, sizeof(one));
+        if constexpr(sizeof(T) == sizeof(uint16_t))
+        {
+            const uint16_t half_one = 0x3c00;
+            std::memcpy(static_cast<void*>(&one), &half_one, sizeof(half_one));
+        }
+        else if constexpr(sizeof(T) == 2 * sizeof(float))
+        {
+            const float real_one = 1;
+            std::memcpy(static_cast<void*>(&one), &real_one, sizeof(real_one));
+        }
+        else
+        {
+            const double real_one = 1;
+            std::memcpy(static_cast<void*>(&one), &real_one, sizeof(real_one));
+        }
+        return one;
+    }
+}
+
+// Scalars of the tiles which accumulate into C along k: the first tile uses beta and the
+// following ones 1. In device pointer mode alpha and beta are copied to the host and the
+// handle is in host pointer mode until the scalars are destroyed.
+template <typename Ta, typename Tb>
+class hipblasTileScalars
+{
+    hipblasHandle_t handle;
+    bool            restore_device_mode = false;
+    Ta              host_alpha;
+    Tb              host_beta;
+    Tb              host_one = hipblasTileOne<Tb>();
+
+public:
+    const Ta*       alpha;
+    const Tb*       beta;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    hipblasTileScalars(hipblasHandle_t handle, const Ta* alpha, const Tb* beta, bool accumulate)
+        : handle(handle)
+        , alpha(alpha)
+        , beta(beta)
+    {
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+        if(!accumulate || !alpha || !beta
+           || (status = hipblasGetPointerMode(handle, &mode)) != HIPBLAS_STATUS_SUCCESS
+           || mode == HIPBLAS_POINTER_MODE_HOST)
+            return;
+
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return;
+        if(hipMemcpyAsync(&host_alpha, alpha, sizeof(Ta), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipMemcpyAsync(&host_beta, beta, sizeof(Tb), hipMemcpyDeviceToHost, stream)
+                  != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+        {
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            return;
+        }
+
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return;
+        restore_device_mode = true;
+        this->alpha         = &host_alpha;
+        this->beta          = &host_beta;
+    }
+
+    ~hipblasTileScalars()
+    {
+        if(restore_device_mode)
+            hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    }
+
+    hipblasTileScalars(const hipblasTileScalars&) = delete;
+    hipblasTileScalars& operator=(const hipblasTileScalars&) = delete;
+
+    const Tb* tile_beta(int64_t k_start) const
+    {
+        return k_start ? &host_one : beta;
+    }
+};
+
+struct hipblasBatchTile
+{
+    int     batch_count;
+    int64_t offset;
+};
+
+// The matrices of the batched functions are behind device pointer arrays which can only be
+// offset as a whole, so only the batch is split and all other values must fit in int
+template <typename F>
+hipblasStatus_t hipblasBatchTiles(hipblasHandle_t                handle,
+                                  std::initializer_list<int64_t> values,
+                                  int64_t                        batch_count,
+                                  F&&                            f)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasTileFits(values))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasForEachTile(batch_count, c_hipblas_tile_max, [&](int64_t b, int batch) {
+        return f(hipblasBatchTile{batch, b});
+    });
+}
+
+struct hipblasGemmTile
+{
+    int     m, n, k, lda, ldb, ldc, batch_count;
+    int64_t offset_A, offset_B, offset_C;
+};
+
+// Tiles of gemm along m, n, k and the batch. Calls f(tile, alpha, beta), the tiles after the
+// first along k accumulate into C.
+template <typename T, typename F>
+hipblasStatus_t hipblasGemmTiles(hipblasHandle_t    handle,
+                                 hipblasOperation_t transA,
+                                 hipblasOperation_t transB,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const T*           alpha,
+                                 int64_t            lda,
+                                 hipblasStride      strideA,
+                                 int64_t            ldb,
+                                 hipblasStride      strideB,
+                                 const T*           beta,
+                                 int64_t            ldc,
+                                 hipblasStride      strideC,
+                                 int64_t            batch_count,
+                                 F&&                f)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool    normalA = transA == HIPBLAS_OP_N, normalB = transB == HIPBLAS_OP_N;
+    int64_t rowsA = normalA ? m : k, rowsB = normalB ? k : n;
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max<int64_t>(rowsA, 1)
+       || ldb < std::max<int64_t>(rowsB, 1) || ldc < std::max<int64_t>(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int64_t max_m = normalA ? c_hipblas_tile_max : hipblasTileCols(lda);
+    int64_t max_n
+        = std::min(hipblasTileCols(ldc), normalB ? hipblasTileCols(ldb) : c_hipblas_tile_max);
+    int64_t max_k = std::min(normalA ? hipblasTileCols(lda) : c_hipblas_tile_max,
+                             normalB ? c_hipblas_tile_max : hipblasTileCols(ldb));
+
+    hipblasTileScalars<T, T> scalars(handle, alpha, beta, k > max_k);
+    if(scalars.status != HIPBLAS_STATUS_SUCCESS)
+        return scalars.status;
+
+    return hipblasForEachTile(batch_count, c_hipblas_tile_max, [&](int64_t b, int batch) {
+        return hipblasForEachTile(n, max_n, [&](int64_t j, int tile_n) {
+            return hipblasForEachTile(m, max_m, [&](int64_t i, int tile_m) {
+                return hipblasForEachTile(k, max_k, [&](int64_t l, int tile_k) {
+                    hipblasGemmTile t;
+                    t.m           = tile_m;
+                    t.n           = tile_n;
+                    t.k           = tile_k;
+                    t.lda         = hipblasTileLd(lda, normalA ? tile_m : tile_k);
+                    t.ldb         = hipblasTileLd(ldb, normalB ? tile_k : tile_n);
+                    t.ldc         = hipblasTileLd(ldc, tile_m);
+                    t.batch_count = batch;
+                    t.offset_A    = b * strideA + (normalA ? i + l * lda : l + i * lda);
+                    t.offset_B    = b * strideB + (normalB ? l + j * ldb : j + l * ldb);
+                    t.offset_C    = b * strideC + i + j * ldc;
+                    return f(t, scalars.alpha, scalars.tile_beta(l));
+                });
+            });
+        });
+    });
+}
+
+struct hipblasRankKTile
+{
+    int     n, k, lda, ldb, ldc, batch_count;
+    int64_t offset_A, offset_B, offset_C;
+};
+
+// Tiles of syrk, herk, syr2k, her2k, syrkx and herkx along k and the batch, C must fit in int.
+// Functions without B pass the leading dimension and stride of A for it. Calls
+// f(tile, alpha, beta), the tiles after the first along k accumulate into C.
+template <typename Ta, typename Tb, typename F>
+hipblasStatus_t hipblasRankKTiles(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int64_t            n,
+                                  int64_t            k,
+                                  const Ta*          alpha,
+                                  int64_t            lda,
+                                  hipblasStride      strideA,
+                                  int64_t            ldb,
+                                  hipblasStride      strideB,
+                                  const Tb*          beta,
+                                  int64_t            ldc,
+                                  hipblasStride      strideC,
+                                  int64_t            batch_count,
+                                  F&&                f)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool    normal = trans == HIPBLAS_OP_N;
+    int64_t rows   = normal ? n : k;
+    if(n < 0 || k < 0 || batch_count < 0 || lda < std::max<int64_t>(rows, 1)
+       || ldb < std::max<int64_t>(rows, 1) || ldc < std::max<int64_t>(n, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!hipblasTileFits({n, ldc}) || (!normal && !hipblasTileFits({lda, ldb})))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int64_t max_k
+        = normal ? std::min(hipblasTileCols(lda), hipblasTileCols(ldb)) : c_hipblas_tile_max;
+
+    hipblasTileScalars<Ta, Tb> scalars(handle, alpha, beta, k > max_k);
+    if(scalars.status != HIPBLAS_STATUS_SUCCESS)
+        return scalars.status;
+
+    return hipblasForEachTile(batch_count, c_hipblas_tile_max, [&](int64_t b, int batch) {
+        return hipblasForEachTile(k, max_k, [&](int64_t l, int tile_k) {
+            hipblasRankKTile t;
+            t.n           = int(n);
+            t.k           = tile_k;
+            t.lda         = hipblasTileLd(lda, normal ? n : tile_k);
+            t.ldb         = hipblasTileLd(ldb, normal ? n : tile_k);
+            t.ldc         = int(ldc);
+            t.batch_count = batch;
+            t.offset_A    = b * strideA + (normal ? l * lda : l);
+            t.offset_B    = b * strideB + (normal ? l * ldb : l);
+            t.offset_C    = b * strideC;
+            return f(t, scalars.alpha, scalars.tile_beta(l));
+        });
+    });
+}
+
+struct hipblasSideTile
+{
+    int     m, n, ldb, ldc, batch_count;
+    int64_t offset_A, offset_B, offset_C;
+};
+
+// Tiles of symm, hemm, trmm and trsm along the dimension of B and C which A is not applied
+// to, n for HIPBLAS_SIDE_LEFT and m for HIPBLAS_SIDE_RIGHT, and the batch. A must fit in int.
+// trsm passes the leading dimension and stride of B for C.
+template <typename F>
+hipblasStatus_t hipblasSideTiles(hipblasHandle_t   handle,
+                                 hipblasSideMode_t side,
+                                 int64_t           m,
+                                 int64_t           n,
+                                 int64_t           lda,
+                                 hipblasStride     strideA,
+                                 int64_t           ldb,
+                                 hipblasStride     strideB,
+                                 int64_t           ldc,
+                                 hipblasStride     strideC,
+                                 int64_t           batch_count,
+                                 F&&               f)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool    left = side == HIPBLAS_SIDE_LEFT;
+    int64_t ka   = left ? m : n;
+    if(m < 0 || n < 0 || batch_count < 0 || lda < std::max<int64_t>(ka, 1)
+       || ldb < std::max<int64_t>(m, 1) || ldc < std::max<int64_t>(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!hipblasTileFits({ka, lda}) || (!left && !hipblasTileFits({ldb, ldc})))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int64_t max_m = left ? m : c_hipblas_tile_max;
+    int64_t max_n = left ? std::min(hipblasTileCols(ldb), hipblasTileCols(ldc)) : n;
+
+    return hipblasForEachTile(batch_count, c_hipblas_tile_max, [&](int64_t b, int batch) {
+        return hipblasForEachTile(n, std::max<int64_t>(max_n, 1), [&](int64_t j, int tile_n) {
+            return hipblasForEachTile(m, std::max<int64_t>(max_m, 1), [&](int64_t i, int tile_m) {
+                hipblasSideTile t;
+                t.m           = tile_m;
+                t.n           = tile_n;
+                t.ldb         = hipblasTileLd(ldb, tile_m);
+                t.ldc         = hipblasTileLd(ldc, tile_m);
+                t.batch_count = batch;
+                t.offset_A    = b * strideA;
+                t.offset_B    = b * strideB + i + j * ldb;
+                t.offset_C    = b * strideC + i + j * ldc;
+                return f(t);
+            });
+        });
+    });
+}
+
+struct hipblasGeamTile
+{
+    int     m, n, lda, ldb, ldc, batch_count;
+    int64_t offset_A, offset_B, offset_C;
+};
+
+// Tiles of geam along m, n and the batch
+template <typename F>
+hipblasStatus_t hipblasGeamTiles(hipblasHandle_t    handle,
+                                 hipblasOperation_t transA,
+                                 hipblasOperation_t transB,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 int64_t            lda,
+                                 hipblasStride      strideA,
+                                 int64_t            ldb,
+                                 hipblasStride      strideB,
+                                 int64_t            ldc,
+                                 hipblasStride      strideC,
+                                 int64_t            batch_count,
+                                 F&&                f)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool normalA = transA == HIPBLAS_OP_N, normalB = transB == HIPBLAS_OP_N;
+    if(m < 0 || n < 0 || batch_count < 0 || lda < std::max<int64_t>(normalA ? m : n, 1)
+       || ldb < std::max<int64_t>(normalB ? m : n, 1) || ldc < std::max<int64_t>(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int64_t max_m = std::min(normalA ? c_hipblas_tile_max : hipblasTileCols(lda),
+                             normalB ? c_hipblas_tile_max : hipblasTileCols(ldb));
+    int64_t max_n = std::min({hipblasTileCols(ldc),
+                              normalA ? hipblasTileCols(lda) : c_hipblas_tile_max,
+                              normalB ? hipblasTileCols(ldb) : c_hipblas_tile_max});
+
+    return hipblasForEachTile(batch_count, c_hipblas_tile_max, [&](int64_t b, int batch) {
+        return hipblasForEachTile(n, max_n, [&](int64_t j, int tile_n) {
+            return hipblasForEachTile(m, max_m, [&](int64_t i, int tile_m) {
+                hipblasGeamTile t;
+                t.m           = tile_m;
+                t.n           = tile_n;
+                t.lda         = hipblasTileLd(lda, normalA ? tile_m : tile_n);
+                t.ldb         = hipblasTileLd(ldb, normalB ? tile_m : tile_n);
+                t.ldc         = hipblasTileLd(ldc, tile_m);
+                t.batch_count = batch;
+                t.offset_A    = b * strideA + (normalA ? i + j * lda : j + i * lda);
+                t.offset_B    = b * strideB + (normalB ? i + j * ldb : j + i * ldb);
+                t.offset_C    = b * strideC + i + j * ldc;
+                return f(t);
+            });
+        });
+    });
+}
+
+struct hipblasDgmmTile
+{
+    int     m, n, lda, incx, ldc, batch_count;
+    int64_t offset_A, offset_x, offset_C;
+};
+
+// Tiles of dgmm along m, n and the batch. With a negative incx the tiles of x are counted
+// from its end, like its elements.
+template <typename F>
+hipblasStatus_t hipblasDgmmTiles(hipblasHandle_t   handle,
+                                 hipblasSideMode_t side,
+                                 int64_t           m,
+                                 int64_t           n,
+                                 int64_t           lda,
+                                 hipblasStride     strideA,
+                                 int64_t           incx,
+                                 hipblasStride     stridex,
+                                 int64_t           ldc,
+                                 hipblasStride     strideC,
+                                 int64_t           batch_count,
+                                 F&&               f)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool left = side == HIPBLAS_SIDE_LEFT;
+    if(m < 0 || n < 0 || batch_count < 0 || lda < std::max<int64_t>(m, 1)
+       || ldc < std::max<int64_t>(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // A tile of a single element of x does not use incx
+    int64_t max_x = hipblasTileFits({incx}) ? c_hipblas_tile_max : 1;
+    int64_t max_m = left ? max_x : c_hipblas_tile_max;
+    int64_t max_n
+        = std::min({hipblasTileCols(lda), hipblasTileCols(ldc), left ? c_hipblas_tile_max : max_x});
+    int64_t len_x = left ? m : n;
+
+    return hipblasForEachTile(batch_count, c_hipblas_tile_max, [&](int64_t b, int batch) {
+        return hipblasForEachTile(n, max_n, [&](int64_t j, int tile_n) {
+            return hipblasForEachTile(m, max_m, [&](int64_t i, int tile_m) {
+                int64_t start_x = left ? i : j, size_x = left ? tile_m : tile_n;
+
+                hipblasDgmmTile t;
+                t.m           = tile_m;
+                t.n           = tile_n;
+                t.lda         = hipblasTileLd(lda, tile_m);
+                t.incx        = hipblasTileFits({incx}) ? int(incx) : 1;
+                t.ldc         = hipblasTileLd(ldc, tile_m);
+                t.batch_count = batch;
+                t.offset_A    = b * strideA + i + j * lda;
+                t.offset_x    = b * stridex
+                             + (incx >= 0 ? start_x * incx : (len_x - start_x - size_x) * -incx);
+                t.offset_C = b * strideC + i + j * ldc;
+                return f(t);
+            });
+        });
+    });
+}
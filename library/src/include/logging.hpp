@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Bits of the HIPBLAS_LAYER environment variable
+enum hipblas_layer_mode : int
+{
+    hipblas_layer_mode_none      = 0,
+    hipblas_layer_mode_log_trace = 1, // YAML record of every call, HIPBLAS_LOG_TRACE_PATH
+    hipblas_layer_mode_log_bench = 2, // hipblas-bench command lines, HIPBLAS_LOG_BENCH_PATH
+    hipblas_layer_mode_log       = hipblas_layer_mode_log_trace | hipblas_layer_mode_log_bench,
+    hipblas_layer_mode_profile   = 4, // timing summary of every handle, HIPBLAS_PROFILE_PATH
+};
+
+// Upper bound on the arguments of a logged function, including the handle
+#define HIPBLAS_LOG_MAX_ARGS 32
+
+enum class hipblasLogKind : uint8_t
+{
+    integer,
+    pointer,
+    operation,
+    fill,
+    diagonal,
+    side,
+    datatype, // hipblasDatatype_t
+    data_type, // hipDataType
+    compute_type,
+    gemm_algo,
+    gemm_flags,
+    pointer_mode,
+    atomics_mode,
+    math_mode,
+    capture_mode,
+    eig_mode,
+    svd_mode,
+    real, // scalar passed by value or read through a host pointer
+    complex,
+};
+
+// Type pointed to by a pointer argument, so alpha and beta can be read in host pointer mode
+enum class hipblasLogScalar : uint8_t
+{
+    none,
+    f16,
+    bf16,
+    f32,
+    f64,
+    c32,
+    c64,
+    untyped, // void*, the type is given by a datatype argument of the function
+};
+
+struct hipblasLogArg
+{
+    hipblasLogKind   kind;
+    hipblasLogScalar scalar;
+    union
+    {
+        int64_t     i;
+        const void* p;
+        double      d[2];
+    };
+};
+
+// Argument names of a call site, split once from the stringized argument list of HIPBLAS_LOG
+struct hipblasLogNames
+{
+    std::vector<std::string> names;
+
+    explicit hipblasLogNames(const char* list);
+};
+
+struct hipblasLogRecord
+{
+    uint64_t               call; // order of the call in the process
+    const char*            function;
+    const hipblasLogNames* names; // names[0] is the handle, names[i + 1] names args[i]
+    hipblasHandle_t        handle;
+    hipStream_t            stream;
+    int                    device;
+    hipblasPointerMode_t   pointer_mode;
+    hipblasAtomicsMode_t   atomics_mode;
+    hipblasMath_t          math_mode;
+    int                    nargs;
+    hipblasLogArg          args[HIPBLAS_LOG_MAX_ARGS];
+};
+
+int hipblas_layer_from_env();
+
+// HIPBLAS_LAYER, read once. With hipblas_profiled_handles, the only cost of the logging and
+// profiling layers when they are off.
+inline int hipblas_layer()
+{
+    static const int layer = hipblas_layer_from_env();
+    return layer;
+}
+
+// Number of handles profiled with hipblasProfileStart, calls skip the profiler when 0
+inline std::atomic<int>& hipblas_profiled_handles()
+{
+    static std::atomic<int> handles{0};
+    return handles;
+}
+
+// Reserves the next record in the ring buffer of the calling thread and records the handle settings
+hipblasLogRecord&
+    hipblas_log_begin(const char* function, const hipblasLogNames& names, hipblasHandle_t handle);
+
+// Reads alpha and beta in host pointer mode and hands the record to the flushing thread
+void hipblas_log_end(hipblasLogRecord& record);
+
+// Splits hipblasSgemmStridedBatched_64 into the hipblas-bench function gemm_strided_batched,
+// the precision f32_r and the C_64 API. Ex functions take their precision from their
+// datatype arguments, precision is left empty.
+void hipblas_bench_function(const char*  function,
+                            std::string& bench_function,
+                            std::string& precision,
+                            bool&        ilp64);
+
+// Name of the value of an enum argument, nullptr if the argument is no enum
+const char* hipblas_log_enum(const hipblasLogArg& arg);
+
+struct hipblasProfileCall;
+
+// Records hipEvents around a call when its handle is profiled, the stop event is recorded when
+// the function returns
+struct hipblasProfileScope
+{
+    hipblasProfileCall* call = nullptr;
+
+    hipblasProfileScope() = default;
+    hipblasProfileScope(const hipblasProfileScope&) = delete;
+    hipblasProfileScope& operator=(const hipblasProfileScope&) = delete;
+
+    ~hipblasProfileScope();
+};
+
+// Records the start event of a call, nullptr if the handle is not profiled
+hipblasProfileCall* hipblas_profile_begin(const char*            function,
+                                          const hipblasLogNames& names,
+                                          hipblasHandle_t        handle,
+                                          const hipblasLogArg*   args,
+                                          int                    nargs);
+
+// Records the stop event of a call
+void hipblas_profile_end(hipblasProfileCall* call);
+
+inline hipblasProfileScope::~hipblasProfileScope()
+{
+    if(call)
+        hipblas_profile_end(call);
+}
+
+// Writes the summary of handle and forgets it, called when the handle is destroyed
+void hipblas_profile_destroy(hipblasHandle_t handle);
+
+template <typename T>
+constexpr hipblasLogScalar hipblas_log_scalar()
+{
+    using U = std::remove_cv_t<T>;
+    if(std::is_same<U, float>{})
+        return hipblasLogScalar::f32;
+    else if(std::is_same<U, double>{})
+        return hipblasLogScalar::f64;
+    else if(std::is_same<U, hipblasHalf>{})
+        return hipblasLogScalar::f16;
+    else if(std::is_same<U, hipblasBfloat16>{})
+        return hipblasLogScalar::bf16;
+    else if(std::is_same<U, hipblasComplex>{} || std::is_same<U, hipFloatComplex>{})
+        return hipblasLogScalar::c32;
+    else if(std::is_same<U, hipblasDoubleComplex>{} || std::is_same<U, hipDoubleComplex>{})
+        return hipblasLogScalar::c64;
+    else if(std::is_void<U>{})
+        return hipblasLogScalar::untyped;
+    return hipblasLogScalar::none;
+}
+
+template <typename T>
+inline void hipblas_log_arg(hipblasLogArg& arg, T* value)
+{
+    arg.kind   = hipblasLogKind::pointer;
+    arg.scalar = hipblas_log_scalar<T>();
+    arg.p      = value;
+}
+
+template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+inline void hipblas_log_arg(hipblasLogArg& arg, T value)
+{
+    arg.kind   = hipblasLogKind::integer;
+    arg.scalar = hipblasLogScalar::none;
+    arg.i      = int64_t(value);
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>{}, int> = 0>
+inline void hipblas_log_arg(hipblasLogArg& arg, T value)
+{
+    arg.kind   = hipblasLogKind::real;
+    arg.scalar = hipblas_log_scalar<T>();
+    arg.d[0]   = value;
+}
+
+#define HIPBLAS_LOG_ENUM(TYPE, KIND)                                \
+    inline void hipblas_log_arg(hipblasLogArg& arg, TYPE value)     \
+    {                                                               \
+        arg.kind   = hipblasLogKind::KIND;                          \
+        arg.scalar = hipblasLogScalar::none;                        \
+        arg.i      = int64_t(value);                                \
+    }
+
+HIPBLAS_LOG_ENUM(hipblasOperation_t, operation)
+HIPBLAS_LOG_ENUM(hipblasFillMode_t, fill)
+HIPBLAS_LOG_ENUM(hipblasDiagType_t, diagonal)
+HIPBLAS_LOG_ENUM(hipblasSideMode_t, side)
+#ifndef HIPBLAS_V2
+HIPBLAS_LOG_ENUM(hipblasDatatype_t, datatype)
+#endif
+HIPBLAS_LOG_ENUM(hipDataType, data_type)
+HIPBLAS_LOG_ENUM(hipblasComputeType_t, compute_type)
+HIPBLAS_LOG_ENUM(hipblasGemmAlgo_t, gemm_algo)
+HIPBLAS_LOG_ENUM(hipblasGemmFlags_t, gemm_flags)
+HIPBLAS_LOG_ENUM(hipblasPointerMode_t, pointer_mode)
+HIPBLAS_LOG_ENUM(hipblasAtomicsMode_t, atomics_mode)
+HIPBLAS_LOG_ENUM(hipblasMath_t, math_mode)
+HIPBLAS_LOG_ENUM(hipblasCaptureMode_t, capture_mode)
+HIPBLAS_LOG_ENUM(hipblasEigMode_t, eig_mode)
+HIPBLAS_LOG_ENUM(hipblasSvdMode_t, svd_mode)
+
+#undef HIPBLAS_LOG_ENUM
+
+template <typename... Ts>
+void hipblas_log_call(hipblasProfileScope&   scope,
+                      const char*            function,
+                      const hipblasLogNames& names,
+                      hipblasHandle_t        handle,
+                      const Ts&... args)
+{
+    static_assert(sizeof...(Ts) <= HIPBLAS_LOG_MAX_ARGS, "Increase HIPBLAS_LOG_MAX_ARGS");
+
+    hipblasLogArg log_args[sizeof...(Ts) + 1];
+    int           nargs = 0;
+    (hipblas_log_arg(log_args[nargs++], args), ...);
+
+    if(hipblas_layer() & hipblas_layer_mode_log)
+    {
+        hipblasLogRecord& record = hipblas_log_begin(function, names, handle);
+        std::copy(log_args, log_args + nargs, record.args);
+        record.nargs = nargs;
+        hipblas_log_end(record);
+    }
+
+    if((hipblas_layer() & hipblas_layer_mode_profile)
+       || hipblas_profiled_handles().load(std::memory_order_relaxed))
+        scope.call = hipblas_profile_begin(function, names, handle, log_args, nargs);
+}
+
+// Records a call for the logging layers and the profiler. The first argument is the handle,
+// the arguments are named in the log as in the argument list. Declares the scope timing the
+// call, so it must be the first statement of the function.
+#define HIPBLAS_LOG(...)                                                                    \
+    hipblasProfileScope hipblas_profile_scope;                                              \
+    if(hipblas_layer() || hipblas_profiled_handles().load(std::memory_order_relaxed))       \
+    {                                                                                       \
+        static const hipblasLogNames hipblas_log_names(#__VA_ARGS__);                       \
+        hipblas_log_call(hipblas_profile_scope, __func__, hipblas_log_names, __VA_ARGS__);  \
+    }
@@ -0,0 +1,54 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+
+// Copies batch_count rows x cols matrices of elem_size bytes from the matrices of the device
+// pointer array A to the matrices of the device pointer array B with a kernel on the stream.
+// Used by the backends to write the C of a batched gemm to a D apart from it.
+hipblasStatus_t hipblasCopyMatrixBatched(hipStream_t       stream,
+                                         int64_t           rows,
+                                         int64_t           cols,
+                                         int               elem_size,
+                                         const void* const A[],
+                                         int64_t           lda,
+                                         void* const       B[],
+                                         int64_t           ldb,
+                                         int64_t           batch_count);
+
+// Copies batch_count rows x cols matrices of elem_size bytes from A + b * stride_A to
+// B + b * stride_B on the stream, with one kernel launch for up to 65535 matrices.
+hipblasStatus_t hipblasCopyMatrixStridedBatched(hipStream_t   stream,
+                                                int64_t       rows,
+                                                int64_t       cols,
+                                                int           elem_size,
+                                                const void*   A,
+                                                int64_t       lda,
+                                                hipblasStride stride_A,
+                                                void*         B,
+                                                int64_t       ldb,
+                                                hipblasStride stride_B,
+                                                int64_t       batch_count);